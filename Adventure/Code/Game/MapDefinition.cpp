@@ -7,7 +7,7 @@
 std::map< std::string, MapDefinition* > MapDefinition::s_mapDefinitions;
 
 //---------------------------------------------------------------------------------------------------------
-MapDefinition::MapDefinition( const XmlElement& element )
+MapDefinition::MapDefinition( const BakedXmlElement& element )
 {
 	m_name = ParseXmlAttribute( element, "name", m_name );
 
@@ -26,19 +26,19 @@ MapDefinition::MapDefinition( const XmlElement& element )
 //---------------------------------------------------------------------------------------------------------
 void MapDefinition::InitializeMapDefinitions()
 {
-	XmlDocument mapDefinitionXml = new XmlDocument();
+	BakedXmlDocument mapDefinitionXml;
 	mapDefinitionXml.LoadFile( "Data/Definitions/MapDefinitions.xml" );
 	GUARANTEE_OR_DIE( mapDefinitionXml.ErrorID() == 0, "MapDefinitions.xml does not exist in Run/Data/Definitions" );
 
-	const XmlElement* rootElement = mapDefinitionXml.RootElement();
-	const XmlElement* nextDefinition = rootElement->FirstChildElement();
+	const BakedXmlElement* rootElement = mapDefinitionXml.RootElement();
+	const BakedXmlElement* nextDefinition = rootElement->FirstChildElement();
 
 	while( nextDefinition )
 	{
 		MapDefinition* newMapDefinition = new MapDefinition( *nextDefinition );
 		s_mapDefinitions[ newMapDefinition->m_name ] = newMapDefinition;
 
-		const XmlElement* mapGenStepElement = nextDefinition->FirstChildElement( "MapGenSteps" );
+		const BakedXmlElement* mapGenStepElement = nextDefinition->FirstChildElement( "MapGenSteps" );
 		mapGenStepElement = mapGenStepElement->FirstChildElement();
 		while( mapGenStepElement )
 		{
@@ -1,5 +1,5 @@
 #pragma once
-#include "Engine/Core/XmlUtils.hpp"
+#include "Engine/Core/BakedXml.hpp"
 #include "Engine/Math/IntVec2.hpp"
 #include <map>
 #include <string>
@@ -10,7 +10,7 @@ class MapGenStep;
 class MapDefinition
 {
 private:
-	explicit MapDefinition( const XmlElement& element );
+	explicit MapDefinition( const BakedXmlElement& element );
 
 public:
 	std::string		GetName()				{ return m_name; }
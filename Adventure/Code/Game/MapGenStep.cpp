@@ -9,7 +9,7 @@
 
 
 //---------------------------------------------------------------------------------------------------------
-MapGenStep::MapGenStep( const XmlElement& element )
+MapGenStep::MapGenStep( const BakedXmlElement& element )
 {
 	m_iterations	= ParseXmlAttribute( element, "iterations", m_iterations );
 	m_chancePerTile	= ParseXmlAttribute( element, "chancePerTile", m_chancePerTile );
@@ -44,7 +44,7 @@ void MapGenStep::RunStep( Map& map )
 
 
 //---------------------------------------------------------------------------------------------------------
-MapGenStep* MapGenStep::CreateMapGenStep( const XmlElement& element )
+MapGenStep* MapGenStep::CreateMapGenStep( const BakedXmlElement& element )
 {
 	std::string mapGenStepType = element.Name();
 	if( mapGenStepType == "Mutate" )				return new MapGenStep_Mutate( element );
@@ -1,5 +1,5 @@
 #pragma once
-#include "Engine/Core/XmlUtils.hpp"
+#include "Engine/Core/BakedXml.hpp"
 #include "Engine/Math/FloatRange.hpp"
 
 class TileDefinition;
@@ -8,12 +8,12 @@ class Map;
 class MapGenStep
 {
 public:
-	explicit MapGenStep( const XmlElement& element );
+	explicit MapGenStep( const BakedXmlElement& element );
 
 	void RunStep( Map& map );
 
 public:
-	static MapGenStep* CreateMapGenStep( const XmlElement& element );
+	static MapGenStep* CreateMapGenStep( const BakedXmlElement& element );
 
 protected:
 	virtual void RunStepOnce( Map& map ) = 0;
@@ -10,7 +10,7 @@
 
 
 //---------------------------------------------------------------------------------------------------------
-MapGenStep_CellularAutomata::MapGenStep_CellularAutomata( const XmlElement& element )
+MapGenStep_CellularAutomata::MapGenStep_CellularAutomata( const BakedXmlElement& element )
 	: MapGenStep( element )
 {
 	m_neighborRadius		= ParseXmlAttribute( element, "NeighborRadius", m_neighborRadius );
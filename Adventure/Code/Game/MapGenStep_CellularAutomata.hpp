@@ -17,7 +17,7 @@ enum Direction
 class MapGenStep_CellularAutomata : public MapGenStep
 {
 public:
-	explicit MapGenStep_CellularAutomata( const XmlElement& element );
+	explicit MapGenStep_CellularAutomata( const BakedXmlElement& element );
 
 	virtual void	RunStepOnce( Map& map ) override;
 	void			SetMetaDataIfNeighborsTile( Map& map, const Tile& currentTile, int currentTileIndex,  int necessaryNumNeighbors );
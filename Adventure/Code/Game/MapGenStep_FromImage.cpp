@@ -7,7 +7,7 @@
 
 
 //---------------------------------------------------------------------------------------------------------
-MapGenStep_FromImage::MapGenStep_FromImage( const XmlElement& element )
+MapGenStep_FromImage::MapGenStep_FromImage( const BakedXmlElement& element )
 	:MapGenStep( element )
 {
 	m_imageFilePath = ParseXmlAttribute( element, "ImageFilePath", m_imageFilePath );
@@ -1,13 +1,13 @@
 #pragma once
 #include "Game/MapGenStep.hpp"
-#include "Engine/Core/XmlUtils.hpp"
+#include "Engine/Core/BakedXml.hpp"
 
 class Map;
 
 class MapGenStep_FromImage : public MapGenStep
 {
 public:
-	MapGenStep_FromImage( const XmlElement& element );
+	MapGenStep_FromImage( const BakedXmlElement& element );
 
 	virtual void RunStepOnce( Map& map ) override;
 
@@ -8,7 +8,7 @@
 
 
 //---------------------------------------------------------------------------------------------------------
-MapGenStep_Mutate::MapGenStep_Mutate( const XmlElement& element )
+MapGenStep_Mutate::MapGenStep_Mutate( const BakedXmlElement& element )
 	: MapGenStep( element )
 {
 	m_maxNumTilesToChange = ParseXmlAttribute( element, "NumTilesToChange", m_maxNumTilesToChange );
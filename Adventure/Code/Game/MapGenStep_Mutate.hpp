@@ -6,7 +6,7 @@ class Map;
 class MapGenStep_Mutate : public MapGenStep
 {
 public:
-	explicit MapGenStep_Mutate( const XmlElement& element );
+	explicit MapGenStep_Mutate( const BakedXmlElement& element );
 
 	virtual void RunStepOnce( Map& map ) override;
 
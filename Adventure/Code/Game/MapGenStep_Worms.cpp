@@ -8,7 +8,7 @@
 
 
 //---------------------------------------------------------------------------------------------------------
-MapGenStep_Worms::MapGenStep_Worms( const XmlElement& element )
+MapGenStep_Worms::MapGenStep_Worms( const BakedXmlElement& element )
 	: MapGenStep( element )
 {
 	m_numWorms		= ParseXmlAttribute( element, "NumWorms", m_numWorms );
@@ -7,7 +7,7 @@ class Map;
 class MapGenStep_Worms : public MapGenStep
 {
 public:
-	explicit MapGenStep_Worms( const XmlElement& element );
+	explicit MapGenStep_Worms( const BakedXmlElement& element );
 
 	virtual void RunStepOnce( Map& map ) override;
 
@@ -10,6 +10,7 @@
 #include "Engine/Network/NetworkSystem.hpp"
 #include "Engine/Platform/Window.hpp"
 #include "Engine/Core/Clock.hpp"
+#include "Engine/Core/FileUtils.hpp"
 #include "Engine/Core/DebugRender.hpp"
 #include "Engine/Core/NamedProperties.hpp"
 #include "Engine/Math/RandomNumberGenerator.hpp"
@@ -20,6 +21,7 @@
 #include "Game/RemoteServer.hpp"
 #include "Game/PlayerClient.hpp"
 #include "Game/RemoteClient.hpp"
+#include "Game/NetworkSimulation.hpp"
 #include "Game/MapRegion.hpp"
 #include "Game/EntityDef.hpp"
 #include "Game/MapMaterial.hpp"
@@ -76,15 +78,89 @@ void App::StartUp()
 	g_theEventSystem->SubscribeEventCallbackFunction( "help", HelpCommand );
 	g_theEventSystem->SubscribeEventCallbackMethod( "Host", this, &App::start_multiplayer_server );
 	g_theEventSystem->SubscribeEventCallbackMethod( "Connect", this, &App::connect_to_mulitplayer_server );
+	g_theEventSystem->SubscribeEventCallbackFunction( "NetSimTest", NetworkSimulationTest );
 
 	m_devConsoleCamera = new Camera( g_theRenderer );
 	m_devConsoleCamera->SetOrthoView( Vec2( -HALF_SCREEN_X, -HALF_SCREEN_Y ), Vec2( HALF_SCREEN_X, HALF_SCREEN_Y ) );
+
+	StartInputRecordingOrReplay();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void App::StartInputRecordingOrReplay()
+{
+	m_inputReplayPath		= g_gameConfigBlackboard.GetValue( "replayInput", "" );
+	m_inputRecordingPath	= g_gameConfigBlackboard.GetValue( "recordInput", "" );
+
+	if( !m_inputReplayPath.empty() )
+	{
+		if( m_inputPlayback.LoadFromFile( m_inputReplayPath ) )
+		{
+			g_theConsole->PrintString( Rgba8::GREEN, "Replaying %u frames of input from %s", m_inputPlayback.GetFrameCount(), m_inputReplayPath.c_str() );
+			m_replayStartSeconds = GetCurrentTimeSeconds();
+		}
+	}
+	else if( !m_inputRecordingPath.empty() )
+	{
+		g_theConsole->PrintString( Rgba8::GREEN, "Recording input to %s", m_inputRecordingPath.c_str() );
+		m_inputRecorder.BeginRecording();
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Runs once the last recorded frame has been simulated, or at shutdown if the recording itself quit the game.
+// The hash only covers what GetWorldData exposes, so compare it between builds replaying the same file.
+void App::FinishInputReplay()
+{
+	double wallSeconds = GetCurrentTimeSeconds() - m_replayStartSeconds;
+	uint framesPlayed = m_inputPlayback.GetFrameIndex();
+	uint64_t worldStateHash = g_theGame != nullptr ? g_theGame->GetWorldStateHash() : 0;
+
+	std::string result = Stringf( "frames=%u wallMs=%.3f msPerFrame=%.4f worldHash=%016llx\n", 
+		framesPlayed, 
+		wallSeconds * 1000.0, 
+		framesPlayed > 0 ? wallSeconds * 1000.0 / static_cast<double>( framesPlayed ) : 0.0,
+		static_cast<unsigned long long>( worldStateHash ) );
+
+	g_theConsole->PrintString( Rgba8::GREEN, "Replay of %s finished: %s", m_inputReplayPath.c_str(), result.c_str() );
+	FileWriteFromBuffer( m_inputReplayPath + ".result.txt", result.data(), result.size() );
+
+	Clock::SetFixedFrameSeconds( 0.0 );
+	m_inputPlayback = InputPlayback();
+	HandleQuitRequested();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void App::SaveInputRecording()
+{
+	m_inputRecorder.EndRecording();
+	if( m_inputRecorder.SaveToFile( m_inputRecordingPath ) )
+	{
+		g_theConsole->PrintString( Rgba8::GREEN, "Saved %u frames of input (%u bytes) to %s", m_inputRecorder.GetFrameCount(), static_cast<uint>( m_inputRecorder.GetEncodedSize() ), m_inputRecordingPath.c_str() );
+	}
+	else
+	{
+		g_theConsole->PrintString( Rgba8::RED, "Could not save input recording to %s", m_inputRecordingPath.c_str() );
+	}
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 void App::ShutDown()
 {
+	if( IsReplayingInput() )
+	{
+		FinishInputReplay();
+	}
+
+	if( m_inputRecorder.IsRecording() )
+	{
+		SaveInputRecording();
+	}
+
  	delete m_devConsoleCamera;
  	m_devConsoleCamera = nullptr;
 
@@ -205,6 +281,37 @@ STATIC void App::HelpCommand( EventArgs* args )
 	}
 }
 
+//---------------------------------------------------------------------------------------------------------
+// Runs prediction and snapshot interpolation over a fake lossy, jittery loopback link
+STATIC void App::NetworkSimulationTest( EventArgs* args )
+{
+	float loss		= args->GetValue( "loss", 0.1f );
+	double latency	= args->GetValue( "latency", 0.08 );
+	double jitter	= args->GetValue( "jitter", 0.04 );
+	double seconds	= args->GetValue( "seconds", 20.0 );
+
+	network_simulation_results_t results;
+	bool hasPassed = RunNetworkSimulationTest( loss, latency, jitter, seconds, results );
+
+	g_theConsole->PrintString( Rgba8::WHITE, "Simulated link: %.0f%% loss, %.0fms latency, %.0fms jitter, %.1fs", loss * 100.f, latency * 1000.0, jitter * 1000.0, seconds );
+	g_theConsole->PrintString( results.isPredictionSettled ? Rgba8::GREEN : Rgba8::RED, "  Prediction: %u input packets (%u dropped), %u commands lost, %u corrections (last %.3f), final error %.5f",
+		results.inputPacketsSent,
+		results.inputPacketsDropped,
+		results.lostCommandCount,
+		results.correctionCount,
+		results.lastCorrectionDistance,
+		results.predictionError );
+	g_theConsole->PrintString( results.isInterpolationClose ? Rgba8::GREEN : Rgba8::RED, "  Interpolation: %u snapshots (%u dropped, %u discarded), error mean %.4f max %.4f, %u extrapolated frames",
+		results.snapshotsSent,
+		results.snapshotsDropped,
+		results.snapshotsDiscarded,
+		results.meanInterpolationError,
+		results.maxInterpolationError,
+		results.extrapolatedSampleCount );
+	g_theConsole->PrintString( hasPassed ? Rgba8::GREEN : Rgba8::RED, hasPassed ? "Network simulation test passed" : "Network simulation test failed" );
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 void App::RunFrame()
 {
@@ -227,10 +334,34 @@ bool App::HandleQuitRequested()
 //---------------------------------------------------------------------------------------------------------
 void App::BeginFrame()
 {
+	// A replayed frame steps the clock by the delta it was recorded with instead of by wall time
+	if( IsReplayingInput() )
+	{
+		double deltaSeconds = 0.0;
+		if( m_inputPlayback.ReadNextFrame( m_replayInputState, deltaSeconds ) )
+		{
+			Clock::SetFixedFrameSeconds( deltaSeconds );
+		}
+		else
+		{
+			FinishInputReplay();
+		}
+	}
+
 	Clock::BeginFrame();
 
 	g_theRenderer->BeginFrame();
 	g_theInput->BeginFrame();
+
+	if( IsReplayingInput() )
+	{
+		g_theInput->SetFromInputState( m_replayInputState );
+	}
+	else if( m_inputRecorder.IsRecording() )
+	{
+		m_inputRecorder.RecordFrame( g_theInput->GetInputState(), Clock::GetMaster()->GetLastDeltaSeconds() );
+	}
+
 	g_theAudio->BeginFrame();
 	g_theNetworkSystem->BeginFrame();
 	m_theServer->BeginFrame();
@@ -288,4 +419,5 @@ void App::EndFrame()
 	g_theNetworkSystem->EndFrame();
 
 	DebugRenderEndFrame();
+	Clock::EndFrame();
 }
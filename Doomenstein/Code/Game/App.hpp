@@ -1,6 +1,8 @@
 #pragma once
 #include "Engine/Core/EventSystem.hpp"
 #include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Input/InputRecording.hpp"
+#include <string>
 
 class Camera;
 class Server;
@@ -12,6 +14,13 @@ private:
 	Server*	m_theServer			= nullptr;
 	Camera*	m_devConsoleCamera	= nullptr;
 
+	InputRecorder	m_inputRecorder;
+	InputPlayback	m_inputPlayback;
+	std::string		m_inputRecordingPath;
+	std::string		m_inputReplayPath;
+	InputState		m_replayInputState;
+	double			m_replayStartSeconds	= 0.0;
+
 public:
 	App() {};
 	~App() {};
@@ -26,13 +35,19 @@ public:
 
 	static void HelpCommand( EventArgs* args );
 	static void QuitRequested( EventArgs* args );
+	static void NetworkSimulationTest( EventArgs* args );
 	bool HandleQuitRequested();
 
 	const bool IsQuitting() const { return m_isQuitting; }
+	bool IsReplayingInput() const { return m_inputPlayback.IsLoaded(); }
 
 private:
 	void BeginFrame();
 	void Update();
 	void Render() const;
 	void EndFrame();
+
+	void StartInputRecordingOrReplay();
+	void FinishInputReplay();
+	void SaveInputRecording();
 };
\ No newline at end of file
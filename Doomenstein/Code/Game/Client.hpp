@@ -1,17 +1,10 @@
 #pragma once
 #include "Engine/Math/Vec3.hpp"
 #include "Game/Server.hpp"
+#include "Game/NetworkData.hpp"
 
 struct UDPMessage;
 
-struct CameraData
-{
-	Vec3 m_position;
-	float m_yawDegrees = 0.f;
-	float m_pitchDegrees = 0.f;
-	float m_rollDegrees = 0.f;
-};
-
 class Client
 {
 public:
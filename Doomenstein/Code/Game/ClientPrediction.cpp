@@ -0,0 +1,223 @@
+#include "Engine/Input/InputRecording.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Game/ClientPrediction.hpp"
+#include <string.h>
+
+
+//---------------------------------------------------------------------------------------------------------
+// Below this the server and the prediction agree; float noise isn't a misprediction
+constexpr float MIN_CORRECTION_DISTANCE = 0.001f;
+
+
+//---------------------------------------------------------------------------------------------------------
+void WriteInputCommandPacket( std::deque<InputCommand> const& commands, std::vector<unsigned char>& out_packet )
+{
+	out_packet.clear();
+	if( commands.empty() )
+		return;
+
+	size_t commandCount = Min( static_cast<uint>( commands.size() ), MAX_INPUT_COMMANDS_PER_PACKET );
+	size_t firstCommandIndex = commands.size() - commandCount;
+
+	InputRecorder recorder;
+	recorder.BeginRecording();
+	for( size_t commandIndex = firstCommandIndex; commandIndex < commands.size(); ++commandIndex )
+	{
+		recorder.RecordFrame( commands[ commandIndex ].m_inputState, commands[ commandIndex ].m_deltaSeconds );
+	}
+	recorder.EndRecording();
+
+	std::vector<unsigned char> recording;
+	recorder.WriteToBuffer( recording );
+
+	uint32_t firstSequence = commands[ firstCommandIndex ].m_sequence;
+	out_packet.resize( sizeof( firstSequence ) );
+	memcpy( out_packet.data(), &firstSequence, sizeof( firstSequence ) );
+	out_packet.insert( out_packet.end(), recording.begin(), recording.end() );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool ReadInputCommandPacket( unsigned char const* packet, size_t packetSize, std::vector<InputCommand>& out_commands )
+{
+	out_commands.clear();
+
+	uint32_t firstSequence = 0;
+	if( packetSize < sizeof( firstSequence ) + sizeof( input_recording_header_t ) )
+		return false;
+
+	memcpy( &firstSequence, packet, sizeof( firstSequence ) );
+
+	InputPlayback playback;
+	if( !playback.LoadFromBuffer( packet + sizeof( firstSequence ), packetSize - sizeof( firstSequence ) ) )
+		return false;
+
+	InputCommand command;
+	double deltaSeconds = 0.0;
+	while( playback.ReadNextFrame( command.m_inputState, deltaSeconds ) )
+	{
+		command.m_sequence = firstSequence + playback.GetFrameIndex() - 1;
+		command.m_deltaSeconds = static_cast<float>( deltaSeconds );
+		out_commands.push_back( command );
+	}
+	return out_commands.size() == playback.GetFrameCount();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+Vec3 GetFreeCameraTranslation( float deltaSeconds, float yawDegrees, InputSystem* input )
+{
+	float forwardMoveAmount = 0.f;
+	float leftMoveAmount = 0.f;
+	float upMoveAmount = 0.f;
+	float moveSpeed = 2.f * deltaSeconds;
+	if( input->IsKeyPressed( KEY_CODE_SHIFT ) )
+	{
+		moveSpeed *= 2.f;
+	}
+
+	if( input->IsKeyPressed( 'W' ) )
+	{
+		forwardMoveAmount += moveSpeed;
+	}	
+	if( input->IsKeyPressed( 'S' ) )
+	{
+		forwardMoveAmount -= moveSpeed;
+	}	
+
+	if( input->IsKeyPressed( 'A' ) )
+	{
+		leftMoveAmount += moveSpeed;
+	}	
+	if( input->IsKeyPressed( 'D' ) )
+	{
+		leftMoveAmount -= moveSpeed;
+	}
+
+	if( input->IsKeyPressed( 'Q' ) )
+	{
+		upMoveAmount += moveSpeed;
+	}
+	if( input->IsKeyPressed( 'E' ) )
+	{
+		upMoveAmount -= moveSpeed;
+	}
+
+	Vec3 cameraForwardXY0 = Vec3( CosDegrees( yawDegrees ), SinDegrees( yawDegrees ), 0.f );
+	Vec3 cameraLeftXY0 = Vec3( -SinDegrees( yawDegrees ), CosDegrees( yawDegrees ), 0.f );
+	Vec3 cameraTranslation = ( cameraForwardXY0 * forwardMoveAmount ) + ( cameraLeftXY0 * leftMoveAmount );
+	cameraTranslation.z = upMoveAmount;
+
+	return cameraTranslation;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void SimulateCameraLook( CameraData& cameraData, InputSystem* input )
+{
+	Vec2 relativeMovement = input->GetCursorRelativeMovement();
+	cameraData.m_pitchDegrees += -relativeMovement.y;
+	cameraData.m_yawDegrees += relativeMovement.x;
+	Clamp( cameraData.m_pitchDegrees, -89.9f, 89.9f );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void SimulateFreeCameraCommand( CameraData& cameraData, InputSystem* input, float deltaSeconds )
+{
+	SimulateCameraLook( cameraData, input );
+	cameraData.m_position += GetFreeCameraTranslation( deltaSeconds, cameraData.m_yawDegrees, input );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+ClientPrediction::ClientPrediction()
+{
+	m_replayInput = new InputSystem();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+ClientPrediction::~ClientPrediction()
+{
+	delete m_replayInput;
+	m_replayInput = nullptr;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+InputCommand const& ClientPrediction::AddLocalCommand( InputState const& inputState, float deltaSeconds )
+{
+	// The server has stopped answering; the oldest commands can't be usefully replayed any more
+	if( m_unacknowledgedCommands.size() >= MAX_UNACKNOWLEDGED_INPUT_COMMANDS )
+	{
+		m_unacknowledgedCommands.pop_front();
+		m_predictionAfterCommand.pop_front();
+	}
+
+	InputCommand command;
+	command.m_sequence		= m_nextSequence++;
+	command.m_deltaSeconds	= deltaSeconds;
+	command.m_inputState	= inputState;
+
+	ApplyCommand( command );
+	m_unacknowledgedCommands.push_back( command );
+	m_predictionAfterCommand.push_back( m_predictedCamera );
+	return m_unacknowledgedCommands.back();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void ClientPrediction::Reconcile( CameraData const& authoritativeCamera )
+{
+	uint acknowledgedSequence = authoritativeCamera.m_lastProcessedInputSequence;
+	if( acknowledgedSequence < m_lastAcknowledgedSequence )
+		return;		// arrived out of order; a newer camera has already been applied
+
+	m_lastAcknowledgedSequence = acknowledgedSequence;
+	while( !m_unacknowledgedCommands.empty() && m_unacknowledgedCommands.front().m_sequence <= acknowledgedSequence )
+	{
+		if( m_unacknowledgedCommands.front().m_sequence == acknowledgedSequence )
+		{
+			CameraData const& predictedCamera = m_predictionAfterCommand.front();
+			float correctionDistance = GetDistance3D( predictedCamera.m_position, authoritativeCamera.m_position );
+			if( correctionDistance > MIN_CORRECTION_DISTANCE && !authoritativeCamera.m_isPossessingEntity )
+			{
+				m_lastCorrectionDistance = correctionDistance;
+				++m_correctionCount;
+			}
+		}
+
+		m_unacknowledgedCommands.pop_front();
+		m_predictionAfterCommand.pop_front();
+	}
+
+	m_predictedCamera = authoritativeCamera;
+	for( size_t commandIndex = 0; commandIndex < m_unacknowledgedCommands.size(); ++commandIndex )
+	{
+		ApplyCommand( m_unacknowledgedCommands[ commandIndex ] );
+		m_predictionAfterCommand[ commandIndex ] = m_predictedCamera;
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void ClientPrediction::WriteUnacknowledgedCommands( std::vector<unsigned char>& out_packet ) const
+{
+	WriteInputCommandPacket( m_unacknowledgedCommands, out_packet );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void ClientPrediction::ApplyCommand( InputCommand const& command )
+{
+	m_replayInput->SetFromInputState( command.m_inputState );
+	if( m_predictedCamera.m_isPossessingEntity )
+	{
+		SimulateCameraLook( m_predictedCamera, m_replayInput );
+	}
+	else
+	{
+		SimulateFreeCameraCommand( m_predictedCamera, m_replayInput, command.m_deltaSeconds );
+	}
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include "Engine/Input/InputSystem.hpp"
+#include "Game/NetworkData.hpp"
+#include <deque>
+#include <vector>
+
+
+//---------------------------------------------------------------------------------------------------------
+constexpr uint MAX_INPUT_COMMANDS_PER_PACKET		= 16;
+constexpr uint MAX_UNACKNOWLEDGED_INPUT_COMMANDS	= 128;
+
+
+//---------------------------------------------------------------------------------------------------------
+struct InputCommand
+{
+	uint		m_sequence		= 0;
+	float		m_deltaSeconds	= 0.f;
+	InputState	m_inputState;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// An input packet is the first command's sequence number followed by an input recording of up to
+// MAX_INPUT_COMMANDS_PER_PACKET consecutive commands, so a lost packet is covered by the next one
+void WriteInputCommandPacket( std::deque<InputCommand> const& commands, std::vector<unsigned char>& out_packet );
+bool ReadInputCommandPacket( unsigned char const* packet, size_t packetSize, std::vector<InputCommand>& out_commands );
+
+// The steps both the server and the predicting client run for one command
+Vec3 GetFreeCameraTranslation( float deltaSeconds, float yawDegrees, InputSystem* input );
+void SimulateCameraLook( CameraData& cameraData, InputSystem* input );
+void SimulateFreeCameraCommand( CameraData& cameraData, InputSystem* input, float deltaSeconds );
+
+
+//---------------------------------------------------------------------------------------------------------
+// Runs the local player's commands on the client as soon as they're made instead of waiting for the server's
+// camera to come back. Every command is kept until the server says it has processed it; when the server's
+// camera arrives, the prediction restarts from it and replays the commands the server hasn't seen yet.
+//
+// Only look is predicted while possessing an entity; its movement depends on collision the client
+// doesn't run, so the position comes from the server.
+//---------------------------------------------------------------------------------------------------------
+class ClientPrediction
+{
+public:
+	ClientPrediction();
+	~ClientPrediction();
+
+	InputCommand const&	AddLocalCommand( InputState const& inputState, float deltaSeconds );
+	void				Reconcile( CameraData const& authoritativeCamera );
+	void				WriteUnacknowledgedCommands( std::vector<unsigned char>& out_packet ) const;
+
+	CameraData const&	GetPredictedCamera() const				{ return m_predictedCamera; }
+	uint				GetUnacknowledgedCount() const			{ return static_cast<uint>( m_unacknowledgedCommands.size() ); }
+	uint				GetLastAcknowledgedSequence() const		{ return m_lastAcknowledgedSequence; }
+	uint				GetCorrectionCount() const				{ return m_correctionCount; }
+	float				GetLastCorrectionDistance() const		{ return m_lastCorrectionDistance; }
+
+private:
+	void ApplyCommand( InputCommand const& command );
+
+private:
+	InputSystem*				m_replayInput				= nullptr;
+	CameraData					m_predictedCamera;
+	std::deque<InputCommand>	m_unacknowledgedCommands;
+	std::deque<CameraData>		m_predictionAfterCommand;		// parallel to m_unacknowledgedCommands
+
+	uint						m_nextSequence				= 1;
+	uint						m_lastAcknowledgedSequence	= 0;
+	uint						m_correctionCount			= 0;
+	float						m_lastCorrectionDistance	= 0.f;
+};
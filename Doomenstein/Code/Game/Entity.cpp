@@ -4,8 +4,10 @@
 #include "Engine/Core/Rgba8.hpp"
 #include "Engine/Renderer/RenderContext.hpp"
 #include "Engine/Renderer/SpriteSheet.hpp"
+#include "Engine/Renderer/SpriteAnimSystem.hpp"
 #include "Engine/Renderer/MeshUtils.hpp"
 #include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/MathUtils.hpp"
 #include "Game/Entity.hpp"
 #include "Game/Game.hpp"
 #include "Game/App.hpp"
@@ -16,6 +18,7 @@
 
 STATIC int Entity::s_entityID = 0;
 
+
 //---------------------------------------------------------------------------------------------------------
 Entity::Entity( Game* theGame, World* theWorld, Map* theMap, EntityDef const& entityDef, XmlElement const& element )
 	: m_entityDef( entityDef )
@@ -33,6 +36,7 @@ Entity::Entity( Game* theGame, World* theWorld, Map* theMap, EntityDef const& en
 	m_topLeft		= Vec3( 0.f, -spriteDimensions.x * 0.5f, spriteDimensions.y );
 
 	SetValuesFromXML( element );
+	UpdateSpriteAnim();
 }
 
 
@@ -49,12 +53,19 @@ Entity::Entity( Game* theGame, World* theWorld, Map* theMap, EntityDef const& en
 	m_bottomRight	= Vec3( 0.f, spriteDimensions.x * 0.5f, 0.f );
 	m_topRight		= Vec3( 0.f, spriteDimensions.x * 0.5f, spriteDimensions.y );
 	m_topLeft		= Vec3( 0.f, -spriteDimensions.x * 0.5f, spriteDimensions.y );
+
+	UpdateSpriteAnim();
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 Entity::~Entity()
 {
+	SpriteAnimSystem* spriteAnims = m_theGame->GetSpriteAnims();
+	if( spriteAnims != nullptr )
+	{
+		spriteAnims->DestroyInstance( m_spriteAnim );
+	}
 }
 
 
@@ -66,51 +77,18 @@ void Entity::Update()
 
 	m_forwardDirection = Vec2::MakeFromPolarDegrees( m_yaw ); 
 	UpdateAnimDirection(); //Should happen last
+	UpdateSpriteAnim();
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+// The billboard itself is batched by TileMap::RenderEntities through AppendSpriteVerts
 //---------------------------------------------------------------------------------------------------------
 void Entity::Render() const
 {
 // 	if( m_isPossessed )
 // 		return;
 
-	SpriteSheet* spriteSheet = m_entityDef.GetSpriteSheet();
-
-	if( spriteSheet != nullptr )
-	{
-		SpriteDefinition const* currentSpriteDef = m_entityDef.GetSpriteDefinitionForAnimSetAtTime( m_actionState, m_currentSpriteDirection, 0.f );
-		BillboardType billboardType = m_entityDef.GetBillBoardType();
-		Mat44 billboardTransform = GetBillboardTransformMatrix( *m_theGame->GetPlayerCamera(), m_position, billboardType );
-		
-		Vec3 bottomLeft		= billboardTransform.TransformPosition3D( m_bottomLeft );
-		Vec3 bottomRight	= billboardTransform.TransformPosition3D( m_bottomRight );
-		Vec3 topRight		= billboardTransform.TransformPosition3D( m_topRight );
-		Vec3 topLeft		= billboardTransform.TransformPosition3D( m_topLeft );
-
-		Vec2 bottomLeftUV;
-		Vec2 topRightUV;
-		currentSpriteDef->GetUVs( bottomLeftUV, topRightUV );
-		Vec2 bottomRightUV	= Vec2( topRightUV.x, bottomLeftUV.y );
-		Vec2 topLeftUV		= Vec2( bottomLeftUV.x, topRightUV.y );
-
-		std::vector<Vertex_PCU> vertexArray;
-
-		vertexArray.push_back( Vertex_PCU( bottomLeft,	Rgba8::WHITE,	bottomLeftUV	) );
-		vertexArray.push_back( Vertex_PCU( bottomRight, Rgba8::WHITE,	bottomRightUV	) );
-		vertexArray.push_back( Vertex_PCU( topRight,	Rgba8::WHITE,	topRightUV		) );
-
-		vertexArray.push_back( Vertex_PCU( bottomLeft,	Rgba8::WHITE,	bottomLeftUV	) );
-		vertexArray.push_back( Vertex_PCU( topRight,	Rgba8::WHITE,	topRightUV		) );
-		vertexArray.push_back( Vertex_PCU( topLeft,		Rgba8::WHITE,	topLeftUV		) );
-
-		g_theRenderer->BindTexture( &spriteSheet->GetTexture() );
-		g_theRenderer->BindShaderByPath( "Data/Shaders/WorldOpaque.hlsl" );
-
-		//TranslateVertexArray( vertexArray, m_position );
-		g_theRenderer->DrawVertexArray( vertexArray );
-	}
-
 	RenderHealthBar();
 
 	if( g_isDebugDraw )
@@ -120,6 +98,36 @@ void Entity::Render() const
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+void Entity::AppendSpriteVerts( std::vector<Vertex_PCU>& vertexArray ) const
+{
+	AABB2 const* spriteUVs = m_theGame->GetSpriteAnims()->GetInstanceUVs( m_spriteAnim );
+	if( spriteUVs == nullptr )
+		return;
+
+	BillboardType billboardType = m_entityDef.GetBillBoardType();
+	Mat44 billboardTransform = GetBillboardTransformMatrix( *m_theGame->GetPlayerCamera(), m_position, billboardType );
+	
+	Vec3 bottomLeft		= billboardTransform.TransformPosition3D( m_bottomLeft );
+	Vec3 bottomRight	= billboardTransform.TransformPosition3D( m_bottomRight );
+	Vec3 topRight		= billboardTransform.TransformPosition3D( m_topRight );
+	Vec3 topLeft		= billboardTransform.TransformPosition3D( m_topLeft );
+
+	Vec2 bottomLeftUV	= spriteUVs->mins;
+	Vec2 topRightUV		= spriteUVs->maxes;
+	Vec2 bottomRightUV	= Vec2( topRightUV.x, bottomLeftUV.y );
+	Vec2 topLeftUV		= Vec2( bottomLeftUV.x, topRightUV.y );
+
+	vertexArray.push_back( Vertex_PCU( bottomLeft,	Rgba8::WHITE,	bottomLeftUV	) );
+	vertexArray.push_back( Vertex_PCU( bottomRight, Rgba8::WHITE,	bottomRightUV	) );
+	vertexArray.push_back( Vertex_PCU( topRight,	Rgba8::WHITE,	topRightUV		) );
+
+	vertexArray.push_back( Vertex_PCU( bottomLeft,	Rgba8::WHITE,	bottomLeftUV	) );
+	vertexArray.push_back( Vertex_PCU( topRight,	Rgba8::WHITE,	topRightUV		) );
+	vertexArray.push_back( Vertex_PCU( topLeft,		Rgba8::WHITE,	topLeftUV		) );
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 void Entity::RenderHealthBar() const
 {
@@ -151,7 +159,7 @@ void Entity::RenderHealthBar() const
 	vertexArray.push_back( Vertex_PCU( t_backgroundTopLeft,		Rgba8::GRAY ) );
 	
 	g_theRenderer->BindTexture( nullptr );
-	g_theRenderer->BindShaderByPath( "Data/Shaders/WorldOpaque.hlsl" );
+	g_theRenderer->BindShaderByHandle( m_theMap->GetWorldOpaqueShader() );
 
 	g_theRenderer->DrawVertexArray( vertexArray );
 
@@ -267,6 +275,14 @@ std::string Entity::GetEntityName() const
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+Texture const* Entity::GetSpriteTexture() const
+{
+	SpriteSheet const* spriteSheet = m_entityDef.GetSpriteSheet();
+	return spriteSheet != nullptr ? &spriteSheet->GetTexture() : nullptr;
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 EntityType Entity::GetEntityType() const
 {
@@ -281,6 +297,22 @@ float Entity::GetHeight() const
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+// Billboards spin about m_position, so a sphere there reaching the furthest sprite or health bar corner
+// covers every facing
+//---------------------------------------------------------------------------------------------------------
+Sphere3 Entity::GetRenderBounds() const
+{
+	float radius = Maxf( Maxf( m_bottomLeft.GetLength(), m_bottomRight.GetLength() ), Maxf( m_topLeft.GetLength(), m_topRight.GetLength() ) );
+
+	float healthBarTop = GetHeight() + 0.3f;
+	float healthBarCornerLength = Vec3( 0.f, GetPhysicsRadius(), healthBarTop ).GetLength();
+	radius = Maxf( radius, healthBarCornerLength );
+
+	return Sphere3( m_position, radius );
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 float Entity::GetEyeHeight() const
 {
@@ -350,6 +382,38 @@ void Entity::UpdateAnimDirection()
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+// Turning keeps the walk cycle where it was; a new action starts its animation over. Action states that
+// only have some directions (Death is usually just "front") fall back to the front view.
+//---------------------------------------------------------------------------------------------------------
+void Entity::UpdateSpriteAnim()
+{
+	SpriteAnimSystem* spriteAnims = m_theGame->GetSpriteAnims();
+	if( spriteAnims == nullptr || m_entityDef.GetSpriteSheet() == nullptr )
+		return;
+
+	uint clip = m_entityDef.GetAnimClip( m_actionState, m_currentSpriteDirection );
+	if( clip == INVALID_SPRITE_ANIM_CLIP )
+	{
+		clip = m_entityDef.GetAnimClip( m_actionState, "front" );
+	}
+	if( clip == INVALID_SPRITE_ANIM_CLIP )
+		return;
+
+	if( !spriteAnims->GetInstanceUVs( m_spriteAnim ) )
+	{
+		m_spriteAnim = spriteAnims->CreateInstance( clip );
+	}
+	else if( clip != m_spriteAnimClip )
+	{
+		spriteAnims->SetInstanceClip( m_spriteAnim, clip, m_actionState != m_spriteAnimActionState );
+	}
+
+	m_spriteAnimClip = clip;
+	m_spriteAnimActionState = m_actionState;
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 void Entity::CheckAndUpdateSpriteDirection( Vec2 const& directionToCompare, std::string const& directionName, Vec2 const& direction )
 {
@@ -1,35 +1,17 @@
 #pragma once
 #include "Game/EntityDef.hpp"
+#include "Game/NetworkData.hpp"
 #include "Engine/Math/Vec3.hpp"
+#include "Engine/Math/Sphere3.hpp"
+#include "Engine/Core/HandlePool.hpp"
 #include <string>
+#include <vector>
 
 class Game;
 class World;
 class Map;
-
-struct EntityData
-{
-	bool	m_isPossessed			= false;
-	bool	m_canBePushedByWalls	= true;
-	bool	m_canBePushedByEntities = true;
-	bool	m_canPushEntities		= true;
-	float	m_mass					= 1.f;
-	bool	m_isDead				= true;
-	int		m_currentHealth			= 0;
-
-	Vec3		m_position;
-	Vec2		m_forwardDirection;
-	float		m_yaw				= 0.f;
-	char		m_actionState[25]	= "Walk";
-	char		m_entityDefName[50] = "";
-};
-
-struct EntitySpawnData
-{
-	bool m_isUsed = false;
-	char m_entityDefName[50] = "";
-	EntityData m_data;
-};
+struct Texture;
+struct Vertex_PCU;
 
 
 //---------------------------------------------------------------------------------------------------------
@@ -45,6 +27,7 @@ public:
 	//---------------------------------------------------------------------------------------------------------
 	virtual void Update();
 	virtual void Render() const;
+	void AppendSpriteVerts( std::vector<Vertex_PCU>& vertexArray ) const;
 	virtual void RenderHealthBar() const;
 	virtual void DebugRender() const;
 	virtual void SetValuesFromXML( XmlElement const& element );
@@ -66,9 +49,12 @@ public:
 	float		GetEyeHeight() const;
 	float		GetSpeed() const;
 	float		GetPhysicsRadius() const;
+	Sphere3		GetRenderBounds() const;
+	Texture const*	GetSpriteTexture() const;
 	EntityData	GetEntityData() const;
 
 	void UpdateAnimDirection();
+	void UpdateSpriteAnim();
 	void CheckAndUpdateSpriteDirection( Vec2 const& directionToCompare, std::string const& directionName, Vec2 const& direction );
 
 	//---------------------------------------------------------------------------------------------------------
@@ -112,4 +98,8 @@ protected:
 	float		m_yaw				= 0.f;
 	std::string	m_actionState		= "Walk";
 	std::string m_currentSpriteDirection = "front";
+
+	PoolHandle	m_spriteAnim;
+	uint		m_spriteAnimClip	= INVALID_SPRITE_ANIM_CLIP;
+	std::string	m_spriteAnimActionState;
 };
\ No newline at end of file
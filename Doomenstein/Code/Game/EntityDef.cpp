@@ -2,21 +2,25 @@
 #include "Game/GameCommon.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/AssetRegistry.hpp"
 #include "Engine/Core/FileUtils.hpp"
 #include "Engine/Renderer/SpriteSheet.hpp"
 #include "Engine/Renderer/SpriteAnimDefinition.hpp"
 #include "Engine/Renderer/SpriteAnimSet.hpp"
+#include "Engine/Renderer/SpriteAtlas.hpp"
 #include "Engine/Renderer/Texture.hpp"
 #include "Engine/Renderer/RenderContext.hpp"
 
 
 //---------------------------------------------------------------------------------------------------------
-STATIC std::map<std::string, EntityDef*>	EntityDef::s_entityDefs;
-STATIC std::map<std::string, SpriteSheet*>	EntityDef::s_spriteSheets;
+STATIC std::unordered_map<std::string, EntityDef*>	EntityDef::s_entityDefs;
+STATIC std::unordered_map<std::string, SpriteSheet*>	EntityDef::s_spriteSheets;
+STATIC SpriteAtlas*									EntityDef::s_spriteAtlas = nullptr;
+STATIC SpriteAnimClipTable							EntityDef::s_animClips;
 
 
 //---------------------------------------------------------------------------------------------------------
-EntityDef::EntityDef( XmlElement const& xmlElement, EntityType entityType )
+EntityDef::EntityDef( BakedXmlElement const& xmlElement, EntityType entityType )
 {
 	bool hasFailedToParse		= false;
 	bool hasParsedPhysics		= false;
@@ -31,7 +35,7 @@ EntityDef::EntityDef( XmlElement const& xmlElement, EntityType entityType )
 		return;
 	}
 	
-	if( s_entityDefs[m_name] != nullptr )
+	if( s_entityDefs.find( m_name ) != s_entityDefs.end() )
 	{
 		g_theConsole->ErrorString( "Entity of name \"%s\" already exists", m_name.c_str() );
 		return;
@@ -39,7 +43,7 @@ EntityDef::EntityDef( XmlElement const& xmlElement, EntityType entityType )
 
 	//if( entityType != ENTITY_TYPE_PORTAL )
 	{
-		XmlElement const* nextChildElement = xmlElement.FirstChildElement();
+		BakedXmlElement const* nextChildElement = xmlElement.FirstChildElement();
 		for( ;; )
 		{
 			if( nextChildElement == nullptr )
@@ -144,7 +148,22 @@ SpriteDefinition const* EntityDef::GetSpriteDefinitionForAnimSetAtTime( std::str
 
 
 //---------------------------------------------------------------------------------------------------------
-bool EntityDef::ParsePhysicsNode( XmlElement const& element )
+uint EntityDef::GetAnimClip( std::string const& animSetName, std::string const& direction ) const
+{
+	auto animSetIter = m_animClips.find( animSetName );
+	if( animSetIter == m_animClips.end() )
+		return INVALID_SPRITE_ANIM_CLIP;
+
+	auto clipIter = animSetIter->second.find( direction );
+	if( clipIter == animSetIter->second.end() )
+		return INVALID_SPRITE_ANIM_CLIP;
+
+	return clipIter->second;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool EntityDef::ParsePhysicsNode( BakedXmlElement const& element )
 {
 	m_physicsRadius = ParseXmlAttribute( element, "radius", -1.f );
 	if( m_physicsRadius == -1.f )
@@ -182,7 +201,7 @@ bool EntityDef::ParsePhysicsNode( XmlElement const& element )
 
 
 //---------------------------------------------------------------------------------------------------------
-bool EntityDef::ParseAppearanceNode( XmlElement const& element )
+bool EntityDef::ParseAppearanceNode( BakedXmlElement const& element )
 {
 	//Validate Size
 	m_size = ParseXmlAttribute( element, "size", Vec2( -1.f, -1.f ) );
@@ -225,7 +244,7 @@ bool EntityDef::ParseAppearanceNode( XmlElement const& element )
 	m_spriteSheet = GetOrCreateEntitySpriteSheet( spriteSheetFilepath.c_str(), spriteSheetLayout );
 
 	//Create Animation States
-	XmlElement const* nextChildElement = element.FirstChildElement();
+	BakedXmlElement const* nextChildElement = element.FirstChildElement();
 	for( ;; )
 	{
 		if( nextChildElement == nullptr )
@@ -240,7 +259,7 @@ bool EntityDef::ParseAppearanceNode( XmlElement const& element )
 
 
 //---------------------------------------------------------------------------------------------------------
-bool EntityDef::CreateAnimState( XmlElement const& element )
+bool EntityDef::CreateAnimState( BakedXmlElement const& element )
 {
 	std::string animStateName = element.Name();
 	if( animStateName != "Walk" && animStateName != "Attack" && animStateName != "Pain" && animStateName != "Death" )
@@ -261,7 +280,7 @@ bool EntityDef::CreateAnimState( XmlElement const& element )
 	}
 
 	//Create New Anim State
-	XmlAttribute const* nextAttribute = element.FirstAttribute();
+	BakedXmlAttribute const* nextAttribute = element.FirstAttribute();
 	std::map<std::string, SpriteAnimDefinition*> animStateMap;
 	for( ;; )
 	{
@@ -280,6 +299,7 @@ bool EntityDef::CreateAnimState( XmlElement const& element )
 		if( newAnim != nullptr )
 		{
 			animStateMap[nextAttributeName] = newAnim;
+			m_animClips[animStateName][nextAttributeName] = s_animClips.AddClip( *newAnim );
 		}
 		nextAttribute = nextAttribute->Next();
 	}
@@ -290,7 +310,7 @@ bool EntityDef::CreateAnimState( XmlElement const& element )
 
 
 //---------------------------------------------------------------------------------------------------------
-SpriteAnimDefinition* EntityDef::CreateAnimDefinition( XmlElement const& element, char const* attributeName )
+SpriteAnimDefinition* EntityDef::CreateAnimDefinition( BakedXmlElement const& element, char const* attributeName )
 {
 	if( !IsSupportedAnimDefType( attributeName ) )
 	{
@@ -358,7 +378,7 @@ STATIC void EntityDef::CreateEntityDefsFromXML( char const* filepath )
 	std::string const projectileNodeName	= "Projectile";
 	std::string const portalNodeName		= "Portal";
 
-	XmlDocument entityDefsTypesFile = new XmlDocument();
+	BakedXmlDocument entityDefsTypesFile;
 	entityDefsTypesFile.LoadFile( filepath );
 	if( entityDefsTypesFile.ErrorID() != tinyxml2::XML_SUCCESS )
 	{
@@ -368,13 +388,13 @@ STATIC void EntityDef::CreateEntityDefsFromXML( char const* filepath )
 		return;
 	}
 
-	const XmlElement* rootElement = entityDefsTypesFile.RootElement();
+	const BakedXmlElement* rootElement = entityDefsTypesFile.RootElement();
 	if( !IsStringEqual( rootElement->Name(), elementNameToLoad.c_str() ) )
 	{
 		g_theConsole->ErrorString( "Tried to load element %s - should be %s", rootElement->Name(), elementNameToLoad.c_str() );
 	}
 
-	const XmlElement* nextChildElement = rootElement->FirstChildElement();
+	const BakedXmlElement* nextChildElement = rootElement->FirstChildElement();
 	for( ;; )
 	{
 		if( nextChildElement == nullptr )
@@ -409,19 +429,41 @@ STATIC void EntityDef::CreateEntityDefsFromXML( char const* filepath )
 		}
 		nextChildElement = nextChildElement->NextSiblingElement();
 	}
+
+	BuildEntitySpriteAtlas();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Every entity sheet shares one texture afterwards, so TileMap can draw all the billboards in one batch
+//---------------------------------------------------------------------------------------------------------
+STATIC void EntityDef::BuildEntitySpriteAtlas()
+{
+	if( s_spriteAtlas != nullptr )
+		return;
+
+	s_spriteAtlas = new SpriteAtlas();
+	for( auto spriteSheetIter = s_spriteSheets.begin(); spriteSheetIter != s_spriteSheets.end(); ++spriteSheetIter )
+	{
+		s_spriteAtlas->AddSpriteSheet( spriteSheetIter->second );
+	}
+	s_spriteAtlas->Build( g_theRenderer, "EntitySprites" );
+	s_animClips.RefreshFrameUVs();
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 STATIC SpriteSheet* EntityDef::GetOrCreateEntitySpriteSheet( char const* filepath, IntVec2 const& layout )
 {
-	SpriteSheet* spriteSheet = s_spriteSheets[ filepath ];
-	if( spriteSheet == nullptr )
+	auto spriteSheetIter = s_spriteSheets.find( filepath );
+	if( spriteSheetIter != s_spriteSheets.end() )
 	{
-		Texture* spriteSheetTexture = g_theRenderer->CreateOrGetTextureFromFile( filepath );
-		spriteSheet = new SpriteSheet( *spriteSheetTexture, layout );
-		s_spriteSheets[ filepath ] = spriteSheet;
+		return spriteSheetIter->second;
 	}
+
+	Texture* spriteSheetTexture = g_theRenderer->CreateOrGetTextureFromFile( filepath );
+	SpriteSheet* spriteSheet = new SpriteSheet( *spriteSheetTexture, layout );
+	s_spriteSheets.insert( { filepath, spriteSheet } );
 	return spriteSheet;
 }
 
@@ -429,7 +471,14 @@ STATIC SpriteSheet* EntityDef::GetOrCreateEntitySpriteSheet( char const* filepat
 //---------------------------------------------------------------------------------------------------------
 STATIC EntityDef* EntityDef::GetEntityDefByName( std::string const& entityName )
 {
-	return s_entityDefs[entityName];
+	RecordAssetStringLookup();
+
+	auto entityDefIter = s_entityDefs.find( entityName );
+	if( entityDefIter == s_entityDefs.end() )
+	{
+		return nullptr;
+	}
+	return entityDefIter->second;
 }
 
 
@@ -1,14 +1,17 @@
 #pragma once
 #include "Game/GameCommon.hpp"
-#include "Engine/Core/XmlUtils.hpp"
+#include "Engine/Core/BakedXml.hpp"
 #include "Engine/Math/AABB2.hpp"
+#include "Engine/Renderer/SpriteAnimSystem.hpp"
 #include <string>
 #include <map>
+#include <unordered_map>
 
 class SpriteSheet;
 class SpriteDefinition;
 class SpriteAnimSet;
 class SpriteAnimDefinition;
+class SpriteAtlas;
 struct Texture;
 
 
@@ -25,13 +28,14 @@ enum EntityType
 };
 
 typedef	std::map<std::string, SpriteAnimSet*> SpriteAnimMap;
+typedef	std::map<std::string, std::map<std::string, uint>> SpriteAnimClipMap;
 
 
 //---------------------------------------------------------------------------------------------------------
 class EntityDef
 {
 private:
-	EntityDef( XmlElement const& xmlElement, EntityType entityType );
+	EntityDef( BakedXmlElement const& xmlElement, EntityType entityType );
 
 public:
 	std::string		GetName() const				{ return m_name; }
@@ -48,27 +52,31 @@ public:
 
 	std::string				GetEntityTypeAsString() const;
 	SpriteDefinition const*	GetSpriteDefinitionForAnimSetAtTime( std::string const& animSetName, std::string const& direction, float time ) const;
+	uint					GetAnimClip( std::string const& animSetName, std::string const& direction ) const;
 
 private:
 	//XML
-	bool					ParsePhysicsNode( XmlElement const& element );
-	bool					ParseAppearanceNode( XmlElement const& element );
-	bool					CreateAnimState( XmlElement const& element );
-	SpriteAnimDefinition*	CreateAnimDefinition( XmlElement const& element, char const* attributeName );
+	bool					ParsePhysicsNode( BakedXmlElement const& element );
+	bool					ParseAppearanceNode( BakedXmlElement const& element );
+	bool					CreateAnimState( BakedXmlElement const& element );
+	SpriteAnimDefinition*	CreateAnimDefinition( BakedXmlElement const& element, char const* attributeName );
 	bool					IsSupportedAnimDefType( std::string const& animDefType );
 	
 
 public:
 	static void			CreateEntityDefsFromXML( char const* filepath );
 	static SpriteSheet*	GetOrCreateEntitySpriteSheet( char const* filepath, IntVec2 const& layout );
+	static void			BuildEntitySpriteAtlas();
 	static EntityDef*	GetEntityDefByName( std::string const& entityName );
 
 	//---------------------------------------------------------------------------------------------------------
 	static EntityType GetEntityTypeFromString( std::string entityTypeAsString );
 
 public:
-	static std::map<std::string, EntityDef*>	s_entityDefs;
-	static std::map<std::string, SpriteSheet*>	s_spriteSheets;
+	static std::unordered_map<std::string, EntityDef*>	s_entityDefs;
+	static std::unordered_map<std::string, SpriteSheet*>	s_spriteSheets;
+	static SpriteAtlas*									s_spriteAtlas;
+	static SpriteAnimClipTable							s_animClips;
 
 
 private:
@@ -86,4 +94,5 @@ private:
 	BillboardType	m_billboardType	= BillboardType::CAMERA_FACING_XY;
 	SpriteSheet*	m_spriteSheet	= nullptr;
 	SpriteAnimMap	m_animations;
+	SpriteAnimClipMap	m_animClips;
 };
\ No newline at end of file
@@ -20,6 +20,7 @@
 #include "Engine/Renderer/Sampler.hpp"
 #include "Engine/Renderer/SpriteSheet.hpp"
 #include "Engine/Renderer/SpriteDefinition.hpp"
+#include "Engine/Renderer/SpriteAnimSystem.hpp"
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Math/RandomNumberGenerator.hpp"
 #include "Engine/Math/AABB3.hpp"
@@ -39,6 +40,7 @@
 #include "Game/MapRegion.hpp"
 #include "Game/EntityDef.hpp"
 #include "Game/Client.hpp"
+#include "Game/ClientPrediction.hpp"
 #include <string>
 
 BitmapFont*				g_devConsoleFont = nullptr;
@@ -138,6 +140,7 @@ void Game::StartUp()
 	LoadTextures();
 	LoadShaders();
 	LoadAudio();
+	m_spriteAnims = new SpriteAnimSystem( EntityDef::s_animClips, MAX_SPRITE_ANIM_INSTANCES );
 	m_world = new World( this );
 }
 
@@ -148,6 +151,9 @@ void Game::ShutDown()
 	delete m_world;
 	m_world = nullptr;
 
+	delete m_spriteAnims;
+	m_spriteAnims = nullptr;
+
 	delete m_worldCamera;
 	m_worldCamera = nullptr;
 
@@ -446,6 +452,7 @@ void Game::Update()
 	}
 
 	m_world->Update();
+	m_spriteAnims->Update( deltaSeconds );
 
 	if( m_possessedEntity != nullptr )
 	{
@@ -469,6 +476,20 @@ void Game::Update()
 			DebugRaycast( raycastStartPos, raycastFwdDir, raycastMaxDistance );
 		}
 	}
+
+	UpdateAudioListener();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void Game::UpdateAudioListener()
+{
+	Mat44 cameraView = m_worldCamera->GetViewMatrix();
+	MatrixInvertOrthoNormal( cameraView );
+
+	Vec3 listenerLeft = cameraView.TransformVector3D( Vec3::UNIT_POSITIVE_Y );
+	listenerLeft.Normalize();
+	g_theAudio->SetListener( m_worldCamera->GetPosition(), listenerLeft );
 }
 
 
@@ -519,12 +540,12 @@ void Game::UpdateFromInput( float deltaSeconds )
 
 	if( m_possessedEntity == nullptr )
 	{
-		Vec3 cameraTranslation = MoveWorldCamera( deltaSeconds, m_worldCamera->GetYawDegrees() );
+		Vec3 cameraTranslation = GetFreeCameraTranslation( deltaSeconds, m_worldCamera->GetYawDegrees(), g_theInput );
 		m_worldCamera->Translate( cameraTranslation );
 	}
 	else
 	{
-		MoveEntity( m_possessedEntity, m_worldCamera->GetYawDegrees() );
+		MoveEntity( m_possessedEntity, deltaSeconds, m_worldCamera->GetYawDegrees() );
 	}
 
 	if( g_theInput->WasKeyJustPressed( KEY_CODE_ESC ) )
@@ -569,60 +590,12 @@ void Game::UpdateFromInput( float deltaSeconds )
 
 
 //---------------------------------------------------------------------------------------------------------
-Vec3 Game::MoveWorldCamera( float deltaSeconds, float yawDegrees, InputSystem* input )
+Vec3 Game::MoveEntity( Entity* entityToMove, float deltaSeconds, float yawDegrees, InputSystem* input )
 {
 	float forwardMoveAmount = 0.f;
 	float leftMoveAmount = 0.f;
 	float upMoveAmount = 0.f;
-	float moveSpeed = 2.f * deltaSeconds;
-	if( input->IsKeyPressed( KEY_CODE_SHIFT ) )
-	{
-		moveSpeed *= 2.f;
-	}
-
-	if( input->IsKeyPressed( 'W' ) )
-	{
-		forwardMoveAmount += moveSpeed;
-	}	
-	if( input->IsKeyPressed( 'S' ) )
-	{
-		forwardMoveAmount -= moveSpeed;
-	}	
-
-	if( input->IsKeyPressed( 'A' ) )
-	{
-		leftMoveAmount += moveSpeed;
-	}	
-	if( input->IsKeyPressed( 'D' ) )
-	{
-		leftMoveAmount -= moveSpeed;
-	}
-
-	if( input->IsKeyPressed( 'Q' ) )
-	{
-		upMoveAmount += moveSpeed;
-	}
-	if( input->IsKeyPressed( 'E' ) )
-	{
-		upMoveAmount -= moveSpeed;
-	}
-
-	Vec3 cameraForwardXY0 = Vec3( CosDegrees( yawDegrees ), SinDegrees( yawDegrees ), 0.f );
-	Vec3 cameraLeftXY0 = Vec3( -SinDegrees( yawDegrees ), CosDegrees( yawDegrees ), 0.f );
-	Vec3 cameraTranslation = ( cameraForwardXY0 * forwardMoveAmount ) + ( cameraLeftXY0 * leftMoveAmount );
-	cameraTranslation.z = upMoveAmount;
-
-	return cameraTranslation;
-}
-
-
-//---------------------------------------------------------------------------------------------------------
-Vec3 Game::MoveEntity( Entity* entityToMove, float yawDegrees, InputSystem* input )
-{
-	float forwardMoveAmount = 0.f;
-	float leftMoveAmount = 0.f;
-	float upMoveAmount = 0.f;
-	float moveSpeed = entityToMove->GetSpeed() * static_cast<float>( m_gameClock->GetLastDeltaSeconds() );
+	float moveSpeed = entityToMove->GetSpeed() * deltaSeconds;
 
 	if( input->IsKeyPressed( 'W' ) )
 	{
@@ -778,7 +751,38 @@ void Game::DebugRaycast( Vec3 const& startPosition, Vec3 const& forwardDir, floa
 //---------------------------------------------------------------------------------------------------------
 WorldData Game::GetWorldData()
 {
-	return m_world->GetWorldData();
+	WorldData worldData = m_world->GetWorldData();
+	worldData.m_serverTimeSeconds = m_gameClock->GetTotalElapsedSeconds();
+	return worldData;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Hashed field by field so the padding inside WorldData doesn't leak into the result
+uint64_t Game::GetWorldStateHash()
+{
+	WorldData worldData = GetWorldData();
+	MapData const& mapData = worldData.m_currentMapData;
+
+	uint64_t hash = HashBytes64( worldData.m_currentMapByName, strlen( worldData.m_currentMapByName ) );
+	hash = HashBytes64( &mapData.m_numEntities, sizeof( mapData.m_numEntities ), hash );
+	for( int entityIndex = 0; entityIndex < mapData.m_numEntities && entityIndex < 50; ++entityIndex )
+	{
+		EntityData const& entity = mapData.m_entities[ entityIndex ];
+		hash = HashBytes64( &entity.m_isPossessed,				sizeof( entity.m_isPossessed ),				hash );
+		hash = HashBytes64( &entity.m_isDead,					sizeof( entity.m_isDead ),					hash );
+		hash = HashBytes64( &entity.m_mass,						sizeof( entity.m_mass ),					hash );
+		hash = HashBytes64( &entity.m_currentHealth,			sizeof( entity.m_currentHealth ),			hash );
+		hash = HashBytes64( &entity.m_position,					sizeof( entity.m_position ),				hash );
+		hash = HashBytes64( &entity.m_forwardDirection,			sizeof( entity.m_forwardDirection ),		hash );
+		hash = HashBytes64( &entity.m_yaw,						sizeof( entity.m_yaw ),						hash );
+		hash = HashBytes64( entity.m_actionState,				strlen( entity.m_actionState ),				hash );
+		hash = HashBytes64( entity.m_entityDefName,				strlen( entity.m_entityDefName ),			hash );
+	}
+
+	Vec3 cameraPosition = m_worldCamera->GetPosition();
+	hash = HashBytes64( &cameraPosition, sizeof( cameraPosition ), hash );
+	return hash;
 }
 
 
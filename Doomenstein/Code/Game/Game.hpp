@@ -19,6 +19,7 @@ class Clock;
 class World;
 class NamedProperties;
 class SpriteSheet;
+class SpriteAnimSystem;
 struct Vertex_PCUTBN;
 struct AABB3;
 struct WorldData;
@@ -61,11 +62,11 @@ public:
 
 	//Upadate
 	void UpdateWorld();
+	void UpdateAudioListener();
 
 	//Input
 	void UpdateFromInput( float deltaSeconds );
-	Vec3 MoveWorldCamera( float deltaSeconds, float yawDegrees, InputSystem* input = g_theInput );
-	Vec3 MoveEntity( Entity* entityToMove, float yawDegrees, InputSystem* input = g_theInput );
+	Vec3 MoveEntity( Entity* entityToMove, float deltaSeconds, float yawDegrees, InputSystem* input = g_theInput );
 	void UpdateBasedOnMouseMovement();
 
 	//Rendering
@@ -81,6 +82,7 @@ public:
 
 	//Other
 	Camera* GetPlayerCamera() const		{ return m_worldCamera; }
+	SpriteAnimSystem* GetSpriteAnims() const	{ return m_spriteAnims; }
 	Entity**	GetPossessedEntityPointer()		{ return &m_possessedEntity; }
 	bool	IsQuitting() const			{ return m_isQuitting; }
 	void	PlaySpawnSound();
@@ -91,6 +93,7 @@ public:
 	void	DebugRaycast( Vec3 const& startPosition, Vec3 const& forwardDir, float maxDistance, float duration = 0.f );
 	
 	WorldData	GetWorldData();
+	uint64_t	GetWorldStateHash();
 	ConnectionData GetConnectionData();
 	void SetCurrentMapByName( std::string const& mapName );
 	void SpawnEntitiesFromSpawnData( SpawnData const& spawnData );
@@ -109,6 +112,7 @@ protected:
 	World* m_world = nullptr;
 
 	Clock* m_gameClock = nullptr;
+	SpriteAnimSystem* m_spriteAnims = nullptr;
 
 	Rgba8 m_ambientColor = Rgba8::WHITE;
 	float m_ambientIntensity = 1.f;
@@ -81,6 +81,8 @@ constexpr float DEV_CONSOLE_LINE_HEIGHT				= 0.15f;
 
 constexpr float PLAYER_HEIGHT						= 0.7f;
 
+constexpr uint MAX_SPRITE_ANIM_INSTANCES				= 2048;
+
 // Game Specific Colors
 const Rgba8 DEV_CONSOLE_INFO_COLOR		( 255, 255, 255 );
 const Rgba8 DEV_CONSOLE_HELP_COLOR		( 255, 255, 0 );
@@ -0,0 +1,163 @@
+//-----------------------------------------------------------------------------------------------
+// Main_NetworkTests.cpp
+//
+// Headless entry point for the network code that doesn't need the renderer or sockets: input command
+//	packets, snapshot interpolation, and the NetSimTest prediction/interpolation run over simulated
+//	lossy links. Built by the CMake build only; exits non-zero if any test failed.
+//
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Platform/Platform.hpp"
+#include "Engine/Input/InputSystem.hpp"
+#include "Game/ClientPrediction.hpp"
+#include "Game/SnapshotInterpolator.hpp"
+#include "Game/NetworkSimulation.hpp"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+
+//-----------------------------------------------------------------------------------------------
+// The engine expects these from the app; nothing here uses them
+//
+DevConsole*		g_theConsole		= nullptr;
+EventSystem*	g_theEventSystem	= nullptr;
+JobSystem*		g_theJobSystem		= nullptr;
+
+
+//-----------------------------------------------------------------------------------------------
+static int s_numTestsPassed = 0;
+static int s_numTestsFailed = 0;
+
+
+//-----------------------------------------------------------------------------------------------
+static void VerifyTestResult( bool isCorrect, const char* testName )
+{
+	if( isCorrect )
+	{
+		++ s_numTestsPassed;
+	}
+	else
+	{
+		++ s_numTestsFailed;
+		printf( "  TEST FAILED: %s\n", testName );
+	}
+}
+
+
+//-----------------------------------------------------------------------------------------------
+static void TestInputCommandPackets()
+{
+	printf( "Running test set \"Input command packets\"\n" );
+
+	std::deque<InputCommand> commands;
+	for( uint sequence = 1; sequence <= 20; ++sequence )
+	{
+		InputCommand command;
+		command.m_sequence = sequence;
+		command.m_deltaSeconds = 0.01f * static_cast<float>( sequence );
+		command.m_inputState.m_keyStates[ 'W' ].UpdateStatus( sequence % 2 == 0 );
+		command.m_inputState.m_cursorRelativeMovement = Vec2( static_cast<float>( sequence ), 0.f );
+		commands.push_back( command );
+	}
+
+	std::vector<unsigned char> packet;
+	std::vector<InputCommand> readCommands;
+	WriteInputCommandPacket( commands, packet );
+	bool wasRead = ReadInputCommandPacket( packet.data(), packet.size(), readCommands );
+	VerifyTestResult( wasRead && readCommands.size() == MAX_INPUT_COMMANDS_PER_PACKET, "A packet should carry the newest MAX_INPUT_COMMANDS_PER_PACKET commands" );
+
+	bool doCommandsMatch = wasRead && !readCommands.empty();
+	for( size_t readIndex = 0; doCommandsMatch && readIndex < readCommands.size(); ++readIndex )
+	{
+		InputCommand const& sentCommand = commands[ commands.size() - readCommands.size() + readIndex ];
+		InputCommand const& readCommand = readCommands[ readIndex ];
+		doCommandsMatch = readCommand.m_sequence == sentCommand.m_sequence
+			&& readCommand.m_deltaSeconds == sentCommand.m_deltaSeconds
+			&& readCommand.m_inputState.m_cursorRelativeMovement == sentCommand.m_inputState.m_cursorRelativeMovement
+			&& readCommand.m_inputState.m_keyStates[ 'W' ].IsPressed() == sentCommand.m_inputState.m_keyStates[ 'W' ].IsPressed();
+	}
+	VerifyTestResult( doCommandsMatch, "Read commands should match the sent sequences, deltas and input" );
+
+	VerifyTestResult( !ReadInputCommandPacket( packet.data(), 6, readCommands ), "A truncated packet should be rejected" );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+static WorldData MakeSnapshot( double serverTimeSeconds )
+{
+	WorldData snapshot;
+	strcpy_s( snapshot.m_currentMapByName, sizeof( snapshot.m_currentMapByName ), "TestMap" );
+	snapshot.m_serverTimeSeconds = serverTimeSeconds;
+	snapshot.m_currentMapData.m_numEntities = 1;
+
+	EntityData& entity = snapshot.m_currentMapData.m_entities[ 0 ];
+	strcpy_s( entity.m_entityDefName, sizeof( entity.m_entityDefName ), "TestEntity" );
+	entity.m_isDead = false;
+	entity.m_position = Vec3( static_cast<float>( serverTimeSeconds ), 0.f, 0.f );
+	return snapshot;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+// The entity's x is its server time, so a sampled x is the server time it was sampled at
+//
+static void TestSnapshotInterpolation()
+{
+	printf( "Running test set \"Snapshot interpolation\"\n" );
+
+	SnapshotInterpolator interpolator( 0.1, 0.05 );
+	WorldData sample;
+	VerifyTestResult( !interpolator.Sample( 0.0, sample ), "Sample() with no snapshots should fail" );
+
+	// The 0.1 snapshot arrives after the 0.2 one, then again as a duplicate
+	interpolator.AddSnapshot( MakeSnapshot( 0.0 ), 0.0 );
+	interpolator.AddSnapshot( MakeSnapshot( 0.2 ), 0.2 );
+	interpolator.AddSnapshot( MakeSnapshot( 0.1 ), 0.2 );
+	interpolator.AddSnapshot( MakeSnapshot( 0.1 ), 0.2 );
+	VerifyTestResult( interpolator.GetDiscardedSnapshotCount() == 1, "Only the duplicate snapshot should be discarded" );
+
+	// The late arrivals relax the server time offset a little, hence the tolerance
+	bool wasSampled = interpolator.Sample( 0.25, sample );
+	float sampledX = sample.m_currentMapData.m_entities[ 0 ].m_position.x;
+	VerifyTestResult( wasSampled && fabsf( sampledX - 0.15f ) < 0.01f && interpolator.GetExtrapolatedSampleCount() == 0, "Sampling between snapshots should blend across the reordered one" );
+
+	interpolator.Sample( 0.5, sample );
+	sampledX = sample.m_currentMapData.m_entities[ 0 ].m_position.x;
+	VerifyTestResult( fabsf( sampledX - 0.25f ) < 0.0001f && interpolator.GetExtrapolatedSampleCount() == 1, "Sampling past the newest snapshot should extrapolate no further than the limit" );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+// Prediction has to hold on any link. Interpolation is only checked where the default 200 ms delay
+//	is meant to cope; on worse links runs of lost snapshots outlast the extrapolation limit.
+//
+static void TestSimulatedLink( const char* linkName, float lossFraction, double latencySeconds, double jitterSeconds, bool isInterpolationExpectedClose )
+{
+	printf( "Running test set \"Prediction and interpolation over a %s link\"\n", linkName );
+
+	network_simulation_results_t results;
+	bool hasPassed = RunNetworkSimulationTest( lossFraction, latencySeconds, jitterSeconds, 20.0, results );
+	printf( "  %u/%u input packets dropped, %u commands lost, %u corrections, prediction error %.5f\n", results.inputPacketsDropped, results.inputPacketsSent, results.lostCommandCount, results.correctionCount, results.predictionError );
+	printf( "  %u/%u snapshots dropped, %u discarded, interpolation error mean %.4f max %.4f, %u extrapolated frames\n", results.snapshotsDropped, results.snapshotsSent, results.snapshotsDiscarded, results.meanInterpolationError, results.maxInterpolationError, results.extrapolatedSampleCount );
+
+	VerifyTestResult( hasPassed == ( results.isPredictionSettled && results.isInterpolationClose ), "RunNetworkSimulationTest() should pass exactly when both of its checks do" );
+	VerifyTestResult( results.isPredictionSettled, "The predicted camera should settle on the server's" );
+	VerifyTestResult( results.correctionCount == 0, "The server should never disagree with a prediction made from the same commands" );
+	VerifyTestResult( results.isInterpolationClose || !isInterpolationExpectedClose, "The interpolated entity should stay close to its true position" );
+	VerifyTestResult( results.lostCommandCount == 0, "Resending unacknowledged commands should cover every dropped input packet" );
+	VerifyTestResult( ( lossFraction > 0.f ) == ( results.inputPacketsDropped > 0 && results.snapshotsDropped > 0 ), "Packets should be dropped exactly when the link is lossy" );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+int main( int, char** )
+{
+	TestInputCommandPackets();
+	TestSnapshotInterpolation();
+	TestSimulatedLink( "perfect",	0.f,	0.0,	0.0,	true );
+	TestSimulatedLink( "lossy",		0.1f,	0.08,	0.04,	true );		// NetSimTest's defaults
+	TestSimulatedLink( "bad",		0.25f,	0.15,	0.08,	false );
+
+	printf( "%i passed, %i failed\n", s_numTestsPassed, s_numTestsFailed );
+	return ( s_numTestsFailed == 0 ) ? 0 : 1;
+}
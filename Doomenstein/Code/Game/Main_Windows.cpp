@@ -22,7 +22,6 @@ const char* APP_NAME = "FPS";					// ...becomes ??? (Change this per project!)
 //-----------------------------------------------------------------------------------------------
 int WINAPI WinMain( _In_ HINSTANCE applicationInstanceHandle, _In_opt_ HINSTANCE, _In_ LPSTR commandLineString, _In_ int )
 {
-	UNUSED( commandLineString );
 	UNUSED( applicationInstanceHandle );
 
 	XmlDocument gameConfigFile = new XmlDocument();
@@ -30,6 +29,9 @@ int WINAPI WinMain( _In_ HINSTANCE applicationInstanceHandle, _In_opt_ HINSTANCE
 	GUARANTEE_OR_DIE( gameConfigFile.ErrorID() == 0, "GameConfig.xml does not exist in Run/Data" );
 	g_gameConfigBlackboard.PopulateFromXmlElementAttribute( *gameConfigFile.RootElement() );
 
+	// e.g. "recordInput=Data/Replays/session.inrec" or "replayInput=Data/Replays/session.inrec"
+	g_gameConfigBlackboard.PopulateFromString( commandLineString );
+
 
 	g_theWindow = new Window();
 	g_theWindow->Open( APP_NAME, CLIENT_ASPECT );
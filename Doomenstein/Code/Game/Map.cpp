@@ -9,6 +9,7 @@
 #include "Game/GameCommon.hpp"
 #include "Engine/Renderer/GPUMesh.hpp"
 #include "Engine/Renderer/Camera.hpp"
+#include "Engine/Renderer/RenderContext.hpp"
 #include "Engine/Core/DevConsole.hpp"
 #include "Engine/Math/Vec3.hpp"
 #include "Engine/Math/MathUtils.hpp"
@@ -20,6 +21,8 @@ Map::Map( Game* theGame, World* theWorld, std::string const& name )
 	m_game = theGame;
 	m_world = theWorld;
 	m_name = name;
+
+	m_worldOpaqueShader = g_theRenderer->GetOrCreateShaderHandle( "Data/Shaders/WorldOpaque.hlsl" );
 }
 
 
@@ -1,6 +1,8 @@
 #pragma once
 #include "Game/RaycastResult.hpp"
+#include "Game/NetworkData.hpp"
 #include "Engine/Core/XmlUtils.hpp"
+#include "Engine/Core/AssetRegistry.hpp"
 #include "Engine/Math/Vec2.hpp"
 #include <vector>
 #include <string>
@@ -14,20 +16,6 @@ class EntityDef;
 class Entity;
 
 
-//---------------------------------------------------------------------------------------------------------
-struct MapData
-{
-	int m_numEntities = 0;
-	EntityData m_entities[50] = {};
-};
-
-
-//---------------------------------------------------------------------------------------------------------
-struct SpawnData
-{
-	EntitySpawnData m_entitiesToSpawn[50] = {};
-};
-
 //---------------------------------------------------------------------------------------------------------
 class Map
 {
@@ -40,6 +28,7 @@ public:
 	virtual void			Render() const		= 0;
 
 	std::string	GetMapName() const { return m_name; }
+	AssetHandle	GetWorldOpaqueShader() const	{ return m_worldOpaqueShader; }
 	MapData		GetMapData();
 	SpawnData	GetEntitySpawnData();
 	void		GetEntityDataFromArray( EntityData entityData[], std::vector<Entity*> const& entities );
@@ -77,6 +66,7 @@ protected:
 	GPUMesh*	m_mapMesh	= nullptr;
 
 	std::string m_name		= "Default";
+	AssetHandle	m_worldOpaqueShader;
 
 	Vec2 m_playerStartPositionXY;
 	float	m_playerStartYawDegrees		= 0.f;
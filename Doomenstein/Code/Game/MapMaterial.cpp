@@ -2,18 +2,19 @@
 #include "Game/GameCommon.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/AssetRegistry.hpp"
 #include "Engine/Renderer/SpriteSheet.hpp"
 #include "Engine/Renderer/Texture.hpp"
 #include "Engine/Renderer/RenderContext.hpp"
 
 
 //---------------------------------------------------------------------------------------------------------
-STATIC std::string							MapMaterial::s_defaultMaterialName = "";
-STATIC std::map<std::string, MapMaterial*>	MapMaterial::s_mapMaterials;
-STATIC std::map<std::string, SpriteSheet*>	MapMaterial::s_materialSheets;
+STATIC std::string										MapMaterial::s_defaultMaterialName = "";
+STATIC std::unordered_map<std::string, MapMaterial*>	MapMaterial::s_mapMaterials;
+STATIC std::unordered_map<std::string, SpriteSheet*>	MapMaterial::s_materialSheets;
 
 //---------------------------------------------------------------------------------------------------------
-MapMaterial::MapMaterial( XmlElement const& xmlElement )
+MapMaterial::MapMaterial( BakedXmlElement const& xmlElement )
 {
 	Strings errorStrings;
 	IntVec2 spritePosition = IntVec2( -1, -1 );
@@ -32,12 +33,16 @@ MapMaterial::MapMaterial( XmlElement const& xmlElement )
 	}
 	else
 	{
-		spriteSheetToUse = s_materialSheets[sheetName];
-		m_spriteTexture = &spriteSheetToUse->GetTexture();
-		if( spriteSheetToUse == nullptr )
+		auto sheetIter = s_materialSheets.find( sheetName );
+		if( sheetIter == s_materialSheets.end() )
 		{
 			errorStrings.push_back( Stringf( "  Failed to find sprite sheet with name: %s", sheetName.c_str() ) );
 		}
+		else
+		{
+			spriteSheetToUse = sheetIter->second;
+			m_spriteTexture = &spriteSheetToUse->GetTexture();
+		}
 	}
 
 	spritePosition	= ParseXmlAttribute( xmlElement, "spriteCoords", spritePosition );
@@ -73,7 +78,7 @@ MapMaterial::MapMaterial( XmlElement const& xmlElement )
 
 
 //---------------------------------------------------------------------------------------------------------
-STATIC void MapMaterial::CreateMaterialSheet( XmlElement const& xmlElement )
+STATIC void MapMaterial::CreateMaterialSheet( BakedXmlElement const& xmlElement )
 {
 	Strings errorMessages;
 	std::string diffuseFilePath;
@@ -90,7 +95,7 @@ STATIC void MapMaterial::CreateMaterialSheet( XmlElement const& xmlElement )
 		errorMessages.push_back( Stringf( "  Failed to parse attribute: 'layout'", xmlElement.GetLineNum() ) );
 	}
 
-	const XmlElement* childElement = xmlElement.FirstChildElement( "Diffuse" );
+	const BakedXmlElement* childElement = xmlElement.FirstChildElement( "Diffuse" );
 	if( childElement != nullptr )
 	{
 		diffuseFilePath = ParseXmlAttribute( *childElement, "image", "MISSING" );
@@ -124,14 +129,21 @@ STATIC void MapMaterial::CreateMaterialSheet( XmlElement const& xmlElement )
 //---------------------------------------------------------------------------------------------------------
 STATIC MapMaterial* MapMaterial::GetMaterialByName( std::string materialName )
 {
-	return s_mapMaterials[ materialName ];
+	RecordAssetStringLookup();
+
+	auto materialIter = s_mapMaterials.find( materialName );
+	if( materialIter == s_mapMaterials.end() )
+	{
+		return nullptr;
+	}
+	return materialIter->second;
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 STATIC MapMaterial* MapMaterial::GetDefaultMaterial()
 {
-	return s_mapMaterials[ s_defaultMaterialName ];
+	return GetMaterialByName( s_defaultMaterialName );
 }
 
 
@@ -144,7 +156,7 @@ STATIC void MapMaterial::CreateMapMaterialsFromXML( char const* filepath )
 	std::string const materialSheetNodeName	= "MaterialsSheet";
 	std::string const materialTypeNodeName	= "MaterialType";
 
-	XmlDocument mapMaterialTypesFile = new XmlDocument();
+	BakedXmlDocument mapMaterialTypesFile;
 	mapMaterialTypesFile.LoadFile( filepath );
 	if( mapMaterialTypesFile.ErrorID() != tinyxml2::XML_SUCCESS )
 	{
@@ -154,7 +166,7 @@ STATIC void MapMaterial::CreateMapMaterialsFromXML( char const* filepath )
 		return;
 	}
 
-	const XmlElement* rootElement = mapMaterialTypesFile.RootElement();
+	const BakedXmlElement* rootElement = mapMaterialTypesFile.RootElement();
 	if( !IsStringEqual( rootElement->Name(), elementNameToLoad.c_str() ) )
 	{
 		g_theConsole->ErrorString( "Tried to load element %s - should be %s", rootElement->Name(), elementNameToLoad.c_str() );
@@ -166,7 +178,7 @@ STATIC void MapMaterial::CreateMapMaterialsFromXML( char const* filepath )
 		g_theConsole->ErrorString( "Could not parse attribute: 'default' in root element" );
 	}
 
-	const XmlElement* nextChildElement = rootElement->FirstChildElement();
+	const BakedXmlElement* nextChildElement = rootElement->FirstChildElement();
 	for( ;; )
 	{
 		if( nextChildElement == nullptr )
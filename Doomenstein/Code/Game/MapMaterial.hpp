@@ -1,9 +1,9 @@
 #pragma once
-#include "Engine/Core/XmlUtils.hpp"
+#include "Engine/Core/BakedXml.hpp"
 #include "Engine/Math/IntVec2.hpp"
 #include "Engine/Math/AABB2.hpp"
 #include <string>
-#include <map>
+#include <unordered_map>
 
 
 class SpriteSheet;
@@ -12,7 +12,7 @@ struct Texture;
 class MapMaterial
 {
 private:
-	MapMaterial( XmlElement const& xmlElement );
+	MapMaterial( BakedXmlElement const& xmlElement );
 
 public:
 	std::string		GetName() const				{ return m_name; }
@@ -21,14 +21,14 @@ public:
 
 public:
 	static void			CreateMapMaterialsFromXML( char const* filepath );
-	static void			CreateMaterialSheet( XmlElement const& xmlElement );
+	static void			CreateMaterialSheet( BakedXmlElement const& xmlElement );
 	static MapMaterial* GetMaterialByName( std::string materialName );
 	static MapMaterial* GetDefaultMaterial();
 
 public:
-	static std::string							s_defaultMaterialName;
-	static std::map<std::string, MapMaterial*>	s_mapMaterials;
-	static std::map<std::string, SpriteSheet*>	s_materialSheets;
+	static std::string										s_defaultMaterialName;
+	static std::unordered_map<std::string, MapMaterial*>	s_mapMaterials;
+	static std::unordered_map<std::string, SpriteSheet*>	s_materialSheets;
 private:
 	std::string		m_name			= "";
 	const Texture*	m_spriteTexture	= nullptr;
@@ -3,15 +3,16 @@
 #include "Game/MapMaterial.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/AssetRegistry.hpp"
 
 
 //---------------------------------------------------------------------------------------------------------
-STATIC std::string							MapRegion::s_defaultMapRegionName = "";
-STATIC std::map<std::string, MapRegion*>	MapRegion::s_mapRegions;
+STATIC std::string									MapRegion::s_defaultMapRegionName = "";
+STATIC std::unordered_map<std::string, MapRegion*>	MapRegion::s_mapRegions;
 
 
 //---------------------------------------------------------------------------------------------------------
-MapRegion::MapRegion( XmlElement const& xmlElement )
+MapRegion::MapRegion( BakedXmlElement const& xmlElement )
 {
 	Strings errorMessages;
 
@@ -22,7 +23,7 @@ MapRegion::MapRegion( XmlElement const& xmlElement )
 		errorMessages.push_back( "  Failed to parse attribute: 'name'" );
 	}
 
-	XmlElement const* nextChildElement = xmlElement.FirstChildElement();
+	BakedXmlElement const* nextChildElement = xmlElement.FirstChildElement();
 	for( ;; )
 	{
 		if( nextChildElement == nullptr )
@@ -106,7 +107,7 @@ STATIC void MapRegion::CreateMapRegionsFromXML( char const* filepath )
 
 	std::string elementNameToLoad = "MapRegionTypes";
 
-	XmlDocument mapMaterialTypesFile = new XmlDocument();
+	BakedXmlDocument mapMaterialTypesFile;
 	mapMaterialTypesFile.LoadFile( filepath );
 	if( mapMaterialTypesFile.ErrorID() != tinyxml2::XML_SUCCESS )
 	{
@@ -116,8 +117,8 @@ STATIC void MapRegion::CreateMapRegionsFromXML( char const* filepath )
 		return;
 	}
 
-	const XmlElement* rootElement = mapMaterialTypesFile.RootElement();
-	const XmlElement* nextChildElement = rootElement->FirstChildElement();
+	const BakedXmlElement* rootElement = mapMaterialTypesFile.RootElement();
+	const BakedXmlElement* nextChildElement = rootElement->FirstChildElement();
 
 	if( rootElement->Name() != elementNameToLoad )
 	{
@@ -144,13 +145,20 @@ STATIC void MapRegion::CreateMapRegionsFromXML( char const* filepath )
 //---------------------------------------------------------------------------------------------------------
 STATIC MapRegion* MapRegion::GetRegionByName( std::string regionTypeName )
 {
-	return s_mapRegions[ regionTypeName ];
+	RecordAssetStringLookup();
+
+	auto regionIter = s_mapRegions.find( regionTypeName );
+	if( regionIter == s_mapRegions.end() )
+	{
+		return nullptr;
+	}
+	return regionIter->second;
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 STATIC MapRegion* MapRegion::GetDefaultRegion()
 {
-	return s_mapRegions[ s_defaultMapRegionName ];
+	return GetRegionByName( s_defaultMapRegionName );
 }
 
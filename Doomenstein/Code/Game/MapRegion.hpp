@@ -1,14 +1,14 @@
 #pragma once
-#include "Engine/Core/XmlUtils.hpp"
+#include "Engine/Core/BakedXml.hpp"
 #include <string>
-#include <map>
+#include <unordered_map>
 
 class MapMaterial;
 
 class MapRegion
 {
 private:
-	explicit MapRegion( XmlElement const& xmlElement );
+	explicit MapRegion( BakedXmlElement const& xmlElement );
 
 public:
 	bool			IsSolid() const				{ return m_isSolid; }
@@ -23,8 +23,8 @@ public:
 	static MapRegion* GetDefaultRegion();
 
 public:
-	static std::string							s_defaultMapRegionName;
-	static std::map<std::string, MapRegion*>	s_mapRegions;
+	static std::string									s_defaultMapRegionName;
+	static std::unordered_map<std::string, MapRegion*>	s_mapRegions;
 
 private:
 	std::string		m_name				= "";
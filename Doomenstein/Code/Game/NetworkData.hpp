@@ -0,0 +1,76 @@
+#pragma once
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Math/Vec3.hpp"
+
+
+//---------------------------------------------------------------------------------------------------------
+// The plain structs sent between the server and its clients as raw bytes. Kept apart from the game classes
+// so prediction, interpolation and the network simulation test build without the renderer.
+//---------------------------------------------------------------------------------------------------------
+struct EntityData
+{
+	bool	m_isPossessed			= false;
+	bool	m_canBePushedByWalls	= true;
+	bool	m_canBePushedByEntities = true;
+	bool	m_canPushEntities		= true;
+	float	m_mass					= 1.f;
+	bool	m_isDead				= true;
+	int		m_currentHealth			= 0;
+
+	Vec3		m_position;
+	Vec2		m_forwardDirection;
+	float		m_yaw				= 0.f;
+	char		m_actionState[25]	= "Walk";
+	char		m_entityDefName[50] = "";
+};
+
+struct EntitySpawnData
+{
+	bool m_isUsed = false;
+	char m_entityDefName[50] = "";
+	EntityData m_data;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+struct MapData
+{
+	int m_numEntities = 0;
+	EntityData m_entities[50] = {};
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+struct SpawnData
+{
+	EntitySpawnData m_entitiesToSpawn[50] = {};
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+struct WorldData
+{
+	char m_currentMapByName[50] = "";
+	double m_serverTimeSeconds = 0.0;
+	MapData m_currentMapData;
+};
+
+struct ConnectionData
+{
+	char m_currentMapByName[50] = "";
+	SpawnData m_entityData;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+struct CameraData
+{
+	Vec3 m_position;
+	float m_yawDegrees = 0.f;
+	float m_pitchDegrees = 0.f;
+	float m_rollDegrees = 0.f;
+
+	uint m_lastProcessedInputSequence = 0;
+	bool m_isPossessingEntity = false;
+};
@@ -0,0 +1,217 @@
+#include "Engine/Input/InputSystem.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Platform/Platform.hpp"
+#include "Game/NetworkSimulation.hpp"
+#include "Game/ClientPrediction.hpp"
+#include "Game/SnapshotInterpolator.hpp"
+#include <math.h>
+
+
+//---------------------------------------------------------------------------------------------------------
+constexpr double	SIMULATION_FRAME_SECONDS				= 1.0 / 60.0;
+constexpr int		SIMULATION_SNAPSHOT_INTERVAL_FRAMES		= 6;			// matches RemoteClient::SendWorldData
+constexpr double	SIMULATION_WARMUP_SECONDS				= 1.0;			// before this the interpolator may not have two snapshots yet
+constexpr double	SIMULATION_SETTLE_SECONDS				= 2.0;			// idle input at the end so every command gets acknowledged
+constexpr float		SIMULATED_ENTITY_ORBIT_RADIUS			= 5.f;
+constexpr float		MAX_PREDICTION_ERROR					= 0.001f;
+constexpr float		MAX_INTERPOLATION_ERROR					= 0.1f;
+
+
+//---------------------------------------------------------------------------------------------------------
+SimulatedLink::SimulatedLink( float lossFraction, double latencySeconds, double jitterSeconds, unsigned int seed )
+	: m_lossFraction( lossFraction )
+	, m_latencySeconds( latencySeconds )
+	, m_jitterSeconds( jitterSeconds )
+{
+	m_rng.Reset( seed );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void SimulatedLink::Send( void const* data, size_t dataSize, double sendTimeSeconds )
+{
+	++m_sentCount;
+	if( m_rng.RollPercentChance( m_lossFraction ) )
+	{
+		++m_droppedCount;
+		return;
+	}
+
+	unsigned char const* dataAsBytes = reinterpret_cast<unsigned char const*>( data );
+
+	in_flight_packet_t packet;
+	packet.deliveryTimeSeconds = sendTimeSeconds + m_latencySeconds + ( m_jitterSeconds * m_rng.RollRandomFloatZeroToOneInclusive() );
+	packet.data.assign( dataAsBytes, dataAsBytes + dataSize );
+	m_inFlightPackets.push_back( packet );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Hands back the earliest packet that has arrived by currentTimeSeconds, if any
+bool SimulatedLink::Receive( double currentTimeSeconds, std::vector<unsigned char>& out_packet )
+{
+	size_t const packetCount = m_inFlightPackets.size();
+	size_t earliestIndex = packetCount;
+	for( size_t packetIndex = 0; packetIndex < packetCount; ++packetIndex )
+	{
+		double deliveryTime = m_inFlightPackets[ packetIndex ].deliveryTimeSeconds;
+		if( deliveryTime <= currentTimeSeconds && ( earliestIndex == packetCount || deliveryTime < m_inFlightPackets[ earliestIndex ].deliveryTimeSeconds ) )
+		{
+			earliestIndex = packetIndex;
+		}
+	}
+
+	if( earliestIndex == packetCount )
+		return false;
+
+	out_packet.swap( m_inFlightPackets[ earliestIndex ].data );
+	m_inFlightPackets[ earliestIndex ] = m_inFlightPackets.back();
+	m_inFlightPackets.pop_back();
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static Vec3 GetSimulatedEntityPosition( double serverTimeSeconds )
+{
+	float angleRadians = static_cast<float>( serverTimeSeconds );
+	return Vec3( cosf( angleRadians ), sinf( angleRadians ), 0.f ) * SIMULATED_ENTITY_ORBIT_RADIUS;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Walks, strafes, sprints and looks around on overlapping cycles so every kind of command gets predicted
+static void UpdateScriptedInput( InputState& inputState, double timeSeconds, bool isIdle )
+{
+	inputState.m_keyStates[ 'W' ].UpdateStatus( !isIdle && fmod( timeSeconds, 3.0 ) < 2.0 );
+	inputState.m_keyStates[ 'A' ].UpdateStatus( !isIdle && fmod( timeSeconds, 5.0 ) > 3.5 );
+	inputState.m_keyStates[ 'Q' ].UpdateStatus( !isIdle && fmod( timeSeconds, 7.0 ) > 6.0 );
+	inputState.m_keyStates[ KEY_CODE_SHIFT ].UpdateStatus( !isIdle && fmod( timeSeconds, 4.0 ) > 3.0 );
+
+	float time = static_cast<float>( timeSeconds );
+	inputState.m_cursorRelativeMovement = isIdle ? Vec2( 0.f, 0.f ) : Vec2( 2.f * sinf( time * 1.3f ), 0.5f * cosf( time * 0.7f ) );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool RunNetworkSimulationTest( float lossFraction, double latencySeconds, double jitterSeconds, double durationSeconds, network_simulation_results_t& out_results )
+{
+	SimulatedLink inputLink( lossFraction, latencySeconds, jitterSeconds, 1 );
+	SimulatedLink cameraLink( lossFraction, latencySeconds, jitterSeconds, 2 );
+	SimulatedLink snapshotLink( lossFraction, latencySeconds, jitterSeconds, 3 );
+
+	ClientPrediction prediction;
+	SnapshotInterpolator interpolator;
+	InputState scriptedInput;
+
+	InputSystem* serverInput = new InputSystem();
+	CameraData serverCamera;
+	uint lastProcessedSequence = 0;
+	uint lostCommandCount = 0;
+
+	std::vector<unsigned char> packet;
+	std::vector<InputCommand> receivedCommands;
+	WorldData snapshot;
+	WorldData receivedSnapshot;
+	WorldData sampledSnapshot;
+
+	uint sampleCount = 0;
+	double totalInterpolationError = 0.0;
+	float maxInterpolationError = 0.f;
+
+	uint frameCount = static_cast<uint>( ( durationSeconds + SIMULATION_SETTLE_SECONDS ) / SIMULATION_FRAME_SECONDS );
+	for( uint frameIndex = 0; frameIndex < frameCount; ++frameIndex )
+	{
+		double currentTime = static_cast<double>( frameIndex ) * SIMULATION_FRAME_SECONDS;
+
+		// Client: predict this frame's command and send everything the server hasn't acknowledged
+		UpdateScriptedInput( scriptedInput, currentTime, currentTime >= durationSeconds );
+		prediction.AddLocalCommand( scriptedInput, static_cast<float>( SIMULATION_FRAME_SECONDS ) );
+		prediction.WriteUnacknowledgedCommands( packet );
+		inputLink.Send( packet.data(), packet.size(), currentTime );
+
+		// Server: run new commands in order, then send back the camera and, every few frames, the world
+		while( inputLink.Receive( currentTime, packet ) )
+		{
+			if( !ReadInputCommandPacket( packet.data(), packet.size(), receivedCommands ) )
+				continue;
+
+			for( size_t commandIndex = 0; commandIndex < receivedCommands.size(); ++commandIndex )
+			{
+				InputCommand const& command = receivedCommands[ commandIndex ];
+				if( command.m_sequence <= lastProcessedSequence )
+					continue;
+
+				lostCommandCount += command.m_sequence - lastProcessedSequence - 1;
+				serverInput->SetFromInputState( command.m_inputState );
+				SimulateFreeCameraCommand( serverCamera, serverInput, command.m_deltaSeconds );
+				lastProcessedSequence = command.m_sequence;
+			}
+		}
+
+		serverCamera.m_lastProcessedInputSequence = lastProcessedSequence;
+		cameraLink.Send( &serverCamera, sizeof( serverCamera ), currentTime );
+
+		if( frameIndex % SIMULATION_SNAPSHOT_INTERVAL_FRAMES == 0 )
+		{
+			EntityData& entity = snapshot.m_currentMapData.m_entities[ 0 ];
+			entity.m_isDead		= false;
+			entity.m_position	= GetSimulatedEntityPosition( currentTime );
+			entity.m_yaw		= ConvertRadiansToDegrees( static_cast<float>( currentTime ) ) + 90.f;
+			strncpy_s( entity.m_entityDefName, sizeof( entity.m_entityDefName ), "SimulatedEntity", _TRUNCATE );
+			strncpy_s( snapshot.m_currentMapByName, sizeof( snapshot.m_currentMapByName ), "SimulatedMap", _TRUNCATE );
+			snapshot.m_currentMapData.m_numEntities = 1;
+			snapshot.m_serverTimeSeconds = currentTime;
+			snapshotLink.Send( &snapshot, sizeof( snapshot ), currentTime );
+		}
+
+		// Client: correct the prediction and show the remote entity from the buffered snapshots
+		while( cameraLink.Receive( currentTime, packet ) )
+		{
+			CameraData authoritativeCamera;
+			memcpy( static_cast<void*>( &authoritativeCamera ), packet.data(), sizeof( authoritativeCamera ) );
+			prediction.Reconcile( authoritativeCamera );
+		}
+
+		while( snapshotLink.Receive( currentTime, packet ) )
+		{
+			memcpy( static_cast<void*>( &receivedSnapshot ), packet.data(), sizeof( receivedSnapshot ) );
+			interpolator.AddSnapshot( receivedSnapshot, currentTime );
+		}
+
+		if( interpolator.Sample( currentTime, sampledSnapshot ) && currentTime >= SIMULATION_WARMUP_SECONDS )
+		{
+			Vec3 truePosition = GetSimulatedEntityPosition( interpolator.GetRenderServerTime( currentTime ) );
+			float interpolationError = GetDistance3D( sampledSnapshot.m_currentMapData.m_entities[ 0 ].m_position, truePosition );
+			totalInterpolationError += interpolationError;
+			maxInterpolationError = Maxf( maxInterpolationError, interpolationError );
+			++sampleCount;
+		}
+	}
+
+	delete serverInput;
+	serverInput = nullptr;
+
+	CameraData const& predictedCamera = prediction.GetPredictedCamera();
+	float predictionError = GetDistance3D( predictedCamera.m_position, serverCamera.m_position );
+	predictionError = Maxf( predictionError, fabsf( predictedCamera.m_yawDegrees - serverCamera.m_yawDegrees ) );
+
+	out_results.inputPacketsSent			= inputLink.GetSentCount();
+	out_results.inputPacketsDropped			= inputLink.GetDroppedCount();
+	out_results.lostCommandCount			= lostCommandCount;
+	out_results.correctionCount				= prediction.GetCorrectionCount();
+	out_results.lastCorrectionDistance		= prediction.GetLastCorrectionDistance();
+	out_results.predictionError				= predictionError;
+
+	out_results.snapshotsSent				= snapshotLink.GetSentCount();
+	out_results.snapshotsDropped			= snapshotLink.GetDroppedCount();
+	out_results.snapshotsDiscarded			= interpolator.GetDiscardedSnapshotCount();
+	out_results.interpolationSampleCount	= sampleCount;
+	out_results.extrapolatedSampleCount		= interpolator.GetExtrapolatedSampleCount();
+	out_results.meanInterpolationError		= sampleCount > 0 ? totalInterpolationError / static_cast<double>( sampleCount ) : 0.0;
+	out_results.maxInterpolationError		= maxInterpolationError;
+
+	out_results.isPredictionSettled			= predictionError <= MAX_PREDICTION_ERROR;
+	out_results.isInterpolationClose		= sampleCount > 0 && maxInterpolationError <= MAX_INTERPOLATION_ERROR;
+	return out_results.isPredictionSettled && out_results.isInterpolationClose;
+}
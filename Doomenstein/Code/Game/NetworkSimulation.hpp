@@ -0,0 +1,69 @@
+#pragma once
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include <vector>
+
+
+//---------------------------------------------------------------------------------------------------------
+// One direction of a fake connection: each packet is dropped with lossFraction probability, otherwise it
+// arrives latency plus a random share of jitter after it was sent, so packets can overtake each other
+//---------------------------------------------------------------------------------------------------------
+class SimulatedLink
+{
+public:
+	SimulatedLink( float lossFraction, double latencySeconds, double jitterSeconds, unsigned int seed );
+	~SimulatedLink() {}
+
+	void	Send( void const* data, size_t dataSize, double sendTimeSeconds );
+	bool	Receive( double currentTimeSeconds, std::vector<unsigned char>& out_packet );
+
+	uint	GetSentCount() const			{ return m_sentCount; }
+	uint	GetDroppedCount() const			{ return m_droppedCount; }
+
+private:
+	struct in_flight_packet_t
+	{
+		double						deliveryTimeSeconds	= 0.0;
+		std::vector<unsigned char>	data;
+	};
+
+private:
+	RandomNumberGenerator			m_rng;
+	std::vector<in_flight_packet_t>	m_inFlightPackets;
+
+	float	m_lossFraction		= 0.f;
+	double	m_latencySeconds	= 0.0;
+	double	m_jitterSeconds		= 0.0;
+	uint	m_sentCount			= 0;
+	uint	m_droppedCount		= 0;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+struct network_simulation_results_t
+{
+	uint	inputPacketsSent			= 0;
+	uint	inputPacketsDropped			= 0;
+	uint	lostCommandCount			= 0;	// commands the server never saw, because every packet carrying them was lost
+	uint	correctionCount				= 0;
+	float	lastCorrectionDistance		= 0.f;
+	float	predictionError				= 0.f;
+
+	uint	snapshotsSent				= 0;
+	uint	snapshotsDropped			= 0;
+	uint	snapshotsDiscarded			= 0;
+	uint	interpolationSampleCount	= 0;
+	uint	extrapolatedSampleCount		= 0;
+	double	meanInterpolationError		= 0.0;
+	float	maxInterpolationError		= 0.f;
+
+	bool	isPredictionSettled			= false;
+	bool	isInterpolationClose		= false;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Runs a scripted client against an in-process server over SimulatedLinks at 60 frames per second and
+// checks that the predicted camera settles exactly on the server's and that interpolated remote entities
+// stay close to where they really were. Returns whether both checks passed.
+bool RunNetworkSimulationTest( float lossFraction, double latencySeconds, double jitterSeconds, double durationSeconds, network_simulation_results_t& out_results );
@@ -59,15 +59,30 @@ void RemoteClient::EndFrame()
 
 
 //---------------------------------------------------------------------------------------------------------
+// Every command the client sent is run once, in order, with the frame time it was made with; that's what
+// lets the client predict exactly where its camera will end up
 void RemoteClient::Update()
 {
 	if( m_isDisconnecting )
 		return;
 
-	Vec2 relativeMovement = m_input->GetCursorRelativeMovement();
-	m_pitchDegrees += -relativeMovement.y;
-	m_yawDegrees += relativeMovement.x;
-	Clamp( m_pitchDegrees, -89.9f, 89.9f );
+	while( !m_pendingCommands.empty() )
+	{
+		RunInputCommand( m_pendingCommands.front() );
+		m_pendingCommands.pop_front();
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void RemoteClient::RunInputCommand( InputCommand const& command )
+{
+	SetInputFromInputState( command.m_inputState );
+	m_lastProcessedInputSequence = command.m_sequence;
+
+	CameraData cameraData = GetCameraData();
+	SimulateCameraLook( cameraData, m_input );
+	SetCameraFromCameraData( cameraData );
 
 	if( m_possessedEntity != nullptr )
 	{
@@ -97,12 +112,12 @@ void RemoteClient::Update()
 
 	if( m_possessedEntity != nullptr )
 	{
-		m_position = g_theGame->MoveEntity( m_possessedEntity, m_yawDegrees, m_input );
+		m_position = g_theGame->MoveEntity( m_possessedEntity, command.m_deltaSeconds, m_yawDegrees, m_input );
 		g_theGame->MoveCameraToEntityEye( m_possessedEntity, m_position, m_yawDegrees );
 	}
 	else
 	{
-		m_position += g_theGame->MoveWorldCamera( g_theGame->GetDeltaSeconds(), m_yawDegrees, m_input );
+		m_position += GetFreeCameraTranslation( command.m_deltaSeconds, m_yawDegrees, m_input );
 	}
 }
 
@@ -122,6 +137,8 @@ CameraData RemoteClient::GetCameraData() const
 	cameraData.m_yawDegrees = m_yawDegrees;
 	cameraData.m_pitchDegrees = m_pitchDegrees;
 	cameraData.m_rollDegrees = m_rollDegrees;
+	cameraData.m_lastProcessedInputSequence = m_lastProcessedInputSequence;
+	cameraData.m_isPossessingEntity = m_possessedEntity != nullptr;
 
 	return cameraData;
 }
@@ -202,11 +219,20 @@ void RemoteClient::ProcessInputData( UDPMessage const& message )
 	UnpackUDPMessage( message );
 
 	UDPPacket inputPacket( m_packets[MESSAGE_ID_INPUT_DATA] );
-	InputState newInputState;
-	if( inputPacket.IsReadyToRead() )
+	std::vector<InputCommand> commands;
+	if( !inputPacket.IsReadyToRead() || !ReadInputCommandPacket( inputPacket.m_data, inputPacket.m_size, commands ) )
+		return;
+
+	// Each packet repeats the commands that haven't been acknowledged yet; only the new ones are queued.
+	// A gap means commands were lost for good, and the client's reconciliation absorbs it.
+	uint newestKnownSequence = m_pendingCommands.empty() ? m_lastProcessedInputSequence : m_pendingCommands.back().m_sequence;
+	for( int commandIndex = 0; commandIndex < commands.size(); ++commandIndex )
 	{
-		memcpy( &newInputState, &inputPacket.m_data[0], sizeof( InputState ) );
-		SetInputFromInputState( newInputState );
+		if( commands[commandIndex].m_sequence > newestKnownSequence )
+		{
+			m_pendingCommands.push_back( commands[commandIndex] );
+			newestKnownSequence = commands[commandIndex].m_sequence;
+		}
 	}
 }
 
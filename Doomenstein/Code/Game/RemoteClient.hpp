@@ -1,6 +1,8 @@
 #pragma once
 #include "Engine/Math/Vec3.hpp"
 #include "Game/Client.hpp"
+#include "Game/ClientPrediction.hpp"
+#include <deque>
 
 class Server;
 class Entity;
@@ -22,6 +24,7 @@ public:
 	CameraData	GetCameraData() const;
 
 	void SetInputFromInputState( InputState const& inputState );
+	void RunInputCommand( InputCommand const& command );
 	void SetCameraFromCameraData( CameraData const& cameraData );
 
 	void ProcessUDPMessages();
@@ -47,4 +50,7 @@ protected:
 	float			m_rollDegrees		= 0.f;
 	InputSystem*	m_input				= nullptr;
 	Entity*			m_possessedEntity	= nullptr;
+
+	std::deque<InputCommand>	m_pendingCommands;
+	uint						m_lastProcessedInputSequence	= 0;
 };
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "Engine/Math/RandomNumberGenerator.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/Time.hpp"
 #include "Engine/Input/InputSystem.hpp"
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Network/UDPSocket.hpp"
@@ -93,6 +94,7 @@ void RemoteServer::Update()
 	if( g_theGame != nullptr )
 	{
 		g_theGame->UpdateWorld();
+		ApplyInterpolatedSnapshot();
 	}
 
 	for( int clientIndex = 0; clientIndex < m_clients.size(); ++clientIndex )
@@ -108,11 +110,29 @@ void RemoteServer::SendInputData()
 	if( m_socket == nullptr )
 		return;
 
-	if( m_frameNum % 1 == 0 && !g_theConsole->IsOpen() )
+	// The command is run locally right away; the server's answer only corrects it
+	if( !g_theConsole->IsOpen() )
 	{
-		InputState inputState = g_theInput->GetInputState();
-		SendLargeUDPData( m_socket, m_connectionIP, m_udpSendPort, &inputState, sizeof( InputState ), MESSAGE_ID_INPUT_DATA, m_frameNum );
-		//g_theNetworkSystem->SendUDPMessage( inputMessage );
+		m_prediction.AddLocalCommand( g_theInput->GetInputState(), g_theGame->GetDeltaSeconds() );
+		g_theGame->SetWorldCameraFromCameraData( m_prediction.GetPredictedCamera() );
+	}
+
+	if( m_prediction.GetUnacknowledgedCount() == 0 )
+		return;
+
+	std::vector<unsigned char> inputPacket;
+	m_prediction.WriteUnacknowledgedCommands( inputPacket );
+	SendLargeUDPData( m_socket, m_connectionIP, m_udpSendPort, inputPacket.data(), static_cast<uint>( inputPacket.size() ), MESSAGE_ID_INPUT_DATA, m_frameNum );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void RemoteServer::ApplyInterpolatedSnapshot()
+{
+	WorldData worldData;
+	if( m_snapshotInterpolator.Sample( GetCurrentTimeSeconds(), worldData ) )
+	{
+		g_theGame->UpdateEntitiesFromWorldData( worldData );
 	}
 }
 
@@ -205,7 +225,7 @@ void RemoteServer::ProcessEntityData( UDPMessage const& message )
 	if( entityPacket.IsReadyToRead() )
 	{
 		memcpy( &worldData, &entityPacket.m_data[0], entityPacket.m_size );
-		g_theGame->UpdateEntitiesFromWorldData( worldData );
+		m_snapshotInterpolator.AddSnapshot( worldData, GetCurrentTimeSeconds() );
 	}
 }
 
@@ -225,6 +245,7 @@ void RemoteServer::ProcessConnectionData( UDPMessage const& message )
 		memcpy( &connectionData, &connectionPacket.m_data[0], connectionPacket.m_size );
 		g_theGame->SetCurrentMapByName( connectionData.m_currentMapByName );
 		g_theGame->SpawnEntitiesFromSpawnData( connectionData.m_entityData );
+		m_snapshotInterpolator.Clear();
 	}
 }
 
@@ -242,7 +263,8 @@ void RemoteServer::ProcessCameraData( UDPMessage const& message )
 	if( cameraPacket.IsReadyToRead() )
 	{
 		memcpy( &cameraData, &cameraPacket.m_data[0], cameraPacket.m_size );
-		g_theGame->SetWorldCameraFromCameraData( cameraData );
+		m_prediction.Reconcile( cameraData );
+		g_theGame->SetWorldCameraFromCameraData( m_prediction.GetPredictedCamera() );
 	}
 }
 
@@ -1,5 +1,7 @@
 #pragma once
 #include "Game/Server.hpp"
+#include "Game/ClientPrediction.hpp"
+#include "Game/SnapshotInterpolator.hpp"
 
 
 class RemoteServer : public Server
@@ -15,6 +17,7 @@ public:
 	virtual void Update()						override;
 
 	void SendInputData();
+	void ApplyInterpolatedSnapshot();
 	void SendDisconnectMessage();
 	void RequestConnectionData();
 
@@ -38,4 +41,7 @@ private:
 	uint16_t m_key = 0;
 	UDPSocket* m_socket = nullptr;
 	UDPPacket m_packets[NUM_MESSAGE_ID] = {};
+
+	ClientPrediction		m_prediction;
+	SnapshotInterpolator	m_snapshotInterpolator;
 };
\ No newline at end of file
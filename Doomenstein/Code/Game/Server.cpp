@@ -54,7 +54,7 @@ void Server::SendLargeUDPData( UDPSocket* socket, std::string const& ipAddress,
 		message.m_header.m_seqNo = messageIndex;
 
 		uint currByte = messageIndex * MAX_UDP_DATA_SIZE;
-		memcpy( &message.m_data, &dataAsChar[currByte], MAX_UDP_DATA_SIZE );
+		memcpy( &message.m_data, &dataAsChar[currByte], Min( MAX_UDP_DATA_SIZE, dataSize - currByte ) );
 
 		g_theNetworkSystem->SendUDPMessage( socket, message );
 	}
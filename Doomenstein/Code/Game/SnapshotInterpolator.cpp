@@ -0,0 +1,156 @@
+#include "Engine/Math/MathUtils.hpp"
+#include "Game/SnapshotInterpolator.hpp"
+
+
+//---------------------------------------------------------------------------------------------------------
+// How far the server time offset moves toward a slower-than-best delivery each snapshot
+constexpr double SERVER_TIME_OFFSET_RELAX_FRACTION = 0.02;
+
+
+//---------------------------------------------------------------------------------------------------------
+SnapshotInterpolator::SnapshotInterpolator( double interpolationDelaySeconds, double maxExtrapolationSeconds )
+	: m_interpolationDelaySeconds( interpolationDelaySeconds )
+	, m_maxExtrapolationSeconds( maxExtrapolationSeconds )
+{
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void SnapshotInterpolator::AddSnapshot( WorldData const& worldData, double localTimeSeconds )
+{
+	double serverTimeOffset = worldData.m_serverTimeSeconds - localTimeSeconds;
+	if( !m_hasServerTimeOffset || serverTimeOffset > m_serverTimeOffsetSeconds )
+	{
+		m_serverTimeOffsetSeconds = serverTimeOffset;
+		m_hasServerTimeOffset = true;
+	}
+	else
+	{
+		m_serverTimeOffsetSeconds += ( serverTimeOffset - m_serverTimeOffsetSeconds ) * SERVER_TIME_OFFSET_RELAX_FRACTION;
+	}
+
+	// Reordered packets are slotted back into place; duplicates and anything older than the buffer are dropped
+	std::deque<WorldData>::iterator insertBefore = m_snapshots.end();
+	while( insertBefore != m_snapshots.begin() && ( insertBefore - 1 )->m_serverTimeSeconds > worldData.m_serverTimeSeconds )
+	{
+		--insertBefore;
+	}
+
+	bool isDuplicate = insertBefore != m_snapshots.begin() && ( insertBefore - 1 )->m_serverTimeSeconds == worldData.m_serverTimeSeconds;
+	bool isTooOld = insertBefore == m_snapshots.begin() && !m_snapshots.empty();
+	if( isDuplicate || isTooOld )
+	{
+		++m_discardedSnapshotCount;
+		return;
+	}
+
+	m_snapshots.insert( insertBefore, worldData );
+	while( m_snapshots.size() > MAX_BUFFERED_SNAPSHOTS )
+	{
+		m_snapshots.pop_front();
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool SnapshotInterpolator::Sample( double localTimeSeconds, WorldData& out_worldData )
+{
+	if( m_snapshots.empty() )
+		return false;
+
+	double renderTime = GetRenderServerTime( localTimeSeconds );
+
+	// Everything before the snapshot just behind renderTime is done with, but keep two for extrapolating
+	while( m_snapshots.size() > 2 && m_snapshots[ 1 ].m_serverTimeSeconds <= renderTime )
+	{
+		m_snapshots.pop_front();
+	}
+
+	WorldData const& oldest = m_snapshots.front();
+	WorldData const& newest = m_snapshots.back();
+	if( m_snapshots.size() == 1 || renderTime <= oldest.m_serverTimeSeconds )
+	{
+		out_worldData = renderTime <= oldest.m_serverTimeSeconds ? oldest : newest;
+		return true;
+	}
+
+	if( renderTime >= newest.m_serverTimeSeconds )
+	{
+		WorldData const& beforeNewest = m_snapshots[ m_snapshots.size() - 2 ];
+		double snapshotGap = newest.m_serverTimeSeconds - beforeNewest.m_serverTimeSeconds;
+		double extrapolationSeconds = GetClamp( renderTime - newest.m_serverTimeSeconds, 0.0, m_maxExtrapolationSeconds );
+		if( extrapolationSeconds > 0.0 )
+		{
+			++m_extrapolatedSampleCount;
+		}
+
+		float fraction = static_cast<float>( 1.0 + extrapolationSeconds / snapshotGap );
+		BlendSnapshots( beforeNewest, newest, fraction, out_worldData );
+		out_worldData.m_serverTimeSeconds = newest.m_serverTimeSeconds + extrapolationSeconds;
+		return true;
+	}
+
+	for( size_t snapshotIndex = 0; snapshotIndex + 1 < m_snapshots.size(); ++snapshotIndex )
+	{
+		WorldData const& older = m_snapshots[ snapshotIndex ];
+		WorldData const& newer = m_snapshots[ snapshotIndex + 1 ];
+		if( renderTime < newer.m_serverTimeSeconds )
+		{
+			float fraction = static_cast<float>( ( renderTime - older.m_serverTimeSeconds ) / ( newer.m_serverTimeSeconds - older.m_serverTimeSeconds ) );
+			BlendSnapshots( older, newer, fraction, out_worldData );
+			out_worldData.m_serverTimeSeconds = renderTime;
+			return true;
+		}
+	}
+
+	out_worldData = newest;
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void SnapshotInterpolator::Clear()
+{
+	m_snapshots.clear();
+	m_hasServerTimeOffset = false;
+	m_serverTimeOffsetSeconds = 0.0;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+double SnapshotInterpolator::GetRenderServerTime( double localTimeSeconds ) const
+{
+	return localTimeSeconds + m_serverTimeOffsetSeconds - m_interpolationDelaySeconds;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Positions and facing are blended; everything else (health, death, action, which entity is in the slot)
+// comes from whichever snapshot is nearer. A fraction past 1 extrapolates.
+void SnapshotInterpolator::BlendSnapshots( WorldData const& older, WorldData const& newer, float fraction, WorldData& out_worldData ) const
+{
+	out_worldData = fraction < 0.5f ? older : newer;
+	if( !IsStringEqual( older.m_currentMapByName, newer.m_currentMapByName ) )
+		return;
+
+	MapData const& olderMap = older.m_currentMapData;
+	MapData const& newerMap = newer.m_currentMapData;
+	int blendCount = GetClamp( olderMap.m_numEntities, 0, newerMap.m_numEntities );
+	for( int entityIndex = 0; entityIndex < blendCount; ++entityIndex )
+	{
+		EntityData const& olderEntity = olderMap.m_entities[ entityIndex ];
+		EntityData const& newerEntity = newerMap.m_entities[ entityIndex ];
+		if( olderEntity.m_isDead || newerEntity.m_isDead || !IsStringEqual( olderEntity.m_entityDefName, newerEntity.m_entityDefName ) )
+			continue;
+
+		EntityData& entity = out_worldData.m_currentMapData.m_entities[ entityIndex ];
+		entity.m_position = olderEntity.m_position + ( ( newerEntity.m_position - olderEntity.m_position ) * fraction );
+		entity.m_yaw = olderEntity.m_yaw + ( GetShortestAngularDisplacement( olderEntity.m_yaw, newerEntity.m_yaw ) * fraction );
+
+		Vec2 forwardDirection = olderEntity.m_forwardDirection + ( ( newerEntity.m_forwardDirection - olderEntity.m_forwardDirection ) * fraction );
+		if( forwardDirection.GetLengthSquared() > 0.f )
+		{
+			entity.m_forwardDirection = forwardDirection.GetNormalized();
+		}
+	}
+}
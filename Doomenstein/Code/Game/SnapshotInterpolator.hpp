@@ -0,0 +1,49 @@
+#pragma once
+#include "Game/NetworkData.hpp"
+#include <deque>
+
+
+//---------------------------------------------------------------------------------------------------------
+constexpr double	DEFAULT_SNAPSHOT_INTERPOLATION_DELAY	= 0.2;
+constexpr double	DEFAULT_MAX_SNAPSHOT_EXTRAPOLATION		= 0.25;
+constexpr uint		MAX_BUFFERED_SNAPSHOTS					= 32;
+
+
+//---------------------------------------------------------------------------------------------------------
+// Remote entities are shown a fixed delay in the past, between the two world snapshots on either side of
+// that moment, rather than jumping whenever a snapshot arrives. The delay has to cover the gap between
+// snapshots plus the network's jitter, or the newest snapshot runs out and positions are extrapolated from
+// the last two, for at most the extrapolation limit, before they hold still.
+//
+// Server time comes from each snapshot. The offset to local time tracks the fastest delivery seen and
+// relaxes slowly, so a late packet doesn't drag the whole view back.
+//---------------------------------------------------------------------------------------------------------
+class SnapshotInterpolator
+{
+public:
+	explicit SnapshotInterpolator( double interpolationDelaySeconds = DEFAULT_SNAPSHOT_INTERPOLATION_DELAY, double maxExtrapolationSeconds = DEFAULT_MAX_SNAPSHOT_EXTRAPOLATION );
+	~SnapshotInterpolator() {}
+
+	void	AddSnapshot( WorldData const& worldData, double localTimeSeconds );
+	bool	Sample( double localTimeSeconds, WorldData& out_worldData );
+	void	Clear();
+
+	double	GetRenderServerTime( double localTimeSeconds ) const;
+	bool	HasSnapshots() const						{ return !m_snapshots.empty(); }
+	uint	GetExtrapolatedSampleCount() const			{ return m_extrapolatedSampleCount; }
+	uint	GetDiscardedSnapshotCount() const			{ return m_discardedSnapshotCount; }
+
+private:
+	void	BlendSnapshots( WorldData const& older, WorldData const& newer, float fraction, WorldData& out_worldData ) const;
+
+private:
+	std::deque<WorldData>	m_snapshots;		// oldest first, by server time
+
+	double	m_interpolationDelaySeconds		= DEFAULT_SNAPSHOT_INTERPOLATION_DELAY;
+	double	m_maxExtrapolationSeconds		= DEFAULT_MAX_SNAPSHOT_EXTRAPOLATION;
+	double	m_serverTimeOffsetSeconds		= 0.0;
+	bool	m_hasServerTimeOffset			= false;
+
+	uint	m_extrapolatedSampleCount		= 0;
+	uint	m_discardedSnapshotCount		= 0;
+};
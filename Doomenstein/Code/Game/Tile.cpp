@@ -1,23 +1,8 @@
 #include "Game/Tile.hpp"
-#include "Game/MapRegion.hpp"
 
 //---------------------------------------------------------------------------------------------------------
-Tile::Tile( MapRegion* regionType, IntVec2 const& tileCoords )
+Tile::Tile( uint16_t regionIndex, bool isSolid )
+	: m_regionIndex( regionIndex )
+	, m_flags( isSolid ? TILE_FLAG_SOLID : 0 )
 {
-	m_regionType = regionType;
-	m_tileCoords = tileCoords;
-}
-
-
-//---------------------------------------------------------------------------------------------------------
-Tile::~Tile()
-{
-
-}
-
-
-//---------------------------------------------------------------------------------------------------------
-bool Tile::IsSolid() const
-{
-	return m_regionType->IsSolid();
 }
@@ -1,20 +1,32 @@
 #pragma once
-#include "Engine/Math/Vec2.hpp"
-#include "Engine/Math/IntVec2.hpp"
+#include <stdint.h>
 
-class MapRegion;
 
+//---------------------------------------------------------------------------------------------------------
+enum TileFlag : uint8_t
+{
+	TILE_FLAG_SOLID		= 1 << 0,
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Four bytes, stored by value in the TileMap. The region is an index into the owning map's region palette
+// and solidity is cached in the flags, so wall tests never leave the tile array.
+//---------------------------------------------------------------------------------------------------------
 class Tile
 {
 public:
-	explicit Tile( MapRegion* regionType, IntVec2 const& tileCoords );
-	~Tile();
+	Tile() = default;
+	explicit Tile( uint16_t regionIndex, bool isSolid );
 
-	bool		IsSolid() const;
-	IntVec2		GetTileCoords() const	{ return m_tileCoords; }
-	MapRegion*	GetRegionType() const	{ return m_regionType; }
+	bool		IsSolid() const				{ return ( m_flags & TILE_FLAG_SOLID ) != 0; }
+	bool		HasRegion() const			{ return m_regionIndex != INVALID_REGION_INDEX; }
+	uint16_t	GetRegionIndex() const		{ return m_regionIndex; }
+
+public:
+	static constexpr uint16_t INVALID_REGION_INDEX = 0xffff;
 
 private:
-	IntVec2		m_tileCoords;
-	MapRegion*	m_regionType = nullptr;
-};
\ No newline at end of file
+	uint16_t	m_regionIndex	= INVALID_REGION_INDEX;
+	uint8_t		m_flags			= TILE_FLAG_SOLID;		// tiles the map rows never set stay solid and unrendered
+};
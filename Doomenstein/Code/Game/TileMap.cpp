@@ -7,6 +7,7 @@
 #include "Engine/Renderer/MeshUtils.hpp"
 #include "Engine/Renderer/GPUMesh.hpp"
 #include "Engine/Math/AABB3.hpp"
+#include "Engine/Renderer/Camera.hpp"
 #include "Engine/Core/Vertex_PCUTBN.hpp"
 #include "Engine/Core/DevConsole.hpp"
 #include "Game/MapMaterial.hpp"
@@ -23,14 +24,21 @@
 TileMap::TileMap( Game* theGame, World* theWorld, std::string const& name, XmlElement const& xmlElement )
 	: Map( theGame, theWorld, name )
 {
-	m_mapMesh = new GPUMesh( g_theRenderer );
+	m_terrainTexture = g_theRenderer->GetOrCreateTextureHandle( "Data/Images/Terrain_8x8.png" );
+
 	CreateFromXML( xmlElement );
+	CreateChunks();
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 TileMap::~TileMap()
 {
+	for( int chunkIndex = 0; chunkIndex < m_chunks.size(); ++chunkIndex )
+	{
+		delete m_chunks[ chunkIndex ].mesh;
+		m_chunks[ chunkIndex ].mesh = nullptr;
+	}
 }
 
 
@@ -82,8 +90,7 @@ RaycastResult TileMap::RaycastAgainstWalls( Vec3 const& startPosition, Vec3 cons
 	currentTileCoords.x = RoundDownToInt( startPosition.x );
 	currentTileCoords.y = RoundDownToInt( startPosition.y );
 
-	Tile* tile = GetTileByCoords( currentTileCoords );
-	if( IsTileSolid( tile ) )
+	if( IsTileSolid( currentTileCoords ) )
 	{
 		return RaycastResult( startPosition, fwdDir, maxDistance, startPosition, true, 0.f, -fwdDir );
 	}
@@ -112,8 +119,7 @@ RaycastResult TileMap::RaycastAgainstWalls( Vec3 const& startPosition, Vec3 cons
 				return RaycastResult( startPosition, fwdDir, maxDistance, startPosition + rayDisplacement, false, maxDistance );
 
 			currentTileCoords.x += xStepSign;
-			tile = GetTileByCoords( currentTileCoords );
-			if( IsTileSolid( tile ) )
+			if( IsTileSolid( currentTileCoords ) )
 			{
 				Vec3 impactPosition = startPosition + ( fwdDir * ( maxDistance * nextCrossingX ) );
 				return RaycastResult( startPosition, fwdDir, maxDistance, impactPosition, true, maxDistance * nextCrossingX, Vec3( (float)(-xStepSign), 0.f, 0.f ) );
@@ -126,8 +132,7 @@ RaycastResult TileMap::RaycastAgainstWalls( Vec3 const& startPosition, Vec3 cons
 				return RaycastResult( startPosition, fwdDir, maxDistance, startPosition + rayDisplacement, false, maxDistance );
 
 			currentTileCoords.y += yStepSign;
-			tile = GetTileByCoords( currentTileCoords );
-			if( IsTileSolid( tile ) )
+			if( IsTileSolid( currentTileCoords ) )
 			{
 				Vec3 impactPosition = startPosition + ( fwdDir * ( maxDistance * nextCrossingY ) );
 				return RaycastResult( startPosition, fwdDir, maxDistance, impactPosition, true, maxDistance * nextCrossingY, Vec3( 0.f, (float)(-yStepSign), 0.f ) );
@@ -282,7 +287,7 @@ Vec3 TileMap::GetClosestPointFromList( Vec3 const& point, std::vector<Vec3> cons
 //---------------------------------------------------------------------------------------------------------
 void TileMap::Update()
 {
-	CreateMapVerts();
+	RebuildDirtyChunks();
 	UpdateEntities();
 	HandleEntityVEntityCollisions();
 	HandleEntitiesVWallCollisions();
@@ -316,20 +321,71 @@ void TileMap::Render() const
 //---------------------------------------------------------------------------------------------------------
 void TileMap::RenderMap() const
 {
-	g_theRenderer->BindTextureByPath( "Data/Images/Terrain_8x8.png" );
+	g_theRenderer->BindTextureByHandle( m_terrainTexture );
 	g_theRenderer->BindShader( (Shader*)nullptr );
 
-	g_theRenderer->DrawMesh( m_mapMesh );
+	Frustum frustum = m_game->GetPlayerCamera()->GetFrustum();
+	m_visibleIndices.resize( m_chunkTree.GetBoundsCount() );
+	uint visibleChunkCount = m_chunkTree.CullVisible( frustum, m_visibleIndices.data() );
+	for( uint visibleIndex = 0; visibleIndex < visibleChunkCount; ++visibleIndex )
+	{
+		tile_map_chunk_t const& chunk = m_chunks[ m_visibleIndices[ visibleIndex ] ];
+		if( chunk.vertexCount > 0 )
+		{
+			g_theRenderer->DrawMesh( chunk.mesh );
+		}
+	}
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 void TileMap::RenderEntities() const
 {
+	// Indices have to line up with m_entities, so dead and empty slots get an empty sphere and are skipped
+	// after the cull
+	m_entityBounds.resize( m_entities.size() );
 	for( uint entityIndex = 0; entityIndex < m_entities.size(); ++entityIndex )
 	{
 		Entity* currentEntity = m_entities[ entityIndex ];
 		if( currentEntity != nullptr && !currentEntity->GetIsDead() )
+		{
+			m_entityBounds[ entityIndex ] = currentEntity->GetRenderBounds();
+		}
+		else
+		{
+			m_entityBounds[ entityIndex ] = Sphere3();
+		}
+	}
+
+	Frustum frustum = m_game->GetPlayerCamera()->GetFrustum();
+	m_visibleIndices.resize( m_entityBounds.size() );
+	uint visibleEntityCount = frustum.CullSpheres( m_entityBounds.data(), static_cast<uint>( m_entityBounds.size() ), m_visibleIndices.data() );
+
+	// Billboards go out in one draw per run of the same texture; with the entity sprite atlas that's one
+	Texture const* batchTexture = nullptr;
+	for( uint visibleIndex = 0; visibleIndex < visibleEntityCount; ++visibleIndex )
+	{
+		Entity* currentEntity = m_entities[ m_visibleIndices[ visibleIndex ] ];
+		if( currentEntity == nullptr || currentEntity->GetIsDead() )
+			continue;
+
+		Texture const* spriteTexture = currentEntity->GetSpriteTexture();
+		if( spriteTexture == nullptr )
+			continue;
+
+		if( spriteTexture != batchTexture )
+		{
+			FlushEntitySprites( batchTexture );
+			batchTexture = spriteTexture;
+		}
+		currentEntity->AppendSpriteVerts( m_spriteVerts );
+	}
+	FlushEntitySprites( batchTexture );
+
+	for( uint visibleIndex = 0; visibleIndex < visibleEntityCount; ++visibleIndex )
+	{
+		Entity* currentEntity = m_entities[ m_visibleIndices[ visibleIndex ] ];
+		if( currentEntity != nullptr && !currentEntity->GetIsDead() )
 		{
 			currentEntity->Render();
 		}
@@ -337,6 +393,19 @@ void TileMap::RenderEntities() const
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+void TileMap::FlushEntitySprites( Texture const* spriteTexture ) const
+{
+	if( m_spriteVerts.empty() )
+		return;
+
+	g_theRenderer->BindTexture( spriteTexture );
+	g_theRenderer->BindShaderByHandle( m_worldOpaqueShader );
+	g_theRenderer->DrawVertexArray( m_spriteVerts );
+	m_spriteVerts.clear();
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 IntVec2 TileMap::GetTileXYCoordsForTileIndex( int tileIndex ) const
 {
@@ -349,7 +418,7 @@ IntVec2 TileMap::GetTileXYCoordsForTileIndex( int tileIndex ) const
 //---------------------------------------------------------------------------------------------------------
 Vec3 TileMap::GetTilePositionForTileIndex( int tileIndex ) const
 {
-	IntVec2 tileCoords = m_tiles[ tileIndex ]->GetTileCoords();
+	IntVec2 tileCoords = GetTileXYCoordsForTileIndex( tileIndex );
 	return Vec3( static_cast<float>( tileCoords.x ), static_cast<float>( tileCoords.y ), 0.f );
 }
 
@@ -363,10 +432,69 @@ int TileMap::GetTileIndexFromCoords( IntVec2 tileCoords ) const
 
 
 //---------------------------------------------------------------------------------------------------------
-Tile* TileMap::GetTileByCoords( IntVec2 tileCoords ) const
+bool TileMap::IsTileInBounds( IntVec2 const& tileCoords ) const
 {
+	return tileCoords.x >= 0 && tileCoords.x < m_dimensions.x && tileCoords.y >= 0 && tileCoords.y < m_dimensions.y;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Everything outside the map counts as solid wall
+bool TileMap::IsTileSolid( IntVec2 const& tileCoords ) const
+{
+	if( !IsTileInBounds( tileCoords ) )
+	{
+		return true;
+	}
+	return m_tiles[ GetTileIndexFromCoords( tileCoords ) ].IsSolid();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+MapRegion* TileMap::GetTileRegion( IntVec2 const& tileCoords ) const
+{
+	if( !IsTileInBounds( tileCoords ) )
+	{
+		return nullptr;
+	}
+
+	Tile const& tile = m_tiles[ GetTileIndexFromCoords( tileCoords ) ];
+	if( !tile.HasRegion() )
+	{
+		return nullptr;
+	}
+	return m_regionPalette[ tile.GetRegionIndex() ];
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void TileMap::SetTileRegion( IntVec2 const& tileCoords, MapRegion* regionType )
+{
+	if( !IsTileInBounds( tileCoords ) || regionType == nullptr )
+	{
+		return;
+	}
+
 	int tileIndex = GetTileIndexFromCoords( tileCoords );
-	return m_tiles[ tileIndex ];
+	m_tiles[ tileIndex ] = Tile( GetOrAddRegionIndex( regionType ), regionType->IsSolid() );
+	MarkChunksDirtyAroundTile( tileCoords );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+uint16_t TileMap::GetOrAddRegionIndex( MapRegion* regionType )
+{
+	for( uint16_t regionIndex = 0; regionIndex < m_regionPalette.size(); ++regionIndex )
+	{
+		if( m_regionPalette[ regionIndex ] == regionType )
+		{
+			return regionIndex;
+		}
+	}
+
+	GUARANTEE_OR_DIE( m_regionPalette.size() < Tile::INVALID_REGION_INDEX, "Too many map regions in one TileMap" );
+	m_regionPalette.push_back( regionType );
+	return static_cast<uint16_t>( m_regionPalette.size() - 1 );
 }
 
 
@@ -526,11 +654,9 @@ void TileMap::PushEntityOutOfWall( Entity* entity, int xDir, int yDir )
 	currentTileCoords.y = RoundDownToInt( entityPositionXY.y );
 
 	IntVec2 tileToCheckCoords = currentTileCoords + IntVec2( xDir, yDir );
-	Tile* tileToCheck = GetTileByCoords( tileToCheckCoords );
-	
-	AABB2 tileXYBounds = GetTileXYBounds( tileToCheck );
+	AABB2 tileXYBounds = GetTileXYBounds( tileToCheckCoords );
 
-	if( IsTileSolid( tileToCheck ) && DoDiscAndAABB2Overlap( tileXYBounds, entityPositionXY, entityRadius ) )
+	if( IsTileSolid( tileToCheckCoords ) && DoDiscAndAABB2Overlap( tileXYBounds, entityPositionXY, entityRadius ) )
 	{
 		if( dynamic_cast<Projectile*>( entity ) != nullptr )
 		{
@@ -592,36 +718,13 @@ void TileMap::AddTileByLegendGlyph( char glyph, int xPosition, int yPosition )
 	}
 
 	int tileIndex = ( yPosition * m_dimensions.x ) + xPosition;
-	m_tiles[ tileIndex ] = new Tile( regionType, IntVec2( xPosition, yPosition ) );
-}
-
-
-//---------------------------------------------------------------------------------------------------------
-Tile* TileMap::GetTileInDirectionFromTileIndex( int tileIndex, int relativeXDistance, int relativeYDistance ) const
-{
-	IntVec2 currentTileCoords = GetTileXYCoordsForTileIndex( tileIndex );
-	IntVec2 tileCoordsToGet = currentTileCoords + IntVec2( relativeXDistance, relativeYDistance );
-
-	if( tileCoordsToGet.x < 0 || tileCoordsToGet.x >= m_dimensions.x )
-	{
-		return nullptr;
-	}
-	else if( tileCoordsToGet.y < 0 || tileCoordsToGet.y >= m_dimensions.y )
-	{
-		return nullptr;
-	}
-	else
-	{
-		return GetTileByCoords( tileCoordsToGet );
-	}
+	m_tiles[ tileIndex ] = Tile( GetOrAddRegionIndex( regionType ), regionType->IsSolid() );
 }
 
 
 //---------------------------------------------------------------------------------------------------------
-AABB2 TileMap::GetTileXYBounds( Tile* tile ) const
+AABB2 TileMap::GetTileXYBounds( IntVec2 const& tileCoords ) const
 {
-	IntVec2 tileCoords = tile->GetTileCoords();
-	
 	Vec2 tilePosition;
 	tilePosition.x = static_cast<float>( tileCoords.x );
 	tilePosition.y = static_cast<float>( tileCoords.y );
@@ -658,24 +761,93 @@ void TileMap::CreatePlayerStart( XmlElement const& xmlElement )
 
 
 //---------------------------------------------------------------------------------------------------------
-void TileMap::CreateMapVerts()
+void TileMap::CreateChunks()
 {
-	size_t numTiles = m_dimensions.x * m_dimensions.y;
-	size_t numFaces = numTiles * 4;
-	size_t numVerticies = numFaces * 6;
-	m_mapVerts.clear();
-	m_mapVerts.reserve( numVerticies );
+	m_chunkDimensions.x = ( m_dimensions.x + TILE_MAP_CHUNK_SIZE - 1 ) / TILE_MAP_CHUNK_SIZE;
+	m_chunkDimensions.y = ( m_dimensions.y + TILE_MAP_CHUNK_SIZE - 1 ) / TILE_MAP_CHUNK_SIZE;
 
+	size_t numChunks = static_cast<size_t>( m_chunkDimensions.x * m_chunkDimensions.y );
+	m_chunks.resize( numChunks );
 
-	for( uint tileIndex = 0; tileIndex < numTiles; ++tileIndex )
+	std::vector<AABB3> chunkBounds( numChunks );
+	for( int chunkIndex = 0; chunkIndex < m_chunks.size(); ++chunkIndex )
 	{
-		if( m_tiles[ tileIndex ] != nullptr )
-			AppendVertsForTile( tileIndex );
- 	}
+		int chunkY = chunkIndex / m_chunkDimensions.x;
+		int chunkX = chunkIndex - ( chunkY * m_chunkDimensions.x );
+		int tileStartX = chunkX * TILE_MAP_CHUNK_SIZE;
+		int tileStartY = chunkY * TILE_MAP_CHUNK_SIZE;
+		int tileEndX = Min( tileStartX + TILE_MAP_CHUNK_SIZE, m_dimensions.x );
+		int tileEndY = Min( tileStartY + TILE_MAP_CHUNK_SIZE, m_dimensions.y );
+
+		// Tiles are one unit tall, floor at z = 0
+		tile_map_chunk_t& chunk = m_chunks[ chunkIndex ];
+		chunk.mesh = new GPUMesh( g_theRenderer );
+		chunk.bounds = AABB3( static_cast<float>( tileStartX ), static_cast<float>( tileStartY ), 0.f, static_cast<float>( tileEndX ), static_cast<float>( tileEndY ), 1.f );
+		chunkBounds[ chunkIndex ] = chunk.bounds;
+	}
+	m_chunkTree.Build( chunkBounds.data(), static_cast<uint>( numChunks ) );
+
+	// A solid tile with all 4 walls exposed is 24 verts, twice an open tile's floor and ceiling; a chunk
+	// can't actually be all of those (a checkerboard averages 18), but 24 per tile never has to grow
+	m_mapVerts.reserve( TILE_MAP_CHUNK_SIZE * TILE_MAP_CHUNK_SIZE * 24 );
+}
 
-	if( m_mapVerts.size() > 0 )
+
+//---------------------------------------------------------------------------------------------------------
+void TileMap::RebuildDirtyChunks()
+{
+	for( int chunkIndex = 0; chunkIndex < m_chunks.size(); ++chunkIndex )
 	{
-		m_mapMesh->UpdateVerticies( static_cast<uint>( m_mapVerts.size() ), &m_mapVerts[0] );
+		if( m_chunks[ chunkIndex ].isDirty )
+		{
+			RebuildChunk( chunkIndex );
+		}
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void TileMap::RebuildChunk( int chunkIndex )
+{
+	tile_map_chunk_t& chunk = m_chunks[ chunkIndex ];
+
+	int chunkY = chunkIndex / m_chunkDimensions.x;
+	int chunkX = chunkIndex - ( chunkY * m_chunkDimensions.x );
+	int tileStartX = chunkX * TILE_MAP_CHUNK_SIZE;
+	int tileStartY = chunkY * TILE_MAP_CHUNK_SIZE;
+	int tileEndX = Min( tileStartX + TILE_MAP_CHUNK_SIZE, m_dimensions.x );
+	int tileEndY = Min( tileStartY + TILE_MAP_CHUNK_SIZE, m_dimensions.y );
+
+	m_mapVerts.clear();
+	for( int tileY = tileStartY; tileY < tileEndY; ++tileY )
+	{
+		for( int tileX = tileStartX; tileX < tileEndX; ++tileX )
+		{
+			AppendVertsForTile( GetTileIndexFromCoords( IntVec2( tileX, tileY ) ) );
+		}
+	}
+
+	chunk.vertexCount = static_cast<uint>( m_mapVerts.size() );
+	if( chunk.vertexCount > 0 )
+	{
+		chunk.mesh->UpdateVerticies( chunk.vertexCount, &m_mapVerts[0] );
+	}
+	chunk.isDirty = false;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// A tile's walls depend on its four neighbours, so an edge tile also dirties the chunk across that edge
+void TileMap::MarkChunksDirtyAroundTile( IntVec2 const& tileCoords )
+{
+	IntVec2 const tilesToMark[] = { tileCoords, tileCoords + IntVec2( 1, 0 ), tileCoords + IntVec2( -1, 0 ), tileCoords + IntVec2( 0, 1 ), tileCoords + IntVec2( 0, -1 ) };
+	for( IntVec2 const& markCoords : tilesToMark )
+	{
+		if( IsTileInBounds( markCoords ) )
+		{
+			int chunkIndex = ( ( markCoords.y / TILE_MAP_CHUNK_SIZE ) * m_chunkDimensions.x ) + ( markCoords.x / TILE_MAP_CHUNK_SIZE );
+			m_chunks[ chunkIndex ].isDirty = true;
+		}
 	}
 }
 
@@ -683,12 +855,17 @@ void TileMap::CreateMapVerts()
 //---------------------------------------------------------------------------------------------------------
 void TileMap::AppendVertsForTile( int tileIndex )
 {
-	Tile* tileToAppend = m_tiles[ tileIndex ];
-	if( IsTileSolid( tileToAppend ) )
+	Tile const& tileToAppend = m_tiles[ tileIndex ];
+	if( !tileToAppend.HasRegion() )
+	{
+		return;
+	}
+
+	if( tileToAppend.IsSolid() )
 	{
 		AppendVertsForSolidTile( tileIndex );
 	}
-	else if( !IsTileSolid( tileToAppend ) )
+	else
 	{
 		AppendVertsForOpenTile( tileIndex );
 	}
@@ -719,7 +896,7 @@ void TileMap::AppendVertsForOpenTile( int tileIndex )
 
 	AABB2		ceilingUVBox	= AABB2( 0.f, 0.f, 1.f, 1.f );
 	AABB2		floorUVBox		= AABB2( 0.f, 0.f, 1.f, 1.f );
-	MapRegion*	tileRegionType	= m_tiles[ tileIndex ]->GetRegionType();
+	MapRegion*	tileRegionType	= m_regionPalette[ m_tiles[ tileIndex ].GetRegionIndex() ];
 
 	if( tileRegionType != nullptr )
 	{
@@ -778,7 +955,7 @@ void TileMap::AppendVertsForSolidTile( int tileIndex )
 	Vec3 frontNormal	= CrossProduct3D( frontTangent, frontBitangent );
 
 	AABB2		sideUVBox		= AABB2( 0.f, 0.f, 1.f, 1.f );
-	MapRegion*	tileRegionType	= m_tiles[tileIndex]->GetRegionType();
+	MapRegion*	tileRegionType	= m_regionPalette[ m_tiles[ tileIndex ].GetRegionIndex() ];
 	if( tileRegionType != nullptr )
 	{
 		MapMaterial* sideMaterial = tileRegionType->GetSideMaterial();
@@ -787,13 +964,15 @@ void TileMap::AppendVertsForSolidTile( int tileIndex )
 	Vec2 sideTopLeftUV		= Vec2( sideUVBox.mins.x, sideUVBox.maxes.y);
 	Vec2 sideBottomRightUV	= Vec2( sideUVBox.maxes.x, sideUVBox.mins.y);
 
-	Tile* northTile = GetTileInDirectionFromTileIndex( tileIndex, 0, 1 ); 
-	Tile* eastTile = GetTileInDirectionFromTileIndex( tileIndex, 1, 0 );
-	Tile* southTile = GetTileInDirectionFromTileIndex( tileIndex, 0, -1 );
-	Tile* westTile = GetTileInDirectionFromTileIndex( tileIndex, -1, 0 );
+	// Faces against another solid tile (or the map edge) can never be seen
+	IntVec2 tileCoords = GetTileXYCoordsForTileIndex( tileIndex );
+	bool isNorthSolid	= IsTileSolid( tileCoords + IntVec2( 0, 1 ) );
+	bool isEastSolid	= IsTileSolid( tileCoords + IntVec2( 1, 0 ) );
+	bool isSouthSolid	= IsTileSolid( tileCoords + IntVec2( 0, -1 ) );
+	bool isWestSolid	= IsTileSolid( tileCoords + IntVec2( -1, 0 ) );
 
 	//Front - South Face
-	if( !IsTileSolid( southTile ) )
+	if( !isSouthSolid )
 	{
 		m_mapVerts.push_back(	Vertex_PCUTBN( frontBottomLeft,		color,	frontTangent,	frontBitangent,		frontNormal,		sideUVBox.mins ) );
 		m_mapVerts.push_back(	Vertex_PCUTBN( frontBottomRight,	color,	frontTangent,	frontBitangent,		frontNormal,		sideBottomRightUV ) );
@@ -805,7 +984,7 @@ void TileMap::AppendVertsForSolidTile( int tileIndex )
 	}
 
 	//Right - East Face
-	if( !IsTileSolid( eastTile ) )
+	if( !isEastSolid )
 	{
 		m_mapVerts.push_back(	Vertex_PCUTBN( frontBottomRight,	color,	-frontNormal,	frontBitangent,		frontTangent,		sideUVBox.mins ) );
 		m_mapVerts.push_back(	Vertex_PCUTBN( backBottomRight,		color,	-frontNormal,	frontBitangent,		frontTangent,		sideBottomRightUV ) );
@@ -817,7 +996,7 @@ void TileMap::AppendVertsForSolidTile( int tileIndex )
 	}
 
 	//Back - North Face
-	if( !IsTileSolid( northTile ) )
+	if( !isNorthSolid )
 	{
 		m_mapVerts.push_back(	Vertex_PCUTBN( backBottomRight,		color,	-frontTangent,	frontBitangent,		-frontNormal,		sideUVBox.mins ) );
 		m_mapVerts.push_back(	Vertex_PCUTBN( backBottomLeft,		color,	-frontTangent,	frontBitangent,		-frontNormal,		sideBottomRightUV ) );
@@ -829,7 +1008,7 @@ void TileMap::AppendVertsForSolidTile( int tileIndex )
 	}
 
 	//Left - West Face
-	if( !IsTileSolid( westTile ) )
+	if( !isWestSolid )
 	{
 		m_mapVerts.push_back(	Vertex_PCUTBN( backBottomLeft,		color,	frontNormal,	frontBitangent,		-frontTangent,		sideUVBox.mins ) );
 		m_mapVerts.push_back(	Vertex_PCUTBN( frontBottomLeft,		color,	frontNormal,	frontBitangent,		-frontTangent,		sideBottomRightUV ) );
@@ -864,6 +1043,7 @@ void TileMap::CreateFromXML( XmlElement const& xmlElement )
 	}
 
 	size_t mapSize = static_cast<size_t>( m_dimensions.x * m_dimensions.y );
+	m_tiles.clear();
 	m_tiles.resize( mapSize );
 
 	XmlElement const* nextChildElement = xmlElement.FirstChildElement();
@@ -934,14 +1114,3 @@ void TileMap::CreateFromXML( XmlElement const& xmlElement )
 		g_theConsole->ErrorString( "A TileMap must have an 'Entities' element" );
 	}
 }
-
-
-//---------------------------------------------------------------------------------------------------------
-bool TileMap::IsTileSolid( Tile* tile ) const
-{
-	if( tile == nullptr || tile->GetRegionType() == nullptr )
-	{
-		return true;
-	}
-	return tile->IsSolid();
-}
\ No newline at end of file
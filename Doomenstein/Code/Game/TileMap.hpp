@@ -2,11 +2,30 @@
 #include "Game/Map.hpp"
 #include "Game/EntityDef.hpp"
 #include "Engine/Math/IntVec2.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/Sphere3.hpp"
+#include "Engine/Math/StaticBoundsTree.hpp"
 #include "Engine/Core/Vertex_PCUTBN.hpp"
+#include "Engine/Core/Vertex_PCU.hpp"
 #include "Engine/Core/XmlUtils.hpp"
+#include "Game/Tile.hpp"
 
-class Tile;
 class Camera;
+class GPUMesh;
+class MapRegion;
+
+
+//---------------------------------------------------------------------------------------------------------
+constexpr int TILE_MAP_CHUNK_SIZE = 16;
+
+struct tile_map_chunk_t
+{
+	GPUMesh*	mesh		= nullptr;
+	AABB3		bounds;
+	uint		vertexCount	= 0;
+	bool		isDirty		= true;
+};
+
 
 class TileMap : public Map
 {
@@ -29,18 +48,22 @@ public:
 	void Render() const override;
 	void RenderMap() const;
 	void RenderEntities() const;
+	void FlushEntitySprites( Texture const* spriteTexture ) const;
 
-	bool	IsTileSolid( Tile* tile ) const;
-	IntVec2 GetTileXYCoordsForTileIndex( int tileIndex ) const;
-	Vec3	GetTilePositionForTileIndex( int tileIndex ) const;
-	int		GetTileIndexFromCoords( IntVec2 tileCoords ) const;
-	Tile*	GetTileByCoords( IntVec2 tileCoords ) const;
-	Tile*	GetTileInDirectionFromTileIndex( int tileIndex, int relativeXDistance, int relativeYDistance ) const;
-	AABB2	GetTileXYBounds( Tile* tile ) const;
+	bool		IsTileInBounds( IntVec2 const& tileCoords ) const;
+	bool		IsTileSolid( IntVec2 const& tileCoords ) const;
+	IntVec2		GetTileXYCoordsForTileIndex( int tileIndex ) const;
+	Vec3		GetTilePositionForTileIndex( int tileIndex ) const;
+	int			GetTileIndexFromCoords( IntVec2 tileCoords ) const;
+	MapRegion*	GetTileRegion( IntVec2 const& tileCoords ) const;
+	AABB2		GetTileXYBounds( IntVec2 const& tileCoords ) const;
+	void		SetTileRegion( IntVec2 const& tileCoords, MapRegion* regionType );
 
 	void	CreatePlayerStart( XmlElement const& xmlElement );
 
-	void CreateMapVerts();
+	void RebuildDirtyChunks();
+	void RebuildChunk( int chunkIndex );
+	void MarkChunksDirtyAroundTile( IntVec2 const& tileCoords );
 	void AppendVertsForTile( int tileIndex );
 	void AppendVertsForOpenTile( int tileIndex );
 	void AppendVertsForSolidTile( int tileIndex );
@@ -53,6 +76,8 @@ private:
 	void AddTileByLegendGlyph( char glyph, int xPosition, int yPosition );
 	
 	void CreateTilesFromXML( XmlElement const& xmlElement );
+	void CreateChunks();
+	uint16_t GetOrAddRegionIndex( MapRegion* regionType );
 	void CreateEntitiesFromXML( XmlElement const& xmlElement );
 
 	void HandleEntitiesVWallCollisions();
@@ -62,8 +87,17 @@ private:
 private:
 	IntVec2	m_dimensions = IntVec2( -1, -1 );
 	
-	std::vector<Tile*>			m_tiles;
-	std::vector<Vertex_PCUTBN>	m_mapVerts;
+	std::vector<Tile>				m_tiles;
+	std::vector<MapRegion*>			m_regionPalette;
+	std::vector<tile_map_chunk_t>	m_chunks;
+	IntVec2							m_chunkDimensions	= IntVec2( 0, 0 );
+	std::vector<Vertex_PCUTBN>		m_mapVerts;			// scratch for whichever chunk is rebuilding
+	StaticBoundsTree				m_chunkTree;		// chunk bounds never change, only what's inside them
+
+	mutable std::vector<Sphere3>	m_entityBounds;		// render scratch, refilled every frame
+	mutable std::vector<uint>		m_visibleIndices;
+	mutable std::vector<Vertex_PCU>	m_spriteVerts;
 
 	std::map<char, std::string> m_legend;
+	AssetHandle					m_terrainTexture;
 };
\ No newline at end of file
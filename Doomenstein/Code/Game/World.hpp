@@ -1,5 +1,6 @@
 #pragma once
 #include "Game/Map.hpp"
+#include "Game/NetworkData.hpp"
 #include "Engine/Core/StringUtils.hpp"
 #include <vector>
 #include <map>
@@ -9,18 +10,6 @@ class Map;
 class Entity;
 struct Vec3;
 
-struct WorldData
-{
-	char m_currentMapByName[50] = "";
-	MapData m_currentMapData;
-};
-
-struct ConnectionData
-{
-	char m_currentMapByName[50] = "";
-	SpawnData m_entityData;
-};
-
 class World
 {
 public:
@@ -0,0 +1,34 @@
+#pragma once
+#include <stddef.h>
+
+
+//-----------------------------------------------------------------------------------------------
+typedef size_t BackendSoundHandle;
+typedef size_t BackendVoiceHandle;
+constexpr size_t INVALID_BACKEND_HANDLE = (size_t)(-1);
+
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+// What AudioSystem needs from whatever actually mixes sound. AudioSystem decides which of its
+//	virtual voices get a real one; the backend just starts, adjusts and stops the real voices it
+//	is told to, so the decisions can run (and be checked) against NullAudioBackend with no device.
+//
+class AudioBackend
+{
+public:
+	virtual ~AudioBackend() {}
+
+	virtual void				Update() = 0;
+	virtual int					GetMaxVoiceCount() const = 0;
+
+	virtual BackendSoundHandle	CreateSound( char const* soundFilePath ) = 0;
+	virtual BackendSoundHandle	CreateSoundFromMemory( void const* fileData, size_t fileSizeBytes ) = 0;
+
+	virtual BackendVoiceHandle	StartVoice( BackendSoundHandle sound, bool isLooped, float volume, float balance, float speed, bool isPaused ) = 0;
+	virtual void				StopVoice( BackendVoiceHandle voice ) = 0;
+	virtual bool				IsVoicePlaying( BackendVoiceHandle voice ) const = 0;	// false once a one-shot has finished
+	virtual void				SetVoiceVolume( BackendVoiceHandle voice, float volume ) = 0;
+	virtual void				SetVoiceBalance( BackendVoiceHandle voice, float balance ) = 0;
+	virtual void				SetVoiceSpeed( BackendVoiceHandle voice, float speed ) = 0;
+	virtual void				SetVoicePaused( BackendVoiceHandle voice, bool isPaused ) = 0;
+};
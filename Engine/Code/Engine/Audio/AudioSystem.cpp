@@ -1,11 +1,20 @@
 #include "Engine/Audio/AudioSystem.hpp"
+#include "Engine/Audio/NullAudioBackend.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/StringUtils.hpp"
+#include "Engine/Core/FileUtils.hpp"
+#include "Engine/Core/JobSystem.hpp"
+#include "Engine/Core/AsyncLoadJob.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Platform/Platform.hpp"
+#include <algorithm>
 
 //-----------------------------------------------------------------------------------------------
 // To disable audio entirely (and remove requirement for fmod.dll / fmod64.dll) for any game,
 //	#define ENGINE_DISABLE_AUDIO in your game's Code/Game/EngineBuildPreferences.hpp file.
+//	AudioSystem then runs on a NullAudioBackend: everything "plays", nothing is heard. Headless
+//	builds have no FMOD, so they always use the NullAudioBackend.
 //
 // Note that this #include is an exception to the rule "engine code doesn't know about game code".
 //	Purpose: Each game can now direct the engine via #defines to build differently for that game.
@@ -13,48 +22,117 @@
 //
 // SD1 NOTE: THIS MEANS *EVERY* GAME MUST HAVE AN EngineBuildPreferences.hpp FILE IN ITS CODE/GAME FOLDER!!
 #include "Game/EngineBuildPreferences.hpp"
-#if !defined( ENGINE_DISABLE_AUDIO )
+#if !defined( ENGINE_DISABLE_AUDIO ) && !defined( ENGINE_HEADLESS )
+#include "Engine/Audio/FmodAudioBackend.hpp"
+#endif
 
 
 //-----------------------------------------------------------------------------------------------
-// Link in the appropriate FMOD static library (32-bit or 64-bit)
-//
-#if defined( _WIN64 )
-#pragma comment( lib, "ThirdParty/fmod/fmod64_vc.lib" )
+// A 3D sound quieter than this (after falloff) isn't worth a voice
+constexpr float AUDIBILITY_CULL_THRESHOLD = 0.001f;
+
+
+//-----------------------------------------------------------------------------------------------
+static AudioBackend* CreateDefaultAudioBackend()
+{
+#if !defined( ENGINE_DISABLE_AUDIO ) && !defined( ENGINE_HEADLESS )
+	return new FmodAudioBackend( 512 );
 #else
-#pragma comment( lib, "ThirdParty/fmod/fmod_vc.lib" )
+	return new NullAudioBackend();
 #endif
+}
 
 
 //-----------------------------------------------------------------------------------------------
-// Initialization code based on example from "FMOD Studio Programmers API for Windows"
+// Reads the sound file on a worker; the backend only sees it once it's in memory on the main thread
 //
+class SoundLoadJob : public AsyncLoadJob
+{
+public:
+	SoundLoadJob( AudioSystem* audioSystem, SoundID soundID, std::string const& soundFilePath )
+		: AsyncLoadJob( JOB_CATEGORY_AUDIO_ASSET_LOADING, soundFilePath )
+		, m_audioSystem( audioSystem )
+		, m_soundID( soundID )
+	{
+	}
+
+	~SoundLoadJob()
+	{
+		delete[] m_fileData;
+		m_fileData = nullptr;
+	}
+
+protected:
+	virtual void ExecuteLoad() override
+	{
+		m_fileData = static_cast<unsigned char*>( FileReadBinaryToNewBuffer( m_filepath, &m_fileSizeBytes ) );
+	}
+
+	virtual void FinalizeLoad() override
+	{
+		m_audioSystem->FinalizeAsyncSoundLoad( m_soundID, m_fileData, m_fileSizeBytes );
+	}
+
+private:
+	AudioSystem*	m_audioSystem		= nullptr;
+	SoundID			m_soundID			= MISSING_SOUND_ID;
+	unsigned char*	m_fileData			= nullptr;
+	size_t			m_fileSizeBytes		= 0;
+};
+
+
+//-----------------------------------------------------------------------------------------------
 AudioSystem::AudioSystem()
-	: m_fmodSystem( nullptr )
+	: AudioSystem( CreateDefaultAudioBackend() )
 {
-	FMOD_RESULT result;
-	result = FMOD::System_Create( &m_fmodSystem );
-	ValidateResult( result );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+AudioSystem::AudioSystem( AudioBackend* backend )
+	: m_backend( backend )
+	, m_voices( MAX_VIRTUAL_VOICES )
+{
+	GUARANTEE_OR_DIE( m_backend != nullptr, "AudioSystem needs a backend" );
+
+	m_categoryVoiceLimits[ SOUND_CATEGORY_SFX ]		= 32;
+	m_categoryVoiceLimits[ SOUND_CATEGORY_MUSIC ]	= 4;
+	m_categoryVoiceLimits[ SOUND_CATEGORY_UI ]		= 8;
+	m_categoryVoiceLimits[ SOUND_CATEGORY_AMBIENT ]	= 8;
+	for( int categoryIndex = 0; categoryIndex < NUM_SOUND_CATEGORIES; ++categoryIndex )
+	{
+		m_categoryRealVoiceCounts[ categoryIndex ] = 0;
+	}
 
-	result = m_fmodSystem->init( 512, FMOD_INIT_NORMAL, nullptr );
-	ValidateResult( result );
+	SetMaxRealVoiceCount( m_maxRealVoiceCount );
 }
 
 
 //-----------------------------------------------------------------------------------------------
 AudioSystem::~AudioSystem()
 {
-	FMOD_RESULT result = m_fmodSystem->release();
-	ValidateResult( result );
+	for( uint32_t voiceIndex = 0; voiceIndex < m_voices.GetCount(); ++voiceIndex )
+	{
+		StopRealVoice( m_voices[ voiceIndex ] );
+	}
+	m_voices.Clear();
 
-	m_fmodSystem = nullptr; // #Fixme: do we delete/free the object also, or just do this?
+	delete m_backend;
+	m_backend = nullptr;
 }
 
 
 //-----------------------------------------------------------------------------------------------
 void AudioSystem::BeginFrame()
 {
-	m_fmodSystem->update();
+	if( g_theJobSystem != nullptr )
+	{
+		g_theJobSystem->ClaimAndDeleteCompletedJobs( JOB_CATEGORY_AUDIO_ASSET_LOADING );
+	}
+
+	++m_frameIndex;
+	UpdateVoices();
+	m_backend->Update();
 }
 
 
@@ -74,9 +152,8 @@ SoundID AudioSystem::CreateOrGetSound( const std::string& soundFilePath )
 	}
 	else
 	{
-		FMOD::Sound* newSound = nullptr;
-		m_fmodSystem->createSound( soundFilePath.c_str(), FMOD_DEFAULT, nullptr, &newSound );
-		if( newSound )
+		BackendSoundHandle newSound = m_backend->CreateSound( soundFilePath.c_str() );
+		if( newSound != INVALID_BACKEND_HANDLE )
 		{
 			SoundID newSoundID = m_registeredSounds.size();
 			m_registeredSoundIDs[ soundFilePath ] = newSoundID;
@@ -89,33 +166,146 @@ SoundID AudioSystem::CreateOrGetSound( const std::string& soundFilePath )
 }
 
 
+//-----------------------------------------------------------------------------------------------
+// The ID is reserved up front with no sound behind it, so PlaySound quietly does nothing until
+//	the load finishes.
+//
+SoundID AudioSystem::CreateOrGetSoundAsync( const std::string& soundFilePath )
+{
+	std::map< std::string, SoundID >::iterator found = m_registeredSoundIDs.find( soundFilePath );
+	if( found != m_registeredSoundIDs.end() )
+	{
+		return found->second;
+	}
+
+	SoundID newSoundID = m_registeredSounds.size();
+	m_registeredSoundIDs[ soundFilePath ] = newSoundID;
+	m_registeredSounds.push_back( INVALID_BACKEND_HANDLE );
+
+	PostAsyncLoadJob( new SoundLoadJob( this, newSoundID, soundFilePath ) );
+	return newSoundID;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+void AudioSystem::FinalizeAsyncSoundLoad( SoundID soundID, void const* fileData, size_t fileSizeBytes )
+{
+	if( soundID >= m_registeredSounds.size() )
+		return;
+
+	if( fileData == nullptr || fileSizeBytes == 0 )
+	{
+		ERROR_RECOVERABLE( Stringf( "WARNING: failed to read sound file for SoundID %u!", (unsigned int) soundID ) );
+		return;
+	}
+
+	m_registeredSounds[ soundID ] = m_backend->CreateSoundFromMemory( fileData, fileSizeBytes );
+}
+
+
 //-----------------------------------------------------------------------------------------------
 SoundPlaybackID AudioSystem::PlaySound( SoundID soundID, bool isLooped, float volume, float balance, float speed, bool isPaused )
+{
+	sound_play_options_t options;
+	options.isLooped	= isLooped;
+	options.volume		= volume;
+	options.balance		= balance;
+	options.speed		= speed;
+	options.isPaused	= isPaused;
+	return PlaySound( soundID, options );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+SoundPlaybackID AudioSystem::PlaySound( SoundID soundID, sound_play_options_t const& options )
 {
 	size_t numSounds = m_registeredSounds.size();
-	if( soundID < 0 || soundID >= numSounds )
+	if( soundID >= numSounds || m_registeredSounds[ soundID ] == INVALID_BACKEND_HANDLE )
 		return MISSING_SOUND_ID;
 
-	FMOD::Sound* sound = m_registeredSounds[ soundID ];
-	if( !sound )
+	// Throttle: past the per-frame cap, the same sound merges into the first one started this frame
+	if( m_maxInstancesPerFrame > 0 )
+	{
+		int sameFrameInstanceCount = 0;
+		uint32_t firstInstanceIndex = 0;
+		for( uint32_t voiceIndex = 0; voiceIndex < m_voices.GetCount(); ++voiceIndex )
+		{
+			virtual_voice_t const& voice = m_voices[ voiceIndex ];
+			if( voice.soundID == soundID && voice.startFrame == m_frameIndex )
+			{
+				if( sameFrameInstanceCount == 0 )
+				{
+					firstInstanceIndex = voiceIndex;
+				}
+				++sameFrameInstanceCount;
+			}
+		}
+
+		if( sameFrameInstanceCount >= m_maxInstancesPerFrame )
+		{
+			virtual_voice_t& firstInstance = m_voices[ firstInstanceIndex ];
+			if( options.volume > firstInstance.options.volume )
+			{
+				firstInstance.options.volume = options.volume;
+				UpdateVoiceAudibility( firstInstance );
+				if( firstInstance.backendVoice != INVALID_BACKEND_HANDLE )
+				{
+					m_backend->SetVoiceVolume( firstInstance.backendVoice, firstInstance.audibility );
+				}
+			}
+
+			++m_voiceStats.throttled;
+			return GetPlaybackIDFromHandle( m_voices.GetHandleAtIndex( firstInstanceIndex ) );
+		}
+	}
+
+	PoolHandle voiceHandle = m_voices.Create();
+	if( voiceHandle.IsNull() )
+	{
+		++m_voiceStats.culled;
 		return MISSING_SOUND_ID;
+	}
 
-	FMOD::Channel* channelAssignedToSound = nullptr;
-	m_fmodSystem->playSound( sound, nullptr, isPaused, &channelAssignedToSound );
-	if( channelAssignedToSound )
+	virtual_voice_t* newVoice = m_voices.Get( voiceHandle );
+	newVoice->soundID = soundID;
+	newVoice->options = options;
+	newVoice->startFrame = m_frameIndex;
+	UpdateVoiceAudibility( *newVoice );
+
+	// Loops that can't be heard or can't get a voice wait as virtual voices; one-shots are dropped
+	bool canPlay = IsVoiceAudible( *newVoice );
+	if( canPlay && !CanStartRealVoice( options.category ) )
 	{
-		int loopCount = isLooped ? -1 : 0;
-		unsigned int playbackMode = isLooped ? FMOD_LOOP_NORMAL : FMOD_LOOP_OFF;
-		float frequency;
-		channelAssignedToSound->setMode(playbackMode);
-		channelAssignedToSound->getFrequency( &frequency );
-		channelAssignedToSound->setFrequency( frequency * speed );
-		channelAssignedToSound->setVolume( volume );
-		channelAssignedToSound->setPan( balance );
-		channelAssignedToSound->setLoopCount( loopCount );
+		int stealIndex = FindVoiceToSteal( *newVoice );
+		if( stealIndex >= 0 )
+		{
+			virtual_voice_t& stolenVoice = m_voices[ stealIndex ];
+			StopRealVoice( stolenVoice );
+			++m_voiceStats.stolen;
+			if( !stolenVoice.options.isLooped )
+			{
+				m_voices.DestroyAtIndex( static_cast<uint32_t>( stealIndex ) );
+				newVoice = m_voices.Get( voiceHandle );
+			}
+		}
+		else
+		{
+			canPlay = false;
+		}
+	}
+
+	if( canPlay )
+	{
+		canPlay = StartRealVoice( *newVoice );
 	}
 
-	return (SoundPlaybackID) channelAssignedToSound;
+	if( !canPlay && !options.isLooped )
+	{
+		m_voices.Destroy( voiceHandle );
+		++m_voiceStats.culled;
+	}
+
+	return GetPlaybackIDFromHandle( voiceHandle );
 }
 
 
@@ -128,8 +318,12 @@ void AudioSystem::StopSound( SoundPlaybackID soundPlaybackID )
 		return;
 	}
 
-	FMOD::Channel* channelAssignedToSound = (FMOD::Channel*) soundPlaybackID;
-	channelAssignedToSound->stop();
+	virtual_voice_t* voice = GetVoice( soundPlaybackID );
+	if( voice == nullptr )
+		return;
+
+	StopRealVoice( *voice );
+	m_voices.Destroy( GetHandleFromPlaybackID( soundPlaybackID ) );
 }
 
 
@@ -144,8 +338,16 @@ void AudioSystem::SetSoundPlaybackVolume( SoundPlaybackID soundPlaybackID, float
 		return;
 	}
 
-	FMOD::Channel* channelAssignedToSound = (FMOD::Channel*) soundPlaybackID;
-	channelAssignedToSound->setVolume( volume );
+	virtual_voice_t* voice = GetVoice( soundPlaybackID );
+	if( voice == nullptr )
+		return;
+
+	voice->options.volume = volume;
+	UpdateVoiceAudibility( *voice );
+	if( voice->backendVoice != INVALID_BACKEND_HANDLE )
+	{
+		m_backend->SetVoiceVolume( voice->backendVoice, voice->audibility );
+	}
 }
 
 
@@ -160,8 +362,15 @@ void AudioSystem::SetSoundPlaybackBalance( SoundPlaybackID soundPlaybackID, floa
 		return;
 	}
 
-	FMOD::Channel* channelAssignedToSound = (FMOD::Channel*) soundPlaybackID;
-	channelAssignedToSound->setPan( balance );
+	virtual_voice_t* voice = GetVoice( soundPlaybackID );
+	if( voice == nullptr )
+		return;
+
+	voice->options.balance = balance;
+	if( voice->backendVoice != INVALID_BACKEND_HANDLE )
+	{
+		m_backend->SetVoiceBalance( voice->backendVoice, GetVoiceBalance( *voice ) );
+	}
 }
 
 
@@ -178,16 +387,40 @@ void AudioSystem::SetSoundPlaybackSpeed( SoundPlaybackID soundPlaybackID, float
 		return;
 	}
 
-	FMOD::Channel* channelAssignedToSound = (FMOD::Channel*) soundPlaybackID;
-	float frequency;
-	FMOD::Sound* currentSound = nullptr;
-	channelAssignedToSound->getCurrentSound( &currentSound );
-	if( !currentSound )
+	virtual_voice_t* voice = GetVoice( soundPlaybackID );
+	if( voice == nullptr )
+		return;
+
+	voice->options.speed = speed;
+	if( voice->backendVoice != INVALID_BACKEND_HANDLE )
+	{
+		m_backend->SetVoiceSpeed( voice->backendVoice, speed );
+	}
+}
+
+
+//-----------------------------------------------------------------------------------------------
+// Falloff and pan follow right away; whether the sound keeps its voice is decided next BeginFrame
+//
+void AudioSystem::SetSoundPlaybackPosition( SoundPlaybackID soundPlaybackID, Vec3 const& position )
+{
+	if( soundPlaybackID == MISSING_SOUND_ID )
+	{
+		ERROR_RECOVERABLE( "WARNING: attempt to set position on missing sound playback ID!" );
+		return;
+	}
+
+	virtual_voice_t* voice = GetVoice( soundPlaybackID );
+	if( voice == nullptr )
 		return;
 
-	int ignored = 0;
-	currentSound->getDefaults( &frequency, &ignored );
-	channelAssignedToSound->setFrequency( frequency * speed );
+	voice->options.position = position;
+	UpdateVoiceAudibility( *voice );
+	if( voice->backendVoice != INVALID_BACKEND_HANDLE )
+	{
+		m_backend->SetVoiceVolume( voice->backendVoice, voice->audibility );
+		m_backend->SetVoiceBalance( voice->backendVoice, GetVoiceBalance( *voice ) );
+	}
 }
 
 
@@ -200,19 +433,290 @@ void AudioSystem::SoundIsPaused( SoundPlaybackID soundPlaybackID, bool isPaused
 		return;
 	}
 
-	FMOD::Channel* channelAssignedToSound = (FMOD::Channel*) soundPlaybackID;
-	channelAssignedToSound->setPaused( isPaused );
+	virtual_voice_t* voice = GetVoice( soundPlaybackID );
+	if( voice == nullptr )
+		return;
+
+	voice->options.isPaused = isPaused;
+	if( voice->backendVoice != INVALID_BACKEND_HANDLE )
+	{
+		m_backend->SetVoicePaused( voice->backendVoice, isPaused );
+	}
+}
+
+
+//-----------------------------------------------------------------------------------------------
+void AudioSystem::SetListener( Vec3 const& position, Vec3 const& leftDirection )
+{
+	m_listenerPosition = position;
+	m_listenerLeft = leftDirection;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+// Shrinking the budget takes effect at the next BeginFrame
+//
+void AudioSystem::SetMaxRealVoiceCount( int maxRealVoiceCount )
+{
+	m_maxRealVoiceCount = GetClamp( maxRealVoiceCount, 0, m_backend->GetMaxVoiceCount() );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+void AudioSystem::SetCategoryVoiceLimit( SoundCategory category, int maxRealVoiceCount )
+{
+	m_categoryVoiceLimits[ category ] = maxRealVoiceCount;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+bool AudioSystem::IsSoundPlaybackReal( SoundPlaybackID soundPlaybackID ) const
+{
+	virtual_voice_t const* voice = m_voices.Get( GetHandleFromPlaybackID( soundPlaybackID ) );
+	return voice != nullptr && voice->backendVoice != INVALID_BACKEND_HANDLE;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+STATIC SoundPlaybackID AudioSystem::GetPlaybackIDFromHandle( PoolHandle handle )
+{
+	if( handle.IsNull() )
+		return MISSING_SOUND_ID;
+
+	return ( static_cast<SoundPlaybackID>( handle.generation ) << 32 ) | static_cast<SoundPlaybackID>( handle.slotIndex );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+STATIC PoolHandle AudioSystem::GetHandleFromPlaybackID( SoundPlaybackID soundPlaybackID )
+{
+	PoolHandle handle;
+	if( soundPlaybackID != MISSING_SOUND_ID )
+	{
+		handle.slotIndex = static_cast<uint32_t>( soundPlaybackID & 0xFFFFFFFF );
+		handle.generation = static_cast<uint32_t>( static_cast<uint64_t>( soundPlaybackID ) >> 32 );
+	}
+	return handle;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+AudioSystem::virtual_voice_t* AudioSystem::GetVoice( SoundPlaybackID soundPlaybackID )
+{
+	return m_voices.Get( GetHandleFromPlaybackID( soundPlaybackID ) );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+// Linear falloff from minDistance to maxDistance, so "out of range" is exactly "silent"
+//
+void AudioSystem::UpdateVoiceAudibility( virtual_voice_t& voice ) const
+{
+	sound_play_options_t const& options = voice.options;
+	if( !options.is3D )
+	{
+		voice.audibility = options.volume;
+		return;
+	}
+
+	float distance = GetDistance3D( m_listenerPosition, options.position );
+	float falloffRange = options.maxDistance - options.minDistance;
+	float falloff = 1.f;
+	if( distance >= options.maxDistance )
+	{
+		falloff = 0.f;
+	}
+	else if( distance > options.minDistance && falloffRange > 0.f )
+	{
+		falloff = 1.f - ( ( distance - options.minDistance ) / falloffRange );
+	}
+	voice.audibility = options.volume * falloff;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+float AudioSystem::GetVoiceBalance( virtual_voice_t const& voice ) const
+{
+	if( !voice.options.is3D )
+		return voice.options.balance;
+
+	Vec3 displacement = voice.options.position - m_listenerPosition;
+	float distance = displacement.GetLength();
+	if( distance < 0.0001f )
+		return 0.f;
+
+	// Balance runs left (-1) to right (+1)
+	return GetClamp( -DotProduct3D( displacement, m_listenerLeft ) / distance, -1.f, 1.f );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+float AudioSystem::GetVoiceImportance( virtual_voice_t const& voice ) const
+{
+	return static_cast<float>( voice.options.priority ) + voice.audibility;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+bool AudioSystem::IsVoiceAudible( virtual_voice_t const& voice ) const
+{
+	return !voice.options.is3D || voice.audibility > AUDIBILITY_CULL_THRESHOLD;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+bool AudioSystem::CanStartRealVoice( SoundCategory category ) const
+{
+	return m_realVoiceCount < m_maxRealVoiceCount && m_categoryRealVoiceCounts[ category ] < m_categoryVoiceLimits[ category ];
 }
 
 
 //-----------------------------------------------------------------------------------------------
-void AudioSystem::ValidateResult( FMOD_RESULT result )
+// The least important real voice forVoice outranks. When forVoice's category is full only that
+//	category can give up a voice, otherwise anything can.
+//
+int AudioSystem::FindVoiceToSteal( virtual_voice_t const& forVoice ) const
 {
-	if( result != FMOD_OK )
+	SoundCategory category = forVoice.options.category;
+	bool isCategoryFull = m_categoryRealVoiceCounts[ category ] >= m_categoryVoiceLimits[ category ];
+	float forVoiceImportance = GetVoiceImportance( forVoice );
+
+	int stealIndex = -1;
+	float stealImportance = forVoiceImportance;
+	for( uint32_t voiceIndex = 0; voiceIndex < m_voices.GetCount(); ++voiceIndex )
 	{
-		ERROR_RECOVERABLE( Stringf( "Engine/Audio SYSTEM ERROR: Got error result code %i - error codes listed in fmod_common.h\n", (int) result ) );
+		virtual_voice_t const& voice = m_voices[ voiceIndex ];
+		if( voice.backendVoice == INVALID_BACKEND_HANDLE || ( isCategoryFull && voice.options.category != category ) )
+			continue;
+
+		float importance = GetVoiceImportance( voice );
+		if( importance < stealImportance )
+		{
+			stealIndex = static_cast<int>( voiceIndex );
+			stealImportance = importance;
+		}
 	}
+	return stealIndex;
 }
 
 
-#endif // !defined( ENGINE_DISABLE_AUDIO )
+//-----------------------------------------------------------------------------------------------
+bool AudioSystem::StartRealVoice( virtual_voice_t& voice )
+{
+	sound_play_options_t const& options = voice.options;
+	BackendSoundHandle sound = m_registeredSounds[ voice.soundID ];
+	voice.backendVoice = m_backend->StartVoice( sound, options.isLooped, voice.audibility, GetVoiceBalance( voice ), options.speed, options.isPaused );
+	if( voice.backendVoice == INVALID_BACKEND_HANDLE )
+		return false;
+
+	++m_realVoiceCount;
+	++m_categoryRealVoiceCounts[ options.category ];
+	++m_voiceStats.started;
+	return true;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+void AudioSystem::StopRealVoice( virtual_voice_t& voice )
+{
+	if( voice.backendVoice == INVALID_BACKEND_HANDLE )
+		return;
+
+	m_backend->StopVoice( voice.backendVoice );
+	voice.backendVoice = INVALID_BACKEND_HANDLE;
+	--m_realVoiceCount;
+	--m_categoryRealVoiceCounts[ voice.options.category ];
+}
+
+
+//-----------------------------------------------------------------------------------------------
+// Once a frame: retire finished one-shots, then hand the real voices to the most important
+//	audible voices within the budget. Losers are stopped before winners start, so a swap never
+//	needs more than the budget.
+//
+void AudioSystem::UpdateVoices()
+{
+	// Walking backwards keeps DestroyAtIndex (which moves the last voice into the hole) safe
+	for( int voiceIndex = static_cast<int>( m_voices.GetCount() ) - 1; voiceIndex >= 0; --voiceIndex )
+	{
+		virtual_voice_t& voice = m_voices[ voiceIndex ];
+		if( voice.backendVoice != INVALID_BACKEND_HANDLE && !m_backend->IsVoicePlaying( voice.backendVoice ) )
+		{
+			// Already stopped by the backend, so just give the slot back
+			voice.backendVoice = INVALID_BACKEND_HANDLE;
+			--m_realVoiceCount;
+			--m_categoryRealVoiceCounts[ voice.options.category ];
+			if( !voice.options.isLooped )
+			{
+				m_voices.DestroyAtIndex( static_cast<uint32_t>( voiceIndex ) );
+				continue;
+			}
+		}
+		UpdateVoiceAudibility( voice );
+	}
+
+	uint32_t voiceCount = m_voices.GetCount();
+	m_voiceOrder.resize( voiceCount );
+	for( uint32_t voiceIndex = 0; voiceIndex < voiceCount; ++voiceIndex )
+	{
+		m_voiceOrder[ voiceIndex ] = voiceIndex;
+	}
+	std::sort( m_voiceOrder.begin(), m_voiceOrder.end(), [&]( uint32_t a, uint32_t b ) { return GetVoiceImportance( m_voices[ a ] ) > GetVoiceImportance( m_voices[ b ] ); } );
+
+	std::vector<bool>& isWinner = m_isVoiceWinner;
+	isWinner.assign( voiceCount, false );
+	int winnerCount = 0;
+	int categoryWinnerCounts[ NUM_SOUND_CATEGORIES ] = {};
+	for( uint32_t orderIndex = 0; orderIndex < voiceCount; ++orderIndex )
+	{
+		uint32_t voiceIndex = m_voiceOrder[ orderIndex ];
+		virtual_voice_t const& voice = m_voices[ voiceIndex ];
+		SoundCategory category = voice.options.category;
+		if( IsVoiceAudible( voice ) && winnerCount < m_maxRealVoiceCount && categoryWinnerCounts[ category ] < m_categoryVoiceLimits[ category ] )
+		{
+			isWinner[ voiceIndex ] = true;
+			++winnerCount;
+			++categoryWinnerCounts[ category ];
+		}
+	}
+
+	for( int voiceIndex = static_cast<int>( voiceCount ) - 1; voiceIndex >= 0; --voiceIndex )
+	{
+		virtual_voice_t& voice = m_voices[ voiceIndex ];
+		if( isWinner[ voiceIndex ] || voice.backendVoice == INVALID_BACKEND_HANDLE )
+			continue;
+
+		StopRealVoice( voice );
+		if( IsVoiceAudible( voice ) )
+		{
+			++m_voiceStats.stolen;
+		}
+		else
+		{
+			++m_voiceStats.culled;
+		}
+		if( !voice.options.isLooped )
+		{
+			// Only ever moves a voice from above voiceIndex, which has been handled already
+			isWinner[ voiceIndex ] = isWinner[ m_voices.GetCount() - 1 ];
+			m_voices.DestroyAtIndex( static_cast<uint32_t>( voiceIndex ) );
+		}
+	}
+
+	for( uint32_t voiceIndex = 0; voiceIndex < m_voices.GetCount(); ++voiceIndex )
+	{
+		virtual_voice_t& voice = m_voices[ voiceIndex ];
+		if( !isWinner[ voiceIndex ] )
+			continue;
+
+		if( voice.backendVoice == INVALID_BACKEND_HANDLE )
+		{
+			StartRealVoice( voice );
+		}
+		else if( voice.options.is3D )
+		{
+			m_backend->SetVoiceVolume( voice.backendVoice, voice.audibility );
+			m_backend->SetVoiceBalance( voice.backendVoice, GetVoiceBalance( voice ) );
+		}
+	}
+}
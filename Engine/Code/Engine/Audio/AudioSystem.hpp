@@ -2,7 +2,9 @@
 
 
 //-----------------------------------------------------------------------------------------------
-#include "ThirdParty/fmod/fmod.hpp"
+#include "Engine/Audio/AudioBackend.hpp"
+#include "Engine/Core/HandlePool.hpp"
+#include "Engine/Math/Vec3.hpp"
 #include <string>
 #include <vector>
 #include <map>
@@ -14,15 +16,67 @@ typedef size_t SoundPlaybackID;
 constexpr size_t MISSING_SOUND_ID = (size_t)(-1); // for bad SoundIDs and SoundPlaybackIDs
 
 
+//-----------------------------------------------------------------------------------------------
+enum SoundCategory
+{
+	SOUND_CATEGORY_SFX,
+	SOUND_CATEGORY_MUSIC,
+	SOUND_CATEGORY_UI,
+	SOUND_CATEGORY_AMBIENT,
+
+	NUM_SOUND_CATEGORIES
+};
+
+
+//-----------------------------------------------------------------------------------------------
+struct sound_play_options_t
+{
+	SoundCategory	category		= SOUND_CATEGORY_SFX;
+	int				priority		= 128;		// higher keeps its voice; audibility breaks ties
+	bool			isLooped		= false;
+	float			volume			= 1.f;
+	float			balance			= 0.f;		// ignored for 3D sounds, which pan from the listener
+	float			speed			= 1.f;
+	bool			isPaused		= false;
+
+	bool			is3D			= false;
+	Vec3			position;
+	float			minDistance		= 1.f;		// full volume inside this
+	float			maxDistance		= 40.f;		// silent, and culled, past this
+};
+
+
+//-----------------------------------------------------------------------------------------------
+struct audio_voice_stats_t
+{
+	int started		= 0;	// given a real voice
+	int stolen		= 0;	// lost a real voice to something more important
+	int throttled	= 0;	// merged into an identical sound started the same frame
+	int culled		= 0;	// one-shots never heard: inaudible, or out-ranked with nothing to steal
+};
+
+
 //-----------------------------------------------------------------------------------------------
 class AudioSystem;
 
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
+// Every PlaySound makes a virtual voice; only the most important audible ones get a real voice
+//	from the backend, within a global budget and a per-category limit. Importance is priority,
+//	then audibility (volume after distance falloff).
+//
+//	- A new sound that doesn't fit steals the least important real voice it outranks.
+//	- One-shots that lose their voice, or never get one, are dropped; a backend can't say how far
+//	  through they would be. Loops go virtual and come back (from the top) when they win again.
+//	- Identical sounds started in one frame past GetMaxInstancesPerFrame merge into the first.
+//
+//	SoundPlaybackIDs are pool handles, so using one after its sound ends is a quiet no-op.
+//
 class AudioSystem
 {
 public:
 	AudioSystem();
+	explicit AudioSystem( AudioBackend* backend );	// takes ownership
 	virtual ~AudioSystem();
 
 public:
@@ -30,18 +84,78 @@ public:
 	virtual void				EndFrame();
 
 	virtual SoundID				CreateOrGetSound( const std::string& soundFilePath );
+	virtual SoundID				CreateOrGetSoundAsync( const std::string& soundFilePath );	// plays nothing until the file has streamed in
+	virtual void				FinalizeAsyncSoundLoad( SoundID soundID, void const* fileData, size_t fileSizeBytes );
 	virtual SoundPlaybackID		PlaySound( SoundID soundID, bool isLooped=false, float volume=1.f, float balance=0.0f, float speed=1.0f, bool isPaused=false );
+	virtual SoundPlaybackID		PlaySound( SoundID soundID, sound_play_options_t const& options );
 	virtual void				StopSound( SoundPlaybackID soundPlaybackID );
 	virtual void				SetSoundPlaybackVolume( SoundPlaybackID soundPlaybackID, float volume );	// volume is in [0,1]
 	virtual void				SetSoundPlaybackBalance( SoundPlaybackID soundPlaybackID, float balance );	// balance is in [-1,1], where 0 is L/R centered
 	virtual void				SetSoundPlaybackSpeed( SoundPlaybackID soundPlaybackID, float speed );		// speed is frequency multiplier (1.0 == normal)
+	virtual void				SetSoundPlaybackPosition( SoundPlaybackID soundPlaybackID, Vec3 const& position );
 	virtual void				SoundIsPaused( SoundPlaybackID soundPlaybackID, bool isPaused );
 
-	virtual void				ValidateResult( FMOD_RESULT result );
+	// Listener for 3D sounds; leftDirection is the listener's unit left, for panning
+	void						SetListener( Vec3 const& position, Vec3 const& leftDirection );
+
+	// Voice budget
+	void						SetMaxRealVoiceCount( int maxRealVoiceCount );
+	void						SetCategoryVoiceLimit( SoundCategory category, int maxRealVoiceCount );
+	void						SetMaxInstancesPerFrame( int maxInstancesPerFrame )		{ m_maxInstancesPerFrame = maxInstancesPerFrame; }
+	int							GetMaxRealVoiceCount() const							{ return m_maxRealVoiceCount; }
+	int							GetMaxInstancesPerFrame() const							{ return m_maxInstancesPerFrame; }
+	int							GetRealVoiceCount() const								{ return m_realVoiceCount; }
+	int							GetCategoryRealVoiceCount( SoundCategory category ) const	{ return m_categoryRealVoiceCounts[ category ]; }
+	int							GetVirtualVoiceCount() const							{ return static_cast<int>( m_voices.GetCount() ); }
+	bool						IsSoundPlaybackReal( SoundPlaybackID soundPlaybackID ) const;
+	audio_voice_stats_t const&	GetVoiceStats() const									{ return m_voiceStats; }
+	AudioBackend*				GetBackend() const										{ return m_backend; }
+
+public:
+	static constexpr uint32_t	MAX_VIRTUAL_VOICES = 1024;
 
 protected:
-	FMOD::System*						m_fmodSystem;
+	struct virtual_voice_t
+	{
+		SoundID					soundID			= MISSING_SOUND_ID;
+		sound_play_options_t	options;
+		BackendVoiceHandle		backendVoice	= INVALID_BACKEND_HANDLE;
+		float					audibility		= 1.f;
+		uint32_t				startFrame		= 0;
+	};
+
+	static SoundPlaybackID		GetPlaybackIDFromHandle( PoolHandle handle );
+	static PoolHandle			GetHandleFromPlaybackID( SoundPlaybackID soundPlaybackID );
+
+	virtual_voice_t*			GetVoice( SoundPlaybackID soundPlaybackID );
+	void						UpdateVoiceAudibility( virtual_voice_t& voice ) const;
+	float						GetVoiceBalance( virtual_voice_t const& voice ) const;
+	float						GetVoiceImportance( virtual_voice_t const& voice ) const;
+	bool						IsVoiceAudible( virtual_voice_t const& voice ) const;
+	bool						CanStartRealVoice( SoundCategory category ) const;
+	int							FindVoiceToSteal( virtual_voice_t const& forVoice ) const;
+	bool						StartRealVoice( virtual_voice_t& voice );
+	void						StopRealVoice( virtual_voice_t& voice );
+	void						UpdateVoices();
+
+protected:
+	AudioBackend*						m_backend		= nullptr;
 	std::map< std::string, SoundID >	m_registeredSoundIDs;
-	std::vector< FMOD::Sound* >			m_registeredSounds;
+	std::vector< BackendSoundHandle >	m_registeredSounds;
+
+	HandlePool<virtual_voice_t>			m_voices;
+	int									m_maxRealVoiceCount		= 48;
+	int									m_categoryVoiceLimits[ NUM_SOUND_CATEGORIES ];
+	int									m_categoryRealVoiceCounts[ NUM_SOUND_CATEGORIES ];
+	int									m_realVoiceCount		= 0;
+	int									m_maxInstancesPerFrame	= 2;
+	uint32_t							m_frameIndex			= 0;
+	audio_voice_stats_t					m_voiceStats;
+
+	Vec3								m_listenerPosition;
+	Vec3								m_listenerLeft			= Vec3( 0.f, 1.f, 0.f );
+
+	std::vector<uint32_t>				m_voiceOrder;			// scratch for UpdateVoices
+	std::vector<bool>					m_isVoiceWinner;		// scratch for UpdateVoices
 };
 
@@ -0,0 +1,181 @@
+#include "Engine/Audio/FmodAudioBackend.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Platform/Platform.hpp"
+
+//-----------------------------------------------------------------------------------------------
+// See AudioSystem.cpp - each game's EngineBuildPreferences.hpp can turn FMOD off entirely, and
+//	headless builds never have it
+//
+#include "Game/EngineBuildPreferences.hpp"
+#if !defined( ENGINE_DISABLE_AUDIO ) && !defined( ENGINE_HEADLESS )
+
+
+//-----------------------------------------------------------------------------------------------
+// Link in the appropriate FMOD static library (32-bit or 64-bit)
+//
+#if defined( _WIN64 )
+#pragma comment( lib, "ThirdParty/fmod/fmod64_vc.lib" )
+#else
+#pragma comment( lib, "ThirdParty/fmod/fmod_vc.lib" )
+#endif
+
+
+//-----------------------------------------------------------------------------------------------
+// Initialization code based on example from "FMOD Studio Programmers API for Windows"
+//
+FmodAudioBackend::FmodAudioBackend( int maxVoiceCount )
+	: m_maxVoiceCount( maxVoiceCount )
+{
+	FMOD_RESULT result;
+	result = FMOD::System_Create( &m_fmodSystem );
+	ValidateResult( result );
+
+	result = m_fmodSystem->init( m_maxVoiceCount, FMOD_INIT_NORMAL, nullptr );
+	ValidateResult( result );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+FmodAudioBackend::~FmodAudioBackend()
+{
+	FMOD_RESULT result = m_fmodSystem->release();
+	ValidateResult( result );
+
+	m_fmodSystem = nullptr;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+void FmodAudioBackend::Update()
+{
+	m_fmodSystem->update();
+}
+
+
+//-----------------------------------------------------------------------------------------------
+BackendSoundHandle FmodAudioBackend::CreateSound( char const* soundFilePath )
+{
+	FMOD::Sound* newSound = nullptr;
+	m_fmodSystem->createSound( soundFilePath, FMOD_DEFAULT, nullptr, &newSound );
+	if( newSound == nullptr )
+		return INVALID_BACKEND_HANDLE;
+
+	return (BackendSoundHandle) newSound;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+BackendSoundHandle FmodAudioBackend::CreateSoundFromMemory( void const* fileData, size_t fileSizeBytes )
+{
+	FMOD_CREATESOUNDEXINFO soundInfo;
+	memset( &soundInfo, 0, sizeof( soundInfo ) );
+	soundInfo.cbsize = sizeof( soundInfo );
+	soundInfo.length = (unsigned int) fileSizeBytes;
+
+	// FMOD_CREATESAMPLE decodes the whole thing now, so the file buffer can be freed with the job
+	FMOD::Sound* newSound = nullptr;
+	m_fmodSystem->createSound( (const char*) fileData, FMOD_DEFAULT | FMOD_OPENMEMORY | FMOD_CREATESAMPLE, &soundInfo, &newSound );
+	if( newSound == nullptr )
+		return INVALID_BACKEND_HANDLE;
+
+	return (BackendSoundHandle) newSound;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+BackendVoiceHandle FmodAudioBackend::StartVoice( BackendSoundHandle sound, bool isLooped, float volume, float balance, float speed, bool isPaused )
+{
+	FMOD::Channel* channelAssignedToSound = nullptr;
+	m_fmodSystem->playSound( (FMOD::Sound*) sound, nullptr, isPaused, &channelAssignedToSound );
+	if( channelAssignedToSound == nullptr )
+		return INVALID_BACKEND_HANDLE;
+
+	int loopCount = isLooped ? -1 : 0;
+	unsigned int playbackMode = isLooped ? FMOD_LOOP_NORMAL : FMOD_LOOP_OFF;
+	float frequency;
+	channelAssignedToSound->setMode(playbackMode);
+	channelAssignedToSound->getFrequency( &frequency );
+	channelAssignedToSound->setFrequency( frequency * speed );
+	channelAssignedToSound->setVolume( volume );
+	channelAssignedToSound->setPan( balance );
+	channelAssignedToSound->setLoopCount( loopCount );
+
+	return (BackendVoiceHandle) channelAssignedToSound;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+void FmodAudioBackend::StopVoice( BackendVoiceHandle voice )
+{
+	FMOD::Channel* channelAssignedToSound = (FMOD::Channel*) voice;
+	channelAssignedToSound->stop();
+}
+
+
+//-----------------------------------------------------------------------------------------------
+bool FmodAudioBackend::IsVoicePlaying( BackendVoiceHandle voice ) const
+{
+	FMOD::Channel* channelAssignedToSound = (FMOD::Channel*) voice;
+	bool isPlaying = false;
+	FMOD_RESULT result = channelAssignedToSound->isPlaying( &isPlaying );
+	return result == FMOD_OK && isPlaying;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+void FmodAudioBackend::SetVoiceVolume( BackendVoiceHandle voice, float volume )
+{
+	FMOD::Channel* channelAssignedToSound = (FMOD::Channel*) voice;
+	channelAssignedToSound->setVolume( volume );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+void FmodAudioBackend::SetVoiceBalance( BackendVoiceHandle voice, float balance )
+{
+	FMOD::Channel* channelAssignedToSound = (FMOD::Channel*) voice;
+	channelAssignedToSound->setPan( balance );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+// Speed is frequency multiplier (1.0 == normal)
+//	A speed of 2.0 gives 2x frequency, i.e. exactly one octave higher
+//	A speed of 0.5 gives 1/2 frequency, i.e. exactly one octave lower
+//
+void FmodAudioBackend::SetVoiceSpeed( BackendVoiceHandle voice, float speed )
+{
+	FMOD::Channel* channelAssignedToSound = (FMOD::Channel*) voice;
+	float frequency;
+	FMOD::Sound* currentSound = nullptr;
+	channelAssignedToSound->getCurrentSound( &currentSound );
+	if( !currentSound )
+		return;
+
+	int ignored = 0;
+	currentSound->getDefaults( &frequency, &ignored );
+	channelAssignedToSound->setFrequency( frequency * speed );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+void FmodAudioBackend::SetVoicePaused( BackendVoiceHandle voice, bool isPaused )
+{
+	FMOD::Channel* channelAssignedToSound = (FMOD::Channel*) voice;
+	channelAssignedToSound->setPaused( isPaused );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+void FmodAudioBackend::ValidateResult( FMOD_RESULT result )
+{
+	if( result != FMOD_OK )
+	{
+		ERROR_RECOVERABLE( Stringf( "Engine/Audio SYSTEM ERROR: Got error result code %i - error codes listed in fmod_common.h\n", (int) result ) );
+	}
+}
+
+
+#endif // !defined( ENGINE_DISABLE_AUDIO ) && !defined( ENGINE_HEADLESS )
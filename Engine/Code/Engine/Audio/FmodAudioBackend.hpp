@@ -0,0 +1,36 @@
+#pragma once
+#include "Engine/Audio/AudioBackend.hpp"
+#include "ThirdParty/fmod/fmod.hpp"
+
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+// Sound handles are FMOD::Sound pointers and voice handles FMOD::Channel pointers. FMOD keeps its
+//	own channel handles safe to use after the channel finishes or is stolen, so a stale voice just
+//	fails the call.
+//
+class FmodAudioBackend : public AudioBackend
+{
+public:
+	explicit FmodAudioBackend( int maxVoiceCount = 512 );
+	virtual ~FmodAudioBackend();
+
+	virtual void				Update() override;
+	virtual int					GetMaxVoiceCount() const override						{ return m_maxVoiceCount; }
+
+	virtual BackendSoundHandle	CreateSound( char const* soundFilePath ) override;
+	virtual BackendSoundHandle	CreateSoundFromMemory( void const* fileData, size_t fileSizeBytes ) override;
+
+	virtual BackendVoiceHandle	StartVoice( BackendSoundHandle sound, bool isLooped, float volume, float balance, float speed, bool isPaused ) override;
+	virtual void				StopVoice( BackendVoiceHandle voice ) override;
+	virtual bool				IsVoicePlaying( BackendVoiceHandle voice ) const override;
+	virtual void				SetVoiceVolume( BackendVoiceHandle voice, float volume ) override;
+	virtual void				SetVoiceBalance( BackendVoiceHandle voice, float balance ) override;
+	virtual void				SetVoiceSpeed( BackendVoiceHandle voice, float speed ) override;
+	virtual void				SetVoicePaused( BackendVoiceHandle voice, bool isPaused ) override;
+
+	void						ValidateResult( FMOD_RESULT result );
+
+private:
+	FMOD::System*	m_fmodSystem		= nullptr;
+	int				m_maxVoiceCount		= 512;
+};
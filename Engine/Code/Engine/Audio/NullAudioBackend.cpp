@@ -0,0 +1,114 @@
+#include "Engine/Audio/NullAudioBackend.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+
+
+//-----------------------------------------------------------------------------------------------
+NullAudioBackend::NullAudioBackend( int maxVoiceCount )
+	: m_maxVoiceCount( maxVoiceCount )
+{
+}
+
+
+//-----------------------------------------------------------------------------------------------
+BackendSoundHandle NullAudioBackend::CreateSound( char const* soundFilePath )
+{
+	if( soundFilePath == nullptr )
+		return INVALID_BACKEND_HANDLE;
+
+	return m_soundCount++;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+BackendSoundHandle NullAudioBackend::CreateSoundFromMemory( void const* fileData, size_t fileSizeBytes )
+{
+	if( fileData == nullptr || fileSizeBytes == 0 )
+		return INVALID_BACKEND_HANDLE;
+
+	return m_soundCount++;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+BackendVoiceHandle NullAudioBackend::StartVoice( BackendSoundHandle sound, bool isLooped, float volume, float balance, float speed, bool isPaused )
+{
+	UNUSED( isLooped );
+	if( sound >= m_soundCount || m_playingVoiceCount >= m_maxVoiceCount )
+		return INVALID_BACKEND_HANDLE;
+
+	null_voice_t newVoice;
+	newVoice.sound = sound;
+	newVoice.volume = volume;
+	newVoice.balance = balance;
+	newVoice.speed = speed;
+	newVoice.isPaused = isPaused;
+	m_voices.push_back( newVoice );
+	++m_playingVoiceCount;
+
+	return m_voices.size() - 1;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+void NullAudioBackend::StopVoice( BackendVoiceHandle voice )
+{
+	FinishVoice( voice );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+bool NullAudioBackend::IsVoicePlaying( BackendVoiceHandle voice ) const
+{
+	return IsValidVoice( voice ) && m_voices[ voice ].isPlaying;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+void NullAudioBackend::SetVoiceVolume( BackendVoiceHandle voice, float volume )
+{
+	if( IsValidVoice( voice ) )
+	{
+		m_voices[ voice ].volume = volume;
+	}
+}
+
+
+//-----------------------------------------------------------------------------------------------
+void NullAudioBackend::SetVoiceBalance( BackendVoiceHandle voice, float balance )
+{
+	if( IsValidVoice( voice ) )
+	{
+		m_voices[ voice ].balance = balance;
+	}
+}
+
+
+//-----------------------------------------------------------------------------------------------
+void NullAudioBackend::SetVoiceSpeed( BackendVoiceHandle voice, float speed )
+{
+	if( IsValidVoice( voice ) )
+	{
+		m_voices[ voice ].speed = speed;
+	}
+}
+
+
+//-----------------------------------------------------------------------------------------------
+void NullAudioBackend::SetVoicePaused( BackendVoiceHandle voice, bool isPaused )
+{
+	if( IsValidVoice( voice ) )
+	{
+		m_voices[ voice ].isPaused = isPaused;
+	}
+}
+
+
+//-----------------------------------------------------------------------------------------------
+void NullAudioBackend::FinishVoice( BackendVoiceHandle voice )
+{
+	if( IsVoicePlaying( voice ) )
+	{
+		m_voices[ voice ].isPlaying = false;
+		--m_playingVoiceCount;
+	}
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include "Engine/Audio/AudioBackend.hpp"
+#include <string>
+#include <vector>
+
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+// Plays nothing, but keeps the same books a real backend would: every sound "loads", and a voice
+//	plays until it is stopped or FinishVoice ends it (standing in for a one-shot running out).
+//	Used when ENGINE_DISABLE_AUDIO is set and to check AudioSystem's voice decisions.
+//
+class NullAudioBackend : public AudioBackend
+{
+public:
+	explicit NullAudioBackend( int maxVoiceCount = 512 );
+	virtual ~NullAudioBackend() {}
+
+	virtual void				Update() override {}
+	virtual int					GetMaxVoiceCount() const override						{ return m_maxVoiceCount; }
+
+	virtual BackendSoundHandle	CreateSound( char const* soundFilePath ) override;
+	virtual BackendSoundHandle	CreateSoundFromMemory( void const* fileData, size_t fileSizeBytes ) override;
+
+	virtual BackendVoiceHandle	StartVoice( BackendSoundHandle sound, bool isLooped, float volume, float balance, float speed, bool isPaused ) override;
+	virtual void				StopVoice( BackendVoiceHandle voice ) override;
+	virtual bool				IsVoicePlaying( BackendVoiceHandle voice ) const override;
+	virtual void				SetVoiceVolume( BackendVoiceHandle voice, float volume ) override;
+	virtual void				SetVoiceBalance( BackendVoiceHandle voice, float balance ) override;
+	virtual void				SetVoiceSpeed( BackendVoiceHandle voice, float speed ) override;
+	virtual void				SetVoicePaused( BackendVoiceHandle voice, bool isPaused ) override;
+
+	void						FinishVoice( BackendVoiceHandle voice );
+	int							GetPlayingVoiceCount() const							{ return m_playingVoiceCount; }
+	int							GetStartedVoiceCount() const							{ return static_cast<int>( m_voices.size() ); }
+	BackendSoundHandle			GetVoiceSound( BackendVoiceHandle voice ) const			{ return m_voices[ voice ].sound; }
+	float						GetVoiceVolume( BackendVoiceHandle voice ) const		{ return m_voices[ voice ].volume; }
+	float						GetVoiceBalance( BackendVoiceHandle voice ) const		{ return m_voices[ voice ].balance; }
+
+private:
+	struct null_voice_t
+	{
+		BackendSoundHandle	sound		= INVALID_BACKEND_HANDLE;
+		float				volume		= 1.f;
+		float				balance		= 0.f;
+		float				speed		= 1.f;
+		bool				isPaused	= false;
+		bool				isPlaying	= true;
+	};
+
+	bool IsValidVoice( BackendVoiceHandle voice ) const		{ return voice < m_voices.size(); }
+
+private:
+	int							m_maxVoiceCount		= 512;
+	int							m_playingVoiceCount	= 0;
+	BackendSoundHandle			m_soundCount		= 0;
+	std::vector<null_voice_t>	m_voices;			// never reused, so a voice handle is its index
+};
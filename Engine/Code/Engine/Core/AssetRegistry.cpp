@@ -0,0 +1,51 @@
+#include "Engine/Core/AssetRegistry.hpp"
+#include <atomic>
+
+
+//---------------------------------------------------------------------------------------------------------
+STATIC const AssetHandle AssetHandle::INVALID = AssetHandle();
+
+
+//---------------------------------------------------------------------------------------------------------
+static std::atomic<uint>	s_assetStringLookupsThisFrame	= 0;
+static uint					s_assetStringLookupsLastFrame	= 0;
+static uint					s_assetStringLookupsPeak		= 0;
+
+
+//---------------------------------------------------------------------------------------------------------
+void RecordAssetStringLookup()
+{
+	s_assetStringLookupsThisFrame++;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void EndAssetLookupFrame()
+{
+	s_assetStringLookupsLastFrame = s_assetStringLookupsThisFrame.exchange( 0 );
+	if( s_assetStringLookupsLastFrame > s_assetStringLookupsPeak )
+	{
+		s_assetStringLookupsPeak = s_assetStringLookupsLastFrame;
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+uint GetAssetStringLookupsThisFrame()
+{
+	return s_assetStringLookupsThisFrame;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+uint GetAssetStringLookupsLastFrame()
+{
+	return s_assetStringLookupsLastFrame;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+uint GetAssetStringLookupsPeak()
+{
+	return s_assetStringLookupsPeak;
+}
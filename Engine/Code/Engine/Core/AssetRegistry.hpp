@@ -0,0 +1,225 @@
+#pragma once
+#include "Engine/Core/EngineCommon.hpp"
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+
+//---------------------------------------------------------------------------------------------------------
+// String lookup instrumentation - every lookup that has to hash a path at call time is counted so
+// per-frame callers can be found and moved over to handles.
+//---------------------------------------------------------------------------------------------------------
+void	RecordAssetStringLookup();
+void	EndAssetLookupFrame();
+uint	GetAssetStringLookupsThisFrame();
+uint	GetAssetStringLookupsLastFrame();
+uint	GetAssetStringLookupsPeak();
+
+
+//---------------------------------------------------------------------------------------------------------
+struct AssetHandle
+{
+public:
+	AssetHandle() = default;
+	explicit AssetHandle( uint index, uint generation )	: m_index( index ), m_generation( generation ) {}
+
+	bool IsValid() const								{ return m_index != INVALID_INDEX; }
+	bool operator==( AssetHandle const& compare ) const	{ return m_index == compare.m_index && m_generation == compare.m_generation; }
+	bool operator!=( AssetHandle const& compare ) const	{ return !( *this == compare ); }
+
+public:
+	static const uint INVALID_INDEX = 0xFFFFFFFF;
+	static const AssetHandle INVALID;
+
+	uint m_index		= INVALID_INDEX;
+	uint m_generation	= 0;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Owns the path -> slot mapping for one asset type. Slots are never reused so a handle's index is stable
+// for the life of the registry. Reloading the asset behind a slot keeps its handles valid and bumps the
+// slot's reload count; Clear retires every slot by bumping its generation, so handles taken before it
+// resolve to null rather than to whatever gets registered next. The registry does not own the assets.
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+class AssetRegistry
+{
+public:
+	AssetHandle	Register( char const* filepath, T* asset );
+	void		Replace( AssetHandle handle, T* newAsset );
+	void		MarkReloaded( AssetHandle handle );
+	void		Clear();
+
+	AssetHandle	FindHandle( char const* filepath ) const;
+	AssetHandle	FindHandle( uint pathHash, char const* filepath ) const;
+	T*			Find( char const* filepath ) const;
+	T*			Get( AssetHandle handle ) const;
+
+	bool		IsStale( AssetHandle handle ) const;
+	uint		GetReloadCount( AssetHandle handle ) const;
+	uint		GetCount() const							{ return static_cast<uint>( m_slots.size() ); }
+	std::string	const& GetFilePath( AssetHandle handle ) const;
+
+private:
+	struct AssetSlot
+	{
+		T*			m_asset			= nullptr;
+		uint		m_pathHash		= 0;
+		uint		m_generation	= 0;
+		uint		m_reloadCount	= 0;
+		std::string	m_filepath		= "";
+	};
+
+	std::vector<AssetSlot>			m_slots;
+	std::unordered_map<uint, uint>	m_slotIndexByPathHash;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+AssetHandle AssetRegistry<T>::Register( char const* filepath, T* asset )
+{
+	uint pathHash = HashString( filepath );
+
+	auto foundIter = m_slotIndexByPathHash.find( pathHash );
+	if( foundIter != m_slotIndexByPathHash.end() )
+	{
+		AssetSlot& existingSlot = m_slots[ foundIter->second ];
+		GUARANTEE_OR_DIE( existingSlot.m_filepath == filepath, Stringf( "Asset path hash collision between \"%s\" and \"%s\"", filepath, existingSlot.m_filepath.c_str() ) );
+
+		existingSlot.m_asset = asset;
+		existingSlot.m_reloadCount++;
+		return AssetHandle( foundIter->second, existingSlot.m_generation );
+	}
+
+	AssetSlot newSlot;
+	newSlot.m_asset		= asset;
+	newSlot.m_pathHash	= pathHash;
+	newSlot.m_filepath	= filepath;
+
+	uint slotIndex = static_cast<uint>( m_slots.size() );
+	m_slots.push_back( newSlot );
+	m_slotIndexByPathHash[ pathHash ] = slotIndex;
+
+	return AssetHandle( slotIndex, 0 );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+void AssetRegistry<T>::Replace( AssetHandle handle, T* newAsset )
+{
+	if( IsStale( handle ) )
+		return;
+
+	AssetSlot& slot = m_slots[ handle.m_index ];
+	slot.m_asset = newAsset;
+	slot.m_reloadCount++;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+void AssetRegistry<T>::MarkReloaded( AssetHandle handle )
+{
+	if( IsStale( handle ) )
+		return;
+
+	m_slots[ handle.m_index ].m_reloadCount++;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+void AssetRegistry<T>::Clear()
+{
+	// Slots stay behind, retired, so no later Register can hand an old handle's index to a new asset
+	for( uint slotIndex = 0; slotIndex < m_slots.size(); ++slotIndex )
+	{
+		AssetSlot& slot = m_slots[ slotIndex ];
+		slot.m_asset = nullptr;
+		slot.m_generation++;
+		slot.m_filepath.clear();
+	}
+	m_slotIndexByPathHash.clear();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+AssetHandle AssetRegistry<T>::FindHandle( char const* filepath ) const
+{
+	RecordAssetStringLookup();
+	return FindHandle( HashString( filepath ), filepath );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+AssetHandle AssetRegistry<T>::FindHandle( uint pathHash, char const* filepath ) const
+{
+	auto foundIter = m_slotIndexByPathHash.find( pathHash );
+	if( foundIter == m_slotIndexByPathHash.end() )
+		return AssetHandle::INVALID;
+
+	AssetSlot const& slot = m_slots[ foundIter->second ];
+	if( filepath != nullptr && slot.m_filepath != filepath )
+		return AssetHandle::INVALID;
+
+	return AssetHandle( foundIter->second, slot.m_generation );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+T* AssetRegistry<T>::Find( char const* filepath ) const
+{
+	AssetHandle handle = FindHandle( filepath );
+	return Get( handle );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+T* AssetRegistry<T>::Get( AssetHandle handle ) const
+{
+	if( IsStale( handle ) )
+		return nullptr;
+
+	return m_slots[ handle.m_index ].m_asset;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+bool AssetRegistry<T>::IsStale( AssetHandle handle ) const
+{
+	if( handle.m_index >= m_slots.size() )
+		return true;
+
+	return m_slots[ handle.m_index ].m_generation != handle.m_generation;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+uint AssetRegistry<T>::GetReloadCount( AssetHandle handle ) const
+{
+	if( IsStale( handle ) )
+		return 0;
+
+	return m_slots[ handle.m_index ].m_reloadCount;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+std::string const& AssetRegistry<T>::GetFilePath( AssetHandle handle ) const
+{
+	static std::string const s_invalidPath = "";
+	if( IsStale( handle ) )
+		return s_invalidPath;
+
+	return m_slots[ handle.m_index ].m_filepath;
+}
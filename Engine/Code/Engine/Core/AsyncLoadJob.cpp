@@ -0,0 +1,131 @@
+#include "Engine/Core/AsyncLoadJob.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/Time.hpp"
+#include <atomic>
+
+
+//---------------------------------------------------------------------------------------------------------
+static std::atomic<uint>				s_asyncLoadsRequested	= 0;
+static std::atomic<uint>				s_asyncLoadsCompleted	= 0;
+static std::vector<async_load_record_t>	s_asyncLoadRecords;
+
+
+//---------------------------------------------------------------------------------------------------------
+AsyncLoadJob::AsyncLoadJob( JobCategory category, std::string const& filepath )
+	: Job( category )
+	, m_filepath( filepath )
+{
+	m_requestTimeSeconds = GetCurrentTimeSeconds();
+	s_asyncLoadsRequested++;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void AsyncLoadJob::Execute()
+{
+	m_startTimeSeconds = GetCurrentTimeSeconds();
+	ExecuteLoad();
+	m_decodeSeconds = GetCurrentTimeSeconds() - m_startTimeSeconds;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void AsyncLoadJob::OnCompleteCallback()
+{
+	double finalizeStartSeconds = GetCurrentTimeSeconds();
+	FinalizeLoad();
+	double finalizeEndSeconds = GetCurrentTimeSeconds();
+
+	async_load_record_t record;
+	record.filepath			= m_filepath;
+	record.queuedSeconds	= m_startTimeSeconds - m_requestTimeSeconds;
+	record.decodeSeconds	= m_decodeSeconds;
+	record.finalizeSeconds	= finalizeEndSeconds - finalizeStartSeconds;
+	record.totalSeconds		= finalizeEndSeconds - m_requestTimeSeconds;
+	s_asyncLoadRecords.push_back( record );
+
+	s_asyncLoadsCompleted++;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void PostAsyncLoadJob( AsyncLoadJob* loadJob )
+{
+	// Without worker threads nothing would ever pick the job up, so load it in place
+	if( g_theJobSystem == nullptr || g_theJobSystem->GetWorkerThreadCount() == 0 )
+	{
+		loadJob->Execute();
+		loadJob->OnCompleteCallback();
+		delete loadJob;
+		return;
+	}
+
+	g_theJobSystem->PostJob( loadJob );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+uint GetAsyncLoadsRequested()
+{
+	return s_asyncLoadsRequested;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+uint GetAsyncLoadsCompleted()
+{
+	return s_asyncLoadsCompleted;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+uint GetAsyncLoadsPending()
+{
+	return s_asyncLoadsRequested - s_asyncLoadsCompleted;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+float GetAsyncLoadProgress()
+{
+	uint requested = s_asyncLoadsRequested;
+	if( requested == 0 )
+		return 1.f;
+
+	return static_cast<float>( s_asyncLoadsCompleted ) / static_cast<float>( requested );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void ResetAsyncLoadProgress()
+{
+	uint pending = GetAsyncLoadsPending();
+	s_asyncLoadsRequested = pending;
+	s_asyncLoadsCompleted = 0;
+	s_asyncLoadRecords.clear();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+std::vector<async_load_record_t> const& GetAsyncLoadRecords()
+{
+	return s_asyncLoadRecords;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void PrintAsyncLoadReport()
+{
+	g_theConsole->PrintString( Rgba8::WHITE, "Async loads: %u/%u complete", GetAsyncLoadsCompleted(), GetAsyncLoadsRequested() );
+	for( uint recordIndex = 0; recordIndex < s_asyncLoadRecords.size(); ++recordIndex )
+	{
+		async_load_record_t const& record = s_asyncLoadRecords[ recordIndex ];
+		g_theConsole->PrintString( Rgba8::WHITE, "  %-48s queued %7.2fms  decode %7.2fms  finalize %7.2fms  total %7.2fms",
+			record.filepath.c_str(),
+			record.queuedSeconds * 1000.0,
+			record.decodeSeconds * 1000.0,
+			record.finalizeSeconds * 1000.0,
+			record.totalSeconds * 1000.0 );
+	}
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include "Engine/Core/JobSystem.hpp"
+#include <string>
+#include <vector>
+
+
+//---------------------------------------------------------------------------------------------------------
+struct async_load_record_t
+{
+	std::string	filepath;
+	double		queuedSeconds	= 0.0;	// request -> worker pickup
+	double		decodeSeconds	= 0.0;	// file I/O + decode on the worker
+	double		finalizeSeconds	= 0.0;	// GPU upload / registration on the main thread
+	double		totalSeconds	= 0.0;	// request -> ready
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// File I/O and decode run in ExecuteLoad() on a worker thread; FinalizeLoad() runs on the main thread
+// when the owning system claims its completed jobs. Both halves are timed and reported on completion.
+//---------------------------------------------------------------------------------------------------------
+class AsyncLoadJob : public Job
+{
+public:
+	AsyncLoadJob( JobCategory category, std::string const& filepath );
+	virtual ~AsyncLoadJob() {}
+
+	virtual void Execute() final;
+	virtual void OnCompleteCallback() final;
+
+protected:
+	virtual void ExecuteLoad() = 0;
+	virtual void FinalizeLoad() = 0;
+
+protected:
+	std::string	m_filepath				= "";
+	double		m_requestTimeSeconds	= 0.0;
+	double		m_startTimeSeconds		= 0.0;
+	double		m_decodeSeconds			= 0.0;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+void	PostAsyncLoadJob( AsyncLoadJob* loadJob );
+
+uint	GetAsyncLoadsRequested();
+uint	GetAsyncLoadsCompleted();
+uint	GetAsyncLoadsPending();
+float	GetAsyncLoadProgress();
+void	ResetAsyncLoadProgress();
+
+std::vector<async_load_record_t> const& GetAsyncLoadRecords();
+void	PrintAsyncLoadReport();
@@ -0,0 +1,409 @@
+#include "Engine/Core/BakedXml.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/FileUtils.hpp"
+#include <unordered_map>
+
+
+//---------------------------------------------------------------------------------------------------------
+constexpr uint64_t BAKED_XML_NULL_REFERENCE = ~0ull;
+
+
+//---------------------------------------------------------------------------------------------------------
+// The string table follows the attribute array, which follows the element array. Element 0 is the root.
+struct baked_xml_header_t
+{
+	uint32_t	magic				= 0;
+	uint32_t	version				= 0;
+	int64_t		sourceModifiedTime	= 0;
+	uint64_t	sourceSize			= 0;
+	uint32_t	elementCount		= 0;
+	uint32_t	attributeCount		= 0;
+	uint64_t	stringTableSize		= 0;
+};
+static_assert( sizeof( baked_xml_header_t ) % 8 == 0, "Baked XML records must stay 8 byte aligned" );
+
+
+//---------------------------------------------------------------------------------------------------------
+// Bake-time only: walks the tinyxml tree in document order and interns every string it meets
+//---------------------------------------------------------------------------------------------------------
+class BakedXmlWriter
+{
+public:
+	struct element_record_t
+	{
+		uint64_t	nameOffset			= 0;
+		uint64_t	firstAttribute		= BAKED_XML_NULL_REFERENCE;
+		uint64_t	firstChild			= BAKED_XML_NULL_REFERENCE;
+		uint64_t	nextSibling			= BAKED_XML_NULL_REFERENCE;
+		int			lineNum				= 0;
+		uint		attributeCount		= 0;
+	};
+
+	struct attribute_record_t
+	{
+		uint64_t	nameOffset			= 0;
+		uint64_t	valueOffset			= 0;
+		uint64_t	next				= BAKED_XML_NULL_REFERENCE;
+	};
+
+	static_assert( sizeof( element_record_t ) == sizeof( BakedXmlElement ), "Baked element layout mismatch" );
+	static_assert( sizeof( attribute_record_t ) == sizeof( BakedXmlAttribute ), "Baked attribute layout mismatch" );
+
+public:
+	uint AddElement( XmlElement const& element )
+	{
+		uint elementIndex = static_cast<uint>( m_elements.size() );
+		m_elements.emplace_back();
+		m_elements[ elementIndex ].nameOffset = InternString( element.Name() );
+		m_elements[ elementIndex ].lineNum = element.GetLineNum();
+
+		for( XmlAttribute const* attribute = element.FirstAttribute(); attribute != nullptr; attribute = attribute->Next() )
+		{
+			uint attributeIndex = static_cast<uint>( m_attributes.size() );
+			m_attributes.emplace_back();
+			m_attributes[ attributeIndex ].nameOffset = InternString( attribute->Name() );
+			m_attributes[ attributeIndex ].valueOffset = InternString( attribute->Value() );
+
+			if( m_elements[ elementIndex ].attributeCount == 0 )
+			{
+				m_elements[ elementIndex ].firstAttribute = attributeIndex;
+			}
+			else
+			{
+				m_attributes[ attributeIndex - 1 ].next = attributeIndex;
+			}
+			m_elements[ elementIndex ].attributeCount++;
+		}
+
+		uint previousChildIndex = 0;
+		for( XmlElement const* child = element.FirstChildElement(); child != nullptr; child = child->NextSiblingElement() )
+		{
+			uint childIndex = AddElement( *child );
+			if( m_elements[ elementIndex ].firstChild == BAKED_XML_NULL_REFERENCE )
+			{
+				m_elements[ elementIndex ].firstChild = childIndex;
+			}
+			else
+			{
+				m_elements[ previousChildIndex ].nextSibling = childIndex;
+			}
+			previousChildIndex = childIndex;
+		}
+
+		return elementIndex;
+	}
+
+	uint64_t InternString( char const* string )
+	{
+		auto stringIter = m_stringOffsets.find( string );
+		if( stringIter != m_stringOffsets.end() )
+		{
+			return stringIter->second;
+		}
+
+		uint64_t offset = m_stringTable.size();
+		m_stringTable.insert( m_stringTable.end(), string, string + strlen( string ) + 1 );
+		m_stringOffsets[ string ] = offset;
+		return offset;
+	}
+
+public:
+	std::vector<element_record_t>					m_elements;
+	std::vector<attribute_record_t>					m_attributes;
+	std::vector<char>								m_stringTable;
+	std::unordered_map<std::string, uint64_t>		m_stringOffsets;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+char const* BakedXmlElement::Name() const
+{
+	return static_cast<char const*>( m_name.pointer );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+char const* BakedXmlElement::Attribute( char const* attributeName ) const
+{
+	BakedXmlAttribute const* attributes = FirstAttribute();
+	for( uint attributeIndex = 0; attributeIndex < m_attributeCount; ++attributeIndex )
+	{
+		if( strcmp( attributes[ attributeIndex ].Name(), attributeName ) == 0 )
+		{
+			return attributes[ attributeIndex ].Value();
+		}
+	}
+	return nullptr;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+BakedXmlAttribute const* BakedXmlElement::FirstAttribute() const
+{
+	return static_cast<BakedXmlAttribute const*>( m_firstAttribute.pointer );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+BakedXmlElement const* BakedXmlElement::FirstChildElement( char const* elementName ) const
+{
+	BakedXmlElement const* child = static_cast<BakedXmlElement const*>( m_firstChild.pointer );
+	if( elementName == nullptr || child == nullptr || strcmp( child->Name(), elementName ) == 0 )
+	{
+		return child;
+	}
+	return child->NextSiblingElement( elementName );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+BakedXmlElement const* BakedXmlElement::NextSiblingElement( char const* elementName ) const
+{
+	BakedXmlElement const* sibling = static_cast<BakedXmlElement const*>( m_nextSibling.pointer );
+	if( elementName == nullptr )
+	{
+		return sibling;
+	}
+
+	while( sibling != nullptr && strcmp( sibling->Name(), elementName ) != 0 )
+	{
+		sibling = static_cast<BakedXmlElement const*>( sibling->m_nextSibling.pointer );
+	}
+	return sibling;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+BakedXmlDocument::~BakedXmlDocument()
+{
+	FreeData();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+tinyxml2::XMLError BakedXmlDocument::LoadFile( char const* xmlFilepath )
+{
+	FreeData();
+	m_errorID = tinyxml2::XML_SUCCESS;
+	m_errorLineNum = 0;
+	m_wasLoadedFromCache = false;
+
+	int64_t sourceModifiedTime = 0;
+	size_t sourceSize = 0;
+	bool hasSource = GetFileModificationInfo( xmlFilepath, &sourceModifiedTime, &sourceSize );
+
+	std::string bakedFilepath = GetBakedFilepath( xmlFilepath );
+	if( LoadFromBakedFile( bakedFilepath, hasSource, sourceModifiedTime, sourceSize ) )
+	{
+		m_wasLoadedFromCache = true;
+		return m_errorID;
+	}
+
+	XmlDocument xmlDocument;
+	xmlDocument.LoadFile( xmlFilepath );
+	if( xmlDocument.ErrorID() != tinyxml2::XML_SUCCESS )
+	{
+		m_errorID = xmlDocument.ErrorID();
+		m_errorLineNum = xmlDocument.ErrorLineNum();
+		return m_errorID;
+	}
+
+	std::vector<unsigned char> bakedData;
+	BakeXmlDocument( xmlDocument, sourceModifiedTime, sourceSize, bakedData );
+
+	// A read-only data folder just means the next run parses the XML again
+	FileWriteFromBuffer( bakedFilepath, bakedData.data(), bakedData.size() );
+
+	m_dataSize = bakedData.size();
+	m_data = new unsigned char[ m_dataSize ];
+	memcpy( m_data, bakedData.data(), m_dataSize );
+	GUARANTEE_OR_DIE( FixUpReferences(), Stringf( "Failed to read back baked data for %s", xmlFilepath ) );
+	return m_errorID;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+BakedXmlElement const* BakedXmlDocument::RootElement() const
+{
+	return m_rootElement;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+STATIC bool BakedXmlDocument::BakeFile( char const* xmlFilepath )
+{
+	int64_t sourceModifiedTime = 0;
+	size_t sourceSize = 0;
+	if( !GetFileModificationInfo( xmlFilepath, &sourceModifiedTime, &sourceSize ) )
+		return false;
+
+	XmlDocument xmlDocument;
+	xmlDocument.LoadFile( xmlFilepath );
+	if( xmlDocument.ErrorID() != tinyxml2::XML_SUCCESS )
+		return false;
+
+	std::vector<unsigned char> bakedData;
+	BakeXmlDocument( xmlDocument, sourceModifiedTime, sourceSize, bakedData );
+	return FileWriteFromBuffer( GetBakedFilepath( xmlFilepath ), bakedData.data(), bakedData.size() );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+STATIC std::string BakedXmlDocument::GetBakedFilepath( char const* xmlFilepath )
+{
+	return std::string( xmlFilepath ) + ".baked";
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool BakedXmlDocument::LoadFromBakedFile( std::string const& bakedFilepath, bool hasSource, int64_t sourceModifiedTime, size_t sourceSize )
+{
+	size_t bakedSize = 0;
+	unsigned char* bakedData = static_cast<unsigned char*>( FileReadBinaryToNewBuffer( bakedFilepath, &bakedSize ) );
+	if( bakedData == nullptr )
+		return false;
+
+	baked_xml_header_t header;
+	if( bakedSize >= sizeof( header ) )
+	{
+		memcpy( &header, bakedData, sizeof( header ) );
+	}
+
+	bool isCurrent =	bakedSize >= sizeof( header )						&&
+						header.magic == BAKED_XML_MAGIC						&&
+						header.version == BAKED_XML_VERSION					&&
+						( !hasSource || ( header.sourceModifiedTime == sourceModifiedTime && header.sourceSize == sourceSize ) );
+	if( !isCurrent )
+	{
+		delete[] bakedData;
+		return false;
+	}
+
+	m_data = bakedData;
+	m_dataSize = bakedSize;
+	if( !FixUpReferences() )
+	{
+		FreeData();
+		return false;
+	}
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Offsets become pointers into this buffer. Anything out of range means a truncated or foreign file.
+bool BakedXmlDocument::FixUpReferences()
+{
+	baked_xml_header_t header;
+	memcpy( &header, m_data, sizeof( header ) );
+
+	size_t elementsStart = sizeof( baked_xml_header_t );
+	size_t attributesStart = elementsStart + ( header.elementCount * sizeof( BakedXmlElement ) );
+	size_t stringsStart = attributesStart + ( header.attributeCount * sizeof( BakedXmlAttribute ) );
+	if( header.elementCount == 0 || stringsStart + header.stringTableSize > m_dataSize )
+		return false;
+
+	BakedXmlElement* elements = reinterpret_cast<BakedXmlElement*>( m_data + elementsStart );
+	BakedXmlAttribute* attributes = reinterpret_cast<BakedXmlAttribute*>( m_data + attributesStart );
+	char const* strings = reinterpret_cast<char const*>( m_data + stringsStart );
+	char const* stringsEnd = strings + header.stringTableSize;
+
+	auto fixUpString = [&]( baked_xml_reference_t& reference ) -> bool
+	{
+		if( reference.offset >= header.stringTableSize )
+			return false;
+
+		reference.pointer = strings + reference.offset;
+		return memchr( reference.pointer, 0, stringsEnd - static_cast<char const*>( reference.pointer ) ) != nullptr;
+	};
+
+	auto fixUpIndex = [&]( baked_xml_reference_t& reference, void const* arrayStart, size_t recordSize, uint recordCount ) -> bool
+	{
+		if( reference.offset == BAKED_XML_NULL_REFERENCE )
+		{
+			reference.pointer = nullptr;
+			return true;
+		}
+
+		if( reference.offset >= recordCount )
+			return false;
+
+		reference.pointer = static_cast<unsigned char const*>( arrayStart ) + ( reference.offset * recordSize );
+		return true;
+	};
+
+	for( uint elementIndex = 0; elementIndex < header.elementCount; ++elementIndex )
+	{
+		BakedXmlElement& element = elements[ elementIndex ];
+
+		// Attribute() walks m_attributeCount records from the first one, so the whole run has to be in the table
+		uint64_t firstAttribute = element.m_firstAttribute.offset;
+		if( element.m_attributeCount > 0 )
+		{
+			if( firstAttribute == BAKED_XML_NULL_REFERENCE || firstAttribute > header.attributeCount || element.m_attributeCount > header.attributeCount - firstAttribute )
+				return false;
+		}
+
+		if( !fixUpString( element.m_name ) ||
+			!fixUpIndex( element.m_firstAttribute, attributes, sizeof( BakedXmlAttribute ), header.attributeCount ) ||
+			!fixUpIndex( element.m_firstChild, elements, sizeof( BakedXmlElement ), header.elementCount ) ||
+			!fixUpIndex( element.m_nextSibling, elements, sizeof( BakedXmlElement ), header.elementCount ) )
+		{
+			return false;
+		}
+	}
+
+	for( uint attributeIndex = 0; attributeIndex < header.attributeCount; ++attributeIndex )
+	{
+		BakedXmlAttribute& attribute = attributes[ attributeIndex ];
+		if( !fixUpString( attribute.m_name ) ||
+			!fixUpString( attribute.m_value ) ||
+			!fixUpIndex( attribute.m_next, attributes, sizeof( BakedXmlAttribute ), header.attributeCount ) )
+		{
+			return false;
+		}
+	}
+
+	m_rootElement = &elements[ 0 ];
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void BakedXmlDocument::FreeData()
+{
+	delete[] m_data;
+	m_data = nullptr;
+	m_dataSize = 0;
+	m_rootElement = nullptr;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+STATIC void BakedXmlDocument::BakeXmlDocument( XmlDocument const& xmlDocument, int64_t sourceModifiedTime, size_t sourceSize, std::vector<unsigned char>& out_bakedData )
+{
+	BakedXmlWriter writer;
+	writer.AddElement( *xmlDocument.RootElement() );
+
+	baked_xml_header_t header;
+	header.magic				= BAKED_XML_MAGIC;
+	header.version				= BAKED_XML_VERSION;
+	header.sourceModifiedTime	= sourceModifiedTime;
+	header.sourceSize			= sourceSize;
+	header.elementCount			= static_cast<uint32_t>( writer.m_elements.size() );
+	header.attributeCount		= static_cast<uint32_t>( writer.m_attributes.size() );
+	header.stringTableSize		= writer.m_stringTable.size();
+
+	size_t elementBytes = writer.m_elements.size() * sizeof( BakedXmlWriter::element_record_t );
+	size_t attributeBytes = writer.m_attributes.size() * sizeof( BakedXmlWriter::attribute_record_t );
+	out_bakedData.resize( sizeof( header ) + elementBytes + attributeBytes + writer.m_stringTable.size() );
+
+	unsigned char* writeCursor = out_bakedData.data();
+	memcpy( writeCursor, &header, sizeof( header ) );
+	writeCursor += sizeof( header );
+	memcpy( writeCursor, writer.m_elements.data(), elementBytes );
+	writeCursor += elementBytes;
+	memcpy( writeCursor, writer.m_attributes.data(), attributeBytes );
+	writeCursor += attributeBytes;
+	memcpy( writeCursor, writer.m_stringTable.data(), writer.m_stringTable.size() );
+}
\ No newline at end of file
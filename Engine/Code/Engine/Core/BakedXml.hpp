@@ -0,0 +1,110 @@
+#pragma once
+#include "Engine/Core/XmlUtils.hpp"
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+
+class BakedXmlAttribute;
+
+
+//---------------------------------------------------------------------------------------------------------
+// The baked image is written with offsets in these slots; loading rewrites them in place as pointers
+union baked_xml_reference_t
+{
+	uint64_t	offset;
+	void const*	pointer;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Read-only element with the same navigation calls as XmlElement, so definition parsers can switch over
+// by changing the type they take.
+//---------------------------------------------------------------------------------------------------------
+class BakedXmlElement
+{
+	friend class BakedXmlDocument;
+
+public:
+	char const*					Name() const;
+	char const*					Attribute( char const* attributeName ) const;
+	BakedXmlAttribute const*	FirstAttribute() const;
+	BakedXmlElement const*		FirstChildElement( char const* elementName = nullptr ) const;
+	BakedXmlElement const*		NextSiblingElement( char const* elementName = nullptr ) const;
+	int							GetLineNum() const								{ return m_lineNum; }
+
+private:
+	baked_xml_reference_t	m_name;
+	baked_xml_reference_t	m_firstAttribute;
+	baked_xml_reference_t	m_firstChild;
+	baked_xml_reference_t	m_nextSibling;
+	int						m_lineNum			= 0;
+	uint					m_attributeCount	= 0;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+class BakedXmlAttribute
+{
+	friend class BakedXmlDocument;
+
+public:
+	char const*					Name() const			{ return static_cast<char const*>( m_name.pointer ); }
+	char const*					Value() const			{ return static_cast<char const*>( m_value.pointer ); }
+	BakedXmlAttribute const*	Next() const			{ return static_cast<BakedXmlAttribute const*>( m_next.pointer ); }
+
+private:
+	baked_xml_reference_t	m_name;
+	baked_xml_reference_t	m_value;
+	baked_xml_reference_t	m_next;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Loads an XML definition file through a binary cache kept beside it as "<file>.baked". The cache holds
+// every element and attribute in flat arrays with all names and values interned into one string table,
+// and records the size and modification time of the XML it was built from. When that still matches (or
+// the XML is absent, as in a shipped build) the cache is read in one block and its offsets are turned into
+// pointers - no text is parsed. Otherwise the XML is parsed, baked, and the cache rewritten.
+//
+// The image is position independent, so it could equally be mapped copy-on-write instead of read.
+//---------------------------------------------------------------------------------------------------------
+class BakedXmlDocument
+{
+public:
+	BakedXmlDocument() = default;
+	~BakedXmlDocument();
+
+	BakedXmlDocument( BakedXmlDocument const& copy ) = delete;
+	BakedXmlDocument& operator=( BakedXmlDocument const& copy ) = delete;
+
+	tinyxml2::XMLError		LoadFile( char const* xmlFilepath );
+	BakedXmlElement const*	RootElement() const;
+
+	tinyxml2::XMLError		ErrorID() const						{ return m_errorID; }
+	char const*				ErrorName() const					{ return XmlDocument::ErrorIDToName( m_errorID ); }
+	int						ErrorLineNum() const				{ return m_errorLineNum; }
+	bool					WasLoadedFromCache() const			{ return m_wasLoadedFromCache; }
+
+	static bool				BakeFile( char const* xmlFilepath );
+	static std::string		GetBakedFilepath( char const* xmlFilepath );
+
+public:
+	static constexpr uint32_t	BAKED_XML_MAGIC		= 0x4C4D5842;	// "BXML"
+	static constexpr uint32_t	BAKED_XML_VERSION	= 1;
+
+private:
+	bool	LoadFromBakedFile( std::string const& bakedFilepath, bool hasSource, int64_t sourceModifiedTime, size_t sourceSize );
+	bool	FixUpReferences();
+	void	FreeData();
+
+	static void	BakeXmlDocument( XmlDocument const& xmlDocument, int64_t sourceModifiedTime, size_t sourceSize, std::vector<unsigned char>& out_bakedData );
+
+private:
+	unsigned char*				m_data					= nullptr;
+	size_t						m_dataSize				= 0;
+	BakedXmlElement const*		m_rootElement			= nullptr;
+	tinyxml2::XMLError			m_errorID				= tinyxml2::XML_SUCCESS;
+	int							m_errorLineNum			= 0;
+	bool						m_wasLoadedFromCache	= false;
+};
\ No newline at end of file
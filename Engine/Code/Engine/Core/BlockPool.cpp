@@ -0,0 +1,264 @@
+#include "Engine/Core/BlockPool.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/MemoryTracker.hpp"
+#include "Engine/Platform/Platform.hpp"
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <malloc.h>
+
+#if defined( PLATFORM_WINDOWS )
+	#define WIN32_LEAN_AND_MEAN
+	#include <windows.h>
+#endif
+
+
+//---------------------------------------------------------------------------------------------------------
+constexpr size_t	BLOCK_POOL_CHUNK_SIZE			= 64 * 1024;
+constexpr size_t	BLOCK_POOL_CHUNK_HEADER_SIZE	= 64;
+constexpr uint		BLOCK_POOL_SIZE_CLASS_COUNT		= 10;
+constexpr size_t	BLOCK_POOL_GRANULARITY			= 16;
+
+static constexpr size_t s_sizeClassBytes[ BLOCK_POOL_SIZE_CLASS_COUNT ] = { 16, 32, 48, 64, 96, 128, 192, 256, 384, 512 };
+
+
+//---------------------------------------------------------------------------------------------------------
+struct PoolFreeBlock
+{
+	PoolFreeBlock* m_next = nullptr;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+class ThreadBlockPool;
+
+
+//---------------------------------------------------------------------------------------------------------
+// Chunks are aligned to their own size so any block can find its header by masking its address
+struct PoolChunkHeader
+{
+	ThreadBlockPool*	m_owner			= nullptr;
+	uint				m_sizeClass		= 0;
+};
+static_assert( sizeof( PoolChunkHeader ) <= BLOCK_POOL_CHUNK_HEADER_SIZE, "PoolChunkHeader outgrew its reserved space" );
+
+
+//---------------------------------------------------------------------------------------------------------
+// One per thread, created on first use and never destroyed, since other threads may still hold its blocks.
+// When its thread exits the pool is orphaned, and the next thread that needs a pool adopts it - chunks,
+// free lists and all - so short-lived threads recycle chunks instead of leaking them.
+//---------------------------------------------------------------------------------------------------------
+class ThreadBlockPool
+{
+public:
+	void*	Allocate( uint sizeClass );
+	void	FreeLocal( void* memory, uint sizeClass );
+	void	FreeRemote( void* memory, uint sizeClass );
+
+public:
+	ThreadBlockPool*				m_nextOrphan									= nullptr;
+
+private:
+	void	CreateChunk( uint sizeClass );
+
+private:
+	PoolFreeBlock*					m_freeLists[ BLOCK_POOL_SIZE_CLASS_COUNT ]		= {};
+	std::atomic<PoolFreeBlock*>		m_remoteFreeLists[ BLOCK_POOL_SIZE_CLASS_COUNT ]	= {};
+	unsigned char*					m_bumpCursors[ BLOCK_POOL_SIZE_CLASS_COUNT ]	= {};
+	unsigned char*					m_bumpEnds[ BLOCK_POOL_SIZE_CLASS_COUNT ]		= {};
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Orphans are linked through the pools themselves, so nothing here needs destroying at process exit
+static std::mutex			s_orphanedPoolsLock;
+static ThreadBlockPool*		s_orphanedPools = nullptr;
+
+
+//---------------------------------------------------------------------------------------------------------
+struct thread_block_pool_owner_t
+{
+	~thread_block_pool_owner_t();
+
+	ThreadBlockPool* m_pool = nullptr;
+};
+static thread_local thread_block_pool_owner_t t_threadBlockPool;
+
+
+//---------------------------------------------------------------------------------------------------------
+thread_block_pool_owner_t::~thread_block_pool_owner_t()
+{
+	if( m_pool == nullptr )
+		return;
+
+	// Blocks this thread still holds are freed remotely from here on, and the adopter reclaims them
+	std::lock_guard<std::mutex> orphanLock( s_orphanedPoolsLock );
+	m_pool->m_nextOrphan = s_orphanedPools;
+	s_orphanedPools = m_pool;
+	m_pool = nullptr;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static ThreadBlockPool* GetThreadBlockPool()
+{
+	if( t_threadBlockPool.m_pool != nullptr )
+		return t_threadBlockPool.m_pool;
+
+	{
+		std::lock_guard<std::mutex> orphanLock( s_orphanedPoolsLock );
+		if( s_orphanedPools != nullptr )
+		{
+			t_threadBlockPool.m_pool = s_orphanedPools;
+			s_orphanedPools = s_orphanedPools->m_nextOrphan;
+			t_threadBlockPool.m_pool->m_nextOrphan = nullptr;
+			return t_threadBlockPool.m_pool;
+		}
+	}
+
+	void* memory = malloc( sizeof( ThreadBlockPool ) );
+	GUARANTEE_OR_DIE( memory != nullptr, "Failed to allocate a thread block pool" );
+	t_threadBlockPool.m_pool = new( memory ) ThreadBlockPool();
+	return t_threadBlockPool.m_pool;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Chunks must be aligned to their own size. VirtualAlloc's 64KB granularity gives that for free, where
+// _aligned_malloc would pad every chunk by nearly another chunk.
+//---------------------------------------------------------------------------------------------------------
+static void* AllocateChunkMemory()
+{
+	static_assert( BLOCK_POOL_CHUNK_SIZE == 64 * 1024, "Chunks rely on the 64KB VirtualAlloc granularity for alignment" );
+#if defined( PLATFORM_WINDOWS )
+	return VirtualAlloc( nullptr, BLOCK_POOL_CHUNK_SIZE, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE );
+#else
+	return aligned_alloc( BLOCK_POOL_CHUNK_SIZE, BLOCK_POOL_CHUNK_SIZE );
+#endif
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static uint GetSizeClassForBytes( size_t byteCount )
+{
+	// 16 byte steps up to 64, then the classes grow by half
+	if( byteCount <= 64 )
+		return byteCount == 0 ? 0 : static_cast<uint>( ( byteCount - 1 ) / BLOCK_POOL_GRANULARITY );
+
+	uint sizeClass = 4;
+	while( s_sizeClassBytes[ sizeClass ] < byteCount )
+	{
+		++sizeClass;
+	}
+	return sizeClass;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static PoolChunkHeader* GetChunkHeader( void* memory )
+{
+	return reinterpret_cast<PoolChunkHeader*>( reinterpret_cast<uintptr_t>( memory ) & ~( static_cast<uintptr_t>( BLOCK_POOL_CHUNK_SIZE ) - 1 ) );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void* ThreadBlockPool::Allocate( uint sizeClass )
+{
+	PoolFreeBlock* block = m_freeLists[ sizeClass ];
+	if( block == nullptr )
+	{
+		// Reclaim everything other threads have handed back in one swap
+		block = m_remoteFreeLists[ sizeClass ].exchange( nullptr, std::memory_order_acquire );
+	}
+
+	if( block != nullptr )
+	{
+		m_freeLists[ sizeClass ] = block->m_next;
+		return block;
+	}
+
+	size_t blockSize = s_sizeClassBytes[ sizeClass ];
+	if( m_bumpCursors[ sizeClass ] == nullptr || m_bumpCursors[ sizeClass ] + blockSize > m_bumpEnds[ sizeClass ] )
+	{
+		CreateChunk( sizeClass );
+	}
+
+	void* memory = m_bumpCursors[ sizeClass ];
+	m_bumpCursors[ sizeClass ] += blockSize;
+	return memory;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void ThreadBlockPool::FreeLocal( void* memory, uint sizeClass )
+{
+	PoolFreeBlock* block = static_cast<PoolFreeBlock*>( memory );
+	block->m_next = m_freeLists[ sizeClass ];
+	m_freeLists[ sizeClass ] = block;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Multiple producers push, only the owner takes - and it takes the whole list - so there is no ABA hazard
+void ThreadBlockPool::FreeRemote( void* memory, uint sizeClass )
+{
+	PoolFreeBlock* block = static_cast<PoolFreeBlock*>( memory );
+	std::atomic<PoolFreeBlock*>& remoteList = m_remoteFreeLists[ sizeClass ];
+
+	block->m_next = remoteList.load( std::memory_order_relaxed );
+	while( !remoteList.compare_exchange_weak( block->m_next, block, std::memory_order_release, std::memory_order_relaxed ) ) {}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void ThreadBlockPool::CreateChunk( uint sizeClass )
+{
+	void* chunkMemory = AllocateChunkMemory();
+	GUARANTEE_OR_DIE( chunkMemory != nullptr, "Failed to allocate a block pool chunk" );
+	MemoryTrackerRecordAllocation( BLOCK_POOL_CHUNK_SIZE, "Block Pool Chunk" );
+
+	PoolChunkHeader* header = new( chunkMemory ) PoolChunkHeader();
+	header->m_owner = this;
+	header->m_sizeClass = sizeClass;
+
+	unsigned char* chunkBytes = static_cast<unsigned char*>( chunkMemory );
+	m_bumpCursors[ sizeClass ] = chunkBytes + BLOCK_POOL_CHUNK_HEADER_SIZE;
+	m_bumpEnds[ sizeClass ] = chunkBytes + BLOCK_POOL_CHUNK_SIZE;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void* PoolAllocate( size_t byteCount )
+{
+	if( byteCount > BLOCK_POOL_MAX_BLOCK_SIZE )
+		return ::operator new( byteCount );
+
+	return GetThreadBlockPool()->Allocate( GetSizeClassForBytes( byteCount ) );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void PoolFree( void* memory, size_t byteCount )
+{
+	if( memory == nullptr )
+		return;
+
+	if( byteCount > BLOCK_POOL_MAX_BLOCK_SIZE )
+	{
+		::operator delete( memory );
+		return;
+	}
+
+	PoolChunkHeader* header = GetChunkHeader( memory );
+	ASSERT_OR_DIE( header->m_sizeClass == GetSizeClassForBytes( byteCount ), "PoolFree called with a different size than PoolAllocate" );
+
+	ThreadBlockPool* threadPool = t_threadBlockPool.m_pool;
+	if( header->m_owner == threadPool )
+	{
+		threadPool->FreeLocal( memory, header->m_sizeClass );
+	}
+	else
+	{
+		header->m_owner->FreeRemote( memory, header->m_sizeClass );
+	}
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+#include <stddef.h>
+
+
+//---------------------------------------------------------------------------------------------------------
+// Per-thread fixed-size block pools for small, short-lived objects. Requests are rounded up to one of a
+// handful of size classes and served from 64KB chunks owned by the allocating thread, so the common path
+// is a free-list pop with no locking. A block freed on a different thread is handed back to its owner
+// through a lock-free list the owner drains the next time it runs out. Anything larger than
+// BLOCK_POOL_MAX_BLOCK_SIZE falls through to the global heap.
+//
+// Frees must pass the same byte count that was allocated.
+//---------------------------------------------------------------------------------------------------------
+constexpr size_t BLOCK_POOL_MAX_BLOCK_SIZE = 512;
+
+
+//---------------------------------------------------------------------------------------------------------
+void*	PoolAllocate( size_t byteCount );
+void	PoolFree( void* memory, size_t byteCount );
+
+
+//---------------------------------------------------------------------------------------------------------
+// Derive from this to make new/delete of a class go through the block pools. Polymorphic classes need a
+// virtual destructor so delete passes the size of the most derived type.
+//---------------------------------------------------------------------------------------------------------
+struct PoolAllocated
+{
+	static void* operator new( size_t byteCount )						{ return PoolAllocate( byteCount ); }
+	static void operator delete( void* memory, size_t byteCount )		{ PoolFree( memory, byteCount ); }
+};
\ No newline at end of file
@@ -1,10 +1,97 @@
 #include "Engine/Core/Clock.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/Time.hpp"
+#include "Engine/Core/Profiler.hpp"
+#include "Engine/Core/MemoryTracker.hpp"
+#include "Engine/Core/LinearArena.hpp"
+#include "Engine/Core/Timer.hpp"
+#include "Engine/Core/HandlePool.hpp"
+#include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/EventSystem.hpp"
+#include "Engine/Core/NamedProperties.hpp"
 #include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
 
 
 STATIC Clock Clock::s_masterClock( nullptr );
+static double s_fixedFrameSeconds = 0.0;
+
+
+//---------------------------------------------------------------------------------------------------------
+static void CountTimerFire( void* userData )
+{
+	uint* fireCount = reinterpret_cast<uint*>( userData );
+	( *fireCount )++;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Runs the same set of timers (half one-shot, half repeating) through polled Timers and through a clock's
+// timer wheel at a fixed 60hz so the per-frame cost of each can be compared
+//---------------------------------------------------------------------------------------------------------
+static void timer_benchmark( EventArgs* args )
+{
+	uint timerCount = static_cast<uint>( args->GetValue( "count", 100000 ) );
+	uint frameCount = static_cast<uint>( args->GetValue( "frames", 600 ) );
+	double const frameSeconds = 1.0 / 60.0;
+
+	RandomNumberGenerator rng;
+	std::vector<float> durations;
+	durations.reserve( timerCount );
+	for( uint timerIndex = 0; timerIndex < timerCount; ++timerIndex )
+	{
+		durations.push_back( rng.RollRandomFloatInRange( 0.05f, 30.f ) );
+	}
+
+	Clock pollingClock( nullptr );
+	std::vector<Timer> polledTimers( timerCount );
+	for( uint timerIndex = 0; timerIndex < timerCount; ++timerIndex )
+	{
+		polledTimers[ timerIndex ].SetSeconds( &pollingClock, durations[ timerIndex ] );
+	}
+
+	uint polledFireCount = 0;
+	double pollingStartSeconds = GetCurrentTimeSeconds();
+	for( uint frameIndex = 0; frameIndex < frameCount; ++frameIndex )
+	{
+		pollingClock.Update( frameSeconds );
+		for( uint timerIndex = 0; timerIndex < timerCount; ++timerIndex )
+		{
+			Timer& timer = polledTimers[ timerIndex ];
+			if( ( timerIndex & 1 ) == 0 )
+			{
+				if( timer.m_durationSeconds >= 0.0 && timer.HasElapsed() )
+				{
+					timer.Stop();
+					polledFireCount++;
+				}
+			}
+			else
+			{
+				polledFireCount += timer.CheckAndDecrement() ? 1 : 0;
+			}
+		}
+	}
+	double pollingSeconds = GetCurrentTimeSeconds() - pollingStartSeconds;
+
+	Clock wheelClock( nullptr );
+	uint wheelFireCount = 0;
+	for( uint timerIndex = 0; timerIndex < timerCount; ++timerIndex )
+	{
+		wheelClock.ScheduleCallback( durations[ timerIndex ], CountTimerFire, &wheelFireCount, ( timerIndex & 1 ) != 0 );
+	}
+
+	double wheelStartSeconds = GetCurrentTimeSeconds();
+	for( uint frameIndex = 0; frameIndex < frameCount; ++frameIndex )
+	{
+		wheelClock.Update( frameSeconds );
+	}
+	double wheelSeconds = GetCurrentTimeSeconds() - wheelStartSeconds;
+
+	g_theConsole->PrintString( Rgba8::WHITE, "Timer benchmark: %u timers, %u frames", timerCount, frameCount );
+	g_theConsole->PrintString( Rgba8::WHITE, "  Polled: %.4fms/frame, %u fires", ( pollingSeconds * 1000.0 ) / frameCount, polledFireCount );
+	g_theConsole->PrintString( Rgba8::WHITE, "  Wheel:  %.4fms/frame, %u fires", ( wheelSeconds * 1000.0 ) / frameCount, wheelFireCount );
+}
 
 
 //---------------------------------------------------------------------------------------------------------
@@ -50,25 +137,38 @@ Clock::~Clock()
 	{
 		m_parentClock->RemoveChild( this );
 	}
+
+	delete m_timerWheel;
+	m_timerWheel = nullptr;
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 void Clock::Update( double deltaSeconds )
 {
+	// A paused clock holds its whole subtree still, so once every descendant has been given a zero delta
+	// there is nothing to walk until it resumes
 	if( IsPaused() )
 	{
-		deltaSeconds = 0.0;
-	}
-	else
-	{
-		Clamp( deltaSeconds, m_minFrameTime, m_maxFrameTime );
-		deltaSeconds *= m_scale;
+		if( !m_isSubtreeFrozen )
+		{
+			FreezeSubtree();
+		}
+		return;
 	}
 
+	m_isSubtreeFrozen = false;
+	Clamp( deltaSeconds, m_minFrameTime, m_maxFrameTime );
+	deltaSeconds *= m_scale;
+
 	m_lastDeltaSeconds = deltaSeconds;
 	m_totalTimeSeconds += deltaSeconds;
 
+	if( m_timerWheel != nullptr )
+	{
+		m_timerWheel->AdvanceTo( m_totalTimeSeconds );
+	}
+
 	for( int childrenClockIndex = 0; childrenClockIndex < m_childrenClocks.size(); ++childrenClockIndex )
 	{
 		Clock* currentChildClock = m_childrenClocks[ childrenClockIndex ];
@@ -85,6 +185,11 @@ void Clock::Reset()
 {
 	m_lastDeltaSeconds = 0.0;
 	m_totalTimeSeconds = 0.0;
+
+	if( m_timerWheel != nullptr )
+	{
+		m_timerWheel->Rebase( m_totalTimeSeconds );
+	}
 }
 
 
@@ -150,10 +255,12 @@ void Clock::AddChild( Clock* newChild )
 		if( m_childrenClocks[ childClockIndex ] == nullptr )
 		{
 			m_childrenClocks[ childClockIndex ] = newChild;
+			m_isSubtreeFrozen = false;
 			return;
 		}
 	}
 	m_childrenClocks.push_back( newChild );
+	m_isSubtreeFrozen = false;
 }
 
 
@@ -171,6 +278,81 @@ void Clock::RemoveChild( Clock* childToRemove )
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+TimerHandle Clock::ScheduleCallback( double delaySeconds, TimerCallbackFunctionPtrType callback, void* userData, bool isRepeating )
+{
+	double periodSeconds = isRepeating ? delaySeconds : 0.0;
+	GUARANTEE_OR_DIE( !isRepeating || periodSeconds > 0.0, "Repeating clock timers need a delay greater than zero" );
+
+	return GetOrCreateTimerWheel()->Schedule( m_totalTimeSeconds + delaySeconds, callback, userData, periodSeconds );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+TimerHandle Clock::ScheduleFlag( double delaySeconds, bool* flagToSet )
+{
+	return GetOrCreateTimerWheel()->ScheduleFlag( m_totalTimeSeconds + delaySeconds, flagToSet );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void Clock::CancelTimer( TimerHandle handle )
+{
+	if( m_timerWheel != nullptr )
+	{
+		m_timerWheel->Cancel( handle );
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool Clock::IsTimerScheduled( TimerHandle handle ) const
+{
+	if( m_timerWheel == nullptr )
+		return false;
+
+	return m_timerWheel->IsScheduled( handle );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+double Clock::GetTimerSecondsRemaining( TimerHandle handle ) const
+{
+	if( !IsTimerScheduled( handle ) )
+		return 0.0;
+
+	return m_timerWheel->GetDeadlineSeconds( handle ) - m_totalTimeSeconds;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void Clock::FreezeSubtree()
+{
+	m_lastDeltaSeconds = 0.0;
+	m_isSubtreeFrozen = true;
+
+	for( size_t childrenClockIndex = 0; childrenClockIndex < m_childrenClocks.size(); ++childrenClockIndex )
+	{
+		Clock* currentChildClock = m_childrenClocks[ childrenClockIndex ];
+		if( currentChildClock != nullptr )
+		{
+			currentChildClock->FreezeSubtree();
+		}
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+TimerWheel* Clock::GetOrCreateTimerWheel()
+{
+	if( m_timerWheel == nullptr )
+	{
+		m_timerWheel = new TimerWheel( m_totalTimeSeconds );
+	}
+	return m_timerWheel;
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 bool Clock::HasParent() const
 {
@@ -197,15 +379,55 @@ STATIC void Clock::SystemShutdown()
 //---------------------------------------------------------------------------------------------------------
 STATIC void Clock::BeginFrame()
 {
+	// This is the boundary between frames. Apps that don't drive the master clock need to call
+	// ProfilerBeginFrame and MemoryTrackerBeginFrame themselves
+	ProfilerBeginFrame();
+	MemoryTrackerBeginFrame();
+
+	static bool s_areCommandsSubscribed = false;
+	if( !s_areCommandsSubscribed && g_theEventSystem != nullptr )
+	{
+		g_theEventSystem->SubscribeEventCallbackFunction( "timer_benchmark", timer_benchmark );
+		SubscribeHandlePoolCommands();
+		s_areCommandsSubscribed = true;
+	}
+
 	static double timeLastFrameStarted = GetCurrentTimeSeconds();
 	double timeThisFrameStarted = GetCurrentTimeSeconds();
 	double deltaSeconds = timeThisFrameStarted - timeLastFrameStarted;
 	timeLastFrameStarted = timeThisFrameStarted;
 
+	if( s_fixedFrameSeconds > 0.0 )
+	{
+		deltaSeconds = s_fixedFrameSeconds;
+	}
+
 	s_masterClock.Update( deltaSeconds );
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+// Last thing in App::EndFrame, once nothing else this frame can still be using frame memory
+STATIC void Clock::EndFrame()
+{
+	ResetFrameArena();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+STATIC void Clock::SetFixedFrameSeconds( double fixedFrameSeconds )
+{
+	s_fixedFrameSeconds = fixedFrameSeconds;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+STATIC double Clock::GetFixedFrameSeconds()
+{
+	return s_fixedFrameSeconds;
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 STATIC Clock* Clock::GetMaster()
 {
@@ -1,4 +1,5 @@
 #pragma once
+#include "Engine/Core/TimerWheel.hpp"
 #include <vector>
 
 
@@ -11,6 +12,8 @@ public:
 	Clock();
 	Clock( Clock* parent );
 	~Clock();
+	Clock( Clock const& copy ) = delete;
+	Clock& operator=( Clock const& copy ) = delete;
 
 	void Update( double deltaSeconds );
 	void Reset();
@@ -27,6 +30,13 @@ public:
 	void	AddChild( Clock* newChild );
 	void	RemoveChild( Clock* childToRemove );
 
+	TimerHandle	ScheduleCallback( double delaySeconds, TimerCallbackFunctionPtrType callback, void* userData = nullptr, bool isRepeating = false );
+	TimerHandle	ScheduleFlag( double delaySeconds, bool* flagToSet );
+	void		CancelTimer( TimerHandle handle );
+	bool		IsTimerScheduled( TimerHandle handle ) const;
+	double		GetTimerSecondsRemaining( TimerHandle handle ) const;
+
+public:
 	bool	HasParent() const;
 	bool	IsPaused() const				{ return m_isPaused; } 
 	double	GetScale() const				{ return m_scale; }
@@ -37,9 +47,19 @@ public:
 	static void SystemStartUp();
 	static void SystemShutdown();
 	static void BeginFrame();
+	static void EndFrame();
+
+	// Non-zero steps the master clock by exactly this much each frame instead of by wall time, so a replayed
+	// session advances the same way on every machine. Zero goes back to wall time.
+	static void		SetFixedFrameSeconds( double fixedFrameSeconds );
+	static double	GetFixedFrameSeconds();
 
 	static Clock* GetMaster();
 
+private:
+	void FreezeSubtree();
+	TimerWheel* GetOrCreateTimerWheel();
+
 private:
 	double m_scale = 1.f;
 	double m_totalTimeSeconds = 0.f;
@@ -49,6 +69,9 @@ private:
 	double m_maxFrameTime = 0.1;
 	
 	bool m_isPaused = false;
+	bool m_isSubtreeFrozen = false;
+
+	TimerWheel* m_timerWheel = nullptr;
 
 	Clock* m_parentClock = nullptr;
 	std::vector<Clock*> m_childrenClocks;
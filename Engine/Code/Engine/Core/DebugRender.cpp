@@ -1,5 +1,9 @@
 #include "Engine/Core/DebugRender.hpp"
-#include "Engine/Core/Timer.hpp"
+#include "Engine/Platform/Platform.hpp"
+
+// Everything here draws through the D3D11 RenderContext, so headless builds leave the debug renderer out
+#if !defined( ENGINE_HEADLESS )
+#include "Engine/Core/Clock.hpp"
 #include "Engine/Core/DevConsole.hpp"
 #include "Engine/Core/NamedProperties.hpp"
 #include "Engine/Math/Vec2.hpp"
@@ -15,6 +19,7 @@
 #include "Engine/Renderer/RenderContext.hpp"
 #include "Engine/Renderer/MeshUtils.hpp"
 #include "Engine/Renderer/BitmapFont.hpp"
+#include "Engine/Renderer/GPUSubMesh.hpp"
 #include <vector>
 #include <stdarg.h>
 
@@ -80,47 +85,304 @@ static BitmapFont* s_debugRenderFont = nullptr;
 
 
 //---------------------------------------------------------------------------------------------------------
+// Primitives are built into shared scratch arrays, then copied into the batch whose render state they
+// share. Each batch owns one persistent vertex/index stream plus a lifetime table, so drawing a mode is a
+// single draw call no matter how many primitives are alive.
+//---------------------------------------------------------------------------------------------------------
+static std::vector<Vertex_PCU>		s_scratchVerticies;
+static std::vector<unsigned int>	s_scratchIndicies;
+
+
 //---------------------------------------------------------------------------------------------------------
-class DebugRenderObject
+struct debug_render_primitive_t
 {
 public:
-	bool HasExpired() const { return m_hasExpired; }
-/*	void AddVertsAndIndiciesToArray( std::vector<Vertex_PCU>& verticies, std::vector<unsigned int>& indicies );*/
-	void SetAllVertsColor( const Rgba8& newColor );
-	void SetRenderMode();
-	void Draw();
+	debug_render_primitive_t();
 
 public:
 	Mat44 m_transformMatrix;
 
-	std::vector<Vertex_PCU> m_objectVerticies;
-	std::vector<unsigned int> m_objectIndicies;
+	std::vector<Vertex_PCU>& m_objectVerticies;
+	std::vector<unsigned int>& m_objectIndicies;
 
 	const Texture* m_texture = nullptr;
-	bool m_hasExpired = false;
-	bool m_isMarkedForDestroy = false;
 	bool m_isBillboarded = false;
 	bool m_isWireMesh = false;
 	Rgba8 m_startColor;
 	Rgba8 m_endColor;
-	Timer m_durationTimer;
+	float m_durationSeconds = 0.f;
+	eDebugRenderMode m_renderMode = DEBUG_RENDER_USE_DEPTH;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+debug_render_primitive_t::debug_render_primitive_t()
+	: m_objectVerticies( s_scratchVerticies )
+	, m_objectIndicies( s_scratchIndicies )
+{
+	s_scratchVerticies.clear();
+	s_scratchIndicies.clear();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+struct debug_render_entry_t
+{
+	unsigned int vertexStart		= 0;
+	unsigned int vertexCount		= 0;
+	unsigned int indexStart			= 0;
+	unsigned int indexCount			= 0;
+	unsigned int localVertexStart	= 0;	// billboards only - verts relative to billboardOrigin
+
+	double startSeconds	= 0.0;
+	double endSeconds	= 0.0;
+	Rgba8 startColor;
+	Rgba8 endColor;
+	Rgba8 currentColor;
+	Vec3 billboardOrigin;
+	bool isMarkedForDestroy = false;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+static bool IsSameColor( Rgba8 const& colorA, Rgba8 const& colorB )
+{
+	return colorA.r == colorB.r && colorA.g == colorB.g && colorA.b == colorB.b && colorA.a == colorB.a;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Old x-ray look for the hidden pass: each channel darkened by a fixed amount, not scaled
+//---------------------------------------------------------------------------------------------------------
+static Rgba8 GetXRayHiddenColor( Rgba8 const& color )
+{
+	constexpr int xRaySubtractValue = 70;
+
+	Rgba8 hiddenColor = color;
+	hiddenColor.r = static_cast<unsigned char>( GetClamp( static_cast<int>( color.r ) - xRaySubtractValue, 0, 255 ) );
+	hiddenColor.g = static_cast<unsigned char>( GetClamp( static_cast<int>( color.g ) - xRaySubtractValue, 0, 255 ) );
+	hiddenColor.b = static_cast<unsigned char>( GetClamp( static_cast<int>( color.b ) - xRaySubtractValue, 0, 255 ) );
+	return hiddenColor;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Billboards get batches of their own, since they have to be re-posed whenever the camera moves; every
+// other batch only re-uploads when an entry is added, removed or changes colour.
+//---------------------------------------------------------------------------------------------------------
+class DebugRenderBatch
+{
+public:
+	DebugRenderBatch( eDebugRenderMode renderMode, bool isWireMesh, bool isBillboarded, const Texture* texture );
+	~DebugRenderBatch();
+
+	bool IsMatch( eDebugRenderMode renderMode, bool isWireMesh, bool isBillboarded, const Texture* texture ) const;
+	bool IsEmpty() const			{ return m_entries.empty(); }
+
+	void AddPrimitive( debug_render_primitive_t const& primitive );
+	void UpdateAndDraw( RenderContext* context, Camera const* camera );
+	void MarkAllForDestroy();
+	void Compact();
+
+private:
+	void UpdateEntries( Camera const* camera, double currentSeconds );
+	void UpdateGPUStreams( RenderContext* context );
+	void SetEntryColor( debug_render_entry_t const& entry, Rgba8 const& color );
+	void SetRenderState( RenderContext* context ) const;
+
+private:
 	eDebugRenderMode m_renderMode = DEBUG_RENDER_USE_DEPTH;
+	bool m_isWireMesh = false;
+	bool m_isBillboarded = false;
+	const Texture* m_texture = nullptr;
+
+	std::vector<debug_render_entry_t> m_entries;
+	std::vector<Vertex_PCU> m_verticies;
+	std::vector<unsigned int> m_indicies;
+	std::vector<Vertex_PCU> m_localVerticies;		// billboard batches only
+	std::vector<Vertex_PCU> m_hiddenVerticies;		// x-ray batches only, scratch for the hidden pass
+
+	GPUSubMesh* m_gpuStream = nullptr;
+	GPUSubMesh* m_hiddenGpuStream = nullptr;
+	bool m_isGPUStreamDirty = true;
+	bool m_hasEntriesToDestroy = false;
+	Vec3 m_lastBillboardCameraPosition;
 };
 
 
 //---------------------------------------------------------------------------------------------------------
-void DebugRenderObject::Draw()
+DebugRenderBatch::DebugRenderBatch( eDebugRenderMode renderMode, bool isWireMesh, bool isBillboarded, const Texture* texture )
+	: m_renderMode( renderMode )
+	, m_isWireMesh( isWireMesh )
+	, m_isBillboarded( isBillboarded )
+	, m_texture( texture )
+{
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+DebugRenderBatch::~DebugRenderBatch()
 {
-	m_hasExpired = m_durationTimer.HasElapsed();
+	delete m_gpuStream;
+	m_gpuStream = nullptr;
 
+	delete m_hiddenGpuStream;
+	m_hiddenGpuStream = nullptr;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool DebugRenderBatch::IsMatch( eDebugRenderMode renderMode, bool isWireMesh, bool isBillboarded, const Texture* texture ) const
+{
+	return m_renderMode == renderMode && m_isWireMesh == isWireMesh && m_isBillboarded == isBillboarded && m_texture == texture;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void DebugRenderBatch::AddPrimitive( debug_render_primitive_t const& primitive )
+{
+	std::vector<Vertex_PCU> const& primitiveVerticies = primitive.m_objectVerticies;
+	std::vector<unsigned int> const& primitiveIndicies = primitive.m_objectIndicies;
+	if( primitiveVerticies.empty() )
+		return;
+
+	debug_render_entry_t entry;
+	entry.vertexStart		= static_cast<unsigned int>( m_verticies.size() );
+	entry.vertexCount		= static_cast<unsigned int>( primitiveVerticies.size() );
+	entry.indexStart		= static_cast<unsigned int>( m_indicies.size() );
+	entry.startColor		= primitive.m_startColor;
+	entry.endColor			= primitive.m_endColor;
+	entry.currentColor		= primitive.m_startColor;
+	entry.startSeconds		= Clock::GetMaster()->GetTotalElapsedSeconds();
+	entry.endSeconds		= entry.startSeconds + primitive.m_durationSeconds;
+
+	// Everything but billboards is baked into world/screen space once, here
 	if( m_isBillboarded )
 	{
-		Vec3 cameraPosition = s_debugRenderSystem->GetCamera()->GetPosition();
-		m_transformMatrix = Mat44::LookAt( m_transformMatrix.GetTranslation3D(), cameraPosition );
+		entry.billboardOrigin = primitive.m_transformMatrix.GetTranslation3D();
+		entry.localVertexStart = static_cast<unsigned int>( m_localVerticies.size() );
+		m_localVerticies.insert( m_localVerticies.end(), primitiveVerticies.begin(), primitiveVerticies.end() );
+	}
+
+	for( unsigned int vertIndex = 0; vertIndex < entry.vertexCount; ++vertIndex )
+	{
+		Vertex_PCU vertex = primitiveVerticies[ vertIndex ];
+		vertex.m_position = primitive.m_transformMatrix.TransformPosition3D( vertex.m_position );
+		vertex.m_color = primitive.m_startColor;
+		m_verticies.push_back( vertex );
+	}
+
+	if( primitiveIndicies.empty() )
+	{
+		entry.indexCount = entry.vertexCount;
+		for( unsigned int vertIndex = 0; vertIndex < entry.vertexCount; ++vertIndex )
+		{
+			m_indicies.push_back( entry.vertexStart + vertIndex );
+		}
+	}
+	else
+	{
+		entry.indexCount = static_cast<unsigned int>( primitiveIndicies.size() );
+		for( unsigned int indexIndex = 0; indexIndex < entry.indexCount; ++indexIndex )
+		{
+			m_indicies.push_back( entry.vertexStart + primitiveIndicies[ indexIndex ] );
+		}
 	}
 
-	RenderContext* context = s_debugRenderSystem->GetRenderContext();
+	m_entries.push_back( entry );
+	m_isGPUStreamDirty = true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void DebugRenderBatch::UpdateEntries( Camera const* camera, double currentSeconds )
+{
+	for( int entryIndex = 0; entryIndex < m_entries.size(); ++entryIndex )
+	{
+		debug_render_entry_t& entry = m_entries[ entryIndex ];
+		if( IsSameColor( entry.startColor, entry.endColor ) )
+			continue;
+
+		double durationSeconds = entry.endSeconds - entry.startSeconds;
+		float fractionComplete = ( durationSeconds == 0.0 ) ? 1.f : static_cast<float>( ( currentSeconds - entry.startSeconds ) / durationSeconds );
+		Rgba8 newColor = Rgba8Lerp( entry.startColor, entry.endColor, fractionComplete );
+		if( !IsSameColor( newColor, entry.currentColor ) )
+		{
+			entry.currentColor = newColor;
+			SetEntryColor( entry, newColor );
+		}
+	}
+
+	if( !m_isBillboarded )
+		return;
+
+	// Re-posed only when the camera has moved or the batch changed since the last pose
+	Vec3 cameraPosition = camera->GetPosition();
+	if( !m_isGPUStreamDirty && cameraPosition == m_lastBillboardCameraPosition )
+		return;
+
+	m_lastBillboardCameraPosition = cameraPosition;
+	for( int entryIndex = 0; entryIndex < m_entries.size(); ++entryIndex )
+	{
+		debug_render_entry_t const& entry = m_entries[ entryIndex ];
+		Mat44 billboardMatrix = Mat44::LookAt( entry.billboardOrigin, cameraPosition );
+		for( unsigned int vertIndex = 0; vertIndex < entry.vertexCount; ++vertIndex )
+		{
+			Vec3 const& localPosition = m_localVerticies[ entry.localVertexStart + vertIndex ].m_position;
+			m_verticies[ entry.vertexStart + vertIndex ].m_position = billboardMatrix.TransformPosition3D( localPosition );
+		}
+	}
+	m_isGPUStreamDirty = true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void DebugRenderBatch::UpdateGPUStreams( RenderContext* context )
+{
+	if( !m_isGPUStreamDirty )
+		return;
 
+	if( m_gpuStream == nullptr )
+	{
+		m_gpuStream = new GPUSubMesh( context );
+	}
+	m_gpuStream->UpdateVerticies( static_cast<unsigned int>( m_verticies.size() ), &m_verticies[0] );
+	m_gpuStream->UpdateIndicies( static_cast<unsigned int>( m_indicies.size() ), &m_indicies[0] );
+
+	if( m_renderMode == DEBUG_RENDER_XRAY )
+	{
+		if( m_hiddenGpuStream == nullptr )
+		{
+			m_hiddenGpuStream = new GPUSubMesh( context );
+		}
+
+		m_hiddenVerticies = m_verticies;
+		for( int vertIndex = 0; vertIndex < m_hiddenVerticies.size(); ++vertIndex )
+		{
+			m_hiddenVerticies[ vertIndex ].m_color = GetXRayHiddenColor( m_hiddenVerticies[ vertIndex ].m_color );
+		}
+		m_hiddenGpuStream->UpdateVerticies( static_cast<unsigned int>( m_hiddenVerticies.size() ), &m_hiddenVerticies[0] );
+		m_hiddenGpuStream->UpdateIndicies( static_cast<unsigned int>( m_indicies.size() ), &m_indicies[0] );
+	}
+
+	m_isGPUStreamDirty = false;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void DebugRenderBatch::SetEntryColor( debug_render_entry_t const& entry, Rgba8 const& color )
+{
+	for( unsigned int vertIndex = 0; vertIndex < entry.vertexCount; ++vertIndex )
+	{
+		m_verticies[ entry.vertexStart + vertIndex ].m_color = color;
+	}
+	m_isGPUStreamDirty = true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void DebugRenderBatch::SetRenderState( RenderContext* context ) const
+{
 	context->BindSampler( context->m_samplerPoint );
 	context->SetBlendMode( BlendMode::ALPHA );
 	context->SetFrontFaceWindOrder( true );
@@ -136,33 +398,22 @@ void DebugRenderObject::Draw()
 		context->SetFillMode( FILL_MODE_SOLID );
 	}
 
- 	context->SetModelUBO( m_transformMatrix );
- 	context->BindTexture( m_texture );
- 	context->BindShader( (Shader*)nullptr );
-
-	SetRenderMode();
-
-	Rgba8 newColor = Rgba8Lerp( m_startColor, m_endColor, m_durationTimer.GetFractionComplete() );
-	SetAllVertsColor( newColor );
-
-	context->DrawIndexedVertexArray( m_objectVerticies, m_objectIndicies );
+	context->BindTexture( m_texture );
+	context->BindShader( (Shader*)nullptr );
 }
 
 
 //---------------------------------------------------------------------------------------------------------
-void DebugRenderObject::SetAllVertsColor( const Rgba8& newColor )
+void DebugRenderBatch::UpdateAndDraw( RenderContext* context, Camera const* camera )
 {
-	for (int objectVertIndex = 0; objectVertIndex < m_objectVerticies.size(); ++objectVertIndex)
-	{
-		m_objectVerticies[ objectVertIndex ].m_color = newColor;
-	}
-}
+	if( m_entries.empty() )
+		return;
 
+	double currentSeconds = Clock::GetMaster()->GetTotalElapsedSeconds();
+	UpdateEntries( camera, currentSeconds );
+	UpdateGPUStreams( context );
 
-//---------------------------------------------------------------------------------------------------------
-void DebugRenderObject::SetRenderMode()
-{
-	RenderContext* context = s_debugRenderSystem->GetRenderContext();
+	SetRenderState( context );
 
 	switch( m_renderMode )
 	{
@@ -173,42 +424,141 @@ void DebugRenderObject::SetRenderMode()
 		context->SetDepthTest( COMPARE_FUNC_LEQUAL, true );
 		break;
 	case DEBUG_RENDER_XRAY:
-	{
-		float xRaySubtractValue = 70.f;
+		context->SetModelUBO( Mat44::IDENTITY );
 		context->SetDepthTest( COMPARE_FUNC_GEQUAL, false );
-		Rgba8 xRayColor = Rgba8Lerp( m_startColor, m_endColor, m_durationTimer.GetFractionComplete() );
-		xRayColor.r = static_cast<unsigned char>( GetClamp(static_cast<float>( xRayColor.r ) - xRaySubtractValue, 0.0f, 255.0f ) );
-		xRayColor.g = static_cast<unsigned char>( GetClamp(static_cast<float>( xRayColor.g ) - xRaySubtractValue, 0.0f, 255.0f ) );
-		xRayColor.b = static_cast<unsigned char>( GetClamp(static_cast<float>( xRayColor.b ) - xRaySubtractValue, 0.0f, 255.0f ) );
-		SetAllVertsColor( xRayColor );
-		context->DrawIndexedVertexArray( m_objectVerticies, m_objectIndicies );
+		context->DrawSubMesh( m_hiddenGpuStream );
 		context->SetDepthTest( COMPARE_FUNC_LEQUAL, true );
 		break;
-	}
 	default:
 		break;
 	}
+
+	context->SetModelUBO( Mat44::IDENTITY );
+	context->DrawSubMesh( m_gpuStream );
+
+	for( int entryIndex = 0; entryIndex < m_entries.size(); ++entryIndex )
+	{
+		debug_render_entry_t& entry = m_entries[ entryIndex ];
+		if( currentSeconds >= entry.endSeconds )
+		{
+			entry.isMarkedForDestroy = true;
+			m_hasEntriesToDestroy = true;
+		}
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void DebugRenderBatch::MarkAllForDestroy()
+{
+	for( int entryIndex = 0; entryIndex < m_entries.size(); ++entryIndex )
+	{
+		m_entries[ entryIndex ].isMarkedForDestroy = true;
+	}
+	m_hasEntriesToDestroy = !m_entries.empty();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Slides every surviving entry down over the dead ones, keeping stream order so indices only need rebasing
+//---------------------------------------------------------------------------------------------------------
+void DebugRenderBatch::Compact()
+{
+	if( !m_hasEntriesToDestroy )
+		return;
+
+	unsigned int writeEntryIndex = 0;
+	unsigned int writeVertexIndex = 0;
+	unsigned int writeIndexIndex = 0;
+	unsigned int writeLocalVertexIndex = 0;
+
+	for( int readEntryIndex = 0; readEntryIndex < m_entries.size(); ++readEntryIndex )
+	{
+		debug_render_entry_t entry = m_entries[ readEntryIndex ];
+		if( entry.isMarkedForDestroy )
+			continue;
+
+		if( entry.vertexStart != writeVertexIndex )
+		{
+			unsigned int vertexShift = entry.vertexStart - writeVertexIndex;
+			for( unsigned int indexIndex = 0; indexIndex < entry.indexCount; ++indexIndex )
+			{
+				m_indicies[ writeIndexIndex + indexIndex ] = m_indicies[ entry.indexStart + indexIndex ] - vertexShift;
+			}
+			for( unsigned int vertIndex = 0; vertIndex < entry.vertexCount; ++vertIndex )
+			{
+				m_verticies[ writeVertexIndex + vertIndex ] = m_verticies[ entry.vertexStart + vertIndex ];
+			}
+		}
+
+		if( m_isBillboarded && entry.localVertexStart != writeLocalVertexIndex )
+		{
+			for( unsigned int vertIndex = 0; vertIndex < entry.vertexCount; ++vertIndex )
+			{
+				m_localVerticies[ writeLocalVertexIndex + vertIndex ] = m_localVerticies[ entry.localVertexStart + vertIndex ];
+			}
+		}
+
+		entry.vertexStart = writeVertexIndex;
+		entry.indexStart = writeIndexIndex;
+		writeVertexIndex += entry.vertexCount;
+		writeIndexIndex += entry.indexCount;
+		if( m_isBillboarded )
+		{
+			entry.localVertexStart = writeLocalVertexIndex;
+			writeLocalVertexIndex += entry.vertexCount;
+		}
+
+		m_entries[ writeEntryIndex ] = entry;
+		++writeEntryIndex;
+	}
+
+	m_entries.resize( writeEntryIndex );
+	m_verticies.resize( writeVertexIndex );
+	m_indicies.resize( writeIndexIndex );
+	m_localVerticies.resize( writeLocalVertexIndex );
+
+	m_hasEntriesToDestroy = false;
+	m_isGPUStreamDirty = true;
 }
+
+
 //---------------------------------------------------------------------------------------------------------
 //---------------------------------------------------------------------------------------------------------
 
 
-static std::vector<DebugRenderObject*> s_debugRenderWorldObjects;
-static std::vector<DebugRenderObject*> s_debugRenderScreenObjects;
+static std::vector<DebugRenderBatch*> s_debugRenderWorldBatches;
+static std::vector<DebugRenderBatch*> s_debugRenderScreenBatches;
 
 
 //---------------------------------------------------------------------------------------------------------
-void AppendDebugRenderObjectToVector( std::vector<DebugRenderObject*>& vectorToAppendTo, DebugRenderObject* objectToAppend )
+void SubmitDebugRenderPrimitive( std::vector<DebugRenderBatch*>& batches, debug_render_primitive_t const& primitive )
 {
-	for( int objectIndex = 0; objectIndex < vectorToAppendTo.size(); ++objectIndex )
+	for( int batchIndex = 0; batchIndex < batches.size(); ++batchIndex )
 	{
-		if( vectorToAppendTo[ objectIndex ] == nullptr )
+		DebugRenderBatch* batch = batches[ batchIndex ];
+		if( batch->IsMatch( primitive.m_renderMode, primitive.m_isWireMesh, primitive.m_isBillboarded, primitive.m_texture ) )
 		{
-			vectorToAppendTo[ objectIndex ] = objectToAppend;
+			batch->AddPrimitive( primitive );
 			return;
 		}
 	}
-	vectorToAppendTo.push_back( objectToAppend );
+
+	DebugRenderBatch* newBatch = new DebugRenderBatch( primitive.m_renderMode, primitive.m_isWireMesh, primitive.m_isBillboarded, primitive.m_texture );
+	newBatch->AddPrimitive( primitive );
+	batches.push_back( newBatch );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void DeleteDebugRenderBatches( std::vector<DebugRenderBatch*>& batches )
+{
+	for( int batchIndex = 0; batchIndex < batches.size(); ++batchIndex )
+	{
+		delete batches[ batchIndex ];
+		batches[ batchIndex ] = nullptr;
+	}
+	batches.clear();
 }
 
 
@@ -435,6 +785,9 @@ void DebugRenderSystemStartup( RenderContext* context )
 //---------------------------------------------------------------------------------------------------------
 void DebugRenderSystemShutdown()
 {
+	DeleteDebugRenderBatches( s_debugRenderWorldBatches );
+	DeleteDebugRenderBatches( s_debugRenderScreenBatches );
+
 	delete s_debugRenderSystem;
 	s_debugRenderSystem = nullptr;
 }
@@ -457,20 +810,14 @@ void DisableDebugRendering()
 //---------------------------------------------------------------------------------------------------------
 void ClearDebugRendering()
 {
-	for( int objectIndex = 0; objectIndex < s_debugRenderWorldObjects.size(); ++objectIndex )
+	for( int batchIndex = 0; batchIndex < s_debugRenderWorldBatches.size(); ++batchIndex )
 	{
-		if( s_debugRenderWorldObjects[ objectIndex ] != nullptr )
-		{
-			s_debugRenderWorldObjects[ objectIndex ]->m_isMarkedForDestroy = true;
-		}
+		s_debugRenderWorldBatches[ batchIndex ]->MarkAllForDestroy();
 	}
 
-	for (int objectIndex = 0; objectIndex < s_debugRenderScreenObjects.size(); ++objectIndex)
+	for( int batchIndex = 0; batchIndex < s_debugRenderScreenBatches.size(); ++batchIndex )
 	{
-		if( s_debugRenderScreenObjects[ objectIndex ] != nullptr )
-		{
-			s_debugRenderScreenObjects[ objectIndex ]->m_isMarkedForDestroy = true;
-		}
+		s_debugRenderScreenBatches[ batchIndex ]->MarkAllForDestroy();
 	}
 }
 
@@ -514,17 +861,9 @@ void DebugRenderWorldToCamera( Camera* cam )
 	s_debugRenderSystem->SetCamera( debugCamera );
 
 	context->BeginCamera( *debugCamera );
-	for( int objectIndex = 0; objectIndex < s_debugRenderWorldObjects.size(); ++objectIndex )
-	{	
-		DebugRenderObject* object = s_debugRenderWorldObjects[ objectIndex ];
-
-		if( object == nullptr ) continue;
-
-		object->Draw();
-		if( object->HasExpired() )
-		{
-			object->m_isMarkedForDestroy = true;
-		}
+	for( int batchIndex = 0; batchIndex < s_debugRenderWorldBatches.size(); ++batchIndex )
+	{
+		s_debugRenderWorldBatches[ batchIndex ]->UpdateAndDraw( context, debugCamera );
 	}
 
 	context->EndCamera( *debugCamera );
@@ -564,17 +903,9 @@ void DebugRenderScreenTo( Texture* output )
 	s_debugRenderSystem->SetCamera( camera );
 
 	context->BeginCamera( *camera );
-	for( int objectIndex = 0; objectIndex < s_debugRenderScreenObjects.size(); ++objectIndex )
+	for( int batchIndex = 0; batchIndex < s_debugRenderScreenBatches.size(); ++batchIndex )
 	{
-		DebugRenderObject* object = s_debugRenderScreenObjects[ objectIndex ];
-
-		if( object == nullptr ) continue;
-
-		object->Draw();
-		if( object->HasExpired() )
-		{
-			object->m_isMarkedForDestroy = true;
-		}
+		s_debugRenderScreenBatches[ batchIndex ]->UpdateAndDraw( context, camera );
 	}
 
 	context->EndCamera( *camera );
@@ -584,22 +915,14 @@ void DebugRenderScreenTo( Texture* output )
 //---------------------------------------------------------------------------------------------------------
 void DebugRenderEndFrame()
 {
-	for( int objectIndex = 0; objectIndex < s_debugRenderWorldObjects.size(); ++objectIndex )
+	for( int batchIndex = 0; batchIndex < s_debugRenderWorldBatches.size(); ++batchIndex )
 	{
-		if( s_debugRenderWorldObjects[ objectIndex ] != nullptr && s_debugRenderWorldObjects[ objectIndex ]->m_isMarkedForDestroy )
-		{
-			delete s_debugRenderWorldObjects[ objectIndex ];
-			s_debugRenderWorldObjects[ objectIndex ] = nullptr;
-		}
+		s_debugRenderWorldBatches[ batchIndex ]->Compact();
 	}
 
-	for( int objectIndex = 0; objectIndex < s_debugRenderScreenObjects.size(); ++objectIndex )
+	for( int batchIndex = 0; batchIndex < s_debugRenderScreenBatches.size(); ++batchIndex )
 	{
-		if( s_debugRenderScreenObjects[ objectIndex ] != nullptr && s_debugRenderScreenObjects[ objectIndex ]->m_isMarkedForDestroy )
-		{
-			delete s_debugRenderScreenObjects[ objectIndex ];
-			s_debugRenderScreenObjects[ objectIndex ] = nullptr;
-		}
+		s_debugRenderScreenBatches[ batchIndex ]->Compact();
 	}
 }
 
@@ -607,14 +930,14 @@ void DebugRenderEndFrame()
 //---------------------------------------------------------------------------------------------------------
 void DebugAddWorldPoint( Vec3 pos, float size, Rgba8 start_color, Rgba8 end_color, float duration, eDebugRenderMode mode )
 {
-	DebugRenderObject* object = new DebugRenderObject();
+	debug_render_primitive_t object;
 
-	object->m_transformMatrix.SetTranslation3D( pos );
-	object->m_durationTimer.SetSeconds( duration );
-	object->m_startColor = start_color;
-	object->m_endColor = end_color;
-	object->m_isBillboarded = true;
-	object->m_renderMode = mode;
+	object.m_transformMatrix.SetTranslation3D( pos );
+	object.m_durationSeconds = duration;
+	object.m_startColor = start_color;
+	object.m_endColor = end_color;
+	object.m_isBillboarded = true;
+	object.m_renderMode = mode;
 
 
 	float halfSize = size * 0.5f;
@@ -622,10 +945,10 @@ void DebugAddWorldPoint( Vec3 pos, float size, Rgba8 start_color, Rgba8 end_colo
 	Vec3 max = Vec3( halfSize, halfSize, pos.z );
 	AABB2 box = AABB2( min.x, min.y, max.x, max.y );
 
-	AppendVertsForAABB2D( object->m_objectVerticies, box, start_color );
+	AppendVertsForAABB2D( object.m_objectVerticies, box, start_color );
 	//object->m_objectIndicies = { 0, 1, 2, 3, 4, 5 };
 
-	AppendDebugRenderObjectToVector( s_debugRenderWorldObjects, object );
+	SubmitDebugRenderPrimitive( s_debugRenderWorldBatches, object );
 }
 
 
@@ -646,17 +969,17 @@ void DebugAddWorldPoint( Vec3 pos, Rgba8 color, float duration, eDebugRenderMode
 //---------------------------------------------------------------------------------------------------------
 void DebugAddWorldLine( Vec3 p0, Vec3 p1, Rgba8 start_color, Rgba8 end_color, float duration, eDebugRenderMode mode )
 {
-	DebugRenderObject* object = new DebugRenderObject();
+	debug_render_primitive_t object;
 
-	object->m_transformMatrix.SetTranslation3D( p0 );
-	object->m_durationTimer.SetSeconds( duration );
-	object->m_startColor = start_color;
-	object->m_endColor = end_color;
-	object->m_renderMode = mode;
+	object.m_transformMatrix.SetTranslation3D( p0 );
+	object.m_durationSeconds = duration;
+	object.m_startColor = start_color;
+	object.m_endColor = end_color;
+	object.m_renderMode = mode;
 
-	AddCylinderToIndexedVertexArray( object->m_objectVerticies, object->m_objectIndicies, Vec3::ZERO, 0.05f, p1 - p0, 0.05f, start_color, 32 );
+	AddCylinderToIndexedVertexArray( object.m_objectVerticies, object.m_objectIndicies, Vec3::ZERO, 0.05f, p1 - p0, 0.05f, start_color, 32 );
 
-	AppendDebugRenderObjectToVector( s_debugRenderWorldObjects, object );
+	SubmitDebugRenderPrimitive( s_debugRenderWorldBatches, object );
 }
 
 
@@ -670,23 +993,23 @@ void DebugAddWorldLine( Vec3 start, Vec3 end, Rgba8 color, float duration, eDebu
 //---------------------------------------------------------------------------------------------------------
 void DebugAddWorldArrow( Vec3 p0, Vec3 p1, Rgba8 start_color, Rgba8 end_color, float duration, eDebugRenderMode mode )
 {
-	DebugRenderObject* object = new DebugRenderObject();
+	debug_render_primitive_t object;
 
-	object->m_transformMatrix.SetTranslation3D(p0);
-	object->m_durationTimer.SetSeconds(duration);
-	object->m_startColor = start_color;
-	object->m_endColor = end_color;
-	object->m_renderMode = mode;
+	object.m_transformMatrix.SetTranslation3D(p0);
+	object.m_durationSeconds = duration;
+	object.m_startColor = start_color;
+	object.m_endColor = end_color;
+	object.m_renderMode = mode;
 
 	Vec3 displacement = p1 - p0;
 	float bodyRadius = GetClamp( displacement.GetLength() * 0.05f, 0.f, 0.01f );
 	float coneRadius = bodyRadius * 2.f;
 	Vec3 coneStartPosition = displacement - displacement.GetNormalize() * ( coneRadius * 1.5f );
 
-	AddCylinderToIndexedVertexArray( object->m_objectVerticies, object->m_objectIndicies, Vec3::ZERO, bodyRadius, coneStartPosition, bodyRadius, start_color, 32 );
-	AddConeToIndexedVertexArray( object->m_objectVerticies, object->m_objectIndicies, coneStartPosition, coneRadius, displacement, start_color, 32 );
+	AddCylinderToIndexedVertexArray( object.m_objectVerticies, object.m_objectIndicies, Vec3::ZERO, bodyRadius, coneStartPosition, bodyRadius, start_color, 32 );
+	AddConeToIndexedVertexArray( object.m_objectVerticies, object.m_objectIndicies, coneStartPosition, coneRadius, displacement, start_color, 32 );
 
-	AppendDebugRenderObjectToVector( s_debugRenderWorldObjects, object );
+	SubmitDebugRenderPrimitive( s_debugRenderWorldBatches, object );
 }
 
 
@@ -700,18 +1023,18 @@ void DebugAddWorldArrow( Vec3 start, Vec3 end, Rgba8 color, float duration, eDeb
 //---------------------------------------------------------------------------------------------------------
 void DebugAddWorldCone( Vec3 const& startPos, float startRadius, Vec3 const& endPos, float endRadius, Rgba8 const& startColor, Rgba8 const& endColor, float duration, eDebugRenderMode mode )
 {
-	DebugRenderObject* object = new DebugRenderObject();
+	debug_render_primitive_t object;
 
-	object->m_transformMatrix.SetTranslation3D( startPos );
-	object->m_durationTimer.SetSeconds( duration );
-	object->m_startColor = startColor;
-	object->m_endColor = endColor;
-	object->m_renderMode = mode;
-	object->m_isWireMesh = true;
+	object.m_transformMatrix.SetTranslation3D( startPos );
+	object.m_durationSeconds = duration;
+	object.m_startColor = startColor;
+	object.m_endColor = endColor;
+	object.m_renderMode = mode;
+	object.m_isWireMesh = true;
 
-	AddCylinderToIndexedVertexArray( object->m_objectVerticies, object->m_objectIndicies, Vec3::ZERO, startRadius, endPos - startPos, endRadius, startColor, 32 );
+	AddCylinderToIndexedVertexArray( object.m_objectVerticies, object.m_objectIndicies, Vec3::ZERO, startRadius, endPos - startPos, endRadius, startColor, 32 );
 
-	AppendDebugRenderObjectToVector( s_debugRenderWorldObjects, object );
+	SubmitDebugRenderPrimitive( s_debugRenderWorldBatches, object );
 }
 
 
@@ -725,17 +1048,17 @@ void DebugAddWorldCone( Vec3 const& startPos, Vec3 const& endPos, float endRadiu
 //---------------------------------------------------------------------------------------------------------
 void DebugAddWorldQuad( Vec3 p0, Vec3 p1, Vec3 p2, Vec3 p3, AABB2 uvs, Rgba8 start_color, Rgba8 end_color, float duration, eDebugRenderMode mode )
 {
-	DebugRenderObject* object = new DebugRenderObject();
+	debug_render_primitive_t object;
 
-	object->m_transformMatrix.SetTranslation3D( p0 );
-	object->m_durationTimer.SetSeconds( duration );
-	object->m_startColor = start_color;
-	object->m_endColor = end_color;
-	object->m_renderMode = mode;
+	object.m_transformMatrix.SetTranslation3D( p0 );
+	object.m_durationSeconds = duration;
+	object.m_startColor = start_color;
+	object.m_endColor = end_color;
+	object.m_renderMode = mode;
 
-	AppendVertsForQuad3D( object->m_objectVerticies, Vec3::ZERO, p1 - p0, p2 - p0, p3 - p0, start_color, uvs.mins, uvs.maxes );
+	AppendVertsForQuad3D( object.m_objectVerticies, Vec3::ZERO, p1 - p0, p2 - p0, p3 - p0, start_color, uvs.mins, uvs.maxes );
 
-	AppendDebugRenderObjectToVector( s_debugRenderWorldObjects, object );
+	SubmitDebugRenderPrimitive( s_debugRenderWorldBatches, object );
 }
 
 
@@ -777,20 +1100,20 @@ void DebugAddWorldPoly( Vec3 const* counterClockwisePolyPoints, Rgba8 const& sta
 //---------------------------------------------------------------------------------------------------------
 void DebugAddWorldWireBounds( OBB3 bounds, Rgba8 start_color, Rgba8 end_color, float duration, eDebugRenderMode mode )
 {
-	DebugRenderObject* object = new DebugRenderObject();
+	debug_render_primitive_t object;
 
-	object->m_transformMatrix = bounds.m_transformMatrix;
-	object->m_durationTimer.SetSeconds( duration );
-	object->m_startColor = start_color;
-	object->m_endColor = end_color;
-	object->m_renderMode = mode;
-	object->m_isWireMesh = true;
+	object.m_transformMatrix = bounds.m_transformMatrix;
+	object.m_durationSeconds = duration;
+	object.m_startColor = start_color;
+	object.m_endColor = end_color;
+	object.m_renderMode = mode;
+	object.m_isWireMesh = true;
 
 	AABB3 localBounds = AABB3( -bounds.m_halfDimensions, bounds.m_halfDimensions );
 
-	AddBoxToIndexedVertexArray( object->m_objectVerticies, object->m_objectIndicies, localBounds, start_color );
+	AddBoxToIndexedVertexArray( object.m_objectVerticies, object.m_objectIndicies, localBounds, start_color );
 
-	AppendDebugRenderObjectToVector( s_debugRenderWorldObjects, object );
+	SubmitDebugRenderPrimitive( s_debugRenderWorldBatches, object );
 }
 
 
@@ -804,38 +1127,38 @@ void DebugAddWorldWireBounds( OBB3 bounds, Rgba8 color, float duration, eDebugRe
 //---------------------------------------------------------------------------------------------------------
 void DebugAddWorldWireBounds( AABB3 bounds, Rgba8 color, float duration, eDebugRenderMode mode )
 {
-	DebugRenderObject* object = new DebugRenderObject();
+	debug_render_primitive_t object;
 
-	object->m_transformMatrix.SetTranslation3D( bounds.mins );
-	object->m_durationTimer.SetSeconds( duration );
-	object->m_startColor = color;
-	object->m_endColor = color;
-	object->m_renderMode = mode;
-	object->m_isWireMesh = true;
+	object.m_transformMatrix.SetTranslation3D( bounds.mins );
+	object.m_durationSeconds = duration;
+	object.m_startColor = color;
+	object.m_endColor = color;
+	object.m_renderMode = mode;
+	object.m_isWireMesh = true;
 
 	AABB3 localBounds = AABB3( Vec3::ZERO, bounds.GetDimensions() );
 
-	AddBoxToIndexedVertexArray( object->m_objectVerticies, object->m_objectIndicies, localBounds, color );
+	AddBoxToIndexedVertexArray( object.m_objectVerticies, object.m_objectIndicies, localBounds, color );
 
-	AppendDebugRenderObjectToVector( s_debugRenderWorldObjects, object );
+	SubmitDebugRenderPrimitive( s_debugRenderWorldBatches, object );
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 void DebugAddWorldWireSphere( Vec3 pos, float radius, Rgba8 start_color, Rgba8 end_color, float duration, eDebugRenderMode mode )
 {
-	DebugRenderObject* object = new DebugRenderObject();
+	debug_render_primitive_t object;
 
-	object->m_transformMatrix.SetTranslation3D( pos );
-	object->m_durationTimer.SetSeconds( duration );
-	object->m_startColor = start_color;
-	object->m_endColor = end_color;
-	object->m_renderMode = mode;
-	object->m_isWireMesh = true;
+	object.m_transformMatrix.SetTranslation3D( pos );
+	object.m_durationSeconds = duration;
+	object.m_startColor = start_color;
+	object.m_endColor = end_color;
+	object.m_renderMode = mode;
+	object.m_isWireMesh = true;
 
-	AddUVSphereToIndexedVertexArray( object->m_objectVerticies, object->m_objectIndicies, Vec3::ZERO, radius, 16, 32, start_color );
+	AddUVSphereToIndexedVertexArray( object.m_objectVerticies, object.m_objectIndicies, Vec3::ZERO, radius, 16, 32, start_color );
 
-	AppendDebugRenderObjectToVector( s_debugRenderWorldObjects, object );
+	SubmitDebugRenderPrimitive( s_debugRenderWorldBatches, object );
 }
 
 
@@ -900,18 +1223,18 @@ void DebugAddWorldText( Mat44 basis, Vec2 pivot, Rgba8 start_color, Rgba8 end_co
 	Vec2 textDimensions = s_debugRenderFont->GetDimensionsForText2D( textSize, text );
 	Vec2 textStartPos = -( textDimensions * pivot );
 
-	DebugRenderObject* object = new DebugRenderObject();
+	debug_render_primitive_t object;
 
-	object->m_durationTimer.SetSeconds( duration );
-	object->m_transformMatrix = basis;
-	object->m_startColor = start_color;
-	object->m_endColor = end_color;
-	object->m_renderMode = mode;
-	object->m_texture = s_debugRenderFont->GetTexture();
+	object.m_durationSeconds = duration;
+	object.m_transformMatrix = basis;
+	object.m_startColor = start_color;
+	object.m_endColor = end_color;
+	object.m_renderMode = mode;
+	object.m_texture = s_debugRenderFont->GetTexture();
 
-	s_debugRenderFont->AddVertsForText2D( object->m_objectVerticies, textStartPos, textSize, text, start_color );
+	s_debugRenderFont->AddVertsForText2D( object.m_objectVerticies, textStartPos, textSize, text, start_color );
 
-	AppendDebugRenderObjectToVector( s_debugRenderWorldObjects, object );
+	SubmitDebugRenderPrimitive( s_debugRenderWorldBatches, object );
 }
 
 
@@ -963,19 +1286,19 @@ void DebugAddWorldBillboardText( Vec3 origin, Vec2 pivot, Rgba8 start_color, Rgb
 	Vec2 textDimensions = s_debugRenderFont->GetDimensionsForText2D( textSize, text );
 	Vec2 textStartPos = -( textDimensions * pivot );
 
-	DebugRenderObject* object = new DebugRenderObject();
+	debug_render_primitive_t object;
 
-	object->m_durationTimer.SetSeconds( duration );
-	object->m_transformMatrix.SetTranslation3D( origin );
-	object->m_startColor = start_color;
-	object->m_endColor = end_color;
-	object->m_renderMode = mode;
-	object->m_texture = s_debugRenderFont->GetTexture();
-	object->m_isBillboarded = true;
+	object.m_durationSeconds = duration;
+	object.m_transformMatrix.SetTranslation3D( origin );
+	object.m_startColor = start_color;
+	object.m_endColor = end_color;
+	object.m_renderMode = mode;
+	object.m_texture = s_debugRenderFont->GetTexture();
+	object.m_isBillboarded = true;
 
-	s_debugRenderFont->AddVertsForText2D( object->m_objectVerticies, textStartPos, textSize, text, start_color );
+	s_debugRenderFont->AddVertsForText2D( object.m_objectVerticies, textStartPos, textSize, text, start_color );
 
-	AppendDebugRenderObjectToVector( s_debugRenderWorldObjects, object );
+	SubmitDebugRenderPrimitive( s_debugRenderWorldBatches, object );
 }
 
 
@@ -1037,22 +1360,22 @@ AABB2 DebugGetScreenBounds()
 //---------------------------------------------------------------------------------------------------------
 void DebugAddScreenPoint( Vec2 pos, float size, Rgba8 start_color, Rgba8 end_color, float duration )
 {
-	DebugRenderObject* screenObject = new DebugRenderObject();
+	debug_render_primitive_t screenObject;
 
-	screenObject->m_durationTimer.SetSeconds( duration );
-	screenObject->m_transformMatrix.SetTranslation2D( pos );
-	screenObject->m_startColor = start_color;
-	screenObject->m_endColor = end_color;
+	screenObject.m_durationSeconds = duration;
+	screenObject.m_transformMatrix.SetTranslation2D( pos );
+	screenObject.m_startColor = start_color;
+	screenObject.m_endColor = end_color;
 
 	float halfSize = size * 0.5f;
 	Vec2 min = Vec2( -halfSize, -halfSize );
 	Vec2 max = Vec2( halfSize, halfSize );
 	AABB2 box = AABB2( min, max );
 
-	AppendVertsForAABB2D( screenObject->m_objectVerticies, box, start_color );
+	AppendVertsForAABB2D( screenObject.m_objectVerticies, box, start_color );
 	//screenObject->m_objectIndicies = { 0, 1, 2, 3, 4, 5 };
 
-	AppendDebugRenderObjectToVector( s_debugRenderScreenObjects, screenObject );
+	SubmitDebugRenderPrimitive( s_debugRenderScreenBatches, screenObject );
 }
 
 
@@ -1073,17 +1396,17 @@ void DebugAddScreenPoint( Vec2 pos, Rgba8 color )
 //---------------------------------------------------------------------------------------------------------
 void DebugAddScreenLine( Vec2 p0, Vec2 p1, Rgba8 start_color, Rgba8 end_color, float duration )
 {
-	DebugRenderObject* screenObject = new DebugRenderObject();
+	debug_render_primitive_t screenObject;
 	
-	screenObject->m_durationTimer.SetSeconds( duration );
-	screenObject->m_transformMatrix.SetTranslation2D( p0 );
-	screenObject->m_startColor = start_color;
-	screenObject->m_endColor = end_color;
+	screenObject.m_durationSeconds = duration;
+	screenObject.m_transformMatrix.SetTranslation2D( p0 );
+	screenObject.m_startColor = start_color;
+	screenObject.m_endColor = end_color;
 
-	AppendVertsForLineBetweenPoints( screenObject->m_objectVerticies, Vec2::ZERO, p1 - p0, start_color, 10.f );
+	AppendVertsForLineBetweenPoints( screenObject.m_objectVerticies, Vec2::ZERO, p1 - p0, start_color, 10.f );
 	//screenObject->m_objectIndicies = { 0, 1, 2, 3, 4, 5 };
 
-	AppendDebugRenderObjectToVector( s_debugRenderScreenObjects, screenObject );
+	SubmitDebugRenderPrimitive( s_debugRenderScreenBatches, screenObject );
 }
 
 
@@ -1097,17 +1420,17 @@ void DebugAddScreenLine(Vec2 p0, Vec2 p1, Rgba8 color, float duration )
 //---------------------------------------------------------------------------------------------------------
 void DebugAddScreenArrow( Vec2 p0, Vec2 p1, Rgba8 start_color, Rgba8 end_color, float duration )
 {
-	DebugRenderObject* screenObject = new DebugRenderObject();
+	debug_render_primitive_t screenObject;
 
-	screenObject->m_durationTimer.SetSeconds( duration );
-	screenObject->m_transformMatrix.SetTranslation2D( p0 );
-	screenObject->m_startColor = start_color;
-	screenObject->m_endColor = end_color;
+	screenObject.m_durationSeconds = duration;
+	screenObject.m_transformMatrix.SetTranslation2D( p0 );
+	screenObject.m_startColor = start_color;
+	screenObject.m_endColor = end_color;
 
-	AppendVertsForArrowBetweenPoints( screenObject->m_objectVerticies, Vec2::ZERO, p1 - p0, start_color, 10.f );
+	AppendVertsForArrowBetweenPoints( screenObject.m_objectVerticies, Vec2::ZERO, p1 - p0, start_color, 10.f );
 	//screenObject->m_objectIndicies = { 0, 1, 2, 3, 4, 5, 6, 7, 8 };
 
-	AppendDebugRenderObjectToVector( s_debugRenderScreenObjects, screenObject );
+	SubmitDebugRenderPrimitive( s_debugRenderScreenBatches, screenObject );
 }
 
 
@@ -1121,19 +1444,19 @@ void DebugAddScreenArrow( Vec2 p0, Vec2 p1, Rgba8 color, float duration )
 //---------------------------------------------------------------------------------------------------------
 void DebugAddScreenQuad( AABB2 bounds, Rgba8 start_color, Rgba8 end_color, float duration )
 {
-	DebugRenderObject* screenObject = new DebugRenderObject();
+	debug_render_primitive_t screenObject;
 
-	screenObject->m_durationTimer.SetSeconds( duration );
-	screenObject->m_transformMatrix.SetTranslation2D( bounds.mins );
-	screenObject->m_startColor = start_color;
-	screenObject->m_endColor = end_color;
+	screenObject.m_durationSeconds = duration;
+	screenObject.m_transformMatrix.SetTranslation2D( bounds.mins );
+	screenObject.m_startColor = start_color;
+	screenObject.m_endColor = end_color;
 
 	AABB2 localBounds = AABB2( Vec2::ZERO, bounds.maxes - bounds.mins );
 
-	AppendVertsForAABB2D( screenObject->m_objectVerticies, localBounds, start_color );
+	AppendVertsForAABB2D( screenObject.m_objectVerticies, localBounds, start_color );
 	//screenObject->m_objectIndicies = { 0, 1, 2, 3, 4, 5 };
 
-	AppendDebugRenderObjectToVector( s_debugRenderScreenObjects, screenObject );
+	SubmitDebugRenderPrimitive( s_debugRenderScreenBatches, screenObject );
 }
 
 
@@ -1147,20 +1470,20 @@ void DebugAddScreenQuad( AABB2 bounds, Rgba8 color, float duration )
 //---------------------------------------------------------------------------------------------------------
 void DebugAddScreenTexturedQuad( AABB2 bounds, Texture* tex, AABB2 uvs, Rgba8 start_tint, Rgba8 end_tint, float duration )
 {
-	DebugRenderObject* screenObject = new DebugRenderObject();
+	debug_render_primitive_t screenObject;
 
-	screenObject->m_durationTimer.SetSeconds( duration );
-	screenObject->m_transformMatrix.SetTranslation2D( bounds.mins );
-	screenObject->m_startColor = start_tint;
-	screenObject->m_endColor = end_tint;
-	screenObject->m_texture = tex;
+	screenObject.m_durationSeconds = duration;
+	screenObject.m_transformMatrix.SetTranslation2D( bounds.mins );
+	screenObject.m_startColor = start_tint;
+	screenObject.m_endColor = end_tint;
+	screenObject.m_texture = tex;
 
 	AABB2 localBounds = AABB2( Vec2::ZERO, bounds.maxes - bounds.mins );
 
-	AppendVertsForAABB2D( screenObject->m_objectVerticies, localBounds, start_tint, uvs.mins, uvs.maxes );
+	AppendVertsForAABB2D( screenObject.m_objectVerticies, localBounds, start_tint, uvs.mins, uvs.maxes );
 	//screenObject->m_objectIndicies = { 0, 1, 2, 3, 4, 5 };
 
-	AppendDebugRenderObjectToVector( s_debugRenderScreenObjects, screenObject );
+	SubmitDebugRenderPrimitive( s_debugRenderScreenBatches, screenObject );
 }
 
 
@@ -1195,17 +1518,17 @@ void DebugAddScreenText( Vec4 ratioOffset, Vec2 pivot, float size, Rgba8 start_c
 	Vec2 textDimensions = s_debugRenderFont->GetDimensionsForText2D( size, text );
 	textStartPos -= textDimensions * pivot;
 
-	DebugRenderObject* screenObject = new DebugRenderObject();
+	debug_render_primitive_t screenObject;
 
-	screenObject->m_durationTimer.SetSeconds( duration );
-	screenObject->m_transformMatrix.SetTranslation2D( textStartPos );
-	screenObject->m_startColor = start_color;
-	screenObject->m_endColor = end_color;
-	screenObject->m_texture = s_debugRenderFont->GetTexture();
+	screenObject.m_durationSeconds = duration;
+	screenObject.m_transformMatrix.SetTranslation2D( textStartPos );
+	screenObject.m_startColor = start_color;
+	screenObject.m_endColor = end_color;
+	screenObject.m_texture = s_debugRenderFont->GetTexture();
 
-	s_debugRenderFont->AddVertsForText2D( screenObject->m_objectVerticies, Vec2::ZERO, size, text, start_color );
+	s_debugRenderFont->AddVertsForText2D( screenObject.m_objectVerticies, Vec2::ZERO, size, text, start_color );
 
-	AppendDebugRenderObjectToVector( s_debugRenderScreenObjects, screenObject );
+	SubmitDebugRenderPrimitive( s_debugRenderScreenBatches, screenObject );
 }
 
 
@@ -1276,3 +1599,4 @@ void DebugAddScreenTextf(Vec4 pos, Vec2 pivot, Rgba8 color, char const* format,
 	DebugAddScreenText( pos, pivot, 10.f, color, color, 0.f, textLiteral );
 }
 
+#endif // !ENGINE_HEADLESS
@@ -104,7 +104,7 @@ void Delegate<ARGS...>::Unsubscribe( c_callback_t const& callback )
 {
 	subscription sub;
 	sub.objectID = nullptr;
-	sub.functionID = callback;
+	sub.functionID = reinterpret_cast<void const*>( callback );
 
 	Unsubscribe( sub );
 }
@@ -125,7 +125,7 @@ void Delegate<ARGS...>::Subscribe( c_callback_t const& callback )
 	subscription sub;
 
 	sub.objectID = nullptr;
-	sub.functionID = callback;
+	sub.functionID = reinterpret_cast<void const*>( callback );
 	sub.callable = callback;
 
 	Subscribe( sub );
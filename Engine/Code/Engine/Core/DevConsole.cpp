@@ -1,20 +1,62 @@
 #include "Engine/Core/DevConsole.hpp"
-#include "Engine/Renderer/BitmapFont.hpp"
+#include "Engine/Core/DevConsoleLog.hpp"
+#include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/Rgba8.hpp"
-#include "Engine/Renderer/Camera.hpp"
-#include "Engine/Renderer/RenderContext.hpp"
 #include "Engine/Input/InputSystem.hpp"
 #include "Engine/Core/EventSystem.hpp"
+#include "Engine/Core/NamedProperties.hpp"
 #include "Engine/Core/Vertex_PCU.hpp"
-#include "Engine/Renderer/MeshUtils.hpp"
 #include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/MathUtils.hpp"
 #include "Engine/Core/Clock.hpp"
+#include "Engine/Platform/Platform.hpp"
+
+#if !defined( ENGINE_HEADLESS )
+#include "Engine/Renderer/BitmapFont.hpp"
+#include "Engine/Renderer/Camera.hpp"
+#include "Engine/Renderer/RenderContext.hpp"
+#include "Engine/Renderer/MeshUtils.hpp"
+#endif
 #include <stdarg.h>
 
 
+//---------------------------------------------------------------------------------------------------------
+static void log_spill( EventArgs* args )
+{
+	std::string defaultFilepath = "DevConsoleLog.txt";
+	bool defaultEnabled = true;
+
+	std::string filepath = args->GetValue( "file", defaultFilepath );
+	bool enabled = args->GetValue( "enabled", defaultEnabled );
+
+	if( !enabled )
+	{
+		g_theConsole->CloseLogSpillFile();
+		g_theConsole->PrintString( Rgba8::WHITE, "Console log spill disabled" );
+	}
+	else if( g_theConsole->OpenLogSpillFile( filepath.c_str() ) )
+	{
+		g_theConsole->PrintString( Rgba8::WHITE, "Console log spilling to \"%s\"", filepath.c_str() );
+	}
+	else
+	{
+		g_theConsole->ErrorString( "Failed to open console log spill file \"%s\"", filepath.c_str() );
+	}
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 DevConsole::DevConsole()
 {
+	m_log = new DevConsoleLog();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+DevConsole::~DevConsole()
+{
+	delete m_log;
+	m_log = nullptr;
 }
 
 
@@ -24,6 +66,12 @@ void DevConsole::StartUp( InputSystem* theInput, EventSystem* theEventSystem )
 	m_clock = new Clock();
 	m_theInput = theInput;
 	m_theEventSystem = theEventSystem;
+	m_mainThreadID = std::this_thread::get_id();
+
+	if( m_theEventSystem != nullptr )
+	{
+		m_theEventSystem->SubscribeEventCallbackFunction( "log_spill", log_spill );
+	}
 }
 
 
@@ -32,12 +80,16 @@ void DevConsole::ShutDown()
 {
 	delete m_clock;
 	m_clock = nullptr;
+
+	m_log->CloseSpillFile();
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 void DevConsole::EndFrame()
 {
+	DrainPendingLines();
+	m_log->FlushSpillFile();
 }
 
 
@@ -50,6 +102,12 @@ void DevConsole::StartFrame()
 //---------------------------------------------------------------------------------------------------------
 void DevConsole::Update()
 {
+	DrainPendingLines();
+	if( m_isOpenRequested.exchange( false ) && !IsOpen() )
+	{
+		SetIsOpen( true );
+	}
+
 	float deltaSeconds = static_cast<float>( m_clock->GetLastDeltaSeconds() );
 	if( IsOpen() )
 	{
@@ -70,11 +128,12 @@ void DevConsole::UpdateCursorBlinkTime( float deltaSeconds )
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+// Safe from any thread - lines show up once the main thread drains the log
 //---------------------------------------------------------------------------------------------------------
 void DevConsole::PrintString( const Rgba8& textColor, const std::string& devConsolePrintString )
 {
-	ColorString newString( textColor, devConsolePrintString );
-	m_colorStrings.push_back( newString );
+	m_log->AddLine( textColor, devConsolePrintString.c_str() );
 }
 
 
@@ -91,9 +150,7 @@ void DevConsole::PrintString( const Rgba8& textColor, const char* messageFormat,
 	va_end( variableArgumentList );
 	
 	textLiteral[ textMaxLength - 1 ] = '\0';
-	
-	std::string textLiteralAsString = textLiteral;
-	PrintString( textColor, textLiteralAsString );
+	m_log->AddLine( textColor, textLiteral );
 }
 
 
@@ -110,11 +167,45 @@ void DevConsole::ErrorString( const char* errorMessageFormat, ... )
 	va_end( variableArgumentList );
 	
 	textLiteral[ textMaxLength - 1 ] = '\0';
-	PrintString( Rgba8::RED, textLiteral );
-	SetIsOpen( true );
+	m_log->AddLine( Rgba8::RED, textLiteral );
+
+	// Opening fires focus events, so other threads leave that to the main thread's next Update
+	if( std::this_thread::get_id() == m_mainThreadID )
+	{
+		SetIsOpen( true );
+	}
+	else
+	{
+		m_isOpenRequested = true;
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool DevConsole::OpenLogSpillFile( char const* filepath )
+{
+	return m_log->OpenSpillFile( filepath );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void DevConsole::CloseLogSpillFile()
+{
+	m_log->CloseSpillFile();
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+void DevConsole::DrainPendingLines() const
+{
+	if( m_log->DrainPendingLines() )
+	{
+		m_outputCache.isDirty = true;
+	}
+}
+
+
+#if !defined( ENGINE_HEADLESS )
 //---------------------------------------------------------------------------------------------------------
 void DevConsole::Render( RenderContext& renderer, Camera& camera, float lineHeight, BitmapFont* font ) const
 {
@@ -155,34 +246,45 @@ void DevConsole::RenderBackground( RenderContext& renderer, const Camera& camera
 //---------------------------------------------------------------------------------------------------------
 void DevConsole::RenderOutput( RenderContext& renderer, const Camera& camera, float lineHeight, BitmapFont* font ) const
 {
-	std::vector<Vertex_PCU> consoleVerts;
-	Vec2 cameraDimensions = camera.GetCameraDimensions();
+	DrainPendingLines();
 
+	Vec2 cameraDimensions = camera.GetCameraDimensions();
 	int maxNumberOfLines = static_cast<int>( cameraDimensions.y / lineHeight );
-	int colorStringLength = static_cast<int>( m_colorStrings.size() );
 
-	int numberOfLinesToPrint = maxNumberOfLines > colorStringLength ? colorStringLength : maxNumberOfLines;
-	numberOfLinesToPrint += m_lastLineToShow;
-	Clamp( numberOfLinesToPrint, 0, colorStringLength );
+	Vec3 orthoBottomLeft = camera.GetOrthoBottomLeft();
+	Vec2 textMins = Vec2( orthoBottomLeft.x, orthoBottomLeft.y + lineHeight );
 
-	Vec3 textMins = camera.GetOrthoBottomLeft();
-	textMins.y += lineHeight;
-
-	for( int consoleStringIndexFromLast = m_lastLineToShow; consoleStringIndexFromLast < numberOfLinesToPrint; ++consoleStringIndexFromLast )
+	// Only rebuild the visible window when the lines or the layout actually changed
+	dev_console_output_cache_t& cache = m_outputCache;
+	if( cache.isDirty || cache.lineHeight != lineHeight || cache.textMins != textMins || cache.maxLineCount != maxNumberOfLines || 
+		cache.lastLineToShow != m_lastLineToShow || cache.font != font )
 	{
-		int consoleStringIndex = colorStringLength - consoleStringIndexFromLast - 1;
+		cache.verticies.clear();
+		cache.lineHeight = lineHeight;
+		cache.textMins = textMins;
+		cache.maxLineCount = maxNumberOfLines;
+		cache.lastLineToShow = m_lastLineToShow;
+		cache.font = font;
+		cache.isDirty = false;
 
-		ColorString currentColorString = m_colorStrings[ consoleStringIndex ];
+		int colorStringLength = static_cast<int>( m_log->GetLineCount() );
+		int numberOfLinesToPrint = maxNumberOfLines > colorStringLength ? colorStringLength : maxNumberOfLines;
+		numberOfLinesToPrint += m_lastLineToShow;
+		Clamp( numberOfLinesToPrint, 0, colorStringLength );
 
-		font->AddVertsForText2D( consoleVerts, Vec2( textMins.x, textMins.y ), lineHeight, currentColorString.m_text, currentColorString.m_color );
+		for( int consoleStringIndexFromLast = m_lastLineToShow; consoleStringIndexFromLast < numberOfLinesToPrint; ++consoleStringIndexFromLast )
+		{
+			ColorString const& currentColorString = m_log->GetLineFromLast( consoleStringIndexFromLast );
+			font->AddVertsForText2D( cache.verticies, textMins, lineHeight, currentColorString.m_text, currentColorString.m_color );
+			textMins.y += lineHeight;
+		}
+	}
 
-		renderer.BindTexture( font->GetTexture() );
-		renderer.BindShader( (Shader*)nullptr );
-		renderer.DrawVertexArray( consoleVerts );
+	if( cache.verticies.empty() ) return;
 
-		textMins.y += lineHeight;
-		consoleVerts.clear();
-	}
+	renderer.BindTexture( font->GetTexture() );
+	renderer.BindShader( (Shader*)nullptr );
+	renderer.DrawVertexArray( cache.verticies );
 }
 
 
@@ -255,6 +357,7 @@ void DevConsole::RenderSelection( RenderContext& renderer, const Camera& camera,
 	renderer.BindShader( (Shader*)nullptr );
 	renderer.DrawVertexArray( selectionVerts );
 }
+#endif
 
 
 //---------------------------------------------------------------------------------------------------------
@@ -525,7 +628,7 @@ void DevConsole::ScrollConsoleOutput( float scrollAmount )
 	int linesToScroll = RoundToInt( scrollAmount );
 	m_lastLineToShow += linesToScroll;
 
-	int maxLineCount = static_cast<int>( m_colorStrings.size() );
+	int maxLineCount = static_cast<int>( m_log->GetLineCount() );
 	Clamp( m_lastLineToShow, 0, maxLineCount );
 }
 
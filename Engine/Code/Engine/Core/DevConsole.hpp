@@ -2,7 +2,11 @@
 #include "Engine/Core/ColorString.hpp"
 #include "Engine/Math/IntRange.hpp"
 #include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Math/Vec2.hpp"
+#include <atomic>
 #include <string>
+#include <thread>
 #include <vector>
 
 class	Camera;
@@ -11,6 +15,7 @@ class	BitmapFont;
 class	InputSystem;
 class	EventSystem;
 class	Clock;
+class	DevConsoleLog;
 
 enum Direction
 {
@@ -18,10 +23,25 @@ enum Direction
 	RIGHT,
 };
 
+
+//---------------------------------------------------------------------------------------------------------
+struct dev_console_output_cache_t
+{
+	std::vector<Vertex_PCU>	verticies;
+	bool					isDirty			= true;
+	float					lineHeight		= 0.f;
+	Vec2					textMins		= Vec2::ZERO;
+	int						maxLineCount	= 0;
+	int						lastLineToShow	= 0;
+	BitmapFont const*		font			= nullptr;
+};
+
+
 class DevConsole
 {
 public:
 	DevConsole();
+	~DevConsole();
 	
 	void StartUp( InputSystem* theInput, EventSystem* theEventSystem );
 	void ShutDown();
@@ -35,6 +55,9 @@ public:
 	void PrintString( const Rgba8& textColor, const char* messageFormat, ... );
 	void ErrorString( const char* errorMessageFormat, ... );
 
+	bool OpenLogSpillFile( char const* filepath );
+	void CloseLogSpillFile();
+
 	void Render( RenderContext& renderer, Camera& camera, float lineHeight, BitmapFont* font ) const;
 	void RenderBackground( RenderContext& renderer, const Camera& camera ) const;
 	void RenderOutput( RenderContext& renderer, const Camera& camera, float lineHeight, BitmapFont* font ) const;
@@ -60,6 +83,7 @@ public:
 	void SubmitCommand();
 	void ScrollConsoleOutput( float scrollAmount );
 	void ResetInput();
+	void DrainPendingLines() const;
 
 	void HandleCut();
 	void HandleCopy();
@@ -87,11 +111,14 @@ private:
 	Rgba8 m_backgroundColor = Rgba8( 50, 50, 50, 175 );
 
 	bool m_isOpen = false;
+	std::atomic<bool> m_isOpenRequested = false;
+	std::thread::id m_mainThreadID;
 	InputSystem* m_theInput = nullptr;
 	EventSystem* m_theEventSystem = nullptr;
 
 
 	std::string m_currentInput = "";
-	std::vector< ColorString > m_colorStrings;
+	DevConsoleLog* m_log = nullptr;
+	mutable dev_console_output_cache_t m_outputCache;
 	std::vector< std::string > m_previousCommands;
 };
\ No newline at end of file
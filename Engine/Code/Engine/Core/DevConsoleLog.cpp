@@ -0,0 +1,144 @@
+#include "Engine/Core/DevConsoleLog.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Platform/Platform.hpp"
+#include <string.h>
+
+
+//---------------------------------------------------------------------------------------------------------
+DevConsoleLog::DevConsoleLog()
+	: m_pendingLines( DEV_CONSOLE_LOG_PENDING_CAPACITY )
+{
+	m_history.reserve( DEV_CONSOLE_LOG_HISTORY_CAPACITY );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+DevConsoleLog::~DevConsoleLog()
+{
+	CloseSpillFile();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Lines of one long message can interleave with another thread's lines, but each line stays whole
+//---------------------------------------------------------------------------------------------------------
+bool DevConsoleLog::AddLine( Rgba8 const& color, char const* text )
+{
+	constexpr size_t maxLineLength = DEV_CONSOLE_LOG_LINE_MAX_LENGTH - 1;
+
+	dev_console_pending_line_t pendingLine;
+	pendingLine.color = color;
+
+	bool wasEveryLineAdded = true;
+	char const* lineStart = text;
+	for( ;; )
+	{
+		size_t lineLength = 0;
+		while( lineLength < maxLineLength && lineStart[ lineLength ] != '\0' && lineStart[ lineLength ] != '\n' )
+		{
+			++lineLength;
+		}
+
+		memcpy( pendingLine.text, lineStart, lineLength );
+		pendingLine.text[ lineLength ] = '\0';
+		if( !m_pendingLines.Push( pendingLine ) )
+		{
+			m_droppedLineCount++;
+			wasEveryLineAdded = false;
+		}
+
+		lineStart += lineLength;
+		if( *lineStart == '\n' )
+		{
+			++lineStart;
+		}
+		if( *lineStart == '\0' )
+			break;
+	}
+	return wasEveryLineAdded;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool DevConsoleLog::DrainPendingLines()
+{
+	bool hasNewLines = false;
+	while( m_pendingLines.Pop( m_drainedLine ) )
+	{
+		AddLineToHistory( m_drainedLine.color, m_drainedLine.text );
+		hasNewLines = true;
+	}
+
+	uint droppedLineCount = m_droppedLineCount;
+	if( droppedLineCount != m_reportedDropCount )
+	{
+		std::string dropMessage = Stringf( "[%u console lines dropped - log queue was full]", droppedLineCount - m_reportedDropCount );
+		AddLineToHistory( Rgba8::YELLOW, dropMessage.c_str() );
+		m_reportedDropCount = droppedLineCount;
+		hasNewLines = true;
+	}
+
+	return hasNewLines;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void DevConsoleLog::AddLineToHistory( Rgba8 const& color, char const* text )
+{
+	if( m_spillFile != nullptr )
+	{
+		fputs( text, m_spillFile );
+		fputc( '\n', m_spillFile );
+	}
+
+	if( m_history.size() < DEV_CONSOLE_LOG_HISTORY_CAPACITY )
+	{
+		m_history.push_back( ColorString( color, text ) );
+		m_historyCount++;
+		return;
+	}
+
+	// Full - reuse the oldest line's string storage
+	ColorString& oldestLine = m_history[ m_historyStart ];
+	oldestLine.m_color = color;
+	oldestLine.m_text.assign( text );
+	m_historyStart = ( m_historyStart + 1 ) % DEV_CONSOLE_LOG_HISTORY_CAPACITY;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+ColorString const& DevConsoleLog::GetLineFromLast( uint indexFromLast ) const
+{
+	uint lineIndex = ( m_historyStart + m_historyCount - 1 - indexFromLast ) % DEV_CONSOLE_LOG_HISTORY_CAPACITY;
+	return m_history[ lineIndex ];
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool DevConsoleLog::OpenSpillFile( char const* filepath )
+{
+	CloseSpillFile();
+	fopen_s( &m_spillFile, filepath, "w" );
+	return m_spillFile != nullptr;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void DevConsoleLog::CloseSpillFile()
+{
+	if( m_spillFile == nullptr )
+		return;
+
+	fclose( m_spillFile );
+	m_spillFile = nullptr;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void DevConsoleLog::FlushSpillFile()
+{
+	if( m_spillFile != nullptr )
+	{
+		fflush( m_spillFile );
+	}
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include "Engine/Core/ColorString.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/LockFreeQueue.hpp"
+#include <atomic>
+#include <stdio.h>
+#include <vector>
+
+
+//---------------------------------------------------------------------------------------------------------
+constexpr uint DEV_CONSOLE_LOG_LINE_MAX_LENGTH		= 256;
+constexpr uint DEV_CONSOLE_LOG_PENDING_CAPACITY		= 1024;
+constexpr uint DEV_CONSOLE_LOG_HISTORY_CAPACITY		= 2048;
+
+
+//---------------------------------------------------------------------------------------------------------
+struct dev_console_pending_line_t
+{
+	Rgba8	color;
+	char	text[ DEV_CONSOLE_LOG_LINE_MAX_LENGTH ];
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// AddLine may be called from any thread and never blocks or allocates - lines go into a bounded
+// multi-producer queue and are dropped (and counted) if it is full. Text longer than a line, or with
+// newlines in it, is split over several lines rather than cut off. The main thread drains the queue into
+// a fixed-size history, overwriting the oldest lines, and optionally spills every line to disk.
+//---------------------------------------------------------------------------------------------------------
+class DevConsoleLog
+{
+public:
+	DevConsoleLog();
+	~DevConsoleLog();
+
+	bool AddLine( Rgba8 const& color, char const* text );
+	bool DrainPendingLines();
+
+	bool OpenSpillFile( char const* filepath );
+	void CloseSpillFile();
+	void FlushSpillFile();
+	bool IsSpilling() const									{ return m_spillFile != nullptr; }
+
+	uint				GetLineCount() const				{ return m_historyCount; }
+	ColorString const&	GetLineFromLast( uint indexFromLast ) const;
+	uint				GetDroppedLineCount() const			{ return m_droppedLineCount; }
+
+private:
+	void AddLineToHistory( Rgba8 const& color, char const* text );
+
+private:
+	MPSCQueue<dev_console_pending_line_t>	m_pendingLines;
+	dev_console_pending_line_t	m_drainedLine;		// scratch for DrainPendingLines
+	std::atomic<uint>			m_droppedLineCount	= 0;
+	uint						m_reportedDropCount	= 0;
+
+	std::vector<ColorString>	m_history;
+	uint						m_historyStart		= 0;
+	uint						m_historyCount		= 0;
+
+	FILE*						m_spillFile			= nullptr;
+};
@@ -3,14 +3,15 @@
 //
 
 //-----------------------------------------------------------------------------------------------
-#ifdef _WIN32
-#define PLATFORM_WINDOWS
+#include "Engine/Platform/Platform.hpp"
+#if defined( PLATFORM_WINDOWS )
 #define WIN32_LEAN_AND_MEAN
 #include <Windows.h>
 #endif
 
 //-----------------------------------------------------------------------------------------------
 #include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/StringUtils.hpp"
 #include <stdarg.h>
 #include <iostream>
@@ -114,6 +115,12 @@ void SystemDialogue_Okay( const std::string& messageTitle, const std::string& me
 		MessageBoxA( NULL, messageText.c_str(), messageTitle.c_str(), MB_OK | dialogueIconTypeFlag | MB_TOPMOST );
 		ShowCursor( FALSE );
 	}
+	#else
+	{
+		UNUSED( messageTitle );
+		UNUSED( messageText );
+		UNUSED( severity );
+	}
 	#endif
 }
 
@@ -133,6 +140,12 @@ bool SystemDialogue_OkayCancel( const std::string& messageTitle, const std::stri
 		isAnswerOkay = (buttonClicked == IDOK);
 		ShowCursor( FALSE );
 	}
+	#else
+	{
+		UNUSED( messageTitle );
+		UNUSED( messageText );
+		UNUSED( severity );
+	}
 	#endif
 
 	return isAnswerOkay;
@@ -154,6 +167,12 @@ bool SystemDialogue_YesNo( const std::string& messageTitle, const std::string& m
 		isAnswerYes = (buttonClicked == IDYES);
 		ShowCursor( FALSE );
 	}
+	#else
+	{
+		UNUSED( messageTitle );
+		UNUSED( messageText );
+		UNUSED( severity );
+	}
 	#endif
 
 	return isAnswerYes;
@@ -175,6 +194,12 @@ int SystemDialogue_YesNoCancel( const std::string& messageTitle, const std::stri
 		answerCode = (buttonClicked == IDYES ? 1 : (buttonClicked == IDNO ? 0 : -1) );
 		ShowCursor( FALSE );
 	}
+	#else
+	{
+		UNUSED( messageTitle );
+		UNUSED( messageText );
+		UNUSED( severity );
+	}
 	#endif
 
 	return answerCode;
@@ -182,7 +207,7 @@ int SystemDialogue_YesNoCancel( const std::string& messageTitle, const std::stri
 
 
 //-----------------------------------------------------------------------------------------------
-__declspec( noreturn ) void FatalError( const char* filePath, const char* functionName, int lineNum, const std::string& reasonForError, const char* conditionText )
+[[noreturn]] void FatalError( const char* filePath, const char* functionName, int lineNum, const std::string& reasonForError, const char* conditionText )
 {
 	std::string errorMessage = reasonForError;
 	if( reasonForError.empty() )
@@ -199,7 +224,7 @@ __declspec( noreturn ) void FatalError( const char* filePath, const char* functi
 	std::string fullMessageTitle = appName + " :: Error";
 	std::string fullMessageText = errorMessage;
 	fullMessageText += "\n\nThe application will now close.\n";
-	bool isDebuggerPresent = (IsDebuggerPresent() == TRUE);
+	bool isDebuggerPresent = IsDebuggerAvailable();
 	if( isDebuggerPresent )
 	{
 		fullMessageText += "\nDEBUGGER DETECTED!\nWould you like to break and debug?\n  (Yes=debug, No=quit)\n";
@@ -225,7 +250,9 @@ __declspec( noreturn ) void FatalError( const char* filePath, const char* functi
 	if( isDebuggerPresent )
 	{
 		bool isAnswerYes = SystemDialogue_YesNo( fullMessageTitle, fullMessageText, SEVERITY_FATAL );
+#if defined( PLATFORM_WINDOWS )
 		ShowCursor( TRUE );
+#endif
 		if( isAnswerYes )
 		{
 			__debugbreak();
@@ -234,10 +261,12 @@ __declspec( noreturn ) void FatalError( const char* filePath, const char* functi
 	else
 	{
 		SystemDialogue_Okay( fullMessageTitle, fullMessageText, SEVERITY_FATAL );
+#if defined( PLATFORM_WINDOWS )
 		ShowCursor( TRUE );
+#endif
 	}
 
-	exit( 0 );
+	exit( EXIT_FAILURE );	// non-zero so a headless test run shows up as failed
 }
 
 
@@ -259,7 +288,7 @@ void RecoverableWarning( const char* filePath, const char* functionName, int lin
 	std::string fullMessageTitle = appName + " :: Warning";
 	std::string fullMessageText = errorMessage;
 
-	bool isDebuggerPresent = (IsDebuggerPresent() == TRUE);
+	bool isDebuggerPresent = IsDebuggerAvailable();
 	if( isDebuggerPresent )
 	{
 		fullMessageText += "\n\nDEBUGGER DETECTED!\nWould you like to continue running?\n  (Yes=continue, No=quit, Cancel=debug)\n";
@@ -289,7 +318,9 @@ void RecoverableWarning( const char* filePath, const char* functionName, int lin
 	if( isDebuggerPresent )
 	{
 		int answerCode = SystemDialogue_YesNoCancel( fullMessageTitle, fullMessageText, SEVERITY_WARNING );
+#if defined( PLATFORM_WINDOWS )
 		ShowCursor( TRUE );
+#endif
 		if( answerCode == 0 ) // "NO"
 		{
 			exit( 0 );
@@ -302,7 +333,9 @@ void RecoverableWarning( const char* filePath, const char* functionName, int lin
 	else
 	{
 		bool isAnswerYes = SystemDialogue_YesNo( fullMessageTitle, fullMessageText, SEVERITY_WARNING );
+#if defined( PLATFORM_WINDOWS )
 		ShowCursor( TRUE );
+#endif
 		if( !isAnswerYes )
 		{
 			exit( 0 );
@@ -4,15 +4,30 @@
 #include "Engine/Math/Vec2.hpp"
 #include "Engine/Math/Vec3.hpp"
 #include "Engine/Core/StringUtils.hpp"
+#include "Engine/Platform/Platform.hpp"
 #include <vector>
+#include <errno.h>
+#include <sys/stat.h>
+
+#if defined( PLATFORM_WINDOWS )
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
 #include <io.h>
+#include <direct.h>
+#else
+#include <dirent.h>
+#include <fnmatch.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
 
 
 //---------------------------------------------------------------------------------------------------------
-void* FileReadToNewBuffer( std::string const& filepath, size_t* out_size )
+static void* ReadFileToNewBuffer( std::string const& filepath, char const* mode, size_t* out_size )
 {
 	FILE* fp = nullptr;
-	fopen_s( &fp, filepath.c_str(), "r" );
+	fopen_s( &fp, filepath.c_str(), mode );
 	if( fp == nullptr )
 	{
 		return nullptr;
@@ -26,7 +41,7 @@ void* FileReadToNewBuffer( std::string const& filepath, size_t* out_size )
 	{
 		fseek(fp, 0, SEEK_SET);
 		size_t bytes_read = fread(buffer, 1, file_size, fp);
-		buffer[bytes_read] = NULL;
+		buffer[bytes_read] = '\0';
 
 		if (out_size != nullptr)
 		{
@@ -39,6 +54,20 @@ void* FileReadToNewBuffer( std::string const& filepath, size_t* out_size )
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+void* FileReadToNewBuffer( std::string const& filepath, size_t* out_size )
+{
+	return ReadFileToNewBuffer( filepath, "r", out_size );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void* FileReadBinaryToNewBuffer( std::string const& filepath, size_t* out_size )
+{
+	return ReadFileToNewBuffer( filepath, "rb", out_size );
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 char const* FileReadToString( std::string const& filepath )
 {
@@ -47,12 +76,90 @@ char const* FileReadToString( std::string const& filepath )
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+// Maps the whole file read-only instead of copying it; pages come in from the OS cache as they are touched.
+// Empty or missing files give nullptr. Unmap with the same size once done.
+//---------------------------------------------------------------------------------------------------------
+void const* FileMapReadOnly( std::string const& filepath, size_t* out_size )
+{
+#if defined( PLATFORM_WINDOWS )
+	HANDLE fileHandle = ::CreateFileA( filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+	if( fileHandle == INVALID_HANDLE_VALUE )
+	{
+		return nullptr;
+	}
+
+	LARGE_INTEGER fileSize;
+	void const* mappedData = nullptr;
+	if( ::GetFileSizeEx( fileHandle, &fileSize ) && fileSize.QuadPart > 0 )
+	{
+		HANDLE mappingHandle = ::CreateFileMappingA( fileHandle, NULL, PAGE_READONLY, 0, 0, NULL );
+		if( mappingHandle != NULL )
+		{
+			// The view keeps the mapping alive after both handles close
+			mappedData = ::MapViewOfFile( mappingHandle, FILE_MAP_READ, 0, 0, 0 );
+			::CloseHandle( mappingHandle );
+		}
+	}
+	::CloseHandle( fileHandle );
+
+	if( mappedData != nullptr && out_size != nullptr )
+	{
+		*out_size = static_cast<size_t>( fileSize.QuadPart );
+	}
+	return mappedData;
+#else
+	int fileDescriptor = open( filepath.c_str(), O_RDONLY );
+	if( fileDescriptor < 0 )
+	{
+		return nullptr;
+	}
+
+	struct stat fileInfo;
+	void* mappedData = MAP_FAILED;
+	if( fstat( fileDescriptor, &fileInfo ) == 0 && fileInfo.st_size > 0 )
+	{
+		mappedData = mmap( nullptr, static_cast<size_t>( fileInfo.st_size ), PROT_READ, MAP_PRIVATE, fileDescriptor, 0 );
+	}
+	close( fileDescriptor );
+
+	if( mappedData == MAP_FAILED )
+	{
+		return nullptr;
+	}
+
+	if( out_size != nullptr )
+	{
+		*out_size = static_cast<size_t>( fileInfo.st_size );
+	}
+	return mappedData;
+#endif
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void FileUnmap( void const* mappedData, size_t size )
+{
+	if( mappedData == nullptr )
+	{
+		return;
+	}
+
+#if defined( PLATFORM_WINDOWS )
+	UNUSED( size );
+	::UnmapViewOfFile( mappedData );
+#else
+	munmap( const_cast<void*>( mappedData ), size );
+#endif
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 Strings GetFileNamesInFolder( std::string const& folderpath, const char* filePattern )
 {
 	Strings fileNamesInFolder;
 
-#ifdef _WIN32
+#if defined( PLATFORM_WINDOWS )
 	std::string fileNamePattern = filePattern ? filePattern : "*";
 	std::string filePath = folderpath + "/" + fileNamePattern;
 	_finddata_t fileInfo;
@@ -65,7 +172,21 @@ Strings GetFileNamesInFolder( std::string const& folderpath, const char* filePat
 			break;
 	}
 #else
-	ERROR_AND_DIE( Stringf( "Not yet implemented for platform!" ) );
+	char const* fileNamePattern = filePattern ? filePattern : "*";
+	DIR* folder = opendir( folderpath.c_str() );
+	if( folder == nullptr )
+	{
+		return fileNamesInFolder;
+	}
+
+	for( dirent* folderEntry = readdir( folder ); folderEntry != nullptr; folderEntry = readdir( folder ) )
+	{
+		if( fnmatch( fileNamePattern, folderEntry->d_name, 0 ) == 0 )
+		{
+			fileNamesInFolder.push_back( folderEntry->d_name );
+		}
+	}
+	closedir( folder );
 #endif
 
 	return fileNamesInFolder;
@@ -83,6 +204,68 @@ std::string GetFileNameWithoutExtension( std::string const& filepath )
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+bool FileWriteFromBuffer( std::string const& filepath, void const* buffer, size_t size )
+{
+	FILE* fp = nullptr;
+	fopen_s( &fp, filepath.c_str(), "wb" );
+	if( fp == nullptr )
+	{
+		return false;
+	}
+
+	size_t bytesWritten = fwrite( buffer, 1, size, fp );
+	fclose( fp );
+	return bytesWritten == size;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool GetFileModificationInfo( std::string const& filepath, int64_t* out_modifiedTime, size_t* out_size )
+{
+#if defined( PLATFORM_WINDOWS )
+	struct _stat64 fileInfo;
+	if( _stat64( filepath.c_str(), &fileInfo ) != 0 )
+	{
+		return false;
+	}
+#else
+	struct stat fileInfo;
+	if( stat( filepath.c_str(), &fileInfo ) != 0 )
+	{
+		return false;
+	}
+#endif
+
+	if( out_modifiedTime != nullptr )
+	{
+		*out_modifiedTime = static_cast<int64_t>( fileInfo.st_mtime );
+	}
+	if( out_size != nullptr )
+	{
+		*out_size = static_cast<size_t>( fileInfo.st_size );
+	}
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Creates a single folder; succeeds if it already exists
+bool CreateFolder( std::string const& folderpath )
+{
+#if defined( PLATFORM_WINDOWS )
+	int errorCode = _mkdir( folderpath.c_str() );
+#else
+	int errorCode = mkdir( folderpath.c_str(), 0755 );
+#endif
+	if( errorCode == 0 )
+	{
+		return true;
+	}
+	return errno == EEXIST;
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 bool IsObjFile( std::string const& filepath )
 {
@@ -231,7 +414,11 @@ bool ReadAndParseObjFile( std::string const& filepath, std::vector<Vertex_PCUTBN
 	std::vector<Vec2> uvs;
 
 	char const* fileAsString = FileReadToString( filepath );
+	if( fileAsString == nullptr )
+		return false;
+
 	Strings fileLines = SplitStringOnDelimiter( fileAsString, '\n' );
+	delete[] fileAsString;
 
 	//Read File line by line
 	for( unsigned int lineIndex = 0; lineIndex < fileLines.size(); ++lineIndex )
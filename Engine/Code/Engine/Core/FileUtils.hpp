@@ -2,6 +2,7 @@
 #include "Engine/Core/StringUtils.hpp"
 #include <string>
 #include <vector>
+#include <stdint.h>
 
 struct Vec2;
 struct Vec3;
@@ -19,9 +20,15 @@ struct last_indicies_used_t
 //---------------------------------------------------------------------------------------------------------
 //Generic File Methods
 void*		FileReadToNewBuffer( std::string const& filepath, size_t* out_size );
+void*		FileReadBinaryToNewBuffer( std::string const& filepath, size_t* out_size );
 char const*	FileReadToString( std::string const& filepath );
+void const*	FileMapReadOnly( std::string const& filepath, size_t* out_size );
+void		FileUnmap( void const* mappedData, size_t size );
 Strings		GetFileNamesInFolder( std::string const& folderpath, const char* filePattern );
 std::string	GetFileNameWithoutExtension( std::string const& filepath );
+bool		FileWriteFromBuffer( std::string const& filepath, void const* buffer, size_t size );
+bool		GetFileModificationInfo( std::string const& filepath, int64_t* out_modifiedTime, size_t* out_size );
+bool		CreateFolder( std::string const& folderpath );
 
 //---------------------------------------------------------------------------------------------------------
 //.obj File Methods
@@ -0,0 +1,229 @@
+#include "Engine/Core/HandlePool.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/EventSystem.hpp"
+#include "Engine/Core/NamedProperties.hpp"
+#include "Engine/Core/Time.hpp"
+#include <algorithm>
+
+
+//---------------------------------------------------------------------------------------------------------
+// About the size of a game projectile: position, velocity, lifetime and a couple of flags
+struct pool_benchmark_projectile_t
+{
+	float	positionX		= 0.f;
+	float	positionY		= 0.f;
+	float	velocityX		= 0.f;
+	float	velocityY		= 0.f;
+	float	secondsToLive	= 0.f;
+	int		damage			= 1;
+	bool	isGarbage		= false;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Lifetimes spread over a second so roughly 1/60th of the projectiles die and respawn every frame
+static float GetBenchmarkLifetime( uint32_t spawnIndex )
+{
+	return 0.1f + static_cast<float>( ( spawnIndex * 2654435761u ) % 1000u ) * 0.001f;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static bool UpdateBenchmarkProjectile( pool_benchmark_projectile_t& projectile, float deltaSeconds )
+{
+	projectile.positionX += projectile.velocityX * deltaSeconds;
+	projectile.positionY += projectile.velocityY * deltaSeconds;
+	projectile.secondsToLive -= deltaSeconds;
+	return projectile.secondsToLive <= 0.f;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static pool_benchmark_projectile_t MakeBenchmarkProjectile( uint32_t spawnIndex )
+{
+	pool_benchmark_projectile_t projectile;
+	projectile.velocityX = static_cast<float>( spawnIndex % 7 );
+	projectile.velocityY = static_cast<float>( spawnIndex % 5 );
+	projectile.secondsToLive = GetBenchmarkLifetime( spawnIndex );
+	return projectile;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// The fixed array of pointers games used: new into the first null slot found by a linear scan
+static double RunPointerArrayBenchmark( uint32_t objectCount, int frameCount, float deltaSeconds )
+{
+	std::vector<pool_benchmark_projectile_t*> projectiles( objectCount, nullptr );
+	uint32_t spawnIndex = 0;
+	for( uint32_t objectIndex = 0; objectIndex < objectCount; ++objectIndex )
+	{
+		projectiles[ objectIndex ] = new pool_benchmark_projectile_t( MakeBenchmarkProjectile( spawnIndex++ ) );
+	}
+
+	double startSeconds = GetCurrentTimeSeconds();
+	for( int frameIndex = 0; frameIndex < frameCount; ++frameIndex )
+	{
+		uint32_t deadCount = 0;
+		for( uint32_t objectIndex = 0; objectIndex < objectCount; ++objectIndex )
+		{
+			pool_benchmark_projectile_t* projectile = projectiles[ objectIndex ];
+			if( projectile != nullptr && UpdateBenchmarkProjectile( *projectile, deltaSeconds ) )
+			{
+				delete projectile;
+				projectiles[ objectIndex ] = nullptr;
+				++deadCount;
+			}
+		}
+
+		for( uint32_t respawnIndex = 0; respawnIndex < deadCount; ++respawnIndex )
+		{
+			pool_benchmark_projectile_t* newProjectile = new pool_benchmark_projectile_t( MakeBenchmarkProjectile( spawnIndex++ ) );
+			for( uint32_t objectIndex = 0; objectIndex < objectCount; ++objectIndex )
+			{
+				if( projectiles[ objectIndex ] == nullptr )
+				{
+					projectiles[ objectIndex ] = newProjectile;
+					break;
+				}
+			}
+		}
+	}
+	double elapsedSeconds = GetCurrentTimeSeconds() - startSeconds;
+
+	for( pool_benchmark_projectile_t* projectile : projectiles )
+	{
+		delete projectile;
+	}
+	return elapsedSeconds;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// A vector of pointers with garbage flags swept at the end of the frame
+static double RunGarbageSweepBenchmark( uint32_t objectCount, int frameCount, float deltaSeconds )
+{
+	std::vector<pool_benchmark_projectile_t*> projectiles;
+	projectiles.reserve( objectCount );
+	uint32_t spawnIndex = 0;
+	for( uint32_t objectIndex = 0; objectIndex < objectCount; ++objectIndex )
+	{
+		projectiles.push_back( new pool_benchmark_projectile_t( MakeBenchmarkProjectile( spawnIndex++ ) ) );
+	}
+
+	double startSeconds = GetCurrentTimeSeconds();
+	for( int frameIndex = 0; frameIndex < frameCount; ++frameIndex )
+	{
+		for( pool_benchmark_projectile_t* projectile : projectiles )
+		{
+			projectile->isGarbage = UpdateBenchmarkProjectile( *projectile, deltaSeconds );
+		}
+
+		uint32_t liveCount = 0;
+		for( uint32_t objectIndex = 0; objectIndex < projectiles.size(); ++objectIndex )
+		{
+			pool_benchmark_projectile_t* projectile = projectiles[ objectIndex ];
+			if( projectile->isGarbage )
+			{
+				delete projectile;
+				continue;
+			}
+			projectiles[ liveCount++ ] = projectile;
+		}
+		projectiles.resize( liveCount );
+
+		while( projectiles.size() < objectCount )
+		{
+			projectiles.push_back( new pool_benchmark_projectile_t( MakeBenchmarkProjectile( spawnIndex++ ) ) );
+		}
+	}
+	double elapsedSeconds = GetCurrentTimeSeconds() - startSeconds;
+
+	for( pool_benchmark_projectile_t* projectile : projectiles )
+	{
+		delete projectile;
+	}
+	return elapsedSeconds;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static double RunHandlePoolBenchmark( uint32_t objectCount, int frameCount, float deltaSeconds, uint32_t& out_staleHandleCount )
+{
+	HandlePool<pool_benchmark_projectile_t> projectiles( objectCount );
+	uint32_t spawnIndex = 0;
+	for( uint32_t objectIndex = 0; objectIndex < objectCount; ++objectIndex )
+	{
+		projectiles.Create( MakeBenchmarkProjectile( spawnIndex++ ) );
+	}
+
+	// Something like a homing missile's target: remember one projectile and check it every frame
+	PoolHandle trackedHandle = projectiles.GetHandleAtIndex( 0 );
+	out_staleHandleCount = 0;
+
+	double startSeconds = GetCurrentTimeSeconds();
+	for( int frameIndex = 0; frameIndex < frameCount; ++frameIndex )
+	{
+		uint32_t objectIndex = 0;
+		while( objectIndex < projectiles.GetCount() )
+		{
+			if( UpdateBenchmarkProjectile( projectiles[ objectIndex ], deltaSeconds ) )
+			{
+				// The last object moves into this index, so stay and update it next
+				projectiles.DestroyAtIndex( objectIndex );
+				continue;
+			}
+			++objectIndex;
+		}
+
+		while( !projectiles.IsFull() )
+		{
+			projectiles.Create( MakeBenchmarkProjectile( spawnIndex++ ) );
+		}
+
+		if( !projectiles.IsAlive( trackedHandle ) )
+		{
+			++out_staleHandleCount;
+			trackedHandle = projectiles.GetHandleAtIndex( frameIndex % projectiles.GetCount() );
+		}
+	}
+	return GetCurrentTimeSeconds() - startSeconds;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void PrintHandlePoolBenchmark( uint32_t objectCount, int frameCount )
+{
+	if( objectCount == 0 || frameCount <= 0 )
+		return;
+
+	float const deltaSeconds = 1.f / 60.f;
+	uint32_t staleHandleCount = 0;
+
+	double pointerArraySeconds	= RunPointerArrayBenchmark( objectCount, frameCount, deltaSeconds );
+	double garbageSweepSeconds	= RunGarbageSweepBenchmark( objectCount, frameCount, deltaSeconds );
+	double handlePoolSeconds	= RunHandlePoolBenchmark( objectCount, frameCount, deltaSeconds, staleHandleCount );
+
+	double const millisecondsPerFrame = 1000.0 / static_cast<double>( frameCount );
+	g_theConsole->PrintString( Rgba8::WHITE, "Pool benchmark: %u projectiles, %i frames, ms per frame", objectCount, frameCount );
+	g_theConsole->PrintString( Rgba8::WHITE, "  pointer array + null scan  %8.3f", pointerArraySeconds * millisecondsPerFrame );
+	g_theConsole->PrintString( Rgba8::WHITE, "  vector + garbage sweep     %8.3f", garbageSweepSeconds * millisecondsPerFrame );
+	g_theConsole->PrintString( Rgba8::WHITE, "  handle pool                %8.3f  (%u stale handles caught)", handlePoolSeconds * millisecondsPerFrame, staleHandleCount );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void pool_benchmark( EventArgs* args )
+{
+	int objectCount = args->GetValue( "count", 100000 );
+	int frameCount = args->GetValue( "frames", 60 );
+	PrintHandlePoolBenchmark( static_cast<uint32_t>( objectCount ), frameCount );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void SubscribeHandlePoolCommands()
+{
+	GUARANTEE_OR_DIE( g_theEventSystem != nullptr, "Handle pool commands need the event system" );
+	g_theEventSystem->SubscribeEventCallbackFunction( "pool_benchmark", pool_benchmark );
+}
@@ -0,0 +1,220 @@
+#pragma once
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+
+//---------------------------------------------------------------------------------------------------------
+// Names an object in a HandlePool. The generation is bumped every time a slot is freed, so a handle kept
+// after its object was destroyed stops resolving instead of pointing at whatever reused the slot.
+//---------------------------------------------------------------------------------------------------------
+struct PoolHandle
+{
+public:
+	static constexpr uint32_t INVALID_SLOT_INDEX = 0xFFFFFFFF;
+
+	uint32_t slotIndex	= INVALID_SLOT_INDEX;
+	uint32_t generation	= 0;
+
+public:
+	bool IsNull() const										{ return slotIndex == INVALID_SLOT_INDEX; }
+	bool operator==( PoolHandle const& compare ) const		{ return slotIndex == compare.slotIndex && generation == compare.generation; }
+	bool operator!=( PoolHandle const& compare ) const		{ return !( *this == compare ); }
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Fixed capacity slot map. Live objects are packed at the front of one array, so iterating them is a
+// straight walk with no null checks; a handle goes through a slot table to find where its object currently
+// sits. Create and Destroy are O(1) - Destroy moves the last object into the hole - so raw pointers and
+// references stay good only until the next Destroy. Hold handles across frames, never pointers.
+//
+// Create returns a null handle once the pool is full.
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+class HandlePool
+{
+public:
+	explicit HandlePool( uint32_t capacity );
+	~HandlePool() {}
+
+	HandlePool( HandlePool const& copy ) = delete;
+	HandlePool& operator=( HandlePool const& copy ) = delete;
+
+	template<typename ...ARGS>
+	PoolHandle	Create( ARGS&&... args );
+	bool		Destroy( PoolHandle handle );
+	void		DestroyAtIndex( uint32_t index );
+	void		Clear();
+
+	T*			Get( PoolHandle handle );
+	T const*	Get( PoolHandle handle ) const;
+	bool		IsAlive( PoolHandle handle ) const						{ return Get( handle ) != nullptr; }
+	PoolHandle	GetHandleAtIndex( uint32_t index ) const;
+
+	uint32_t	GetCount() const										{ return static_cast<uint32_t>( m_objects.size() ); }
+	uint32_t	GetCapacity() const										{ return static_cast<uint32_t>( m_slots.size() ); }
+	bool		IsFull() const											{ return m_objects.size() == m_slots.size(); }
+
+	// Dense access; indices shift whenever something is destroyed
+	T&			operator[]( uint32_t index )							{ return m_objects[ index ]; }
+	T const&	operator[]( uint32_t index ) const						{ return m_objects[ index ]; }
+	T*			begin()													{ return m_objects.data(); }
+	T*			end()													{ return m_objects.data() + m_objects.size(); }
+	T const*	begin() const											{ return m_objects.data(); }
+	T const*	end() const												{ return m_objects.data() + m_objects.size(); }
+
+private:
+	// While a slot is free, objectIndex links to the next free slot
+	struct slot_t
+	{
+		uint32_t objectIndex	= 0;
+		uint32_t generation		= 1;
+	};
+
+private:
+	std::vector<T>			m_objects;
+	std::vector<uint32_t>	m_slotIndexOfObject;	// parallel to m_objects
+	std::vector<slot_t>		m_slots;
+	uint32_t				m_firstFreeSlot		= PoolHandle::INVALID_SLOT_INDEX;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Churns objectCount projectile-sized objects through a raw pointer array, a vector with a garbage sweep
+// and a HandlePool, and prints the frame cost of each
+void PrintHandlePoolBenchmark( uint32_t objectCount, int frameCount );
+
+
+//---------------------------------------------------------------------------------------------------------
+// Adds the pool_benchmark console command; Clock::BeginFrame calls this once the event system exists
+void SubscribeHandlePoolCommands();
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+HandlePool<T>::HandlePool( uint32_t capacity )
+{
+	GUARANTEE_OR_DIE( capacity < PoolHandle::INVALID_SLOT_INDEX, "HandlePool capacity too large" );
+
+	m_objects.reserve( capacity );
+	m_slotIndexOfObject.reserve( capacity );
+	m_slots.resize( capacity );
+	Clear();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+template<typename ...ARGS>
+PoolHandle HandlePool<T>::Create( ARGS&&... args )
+{
+	PoolHandle handle;
+	if( m_firstFreeSlot == PoolHandle::INVALID_SLOT_INDEX )
+		return handle;
+
+	uint32_t slotIndex = m_firstFreeSlot;
+	slot_t& slot = m_slots[ slotIndex ];
+	m_firstFreeSlot = slot.objectIndex;
+
+	slot.objectIndex = static_cast<uint32_t>( m_objects.size() );
+	m_objects.emplace_back( std::forward<ARGS>( args )... );
+	m_slotIndexOfObject.push_back( slotIndex );
+
+	handle.slotIndex = slotIndex;
+	handle.generation = slot.generation;
+	return handle;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+bool HandlePool<T>::Destroy( PoolHandle handle )
+{
+	if( !IsAlive( handle ) )
+		return false;
+
+	DestroyAtIndex( m_slots[ handle.slotIndex ].objectIndex );
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+void HandlePool<T>::DestroyAtIndex( uint32_t index )
+{
+	uint32_t lastIndex = static_cast<uint32_t>( m_objects.size() ) - 1;
+	uint32_t slotIndex = m_slotIndexOfObject[ index ];
+
+	if( index != lastIndex )
+	{
+		m_objects[ index ] = std::move( m_objects[ lastIndex ] );
+		m_slotIndexOfObject[ index ] = m_slotIndexOfObject[ lastIndex ];
+		m_slots[ m_slotIndexOfObject[ index ] ].objectIndex = index;
+	}
+	m_objects.pop_back();
+	m_slotIndexOfObject.pop_back();
+
+	slot_t& slot = m_slots[ slotIndex ];
+	++slot.generation;
+	slot.objectIndex = m_firstFreeSlot;
+	m_firstFreeSlot = slotIndex;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Generations keep counting up through a Clear, so handles from before it go stale too
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+void HandlePool<T>::Clear()
+{
+	for( uint32_t objectIndex = 0; objectIndex < m_slotIndexOfObject.size(); ++objectIndex )
+	{
+		++m_slots[ m_slotIndexOfObject[ objectIndex ] ].generation;
+	}
+	m_objects.clear();
+	m_slotIndexOfObject.clear();
+
+	// Thread the free list in slot order so a fresh pool hands out slots 0, 1, 2...
+	uint32_t capacity = GetCapacity();
+	for( uint32_t slotIndex = 0; slotIndex < capacity; ++slotIndex )
+	{
+		m_slots[ slotIndex ].objectIndex = ( slotIndex + 1 < capacity ) ? slotIndex + 1 : PoolHandle::INVALID_SLOT_INDEX;
+	}
+	m_firstFreeSlot = ( capacity > 0 ) ? 0 : PoolHandle::INVALID_SLOT_INDEX;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+T* HandlePool<T>::Get( PoolHandle handle )
+{
+	return const_cast<T*>( static_cast<HandlePool<T> const*>( this )->Get( handle ) );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+T const* HandlePool<T>::Get( PoolHandle handle ) const
+{
+	if( handle.slotIndex >= m_slots.size() )
+		return nullptr;
+
+	slot_t const& slot = m_slots[ handle.slotIndex ];
+	if( slot.generation != handle.generation )
+		return nullptr;
+
+	return &m_objects[ slot.objectIndex ];
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+PoolHandle HandlePool<T>::GetHandleAtIndex( uint32_t index ) const
+{
+	PoolHandle handle;
+	handle.slotIndex = m_slotIndexOfObject[ index ];
+	handle.generation = m_slots[ handle.slotIndex ].generation;
+	return handle;
+}
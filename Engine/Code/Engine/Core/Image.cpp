@@ -1,44 +1,133 @@
-//#define STB_IMAGE_IMPLEMENTATION
+#define STB_IMAGE_IMPLEMENTATION
 #include "ThirdParty/stb/stb_image.h"
 
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/Image.hpp"
 #include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include <algorithm>
+#include <stdlib.h>
 
 
 //---------------------------------------------------------------------------------------------------------
-Image::Image( const char* imageFilePath )
+// Decodes as RGBA8 (stb expands RGB for us) and keeps stb's output buffer as the texel storage, so a load is
+// one decode and no copy. Flipping swaps rows in place rather than going through
+// stbi_set_flip_vertically_on_load, since that flag is global and images decode on workers.
+//---------------------------------------------------------------------------------------------------------
+Image::Image( const char* imageFilePath, bool flipVertically )
 	: m_imageFilePath( imageFilePath )
 {
 	int numComponents = 0;
-	int numComponentsRequested = 0;
+	int numComponentsRequested = 4;
 
-	stbi_set_flip_vertically_on_load( 0 ); //Start position is Bottom Left;
-	unsigned char* imageData = stbi_load( m_imageFilePath.c_str(), &m_dimensions.x, &m_dimensions.y, &numComponents, numComponentsRequested );
+	m_rgbaTexels = stbi_load( m_imageFilePath.c_str(), &m_dimensions.x, &m_dimensions.y, &numComponents, numComponentsRequested );
 
 	// Check if the load was successful
-	GUARANTEE_OR_DIE( imageData, Stringf( "Failed to load image \"%s\"", imageFilePath ) );
+	GUARANTEE_OR_DIE( m_rgbaTexels, Stringf( "Failed to load image \"%s\"", imageFilePath ) );
 	GUARANTEE_OR_DIE( numComponents >= 3 && numComponents <= 4 && m_dimensions.x > 0 && m_dimensions.y > 0, Stringf( "ERROR loading image \"%s\" (Bpp=%i, size=%i,%i)", imageFilePath, numComponents, m_dimensions.x, m_dimensions.y ) );
 
-	int imageDataSize = ( m_dimensions.x * m_dimensions.y ) * numComponents;
-
-	for( int texelIndex = 0; texelIndex < imageDataSize; texelIndex += numComponents )
+	if( flipVertically )
 	{
-		unsigned char a = 255;
-		unsigned char r = imageData[ texelIndex ];
-		unsigned char g = imageData[ texelIndex + 1 ];
-		unsigned char b = imageData[ texelIndex + 2 ];
-
-		if( numComponents == 4 )
+		size_t rowSizeBytes = static_cast<size_t>( m_dimensions.x ) * sizeof( Rgba8 );
+		for( int rowIndex = 0; rowIndex < m_dimensions.y / 2; ++rowIndex )
 		{
-			a = imageData[ texelIndex + 3 ];
+			unsigned char* rowBytes = &m_rgbaTexels[ rowIndex * rowSizeBytes ];
+			unsigned char* mirrorRowBytes = &m_rgbaTexels[ ( m_dimensions.y - 1 - rowIndex ) * rowSizeBytes ];
+			std::swap_ranges( rowBytes, rowBytes + rowSizeBytes, mirrorRowBytes );
 		}
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// A blank image to draw into, e.g. an atlas page
+//---------------------------------------------------------------------------------------------------------
+Image::Image( const char* imageName, IntVec2 const& dimensions, Rgba8 const& clearColor )
+	: m_imageFilePath( imageName )
+	, m_dimensions( dimensions )
+{
+	GUARANTEE_OR_DIE( m_dimensions.x > 0 && m_dimensions.y > 0, Stringf( "Cannot create image \"%s\" of size %i,%i", imageName, m_dimensions.x, m_dimensions.y ) );
+
+	// stb_image allocates with plain malloc (STBI_MALLOC is left as the default), so every image can free the same way
+	size_t texelCount = static_cast<size_t>( m_dimensions.x ) * static_cast<size_t>( m_dimensions.y );
+	m_rgbaTexels = static_cast<unsigned char*>( malloc( texelCount * sizeof( Rgba8 ) ) );
+
+	Rgba8* texels = reinterpret_cast<Rgba8*>( m_rgbaTexels );
+	for( size_t texelIndex = 0; texelIndex < texelCount; ++texelIndex )
+	{
+		texels[ texelIndex ] = clearColor;
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+Image::Image( Image const& copyFrom )
+	: m_imageFilePath( copyFrom.m_imageFilePath )
+	, m_dimensions( copyFrom.m_dimensions )
+{
+	if( copyFrom.m_rgbaTexels != nullptr )
+	{
+		m_rgbaTexels = static_cast<unsigned char*>( malloc( copyFrom.GetRawDataSizeBytes() ) );
+		memcpy( m_rgbaTexels, copyFrom.m_rgbaTexels, copyFrom.GetRawDataSizeBytes() );
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+Image::Image( Image&& moveFrom ) noexcept
+	: m_imageFilePath( std::move( moveFrom.m_imageFilePath ) )
+	, m_dimensions( moveFrom.m_dimensions )
+	, m_rgbaTexels( moveFrom.m_rgbaTexels )
+{
+	moveFrom.m_dimensions = IntVec2( 0, 0 );
+	moveFrom.m_rgbaTexels = nullptr;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+Image::~Image()
+{
+	FreeTexels();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+Image& Image::operator=( Image const& copyFrom )
+{
+	if( this != &copyFrom )
+	{
+		Image copy( copyFrom );
+		*this = std::move( copy );
+	}
+	return *this;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+Image& Image::operator=( Image&& moveFrom ) noexcept
+{
+	if( this != &moveFrom )
+	{
+		FreeTexels();
+		m_imageFilePath = std::move( moveFrom.m_imageFilePath );
+		m_dimensions = moveFrom.m_dimensions;
+		m_rgbaTexels = moveFrom.m_rgbaTexels;
 
-		Rgba8 newTexel( r, g, b, a );
-		m_rgbaTexles.push_back( newTexel );
+		moveFrom.m_dimensions = IntVec2( 0, 0 );
+		moveFrom.m_rgbaTexels = nullptr;
 	}
+	return *this;
+}
+
 
-	stbi_image_free( imageData );
+//---------------------------------------------------------------------------------------------------------
+void Image::FreeTexels()
+{
+	if( m_rgbaTexels != nullptr )
+	{
+		stbi_image_free( m_rgbaTexels );
+		m_rgbaTexels = nullptr;
+	}
 }
 
 
@@ -56,11 +145,25 @@ IntVec2 Image::GetDimensions() const
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+const void* Image::GetRawData() const
+{
+	return m_rgbaTexels;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+size_t Image::GetRawDataSizeBytes() const
+{
+	return static_cast<size_t>( m_dimensions.x ) * static_cast<size_t>( m_dimensions.y ) * sizeof( Rgba8 );
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 Rgba8 Image::GetTexelColor( int texelX, int texelY ) const
 {
 	int texelIndex = ( texelY * m_dimensions.x ) + texelX;
-	return m_rgbaTexles[ texelIndex ];
+	return reinterpret_cast<Rgba8 const*>( m_rgbaTexels )[ texelIndex ];
 }
 
 
@@ -75,7 +178,7 @@ Rgba8 Image::GetTexelColor( IntVec2 texelCoords ) const
 void Image::SetTexelColor( int texelX, int texelY, const Rgba8& newTexelColor )
 {
 	int texelIndex = ( texelY * m_dimensions.x ) + texelX;
-	m_rgbaTexles[ texelIndex ] = newTexelColor;
+	reinterpret_cast<Rgba8*>( m_rgbaTexels )[ texelIndex ] = newTexelColor;
 }
 
 
@@ -84,3 +187,61 @@ void Image::SetTexelColor( IntVec2 texelCoords, const Rgba8& newTexelColor )
 {
 	SetTexelColor( texelCoords.x, texelCoords.y, newTexelColor );
 }
+
+
+//---------------------------------------------------------------------------------------------------------
+void Image::CopyTexelRow( int texelX, int texelY, int texelCount, void const* sourceRgbaTexels )
+{
+	GUARANTEE_OR_DIE( texelX >= 0 && texelY >= 0 && texelX + texelCount <= m_dimensions.x && texelY < m_dimensions.y, Stringf( "Texel row copy out of bounds in image \"%s\"", m_imageFilePath.c_str() ) );
+
+	int texelIndex = ( texelY * m_dimensions.x ) + texelX;
+	memcpy( &m_rgbaTexels[ texelIndex * sizeof( Rgba8 ) ], sourceRgbaTexels, static_cast<size_t>( texelCount ) * sizeof( Rgba8 ) );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+Image Image::CreateHalfSizeMip() const
+{
+	IntVec2 mipDimensions( m_dimensions.x > 1 ? m_dimensions.x / 2 : 1, m_dimensions.y > 1 ? m_dimensions.y / 2 : 1 );
+	Image mip( m_imageFilePath.c_str(), mipDimensions, Rgba8( 0, 0, 0, 0 ) );
+
+	size_t const sourceRowSizeBytes = static_cast<size_t>( m_dimensions.x ) * sizeof( Rgba8 );
+	unsigned char* mipTexelBytes = mip.m_rgbaTexels;
+	for( int mipY = 0; mipY < mipDimensions.y; ++mipY )
+	{
+		// Clamped so a 1 texel tall source averages its row with itself
+		int sourceY0 = mipY * 2;
+		int sourceY1 = GetClamp( sourceY0 + 1, 0, m_dimensions.y - 1 );
+		unsigned char const* sourceRow0 = &m_rgbaTexels[ sourceY0 * sourceRowSizeBytes ];
+		unsigned char const* sourceRow1 = &m_rgbaTexels[ sourceY1 * sourceRowSizeBytes ];
+
+		for( int mipX = 0; mipX < mipDimensions.x; ++mipX )
+		{
+			size_t sourceX0 = static_cast<size_t>( mipX * 2 ) * sizeof( Rgba8 );
+			size_t sourceX1 = static_cast<size_t>( GetClamp( mipX * 2 + 1, 0, m_dimensions.x - 1 ) ) * sizeof( Rgba8 );
+			for( int channelIndex = 0; channelIndex < 4; ++channelIndex )
+			{
+				int channelSum = sourceRow0[ sourceX0 + channelIndex ] + sourceRow0[ sourceX1 + channelIndex ]
+								+ sourceRow1[ sourceX0 + channelIndex ] + sourceRow1[ sourceX1 + channelIndex ];
+				*mipTexelBytes = static_cast<unsigned char>( ( channelSum + 2 ) >> 2 );
+				++mipTexelBytes;
+			}
+		}
+	}
+
+	return mip;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+int Image::GetFullMipChainLength() const
+{
+	int mipCount = 1;
+	int largestDimension = m_dimensions.x > m_dimensions.y ? m_dimensions.x : m_dimensions.y;
+	while( largestDimension > 1 )
+	{
+		largestDimension >>= 1;
+		++mipCount;
+	}
+	return mipCount;
+}
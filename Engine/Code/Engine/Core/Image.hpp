@@ -8,16 +8,34 @@ struct Rgba8;
 struct Image
 {
 public:
-	Image( const char* imageFilePath );
+	Image( const char* imageFilePath, bool flipVertically = false );
+	explicit Image( const char* imageName, IntVec2 const& dimensions, Rgba8 const& clearColor );
+	Image( Image const& copyFrom );
+	Image( Image&& moveFrom ) noexcept;
+	~Image();
+
+	Image&				operator=( Image const& copyFrom );
+	Image&				operator=( Image&& moveFrom ) noexcept;
+
 	const std::string&	GetImageFilePath() const;
 	IntVec2				GetDimensions() const;
+	const void*			GetRawData() const;
+	size_t				GetRawDataSizeBytes() const;
 	Rgba8				GetTexelColor( int texelX, int texelY ) const;
 	Rgba8				GetTexelColor( IntVec2 texelCoords ) const;
 	void				SetTexelColor( int texelX, int texelY, const Rgba8& newTexelColor );
 	void				SetTexelColor( IntVec2 texelCoords, const Rgba8& newTexelColor );
+	void				CopyTexelRow( int texelX, int texelY, int texelCount, void const* sourceRgbaTexels );
+
+	// Box filtered 2x2 -> 1 (an odd last row or column is dropped), for mip chains built on the CPU
+	Image				CreateHalfSizeMip() const;
+	int					GetFullMipChainLength() const;
+
+private:
+	void				FreeTexels();
 
 private:
 	std::string				m_imageFilePath;
 	IntVec2					m_dimensions = IntVec2( 0, 0 );
-	std::vector< Rgba8 >	m_rgbaTexles;
+	unsigned char*			m_rgbaTexels = nullptr;		// tightly packed RGBA8 rows, malloc'd (stb_image's own buffer when decoded)
 };
\ No newline at end of file
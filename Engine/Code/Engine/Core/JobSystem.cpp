@@ -1,9 +1,29 @@
 #include "Engine/Core/JobSystem.hpp"
 #include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/Profiler.hpp"
+#include "Engine/Core/EventSystem.hpp"
+#include "Engine/Core/NamedProperties.hpp"
 
 //---------------------------------------------------------------------------------------------------------
 std::atomic<bool> g_isJobSystemQuitting = false;
 
+static char const* s_jobZoneNames[ NUM_JOB_CATEGORIES ] =
+{
+	"Job: Generic",
+	"Job: Render Asset Loading",
+	"Job: Audio Asset Loading",
+	"Job: Simulation",
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+static void queue_benchmark( EventArgs* args )
+{
+	int maxProducerCount = args->GetValue( "producers", 16 );
+	int itemsPerProducer = args->GetValue( "items", 200000 );
+	PrintQueueContentionBenchmark( maxProducerCount, itemsPerProducer );
+}
+
 
 //---------------------------------------------------------------------------------------------------------
 //
@@ -20,6 +40,14 @@ Job::Job()
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+Job::Job( JobCategory category )
+	: Job()
+{
+	m_category = category;
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 //---------------------------------------------------------------------------------------------------------
 
@@ -50,18 +78,18 @@ WorkerThread::~WorkerThread()
 //---------------------------------------------------------------------------------------------------------
 void WorkerThread::WorkerThreadMain()
 {
+	static std::atomic<uint> s_nextWorkerIndex = 0;
+	ProfilerSetThreadName( Stringf( "Worker %u", s_nextWorkerIndex++ ).c_str() );
+
 	while ( !g_isJobSystemQuitting )
 	{
-		Job* job = g_theJobSystem->GetBestAvailableJob();
+		Job* job = g_theJobSystem->WaitForAvailableJob( 0.1 );
 		if( job != nullptr )
 		{
+			PROFILE_SCOPE( s_jobZoneNames[ job->GetCategory() ] );
 			job->Execute();
 			g_theJobSystem->OnJobCompleted( job );
 		}
-		else
-		{
-			std::this_thread::sleep_for( std::chrono::microseconds(10) );
-		}
 	}
 }
 
@@ -77,11 +105,35 @@ void WorkerThread::WorkerThreadMain()
 //---------------------------------------------------------------------------------------------------------
 
 
+//---------------------------------------------------------------------------------------------------------
+JobSystem::JobSystem()
+	: m_jobsQueued( JOB_QUEUE_CAPACITY )
+{
+	// As deep as the pending queue, so a full frame's worth of posts can complete before anyone claims
+	for( int categoryIndex = 0; categoryIndex < NUM_JOB_CATEGORIES; ++categoryIndex )
+	{
+		m_jobsCompleted[ categoryIndex ] = new MPSCQueue<Job*>( JOB_QUEUE_CAPACITY );
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+JobSystem::~JobSystem()
+{
+	for( int categoryIndex = 0; categoryIndex < NUM_JOB_CATEGORIES; ++categoryIndex )
+	{
+		delete m_jobsCompleted[ categoryIndex ];
+		m_jobsCompleted[ categoryIndex ] = nullptr;
+	}
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 void JobSystem::ShutDown()
 {
 	// Order here is important to ensure we grab all threads and jobs
 	g_isJobSystemQuitting = true;
+	m_jobsQueued.WakeWaiters();
 
 	DeleteWorkerThreads();
 	DeleteQueuedJobs();
@@ -92,7 +144,7 @@ void JobSystem::ShutDown()
 //---------------------------------------------------------------------------------------------------------
 void JobSystem::DeleteWorkerThreads()
 {
-	for ( int workerThreadIndex = 0; workerThreadIndex < m_workerThreads.size(); ++workerThreadIndex )
+	for ( size_t workerThreadIndex = 0; workerThreadIndex < m_workerThreads.size(); ++workerThreadIndex )
 	{
 		delete m_workerThreads[ workerThreadIndex ];
 		m_workerThreads[ workerThreadIndex ] = nullptr;
@@ -103,30 +155,37 @@ void JobSystem::DeleteWorkerThreads()
 //---------------------------------------------------------------------------------------------------------
 void JobSystem::DeleteQueuedJobs()
 {
-	m_jobsQueuedMutex.lock();
-
-	for( auto jobIndexIter = m_jobsQueued.begin(); jobIndexIter != m_jobsQueued.end(); ++jobIndexIter )
-	{		
-		delete *jobIndexIter;
-		*jobIndexIter = nullptr;
+	Job* job = nullptr;
+	while( m_jobsQueued.Pop( job ) )
+	{
+		delete job;
 	}
-
-	m_jobsQueuedMutex.unlock();
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 void JobSystem::DeleteCompletedJobs()
 {
-	m_jobsCompletedMutex.lock();
-
-	for( auto jobIndexIter = m_jobsCompleted.begin(); jobIndexIter != m_jobsCompleted.end(); ++jobIndexIter )
-	{		
-		delete *jobIndexIter;
-		*jobIndexIter = nullptr;
+	for( int categoryIndex = 0; categoryIndex < NUM_JOB_CATEGORIES; ++categoryIndex )
+	{
+		Job* job = nullptr;
+		while( m_jobsCompleted[ categoryIndex ]->Pop( job ) )
+		{
+			delete job;
+		}
 	}
 
-	m_jobsCompletedMutex.unlock();
+	std::lock_guard<std::mutex> spillLock( m_spilledJobsLock );
+	for( int categoryIndex = 0; categoryIndex < NUM_JOB_CATEGORIES; ++categoryIndex )
+	{
+		std::vector<Job*>& spilledJobs = m_spilledJobs[ categoryIndex ];
+		for( size_t jobIndex = 0; jobIndex < spilledJobs.size(); ++jobIndex )
+		{
+			delete spilledJobs[ jobIndex ];
+		}
+		spilledJobs.clear();
+	}
+	m_spilledJobCount = 0;
 }
 
 
@@ -137,6 +196,13 @@ void JobSystem::CreateWorkerThreads( int numThreadsToCreate )
 	{
 		CreateWorkerThread();
 	}
+
+	static bool s_areCommandsSubscribed = false;
+	if( !s_areCommandsSubscribed && g_theEventSystem != nullptr )
+	{
+		g_theEventSystem->SubscribeEventCallbackFunction( "queue_benchmark", queue_benchmark );
+		s_areCommandsSubscribed = true;
+	}
 }
 
 
@@ -154,73 +220,99 @@ void JobSystem::PostJob( Job* job )
 {
 	GUARANTEE_OR_DIE( job != nullptr, "Cannot add add job nullptr to list" );
 
-	m_jobsQueuedMutex.lock();
-
-	m_jobsQueued.push_back( job );
-
-	m_jobsQueuedMutex.unlock();
+	while( !m_jobsQueued.Push( job ) )
+	{
+		// Full means the workers are behind; with none to drain it this would never return
+		GUARANTEE_OR_DIE( !m_workerThreads.empty(), Stringf( "Job queue is full (%u jobs) with no worker threads", static_cast<uint>( m_jobsQueued.GetCapacity() ) ) );
+		std::this_thread::yield();
+	}
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 void JobSystem::OnJobCompleted( Job* job )
 {
-	m_jobsRunningMutex.lock();
-	m_jobsCompletedMutex.lock();
-	
-	for( auto jobIter = m_jobsRunning.begin(); jobIter != m_jobsRunning.end(); ++jobIter )
+	if( job->IsFireAndForget() )
 	{
-		Job* runningJob = *jobIter;
-		if( runningJob == job )
-		{
-			m_jobsCompleted.push_back( job );
-			m_jobsRunning.erase( jobIter );
-			break;
-		}
+		delete job;
+		return;
 	}
 
-	m_jobsCompletedMutex.unlock();
-	m_jobsRunningMutex.unlock();
+	JobCategory category = job->GetCategory();
+	if( m_jobsCompleted[ category ]->Push( job ) )
+		return;
+
+	// Nobody has claimed this category in a while; park it rather than wait on a claim that may never come
+	std::lock_guard<std::mutex> spillLock( m_spilledJobsLock );
+	m_spilledJobs[ category ].push_back( job );
+	m_spilledJobCount++;
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 void JobSystem::ClaimAndDeleteAllCompletedJobs()
 {
-	std::deque<Job*> claimedJobs;
+	for( int categoryIndex = 0; categoryIndex < NUM_JOB_CATEGORIES; ++categoryIndex )
+	{
+		ClaimAndDeleteCompletedJobs( static_cast<JobCategory>( categoryIndex ) );
+	}
+}
 
-	m_jobsCompletedMutex.lock();
-	m_jobsCompleted.swap( claimedJobs );
-	m_jobsCompletedMutex.unlock();
 
-	for( auto claimedJobIter = claimedJobs.begin(); claimedJobIter != claimedJobs.end(); ++claimedJobIter )
+//---------------------------------------------------------------------------------------------------------
+void JobSystem::ClaimAndDeleteCompletedJobs( JobCategory category )
+{
+	MPSCQueue<Job*>& completedJobs = *m_jobsCompleted[ category ];
+
+	// Only claim what was there on entry so a steady stream of completions can't stall the frame
+	size_t claimCount = completedJobs.GetApproximateSize();
+	Job* job = nullptr;
+	for( size_t claimIndex = 0; claimIndex < claimCount && completedJobs.Pop( job ); ++claimIndex )
 	{
-		Job* job = *claimedJobIter;
 		job->OnCompleteCallback();
 		delete job;
 	}
+
+	if( m_spilledJobCount.load( std::memory_order_relaxed ) > 0 )
+	{
+		ClaimSpilledJobs( category );
+	}
 }
 
 
 //---------------------------------------------------------------------------------------------------------
-Job* JobSystem::GetBestAvailableJob()
+void JobSystem::ClaimSpilledJobs( JobCategory category )
 {
-	Job* job = nullptr;
-
-	m_jobsQueuedMutex.lock();
-
-	if( m_jobsQueued.size() > 0 )
+	// Swapped out first so callbacks run without the lock, and can post jobs of their own
+	std::vector<Job*> spilledJobs;
 	{
-		job = m_jobsQueued.front();
-		m_jobsQueued.pop_front();
+		std::lock_guard<std::mutex> spillLock( m_spilledJobsLock );
+		spilledJobs.swap( m_spilledJobs[ category ] );
+		m_spilledJobCount -= static_cast<uint>( spilledJobs.size() );
+	}
 
-		m_jobsRunningMutex.lock();
-		m_jobsRunning.push_back( job );
-		m_jobsRunningMutex.unlock();
+	for( size_t jobIndex = 0; jobIndex < spilledJobs.size(); ++jobIndex )
+	{
+		spilledJobs[ jobIndex ]->OnCompleteCallback();
+		delete spilledJobs[ jobIndex ];
 	}
+}
 
-	m_jobsQueuedMutex.unlock();
 
+//---------------------------------------------------------------------------------------------------------
+Job* JobSystem::GetBestAvailableJob()
+{
+	Job* job = nullptr;
+	m_jobsQueued.Pop( job );
+	return job;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+Job* JobSystem::WaitForAvailableJob( double maxWaitSeconds )
+{
+	Job* job = nullptr;
+	m_jobsQueued.PopWait( job, maxWaitSeconds );
 	return job;
 }
 
@@ -228,16 +320,8 @@ Job* JobSystem::GetBestAvailableJob()
 //---------------------------------------------------------------------------------------------------------
 void JobSystem::WaitForAllJobs()
 {
-	bool isWaitingForJobs = true;
-	while( isWaitingForJobs )
+	while( !m_jobsQueued.IsEmpty() )
 	{
-		m_jobsQueuedMutex.lock();
-		if( m_jobsQueued.size() <= 0 )
-		{
-			isWaitingForJobs = false;
-		}
-		m_jobsQueuedMutex.unlock();
 		std::this_thread::sleep_for( std::chrono::microseconds(10) );
 	}
-}
-
+}
\ No newline at end of file
@@ -1,27 +1,52 @@
 #pragma once
 #include "Engine/Core/EngineCommon.hpp"
-#include <mutex>
+#include "Engine/Core/BlockPool.hpp"
+#include "Engine/Core/LockFreeQueue.hpp"
 #include <atomic>
+#include <mutex>
 #include <vector>
-#include <deque>
 #include <thread>
 
 
 //---------------------------------------------------------------------------------------------------------
 extern std::atomic<bool> g_isJobSystemQuitting;
 
+constexpr size_t JOB_QUEUE_CAPACITY = 4096;
+
 
 //---------------------------------------------------------------------------------------------------------
-class Job
+// Completed jobs can be claimed per category so a system only runs the callbacks it owns
+enum JobCategory
+{
+	JOB_CATEGORY_GENERIC,
+	JOB_CATEGORY_RENDER_ASSET_LOADING,
+	JOB_CATEGORY_AUDIO_ASSET_LOADING,
+	JOB_CATEGORY_SIMULATION,
+
+	NUM_JOB_CATEGORIES
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+class Job : public PoolAllocated
 {
 public:
 	Job();
+	explicit Job( JobCategory category );
 	virtual ~Job() {}
 	virtual void Execute() = 0;
 	virtual void OnCompleteCallback() = 0;
 
+	JobCategory GetCategory() const		{ return m_category; }
+
+	// Fire-and-forget jobs are deleted by the worker that ran them and never reach a completed queue, so
+	// their OnCompleteCallback never runs; whoever posted them tracks completion from Execute
+	bool		IsFireAndForget() const	{ return m_isFireAndForget; }
+
 protected:
-	int		m_jobID = 0;
+	int			m_jobID				= 0;
+	JobCategory	m_category			= JOB_CATEGORY_GENERIC;
+	bool		m_isFireAndForget	= false;
 };
 
 
@@ -43,8 +68,8 @@ private:
 class JobSystem
 {
 public:
-	JobSystem() {};
-	~JobSystem() {};
+	JobSystem();
+	~JobSystem();
 
 	void ShutDown();
 
@@ -58,16 +83,24 @@ public:
 	void PostJob( Job* job );
 	void OnJobCompleted( Job* job );
 	Job* GetBestAvailableJob();
+	Job* WaitForAvailableJob( double maxWaitSeconds );
 	void WaitForAllJobs();
 	void ClaimAndDeleteAllCompletedJobs();
+	void ClaimAndDeleteCompletedJobs( JobCategory category );
+	int  GetWorkerThreadCount() const		{ return static_cast<int>( m_workerThreads.size() ); }
+
+private:
+	void ClaimSpilledJobs( JobCategory category );
 
 private:
-	std::deque< Job* >	m_jobsQueued;
-	std::deque< Job* >	m_jobsRunning;
-	std::deque< Job* >	m_jobsCompleted;
-	std::mutex			m_jobsQueuedMutex;
-	std::mutex			m_jobsRunningMutex;
-	std::mutex			m_jobsCompletedMutex;
+	// Any thread posts, every worker pops; completed jobs are only ever claimed from the main thread
+	MPMCQueue< Job* >	m_jobsQueued;
+	MPSCQueue< Job* >*	m_jobsCompleted[ NUM_JOB_CATEGORIES ]	= {};
+
+	// Completions that found their category's queue full; a worker must never wait on a category nobody claims
+	std::mutex			m_spilledJobsLock;
+	std::vector< Job* >	m_spilledJobs[ NUM_JOB_CATEGORIES ];
+	std::atomic<uint>	m_spilledJobCount						= 0;
 
 	std::vector< WorkerThread* > m_workerThreads;
 };
\ No newline at end of file
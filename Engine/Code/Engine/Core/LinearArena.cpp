@@ -0,0 +1,117 @@
+#include "Engine/Core/LinearArena.hpp"
+#include "Engine/Core/MemoryTracker.hpp"
+#include <stdlib.h>
+
+
+//---------------------------------------------------------------------------------------------------------
+LinearArena::LinearArena( size_t initialCapacityBytes, char const* name )
+	: m_name( name )
+{
+	m_currentBlock = CreateBlock( initialCapacityBytes );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+LinearArena::~LinearArena()
+{
+	while( m_currentBlock != nullptr )
+	{
+		ArenaBlock* previousBlock = m_currentBlock->m_previous;
+		DestroyBlock( m_currentBlock );
+		m_currentBlock = previousBlock;
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void* LinearArena::Allocate( size_t byteCount, size_t alignment )
+{
+	ASSERT_OR_DIE( alignment != 0 && ( alignment & ( alignment - 1 ) ) == 0, "LinearArena alignment must be a power of two" );
+
+	uintptr_t blockStart = reinterpret_cast<uintptr_t>( GetBlockData( m_currentBlock ) );
+	uintptr_t alignedAddress = ( blockStart + m_currentBlock->m_offset + alignment - 1 ) & ~( static_cast<uintptr_t>( alignment ) - 1 );
+	size_t newOffset = static_cast<size_t>( alignedAddress - blockStart ) + byteCount;
+
+	if( newOffset > m_currentBlock->m_capacity )
+	{
+		size_t newCapacity = m_currentBlock->m_capacity * 2;
+		if( newCapacity < byteCount + alignment )
+		{
+			newCapacity = byteCount + alignment;
+		}
+
+		ArenaBlock* newBlock = CreateBlock( newCapacity );
+		newBlock->m_previous = m_currentBlock;
+		m_currentBlock = newBlock;
+
+		blockStart = reinterpret_cast<uintptr_t>( GetBlockData( m_currentBlock ) );
+		alignedAddress = ( blockStart + alignment - 1 ) & ~( static_cast<uintptr_t>( alignment ) - 1 );
+		newOffset = static_cast<size_t>( alignedAddress - blockStart ) + byteCount;
+	}
+
+	m_usedBytes += newOffset - m_currentBlock->m_offset;
+	m_currentBlock->m_offset = newOffset;
+	return reinterpret_cast<void*>( alignedAddress );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void LinearArena::Reset()
+{
+	m_highWaterBytes = GetHighWaterBytes();
+	m_usedBytes = 0;
+
+	if( m_currentBlock->m_previous != nullptr )
+	{
+		while( m_currentBlock != nullptr )
+		{
+			ArenaBlock* previousBlock = m_currentBlock->m_previous;
+			DestroyBlock( m_currentBlock );
+			m_currentBlock = previousBlock;
+		}
+
+		// The chain only exists because a frame overflowed; replace it with one block that fits the worst frame
+		// seen, plus headroom so a frame that lands alignment padding differently doesn't chain again
+		m_currentBlock = CreateBlock( m_highWaterBytes + m_highWaterBytes / 2 );
+	}
+
+	m_currentBlock->m_offset = 0;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+LinearArena::ArenaBlock* LinearArena::CreateBlock( size_t capacityBytes )
+{
+	void* memory = malloc( sizeof( ArenaBlock ) + capacityBytes );
+	GUARANTEE_OR_DIE( memory != nullptr, Stringf( "%s failed to allocate a %zu byte block", m_name, capacityBytes ) );
+	MemoryTrackerRecordAllocation( capacityBytes, m_name );
+
+	ArenaBlock* block = new( memory ) ArenaBlock();
+	block->m_capacity = capacityBytes;
+	m_capacityBytes += capacityBytes;
+	return block;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void LinearArena::DestroyBlock( ArenaBlock* block )
+{
+	MemoryTrackerRecordFree( block->m_capacity );
+	m_capacityBytes -= block->m_capacity;
+	free( block );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+LinearArena& GetFrameArena()
+{
+	static LinearArena s_frameArena( 256 * 1024, "Frame Arena" );
+	return s_frameArena;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void ResetFrameArena()
+{
+	GetFrameArena().Reset();
+}
\ No newline at end of file
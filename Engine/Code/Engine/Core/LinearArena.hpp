@@ -0,0 +1,85 @@
+#pragma once
+#include "Engine/Core/EngineCommon.hpp"
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+//---------------------------------------------------------------------------------------------------------
+// Bump allocator for data that dies together. Allocations are never freed individually - Reset() drops
+// everything at once. When a frame outgrows the current block another block is chained on, and the next
+// Reset() folds the chain into one block sized from the high-water mark so steady-state frames never touch
+// the heap. Nothing in the arena gets its destructor run, so only trivially destructible types may use New.
+//---------------------------------------------------------------------------------------------------------
+class LinearArena
+{
+public:
+	explicit LinearArena( size_t initialCapacityBytes = 64 * 1024, char const* name = "LinearArena" );
+	~LinearArena();
+
+	LinearArena( LinearArena const& copy ) = delete;
+	LinearArena& operator=( LinearArena const& copy ) = delete;
+
+	void*	Allocate( size_t byteCount, size_t alignment = alignof( std::max_align_t ) );
+	void	Reset();
+
+	template<typename T, typename ...ARGS>
+	T*		New( ARGS&& ...args );
+	template<typename T>
+	T*		NewArray( size_t count );
+
+	size_t	GetUsedBytes() const				{ return m_usedBytes; }
+	size_t	GetCapacityBytes() const			{ return m_capacityBytes; }
+	size_t	GetHighWaterBytes() const			{ return m_highWaterBytes > m_usedBytes ? m_highWaterBytes : m_usedBytes; }
+
+private:
+	struct alignas( 16 ) ArenaBlock
+	{
+		ArenaBlock*	m_previous	= nullptr;
+		size_t		m_capacity	= 0;
+		size_t		m_offset	= 0;
+	};
+
+	ArenaBlock*	CreateBlock( size_t capacityBytes );
+	void		DestroyBlock( ArenaBlock* block );
+	unsigned char* GetBlockData( ArenaBlock* block ) const	{ return reinterpret_cast<unsigned char*>( block + 1 ); }
+
+private:
+	char const*	m_name				= nullptr;
+	ArenaBlock*	m_currentBlock		= nullptr;
+	size_t		m_usedBytes			= 0;
+	size_t		m_capacityBytes		= 0;
+	size_t		m_highWaterBytes	= 0;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T, typename ...ARGS>
+T* LinearArena::New( ARGS&& ...args )
+{
+	static_assert( std::is_trivially_destructible<T>::value, "LinearArena never runs destructors" );
+	return new( Allocate( sizeof( T ), alignof( T ) ) ) T( std::forward<ARGS>( args )... );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+T* LinearArena::NewArray( size_t count )
+{
+	static_assert( std::is_trivially_destructible<T>::value, "LinearArena never runs destructors" );
+	T* elements = static_cast<T*>( Allocate( sizeof( T ) * count, alignof( T ) ) );
+	for( size_t elementIndex = 0; elementIndex < count; ++elementIndex )
+	{
+		new( &elements[ elementIndex ] ) T();
+	}
+	return elements;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Scratch memory for the current frame, main thread only. It is reset at the end of the frame in
+// Clock::EndFrame, so nothing allocated from it may be kept past the end of the frame.
+//---------------------------------------------------------------------------------------------------------
+LinearArena&	GetFrameArena();
+void			ResetFrameArena();
\ No newline at end of file
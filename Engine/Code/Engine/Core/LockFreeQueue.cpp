@@ -0,0 +1,126 @@
+#include "Engine/Core/LockFreeQueue.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/Time.hpp"
+#include <deque>
+#include <thread>
+#include <vector>
+
+
+//---------------------------------------------------------------------------------------------------------
+// Cache-line sized so the copy cost is representative of a small message rather than a pointer
+struct queue_benchmark_item_t
+{
+	uint64_t values[ 8 ] = {};
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// The mutex + deque queue the lock-free family replaced, kept only as the benchmark baseline
+class LockedDequeQueue
+{
+public:
+	bool Push( queue_benchmark_item_t&& value )
+	{
+		std::lock_guard<std::mutex> queueLock( m_mutex );
+		m_queue.push_back( std::move( value ) );
+		return true;
+	}
+
+	bool Pop( queue_benchmark_item_t& out_value )
+	{
+		std::lock_guard<std::mutex> queueLock( m_mutex );
+		if( m_queue.empty() )
+			return false;
+
+		out_value = std::move( m_queue.front() );
+		m_queue.pop_front();
+		return true;
+	}
+
+private:
+	std::mutex							m_mutex;
+	std::deque<queue_benchmark_item_t>	m_queue;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Items per second through one consumer with producerCount threads pushing at once
+template<typename QUEUE_TYPE>
+static double RunQueueBenchmark( QUEUE_TYPE& queue, int producerCount, int itemsPerProducer )
+{
+	std::atomic<bool> isStarted = false;
+	std::vector<std::thread> producers;
+	for( int producerIndex = 0; producerIndex < producerCount; ++producerIndex )
+	{
+		producers.emplace_back( [&queue, &isStarted, producerIndex, itemsPerProducer]()
+		{
+			while( !isStarted ) {}
+			for( int itemIndex = 0; itemIndex < itemsPerProducer; ++itemIndex )
+			{
+				queue_benchmark_item_t item;
+				item.values[ 0 ] = static_cast<uint64_t>( producerIndex );
+				item.values[ 1 ] = static_cast<uint64_t>( itemIndex );
+				while( !queue.Push( std::move( item ) ) )
+				{
+					std::this_thread::yield();
+				}
+			}
+		} );
+	}
+
+	uint64_t const totalItemCount = static_cast<uint64_t>( producerCount ) * static_cast<uint64_t>( itemsPerProducer );
+	uint64_t receivedCount = 0;
+	queue_benchmark_item_t item;
+
+	double startSeconds = GetCurrentTimeSeconds();
+	isStarted = true;
+	while( receivedCount < totalItemCount )
+	{
+		if( queue.Pop( item ) )
+		{
+			++receivedCount;
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+	double elapsedSeconds = GetCurrentTimeSeconds() - startSeconds;
+
+	for( std::thread& producer : producers )
+	{
+		producer.join();
+	}
+	return static_cast<double>( totalItemCount ) / elapsedSeconds;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void PrintQueueContentionBenchmark( int maxProducerCount, int itemsPerProducer )
+{
+	g_theConsole->PrintString( Rgba8::WHITE, "Queue benchmark: %i items per producer, 1 consumer, Mitems/sec", itemsPerProducer );
+	g_theConsole->PrintString( Rgba8::WHITE, "  producers    mutex+deque        MPSC        MPMC        SPSC" );
+
+	for( int producerCount = 1; producerCount <= maxProducerCount; producerCount *= 2 )
+	{
+		LockedDequeQueue lockedQueue;
+		MPSCQueue<queue_benchmark_item_t> mpscQueue( 4096 );
+		MPMCQueue<queue_benchmark_item_t> mpmcQueue( 4096 );
+
+		double lockedRate	= RunQueueBenchmark( lockedQueue, producerCount, itemsPerProducer );
+		double mpscRate		= RunQueueBenchmark( mpscQueue, producerCount, itemsPerProducer );
+		double mpmcRate		= RunQueueBenchmark( mpmcQueue, producerCount, itemsPerProducer );
+
+		if( producerCount == 1 )
+		{
+			SPSCQueue<queue_benchmark_item_t> spscQueue( 4096 );
+			double spscRate = RunQueueBenchmark( spscQueue, producerCount, itemsPerProducer );
+			g_theConsole->PrintString( Rgba8::WHITE, "  %9i %14.2f %11.2f %11.2f %11.2f", producerCount, lockedRate / 1.0e6, mpscRate / 1.0e6, mpmcRate / 1.0e6, spscRate / 1.0e6 );
+		}
+		else
+		{
+			g_theConsole->PrintString( Rgba8::WHITE, "  %9i %14.2f %11.2f %11.2f           -", producerCount, lockedRate / 1.0e6, mpscRate / 1.0e6, mpmcRate / 1.0e6 );
+		}
+	}
+}
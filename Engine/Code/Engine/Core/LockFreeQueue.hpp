@@ -0,0 +1,331 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+#include <utility>
+
+
+//---------------------------------------------------------------------------------------------------------
+constexpr size_t DEFAULT_QUEUE_CAPACITY = 1024;
+
+
+//---------------------------------------------------------------------------------------------------------
+// Bounded ring of sequence-stamped slots (Vyukov). Each slot's sequence says whose turn it is, so a
+// producer and a consumer never touch the same slot at once and no lock is taken on push or pop. The
+// producer/consumer flags drop the compare-exchange on whichever side has a single owner thread, which
+// gives the SPSC and MPSC variants below.
+//
+// Push/Pop never block: Push returns false when full, Pop when empty. PopWait is the optional blocking
+// consumer - it parks on a condition variable, and producers only touch that mutex when a waiter exists.
+//---------------------------------------------------------------------------------------------------------
+template<typename T, bool IS_MULTI_PRODUCER, bool IS_MULTI_CONSUMER>
+class BoundedQueue
+{
+public:
+	explicit BoundedQueue( size_t capacity = DEFAULT_QUEUE_CAPACITY );
+	~BoundedQueue();
+
+	BoundedQueue( BoundedQueue const& copy ) = delete;
+	BoundedQueue& operator=( BoundedQueue const& copy ) = delete;
+
+	bool	Push( T const& value );
+	bool	Push( T&& value );
+	bool	Pop( T& out_value );
+	bool	PopWait( T& out_value, double maxWaitSeconds );
+	void	WakeWaiters();
+
+	// Moves values out of the array until the queue fills; returns how many went in
+	size_t	PushBatch( T* values, size_t count );
+	template<typename OUTPUT_ITERATOR>
+	size_t	PopBatch( OUTPUT_ITERATOR out_values, size_t maxCount );
+
+	size_t	GetCapacity() const								{ return m_mask + 1; }
+	size_t	GetApproximateSize() const;
+	bool	IsEmpty() const									{ return GetApproximateSize() == 0; }
+
+private:
+	struct slot_t
+	{
+		std::atomic<size_t>	sequence;
+		T					value;
+	};
+
+	template<typename U>
+	bool	Enqueue( U&& value );
+	void	NotifyWaiters( bool shouldWakeAll );
+
+private:
+	slot_t*						m_slots				= nullptr;
+	size_t						m_mask				= 0;
+
+	alignas( 64 ) std::atomic<size_t>	m_enqueuePosition;
+	alignas( 64 ) std::atomic<size_t>	m_dequeuePosition;
+	alignas( 64 ) std::atomic<int>		m_waiterCount;
+	std::atomic<uint32_t>				m_wakeGeneration;
+	std::mutex							m_waitMutex;
+	std::condition_variable				m_waitCondition;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T> using SPSCQueue = BoundedQueue<T, false, false>;
+template<typename T> using MPSCQueue = BoundedQueue<T, true, false>;
+template<typename T> using MPMCQueue = BoundedQueue<T, true, true>;
+
+
+//---------------------------------------------------------------------------------------------------------
+void PrintQueueContentionBenchmark( int maxProducerCount, int itemsPerProducer );
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T, bool IS_MULTI_PRODUCER, bool IS_MULTI_CONSUMER>
+BoundedQueue<T, IS_MULTI_PRODUCER, IS_MULTI_CONSUMER>::BoundedQueue( size_t capacity )
+	: m_enqueuePosition( 0 )
+	, m_dequeuePosition( 0 )
+	, m_waiterCount( 0 )
+	, m_wakeGeneration( 0 )
+{
+	size_t roundedCapacity = 2;
+	while( roundedCapacity < capacity )
+	{
+		roundedCapacity <<= 1;
+	}
+
+	m_mask = roundedCapacity - 1;
+	m_slots = new slot_t[ roundedCapacity ];
+	for( size_t slotIndex = 0; slotIndex < roundedCapacity; ++slotIndex )
+	{
+		m_slots[ slotIndex ].sequence.store( slotIndex, std::memory_order_relaxed );
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T, bool IS_MULTI_PRODUCER, bool IS_MULTI_CONSUMER>
+BoundedQueue<T, IS_MULTI_PRODUCER, IS_MULTI_CONSUMER>::~BoundedQueue()
+{
+	delete[] m_slots;
+	m_slots = nullptr;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T, bool IS_MULTI_PRODUCER, bool IS_MULTI_CONSUMER>
+bool BoundedQueue<T, IS_MULTI_PRODUCER, IS_MULTI_CONSUMER>::Push( T const& value )
+{
+	if( !Enqueue( value ) )
+		return false;
+
+	NotifyWaiters( false );
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T, bool IS_MULTI_PRODUCER, bool IS_MULTI_CONSUMER>
+bool BoundedQueue<T, IS_MULTI_PRODUCER, IS_MULTI_CONSUMER>::Push( T&& value )
+{
+	if( !Enqueue( std::move( value ) ) )
+		return false;
+
+	NotifyWaiters( false );
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T, bool IS_MULTI_PRODUCER, bool IS_MULTI_CONSUMER>
+size_t BoundedQueue<T, IS_MULTI_PRODUCER, IS_MULTI_CONSUMER>::PushBatch( T* values, size_t count )
+{
+	size_t pushedCount = 0;
+	while( pushedCount < count && Enqueue( std::move( values[ pushedCount ] ) ) )
+	{
+		++pushedCount;
+	}
+
+	if( pushedCount > 0 )
+	{
+		NotifyWaiters( pushedCount > 1 );
+	}
+	return pushedCount;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T, bool IS_MULTI_PRODUCER, bool IS_MULTI_CONSUMER>
+template<typename U>
+bool BoundedQueue<T, IS_MULTI_PRODUCER, IS_MULTI_CONSUMER>::Enqueue( U&& value )
+{
+	slot_t* slot = nullptr;
+	size_t position = m_enqueuePosition.load( std::memory_order_relaxed );
+	for( ;; )
+	{
+		slot = &m_slots[ position & m_mask ];
+		size_t sequence = slot->sequence.load( std::memory_order_acquire );
+		intptr_t difference = static_cast<intptr_t>( sequence ) - static_cast<intptr_t>( position );
+		if( difference == 0 )
+		{
+			if( !IS_MULTI_PRODUCER )
+			{
+				m_enqueuePosition.store( position + 1, std::memory_order_relaxed );
+				break;
+			}
+			if( m_enqueuePosition.compare_exchange_weak( position, position + 1, std::memory_order_relaxed ) )
+			{
+				break;
+			}
+		}
+		else if( difference < 0 )
+		{
+			// The consumer hasn't released this slot from the previous lap yet
+			return false;
+		}
+		else
+		{
+			position = m_enqueuePosition.load( std::memory_order_relaxed );
+		}
+	}
+
+	slot->value = std::forward<U>( value );
+	slot->sequence.store( position + 1, std::memory_order_release );
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T, bool IS_MULTI_PRODUCER, bool IS_MULTI_CONSUMER>
+bool BoundedQueue<T, IS_MULTI_PRODUCER, IS_MULTI_CONSUMER>::Pop( T& out_value )
+{
+	slot_t* slot = nullptr;
+	size_t position = m_dequeuePosition.load( std::memory_order_relaxed );
+	for( ;; )
+	{
+		slot = &m_slots[ position & m_mask ];
+		size_t sequence = slot->sequence.load( std::memory_order_acquire );
+		intptr_t difference = static_cast<intptr_t>( sequence ) - static_cast<intptr_t>( position + 1 );
+		if( difference == 0 )
+		{
+			if( !IS_MULTI_CONSUMER )
+			{
+				m_dequeuePosition.store( position + 1, std::memory_order_relaxed );
+				break;
+			}
+			if( m_dequeuePosition.compare_exchange_weak( position, position + 1, std::memory_order_relaxed ) )
+			{
+				break;
+			}
+		}
+		else if( difference < 0 )
+		{
+			return false;
+		}
+		else
+		{
+			position = m_dequeuePosition.load( std::memory_order_relaxed );
+		}
+	}
+
+	out_value = std::move( slot->value );
+	slot->sequence.store( position + m_mask + 1, std::memory_order_release );
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T, bool IS_MULTI_PRODUCER, bool IS_MULTI_CONSUMER>
+template<typename OUTPUT_ITERATOR>
+size_t BoundedQueue<T, IS_MULTI_PRODUCER, IS_MULTI_CONSUMER>::PopBatch( OUTPUT_ITERATOR out_values, size_t maxCount )
+{
+	size_t poppedCount = 0;
+	T value;
+	while( poppedCount < maxCount && Pop( value ) )
+	{
+		*out_values = std::move( value );
+		++out_values;
+		++poppedCount;
+	}
+	return poppedCount;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Returns false on timeout or when WakeWaiters() is called with the queue still empty
+template<typename T, bool IS_MULTI_PRODUCER, bool IS_MULTI_CONSUMER>
+bool BoundedQueue<T, IS_MULTI_PRODUCER, IS_MULTI_CONSUMER>::PopWait( T& out_value, double maxWaitSeconds )
+{
+	if( Pop( out_value ) )
+		return true;
+
+	std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>( std::chrono::duration<double>( maxWaitSeconds ) );
+
+	std::unique_lock<std::mutex> waitLock( m_waitMutex );
+	uint32_t wakeGeneration = m_wakeGeneration.load( std::memory_order_relaxed );
+	m_waiterCount.fetch_add( 1, std::memory_order_seq_cst );
+
+	// Re-checked under the lock after registering, so a push that missed the waiter count can't be missed here
+	bool wasPopped = false;
+	for( ;; )
+	{
+		if( Pop( out_value ) )
+		{
+			wasPopped = true;
+			break;
+		}
+		if( m_wakeGeneration.load( std::memory_order_relaxed ) != wakeGeneration )
+		{
+			break;
+		}
+		if( m_waitCondition.wait_until( waitLock, deadline ) == std::cv_status::timeout )
+		{
+			wasPopped = Pop( out_value );
+			break;
+		}
+	}
+
+	m_waiterCount.fetch_sub( 1, std::memory_order_relaxed );
+	return wasPopped;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T, bool IS_MULTI_PRODUCER, bool IS_MULTI_CONSUMER>
+void BoundedQueue<T, IS_MULTI_PRODUCER, IS_MULTI_CONSUMER>::WakeWaiters()
+{
+	std::lock_guard<std::mutex> waitLock( m_waitMutex );
+	m_wakeGeneration.fetch_add( 1, std::memory_order_relaxed );
+	m_waitCondition.notify_all();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T, bool IS_MULTI_PRODUCER, bool IS_MULTI_CONSUMER>
+void BoundedQueue<T, IS_MULTI_PRODUCER, IS_MULTI_CONSUMER>::NotifyWaiters( bool shouldWakeAll )
+{
+	// Pairs with the waiter's fetch_add: either it sees our slot, or we see it waiting
+	std::atomic_thread_fence( std::memory_order_seq_cst );
+	if( m_waiterCount.load( std::memory_order_relaxed ) == 0 )
+		return;
+
+	std::lock_guard<std::mutex> waitLock( m_waitMutex );
+	if( shouldWakeAll )
+	{
+		m_waitCondition.notify_all();
+	}
+	else
+	{
+		m_waitCondition.notify_one();
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T, bool IS_MULTI_PRODUCER, bool IS_MULTI_CONSUMER>
+size_t BoundedQueue<T, IS_MULTI_PRODUCER, IS_MULTI_CONSUMER>::GetApproximateSize() const
+{
+	size_t enqueuePosition = m_enqueuePosition.load( std::memory_order_relaxed );
+	size_t dequeuePosition = m_dequeuePosition.load( std::memory_order_relaxed );
+	return enqueuePosition > dequeuePosition ? enqueuePosition - dequeuePosition : 0;
+}
@@ -0,0 +1,343 @@
+#include "Engine/Core/MemoryTracker.hpp"
+#include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/EventSystem.hpp"
+#include "Engine/Core/NamedProperties.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Platform/Platform.hpp"
+#include <atomic>
+#include <algorithm>
+#include <vector>
+#include <new>
+#include <stdlib.h>
+
+
+//---------------------------------------------------------------------------------------------------------
+constexpr uint MEMORY_SITE_CAPACITY			= 4096;		// must be a power of two
+constexpr uint MEMORY_REPORT_SITE_COUNT		= 16;
+
+
+//---------------------------------------------------------------------------------------------------------
+// key is either a MEMORY_SITE string literal or a return address from the global operator new
+struct memory_site_t
+{
+	void const*	key					= nullptr;
+	bool		isNamed				= false;
+	uint		frameCount			= 0;
+	size_t		frameBytes			= 0;
+	uint		lastFrameCount		= 0;
+	size_t		lastFrameBytes		= 0;
+	uint64_t	totalCount			= 0;
+	uint64_t	totalBytes			= 0;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Everything here has to work from inside operator new, so it is all fixed-size and guarded by a spin lock
+// rather than anything that could allocate
+//---------------------------------------------------------------------------------------------------------
+static std::atomic<uint>		s_frameAllocationCount		= 0;
+static std::atomic<uint>		s_frameFreeCount			= 0;
+static std::atomic<size_t>		s_frameAllocatedBytes		= 0;
+static std::atomic<size_t>		s_frameFreedBytes			= 0;
+static std::atomic<int64_t>		s_liveBytes					= 0;
+static memory_frame_stats_t		s_lastFrameStats;
+
+static std::atomic<bool>		s_isSiteTrackingEnabled		= false;
+static std::atomic_flag			s_siteTableLock				= ATOMIC_FLAG_INIT;
+static memory_site_t			s_sites[ MEMORY_SITE_CAPACITY ];
+static uint						s_siteCount					= 0;
+static uint						s_droppedSiteCount			= 0;
+static thread_local bool		s_isInsideTracker			= false;
+
+static bool						s_areCommandsSubscribed		= false;
+
+
+//---------------------------------------------------------------------------------------------------------
+static void RecordAllocationForSite( void const* key, bool isNamed, size_t byteCount )
+{
+	if( s_isInsideTracker )
+		return;
+
+	s_isInsideTracker = true;
+	while( s_siteTableLock.test_and_set( std::memory_order_acquire ) ) {}
+
+	uint hash = static_cast<uint>( reinterpret_cast<uintptr_t>( key ) >> 3 ) * 2654435761u;
+	for( uint probe = 0; probe < MEMORY_SITE_CAPACITY; ++probe )
+	{
+		memory_site_t& site = s_sites[ ( hash + probe ) & ( MEMORY_SITE_CAPACITY - 1 ) ];
+		if( site.key == nullptr )
+		{
+			// Keep a quarter of the table free so probes stay short; sites past that are only counted
+			if( s_siteCount >= ( MEMORY_SITE_CAPACITY * 3 ) / 4 )
+			{
+				s_droppedSiteCount++;
+				break;
+			}
+
+			site.key = key;
+			site.isNamed = isNamed;
+			s_siteCount++;
+		}
+
+		if( site.key == key )
+		{
+			site.frameCount++;
+			site.frameBytes += byteCount;
+			site.totalCount++;
+			site.totalBytes += byteCount;
+			break;
+		}
+	}
+
+	s_siteTableLock.clear( std::memory_order_release );
+	s_isInsideTracker = false;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void RecordAllocationTotals( size_t byteCount )
+{
+	s_frameAllocationCount.fetch_add( 1, std::memory_order_relaxed );
+	s_frameAllocatedBytes.fetch_add( byteCount, std::memory_order_relaxed );
+	s_liveBytes.fetch_add( static_cast<int64_t>( byteCount ), std::memory_order_relaxed );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void MemoryTrackerRecordAllocation( size_t byteCount, char const* site )
+{
+	RecordAllocationTotals( byteCount );
+	if( site != nullptr && s_isSiteTrackingEnabled.load( std::memory_order_relaxed ) )
+	{
+		RecordAllocationForSite( site, true, byteCount );
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void MemoryTrackerRecordAllocation( size_t byteCount, void const* returnAddress )
+{
+	RecordAllocationTotals( byteCount );
+	if( s_isSiteTrackingEnabled.load( std::memory_order_relaxed ) )
+	{
+		RecordAllocationForSite( returnAddress, false, byteCount );
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void MemoryTrackerRecordFree( size_t byteCount )
+{
+	s_frameFreeCount.fetch_add( 1, std::memory_order_relaxed );
+	s_frameFreedBytes.fetch_add( byteCount, std::memory_order_relaxed );
+	s_liveBytes.fetch_sub( static_cast<int64_t>( byteCount ), std::memory_order_relaxed );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void mem_report( EventArgs* args )
+{
+	UNUSED( args );
+	MemoryTrackerPrintReport();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void mem_track( EventArgs* args )
+{
+	MemoryTrackerSetSiteTrackingEnabled( args->GetValue( "enabled", !MemoryTrackerIsSiteTrackingEnabled() ) );
+	g_theConsole->PrintString( Rgba8::WHITE, "Allocation site tracking %s", MemoryTrackerIsSiteTrackingEnabled() ? "enabled" : "disabled" );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void MemoryTrackerBeginFrame()
+{
+	if( !s_areCommandsSubscribed && g_theEventSystem != nullptr )
+	{
+		g_theEventSystem->SubscribeEventCallbackFunction( "mem_report", mem_report );
+		g_theEventSystem->SubscribeEventCallbackFunction( "mem_track", mem_track );
+		s_areCommandsSubscribed = true;
+	}
+
+	s_lastFrameStats.allocationCount	= s_frameAllocationCount.exchange( 0 );
+	s_lastFrameStats.freeCount			= s_frameFreeCount.exchange( 0 );
+	s_lastFrameStats.allocatedBytes		= s_frameAllocatedBytes.exchange( 0 );
+	s_lastFrameStats.freedBytes			= s_frameFreedBytes.exchange( 0 );
+
+	if( !s_isSiteTrackingEnabled )
+		return;
+
+	while( s_siteTableLock.test_and_set( std::memory_order_acquire ) ) {}
+	for( uint siteIndex = 0; siteIndex < MEMORY_SITE_CAPACITY; ++siteIndex )
+	{
+		memory_site_t& site = s_sites[ siteIndex ];
+		site.lastFrameCount = site.frameCount;
+		site.lastFrameBytes = site.frameBytes;
+		site.frameCount = 0;
+		site.frameBytes = 0;
+	}
+	s_siteTableLock.clear( std::memory_order_release );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void MemoryTrackerSetSiteTrackingEnabled( bool isEnabled )
+{
+	s_isSiteTrackingEnabled = isEnabled;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool MemoryTrackerIsSiteTrackingEnabled()
+{
+	return s_isSiteTrackingEnabled;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static std::string GetSiteName( memory_site_t const& site )
+{
+	if( site.isNamed )
+		return std::string( reinterpret_cast<char const*>( site.key ) );
+
+	return Stringf( "operator new from 0x%p", site.key );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void MemoryTrackerPrintReport()
+{
+	if( g_theConsole == nullptr )
+		return;
+
+	memory_frame_stats_t const& stats = s_lastFrameStats;
+	g_theConsole->PrintString( Rgba8::WHITE, "Last frame: %u allocations (%zu bytes), %u frees (%zu bytes), %lld bytes live",
+		stats.allocationCount, stats.allocatedBytes, stats.freeCount, stats.freedBytes, static_cast<long long>( s_liveBytes.load() ) );
+
+#if !defined( ENGINE_TRACK_ALLOCATIONS )
+	g_theConsole->PrintString( Rgba8::YELLOW, "  Only engine allocators are counted - define ENGINE_TRACK_ALLOCATIONS to count the global heap" );
+#endif
+
+	if( !s_isSiteTrackingEnabled )
+	{
+		g_theConsole->PrintString( Rgba8::WHITE, "  Site tracking is off (mem_track enabled=true)" );
+		return;
+	}
+
+	std::vector<memory_site_t> sites;
+	while( s_siteTableLock.test_and_set( std::memory_order_acquire ) ) {}
+	s_isInsideTracker = true;
+	for( uint siteIndex = 0; siteIndex < MEMORY_SITE_CAPACITY; ++siteIndex )
+	{
+		if( s_sites[ siteIndex ].key != nullptr )
+		{
+			sites.push_back( s_sites[ siteIndex ] );
+		}
+	}
+	s_isInsideTracker = false;
+	s_siteTableLock.clear( std::memory_order_release );
+
+	std::sort( sites.begin(), sites.end(), []( memory_site_t const& a, memory_site_t const& b )
+	{
+		if( a.lastFrameCount != b.lastFrameCount )
+			return a.lastFrameCount > b.lastFrameCount;
+
+		return a.totalCount > b.totalCount;
+	} );
+
+	g_theConsole->PrintString( Rgba8::WHITE, "  %u call sites (%u not tracked), busiest last frame:", s_siteCount, s_droppedSiteCount );
+	uint reportCount = Min( static_cast<uint>( sites.size() ), MEMORY_REPORT_SITE_COUNT );
+	for( uint siteIndex = 0; siteIndex < reportCount; ++siteIndex )
+	{
+		memory_site_t const& site = sites[ siteIndex ];
+		g_theConsole->PrintString( Rgba8::WHITE, "  %6u allocs %9zu bytes this frame | %9llu allocs total - %s",
+			site.lastFrameCount, site.lastFrameBytes, static_cast<unsigned long long>( site.totalCount ), GetSiteName( site ).c_str() );
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+memory_frame_stats_t MemoryTrackerGetLastFrameStats()
+{
+	return s_lastFrameStats;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+size_t MemoryTrackerGetLiveBytes()
+{
+	int64_t liveBytes = s_liveBytes.load();
+	return liveBytes > 0 ? static_cast<size_t>( liveBytes ) : 0;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Global heap hooks. Each block carries a header holding its size so frees can be counted in bytes.
+//---------------------------------------------------------------------------------------------------------
+#if defined( ENGINE_TRACK_ALLOCATIONS )
+#if defined( PLATFORM_WINDOWS )
+#include <intrin.h>
+#endif
+
+constexpr size_t MEMORY_TRACKED_HEADER_SIZE = 16;
+
+
+//---------------------------------------------------------------------------------------------------------
+static void* TrackedAllocate( size_t byteCount, void const* returnAddress )
+{
+	unsigned char* block = static_cast<unsigned char*>( malloc( byteCount + MEMORY_TRACKED_HEADER_SIZE ) );
+	if( block == nullptr )
+		return nullptr;
+
+	*reinterpret_cast<size_t*>( block ) = byteCount;
+	MemoryTrackerRecordAllocation( byteCount, returnAddress );
+	return block + MEMORY_TRACKED_HEADER_SIZE;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void TrackedFree( void* memory )
+{
+	if( memory == nullptr )
+		return;
+
+	unsigned char* block = static_cast<unsigned char*>( memory ) - MEMORY_TRACKED_HEADER_SIZE;
+	MemoryTrackerRecordFree( *reinterpret_cast<size_t*>( block ) );
+	free( block );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void* operator new( size_t byteCount )
+{
+	void* memory = TrackedAllocate( byteCount, _ReturnAddress() );
+	if( memory == nullptr )
+		throw std::bad_alloc();
+
+	return memory;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void* operator new[]( size_t byteCount )
+{
+	void* memory = TrackedAllocate( byteCount, _ReturnAddress() );
+	if( memory == nullptr )
+		throw std::bad_alloc();
+
+	return memory;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void* operator new( size_t byteCount, std::nothrow_t const& )			{ return TrackedAllocate( byteCount, _ReturnAddress() ); }
+void* operator new[]( size_t byteCount, std::nothrow_t const& )			{ return TrackedAllocate( byteCount, _ReturnAddress() ); }
+void operator delete( void* memory )									{ TrackedFree( memory ); }
+void operator delete[]( void* memory )									{ TrackedFree( memory ); }
+void operator delete( void* memory, size_t )							{ TrackedFree( memory ); }
+void operator delete[]( void* memory, size_t )							{ TrackedFree( memory ); }
+void operator delete( void* memory, std::nothrow_t const& )				{ TrackedFree( memory ); }
+void operator delete[]( void* memory, std::nothrow_t const& )			{ TrackedFree( memory ); }
+
+#endif // defined( ENGINE_TRACK_ALLOCATIONS )
\ No newline at end of file
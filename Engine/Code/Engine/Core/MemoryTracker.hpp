@@ -0,0 +1,39 @@
+#pragma once
+#include "Engine/Core/EngineCommon.hpp"
+#include "Game/EngineBuildPreferences.hpp"
+#include <stddef.h>
+
+
+//---------------------------------------------------------------------------------------------------------
+// Counts allocations per frame and per call site. The engine allocators (frame arena, block pools) always
+// report the heap blocks they grow by; defining ENGINE_TRACK_ALLOCATIONS in the game's EngineBuildPreferences.hpp also routes the
+// global operator new/delete through the tracker, keyed by return address, so stray heap traffic in a
+// steady-state frame shows up in mem_report.
+//---------------------------------------------------------------------------------------------------------
+#define MEMORY_STRINGIFY_INNER( x )		#x
+#define MEMORY_STRINGIFY( x )			MEMORY_STRINGIFY_INNER( x )
+#define MEMORY_SITE						__FILE__ "(" MEMORY_STRINGIFY( __LINE__ ) ")"
+
+
+//---------------------------------------------------------------------------------------------------------
+struct memory_frame_stats_t
+{
+	uint	allocationCount		= 0;
+	uint	freeCount			= 0;
+	size_t	allocatedBytes		= 0;
+	size_t	freedBytes			= 0;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+void	MemoryTrackerRecordAllocation( size_t byteCount, char const* site );
+void	MemoryTrackerRecordAllocation( size_t byteCount, void const* returnAddress );
+void	MemoryTrackerRecordFree( size_t byteCount );
+void	MemoryTrackerBeginFrame();
+
+void	MemoryTrackerSetSiteTrackingEnabled( bool isEnabled );
+bool	MemoryTrackerIsSiteTrackingEnabled();
+void	MemoryTrackerPrintReport();
+
+memory_frame_stats_t	MemoryTrackerGetLastFrameStats();
+size_t					MemoryTrackerGetLiveBytes();
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #include "Engine/Core/StringUtils.hpp"
+#include "Engine/Core/BlockPool.hpp"
 #include <string>
 #include <map>
 
@@ -13,7 +14,7 @@ class NamedProperties;
 //---------------------------------------------------------------------------------------------------------
 // TypedPropertyBase
 //---------------------------------------------------------------------------------------------------------
-class TypedPropertyBase
+class TypedPropertyBase : public PoolAllocated
 {
 public:
 	virtual ~TypedPropertyBase() {}
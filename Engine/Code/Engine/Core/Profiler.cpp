@@ -0,0 +1,702 @@
+#include "Engine/Core/Profiler.hpp"
+#include "Engine/Core/Time.hpp"
+#include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/EventSystem.hpp"
+#include "Engine/Core/NamedProperties.hpp"
+#include "Engine/Core/DebugRender.hpp"
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/Vec4.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Platform/Platform.hpp"
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <algorithm>
+#include <string.h>
+#include <stdio.h>
+
+
+//---------------------------------------------------------------------------------------------------------
+constexpr uint	PROFILER_EVENTS_PER_THREAD		= 16384;	// must be a power of two
+constexpr uint	PROFILER_MAX_ZONE_DEPTH			= 64;
+constexpr uint	PROFILER_ZONE_HISTORY_SIZE		= 131072;
+constexpr uint	PROFILER_FRAME_HISTORY_SIZE		= 256;
+constexpr uint	PROFILER_OVERLAY_LINE_COUNT		= 24;
+constexpr float	PROFILER_OVERLAY_TEXT_SIZE		= 14.f;
+constexpr uint	PROFILER_FRAMES_TID				= 0xFFFF;
+
+
+//---------------------------------------------------------------------------------------------------------
+// name == nullptr marks the end of the innermost open zone
+struct profiler_event_t
+{
+	char const*	name	= nullptr;
+	uint64_t	ticks	= 0;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+struct profiler_open_zone_t
+{
+	char const*	name		= nullptr;
+	uint64_t	startTicks	= 0;
+	uint64_t	childTicks	= 0;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+struct profiler_zone_record_t
+{
+	char const*	name		= nullptr;
+	uint64_t	startTicks	= 0;
+	uint64_t	endTicks	= 0;
+	uint		threadIndex	= 0;
+	uint		depth		= 0;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+struct profiler_frame_record_t
+{
+	uint		frameIndex	= 0;
+	uint64_t	startTicks	= 0;
+	uint64_t	endTicks	= 0;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+struct profiler_node_t
+{
+	char const*	name			= nullptr;
+	int			parentIndex		= -1;
+	int			firstChildIndex	= -1;
+	int			nextSiblingIndex = -1;
+	uint		threadIndex		= 0;
+	uint		depth			= 0;
+	uint		callCount		= 0;
+	uint64_t	inclusiveTicks	= 0;
+	uint64_t	selfTicks		= 0;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Single producer (the owning thread) / single consumer (the thread calling ProfilerBeginFrame).
+// Read and write indices only ever increase; the slot is the index masked by the capacity.
+//---------------------------------------------------------------------------------------------------------
+class ProfilerThreadLog
+{
+public:
+	bool Push( char const* zoneName, uint64_t ticks, uint requiredFreeSlots );
+	bool Pop( profiler_event_t& out_event );
+
+public:
+	std::string				m_threadName		= "";
+	uint					m_threadIndex		= 0;
+	uint					m_producerDepth		= 0;
+	std::atomic<uint>		m_droppedZones		= 0;
+
+	profiler_open_zone_t	m_openZones[ PROFILER_MAX_ZONE_DEPTH ];
+	uint					m_openZoneCount		= 0;
+
+private:
+	profiler_event_t		m_events[ PROFILER_EVENTS_PER_THREAD ];
+	std::atomic<uint>		m_writeIndex		= 0;
+	std::atomic<uint>		m_readIndex			= 0;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+bool ProfilerThreadLog::Push( char const* zoneName, uint64_t ticks, uint requiredFreeSlots )
+{
+	uint writeIndex = m_writeIndex.load( std::memory_order_relaxed );
+	uint readIndex = m_readIndex.load( std::memory_order_acquire );
+	uint usedSlots = writeIndex - readIndex;
+	if( usedSlots + requiredFreeSlots > PROFILER_EVENTS_PER_THREAD )
+		return false;
+
+	profiler_event_t& event = m_events[ writeIndex & ( PROFILER_EVENTS_PER_THREAD - 1 ) ];
+	event.name = zoneName;
+	event.ticks = ticks;
+	m_writeIndex.store( writeIndex + 1, std::memory_order_release );
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool ProfilerThreadLog::Pop( profiler_event_t& out_event )
+{
+	uint readIndex = m_readIndex.load( std::memory_order_relaxed );
+	uint writeIndex = m_writeIndex.load( std::memory_order_acquire );
+	if( readIndex == writeIndex )
+		return false;
+
+	out_event = m_events[ readIndex & ( PROFILER_EVENTS_PER_THREAD - 1 ) ];
+	m_readIndex.store( readIndex + 1, std::memory_order_release );
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Thread logs are created on a thread's first zone and live for the rest of the process so a thread that
+// exits mid-frame never leaves the consumer holding a dangling log.
+//---------------------------------------------------------------------------------------------------------
+static std::atomic<bool>					s_isProfilerEnabled			= true;
+static std::mutex							s_threadLogsLock;
+static std::vector<ProfilerThreadLog*>		s_threadLogs;
+static thread_local ProfilerThreadLog*		s_threadLog					= nullptr;
+
+static bool									s_areCommandsSubscribed		= false;
+static bool									s_isOverlayEnabled			= false;
+static double								s_spikeThresholdMilliseconds = 0.0;
+static uint									s_lastSpikeCaptureFrame		= 0;
+
+static uint									s_frameIndex				= 0;
+static uint64_t								s_frameStartTicks			= 0;
+static double								s_lastFrameMilliseconds		= 0.0;
+static std::vector<profiler_node_t>			s_frameNodes;
+static std::vector<profiler_node_t>			s_lastFrameNodes;
+
+static std::vector<profiler_zone_record_t>	s_zoneHistory;
+static uint64_t								s_zoneHistoryCount			= 0;
+static profiler_frame_record_t				s_frameHistory[ PROFILER_FRAME_HISTORY_SIZE ];
+static uint									s_frameHistoryCount			= 0;
+
+
+//---------------------------------------------------------------------------------------------------------
+static ProfilerThreadLog* GetOrCreateThreadLog()
+{
+	if( s_threadLog != nullptr )
+		return s_threadLog;
+
+	ProfilerThreadLog* newLog = new ProfilerThreadLog();
+
+	std::scoped_lock lock( s_threadLogsLock );
+	newLog->m_threadIndex = static_cast<uint>( s_threadLogs.size() );
+	newLog->m_threadName = Stringf( "Thread %u", newLog->m_threadIndex );
+	s_threadLogs.push_back( newLog );
+
+	s_threadLog = newLog;
+	return newLog;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool ProfilerBeginZone( char const* zoneName )
+{
+	if( !s_isProfilerEnabled.load( std::memory_order_relaxed ) )
+		return false;
+
+	ProfilerThreadLog* log = GetOrCreateThreadLog();
+	if( log->m_producerDepth >= PROFILER_MAX_ZONE_DEPTH )
+	{
+		log->m_droppedZones++;
+		return false;
+	}
+
+	// Leave room for the end event of this zone and of every zone already open on this thread, so once a
+	// begin is accepted its end can never be dropped and the hierarchy stays balanced
+	uint requiredFreeSlots = log->m_producerDepth + 2;
+	if( !log->Push( zoneName, GetCurrentTimeTicks(), requiredFreeSlots ) )
+	{
+		log->m_droppedZones++;
+		return false;
+	}
+
+	log->m_producerDepth++;
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void ProfilerEndZone()
+{
+	ProfilerThreadLog* log = s_threadLog;
+	if( log == nullptr || log->m_producerDepth == 0 )
+		return;
+
+	log->Push( nullptr, GetCurrentTimeTicks(), 1 );
+	log->m_producerDepth--;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void ProfilerSetThreadName( char const* threadName )
+{
+	ProfilerThreadLog* log = GetOrCreateThreadLog();
+
+	std::scoped_lock lock( s_threadLogsLock );
+	log->m_threadName = threadName;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static int FindOrAddFrameNode( int parentIndex, char const* zoneName, uint threadIndex, uint depth )
+{
+	int childIndex = s_frameNodes[ parentIndex ].firstChildIndex;
+	while( childIndex != -1 )
+	{
+		profiler_node_t const& child = s_frameNodes[ childIndex ];
+		if( child.threadIndex == threadIndex && ( child.name == zoneName || strcmp( child.name, zoneName ) == 0 ) )
+			return childIndex;
+
+		childIndex = child.nextSiblingIndex;
+	}
+
+	profiler_node_t newNode;
+	newNode.name				= zoneName;
+	newNode.parentIndex			= parentIndex;
+	newNode.nextSiblingIndex	= s_frameNodes[ parentIndex ].firstChildIndex;
+	newNode.threadIndex			= threadIndex;
+	newNode.depth				= depth;
+
+	int newIndex = static_cast<int>( s_frameNodes.size() );
+	s_frameNodes.push_back( newNode );
+	s_frameNodes[ parentIndex ].firstChildIndex = newIndex;
+	return newIndex;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void ResetFrameNodes()
+{
+	s_frameNodes.clear();
+	s_frameNodes.push_back( profiler_node_t() );
+	s_frameNodes[ 0 ].name = "Frame";
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void RecordCompletedZone( ProfilerThreadLog* log, profiler_open_zone_t const& zone, uint64_t endTicks )
+{
+	uint64_t durationTicks = endTicks - zone.startTicks;
+	uint depth = log->m_openZoneCount;
+	if( depth > 0 )
+	{
+		log->m_openZones[ depth - 1 ].childTicks += durationTicks;
+	}
+
+	// Zones that straddle a frame marker are counted in the frame they end in, so the node path is
+	// resolved from the thread's open stack here rather than when the zone began
+	int nodeIndex = 0;
+	for( uint openIndex = 0; openIndex < depth; ++openIndex )
+	{
+		nodeIndex = FindOrAddFrameNode( nodeIndex, log->m_openZones[ openIndex ].name, log->m_threadIndex, openIndex );
+	}
+	nodeIndex = FindOrAddFrameNode( nodeIndex, zone.name, log->m_threadIndex, depth );
+
+	profiler_node_t& node = s_frameNodes[ nodeIndex ];
+	node.callCount++;
+	node.inclusiveTicks += durationTicks;
+	node.selfTicks += durationTicks - zone.childTicks;
+
+	profiler_zone_record_t& record = s_zoneHistory[ s_zoneHistoryCount % PROFILER_ZONE_HISTORY_SIZE ];
+	record.name			= zone.name;
+	record.startTicks	= zone.startTicks;
+	record.endTicks		= endTicks;
+	record.threadIndex	= log->m_threadIndex;
+	record.depth		= depth;
+	s_zoneHistoryCount++;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void DrainThreadLogs()
+{
+	std::scoped_lock lock( s_threadLogsLock );
+	for( uint logIndex = 0; logIndex < s_threadLogs.size(); ++logIndex )
+	{
+		ProfilerThreadLog* log = s_threadLogs[ logIndex ];
+
+		profiler_event_t event;
+		while( log->Pop( event ) )
+		{
+			if( event.name != nullptr )
+			{
+				if( log->m_openZoneCount < PROFILER_MAX_ZONE_DEPTH )
+				{
+					profiler_open_zone_t& openZone = log->m_openZones[ log->m_openZoneCount ];
+					openZone.name		= event.name;
+					openZone.startTicks	= event.ticks;
+					openZone.childTicks	= 0;
+				}
+				log->m_openZoneCount++;
+			}
+			else if( log->m_openZoneCount > 0 )
+			{
+				log->m_openZoneCount--;
+				if( log->m_openZoneCount < PROFILER_MAX_ZONE_DEPTH )
+				{
+					RecordCompletedZone( log, log->m_openZones[ log->m_openZoneCount ], event.ticks );
+				}
+			}
+		}
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static double TicksToMilliseconds( uint64_t ticks )
+{
+	return static_cast<double>( ticks ) * GetSecondsPerTick() * 1000.0;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static uint GetDroppedZoneCount()
+{
+	uint droppedZones = 0;
+
+	std::scoped_lock lock( s_threadLogsLock );
+	for( uint logIndex = 0; logIndex < s_threadLogs.size(); ++logIndex )
+	{
+		droppedZones += s_threadLogs[ logIndex ]->m_droppedZones.load();
+	}
+	return droppedZones;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static std::string GetThreadName( uint threadIndex )
+{
+	std::scoped_lock lock( s_threadLogsLock );
+	if( threadIndex >= s_threadLogs.size() )
+		return "";
+
+	return s_threadLogs[ threadIndex ]->m_threadName;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Depth first over the last frame's hierarchy with siblings ordered by inclusive time
+//---------------------------------------------------------------------------------------------------------
+static void GetSortedReportNodes( int parentIndex, std::vector<int>& out_nodeIndices, uint maxNodes )
+{
+	std::vector<int> childIndices;
+	int childIndex = s_lastFrameNodes[ parentIndex ].firstChildIndex;
+	while( childIndex != -1 )
+	{
+		childIndices.push_back( childIndex );
+		childIndex = s_lastFrameNodes[ childIndex ].nextSiblingIndex;
+	}
+
+	std::sort( childIndices.begin(), childIndices.end(), []( int a, int b ) { return s_lastFrameNodes[ a ].inclusiveTicks > s_lastFrameNodes[ b ].inclusiveTicks; } );
+
+	for( uint sortedIndex = 0; sortedIndex < childIndices.size(); ++sortedIndex )
+	{
+		if( out_nodeIndices.size() >= maxNodes )
+			return;
+
+		out_nodeIndices.push_back( childIndices[ sortedIndex ] );
+		GetSortedReportNodes( childIndices[ sortedIndex ], out_nodeIndices, maxNodes );
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static std::string GetReportLine( profiler_node_t const& node )
+{
+	std::string label = std::string( node.depth * 2, ' ' );
+	if( node.depth == 0 )
+	{
+		label += "[" + GetThreadName( node.threadIndex ) + "] ";
+	}
+	label += node.name;
+
+	return Stringf( "%-48s %8.3fms incl %8.3fms self %5u calls", label.c_str(), TicksToMilliseconds( node.inclusiveTicks ), TicksToMilliseconds( node.selfTicks ), node.callCount );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void RenderProfilerOverlay()
+{
+#if !defined( ENGINE_HEADLESS )
+	if( s_lastFrameNodes.empty() )
+		return;
+
+	std::vector<int> nodeIndices;
+	GetSortedReportNodes( 0, nodeIndices, PROFILER_OVERLAY_LINE_COUNT );
+
+	float lineHeight = PROFILER_OVERLAY_TEXT_SIZE * 1.2f;
+	Vec4 lineRatioOffset = Vec4( 0.f, 1.f, 10.f, -10.f );
+	DebugAddScreenTextf( lineRatioOffset, ALIGN_TOP_LEFT, PROFILER_OVERLAY_TEXT_SIZE, Rgba8::YELLOW, 0.f, "Frame %u  %.2fms  (%u zones dropped)", s_frameIndex - 1, s_lastFrameMilliseconds, GetDroppedZoneCount() );
+
+	for( uint lineIndex = 0; lineIndex < nodeIndices.size(); ++lineIndex )
+	{
+		lineRatioOffset.w -= lineHeight;
+		std::string line = GetReportLine( s_lastFrameNodes[ nodeIndices[ lineIndex ] ] );
+		DebugAddScreenTextf( lineRatioOffset, ALIGN_TOP_LEFT, PROFILER_OVERLAY_TEXT_SIZE, Rgba8::WHITE, 0.f, "%s", line.c_str() );
+	}
+#endif
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void profiler( EventArgs* args )
+{
+	ProfilerSetEnabled( args->GetValue( "enabled", !ProfilerIsEnabled() ) );
+	g_theConsole->PrintString( Rgba8::WHITE, "Profiler %s", ProfilerIsEnabled() ? "enabled" : "disabled" );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void profiler_overlay( EventArgs* args )
+{
+	ProfilerSetOverlayEnabled( args->GetValue( "enabled", !s_isOverlayEnabled ) );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void profiler_report( EventArgs* args )
+{
+	UNUSED( args );
+	ProfilerPrintReport();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void profiler_capture( EventArgs* args )
+{
+	std::string filepath = args->GetValue( "file", "ProfileCapture.json" );
+	if( ProfilerWriteChromeTrace( filepath.c_str() ) )
+	{
+		g_theConsole->PrintString( Rgba8::GREEN, "Wrote profile capture to %s", filepath.c_str() );
+	}
+	else
+	{
+		g_theConsole->ErrorString( "Could not write profile capture to %s", filepath.c_str() );
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void profiler_spike( EventArgs* args )
+{
+	ProfilerSetSpikeThresholdMilliseconds( args->GetValue( "ms", 0.0 ) );
+	g_theConsole->PrintString( Rgba8::WHITE, "Profiler spike capture threshold: %.2fms (0 disables)", s_spikeThresholdMilliseconds );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void SubscribeProfilerCommands()
+{
+	if( s_areCommandsSubscribed || g_theEventSystem == nullptr )
+		return;
+
+	g_theEventSystem->SubscribeEventCallbackFunction( "profiler", profiler );
+	g_theEventSystem->SubscribeEventCallbackFunction( "profiler_overlay", profiler_overlay );
+	g_theEventSystem->SubscribeEventCallbackFunction( "profiler_report", profiler_report );
+	g_theEventSystem->SubscribeEventCallbackFunction( "profiler_capture", profiler_capture );
+	g_theEventSystem->SubscribeEventCallbackFunction( "profiler_spike", profiler_spike );
+	s_areCommandsSubscribed = true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void CheckForFrameSpike()
+{
+	if( s_spikeThresholdMilliseconds <= 0.0 || s_lastFrameMilliseconds < s_spikeThresholdMilliseconds )
+		return;
+
+	// Don't let one long hitch write a capture every frame; wait until the history has turned over
+	if( s_lastSpikeCaptureFrame != 0 && s_frameIndex - s_lastSpikeCaptureFrame < PROFILER_FRAME_HISTORY_SIZE )
+		return;
+
+	s_lastSpikeCaptureFrame = s_frameIndex;
+	std::string filepath = Stringf( "ProfileSpike_%u.json", s_frameIndex - 1 );
+	if( ProfilerWriteChromeTrace( filepath.c_str() ) && g_theConsole != nullptr )
+	{
+		g_theConsole->PrintString( Rgba8::YELLOW, "Frame %u took %.2fms - wrote %s", s_frameIndex - 1, s_lastFrameMilliseconds, filepath.c_str() );
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Frame marker. Must be called once per frame from the main thread (Clock::BeginFrame does this); it is
+// the only consumer of the per-thread event rings.
+//---------------------------------------------------------------------------------------------------------
+void ProfilerBeginFrame()
+{
+	uint64_t frameStartTicks = GetCurrentTimeTicks();
+	SubscribeProfilerCommands();
+
+	if( s_frameIndex == 0 )
+	{
+		ProfilerSetThreadName( "Main" );
+		s_zoneHistory.resize( PROFILER_ZONE_HISTORY_SIZE );
+		ResetFrameNodes();
+	}
+	else
+	{
+		DrainThreadLogs();
+
+		s_lastFrameMilliseconds = TicksToMilliseconds( frameStartTicks - s_frameStartTicks );
+		s_lastFrameNodes.swap( s_frameNodes );
+		ResetFrameNodes();
+
+		profiler_frame_record_t& frameRecord = s_frameHistory[ s_frameHistoryCount % PROFILER_FRAME_HISTORY_SIZE ];
+		frameRecord.frameIndex	= s_frameIndex - 1;
+		frameRecord.startTicks	= s_frameStartTicks;
+		frameRecord.endTicks	= frameStartTicks;
+		s_frameHistoryCount++;
+
+		CheckForFrameSpike();
+		if( s_isOverlayEnabled )
+		{
+			RenderProfilerOverlay();
+		}
+	}
+
+	s_frameStartTicks = frameStartTicks;
+	s_frameIndex++;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void ProfilerSetEnabled( bool isEnabled )
+{
+	s_isProfilerEnabled = isEnabled;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool ProfilerIsEnabled()
+{
+	return s_isProfilerEnabled;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void ProfilerSetOverlayEnabled( bool isEnabled )
+{
+	s_isOverlayEnabled = isEnabled;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void ProfilerSetSpikeThresholdMilliseconds( double thresholdMilliseconds )
+{
+	s_spikeThresholdMilliseconds = thresholdMilliseconds;
+	s_lastSpikeCaptureFrame = 0;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void ProfilerPrintReport()
+{
+	if( g_theConsole == nullptr )
+		return;
+
+	g_theConsole->PrintString( Rgba8::WHITE, "Frame %u: %.2fms, %u zones dropped", s_frameIndex - 1, s_lastFrameMilliseconds, GetDroppedZoneCount() );
+	if( s_lastFrameNodes.empty() )
+		return;
+
+	std::vector<int> nodeIndices;
+	GetSortedReportNodes( 0, nodeIndices, static_cast<uint>( s_lastFrameNodes.size() ) );
+	for( uint lineIndex = 0; lineIndex < nodeIndices.size(); ++lineIndex )
+	{
+		g_theConsole->PrintString( Rgba8::WHITE, GetReportLine( s_lastFrameNodes[ nodeIndices[ lineIndex ] ] ) );
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void WriteJsonEscapedString( FILE* file, char const* text )
+{
+	fputc( '"', file );
+	for( char const* character = text; *character != '\0'; ++character )
+	{
+		if( *character == '"' || *character == '\\' )
+		{
+			fputc( '\\', file );
+		}
+		fputc( *character, file );
+	}
+	fputc( '"', file );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Chrome trace event format (load in chrome://tracing or Perfetto). Covers whatever is still held in the
+// zone and frame histories; timestamps are microseconds from the oldest frame kept.
+//---------------------------------------------------------------------------------------------------------
+bool ProfilerWriteChromeTrace( char const* filepath )
+{
+	FILE* file = nullptr;
+	fopen_s( &file, filepath, "w" );
+	if( file == nullptr )
+		return false;
+
+	uint frameCount = Min( s_frameHistoryCount, PROFILER_FRAME_HISTORY_SIZE );
+	uint firstFrame = s_frameHistoryCount - frameCount;
+	uint64_t originTicks = frameCount > 0 ? s_frameHistory[ firstFrame % PROFILER_FRAME_HISTORY_SIZE ].startTicks : s_frameStartTicks;
+	double microsecondsPerTick = GetSecondsPerTick() * 1000000.0;
+
+	fputs( "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", file );
+	fprintf( file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"Frames\"}}", PROFILER_FRAMES_TID );
+	{
+		std::scoped_lock lock( s_threadLogsLock );
+		for( uint logIndex = 0; logIndex < s_threadLogs.size(); ++logIndex )
+		{
+			fprintf( file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":", logIndex );
+			WriteJsonEscapedString( file, s_threadLogs[ logIndex ]->m_threadName.c_str() );
+			fputs( "}}", file );
+		}
+	}
+
+	for( uint frameNumber = firstFrame; frameNumber < s_frameHistoryCount; ++frameNumber )
+	{
+		profiler_frame_record_t const& frame = s_frameHistory[ frameNumber % PROFILER_FRAME_HISTORY_SIZE ];
+		double startMicroseconds = static_cast<double>( frame.startTicks - originTicks ) * microsecondsPerTick;
+		double durationMicroseconds = static_cast<double>( frame.endTicks - frame.startTicks ) * microsecondsPerTick;
+		fprintf( file, ",\n{\"name\":\"Frame %u\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", frame.frameIndex, PROFILER_FRAMES_TID, startMicroseconds, durationMicroseconds );
+		fprintf( file, ",\n{\"name\":\"Frame %u\",\"cat\":\"frame\",\"ph\":\"i\",\"s\":\"g\",\"pid\":0,\"tid\":%u,\"ts\":%.3f}", frame.frameIndex, PROFILER_FRAMES_TID, startMicroseconds );
+	}
+
+	uint64_t zoneCount = s_zoneHistoryCount < PROFILER_ZONE_HISTORY_SIZE ? s_zoneHistoryCount : PROFILER_ZONE_HISTORY_SIZE;
+	for( uint64_t zoneNumber = s_zoneHistoryCount - zoneCount; zoneNumber < s_zoneHistoryCount; ++zoneNumber )
+	{
+		profiler_zone_record_t const& zone = s_zoneHistory[ zoneNumber % PROFILER_ZONE_HISTORY_SIZE ];
+		if( zone.startTicks < originTicks )
+			continue;
+
+		fputs( ",\n{\"name\":", file );
+		WriteJsonEscapedString( file, zone.name );
+		double startMicroseconds = static_cast<double>( zone.startTicks - originTicks ) * microsecondsPerTick;
+		double durationMicroseconds = static_cast<double>( zone.endTicks - zone.startTicks ) * microsecondsPerTick;
+		fprintf( file, ",\"cat\":\"zone\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", zone.threadIndex, startMicroseconds, durationMicroseconds );
+	}
+
+	fputs( "\n]}\n", file );
+	fclose( file );
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+uint ProfilerGetFrameIndex()
+{
+	return s_frameIndex;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+double ProfilerGetLastFrameMilliseconds()
+{
+	return s_lastFrameMilliseconds;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+double ProfilerGetLastFrameZoneMilliseconds( char const* zoneName )
+{
+	uint64_t inclusiveTicks = 0;
+	for( uint nodeIndex = 1; nodeIndex < s_lastFrameNodes.size(); ++nodeIndex )
+	{
+		profiler_node_t const& node = s_lastFrameNodes[ nodeIndex ];
+		if( strcmp( node.name, zoneName ) == 0 )
+		{
+			inclusiveTicks += node.inclusiveTicks;
+		}
+	}
+	return TicksToMilliseconds( inclusiveTicks );
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+#include "Engine/Core/EngineCommon.hpp"
+#include "Game/EngineBuildPreferences.hpp"
+#include <stdint.h>
+
+
+//---------------------------------------------------------------------------------------------------------
+// Scoped zone profiler. Every thread that opens a zone gets its own lock-free ring of begin/end events;
+// the main thread drains the rings at each frame marker and rebuilds that frame's zone hierarchy.
+// Zone names must be string literals (or otherwise outlive the profiler) since only the pointer is kept.
+//
+// Define ENGINE_DISABLE_PROFILER in the game's EngineBuildPreferences.hpp to compile zones out entirely.
+//---------------------------------------------------------------------------------------------------------
+#define PROFILE_CONCAT_INNER( a, b )	a##b
+#define PROFILE_CONCAT( a, b )			PROFILE_CONCAT_INNER( a, b )
+
+#if defined( ENGINE_DISABLE_PROFILER )
+	#define PROFILE_SCOPE( zoneName )
+#else
+	#define PROFILE_SCOPE( zoneName )	ProfileScope PROFILE_CONCAT( profileScope_, __LINE__ )( zoneName )
+#endif
+
+
+//---------------------------------------------------------------------------------------------------------
+void	ProfilerBeginFrame();
+void	ProfilerSetThreadName( char const* threadName );
+bool	ProfilerBeginZone( char const* zoneName );
+void	ProfilerEndZone();
+
+void	ProfilerSetEnabled( bool isEnabled );
+bool	ProfilerIsEnabled();
+void	ProfilerSetOverlayEnabled( bool isEnabled );
+void	ProfilerSetSpikeThresholdMilliseconds( double thresholdMilliseconds );
+void	ProfilerPrintReport();
+bool	ProfilerWriteChromeTrace( char const* filepath );
+
+uint	ProfilerGetFrameIndex();
+double	ProfilerGetLastFrameMilliseconds();
+double	ProfilerGetLastFrameZoneMilliseconds( char const* zoneName );
+
+
+//---------------------------------------------------------------------------------------------------------
+class ProfileScope
+{
+public:
+	explicit ProfileScope( char const* zoneName )	: m_isRecording( ProfilerBeginZone( zoneName ) ) {}
+	~ProfileScope()									{ if( m_isRecording ) { ProfilerEndZone(); } }
+
+	ProfileScope( ProfileScope const& copy ) = delete;
+	ProfileScope& operator=( ProfileScope const& copy ) = delete;
+
+private:
+	bool m_isRecording = false;
+};
\ No newline at end of file
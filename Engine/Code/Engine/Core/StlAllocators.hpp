@@ -0,0 +1,63 @@
+#pragma once
+#include "Engine/Core/LinearArena.hpp"
+#include "Engine/Core/BlockPool.hpp"
+#include <vector>
+
+
+//---------------------------------------------------------------------------------------------------------
+// Standard container allocator over a LinearArena. Deallocate is a no-op; growth leaves the old buffer
+// behind until the arena resets, so reserve() up front when the size is known.
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+class ArenaAllocator
+{
+public:
+	typedef T value_type;
+
+	ArenaAllocator()												: m_arena( &GetFrameArena() ) {}
+	explicit ArenaAllocator( LinearArena& arena )					: m_arena( &arena ) {}
+	template<typename U>
+	ArenaAllocator( ArenaAllocator<U> const& copy )					: m_arena( copy.GetArena() ) {}
+
+	T*				allocate( size_t count )						{ return static_cast<T*>( m_arena->Allocate( sizeof( T ) * count, alignof( T ) ) ); }
+	void			deallocate( T* memory, size_t count )			{ UNUSED( memory ); UNUSED( count ); }
+
+	LinearArena*	GetArena() const								{ return m_arena; }
+
+	template<typename U>
+	bool operator==( ArenaAllocator<U> const& compare ) const		{ return m_arena == compare.GetArena(); }
+	template<typename U>
+	bool operator!=( ArenaAllocator<U> const& compare ) const		{ return m_arena != compare.GetArena(); }
+
+private:
+	LinearArena* m_arena = nullptr;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Standard container allocator over the block pools; suited to node containers (list, map, set) whose
+// nodes are small and churn often.
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+class PoolAllocator
+{
+public:
+	typedef T value_type;
+
+	PoolAllocator() = default;
+	template<typename U>
+	PoolAllocator( PoolAllocator<U> const& copy )					{ UNUSED( copy ); }
+
+	T*		allocate( size_t count )								{ return static_cast<T*>( PoolAllocate( sizeof( T ) * count ) ); }
+	void	deallocate( T* memory, size_t count )					{ PoolFree( memory, sizeof( T ) * count ); }
+
+	template<typename U>
+	bool operator==( PoolAllocator<U> const& compare ) const		{ UNUSED( compare ); return true; }
+	template<typename U>
+	bool operator!=( PoolAllocator<U> const& compare ) const		{ UNUSED( compare ); return false; }
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+using FrameVector = std::vector<T, ArenaAllocator<T>>;
\ No newline at end of file
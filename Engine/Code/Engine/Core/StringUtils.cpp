@@ -1,5 +1,6 @@
 #include "Engine/Core/StringUtils.hpp"
 #include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Platform/Platform.hpp"
 #include <stdarg.h>
 
 
@@ -67,6 +68,48 @@ Strings SplitStringOnDelimiter( const std::string& originalString, char delimete
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+// 32-bit FNV-1a
+uint HashString( char const* string, size_t length )
+{
+	uint hash = 2166136261u;
+	for( size_t charIndex = 0; charIndex < length; ++charIndex )
+	{
+		hash ^= static_cast<unsigned char>( string[ charIndex ] );
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+uint HashString( char const* string )
+{
+	return HashString( string, strlen( string ) );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+uint HashString( std::string const& string )
+{
+	return HashString( string.c_str(), string.length() );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// 64-bit FNV-1a; pass the previous result back in as hash to fold several buffers into one
+uint64_t HashBytes64( void const* bytes, size_t byteCount, uint64_t hash )
+{
+	unsigned char const* byteArray = reinterpret_cast<unsigned char const*>( bytes );
+	for( size_t byteIndex = 0; byteIndex < byteCount; ++byteIndex )
+	{
+		hash ^= byteArray[ byteIndex ];
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 std::string FindNextWord( std::string const& string, unsigned int& startIndex )
 {
@@ -2,6 +2,8 @@
 //---------------------------------------------------------------------------------------------------------
 #include <string>
 #include <vector>
+#include <stdint.h>
+#include <string.h>
 
 typedef std::vector< std::string > Strings;
 typedef unsigned int uint;
@@ -26,6 +28,12 @@ inline bool IsAlphaNumeric( char const c )		{ return (IsAlpha(c) || IsNumeric(c)
 //---------------------------------------------------------------------------------------------------------
 inline bool IsStringEqual( char const* a, char const* b )	{ return ( strcmp( a, b ) == 0 ); }
 
+//---------------------------------------------------------------------------------------------------------
+uint HashString( char const* string );
+uint HashString( char const* string, size_t length );
+uint HashString( std::string const& string );
+uint64_t HashBytes64( void const* bytes, size_t byteCount, uint64_t hash = 14695981039346656037ull );
+
 //---------------------------------------------------------------------------------------------------------
 std::string FindNextWord( std::string const& stringToParse, unsigned int& startIndex );
 
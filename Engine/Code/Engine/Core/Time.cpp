@@ -4,6 +4,9 @@
 
 //-----------------------------------------------------------------------------------------------
 #include "Engine/Core/Time.hpp"
+#include "Engine/Platform/Platform.hpp"
+
+#if defined( PLATFORM_WINDOWS )
 #define WIN32_LEAN_AND_MEAN
 #include <Windows.h>
 
@@ -32,3 +35,59 @@ double GetCurrentTimeSeconds()
 }
 
 
+//-----------------------------------------------------------------------------------------------
+// Raw counter read for hot paths like profiler zones - no subtraction or conversion to seconds
+//-----------------------------------------------------------------------------------------------
+uint64_t GetCurrentTimeTicks()
+{
+	LARGE_INTEGER currentCount;
+	QueryPerformanceCounter( &currentCount );
+	return static_cast< uint64_t >( currentCount.QuadPart );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+double GetSecondsPerTick()
+{
+	static double secondsPerTick = 0.0;
+	if( secondsPerTick == 0.0 )
+	{
+		LARGE_INTEGER countsPerSecond;
+		QueryPerformanceFrequency( &countsPerSecond );
+		secondsPerTick = 1.0 / static_cast< double >( countsPerSecond.QuadPart );
+	}
+	return secondsPerTick;
+}
+
+
+#else
+#include <time.h>
+
+
+//-----------------------------------------------------------------------------------------------
+// CLOCK_MONOTONIC never jumps with wall clock changes; ticks are nanoseconds
+//-----------------------------------------------------------------------------------------------
+uint64_t GetCurrentTimeTicks()
+{
+	timespec currentTime;
+	clock_gettime( CLOCK_MONOTONIC, &currentTime );
+	return static_cast< uint64_t >( currentTime.tv_sec ) * 1000000000ull + static_cast< uint64_t >( currentTime.tv_nsec );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+double GetCurrentTimeSeconds()
+{
+	static uint64_t initialTicks = GetCurrentTimeTicks();
+	uint64_t elapsedTicksSinceInitialTime = GetCurrentTimeTicks() - initialTicks;
+	return static_cast< double >( elapsedTicksSinceInitialTime ) * GetSecondsPerTick();
+}
+
+
+//-----------------------------------------------------------------------------------------------
+double GetSecondsPerTick()
+{
+	return 1.0 / 1000000000.0;
+}
+
+#endif
@@ -2,8 +2,10 @@
 // Time.hpp
 //
 #pragma once
+#include <stdint.h>
 
 
 //-----------------------------------------------------------------------------------------------
 double GetCurrentTimeSeconds();
-
+uint64_t GetCurrentTimeTicks();
+double GetSecondsPerTick();
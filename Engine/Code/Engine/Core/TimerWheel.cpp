@@ -0,0 +1,392 @@
+#include "Engine/Core/TimerWheel.hpp"
+
+
+//---------------------------------------------------------------------------------------------------------
+STATIC const TimerHandle TimerHandle::INVALID = TimerHandle();
+
+
+//---------------------------------------------------------------------------------------------------------
+TimerWheel::TimerWheel( double currentSeconds )
+{
+	for( int listIndex = 0; listIndex <= DUE_LIST_INDEX; ++listIndex )
+	{
+		m_listHeads[ listIndex ] = -1;
+	}
+	m_nextTick = GetTickForSeconds( currentSeconds );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+TimerHandle TimerWheel::Schedule( double deadlineSeconds, TimerCallbackFunctionPtrType callback, void* userData, double periodSeconds )
+{
+	TimerHandle handle = AllocateEntry();
+
+	TimerEntry& entry = m_entries[ handle.m_index ];
+	entry.m_deadlineSeconds	= deadlineSeconds;
+	entry.m_periodSeconds	= periodSeconds;
+	entry.m_deadlineTick	= GetTickForSeconds( deadlineSeconds );
+	entry.m_callback		= callback;
+	entry.m_userData		= userData;
+
+	Link( handle.m_index );
+	return handle;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+TimerHandle TimerWheel::ScheduleFlag( double deadlineSeconds, bool* flagToSet )
+{
+	TimerHandle handle = AllocateEntry();
+
+	TimerEntry& entry = m_entries[ handle.m_index ];
+	entry.m_deadlineSeconds	= deadlineSeconds;
+	entry.m_deadlineTick	= GetTickForSeconds( deadlineSeconds );
+	entry.m_flagToSet		= flagToSet;
+
+	Link( handle.m_index );
+	return handle;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void TimerWheel::Cancel( TimerHandle handle )
+{
+	if( GetScheduledEntry( handle ) == nullptr )
+		return;
+
+	// Entries already pulled out for firing this advance are no longer in a list
+	if( m_entries[ handle.m_index ].m_state == TIMER_ENTRY_SCHEDULED )
+	{
+		Unlink( handle.m_index );
+	}
+	FreeEntry( handle.m_index );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void TimerWheel::CancelAll()
+{
+	for( uint entryIndex = 0; entryIndex < m_entries.size(); ++entryIndex )
+	{
+		if( m_entries[ entryIndex ].m_state != TIMER_ENTRY_FREE )
+		{
+			m_entries[ entryIndex ].m_listIndex = -1;
+			FreeEntry( entryIndex );
+		}
+	}
+
+	for( int listIndex = 0; listIndex <= DUE_LIST_INDEX; ++listIndex )
+	{
+		m_listHeads[ listIndex ] = -1;
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Walks every tick between the last advance and now. A tick that starts a new block of a level pulls that
+// level's slot down (and the level above it when that one wraps too); each level 0 slot passed over is
+// moved to the due list, which is then fired against the exact deadline in seconds.
+//---------------------------------------------------------------------------------------------------------
+void TimerWheel::AdvanceTo( double currentSeconds )
+{
+	uint64_t targetTick = GetTickForSeconds( currentSeconds );
+	if( m_scheduledCount == 0 )
+	{
+		if( m_nextTick <= targetTick )
+		{
+			m_nextTick = targetTick + 1;
+		}
+		return;
+	}
+
+	while( m_nextTick <= targetTick )
+	{
+		if( ( m_nextTick & ( SLOTS_PER_LEVEL - 1 ) ) == 0 )
+		{
+			for( uint level = 1; level < LEVEL_COUNT; ++level )
+			{
+				CascadeSlot( level );
+
+				uint levelSlot = static_cast<uint>( m_nextTick >> ( SLOT_BITS * level ) ) & ( SLOTS_PER_LEVEL - 1 );
+				if( levelSlot != 0 )
+					break;
+			}
+		}
+
+		int slotListIndex = static_cast<int>( m_nextTick & ( SLOTS_PER_LEVEL - 1 ) );
+		int entryIndex = m_listHeads[ slotListIndex ];
+		while( entryIndex != -1 )
+		{
+			int nextIndex = m_entries[ entryIndex ].m_nextIndex;
+			Unlink( entryIndex );
+			LinkToList( entryIndex, DUE_LIST_INDEX );
+			entryIndex = nextIndex;
+		}
+
+		++m_nextTick;
+	}
+
+	FireDueEntries( currentSeconds );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// For when the owning clock's time jumps backwards - deadlines stay where they were in clock time
+//---------------------------------------------------------------------------------------------------------
+void TimerWheel::Rebase( double currentSeconds )
+{
+	for( int listIndex = 0; listIndex <= DUE_LIST_INDEX; ++listIndex )
+	{
+		m_listHeads[ listIndex ] = -1;
+	}
+	m_nextTick = GetTickForSeconds( currentSeconds );
+
+	for( uint entryIndex = 0; entryIndex < m_entries.size(); ++entryIndex )
+	{
+		if( m_entries[ entryIndex ].m_state == TIMER_ENTRY_SCHEDULED )
+		{
+			Link( entryIndex );
+		}
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool TimerWheel::IsScheduled( TimerHandle handle ) const
+{
+	return GetScheduledEntry( handle ) != nullptr;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+double TimerWheel::GetDeadlineSeconds( TimerHandle handle ) const
+{
+	TimerEntry const* entry = GetScheduledEntry( handle );
+	if( entry == nullptr )
+		return -1.0;
+
+	return entry->m_deadlineSeconds;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+TimerHandle TimerWheel::AllocateEntry()
+{
+	uint entryIndex = 0;
+	if( m_firstFreeIndex != -1 )
+	{
+		entryIndex = static_cast<uint>( m_firstFreeIndex );
+		m_firstFreeIndex = m_entries[ entryIndex ].m_nextIndex;
+	}
+	else
+	{
+		entryIndex = static_cast<uint>( m_entries.size() );
+		m_entries.push_back( TimerEntry() );
+	}
+
+	TimerEntry& entry = m_entries[ entryIndex ];
+	entry.m_state		= TIMER_ENTRY_SCHEDULED;
+	entry.m_listIndex	= -1;
+	entry.m_prevIndex	= -1;
+	entry.m_nextIndex	= -1;
+	m_scheduledCount++;
+
+	return TimerHandle( entryIndex, entry.m_generation );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void TimerWheel::FreeEntry( uint entryIndex )
+{
+	TimerEntry& entry = m_entries[ entryIndex ];
+	entry.m_generation++;
+	entry.m_state		= TIMER_ENTRY_FREE;
+	entry.m_callback	= nullptr;
+	entry.m_userData	= nullptr;
+	entry.m_flagToSet	= nullptr;
+	entry.m_periodSeconds = 0.0;
+	entry.m_prevIndex	= -1;
+	entry.m_nextIndex	= m_firstFreeIndex;
+	m_firstFreeIndex = static_cast<int>( entryIndex );
+	m_scheduledCount--;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void TimerWheel::Link( uint entryIndex )
+{
+	TimerEntry const& entry = m_entries[ entryIndex ];
+	if( entry.m_deadlineTick < m_nextTick )
+	{
+		LinkToList( entryIndex, DUE_LIST_INDEX );
+		return;
+	}
+
+	// Anything past the top level's reach parks in its furthest slot and is re-placed when that cascades
+	uint64_t const maxDelta = static_cast<uint64_t>( 1 ) << ( SLOT_BITS * LEVEL_COUNT );
+	uint64_t delta = entry.m_deadlineTick - m_nextTick;
+	uint64_t placementTick = entry.m_deadlineTick;
+	if( delta >= maxDelta )
+	{
+		delta = maxDelta - 1;
+		placementTick = m_nextTick + delta;
+	}
+
+	uint level = 0;
+	while( level + 1 < LEVEL_COUNT && delta >= ( static_cast<uint64_t>( 1 ) << ( SLOT_BITS * ( level + 1 ) ) ) )
+	{
+		++level;
+	}
+
+	uint slot = static_cast<uint>( placementTick >> ( SLOT_BITS * level ) ) & ( SLOTS_PER_LEVEL - 1 );
+	LinkToList( entryIndex, static_cast<int>( level * SLOTS_PER_LEVEL + slot ) );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void TimerWheel::LinkToList( uint entryIndex, int listIndex )
+{
+	TimerEntry& entry = m_entries[ entryIndex ];
+	entry.m_listIndex	= listIndex;
+	entry.m_prevIndex	= -1;
+	entry.m_nextIndex	= m_listHeads[ listIndex ];
+
+	if( entry.m_nextIndex != -1 )
+	{
+		m_entries[ entry.m_nextIndex ].m_prevIndex = static_cast<int>( entryIndex );
+	}
+	m_listHeads[ listIndex ] = static_cast<int>( entryIndex );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void TimerWheel::Unlink( uint entryIndex )
+{
+	TimerEntry& entry = m_entries[ entryIndex ];
+	if( entry.m_listIndex == -1 )
+		return;
+
+	if( entry.m_prevIndex != -1 )
+	{
+		m_entries[ entry.m_prevIndex ].m_nextIndex = entry.m_nextIndex;
+	}
+	else
+	{
+		m_listHeads[ entry.m_listIndex ] = entry.m_nextIndex;
+	}
+
+	if( entry.m_nextIndex != -1 )
+	{
+		m_entries[ entry.m_nextIndex ].m_prevIndex = entry.m_prevIndex;
+	}
+
+	entry.m_listIndex	= -1;
+	entry.m_prevIndex	= -1;
+	entry.m_nextIndex	= -1;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void TimerWheel::CascadeSlot( uint level )
+{
+	uint slot = static_cast<uint>( m_nextTick >> ( SLOT_BITS * level ) ) & ( SLOTS_PER_LEVEL - 1 );
+	int listIndex = static_cast<int>( level * SLOTS_PER_LEVEL + slot );
+
+	int entryIndex = m_listHeads[ listIndex ];
+	m_listHeads[ listIndex ] = -1;
+	while( entryIndex != -1 )
+	{
+		int nextIndex = m_entries[ entryIndex ].m_nextIndex;
+		m_entries[ entryIndex ].m_listIndex = -1;
+		Link( entryIndex );
+		entryIndex = nextIndex;
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Callbacks may schedule or cancel timers (including the one firing), so expired entries are pulled out
+// first and each is re-validated before it fires. Repeating timers re-arm before their callback runs and
+// keep firing until they have caught up with the current time.
+//---------------------------------------------------------------------------------------------------------
+void TimerWheel::FireDueEntries( double currentSeconds )
+{
+	while( m_listHeads[ DUE_LIST_INDEX ] != -1 )
+	{
+		m_firingScratch.clear();
+
+		int entryIndex = m_listHeads[ DUE_LIST_INDEX ];
+		while( entryIndex != -1 )
+		{
+			TimerEntry& entry = m_entries[ entryIndex ];
+			int nextIndex = entry.m_nextIndex;
+			if( entry.m_deadlineSeconds <= currentSeconds )
+			{
+				Unlink( entryIndex );
+				entry.m_state = TIMER_ENTRY_FIRING;
+				m_firingScratch.push_back( static_cast<uint>( entryIndex ) );
+			}
+			entryIndex = nextIndex;
+		}
+
+		if( m_firingScratch.empty() )
+			return;
+
+		for( uint firingIndex = 0; firingIndex < m_firingScratch.size(); ++firingIndex )
+		{
+			uint firingEntryIndex = m_firingScratch[ firingIndex ];
+			TimerEntry& entry = m_entries[ firingEntryIndex ];
+			if( entry.m_state != TIMER_ENTRY_FIRING )
+				continue;
+
+			TimerCallbackFunctionPtrType callback = entry.m_callback;
+			void* userData = entry.m_userData;
+			bool* flagToSet = entry.m_flagToSet;
+
+			if( entry.m_periodSeconds > 0.0 )
+			{
+				entry.m_deadlineSeconds += entry.m_periodSeconds;
+				entry.m_deadlineTick = GetTickForSeconds( entry.m_deadlineSeconds );
+				entry.m_state = TIMER_ENTRY_SCHEDULED;
+				Link( firingEntryIndex );
+			}
+			else
+			{
+				FreeEntry( firingEntryIndex );
+			}
+
+			if( flagToSet != nullptr )
+			{
+				*flagToSet = true;
+			}
+			if( callback != nullptr )
+			{
+				callback( userData );
+			}
+		}
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+TimerWheel::TimerEntry const* TimerWheel::GetScheduledEntry( TimerHandle handle ) const
+{
+	if( handle.m_index >= m_entries.size() )
+		return nullptr;
+
+	TimerEntry const& entry = m_entries[ handle.m_index ];
+	if( entry.m_state == TIMER_ENTRY_FREE || entry.m_generation != handle.m_generation )
+		return nullptr;
+
+	return &entry;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+uint64_t TimerWheel::GetTickForSeconds( double seconds ) const
+{
+	if( seconds <= 0.0 )
+		return 0;
+
+	return static_cast<uint64_t>( seconds * static_cast<double>( TICKS_PER_SECOND ) );
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+#include "Engine/Core/EngineCommon.hpp"
+#include <stdint.h>
+#include <vector>
+
+
+typedef void( *TimerCallbackFunctionPtrType )( void* userData );
+
+
+//---------------------------------------------------------------------------------------------------------
+struct TimerHandle
+{
+public:
+	TimerHandle() = default;
+	explicit TimerHandle( uint index, uint generation )	: m_index( index ), m_generation( generation ) {}
+
+	bool IsValid() const								{ return m_index != INVALID_INDEX; }
+	bool operator==( TimerHandle const& compare ) const	{ return m_index == compare.m_index && m_generation == compare.m_generation; }
+	bool operator!=( TimerHandle const& compare ) const	{ return !( *this == compare ); }
+
+public:
+	static const uint INVALID_INDEX = 0xFFFFFFFF;
+	static const TimerHandle INVALID;
+
+	uint m_index		= INVALID_INDEX;
+	uint m_generation	= 0;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Hierarchical timer wheel driven by one clock's total time. Deadlines are bucketed by millisecond tick
+// into four levels of 256 slots; each level covers 256x the span of the one below and is cascaded down
+// as time reaches it, so advancing only touches the slots passed over plus the timers that expire.
+// A flag target must outlive its timer - cancel the timer before the flag goes away.
+//---------------------------------------------------------------------------------------------------------
+class TimerWheel
+{
+public:
+	TimerWheel( double currentSeconds = 0.0 );
+
+	TimerHandle	Schedule( double deadlineSeconds, TimerCallbackFunctionPtrType callback, void* userData, double periodSeconds = 0.0 );
+	TimerHandle	ScheduleFlag( double deadlineSeconds, bool* flagToSet );
+	void		Cancel( TimerHandle handle );
+	void		CancelAll();
+
+	void		AdvanceTo( double currentSeconds );
+	void		Rebase( double currentSeconds );
+
+	bool		IsScheduled( TimerHandle handle ) const;
+	double		GetDeadlineSeconds( TimerHandle handle ) const;
+	uint		GetScheduledCount() const					{ return m_scheduledCount; }
+
+public:
+	static constexpr uint	TICKS_PER_SECOND	= 1000;
+	static constexpr uint	LEVEL_COUNT			= 4;
+	static constexpr uint	SLOT_BITS			= 8;
+	static constexpr uint	SLOTS_PER_LEVEL		= 1 << SLOT_BITS;
+
+private:
+	enum TimerEntryState : uint8_t
+	{
+		TIMER_ENTRY_FREE,
+		TIMER_ENTRY_SCHEDULED,
+		TIMER_ENTRY_FIRING,
+	};
+
+	struct TimerEntry
+	{
+		double							m_deadlineSeconds	= 0.0;
+		double							m_periodSeconds		= 0.0;
+		uint64_t						m_deadlineTick		= 0;
+		TimerCallbackFunctionPtrType	m_callback			= nullptr;
+		void*							m_userData			= nullptr;
+		bool*							m_flagToSet			= nullptr;
+		uint							m_generation		= 0;
+		int								m_listIndex			= -1;
+		int								m_prevIndex			= -1;
+		int								m_nextIndex			= -1;
+		TimerEntryState					m_state				= TIMER_ENTRY_FREE;
+	};
+
+	TimerHandle	AllocateEntry();
+	void		FreeEntry( uint entryIndex );
+	void		Link( uint entryIndex );
+	void		LinkToList( uint entryIndex, int listIndex );
+	void		Unlink( uint entryIndex );
+	void		CascadeSlot( uint level );
+	void		FireDueEntries( double currentSeconds );
+	TimerEntry const* GetScheduledEntry( TimerHandle handle ) const;
+
+	uint64_t	GetTickForSeconds( double seconds ) const;
+
+private:
+	static constexpr int DUE_LIST_INDEX	= LEVEL_COUNT * SLOTS_PER_LEVEL;
+
+	std::vector<TimerEntry>	m_entries;
+	std::vector<uint>		m_firingScratch;
+	int						m_listHeads[ DUE_LIST_INDEX + 1 ];
+	int						m_firstFreeIndex	= -1;
+	uint					m_scheduledCount	= 0;
+	uint64_t				m_nextTick			= 0;
+};
\ No newline at end of file
@@ -1,17 +1,18 @@
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/XmlUtils.hpp"
+#include "Engine/Core/BakedXml.hpp"
 #include "Engine/Math/Vec2.hpp"
 #include "Engine/Math/Vec3.hpp"
 #include "Engine/Math/IntVec2.hpp"
 #include "Engine/Math/IntRange.hpp"
 #include "Engine/Math/FloatRange.hpp"
 #include "Engine/Math/AABB2.hpp"
+#include "Engine/Platform/Platform.hpp"
 
 
 //---------------------------------------------------------------------------------------------------------
-int ParseXmlAttribute( const XmlElement& element, const char* attributeName, int defaultValue )
+static int ParseXmlAttributeText( const char* attributeValueText, int defaultValue )
 {
-	const char* attributeValueText = element.Attribute( attributeName );
 	int value = defaultValue;
 	if( attributeValueText )
 	{
@@ -22,9 +23,22 @@ int ParseXmlAttribute( const XmlElement& element, const char* attributeName, int
 
 
 //---------------------------------------------------------------------------------------------------------
-char ParseXmlAttribute( const XmlElement& element, const char* attributeName, char defaultValue )
+int ParseXmlAttribute( const XmlElement& element, const char* attributeName, int defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+int ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, int defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static char ParseXmlAttributeText( const char* attributeValueText, char defaultValue )
 {
-	const char* attributeValueText = element.Attribute( attributeName );
 	char value = defaultValue;
 	if( attributeValueText )
 	{
@@ -35,9 +49,22 @@ char ParseXmlAttribute( const XmlElement& element, const char* attributeName, ch
 
 
 //---------------------------------------------------------------------------------------------------------
-bool ParseXmlAttribute( const XmlElement& element, const char* attributeName, bool defaultValue )
+char ParseXmlAttribute( const XmlElement& element, const char* attributeName, char defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+char ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, char defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static bool ParseXmlAttributeText( const char* attributeValueText, bool defaultValue )
 {
-	const char* attributeValueText = element.Attribute( attributeName );
 	bool value = defaultValue;
 	if( attributeValueText )
 	{
@@ -65,9 +92,22 @@ bool ParseXmlAttribute( const XmlElement& element, const char* attributeName, bo
 
 
 //---------------------------------------------------------------------------------------------------------
-float ParseXmlAttribute( const XmlElement& element, const char* attributeName, float defaultValue )
+bool ParseXmlAttribute( const XmlElement& element, const char* attributeName, bool defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, bool defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static float ParseXmlAttributeText( const char* attributeValueText, float defaultValue )
 {
-	const char* attributeValueText = element.Attribute( attributeName );
 	float value = defaultValue;
 	if( attributeValueText )
 	{
@@ -78,9 +118,22 @@ float ParseXmlAttribute( const XmlElement& element, const char* attributeName, f
 
 
 //---------------------------------------------------------------------------------------------------------
-Rgba8 ParseXmlAttribute( const XmlElement& element, const char* attributeName, const Rgba8& defaultValue )
+float ParseXmlAttribute( const XmlElement& element, const char* attributeName, float defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+float ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, float defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static Rgba8 ParseXmlAttributeText( const char* attributeValueText, const Rgba8& defaultValue )
 {
-	const char* attributeValueText = element.Attribute( attributeName );
 	Rgba8 value = defaultValue;
 	if( attributeValueText )
 	{
@@ -91,9 +144,22 @@ Rgba8 ParseXmlAttribute( const XmlElement& element, const char* attributeName, c
 
 
 //---------------------------------------------------------------------------------------------------------
-Vec2 ParseXmlAttribute( const XmlElement& element, const char* attributeName, const Vec2& defaultValue )
+Rgba8 ParseXmlAttribute( const XmlElement& element, const char* attributeName, const Rgba8& defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+Rgba8 ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, const Rgba8& defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static Vec2 ParseXmlAttributeText( const char* attributeValueText, const Vec2& defaultValue )
 {
-	const char* attributeValueText = element.Attribute( attributeName );
 	Vec2 value = defaultValue;
 	if( attributeValueText )
 	{
@@ -104,9 +170,22 @@ Vec2 ParseXmlAttribute( const XmlElement& element, const char* attributeName, co
 
 
 //---------------------------------------------------------------------------------------------------------
-IntVec2 ParseXmlAttribute( const XmlElement& element, const char* attributeName, const IntVec2& defaultValue )
+Vec2 ParseXmlAttribute( const XmlElement& element, const char* attributeName, const Vec2& defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+Vec2 ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, const Vec2& defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static IntVec2 ParseXmlAttributeText( const char* attributeValueText, const IntVec2& defaultValue )
 {
-	const char* attributeValueText = element.Attribute( attributeName );
 	IntVec2 value = defaultValue;
 	if( attributeValueText )
 	{
@@ -117,9 +196,22 @@ IntVec2 ParseXmlAttribute( const XmlElement& element, const char* attributeName,
 
 
 //---------------------------------------------------------------------------------------------------------
-std::string ParseXmlAttribute( const XmlElement& element, const char* attributeName, const std::string& defaultValue )
+IntVec2 ParseXmlAttribute( const XmlElement& element, const char* attributeName, const IntVec2& defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+IntVec2 ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, const IntVec2& defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static std::string ParseXmlAttributeText( const char* attributeValueText, const std::string& defaultValue )
 {
-	const char* attributeValueText = element.Attribute( attributeName );
 	std::string value = defaultValue;
 	if( attributeValueText )
 	{
@@ -130,9 +222,22 @@ std::string ParseXmlAttribute( const XmlElement& element, const char* attributeN
 
 
 //---------------------------------------------------------------------------------------------------------
-std::string ParseXmlAttribute( const XmlElement& element, const char* attributeName, const char* defaultValue )
+std::string ParseXmlAttribute( const XmlElement& element, const char* attributeName, const std::string& defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+std::string ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, const std::string& defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static std::string ParseXmlAttributeText( const char* attributeValueText, const char* defaultValue )
 {
-	const char* attributeValueText = element.Attribute( attributeName );
 	std::string value = defaultValue;
 	if( attributeValueText )
 	{
@@ -143,9 +248,22 @@ std::string ParseXmlAttribute( const XmlElement& element, const char* attributeN
 
 
 //---------------------------------------------------------------------------------------------------------
-Strings ParseXmlAttribute( const XmlElement& element, const char* attributeName, const Strings& defaultValue, char delimiter )
+std::string ParseXmlAttribute( const XmlElement& element, const char* attributeName, const char* defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+std::string ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, const char* defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static Strings ParseXmlAttributeText( const char* attributeValueText, const Strings& defaultValue, char delimiter )
 {
-	const char* attributeValueText = element.Attribute( attributeName );
 	Strings value = defaultValue;
 	if( attributeValueText )
 	{
@@ -156,9 +274,22 @@ Strings ParseXmlAttribute( const XmlElement& element, const char* attributeName,
 
 
 //---------------------------------------------------------------------------------------------------------
-IntRange ParseXmlAttribute( const XmlElement& element, const char* attributeName, const IntRange& defaultValue )
+Strings ParseXmlAttribute( const XmlElement& element, const char* attributeName, const Strings& defaultValue, char delimiter )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue, delimiter );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+Strings ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, const Strings& defaultValue, char delimiter )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue, delimiter );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static IntRange ParseXmlAttributeText( const char* attributeValueText, const IntRange& defaultValue )
 {
-	const char* attributeValueText = element.Attribute( attributeName );
 	IntRange value = defaultValue;
 	if( attributeValueText )
 	{
@@ -169,9 +300,22 @@ IntRange ParseXmlAttribute( const XmlElement& element, const char* attributeName
 
 
 //---------------------------------------------------------------------------------------------------------
-FloatRange ParseXmlAttribute( const XmlElement& element, const char* attributeName, const FloatRange& defaultValue )
+IntRange ParseXmlAttribute( const XmlElement& element, const char* attributeName, const IntRange& defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+IntRange ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, const IntRange& defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static FloatRange ParseXmlAttributeText( const char* attributeValueText, const FloatRange& defaultValue )
 {
-	const char* attributeValueText = element.Attribute( attributeName );
 	FloatRange value = defaultValue;
 	if( attributeValueText )
 	{
@@ -182,9 +326,22 @@ FloatRange ParseXmlAttribute( const XmlElement& element, const char* attributeNa
 
 
 //---------------------------------------------------------------------------------------------------------
-AABB2 ParseXmlAttribute( const XmlElement& element, const char* attributeName, const AABB2& defaultValue )
+FloatRange ParseXmlAttribute( const XmlElement& element, const char* attributeName, const FloatRange& defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+FloatRange ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, const FloatRange& defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static AABB2 ParseXmlAttributeText( const char* attributeValueText, const AABB2& defaultValue )
 {
-	const char* attributeValueText = element.Attribute( attributeName );
 	AABB2 value = defaultValue;
 	if( attributeValueText )
 	{
@@ -195,9 +352,22 @@ AABB2 ParseXmlAttribute( const XmlElement& element, const char* attributeName, c
 
 
 //---------------------------------------------------------------------------------------------------------
-Vec3 ParseXmlAttribute( const XmlElement& element, const char* attributeName, const Vec3& defaultValue )
+AABB2 ParseXmlAttribute( const XmlElement& element, const char* attributeName, const AABB2& defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+AABB2 ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, const AABB2& defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static Vec3 ParseXmlAttributeText( const char* attributeValueText, const Vec3& defaultValue )
 {
-	const char* attributeValueText = element.Attribute( attributeName );
 	Vec3 value = defaultValue;
 	if( attributeValueText )
 	{
@@ -208,9 +378,22 @@ Vec3 ParseXmlAttribute( const XmlElement& element, const char* attributeName, co
 
 
 //---------------------------------------------------------------------------------------------------------
-double ParseXmlAttribute( const XmlElement& element, const char* attributeName, double defaultValue )
+Vec3 ParseXmlAttribute( const XmlElement& element, const char* attributeName, const Vec3& defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+Vec3 ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, const Vec3& defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static double ParseXmlAttributeText( const char* attributeValueText, double defaultValue )
 {
-	const char* attributeValueText = element.Attribute( attributeName );
 	double value = defaultValue;
 	if( attributeValueText )
 	{
@@ -218,3 +401,17 @@ double ParseXmlAttribute( const XmlElement& element, const char* attributeName,
 	}
 	return value;
 }
+
+
+//---------------------------------------------------------------------------------------------------------
+double ParseXmlAttribute( const XmlElement& element, const char* attributeName, double defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+double ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, double defaultValue )
+{
+	return ParseXmlAttributeText( element.Attribute( attributeName ), defaultValue );
+}
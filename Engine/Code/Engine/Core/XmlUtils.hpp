@@ -15,6 +15,7 @@ struct IntVec2;
 struct IntRange;
 struct FloatRange;
 struct AABB2;
+class BakedXmlElement;
 
 
 //---------------------------------------------------------------------------------------------------------
@@ -32,4 +33,23 @@ FloatRange ParseXmlAttribute( const XmlElement& element, const char* attributeNa
 AABB2 ParseXmlAttribute( const XmlElement& element, const char* attributeName, const AABB2& defaultValue );
 std::string ParseXmlAttribute( const XmlElement& element, const char* attributeName, const std::string& defaultValue );
 std::string ParseXmlAttribute( const XmlElement& element, const char* attributeName, const char* defaultValue );
-Strings ParseXmlAttribute( const XmlElement& element, const char* attributeName, const Strings& defaultValue, char delimiter = ',' );
\ No newline at end of file
+Strings ParseXmlAttribute( const XmlElement& element, const char* attributeName, const Strings& defaultValue, char delimiter = ',' );
+
+
+//---------------------------------------------------------------------------------------------------------
+// Same parsing over a baked definition file (see BakedXml.hpp)
+int ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, int defaultValue );
+char ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, char defaultValue );
+bool ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, bool defaultValue );
+float ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, float defaultValue );
+double ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, double defaultValue );
+Rgba8 ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, const Rgba8& defaultValue );
+Vec2 ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, const Vec2& defaultValue );
+Vec3 ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, const Vec3& defaultValue );
+IntVec2 ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, const IntVec2& defaultValue );
+IntRange ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, const IntRange& defaultValue );
+FloatRange ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, const FloatRange& defaultValue );
+AABB2 ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, const AABB2& defaultValue );
+std::string ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, const std::string& defaultValue );
+std::string ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, const char* defaultValue );
+Strings ParseXmlAttribute( const BakedXmlElement& element, const char* attributeName, const Strings& defaultValue, char delimiter = ',' );
\ No newline at end of file
@@ -21,8 +21,8 @@ private:
 	void	UpdatePosition( float rawNormalizedX, float rawNormalizedY );
 
 private:
-	const float		m_innerDeadZoneFraction;
-	const float		m_outerDeadZoneFraction;
+	float			m_innerDeadZoneFraction;
+	float			m_outerDeadZoneFraction;
 	Vec2			m_rawPosition			= Vec2( 0.f, 0.f );
 	Vec2			m_correctedPosition		= Vec2( 0.f, 0.f );
 	float			m_correctedDegrees		= 0.f;
@@ -0,0 +1,301 @@
+#include "Engine/Input/InputRecording.hpp"
+#include "Engine/Core/FileUtils.hpp"
+#include <string.h>
+#include <stdlib.h>
+
+
+//---------------------------------------------------------------------------------------------------------
+constexpr uint32_t	INPUT_RECORDING_FOURCC		= 'I' | ( 'N' << 8 ) | ( 'R' << 16 ) | ( 'C' << 24 );
+constexpr uint32_t	INPUT_RECORDING_VERSION		= 2;
+
+// The delta, then InputState's fields back to back; Vec2s go as their two floats
+constexpr size_t	INPUT_RECORD_SIZE			= sizeof( double ) + ( sizeof( float ) * 7 ) + sizeof( InputState::m_keyStates ) + sizeof( InputState::m_mouseStates ) + sizeof( InputState::m_controllers );
+
+// Zero runs shorter than this stay inside the literal; a new pair of lengths would cost more than the zeros
+constexpr size_t	MIN_ENCODED_ZERO_RUN		= 3;
+
+
+//---------------------------------------------------------------------------------------------------------
+static void WriteVarint( std::vector<unsigned char>& out_bytes, size_t value )
+{
+	while( value >= 0x80 )
+	{
+		out_bytes.push_back( static_cast<unsigned char>( value | 0x80 ) );
+		value >>= 7;
+	}
+	out_bytes.push_back( static_cast<unsigned char>( value ) );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static bool ReadVarint( std::vector<unsigned char> const& bytes, size_t& readOffset, size_t& out_value )
+{
+	out_value = 0;
+	for( int shift = 0; shift < 64; shift += 7 )
+	{
+		if( readOffset >= bytes.size() )
+			return false;
+
+		unsigned char byte = bytes[ readOffset++ ];
+		out_value |= static_cast<size_t>( byte & 0x7F ) << shift;
+		if( ( byte & 0x80 ) == 0 )
+			return true;
+	}
+	return false;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template <typename T>
+static void WriteRecordField( unsigned char*& writeCursor, T const& value )
+{
+	memcpy( writeCursor, &value, sizeof( T ) );
+	writeCursor += sizeof( T );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+template <typename T>
+static void ReadRecordField( unsigned char const*& readCursor, T& out_value )
+{
+	memcpy( &out_value, readCursor, sizeof( T ) );
+	readCursor += sizeof( T );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Field by field rather than the whole struct, so the record holds no padding and InputState never has to
+// be trivially copyable
+//---------------------------------------------------------------------------------------------------------
+static void WriteRecord( std::vector<unsigned char>& out_record, InputState const& inputState, double deltaSeconds )
+{
+	out_record.resize( INPUT_RECORD_SIZE );
+	unsigned char* writeCursor = out_record.data();
+	WriteRecordField( writeCursor, deltaSeconds );
+	WriteRecordField( writeCursor, inputState.m_scrollAmount );
+	WriteRecordField( writeCursor, inputState.m_mouseNormalizedPos.x );
+	WriteRecordField( writeCursor, inputState.m_mouseNormalizedPos.y );
+	WriteRecordField( writeCursor, inputState.m_cursorRelativeMovement.x );
+	WriteRecordField( writeCursor, inputState.m_cursorRelativeMovement.y );
+	WriteRecordField( writeCursor, inputState.m_cursorPositionLastFrame.x );
+	WriteRecordField( writeCursor, inputState.m_cursorPositionLastFrame.y );
+	WriteRecordField( writeCursor, inputState.m_keyStates );
+	WriteRecordField( writeCursor, inputState.m_mouseStates );
+	WriteRecordField( writeCursor, inputState.m_controllers );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void ReadRecord( std::vector<unsigned char> const& record, InputState& out_inputState, double& out_deltaSeconds )
+{
+	unsigned char const* readCursor = record.data();
+	ReadRecordField( readCursor, out_deltaSeconds );
+	ReadRecordField( readCursor, out_inputState.m_scrollAmount );
+	ReadRecordField( readCursor, out_inputState.m_mouseNormalizedPos.x );
+	ReadRecordField( readCursor, out_inputState.m_mouseNormalizedPos.y );
+	ReadRecordField( readCursor, out_inputState.m_cursorRelativeMovement.x );
+	ReadRecordField( readCursor, out_inputState.m_cursorRelativeMovement.y );
+	ReadRecordField( readCursor, out_inputState.m_cursorPositionLastFrame.x );
+	ReadRecordField( readCursor, out_inputState.m_cursorPositionLastFrame.y );
+	ReadRecordField( readCursor, out_inputState.m_keyStates );
+	ReadRecordField( readCursor, out_inputState.m_mouseStates );
+	ReadRecordField( readCursor, out_inputState.m_controllers );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+//---------------------------------------------------------------------------------------------------------
+void InputRecorder::BeginRecording()
+{
+	m_isRecording = true;
+	m_frameCount = 0;
+	m_encodedFrames.clear();
+
+	// The first frame is encoded against all zeros
+	m_previousRecord.assign( INPUT_RECORD_SIZE, 0 );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void InputRecorder::RecordFrame( InputState const& inputState, double deltaSeconds )
+{
+	if( !m_isRecording )
+		return;
+
+	WriteRecord( m_currentRecord, inputState, deltaSeconds );
+	for( size_t byteIndex = 0; byteIndex < INPUT_RECORD_SIZE; ++byteIndex )
+	{
+		m_previousRecord[ byteIndex ] ^= m_currentRecord[ byteIndex ];
+	}
+
+	// m_previousRecord now holds the XOR; encode it as alternating zero runs and literals
+	std::vector<unsigned char> const& delta = m_previousRecord;
+	size_t byteIndex = 0;
+	while( byteIndex < INPUT_RECORD_SIZE )
+	{
+		size_t zeroRunStart = byteIndex;
+		while( byteIndex < INPUT_RECORD_SIZE && delta[ byteIndex ] == 0 )
+		{
+			++byteIndex;
+		}
+		size_t zeroRunLength = byteIndex - zeroRunStart;
+
+		size_t literalStart = byteIndex;
+		size_t literalEnd = byteIndex;
+		while( literalEnd < INPUT_RECORD_SIZE )
+		{
+			if( delta[ literalEnd ] != 0 )
+			{
+				++literalEnd;
+				continue;
+			}
+
+			size_t zeroEnd = literalEnd;
+			while( zeroEnd < INPUT_RECORD_SIZE && delta[ zeroEnd ] == 0 && zeroEnd - literalEnd < MIN_ENCODED_ZERO_RUN )
+			{
+				++zeroEnd;
+			}
+
+			// A short gap followed by more changes is cheaper left in the literal
+			if( zeroEnd - literalEnd < MIN_ENCODED_ZERO_RUN && zeroEnd < INPUT_RECORD_SIZE )
+			{
+				literalEnd = zeroEnd;
+				continue;
+			}
+			break;
+		}
+
+		WriteVarint( m_encodedFrames, zeroRunLength );
+		WriteVarint( m_encodedFrames, literalEnd - literalStart );
+		m_encodedFrames.insert( m_encodedFrames.end(), delta.begin() + literalStart, delta.begin() + literalEnd );
+		byteIndex = literalEnd;
+	}
+
+	m_previousRecord.swap( m_currentRecord );
+	++m_frameCount;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Header plus the encoded frames, exactly what SaveToFile writes and LoadFromBuffer reads
+void InputRecorder::WriteToBuffer( std::vector<unsigned char>& out_buffer ) const
+{
+	input_recording_header_t header;
+	header.fourCC		= INPUT_RECORDING_FOURCC;
+	header.version		= INPUT_RECORDING_VERSION;
+	header.recordSize	= static_cast<uint32_t>( INPUT_RECORD_SIZE );
+	header.frameCount	= m_frameCount;
+
+	out_buffer.resize( sizeof( header ) );
+	memcpy( out_buffer.data(), &header, sizeof( header ) );
+	out_buffer.insert( out_buffer.end(), m_encodedFrames.begin(), m_encodedFrames.end() );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool InputRecorder::SaveToFile( std::string const& filepath ) const
+{
+	std::vector<unsigned char> fileBytes;
+	WriteToBuffer( fileBytes );
+	return FileWriteFromBuffer( filepath, fileBytes.data(), fileBytes.size() );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+//---------------------------------------------------------------------------------------------------------
+bool InputPlayback::LoadFromFile( std::string const& filepath )
+{
+	// Mapped rather than read; LoadFromBuffer copies the frames out anyway
+	size_t fileSize = 0;
+	unsigned char const* fileBytes = static_cast<unsigned char const*>( FileMapReadOnly( filepath, &fileSize ) );
+	if( fileBytes == nullptr )
+	{
+		ERROR_RECOVERABLE( Stringf( "Could not open input recording %s", filepath.c_str() ) );
+		return false;
+	}
+
+	bool wasLoaded = LoadFromBuffer( fileBytes, fileSize );
+	FileUnmap( fileBytes, fileSize );
+	return wasLoaded;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool InputPlayback::LoadFromBuffer( unsigned char const* buffer, size_t bufferSize )
+{
+	m_isLoaded = false;
+	m_frameCount = 0;
+	m_encodedFrames.clear();
+	Rewind();
+
+	input_recording_header_t header;
+	if( bufferSize < sizeof( header ) )
+	{
+		ERROR_RECOVERABLE( "Input recording is too small to hold a header" );
+		return false;
+	}
+	memcpy( &header, buffer, sizeof( header ) );
+
+	if( header.fourCC != INPUT_RECORDING_FOURCC || header.version != INPUT_RECORDING_VERSION )
+	{
+		ERROR_RECOVERABLE( "Not an input recording, or one from an older version" );
+		return false;
+	}
+
+	if( header.recordSize != INPUT_RECORD_SIZE )
+	{
+		ERROR_RECOVERABLE( Stringf( "Input recording was made with a %u byte input record; this build uses %u", header.recordSize, static_cast<uint>( INPUT_RECORD_SIZE ) ) );
+		return false;
+	}
+
+	m_encodedFrames.assign( buffer + sizeof( header ), buffer + bufferSize );
+	m_frameCount = header.frameCount;
+	m_isLoaded = true;
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void InputPlayback::Rewind()
+{
+	m_frameIndex = 0;
+	m_readOffset = 0;
+	m_record.assign( INPUT_RECORD_SIZE, 0 );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool InputPlayback::ReadNextFrame( InputState& out_inputState, double& out_deltaSeconds )
+{
+	if( !m_isLoaded || IsFinished() )
+		return false;
+
+	size_t byteIndex = 0;
+	while( byteIndex < INPUT_RECORD_SIZE )
+	{
+		size_t zeroRunLength = 0;
+		size_t literalLength = 0;
+		if( !ReadVarint( m_encodedFrames, m_readOffset, zeroRunLength ) || !ReadVarint( m_encodedFrames, m_readOffset, literalLength ) )
+			break;
+
+		byteIndex += zeroRunLength;
+		if( byteIndex + literalLength > INPUT_RECORD_SIZE || m_readOffset + literalLength > m_encodedFrames.size() )
+			break;
+
+		for( size_t literalIndex = 0; literalIndex < literalLength; ++literalIndex )
+		{
+			m_record[ byteIndex++ ] ^= m_encodedFrames[ m_readOffset++ ];
+		}
+	}
+
+	if( byteIndex != INPUT_RECORD_SIZE )
+	{
+		ERROR_RECOVERABLE( Stringf( "Input recording is corrupt at frame %u", m_frameIndex ) );
+		m_frameIndex = m_frameCount;
+		return false;
+	}
+
+	ReadRecord( m_record, out_inputState, out_deltaSeconds );
+	++m_frameIndex;
+	return true;
+}
@@ -0,0 +1,80 @@
+#pragma once
+#include "Engine/Input/InputSystem.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+
+//---------------------------------------------------------------------------------------------------------
+// A recording is a header followed by one record per frame: the master clock delta and the fields of the
+// InputState the game saw that frame, packed as raw bytes. Each record is XORed against the one before it,
+// so anything that didn't change becomes zeros, and the zeros are run-length encoded:
+//
+//	record := { zeroRunLength, literalLength, literal bytes }... until the record's bytes are covered
+//
+// with both lengths as LEB128 varints. A frame where nothing moved costs two or three bytes.
+//
+// The records hold the in-memory layout of InputState's fields, so a recording only plays back on builds
+// where those haven't changed. The header's record size catches most of those.
+//---------------------------------------------------------------------------------------------------------
+struct input_recording_header_t
+{
+	uint32_t	fourCC			= 0;
+	uint32_t	version			= 0;
+	uint32_t	recordSize		= 0;
+	uint32_t	frameCount		= 0;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+class InputRecorder
+{
+public:
+	InputRecorder() {}
+	~InputRecorder() {}
+
+	void	BeginRecording();
+	void	RecordFrame( InputState const& inputState, double deltaSeconds );
+	void	EndRecording()										{ m_isRecording = false; }
+	void	WriteToBuffer( std::vector<unsigned char>& out_buffer ) const;
+	bool	SaveToFile( std::string const& filepath ) const;
+
+	bool	IsRecording() const									{ return m_isRecording; }
+	uint	GetFrameCount() const								{ return m_frameCount; }
+	size_t	GetEncodedSize() const								{ return sizeof( input_recording_header_t ) + m_encodedFrames.size(); }
+
+private:
+	bool						m_isRecording		= false;
+	uint						m_frameCount		= 0;
+	std::vector<unsigned char>	m_previousRecord;
+	std::vector<unsigned char>	m_currentRecord;
+	std::vector<unsigned char>	m_encodedFrames;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+class InputPlayback
+{
+public:
+	InputPlayback() {}
+	~InputPlayback() {}
+
+	bool	LoadFromFile( std::string const& filepath );
+	bool	LoadFromBuffer( unsigned char const* buffer, size_t bufferSize );
+	void	Rewind();
+	bool	ReadNextFrame( InputState& out_inputState, double& out_deltaSeconds );
+
+	bool	IsLoaded() const									{ return m_isLoaded; }
+	bool	IsFinished() const									{ return m_frameIndex >= m_frameCount; }
+	uint	GetFrameCount() const								{ return m_frameCount; }
+	uint	GetFrameIndex() const								{ return m_frameIndex; }
+
+private:
+	bool						m_isLoaded			= false;
+	uint						m_frameCount		= 0;
+	uint						m_frameIndex		= 0;
+	size_t						m_readOffset		= 0;
+	std::vector<unsigned char>	m_record;
+	std::vector<unsigned char>	m_encodedFrames;
+};
@@ -1,14 +1,19 @@
-#define WIN32_LEAN_AND_MEAN
 #include "Engine/Input/InputSystem.hpp"
 #include "Engine/Math/IntVec2.hpp"
 #include "Engine/Math/AABB2.hpp"
 #include "Engine/Platform/Window.hpp"
+#include "Engine/Platform/Platform.hpp"
+
+#if defined( PLATFORM_WINDOWS )
+#define WIN32_LEAN_AND_MEAN
 #include <Windows.h>
+#endif
 
 //extern HWND g_hWnd;
 
 
 //Define Key Codes
+#if defined( PLATFORM_WINDOWS )
 const unsigned char KEY_CODE_ESC			= VK_ESCAPE;
 const unsigned char KEY_CODE_ENTER			= VK_RETURN;
 const unsigned char KEY_CODE_SPACEBAR		= VK_SPACE;
@@ -53,6 +58,53 @@ const unsigned char MOUSE_CODE_LEFT			= MK_LBUTTON;
 const unsigned char MOUSE_CODE_RIGHT		= MK_RBUTTON;
 const unsigned char MOUSE_CODE_MIDDLE		= MK_MBUTTON;
 
+#else
+// Same values as the Windows virtual key codes, so input recordings play back on either platform
+const unsigned char KEY_CODE_ESC			= 0x1B;
+const unsigned char KEY_CODE_ENTER			= 0x0D;
+const unsigned char KEY_CODE_SPACEBAR		= 0x20;
+const unsigned char KEY_CODE_BACKSPACE		= 0x08;
+const unsigned char KEY_CODE_DELETE			= 0x2E;
+const unsigned char KEY_CODE_UP_ARROW		= 0x26;
+const unsigned char KEY_CODE_LEFT_ARROW		= 0x25;
+const unsigned char KEY_CODE_DOWN_ARROW		= 0x28;
+const unsigned char KEY_CODE_RIGHT_ARROW	= 0x27;
+const unsigned char KEY_CODE_SHIFT			= 0x10;
+const unsigned char KEY_CODE_CTRL			= 0x11;
+const unsigned char KEY_CODE_COPY			= 0x03;
+const unsigned char KEY_CODE_PASTE			= 0x16;
+const unsigned char KEY_CODE_CUT			= 0x18;
+const unsigned char KEY_CODE_F1				= 0x70;
+const unsigned char KEY_CODE_F2				= 0x71;
+const unsigned char KEY_CODE_F3				= 0x72;
+const unsigned char KEY_CODE_F4				= 0x73;
+const unsigned char KEY_CODE_F5				= 0x74;
+const unsigned char KEY_CODE_F6				= 0x75;
+const unsigned char KEY_CODE_F7				= 0x76;
+const unsigned char KEY_CODE_F8				= 0x77;
+const unsigned char KEY_CODE_F9				= 0x78;
+const unsigned char KEY_CODE_F10			= 0x79;
+const unsigned char KEY_CODE_F11			= 0x7A;
+const unsigned char KEY_CODE_F12			= 0x7B;
+const unsigned char KEY_CODE_PLUS			= 0xBB;
+const unsigned char KEY_CODE_MINUS			= 0xBD;
+const unsigned char KEY_CODE_HOME			= 0x24;
+const unsigned char KEY_CODE_END			= 0x23;
+const unsigned char KEY_CODE_TILDE			= 0xC0;
+const unsigned char KEY_CODE_LEFT_BRACKET	= 0xDB;
+const unsigned char KEY_CODE_RIGHT_BRACKET	= 0xDD;
+const unsigned char KEY_CODE_COMMA			= 0xBC;
+const unsigned char KEY_CODE_PERIOD			= 0xBE;
+const unsigned char KEY_CODE_SEMICOLON		= 0xBA;
+const unsigned char KEY_CODE_BACK_SLASH		= 0xBF;
+const unsigned char KEY_CODE_APOSTROPHE		= 0xDE;
+
+const unsigned char MOUSE_CODE_LEFT			= 0x01;
+const unsigned char MOUSE_CODE_RIGHT		= 0x02;
+const unsigned char MOUSE_CODE_MIDDLE		= 0x10;
+
+#endif
+
 
 
 //---------------------------------------------------------------------------------------------------------
@@ -112,7 +164,7 @@ void InputSystem::ShutDown()
 //---------------------------------------------------------------------------------------------------------
 InputState InputSystem::GetInputState()
 {
-	InputState inputState;
+	InputState inputState = InputState();
 	inputState.m_scrollAmount				= m_scrollAmount;
 	inputState.m_mouseNormalizedPos			= m_mouseNormalizedPos;
 	inputState.m_cursorRelativeMovement		= m_cursorRelativeMovement;
@@ -158,6 +210,7 @@ void InputSystem::UpdateMouse()
 }
 
 
+#if defined( PLATFORM_WINDOWS )
 //---------------------------------------------------------------------------------------------------------
 IntVec2 InputSystem::GetMouseRawDesktopPosition() const
 {
@@ -166,6 +219,51 @@ IntVec2 InputSystem::GetMouseRawDesktopPosition() const
 	return IntVec2( rawMouseDesktopPos.x, rawMouseDesktopPos.y );
 }
 
+#else
+//---------------------------------------------------------------------------------------------------------
+// Headless: there is no OS cursor, so the mouse only moves when SetFromInputState says it did
+//---------------------------------------------------------------------------------------------------------
+IntVec2 InputSystem::GetMouseRawDesktopPosition() const
+{
+	return IntVec2( static_cast<int>( m_cursorPositionLastFrame.x ), static_cast<int>( m_cursorPositionLastFrame.y ) );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void InputSystem::ShowSystemCursor( bool isShown )
+{
+	UNUSED( isShown );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void InputSystem::ClipSystemCursor( AABB2 const* windowDimensions )
+{
+	UNUSED( windowDimensions );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void InputSystem::RecenterCursor()
+{
+	m_cursorPositionLastFrame = m_theWindow != nullptr ? m_theWindow->GetClientCenter() : Vec2();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void InputSystem::UpdateRelativeMode()
+{
+	m_cursorRelativeMovement = Vec2();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void InputSystem::UpdateAbsoluteMode()
+{
+}
+
+#endif
+
 
 //---------------------------------------------------------------------------------------------------------
 Vec2 InputSystem::GetMouseNormalizedClientPosition() const
@@ -181,6 +279,7 @@ Vec2 InputSystem::GetCursorRelativeMovement() const
 }
 
 
+#if defined( PLATFORM_WINDOWS )
 //---------------------------------------------------------------------------------------------------------
 void InputSystem::ShowSystemCursor( bool isShown )
 {
@@ -259,6 +358,7 @@ void InputSystem::UpdateAbsoluteMode()
 
 	m_mouseNormalizedPos = clientBounds.GetUVForPoint( mouseClientPos );
 }
+#endif
 
 
 //---------------------------------------------------------------------------------------------------------
@@ -430,6 +530,7 @@ bool InputSystem::PopFromCharacterQueue( char* out_c )
 }
 
 
+#if defined( PLATFORM_WINDOWS )
 //---------------------------------------------------------------------------------------------------------
 void InputSystem::AddStringToClipboard( std::string stringToAdd )
 {
@@ -457,3 +558,25 @@ std::string InputSystem::GetStringFromClipboard()
 
 	return stringFromClipboard;
 }
+
+#else
+//---------------------------------------------------------------------------------------------------------
+// Headless: a clipboard private to the process, so the dev console's cut/copy/paste still round-trip
+//---------------------------------------------------------------------------------------------------------
+static std::string s_headlessClipboard;
+
+
+//---------------------------------------------------------------------------------------------------------
+void InputSystem::AddStringToClipboard( std::string stringToAdd )
+{
+	s_headlessClipboard = stringToAdd;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+std::string InputSystem::GetStringFromClipboard()
+{
+	return s_headlessClipboard;
+}
+
+#endif
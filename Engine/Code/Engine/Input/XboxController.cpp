@@ -1,7 +1,10 @@
+#include "Engine/Platform/Platform.hpp"
+#if defined( PLATFORM_WINDOWS )
 #define WIN32_LEAN_AND_MEAN
 #include <Windows.h>
 #include <Xinput.h>
 #pragma comment( lib, "xinput9_1_0" )
+#endif
 
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Input/XboxController.hpp"
@@ -34,6 +37,10 @@ const KeyButtonState XboxController::GetButtonState( XboxButtonID buttonID ) con
 //---------------------------------------------------------------------------------------------------------
 void XboxController::Update()
 {
+#if defined( ENGINE_HEADLESS )
+	// No controllers to poll; their state only comes from InputSystem::SetFromInputState
+	return;
+#else
 	XINPUT_STATE xboxControllerState;
 	memset( &xboxControllerState, 0, sizeof( xboxControllerState ) );
 	DWORD errorStatus = XInputGetState( m_controllerID, &xboxControllerState );
@@ -71,6 +78,7 @@ void XboxController::Update()
 		m_isConnected = false;
 		Reset();
 	}
+#endif
 }
 
 
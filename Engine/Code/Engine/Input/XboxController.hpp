@@ -1,6 +1,6 @@
 #pragma once
 #include "Engine/Input/KeyButtonState.hpp"
-#include "Engine/Input/AnalogJoyStick.hpp"
+#include "Engine/Input/AnalogJoystick.hpp"
 
 enum XboxButtonID
 {
@@ -48,7 +48,7 @@ private:
 	void UpdateButton( XboxButtonID buttonID, unsigned short buttonFlags, unsigned short buttonFlag );
 
 public:
-	const int		m_controllerID	= -1;
+	int				m_controllerID	= -1;
 	bool			m_isConnected	= false;
 	KeyButtonState	m_buttonStates[ NUM_XBOX_BUTTONS ];
 	AnalogJoyStick	m_leftJoyStick		= AnalogJoyStick( 0.3f, 0.95f );
@@ -0,0 +1,255 @@
+#include "Engine/Math/Frustum.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/Sphere3.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/OBB3.hpp"
+#include <math.h>
+
+
+//---------------------------------------------------------------------------------------------------------
+// The planes copied out into flat arrays once per call, so the per-volume loops are plain float math with
+// no Vec3 temporaries
+//---------------------------------------------------------------------------------------------------------
+struct frustum_plane_terms_t
+{
+	float normalX[ NUM_FRUSTUM_PLANES ];
+	float normalY[ NUM_FRUSTUM_PLANES ];
+	float normalZ[ NUM_FRUSTUM_PLANES ];
+	float absNormalX[ NUM_FRUSTUM_PLANES ];
+	float absNormalY[ NUM_FRUSTUM_PLANES ];
+	float absNormalZ[ NUM_FRUSTUM_PLANES ];
+	float distance[ NUM_FRUSTUM_PLANES ];
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+static void GetPlaneTerms( Frustum const& frustum, frustum_plane_terms_t& out_terms )
+{
+	for( int planeIndex = 0; planeIndex < NUM_FRUSTUM_PLANES; ++planeIndex )
+	{
+		Plane3D const& plane = frustum.planes[ planeIndex ];
+		out_terms.normalX[ planeIndex ]		= plane.normal.x;
+		out_terms.normalY[ planeIndex ]		= plane.normal.y;
+		out_terms.normalZ[ planeIndex ]		= plane.normal.z;
+		out_terms.absNormalX[ planeIndex ]	= fabsf( plane.normal.x );
+		out_terms.absNormalY[ planeIndex ]	= fabsf( plane.normal.y );
+		out_terms.absNormalZ[ planeIndex ]	= fabsf( plane.normal.z );
+		out_terms.distance[ planeIndex ]	= plane.distance;
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// A box is outside a plane when its center is further behind it than the box's extent along the normal.
+// All six planes are always tested and the results and-ed: most volumes fail at an unpredictable plane, so
+// an early out costs more in mispredicted branches than the extra planes do.
+//---------------------------------------------------------------------------------------------------------
+static bool IsBoxVisible( frustum_plane_terms_t const& terms, float centerX, float centerY, float centerZ, float extentX, float extentY, float extentZ )
+{
+	bool isVisible = true;
+	for( int planeIndex = 0; planeIndex < NUM_FRUSTUM_PLANES; ++planeIndex )
+	{
+		float centerDistance	= ( terms.normalX[ planeIndex ] * centerX ) + ( terms.normalY[ planeIndex ] * centerY ) + ( terms.normalZ[ planeIndex ] * centerZ ) - terms.distance[ planeIndex ];
+		float projectedExtent	= ( terms.absNormalX[ planeIndex ] * extentX ) + ( terms.absNormalY[ planeIndex ] * extentY ) + ( terms.absNormalZ[ planeIndex ] * extentZ );
+		isVisible &= centerDistance >= -projectedExtent;
+	}
+	return isVisible;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static bool IsSphereVisible( frustum_plane_terms_t const& terms, float centerX, float centerY, float centerZ, float radius )
+{
+	bool isVisible = true;
+	for( int planeIndex = 0; planeIndex < NUM_FRUSTUM_PLANES; ++planeIndex )
+	{
+		float centerDistance = ( terms.normalX[ planeIndex ] * centerX ) + ( terms.normalY[ planeIndex ] * centerY ) + ( terms.normalZ[ planeIndex ] * centerZ ) - terms.distance[ planeIndex ];
+		isVisible &= centerDistance >= -radius;
+	}
+	return isVisible;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static bool IsOrientedBoxVisible( frustum_plane_terms_t const& terms, Mat44 const& boxTransform, Vec3 const& halfDimensions )
+{
+	bool isVisible = true;
+	for( int planeIndex = 0; planeIndex < NUM_FRUSTUM_PLANES; ++planeIndex )
+	{
+		float normalX = terms.normalX[ planeIndex ];
+		float normalY = terms.normalY[ planeIndex ];
+		float normalZ = terms.normalZ[ planeIndex ];
+
+		float centerDistance	= ( normalX * boxTransform.Tx ) + ( normalY * boxTransform.Ty ) + ( normalZ * boxTransform.Tz ) - terms.distance[ planeIndex ];
+		float projectedExtent	= ( halfDimensions.x * fabsf( ( normalX * boxTransform.Ix ) + ( normalY * boxTransform.Iy ) + ( normalZ * boxTransform.Iz ) ) )
+								+ ( halfDimensions.y * fabsf( ( normalX * boxTransform.Jx ) + ( normalY * boxTransform.Jy ) + ( normalZ * boxTransform.Jz ) ) )
+								+ ( halfDimensions.z * fabsf( ( normalX * boxTransform.Kx ) + ( normalY * boxTransform.Ky ) + ( normalZ * boxTransform.Kz ) ) );
+		isVisible &= centerDistance >= -projectedExtent;
+	}
+	return isVisible;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Clip-space row ( a, b, c, d ) gives a*x + b*y + c*z + d >= 0 for world points inside the plane
+//---------------------------------------------------------------------------------------------------------
+static Plane3D MakePlaneFromClipRow( float a, float b, float c, float d )
+{
+	float length = sqrtf( ( a * a ) + ( b * b ) + ( c * c ) );
+	if( length > 0.f )
+	{
+		float inverseLength = 1.f / length;
+		a *= inverseLength;
+		b *= inverseLength;
+		c *= inverseLength;
+		d *= inverseLength;
+	}
+	return Plane3D( Vec3( a, b, c ), -d );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+Frustum::Frustum( Mat44 const& viewProjection )
+{
+	Mat44 const& m = viewProjection;
+	planes[ FRUSTUM_PLANE_LEFT ]	= MakePlaneFromClipRow( m.Iw + m.Ix, m.Jw + m.Jx, m.Kw + m.Kx, m.Tw + m.Tx );
+	planes[ FRUSTUM_PLANE_RIGHT ]	= MakePlaneFromClipRow( m.Iw - m.Ix, m.Jw - m.Jx, m.Kw - m.Kx, m.Tw - m.Tx );
+	planes[ FRUSTUM_PLANE_BOTTOM ]	= MakePlaneFromClipRow( m.Iw + m.Iy, m.Jw + m.Jy, m.Kw + m.Ky, m.Tw + m.Ty );
+	planes[ FRUSTUM_PLANE_TOP ]		= MakePlaneFromClipRow( m.Iw - m.Iy, m.Jw - m.Jy, m.Kw - m.Ky, m.Tw - m.Ty );
+	planes[ FRUSTUM_PLANE_NEAR ]	= MakePlaneFromClipRow( m.Iz, m.Jz, m.Kz, m.Tz );
+	planes[ FRUSTUM_PLANE_FAR ]		= MakePlaneFromClipRow( m.Iw - m.Iz, m.Jw - m.Jz, m.Kw - m.Kz, m.Tw - m.Tz );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool Frustum::IsPointInside( Vec3 const& point ) const
+{
+	for( int planeIndex = 0; planeIndex < NUM_FRUSTUM_PLANES; ++planeIndex )
+	{
+		if( planes[ planeIndex ].GetPointsDistanceFromPlane( point ) < 0.f )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool Frustum::IsSphereVisible( Sphere3 const& sphere ) const
+{
+	frustum_plane_terms_t terms;
+	GetPlaneTerms( *this, terms );
+	return ::IsSphereVisible( terms, sphere.center.x, sphere.center.y, sphere.center.z, sphere.radius );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool Frustum::IsAABB3Visible( AABB3 const& bounds ) const
+{
+	frustum_plane_terms_t terms;
+	GetPlaneTerms( *this, terms );
+
+	// fabsf since some callers build boxes with mins.z > maxes.z for a -z forward basis
+	return IsBoxVisible( terms,
+		( bounds.mins.x + bounds.maxes.x ) * 0.5f, ( bounds.mins.y + bounds.maxes.y ) * 0.5f, ( bounds.mins.z + bounds.maxes.z ) * 0.5f,
+		fabsf( bounds.maxes.x - bounds.mins.x ) * 0.5f, fabsf( bounds.maxes.y - bounds.mins.y ) * 0.5f, fabsf( bounds.maxes.z - bounds.mins.z ) * 0.5f );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool Frustum::IsOBB3Visible( OBB3 const& bounds ) const
+{
+	frustum_plane_terms_t terms;
+	GetPlaneTerms( *this, terms );
+	return IsOrientedBoxVisible( terms, bounds.m_transformMatrix, bounds.m_halfDimensions );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+FrustumOverlap Frustum::ClassifyAABB3( AABB3 const& bounds ) const
+{
+	float centerX = ( bounds.mins.x + bounds.maxes.x ) * 0.5f;
+	float centerY = ( bounds.mins.y + bounds.maxes.y ) * 0.5f;
+	float centerZ = ( bounds.mins.z + bounds.maxes.z ) * 0.5f;
+	float extentX = fabsf( bounds.maxes.x - bounds.mins.x ) * 0.5f;
+	float extentY = fabsf( bounds.maxes.y - bounds.mins.y ) * 0.5f;
+	float extentZ = fabsf( bounds.maxes.z - bounds.mins.z ) * 0.5f;
+
+	FrustumOverlap overlap = FRUSTUM_INSIDE;
+	for( int planeIndex = 0; planeIndex < NUM_FRUSTUM_PLANES; ++planeIndex )
+	{
+		Vec3 const& normal = planes[ planeIndex ].normal;
+		float centerDistance	= ( normal.x * centerX ) + ( normal.y * centerY ) + ( normal.z * centerZ ) - planes[ planeIndex ].distance;
+		float projectedExtent	= ( fabsf( normal.x ) * extentX ) + ( fabsf( normal.y ) * extentY ) + ( fabsf( normal.z ) * extentZ );
+		if( centerDistance < -projectedExtent )
+		{
+			return FRUSTUM_OUTSIDE;
+		}
+		if( centerDistance < projectedExtent )
+		{
+			overlap = FRUSTUM_INTERSECTING;
+		}
+	}
+	return overlap;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+uint Frustum::CullSpheres( Sphere3 const* spheres, uint count, uint* out_visibleIndices ) const
+{
+	frustum_plane_terms_t terms;
+	GetPlaneTerms( *this, terms );
+
+	uint visibleCount = 0;
+	for( uint sphereIndex = 0; sphereIndex < count; ++sphereIndex )
+	{
+		Sphere3 const& sphere = spheres[ sphereIndex ];
+		bool isVisible = ::IsSphereVisible( terms, sphere.center.x, sphere.center.y, sphere.center.z, sphere.radius );
+
+		// Always write, only advance when visible - keeps the loop free of a second branch
+		out_visibleIndices[ visibleCount ] = sphereIndex;
+		visibleCount += isVisible ? 1 : 0;
+	}
+	return visibleCount;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+uint Frustum::CullAABB3s( AABB3 const* bounds, uint count, uint* out_visibleIndices ) const
+{
+	frustum_plane_terms_t terms;
+	GetPlaneTerms( *this, terms );
+
+	uint visibleCount = 0;
+	for( uint boundsIndex = 0; boundsIndex < count; ++boundsIndex )
+	{
+		AABB3 const& box = bounds[ boundsIndex ];
+		bool isVisible = IsBoxVisible( terms,
+			( box.mins.x + box.maxes.x ) * 0.5f, ( box.mins.y + box.maxes.y ) * 0.5f, ( box.mins.z + box.maxes.z ) * 0.5f,
+			fabsf( box.maxes.x - box.mins.x ) * 0.5f, fabsf( box.maxes.y - box.mins.y ) * 0.5f, fabsf( box.maxes.z - box.mins.z ) * 0.5f );
+
+		out_visibleIndices[ visibleCount ] = boundsIndex;
+		visibleCount += isVisible ? 1 : 0;
+	}
+	return visibleCount;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+uint Frustum::CullOBB3s( OBB3 const* bounds, uint count, uint* out_visibleIndices ) const
+{
+	frustum_plane_terms_t terms;
+	GetPlaneTerms( *this, terms );
+
+	uint visibleCount = 0;
+	for( uint boundsIndex = 0; boundsIndex < count; ++boundsIndex )
+	{
+		OBB3 const& box = bounds[ boundsIndex ];
+		bool isVisible = IsOrientedBoxVisible( terms, box.m_transformMatrix, box.m_halfDimensions );
+
+		out_visibleIndices[ visibleCount ] = boundsIndex;
+		visibleCount += isVisible ? 1 : 0;
+	}
+	return visibleCount;
+}
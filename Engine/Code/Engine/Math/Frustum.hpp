@@ -0,0 +1,61 @@
+#pragma once
+#include "Engine/Math/Plane3D.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+
+struct Mat44;
+struct Sphere3;
+struct AABB3;
+struct OBB3;
+
+
+//---------------------------------------------------------------------------------------------------------
+enum FrustumPlane
+{
+	FRUSTUM_PLANE_LEFT,
+	FRUSTUM_PLANE_RIGHT,
+	FRUSTUM_PLANE_BOTTOM,
+	FRUSTUM_PLANE_TOP,
+	FRUSTUM_PLANE_NEAR,
+	FRUSTUM_PLANE_FAR,
+
+	NUM_FRUSTUM_PLANES
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+enum FrustumOverlap
+{
+	FRUSTUM_OUTSIDE,
+	FRUSTUM_INTERSECTING,
+	FRUSTUM_INSIDE,
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Six inward-facing planes pulled straight out of a view-projection matrix, so any change of basis folded
+// into the projection is handled for free. Clip space is the D3D one: -w <= x,y <= w and 0 <= z <= w.
+//
+// The tests are conservative - a volume near a frustum corner can pass every plane while lying outside, and
+// is reported visible. The Cull* batch calls write the indices of the visible volumes into
+// out_visibleIndices (which must have room for count) and return how many were written.
+//---------------------------------------------------------------------------------------------------------
+struct Frustum
+{
+public:
+	Plane3D planes[ NUM_FRUSTUM_PLANES ];
+
+public:
+	Frustum() {}
+	explicit Frustum( Mat44 const& viewProjection );
+	~Frustum() {}
+
+	bool			IsPointInside( Vec3 const& point ) const;
+	bool			IsSphereVisible( Sphere3 const& sphere ) const;
+	bool			IsAABB3Visible( AABB3 const& bounds ) const;
+	bool			IsOBB3Visible( OBB3 const& bounds ) const;
+	FrustumOverlap	ClassifyAABB3( AABB3 const& bounds ) const;
+
+	uint			CullSpheres( Sphere3 const* spheres, uint count, uint* out_visibleIndices ) const;
+	uint			CullAABB3s( AABB3 const* bounds, uint count, uint* out_visibleIndices ) const;
+	uint			CullOBB3s( OBB3 const* bounds, uint count, uint* out_visibleIndices ) const;
+};
@@ -0,0 +1,330 @@
+#include "Engine/Math/GridPathRequestQueue.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Engine/Core/JobSystem.hpp"
+#include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/EventSystem.hpp"
+#include "Engine/Core/NamedProperties.hpp"
+#include "Engine/Core/Time.hpp"
+#include <atomic>
+#include <thread>
+
+
+//---------------------------------------------------------------------------------------------------------
+// Fire-and-forget: ProcessRequests waits on the counter, so there is nothing to claim afterwards
+//---------------------------------------------------------------------------------------------------------
+class GridPathBatchJob : public Job
+{
+public:
+	GridPathBatchJob( GridPathRequestQueue* queue, uint jobIndex, uint jobCount, std::atomic<uint>* jobsRemaining )
+		: Job( JOB_CATEGORY_SIMULATION )
+		, m_queue( queue )
+		, m_jobIndex( jobIndex )
+		, m_jobCount( jobCount )
+		, m_jobsRemaining( jobsRemaining )
+	{
+		m_isFireAndForget = true;
+	}
+
+	virtual void Execute() override
+	{
+		m_queue->RunBatchShare( m_jobIndex, m_jobCount );
+		m_jobsRemaining->fetch_sub( 1 );
+	}
+
+	virtual void OnCompleteCallback() override {}
+
+private:
+	GridPathRequestQueue*	m_queue				= nullptr;
+	uint					m_jobIndex			= 0;
+	uint					m_jobCount			= 1;
+	std::atomic<uint>*		m_jobsRemaining		= nullptr;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+static void path_benchmark( EventArgs* args )
+{
+	int gridSize = args->GetValue( "size", 512 );
+	int agentCount = args->GetValue( "agents", 1000 );
+	PrintGridPathfindingBenchmark( gridSize, static_cast<uint>( agentCount ) );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+GridPathRequestQueue::GridPathRequestQueue( uint maxQueriesPerFrame )
+	: m_maxQueriesPerFrame( maxQueriesPerFrame )
+{
+	static bool s_areCommandsSubscribed = false;
+	if( !s_areCommandsSubscribed && g_theEventSystem != nullptr )
+	{
+		g_theEventSystem->SubscribeEventCallbackFunction( "path_benchmark", path_benchmark );
+		s_areCommandsSubscribed = true;
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+uint GridPathRequestQueue::RequestPath( IntVec2 const& start, IntVec2 const& goal, GridPathAlgorithm algorithm )
+{
+	path_request_t request;
+	request.requestID	= m_nextRequestID++;
+	request.start		= start;
+	request.goal		= goal;
+	request.algorithm	= algorithm;
+	m_pendingRequests.push_back( request );
+
+	if( m_nextRequestID == INVALID_REQUEST_ID )
+	{
+		++m_nextRequestID;
+	}
+	return request.requestID;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void GridPathRequestQueue::CancelRequest( uint requestID )
+{
+	for( auto requestIter = m_pendingRequests.begin(); requestIter != m_pendingRequests.end(); ++requestIter )
+	{
+		if( requestIter->requestID == requestID )
+		{
+			m_pendingRequests.erase( requestIter );
+			return;
+		}
+	}
+
+	std::vector<IntVec2> discardedPath;
+	ClaimResult( requestID, discardedPath );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+uint GridPathRequestQueue::ProcessRequests( PassabilityGrid const& grid, bool isMultithreaded )
+{
+	uint batchCount = static_cast<uint>( m_pendingRequests.size() );
+	batchCount = ( batchCount < m_maxQueriesPerFrame ) ? batchCount : m_maxQueriesPerFrame;
+	if( batchCount == 0 )
+		return 0;
+
+	m_batchRequests.clear();
+	for( uint requestIndex = 0; requestIndex < batchCount; ++requestIndex )
+	{
+		m_batchRequests.push_back( std::move( m_pendingRequests.front() ) );
+		m_pendingRequests.pop_front();
+	}
+	m_batchGrid = &grid;
+
+	uint jobCount = 1;
+	if( isMultithreaded && g_theJobSystem != nullptr )
+	{
+		jobCount = static_cast<uint>( g_theJobSystem->GetWorkerThreadCount() ) + 1;
+		jobCount = ( jobCount < batchCount ) ? jobCount : batchCount;
+	}
+	if( m_pathfinders.size() < jobCount )
+	{
+		m_pathfinders.resize( jobCount );
+	}
+
+	// The calling thread always takes the first share
+	std::atomic<uint> jobsRemaining( jobCount - 1 );
+	for( uint jobIndex = 1; jobIndex < jobCount; ++jobIndex )
+	{
+		g_theJobSystem->PostJob( new GridPathBatchJob( this, jobIndex, jobCount, &jobsRemaining ) );
+	}
+
+	RunBatchShare( 0, jobCount );
+
+	if( jobCount > 1 )
+	{
+		while( jobsRemaining.load() > 0 )
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	for( uint requestIndex = 0; requestIndex < batchCount; ++requestIndex )
+	{
+		m_completedRequests.push_back( std::move( m_batchRequests[ requestIndex ] ) );
+	}
+	m_batchRequests.clear();
+	m_batchGrid = nullptr;
+	return batchCount;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void GridPathRequestQueue::RunBatchShare( uint jobIndex, uint jobCount )
+{
+	GridPathfinder& pathfinder = m_pathfinders[ jobIndex ];
+	for( uint requestIndex = jobIndex; requestIndex < m_batchRequests.size(); requestIndex += jobCount )
+	{
+		path_request_t& request = m_batchRequests[ requestIndex ];
+		bool wasFound = pathfinder.FindPath( *m_batchGrid, request.start, request.goal, request.algorithm, request.path );
+		request.status = wasFound ? GRID_PATH_STATUS_FOUND : GRID_PATH_STATUS_NOT_FOUND;
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+GridPathStatus GridPathRequestQueue::ClaimResult( uint requestID, std::vector<IntVec2>& out_path )
+{
+	for( uint resultIndex = 0; resultIndex < m_completedRequests.size(); ++resultIndex )
+	{
+		path_request_t& result = m_completedRequests[ resultIndex ];
+		if( result.requestID != requestID )
+			continue;
+
+		GridPathStatus status = result.status;
+		out_path.swap( result.path );
+
+		m_completedRequests[ resultIndex ] = std::move( m_completedRequests.back() );
+		m_completedRequests.pop_back();
+		return status;
+	}
+
+	for( uint requestIndex = 0; requestIndex < m_pendingRequests.size(); ++requestIndex )
+	{
+		if( m_pendingRequests[ requestIndex ].requestID == requestID )
+			return GRID_PATH_STATUS_PENDING;
+	}
+	return GRID_PATH_STATUS_UNKNOWN;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+//---------------------------------------------------------------------------------------------------------
+// Rectangular buildings on open ground, the kind of map jump point search was made for; a maze-like noise
+// map would make every tile a jump point
+//---------------------------------------------------------------------------------------------------------
+static void MakeBenchmarkGrid( PassabilityGrid& grid, int gridSize, RandomNumberGenerator& rng )
+{
+	grid.Resize( IntVec2( gridSize, gridSize ), true );
+
+	int obstacleCount = ( gridSize * gridSize ) / 400;
+	for( int obstacleIndex = 0; obstacleIndex < obstacleCount; ++obstacleIndex )
+	{
+		int minX = rng.RollRandomIntLessThan( gridSize );
+		int minY = rng.RollRandomIntLessThan( gridSize );
+		int width = rng.RollRandomIntInRange( 2, 24 );
+		int height = rng.RollRandomIntInRange( 2, 24 );
+		for( int y = minY; y < minY + height && y < gridSize; ++y )
+		{
+			for( int x = minX; x < minX + width && x < gridSize; ++x )
+			{
+				grid.SetPassable( IntVec2( x, y ), false );
+			}
+		}
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static IntVec2 RollReachableTile( FlowField const& flowField, int gridSize, RandomNumberGenerator& rng )
+{
+	IntVec2 tileCoords;
+	do
+	{
+		tileCoords = IntVec2( rng.RollRandomIntLessThan( gridSize ), rng.RollRandomIntLessThan( gridSize ) );
+	} while( !flowField.IsReachable( tileCoords ) );
+	return tileCoords;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Every agent chases the same goal (the swarm case), so all four approaches answer the same question
+//---------------------------------------------------------------------------------------------------------
+void PrintGridPathfindingBenchmark( int gridSize, uint agentCount )
+{
+	if( gridSize <= 1 || agentCount == 0 )
+		return;
+
+	RandomNumberGenerator rng;
+	rng.Reset( 44 );
+
+	PassabilityGrid grid;
+	MakeBenchmarkGrid( grid, gridSize, rng );
+
+	IntVec2 goal( gridSize / 2, gridSize / 2 );
+	grid.SetPassable( goal, true );
+
+	double flowFieldStartSeconds = GetCurrentTimeSeconds();
+	FlowField flowField;
+	flowField.Build( grid, goal );
+	double flowFieldBuildSeconds = GetCurrentTimeSeconds() - flowFieldStartSeconds;
+
+	std::vector<IntVec2> agentTiles;
+	agentTiles.reserve( agentCount );
+	for( uint agentIndex = 0; agentIndex < agentCount; ++agentIndex )
+	{
+		agentTiles.push_back( RollReachableTile( flowField, gridSize, rng ) );
+	}
+
+	// Walk every agent home through the field, one lookup per step
+	flowFieldStartSeconds = GetCurrentTimeSeconds();
+	uint flowFieldSteps = 0;
+	for( uint agentIndex = 0; agentIndex < agentCount; ++agentIndex )
+	{
+		IntVec2 tileCoords = agentTiles[ agentIndex ];
+		while( tileCoords != goal )
+		{
+			tileCoords = flowField.GetNextTile( tileCoords );
+			++flowFieldSteps;
+		}
+	}
+	double flowFieldWalkSeconds = GetCurrentTimeSeconds() - flowFieldStartSeconds;
+
+	GridPathfinder pathfinder;
+	std::vector<IntVec2> path;
+	uint64_t aStarNodes = 0;
+	uint64_t jumpPointNodes = 0;
+	uint mismatchedCosts = 0;
+
+	double aStarStartSeconds = GetCurrentTimeSeconds();
+	std::vector<float> aStarCosts;
+	aStarCosts.reserve( agentCount );
+	for( uint agentIndex = 0; agentIndex < agentCount; ++agentIndex )
+	{
+		pathfinder.FindPathAStar( grid, agentTiles[ agentIndex ], goal, path );
+		aStarCosts.push_back( pathfinder.GetPathCost() );
+		aStarNodes += pathfinder.GetNodesExpanded();
+	}
+	double aStarSeconds = GetCurrentTimeSeconds() - aStarStartSeconds;
+
+	double jumpPointStartSeconds = GetCurrentTimeSeconds();
+	for( uint agentIndex = 0; agentIndex < agentCount; ++agentIndex )
+	{
+		pathfinder.FindPathJumpPoint( grid, agentTiles[ agentIndex ], goal, path );
+		jumpPointNodes += pathfinder.GetNodesExpanded();
+
+		float costDifference = pathfinder.GetPathCost() - aStarCosts[ agentIndex ];
+		if( costDifference > 0.01f || costDifference < -0.01f )
+		{
+			++mismatchedCosts;
+		}
+	}
+	double jumpPointSeconds = GetCurrentTimeSeconds() - jumpPointStartSeconds;
+
+	// Everything in one frame so the batching cost shows on its own
+	GridPathRequestQueue requestQueue( agentCount );
+	for( uint agentIndex = 0; agentIndex < agentCount; ++agentIndex )
+	{
+		requestQueue.RequestPath( agentTiles[ agentIndex ], goal, GRID_PATH_JUMP_POINT );
+	}
+	double batchStartSeconds = GetCurrentTimeSeconds();
+	requestQueue.ProcessRequests( grid, true );
+	double batchSeconds = GetCurrentTimeSeconds() - batchStartSeconds;
+
+	uint shareCount = 1;
+	if( g_theJobSystem != nullptr )
+	{
+		shareCount += static_cast<uint>( g_theJobSystem->GetWorkerThreadCount() );
+	}
+
+	double const agents = static_cast<double>( agentCount );
+	g_theConsole->PrintString( Rgba8::WHITE, "Pathfinding benchmark: %ix%i grid, %u agents to one goal", gridSize, gridSize, agentCount );
+	g_theConsole->PrintString( Rgba8::WHITE, "  A*                      %9.2fms total  %8.1f nodes/query", aStarSeconds * 1000.0, static_cast<double>( aStarNodes ) / agents );
+	g_theConsole->PrintString( Rgba8::WHITE, "  jump point              %9.2fms total  %8.1f nodes/query  (%u cost mismatches)", jumpPointSeconds * 1000.0, static_cast<double>( jumpPointNodes ) / agents, mismatchedCosts );
+	g_theConsole->PrintString( Rgba8::WHITE, "  jump point, %2u shares   %9.2fms total", shareCount, batchSeconds * 1000.0 );
+	g_theConsole->PrintString( Rgba8::WHITE, "  flow field build        %9.2fms", flowFieldBuildSeconds * 1000.0 );
+	g_theConsole->PrintString( Rgba8::WHITE, "  flow field walk         %9.2fms total  (%u steps)", flowFieldWalkSeconds * 1000.0, flowFieldSteps );
+}
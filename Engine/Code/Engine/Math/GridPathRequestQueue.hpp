@@ -0,0 +1,74 @@
+#pragma once
+#include "Engine/Math/GridPathfinding.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include <deque>
+#include <vector>
+
+
+//---------------------------------------------------------------------------------------------------------
+enum GridPathStatus
+{
+	GRID_PATH_STATUS_UNKNOWN,		// never requested, cancelled or already claimed
+	GRID_PATH_STATUS_PENDING,
+	GRID_PATH_STATUS_FOUND,
+	GRID_PATH_STATUS_NOT_FOUND,
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Agents ask for paths whenever they like; ProcessRequests answers at most GetMaxQueriesPerFrame() of them
+// in request order, so a wave of spawns costs a few frames of latency instead of one long frame. Each
+// frame's batch is split across the job system's workers and the calling thread, each share with its own
+// GridPathfinder, and is finished by the time ProcessRequests returns.
+//
+// Results wait until claimed. A request is either claimed or cancelled, or its result is kept forever.
+//---------------------------------------------------------------------------------------------------------
+class GridPathRequestQueue
+{
+public:
+	explicit GridPathRequestQueue( uint maxQueriesPerFrame = 16 );
+	~GridPathRequestQueue() {}
+
+	uint			RequestPath( IntVec2 const& start, IntVec2 const& goal, GridPathAlgorithm algorithm = GRID_PATH_JUMP_POINT );
+	void			CancelRequest( uint requestID );
+	uint			ProcessRequests( PassabilityGrid const& grid, bool isMultithreaded = true );
+	GridPathStatus	ClaimResult( uint requestID, std::vector<IntVec2>& out_path );
+
+	void			SetMaxQueriesPerFrame( uint maxQueriesPerFrame )			{ m_maxQueriesPerFrame = maxQueriesPerFrame; }
+	uint			GetMaxQueriesPerFrame() const								{ return m_maxQueriesPerFrame; }
+	uint			GetPendingCount() const										{ return static_cast<uint>( m_pendingRequests.size() ); }
+	uint			GetUnclaimedCount() const									{ return static_cast<uint>( m_completedRequests.size() ); }
+
+	// Called by each job share; runs every jobCount'th request of the current batch starting at jobIndex
+	void			RunBatchShare( uint jobIndex, uint jobCount );
+
+public:
+	static constexpr uint INVALID_REQUEST_ID = 0;
+
+private:
+	struct path_request_t
+	{
+		uint					requestID	= INVALID_REQUEST_ID;
+		IntVec2					start;
+		IntVec2					goal;
+		GridPathAlgorithm		algorithm	= GRID_PATH_JUMP_POINT;
+		GridPathStatus			status		= GRID_PATH_STATUS_PENDING;
+		std::vector<IntVec2>	path;
+	};
+
+private:
+	std::deque<path_request_t>		m_pendingRequests;
+	std::vector<path_request_t>		m_batchRequests;
+	std::vector<path_request_t>		m_completedRequests;
+	std::vector<GridPathfinder>		m_pathfinders;			// one per job share
+	PassabilityGrid const*			m_batchGrid				= nullptr;
+
+	uint							m_maxQueriesPerFrame	= 16;
+	uint							m_nextRequestID			= 1;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Runs agentCount agents on a gridSize x gridSize map through A*, jump point search (on the calling thread
+// and batched across the job system) and one shared flow field, and prints the cost of each
+void PrintGridPathfindingBenchmark( int gridSize, uint agentCount );
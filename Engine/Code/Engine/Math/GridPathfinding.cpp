@@ -0,0 +1,547 @@
+#include "Engine/Math/GridPathfinding.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdlib.h>
+
+
+//---------------------------------------------------------------------------------------------------------
+// Straight directions first, then diagonals; the opposite of a direction is two along in its own group
+//---------------------------------------------------------------------------------------------------------
+constexpr int	NUM_GRID_DIRECTIONS				= 8;
+constexpr int	NUM_STRAIGHT_GRID_DIRECTIONS	= 4;
+constexpr float	DIAGONAL_STEP_COST				= 1.41421356f;
+
+static int const s_directionX[ NUM_GRID_DIRECTIONS ] = { 1, 0, -1,  0, 1, -1, -1,  1 };
+static int const s_directionY[ NUM_GRID_DIRECTIONS ] = { 0, 1,  0, -1, 1,  1, -1, -1 };
+
+
+//---------------------------------------------------------------------------------------------------------
+static int GetOppositeGridDirection( int directionIndex )
+{
+	if( directionIndex < NUM_STRAIGHT_GRID_DIRECTIONS )
+		return ( directionIndex + 2 ) % NUM_STRAIGHT_GRID_DIRECTIONS;
+
+	return NUM_STRAIGHT_GRID_DIRECTIONS + ( ( directionIndex - NUM_STRAIGHT_GRID_DIRECTIONS + 2 ) % NUM_STRAIGHT_GRID_DIRECTIONS );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static int GetStepSign( int value )
+{
+	return ( value > 0 ) - ( value < 0 );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Exact cost of any straight or diagonal run, and an admissible heuristic for everything else
+//---------------------------------------------------------------------------------------------------------
+static float GetOctileDistance( int ax, int ay, int bx, int by )
+{
+	int deltaX = abs( bx - ax );
+	int deltaY = abs( by - ay );
+	int diagonalSteps = ( deltaX < deltaY ) ? deltaX : deltaY;
+	int straightSteps = ( deltaX + deltaY ) - ( 2 * diagonalSteps );
+	return static_cast<float>( straightSteps ) + ( DIAGONAL_STEP_COST * static_cast<float>( diagonalSteps ) );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// The diagonal from (x, y) to (x + dx, y + dy) slides past (x + dx, y) and (x, y + dy); both must be open
+//---------------------------------------------------------------------------------------------------------
+static bool CanStep( PassabilityGrid const& grid, int x, int y, int dx, int dy )
+{
+	if( !grid.IsPassable( x + dx, y + dy ) )
+		return false;
+
+	if( dx != 0 && dy != 0 )
+		return grid.IsPassable( x + dx, y ) && grid.IsPassable( x, y + dy );
+
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+//---------------------------------------------------------------------------------------------------------
+PassabilityGrid::PassabilityGrid( IntVec2 const& dimensions, bool isPassable )
+{
+	Resize( dimensions, isPassable );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void PassabilityGrid::Resize( IntVec2 const& dimensions, bool isPassable )
+{
+	GUARANTEE_OR_DIE( dimensions.x >= 0 && dimensions.y >= 0, "PassabilityGrid dimensions cannot be negative" );
+
+	m_dimensions = dimensions;
+	m_wordsPerRow = ( dimensions.x + 63 ) / 64;
+	m_bits.assign( static_cast<size_t>( m_wordsPerRow ) * static_cast<size_t>( dimensions.y ), isPassable ? ~0ull : 0ull );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void PassabilityGrid::SetPassable( IntVec2 const& tileCoords, bool isPassable )
+{
+	if( !IsInBounds( tileCoords ) )
+		return;
+
+	uint64_t& word = m_bits[ ( tileCoords.y * m_wordsPerRow ) + ( tileCoords.x >> 6 ) ];
+	uint64_t bit = 1ull << ( tileCoords.x & 63 );
+	word = isPassable ? ( word | bit ) : ( word & ~bit );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool PassabilityGrid::IsPassable( int x, int y ) const
+{
+	// Unsigned compare folds the negative check in
+	if( static_cast<unsigned int>( x ) >= static_cast<unsigned int>( m_dimensions.x ) || static_cast<unsigned int>( y ) >= static_cast<unsigned int>( m_dimensions.y ) )
+		return false;
+
+	return ( ( m_bits[ ( y * m_wordsPerRow ) + ( x >> 6 ) ] >> ( x & 63 ) ) & 1ull ) != 0;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool PassabilityGrid::IsInBounds( IntVec2 const& tileCoords ) const
+{
+	return tileCoords.x >= 0 && tileCoords.y >= 0 && tileCoords.x < m_dimensions.x && tileCoords.y < m_dimensions.y;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+//---------------------------------------------------------------------------------------------------------
+bool GridPathfinder::FindPath( PassabilityGrid const& grid, IntVec2 const& start, IntVec2 const& goal, GridPathAlgorithm algorithm, std::vector<IntVec2>& out_path )
+{
+	switch( algorithm )
+	{
+	case GRID_PATH_ASTAR:		return FindPathAStar( grid, start, goal, out_path );
+	case GRID_PATH_JUMP_POINT:	return FindPathJumpPoint( grid, start, goal, out_path );
+	default:
+		ERROR_AND_DIE( "Unknown grid path algorithm" );
+		return false;
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool GridPathfinder::FindPathAStar( PassabilityGrid const& grid, IntVec2 const& start, IntVec2 const& goal, std::vector<IntVec2>& out_path )
+{
+	if( !BeginSearch( grid, start, goal, out_path ) )
+		return false;
+
+	int goalIndex = grid.GetTileIndex( goal );
+	open_node_t node;
+	while( PopOpen( node ) )
+	{
+		++m_nodesExpanded;
+		if( node.tileIndex == goalIndex )
+		{
+			m_pathCost = node.gCost;
+			BuildPath( grid, goalIndex, out_path );
+			return true;
+		}
+
+		IntVec2 tileCoords = grid.GetTileCoords( node.tileIndex );
+		for( int directionIndex = 0; directionIndex < NUM_GRID_DIRECTIONS; ++directionIndex )
+		{
+			int dx = s_directionX[ directionIndex ];
+			int dy = s_directionY[ directionIndex ];
+			if( !CanStep( grid, tileCoords.x, tileCoords.y, dx, dy ) )
+				continue;
+
+			IntVec2 neighborCoords( tileCoords.x + dx, tileCoords.y + dy );
+			float stepCost = ( directionIndex < NUM_STRAIGHT_GRID_DIRECTIONS ) ? 1.f : DIAGONAL_STEP_COST;
+			TryOpen( grid.GetTileIndex( neighborCoords ), node.tileIndex, node.gCost + stepCost, neighborCoords, goal );
+		}
+	}
+	return false;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Harabor & Grastien's jump point search, in the variant that forbids cutting corners: a straight run stops
+// where a tile beside it opens up behind an obstacle, and a diagonal run stops wherever one of its two
+// straight scans finds such a tile. Only those stops ever touch the heap.
+//---------------------------------------------------------------------------------------------------------
+bool GridPathfinder::FindPathJumpPoint( PassabilityGrid const& grid, IntVec2 const& start, IntVec2 const& goal, std::vector<IntVec2>& out_path )
+{
+	if( !BeginSearch( grid, start, goal, out_path ) )
+		return false;
+
+	int goalIndex = grid.GetTileIndex( goal );
+	IntVec2 directions[ NUM_GRID_DIRECTIONS ];
+	open_node_t node;
+	while( PopOpen( node ) )
+	{
+		++m_nodesExpanded;
+		if( node.tileIndex == goalIndex )
+		{
+			m_pathCost = node.gCost;
+			BuildPath( grid, goalIndex, out_path );
+			return true;
+		}
+
+		IntVec2 tileCoords = grid.GetTileCoords( node.tileIndex );
+		int directionCount = GetJumpPointDirections( grid, node.tileIndex, directions );
+		for( int directionIndex = 0; directionIndex < directionCount; ++directionIndex )
+		{
+			int dx = directions[ directionIndex ].x;
+			int dy = directions[ directionIndex ].y;
+
+			int jumpIndex = ( dx != 0 && dy != 0 )
+				? JumpDiagonal( grid, tileCoords.x + dx, tileCoords.y + dy, dx, dy, goal )
+				: JumpStraight( grid, tileCoords.x + dx, tileCoords.y + dy, dx, dy, goal );
+			if( jumpIndex < 0 )
+				continue;
+
+			IntVec2 jumpCoords = grid.GetTileCoords( jumpIndex );
+			float gCost = node.gCost + GetOctileDistance( tileCoords.x, tileCoords.y, jumpCoords.x, jumpCoords.y );
+			TryOpen( jumpIndex, node.tileIndex, gCost, jumpCoords, goal );
+		}
+	}
+	return false;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool GridPathfinder::BeginSearch( PassabilityGrid const& grid, IntVec2 const& start, IntVec2 const& goal, std::vector<IntVec2>& out_path )
+{
+	out_path.clear();
+	m_pathCost = 0.f;
+	m_nodesExpanded = 0;
+	if( !grid.IsPassable( start ) || !grid.IsPassable( goal ) )
+		return false;
+
+	size_t tileCount = static_cast<size_t>( grid.GetTileCount() );
+	if( m_gCosts.size() != tileCount )
+	{
+		m_gCosts.assign( tileCount, 0.f );
+		m_parents.assign( tileCount, -1 );
+		m_openedStamps.assign( tileCount, 0 );
+		m_closedStamps.assign( tileCount, 0 );
+		m_searchStamp = 0;
+	}
+
+	++m_searchStamp;
+	if( m_searchStamp == 0 )
+	{
+		// Wrapped after four billion searches; old stamps could now look current
+		std::fill( m_openedStamps.begin(), m_openedStamps.end(), 0 );
+		std::fill( m_closedStamps.begin(), m_closedStamps.end(), 0 );
+		m_searchStamp = 1;
+	}
+
+	m_openHeap.clear();
+	TryOpen( grid.GetTileIndex( start ), -1, 0.f, start, goal );
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void GridPathfinder::TryOpen( int tileIndex, int parentIndex, float gCost, IntVec2 const& tileCoords, IntVec2 const& goal )
+{
+	if( m_closedStamps[ tileIndex ] == m_searchStamp )
+		return;
+
+	if( m_openedStamps[ tileIndex ] == m_searchStamp && gCost >= m_gCosts[ tileIndex ] )
+		return;
+
+	m_openedStamps[ tileIndex ] = m_searchStamp;
+	m_gCosts[ tileIndex ] = gCost;
+	m_parents[ tileIndex ] = parentIndex;
+
+	// A cheaper route just pushes a second entry; the old one is skipped as stale when it surfaces
+	open_node_t node;
+	node.gCost		= gCost;
+	node.fCost		= gCost + GetOctileDistance( tileCoords.x, tileCoords.y, goal.x, goal.y );
+	node.tileIndex	= tileIndex;
+	m_openHeap.push_back( node );
+	std::push_heap( m_openHeap.begin(), m_openHeap.end() );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool GridPathfinder::PopOpen( open_node_t& out_node )
+{
+	while( !m_openHeap.empty() )
+	{
+		std::pop_heap( m_openHeap.begin(), m_openHeap.end() );
+		out_node = m_openHeap.back();
+		m_openHeap.pop_back();
+
+		if( m_closedStamps[ out_node.tileIndex ] == m_searchStamp || out_node.gCost > m_gCosts[ out_node.tileIndex ] )
+			continue;
+
+		m_closedStamps[ out_node.tileIndex ] = m_searchStamp;
+		return true;
+	}
+	return false;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Jump point parents can be many tiles back, but always along a straight or diagonal line, so walking the
+// line fills in the tiles between them
+//---------------------------------------------------------------------------------------------------------
+void GridPathfinder::BuildPath( PassabilityGrid const& grid, int goalIndex, std::vector<IntVec2>& out_path ) const
+{
+	out_path.clear();
+	IntVec2 tileCoords = grid.GetTileCoords( goalIndex );
+	out_path.push_back( tileCoords );
+
+	for( int parentIndex = m_parents[ goalIndex ]; parentIndex >= 0; parentIndex = m_parents[ parentIndex ] )
+	{
+		IntVec2 parentCoords = grid.GetTileCoords( parentIndex );
+		int dx = GetStepSign( parentCoords.x - tileCoords.x );
+		int dy = GetStepSign( parentCoords.y - tileCoords.y );
+		while( tileCoords != parentCoords )
+		{
+			tileCoords += IntVec2( dx, dy );
+			out_path.push_back( tileCoords );
+		}
+	}
+	std::reverse( out_path.begin(), out_path.end() );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Returns the first jump point on the run from (x, y) heading (dx, dy), or -1 if the run hits a wall
+//---------------------------------------------------------------------------------------------------------
+int GridPathfinder::JumpStraight( PassabilityGrid const& grid, int x, int y, int dx, int dy, IntVec2 const& goal ) const
+{
+	while( grid.IsPassable( x, y ) )
+	{
+		if( x == goal.x && y == goal.y )
+			return grid.GetTileIndex( x, y );
+
+		if( dx != 0 )
+		{
+			if( ( grid.IsPassable( x, y - 1 ) && !grid.IsPassable( x - dx, y - 1 ) ) ||
+				( grid.IsPassable( x, y + 1 ) && !grid.IsPassable( x - dx, y + 1 ) ) )
+				return grid.GetTileIndex( x, y );
+		}
+		else
+		{
+			if( ( grid.IsPassable( x - 1, y ) && !grid.IsPassable( x - 1, y - dy ) ) ||
+				( grid.IsPassable( x + 1, y ) && !grid.IsPassable( x + 1, y - dy ) ) )
+				return grid.GetTileIndex( x, y );
+		}
+
+		x += dx;
+		y += dy;
+	}
+	return -1;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+int GridPathfinder::JumpDiagonal( PassabilityGrid const& grid, int x, int y, int dx, int dy, IntVec2 const& goal ) const
+{
+	while( grid.IsPassable( x, y ) )
+	{
+		if( x == goal.x && y == goal.y )
+			return grid.GetTileIndex( x, y );
+
+		if( JumpStraight( grid, x + dx, y, dx, 0, goal ) >= 0 || JumpStraight( grid, x, y + dy, 0, dy, goal ) >= 0 )
+			return grid.GetTileIndex( x, y );
+
+		if( !grid.IsPassable( x + dx, y ) || !grid.IsPassable( x, y + dy ) )
+			return -1;
+
+		x += dx;
+		y += dy;
+	}
+	return -1;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// The start expands every open direction; anything else only continues the way it came plus the turns its
+// parent couldn't have taken itself
+//---------------------------------------------------------------------------------------------------------
+int GridPathfinder::GetJumpPointDirections( PassabilityGrid const& grid, int tileIndex, IntVec2* out_directions ) const
+{
+	IntVec2 tileCoords = grid.GetTileCoords( tileIndex );
+	int x = tileCoords.x;
+	int y = tileCoords.y;
+	int directionCount = 0;
+
+	int parentIndex = m_parents[ tileIndex ];
+	if( parentIndex < 0 )
+	{
+		for( int directionIndex = 0; directionIndex < NUM_GRID_DIRECTIONS; ++directionIndex )
+		{
+			if( CanStep( grid, x, y, s_directionX[ directionIndex ], s_directionY[ directionIndex ] ) )
+			{
+				out_directions[ directionCount++ ] = IntVec2( s_directionX[ directionIndex ], s_directionY[ directionIndex ] );
+			}
+		}
+		return directionCount;
+	}
+
+	IntVec2 parentCoords = grid.GetTileCoords( parentIndex );
+	int dx = GetStepSign( x - parentCoords.x );
+	int dy = GetStepSign( y - parentCoords.y );
+
+	if( dx != 0 && dy != 0 )
+	{
+		bool isVerticalOpen = grid.IsPassable( x, y + dy );
+		bool isHorizontalOpen = grid.IsPassable( x + dx, y );
+		if( isVerticalOpen )						out_directions[ directionCount++ ] = IntVec2( 0, dy );
+		if( isHorizontalOpen )						out_directions[ directionCount++ ] = IntVec2( dx, 0 );
+		if( isVerticalOpen && isHorizontalOpen )	out_directions[ directionCount++ ] = IntVec2( dx, dy );
+	}
+	else if( dx != 0 )
+	{
+		bool isNextOpen = grid.IsPassable( x + dx, y );
+		bool isUpOpen = grid.IsPassable( x, y + 1 );
+		bool isDownOpen = grid.IsPassable( x, y - 1 );
+		if( isNextOpen )
+		{
+			out_directions[ directionCount++ ] = IntVec2( dx, 0 );
+			if( isUpOpen )		out_directions[ directionCount++ ] = IntVec2( dx, 1 );
+			if( isDownOpen )	out_directions[ directionCount++ ] = IntVec2( dx, -1 );
+		}
+		if( isUpOpen )			out_directions[ directionCount++ ] = IntVec2( 0, 1 );
+		if( isDownOpen )		out_directions[ directionCount++ ] = IntVec2( 0, -1 );
+	}
+	else
+	{
+		bool isNextOpen = grid.IsPassable( x, y + dy );
+		bool isRightOpen = grid.IsPassable( x + 1, y );
+		bool isLeftOpen = grid.IsPassable( x - 1, y );
+		if( isNextOpen )
+		{
+			out_directions[ directionCount++ ] = IntVec2( 0, dy );
+			if( isRightOpen )	out_directions[ directionCount++ ] = IntVec2( 1, dy );
+			if( isLeftOpen )	out_directions[ directionCount++ ] = IntVec2( -1, dy );
+		}
+		if( isRightOpen )		out_directions[ directionCount++ ] = IntVec2( 1, 0 );
+		if( isLeftOpen )		out_directions[ directionCount++ ] = IntVec2( -1, 0 );
+	}
+	return directionCount;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+//---------------------------------------------------------------------------------------------------------
+void FlowField::Build( PassabilityGrid const& grid, IntVec2 const& goalTile )
+{
+	std::vector<IntVec2> goalTiles;
+	goalTiles.push_back( goalTile );
+	Build( grid, goalTiles );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void FlowField::Build( PassabilityGrid const& grid, std::vector<IntVec2> const& goalTiles )
+{
+	m_dimensions = grid.GetDimensions();
+	size_t tileCount = static_cast<size_t>( grid.GetTileCount() );
+	m_distances.assign( tileCount, std::numeric_limits<float>::infinity() );
+	m_directions.assign( tileCount, NO_DIRECTION );
+	m_openHeap.clear();
+
+	for( uint goalIndex = 0; goalIndex < goalTiles.size(); ++goalIndex )
+	{
+		IntVec2 const& goalTile = goalTiles[ goalIndex ];
+		if( !grid.IsPassable( goalTile ) )
+			continue;
+
+		open_tile_t openTile;
+		openTile.tileIndex = grid.GetTileIndex( goalTile );
+		m_distances[ openTile.tileIndex ] = 0.f;
+		m_openHeap.push_back( openTile );
+	}
+	std::make_heap( m_openHeap.begin(), m_openHeap.end() );
+
+	while( !m_openHeap.empty() )
+	{
+		std::pop_heap( m_openHeap.begin(), m_openHeap.end() );
+		open_tile_t openTile = m_openHeap.back();
+		m_openHeap.pop_back();
+		if( openTile.distance > m_distances[ openTile.tileIndex ] )
+			continue;
+
+		IntVec2 tileCoords = grid.GetTileCoords( openTile.tileIndex );
+		for( int directionIndex = 0; directionIndex < NUM_GRID_DIRECTIONS; ++directionIndex )
+		{
+			int dx = s_directionX[ directionIndex ];
+			int dy = s_directionY[ directionIndex ];
+			if( !CanStep( grid, tileCoords.x, tileCoords.y, dx, dy ) )
+				continue;
+
+			int neighborIndex = grid.GetTileIndex( tileCoords.x + dx, tileCoords.y + dy );
+			float stepCost = ( directionIndex < NUM_STRAIGHT_GRID_DIRECTIONS ) ? 1.f : DIAGONAL_STEP_COST;
+			float neighborDistance = openTile.distance + stepCost;
+			if( neighborDistance >= m_distances[ neighborIndex ] )
+				continue;
+
+			// The neighbor flows back the way we came
+			m_distances[ neighborIndex ] = neighborDistance;
+			m_directions[ neighborIndex ] = static_cast<uint8_t>( GetOppositeGridDirection( directionIndex ) );
+
+			open_tile_t neighborTile;
+			neighborTile.distance	= neighborDistance;
+			neighborTile.tileIndex	= neighborIndex;
+			m_openHeap.push_back( neighborTile );
+			std::push_heap( m_openHeap.begin(), m_openHeap.end() );
+		}
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool FlowField::IsReachable( IntVec2 const& tileCoords ) const
+{
+	int tileIndex = GetTileIndex( tileCoords );
+	return tileIndex >= 0 && m_distances[ tileIndex ] != std::numeric_limits<float>::infinity();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+float FlowField::GetDistance( IntVec2 const& tileCoords ) const
+{
+	int tileIndex = GetTileIndex( tileCoords );
+	if( tileIndex < 0 )
+		return std::numeric_limits<float>::infinity();
+
+	return m_distances[ tileIndex ];
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+IntVec2 FlowField::GetNextTile( IntVec2 const& tileCoords ) const
+{
+	int tileIndex = GetTileIndex( tileCoords );
+	if( tileIndex < 0 || m_directions[ tileIndex ] == NO_DIRECTION )
+		return tileCoords;
+
+	uint8_t directionIndex = m_directions[ tileIndex ];
+	return IntVec2( tileCoords.x + s_directionX[ directionIndex ], tileCoords.y + s_directionY[ directionIndex ] );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+Vec2 FlowField::GetFlowDirection( IntVec2 const& tileCoords ) const
+{
+	int tileIndex = GetTileIndex( tileCoords );
+	if( tileIndex < 0 || m_directions[ tileIndex ] == NO_DIRECTION )
+		return Vec2( 0.f, 0.f );
+
+	uint8_t directionIndex = m_directions[ tileIndex ];
+	Vec2 direction( static_cast<float>( s_directionX[ directionIndex ] ), static_cast<float>( s_directionY[ directionIndex ] ) );
+	return direction.GetNormalized();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+int FlowField::GetTileIndex( IntVec2 const& tileCoords ) const
+{
+	if( tileCoords.x < 0 || tileCoords.y < 0 || tileCoords.x >= m_dimensions.x || tileCoords.y >= m_dimensions.y )
+		return -1;
+
+	return tileCoords.x + ( tileCoords.y * m_dimensions.x );
+}
@@ -0,0 +1,148 @@
+#pragma once
+#include "Engine/Math/IntVec2.hpp"
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include <stdint.h>
+#include <vector>
+
+
+//---------------------------------------------------------------------------------------------------------
+// One bit per tile, rows padded to whole 64-bit words. Anything outside the grid reads as blocked, so
+// searches never need their own bounds checks.
+//---------------------------------------------------------------------------------------------------------
+class PassabilityGrid
+{
+public:
+	PassabilityGrid() {}
+	explicit PassabilityGrid( IntVec2 const& dimensions, bool isPassable = true );
+	~PassabilityGrid() {}
+
+	void	Resize( IntVec2 const& dimensions, bool isPassable = true );
+	void	SetPassable( IntVec2 const& tileCoords, bool isPassable );
+	void	SetPassable( int tileIndex, bool isPassable )				{ SetPassable( GetTileCoords( tileIndex ), isPassable ); }
+
+	bool	IsPassable( int x, int y ) const;
+	bool	IsPassable( IntVec2 const& tileCoords ) const				{ return IsPassable( tileCoords.x, tileCoords.y ); }
+	bool	IsInBounds( IntVec2 const& tileCoords ) const;
+
+	IntVec2	GetDimensions() const										{ return m_dimensions; }
+	int		GetTileCount() const										{ return m_dimensions.x * m_dimensions.y; }
+	int		GetTileIndex( int x, int y ) const							{ return x + ( y * m_dimensions.x ); }
+	int		GetTileIndex( IntVec2 const& tileCoords ) const				{ return GetTileIndex( tileCoords.x, tileCoords.y ); }
+	IntVec2	GetTileCoords( int tileIndex ) const						{ return IntVec2( tileIndex % m_dimensions.x, tileIndex / m_dimensions.x ); }
+
+private:
+	IntVec2					m_dimensions	= IntVec2( 0, 0 );
+	int						m_wordsPerRow	= 0;
+	std::vector<uint64_t>	m_bits;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+enum GridPathAlgorithm
+{
+	GRID_PATH_ASTAR,
+	GRID_PATH_JUMP_POINT,
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Shortest paths on a PassabilityGrid with 8-way movement (straight steps cost 1, diagonals sqrt(2)).
+// A diagonal step is only allowed when both tiles it slides past are open, so agents never clip corners.
+//
+// A* runs on a binary heap; jump point search gives the same path lengths but only pushes the tiles where
+// the path could turn, which is far fewer heap operations on open maps. Paths come back as every tile from
+// start to goal inclusive either way.
+//
+// A pathfinder owns the per-tile scratch for one search at a time and reuses it between searches (stamped,
+// never cleared), so keep one per thread rather than creating one per query.
+//---------------------------------------------------------------------------------------------------------
+class GridPathfinder
+{
+public:
+	GridPathfinder() {}
+	~GridPathfinder() {}
+
+	bool	FindPath( PassabilityGrid const& grid, IntVec2 const& start, IntVec2 const& goal, GridPathAlgorithm algorithm, std::vector<IntVec2>& out_path );
+	bool	FindPathAStar( PassabilityGrid const& grid, IntVec2 const& start, IntVec2 const& goal, std::vector<IntVec2>& out_path );
+	bool	FindPathJumpPoint( PassabilityGrid const& grid, IntVec2 const& start, IntVec2 const& goal, std::vector<IntVec2>& out_path );
+
+	// Stats for the last search
+	float	GetPathCost() const											{ return m_pathCost; }
+	uint	GetNodesExpanded() const									{ return m_nodesExpanded; }
+
+private:
+	struct open_node_t
+	{
+		float	fCost		= 0.f;
+		float	gCost		= 0.f;
+		int		tileIndex	= 0;
+
+		// Min-heap on f; on ties the node further along (higher g) comes out first
+		bool operator<( open_node_t const& compare ) const			{ return fCost > compare.fCost || ( fCost == compare.fCost && gCost < compare.gCost ); }
+	};
+
+	bool	BeginSearch( PassabilityGrid const& grid, IntVec2 const& start, IntVec2 const& goal, std::vector<IntVec2>& out_path );
+	void	TryOpen( int tileIndex, int parentIndex, float gCost, IntVec2 const& tileCoords, IntVec2 const& goal );
+	bool	PopOpen( open_node_t& out_node );
+	void	BuildPath( PassabilityGrid const& grid, int goalIndex, std::vector<IntVec2>& out_path ) const;
+
+	int		JumpStraight( PassabilityGrid const& grid, int x, int y, int dx, int dy, IntVec2 const& goal ) const;
+	int		JumpDiagonal( PassabilityGrid const& grid, int x, int y, int dx, int dy, IntVec2 const& goal ) const;
+	int		GetJumpPointDirections( PassabilityGrid const& grid, int tileIndex, IntVec2* out_directions ) const;
+
+private:
+	std::vector<float>			m_gCosts;
+	std::vector<int>			m_parents;
+	std::vector<uint32_t>		m_openedStamps;		// == m_searchStamp once a tile has a g cost this search
+	std::vector<uint32_t>		m_closedStamps;
+	std::vector<open_node_t>	m_openHeap;
+	uint32_t					m_searchStamp		= 0;
+
+	float						m_pathCost			= 0.f;
+	uint						m_nodesExpanded		= 0;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Distance to the nearest of any number of goal tiles for every tile on the grid, plus the neighbor to step
+// to from each one. Built once per goal change with a multi-source Dijkstra, then every agent in a swarm
+// steers with a single lookup instead of its own search.
+//---------------------------------------------------------------------------------------------------------
+class FlowField
+{
+public:
+	FlowField() {}
+	~FlowField() {}
+
+	void	Build( PassabilityGrid const& grid, std::vector<IntVec2> const& goalTiles );
+	void	Build( PassabilityGrid const& grid, IntVec2 const& goalTile );
+
+	bool	IsReachable( IntVec2 const& tileCoords ) const;
+	float	GetDistance( IntVec2 const& tileCoords ) const;				// infinity if unreachable
+	IntVec2	GetNextTile( IntVec2 const& tileCoords ) const;				// tileCoords itself at a goal or unreachable
+	Vec2	GetFlowDirection( IntVec2 const& tileCoords ) const;		// normalized; zero at a goal or unreachable
+
+	IntVec2	GetDimensions() const										{ return m_dimensions; }
+
+public:
+	static constexpr uint8_t NO_DIRECTION = 0xFF;
+
+private:
+	struct open_tile_t
+	{
+		float	distance	= 0.f;
+		int		tileIndex	= 0;
+
+		bool operator<( open_tile_t const& compare ) const			{ return distance > compare.distance; }
+	};
+
+	int		GetTileIndex( IntVec2 const& tileCoords ) const;
+
+private:
+	IntVec2						m_dimensions	= IntVec2( 0, 0 );
+	std::vector<float>			m_distances;
+	std::vector<uint8_t>		m_directions;
+	std::vector<open_tile_t>	m_openHeap;
+};
+
@@ -794,7 +794,7 @@ bool DoPolygonAndDiscOverlap( const Polygon2D& polygon, const Vec2& discCenter,
 
 
 //---------------------------------------------------------------------------------------------------------
-bool DoPolygonsOverlap( Polygon2D polygonA, Polygon2D polygonB, std::vector<Vec2>* out_simplexResult ) 
+bool DoPolygonsOverlap( const Polygon2D& polygonA, const Polygon2D& polygonB, std::vector<Vec2>* out_simplexResult ) 
 {
 	Vec2 simplexVerts[ 3 ];
 	Vec2 direction = Vec2::LEFT;
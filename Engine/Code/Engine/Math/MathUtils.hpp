@@ -96,7 +96,7 @@ bool		DoOBBAndLineSegmentOverlap2D( const OBB2& obb, const Vec2& lineStart, cons
 bool		DoOBBAndCapsuleOverlap2D( const OBB2& obb, const Vec2& capsuleMidStart, const Vec2& capsuleMidEnd, float capsuleRadius );
 bool		DoOBBAndDiscOverlap2D( const OBB2& obb, const Vec2& discCenter, float discRadius );
 bool		DoPolygonAndDiscOverlap( const Polygon2D& polygon, const Vec2& discCenter, float discRadius );
-bool		DoPolygonsOverlap( Polygon2D polygonA, Polygon2D polygonB, std::vector<Vec2>* out_craetedSimplex = nullptr );
+bool		DoPolygonsOverlap( const Polygon2D& polygonA, const Polygon2D& polygonB, std::vector<Vec2>* out_craetedSimplex = nullptr );
 
 void		PushDiscOutOfOBB2( Vec2& discCenterPosition, float discRadius, const OBB2& box );
 void		PushDiscOutOfAABB2( Vec2& discCenterPosition, float discRadius, const AABB2& box );
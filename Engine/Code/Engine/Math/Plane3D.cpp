@@ -0,0 +1,39 @@
+#include "Engine/Math/Plane3D.hpp"
+#include "Engine/Math/MathUtils.hpp"
+
+
+//---------------------------------------------------------------------------------------------------------
+Plane3D::Plane3D( Vec3 const& toNormal, float toDistance )
+{
+	normal = toNormal;
+	distance = toDistance;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+Plane3D::Plane3D( Vec3 const& toNormal, Vec3 const& pointOnPlane )
+{
+	normal = toNormal;
+	distance = DotProduct3D( toNormal, pointOnPlane );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+Vec3 Plane3D::GetOrigin() const
+{
+	return normal * distance;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+float Plane3D::GetPointsDistanceFromPlane( Vec3 const& refPoint ) const
+{
+	return DotProduct3D( normal, refPoint ) - distance;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool Plane3D::IsPointInFrontOfPlane( Vec3 const& refPoint ) const
+{
+	return GetPointsDistanceFromPlane( refPoint ) > 0.f;
+}
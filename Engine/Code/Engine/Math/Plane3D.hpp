@@ -0,0 +1,20 @@
+#pragma once
+#include "Engine/Math/Vec3.hpp"
+
+
+struct Plane3D
+{
+public:
+	Vec3 normal;
+	float distance = 0.f;
+
+public:
+	Plane3D() {}
+	Plane3D( Vec3 const& toNormal, float toDistance );
+	Plane3D( Vec3 const& toNormal, Vec3 const& pointOnPlane );
+	~Plane3D() = default;
+
+	Vec3	GetOrigin() const;
+	float	GetPointsDistanceFromPlane( Vec3 const& refPoint ) const;
+	bool	IsPointInFrontOfPlane( Vec3 const& refPoint ) const;
+};
@@ -0,0 +1,477 @@
+#include "Engine/Math/RectPacker.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/Time.hpp"
+#include <algorithm>
+#include <limits.h>
+
+
+//---------------------------------------------------------------------------------------------------------
+RectPacker::RectPacker( IntVec2 const& binSize, RectPackMethod method )
+	: m_binSize( binSize )
+	, m_method( method )
+{
+	Reset();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void RectPacker::Reset()
+{
+	m_usedExtents = IntVec2( 0, 0 );
+	m_packedArea = 0;
+	m_shelfCursor = IntVec2( 0, 0 );
+	m_shelfHeight = 0;
+
+	m_skyline.clear();
+	skyline_node_t floorNode;
+	floorNode.width = m_binSize.x;
+	m_skyline.push_back( floorNode );
+
+	m_freeRects.clear();
+	free_rect_t wholeBin;
+	wholeBin.size = m_binSize;
+	m_freeRects.push_back( wholeBin );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool RectPacker::Insert( IntVec2 const& rectSize, IntVec2& out_rectMins )
+{
+	if( rectSize.x <= 0 || rectSize.y <= 0 || rectSize.x > m_binSize.x || rectSize.y > m_binSize.y )
+		return false;
+
+	bool wasInserted = false;
+	switch( m_method )
+	{
+	case RECT_PACK_SHELF:		wasInserted = InsertShelf( rectSize, out_rectMins );		break;
+	case RECT_PACK_SKYLINE:		wasInserted = InsertSkyline( rectSize, out_rectMins );		break;
+	case RECT_PACK_MAX_RECTS:	wasInserted = InsertMaxRects( rectSize, out_rectMins );	break;
+	default:
+		ERROR_AND_DIE( "Unknown rect pack method" );
+	}
+
+	if( wasInserted )
+	{
+		m_packedArea += rectSize.x * rectSize.y;
+		if( out_rectMins.x + rectSize.x > m_usedExtents.x )
+		{
+			m_usedExtents.x = out_rectMins.x + rectSize.x;
+		}
+		if( out_rectMins.y + rectSize.y > m_usedExtents.y )
+		{
+			m_usedExtents.y = out_rectMins.y + rectSize.y;
+		}
+	}
+	return wasInserted;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+float RectPacker::GetOccupancy() const
+{
+	int usedArea = m_usedExtents.x * m_usedExtents.y;
+	if( usedArea == 0 )
+		return 0.f;
+
+	return static_cast<float>( m_packedArea ) / static_cast<float>( usedArea );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool RectPacker::InsertShelf( IntVec2 const& rectSize, IntVec2& out_rectMins )
+{
+	if( m_shelfCursor.x + rectSize.x > m_binSize.x )
+	{
+		m_shelfCursor.x = 0;
+		m_shelfCursor.y += m_shelfHeight;
+		m_shelfHeight = 0;
+	}
+
+	if( m_shelfCursor.y + rectSize.y > m_binSize.y )
+		return false;
+
+	out_rectMins = m_shelfCursor;
+	m_shelfCursor.x += rectSize.x;
+	if( rectSize.y > m_shelfHeight )
+	{
+		m_shelfHeight = rectSize.y;
+	}
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Bottom-left: the spot whose top edge ends up lowest, ties going to the narrowest skyline segment
+//---------------------------------------------------------------------------------------------------------
+bool RectPacker::InsertSkyline( IntVec2 const& rectSize, IntVec2& out_rectMins )
+{
+	size_t bestNodeIndex = m_skyline.size();
+	int bestTop = INT_MAX;
+	int bestWidth = INT_MAX;
+	int bestY = 0;
+	for( size_t nodeIndex = 0; nodeIndex < m_skyline.size(); ++nodeIndex )
+	{
+		int fitY = GetSkylineFitY( nodeIndex, rectSize );
+		if( fitY < 0 )
+			continue;
+
+		int top = fitY + rectSize.y;
+		if( top < bestTop || ( top == bestTop && m_skyline[ nodeIndex ].width < bestWidth ) )
+		{
+			bestNodeIndex = nodeIndex;
+			bestTop = top;
+			bestWidth = m_skyline[ nodeIndex ].width;
+			bestY = fitY;
+		}
+	}
+
+	if( bestNodeIndex == m_skyline.size() )
+		return false;
+
+	out_rectMins = IntVec2( m_skyline[ bestNodeIndex ].x, bestY );
+	AddSkylineLevel( bestNodeIndex, out_rectMins, rectSize );
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// How high a rect starting at this node has to sit to clear every node under it, or -1 if it won't fit
+//---------------------------------------------------------------------------------------------------------
+int RectPacker::GetSkylineFitY( size_t nodeIndex, IntVec2 const& rectSize ) const
+{
+	if( m_skyline[ nodeIndex ].x + rectSize.x > m_binSize.x )
+		return -1;
+
+	int fitY = 0;
+	int widthLeft = rectSize.x;
+	for( size_t coveredIndex = nodeIndex; widthLeft > 0; ++coveredIndex )
+	{
+		skyline_node_t const& coveredNode = m_skyline[ coveredIndex ];
+		if( coveredNode.y > fitY )
+		{
+			fitY = coveredNode.y;
+		}
+		if( fitY + rectSize.y > m_binSize.y )
+			return -1;
+
+		widthLeft -= coveredNode.width;
+	}
+	return fitY;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void RectPacker::AddSkylineLevel( size_t nodeIndex, IntVec2 const& rectMins, IntVec2 const& rectSize )
+{
+	skyline_node_t newNode;
+	newNode.x = rectMins.x;
+	newNode.y = rectMins.y + rectSize.y;
+	newNode.width = rectSize.x;
+	m_skyline.insert( m_skyline.begin() + nodeIndex, newNode );
+
+	// Trim or drop the nodes the new level now covers
+	for( size_t coveredIndex = nodeIndex + 1; coveredIndex < m_skyline.size(); )
+	{
+		skyline_node_t const& previousNode = m_skyline[ coveredIndex - 1 ];
+		skyline_node_t& coveredNode = m_skyline[ coveredIndex ];
+		int overlap = previousNode.x + previousNode.width - coveredNode.x;
+		if( overlap <= 0 )
+			break;
+
+		coveredNode.x += overlap;
+		coveredNode.width -= overlap;
+		if( coveredNode.width > 0 )
+			break;
+
+		m_skyline.erase( m_skyline.begin() + coveredIndex );
+	}
+
+	for( size_t mergeIndex = 0; mergeIndex + 1 < m_skyline.size(); )
+	{
+		if( m_skyline[ mergeIndex ].y == m_skyline[ mergeIndex + 1 ].y )
+		{
+			m_skyline[ mergeIndex ].width += m_skyline[ mergeIndex + 1 ].width;
+			m_skyline.erase( m_skyline.begin() + mergeIndex + 1 );
+		}
+		else
+		{
+			++mergeIndex;
+		}
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Best short side fit: the free rect that leaves the smallest leftover on its tighter side
+//---------------------------------------------------------------------------------------------------------
+bool RectPacker::InsertMaxRects( IntVec2 const& rectSize, IntVec2& out_rectMins )
+{
+	size_t bestFreeIndex = m_freeRects.size();
+	int bestShortSide = INT_MAX;
+	int bestLongSide = INT_MAX;
+	for( size_t freeIndex = 0; freeIndex < m_freeRects.size(); ++freeIndex )
+	{
+		free_rect_t const& freeRect = m_freeRects[ freeIndex ];
+		if( rectSize.x > freeRect.size.x || rectSize.y > freeRect.size.y )
+			continue;
+
+		int leftoverX = freeRect.size.x - rectSize.x;
+		int leftoverY = freeRect.size.y - rectSize.y;
+		int shortSide = leftoverX < leftoverY ? leftoverX : leftoverY;
+		int longSide = leftoverX < leftoverY ? leftoverY : leftoverX;
+		if( shortSide < bestShortSide || ( shortSide == bestShortSide && longSide < bestLongSide ) )
+		{
+			bestFreeIndex = freeIndex;
+			bestShortSide = shortSide;
+			bestLongSide = longSide;
+		}
+	}
+
+	if( bestFreeIndex == m_freeRects.size() )
+		return false;
+
+	out_rectMins = m_freeRects[ bestFreeIndex ].mins;
+	SplitFreeRects( out_rectMins, rectSize );
+	PruneFreeRects();
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Every free rect the new rect overlaps is replaced by the (up to four) maximal rects around it
+//---------------------------------------------------------------------------------------------------------
+void RectPacker::SplitFreeRects( IntVec2 const& usedMins, IntVec2 const& usedSize )
+{
+	IntVec2 usedMaxes = usedMins + usedSize;
+
+	m_newFreeRects.clear();
+	for( size_t freeIndex = 0; freeIndex < m_freeRects.size(); )
+	{
+		free_rect_t freeRect = m_freeRects[ freeIndex ];
+		IntVec2 freeMaxes = freeRect.mins + freeRect.size;
+		if( usedMins.x >= freeMaxes.x || usedMaxes.x <= freeRect.mins.x || usedMins.y >= freeMaxes.y || usedMaxes.y <= freeRect.mins.y )
+		{
+			++freeIndex;
+			continue;
+		}
+
+		free_rect_t splitRect;
+		if( usedMins.x > freeRect.mins.x )
+		{
+			splitRect.mins = freeRect.mins;
+			splitRect.size = IntVec2( usedMins.x - freeRect.mins.x, freeRect.size.y );
+			m_newFreeRects.push_back( splitRect );
+		}
+		if( usedMaxes.x < freeMaxes.x )
+		{
+			splitRect.mins = IntVec2( usedMaxes.x, freeRect.mins.y );
+			splitRect.size = IntVec2( freeMaxes.x - usedMaxes.x, freeRect.size.y );
+			m_newFreeRects.push_back( splitRect );
+		}
+		if( usedMins.y > freeRect.mins.y )
+		{
+			splitRect.mins = freeRect.mins;
+			splitRect.size = IntVec2( freeRect.size.x, usedMins.y - freeRect.mins.y );
+			m_newFreeRects.push_back( splitRect );
+		}
+		if( usedMaxes.y < freeMaxes.y )
+		{
+			splitRect.mins = IntVec2( freeRect.mins.x, usedMaxes.y );
+			splitRect.size = IntVec2( freeRect.size.x, freeMaxes.y - usedMaxes.y );
+			m_newFreeRects.push_back( splitRect );
+		}
+
+		m_freeRects[ freeIndex ] = m_freeRects.back();
+		m_freeRects.pop_back();
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static bool IsFreeRectInside( IntVec2 const& innerMins, IntVec2 const& innerSize, IntVec2 const& outerMins, IntVec2 const& outerSize )
+{
+	return	innerMins.x >= outerMins.x && innerMins.y >= outerMins.y &&
+			innerMins.x + innerSize.x <= outerMins.x + outerSize.x &&
+			innerMins.y + innerSize.y <= outerMins.y + outerSize.y;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// The old free rects were already maximal against each other, so only pairs involving a new rect from the
+// last split need checking
+//---------------------------------------------------------------------------------------------------------
+void RectPacker::PruneFreeRects()
+{
+	for( size_t newIndex = 0; newIndex < m_newFreeRects.size(); )
+	{
+		free_rect_t const& newRect = m_newFreeRects[ newIndex ];
+		bool isRedundant = false;
+		for( size_t freeIndex = 0; freeIndex < m_freeRects.size() && !isRedundant; ++freeIndex )
+		{
+			isRedundant = IsFreeRectInside( newRect.mins, newRect.size, m_freeRects[ freeIndex ].mins, m_freeRects[ freeIndex ].size );
+		}
+		for( size_t otherIndex = 0; otherIndex < m_newFreeRects.size() && !isRedundant; ++otherIndex )
+		{
+			// Of two identical rects only the later one goes
+			free_rect_t const& otherRect = m_newFreeRects[ otherIndex ];
+			bool isSameRect = newRect.mins == otherRect.mins && newRect.size == otherRect.size;
+			if( otherIndex != newIndex && ( !isSameRect || otherIndex < newIndex ) )
+			{
+				isRedundant = IsFreeRectInside( newRect.mins, newRect.size, otherRect.mins, otherRect.size );
+			}
+		}
+
+		if( isRedundant )
+		{
+			m_newFreeRects[ newIndex ] = m_newFreeRects.back();
+			m_newFreeRects.pop_back();
+		}
+		else
+		{
+			++newIndex;
+		}
+	}
+
+	for( size_t freeIndex = 0; freeIndex < m_freeRects.size(); )
+	{
+		bool isRedundant = false;
+		for( size_t newIndex = 0; newIndex < m_newFreeRects.size() && !isRedundant; ++newIndex )
+		{
+			isRedundant = IsFreeRectInside( m_freeRects[ freeIndex ].mins, m_freeRects[ freeIndex ].size, m_newFreeRects[ newIndex ].mins, m_newFreeRects[ newIndex ].size );
+		}
+
+		if( isRedundant )
+		{
+			m_freeRects[ freeIndex ] = m_freeRects.back();
+			m_freeRects.pop_back();
+		}
+		else
+		{
+			++freeIndex;
+		}
+	}
+
+	m_freeRects.insert( m_freeRects.end(), m_newFreeRects.begin(), m_newFreeRects.end() );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+int PackRectsIntoBins( std::vector<IntVec2> const& rectSizes, IntVec2 const& binSize, RectPackMethod method, std::vector<rect_placement_t>& out_placements, std::vector<IntVec2>* out_binExtents )
+{
+	out_placements.clear();
+	out_placements.resize( rectSizes.size() );
+
+	// Longest side first, then area, so the awkward rects claim space while there is still a choice
+	std::vector<size_t> packOrder( rectSizes.size() );
+	for( size_t rectIndex = 0; rectIndex < packOrder.size(); ++rectIndex )
+	{
+		packOrder[ rectIndex ] = rectIndex;
+	}
+	std::stable_sort( packOrder.begin(), packOrder.end(), [&]( size_t a, size_t b )
+	{
+		IntVec2 const& sizeA = rectSizes[ a ];
+		IntVec2 const& sizeB = rectSizes[ b ];
+		int longSideA = sizeA.x > sizeA.y ? sizeA.x : sizeA.y;
+		int longSideB = sizeB.x > sizeB.y ? sizeB.x : sizeB.y;
+		if( longSideA != longSideB )
+			return longSideA > longSideB;
+
+		return sizeA.x * sizeA.y > sizeB.x * sizeB.y;
+	} );
+
+	std::vector<RectPacker> bins;
+	for( size_t orderIndex = 0; orderIndex < packOrder.size(); ++orderIndex )
+	{
+		size_t rectIndex = packOrder[ orderIndex ];
+		IntVec2 const& rectSize = rectSizes[ rectIndex ];
+		rect_placement_t& placement = out_placements[ rectIndex ];
+		if( rectSize.x > binSize.x || rectSize.y > binSize.y )
+			continue;
+
+		for( size_t binIndex = 0; binIndex < bins.size(); ++binIndex )
+		{
+			if( bins[ binIndex ].Insert( rectSize, placement.mins ) )
+			{
+				placement.binIndex = static_cast<int>( binIndex );
+				break;
+			}
+		}
+
+		if( placement.binIndex < 0 )
+		{
+			bins.push_back( RectPacker( binSize, method ) );
+			bins.back().Insert( rectSize, placement.mins );
+			placement.binIndex = static_cast<int>( bins.size() ) - 1;
+		}
+	}
+
+	if( out_binExtents != nullptr )
+	{
+		out_binExtents->clear();
+		for( size_t binIndex = 0; binIndex < bins.size(); ++binIndex )
+		{
+			out_binExtents->push_back( bins[ binIndex ].GetUsedExtents() );
+		}
+	}
+	return static_cast<int>( bins.size() );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void RollBenchmarkRectSizes( std::vector<IntVec2>& out_rectSizes, uint rectCount, RandomNumberGenerator& rng )
+{
+	// Mostly small sprites and glyph sheets, with the odd large sheet or UI panel
+	out_rectSizes.clear();
+	for( uint rectIndex = 0; rectIndex < rectCount; ++rectIndex )
+	{
+		int maxSide = rng.RollPercentChance( 0.1f ) ? 256 : 64;
+		out_rectSizes.push_back( IntVec2( rng.RollRandomIntInRange( 8, maxSide ), rng.RollRandomIntInRange( 8, maxSide ) ) );
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void PrintRectPackerBenchmark( uint rectCount, int binSize )
+{
+	if( rectCount == 0 || binSize < 256 )
+		return;
+
+	RandomNumberGenerator rng;
+	rng.Reset( 48 );
+
+	std::vector<IntVec2> rectSizes;
+	RollBenchmarkRectSizes( rectSizes, rectCount, rng );
+
+	int64_t rectArea = 0;
+	for( size_t rectIndex = 0; rectIndex < rectSizes.size(); ++rectIndex )
+	{
+		rectArea += rectSizes[ rectIndex ].x * rectSizes[ rectIndex ].y;
+	}
+
+	g_theConsole->PrintString( Rgba8::WHITE, "Rect packer benchmark: %u rects into %ix%i bins", rectCount, binSize, binSize );
+
+	char const* methodNames[] = { "shelf", "skyline", "max rects" };
+	RectPackMethod methods[] = { RECT_PACK_SHELF, RECT_PACK_SKYLINE, RECT_PACK_MAX_RECTS };
+	for( int methodIndex = 0; methodIndex < 3; ++methodIndex )
+	{
+		std::vector<rect_placement_t> placements;
+		std::vector<IntVec2> binExtents;
+
+		double startSeconds = GetCurrentTimeSeconds();
+		int binCount = PackRectsIntoBins( rectSizes, IntVec2( binSize, binSize ), methods[ methodIndex ], placements, &binExtents );
+		double packSeconds = GetCurrentTimeSeconds() - startSeconds;
+
+		// Occupancy against each bin trimmed to what it used, the way atlas pages are
+		int64_t usedBinArea = 0;
+		for( size_t binIndex = 0; binIndex < binExtents.size(); ++binIndex )
+		{
+			usedBinArea += binExtents[ binIndex ].x * binExtents[ binIndex ].y;
+		}
+
+		float occupancy = usedBinArea > 0 ? static_cast<float>( static_cast<double>( rectArea ) / static_cast<double>( usedBinArea ) ) : 0.f;
+		double microsecondsPerRect = packSeconds * 1000000.0 / static_cast<double>( rectCount );
+		g_theConsole->PrintString( Rgba8::WHITE, "  %-10s %3i bins  %5.1f%% occupied  %8.2f us per rect", methodNames[ methodIndex ], binCount, occupancy * 100.f, microsecondsPerRect );
+	}
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include "Engine/Math/IntVec2.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include <vector>
+
+
+//---------------------------------------------------------------------------------------------------------
+enum RectPackMethod
+{
+	RECT_PACK_SHELF,		// rows left to right, each as tall as its first rect; fastest, wastes the most
+	RECT_PACK_SKYLINE,		// bottom-left against a height profile of the bin
+	RECT_PACK_MAX_RECTS,	// best short side fit against every maximal free rectangle; slowest, tightest
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Packs rectangles into one fixed size bin at load time. Rects are placed without rotation and the packer
+// only tracks where they went; padding is up to the caller (grow the size before inserting).
+//---------------------------------------------------------------------------------------------------------
+class RectPacker
+{
+public:
+	explicit RectPacker( IntVec2 const& binSize, RectPackMethod method = RECT_PACK_MAX_RECTS );
+	~RectPacker() {}
+
+	void			Reset();
+	bool			Insert( IntVec2 const& rectSize, IntVec2& out_rectMins );
+
+	IntVec2			GetBinSize() const							{ return m_binSize; }
+	IntVec2			GetUsedExtents() const						{ return m_usedExtents; }
+	int				GetPackedArea() const						{ return m_packedArea; }
+	float			GetOccupancy() const;
+
+private:
+	struct skyline_node_t
+	{
+		int x		= 0;
+		int y		= 0;
+		int width	= 0;
+	};
+
+	struct free_rect_t
+	{
+		IntVec2 mins;
+		IntVec2 size;
+	};
+
+	bool	InsertShelf( IntVec2 const& rectSize, IntVec2& out_rectMins );
+	bool	InsertSkyline( IntVec2 const& rectSize, IntVec2& out_rectMins );
+	bool	InsertMaxRects( IntVec2 const& rectSize, IntVec2& out_rectMins );
+
+	int		GetSkylineFitY( size_t nodeIndex, IntVec2 const& rectSize ) const;
+	void	AddSkylineLevel( size_t nodeIndex, IntVec2 const& rectMins, IntVec2 const& rectSize );
+	void	SplitFreeRects( IntVec2 const& usedMins, IntVec2 const& usedSize );
+	void	PruneFreeRects();
+
+private:
+	IntVec2			m_binSize;
+	RectPackMethod	m_method		= RECT_PACK_MAX_RECTS;
+	IntVec2			m_usedExtents;
+	int				m_packedArea	= 0;
+
+	// RECT_PACK_SHELF
+	IntVec2			m_shelfCursor;
+	int				m_shelfHeight	= 0;
+
+	std::vector<skyline_node_t>	m_skyline;		// RECT_PACK_SKYLINE, sorted left to right
+	std::vector<free_rect_t>	m_freeRects;	// RECT_PACK_MAX_RECTS
+	std::vector<free_rect_t>	m_newFreeRects;	// scratch, rects made by the latest split
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+struct rect_placement_t
+{
+	int		binIndex = -1;		// -1 if the rect is bigger than a bin
+	IntVec2	mins;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Packs a whole set at once, biggest first, opening a new bin whenever a rect fits in none of the open ones.
+// Placements are parallel to rectSizes; out_binExtents gets how much of each bin ended up used, so callers
+// can trim the last pages. Returns the number of bins.
+int PackRectsIntoBins( std::vector<IntVec2> const& rectSizes, IntVec2 const& binSize, RectPackMethod method, std::vector<rect_placement_t>& out_placements, std::vector<IntVec2>* out_binExtents = nullptr );
+
+// Packs random sprite-like rect sets with each method and prints occupancy and throughput
+void PrintRectPackerBenchmark( uint rectCount, int binSize );
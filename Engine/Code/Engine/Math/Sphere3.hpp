@@ -0,0 +1,16 @@
+#pragma once
+#include "Engine/Math/Vec3.hpp"
+
+
+//---------------------------------------------------------------------------------------------------------
+struct Sphere3
+{
+public:
+	Vec3	center;
+	float	radius = 0.f;
+
+public:
+	Sphere3() {}
+	Sphere3( Vec3 const& sphereCenter, float sphereRadius )	: center( sphereCenter ), radius( sphereRadius ) {}
+	~Sphere3() {}
+};
@@ -0,0 +1,170 @@
+#include "Engine/Math/StaticBoundsTree.hpp"
+#include "Engine/Math/Frustum.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include <algorithm>
+#include <math.h>
+#include <string.h>
+
+
+//---------------------------------------------------------------------------------------------------------
+static float GetCenterOnAxis( AABB3 const& bounds, int axis )
+{
+	switch( axis )
+	{
+	case 0:		return ( bounds.mins.x + bounds.maxes.x ) * 0.5f;
+	case 1:		return ( bounds.mins.y + bounds.maxes.y ) * 0.5f;
+	default:	return ( bounds.mins.z + bounds.maxes.z ) * 0.5f;
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void StretchToIncludeBounds( AABB3& bounds, AABB3 const& boundsToInclude )
+{
+	bounds.mins.x	= fminf( bounds.mins.x, boundsToInclude.mins.x );
+	bounds.mins.y	= fminf( bounds.mins.y, boundsToInclude.mins.y );
+	bounds.mins.z	= fminf( bounds.mins.z, boundsToInclude.mins.z );
+	bounds.maxes.x	= fmaxf( bounds.maxes.x, boundsToInclude.maxes.x );
+	bounds.maxes.y	= fmaxf( bounds.maxes.y, boundsToInclude.maxes.y );
+	bounds.maxes.z	= fmaxf( bounds.maxes.z, boundsToInclude.maxes.z );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void StaticBoundsTree::Build( AABB3 const* bounds, uint count )
+{
+	Clear();
+	if( count == 0 )
+		return;
+
+	// Sorted so mins <= maxes, since some callers build boxes with a flipped z
+	m_itemBounds.resize( count );
+	m_itemIndices.resize( count );
+	for( uint itemIndex = 0; itemIndex < count; ++itemIndex )
+	{
+		AABB3 const& source = bounds[ itemIndex ];
+		m_itemBounds[ itemIndex ] = AABB3(	fminf( source.mins.x, source.maxes.x ), fminf( source.mins.y, source.maxes.y ), fminf( source.mins.z, source.maxes.z ),
+											fmaxf( source.mins.x, source.maxes.x ), fmaxf( source.mins.y, source.maxes.y ), fmaxf( source.mins.z, source.maxes.z ) );
+		m_itemIndices[ itemIndex ] = itemIndex;
+	}
+
+	m_nodes.reserve( ( 2 * count ) / LEAF_BOUNDS_COUNT + 1 );
+	BuildNode( 0, count );
+
+	// Reorder the bounds to match m_itemIndices so leaves read them contiguously
+	std::vector<AABB3> boundsInTreeOrder( count );
+	for( uint itemIndex = 0; itemIndex < count; ++itemIndex )
+	{
+		boundsInTreeOrder[ itemIndex ] = m_itemBounds[ m_itemIndices[ itemIndex ] ];
+	}
+	m_itemBounds.swap( boundsInTreeOrder );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void StaticBoundsTree::Clear()
+{
+	m_nodes.clear();
+	m_itemIndices.clear();
+	m_itemBounds.clear();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// m_itemBounds is still in input order while building; m_itemIndices is what gets partitioned
+//---------------------------------------------------------------------------------------------------------
+uint StaticBoundsTree::BuildNode( uint firstItem, uint itemCount )
+{
+	uint nodeIndex = static_cast<uint>( m_nodes.size() );
+	m_nodes.push_back( node_t() );
+
+	AABB3 nodeBounds = m_itemBounds[ m_itemIndices[ firstItem ] ];
+	AABB3 centerBounds( nodeBounds.GetCenter(), nodeBounds.GetCenter() );
+	for( uint itemIndex = firstItem + 1; itemIndex < firstItem + itemCount; ++itemIndex )
+	{
+		AABB3 const& itemBounds = m_itemBounds[ m_itemIndices[ itemIndex ] ];
+		StretchToIncludeBounds( nodeBounds, itemBounds );
+
+		Vec3 itemCenter = itemBounds.GetCenter();
+		StretchToIncludeBounds( centerBounds, AABB3( itemCenter, itemCenter ) );
+	}
+
+	m_nodes[ nodeIndex ].bounds		= nodeBounds;
+	m_nodes[ nodeIndex ].firstItem	= firstItem;
+	m_nodes[ nodeIndex ].itemCount	= itemCount;
+
+	if( itemCount <= LEAF_BOUNDS_COUNT )
+	{
+		return nodeIndex;
+	}
+
+	Vec3 centerSpread = centerBounds.GetDimensions();
+	int splitAxis = 0;
+	if( centerSpread.y > centerSpread.x && centerSpread.y >= centerSpread.z )
+	{
+		splitAxis = 1;
+	}
+	else if( centerSpread.z > centerSpread.x && centerSpread.z > centerSpread.y )
+	{
+		splitAxis = 2;
+	}
+
+	// Median split keeps the tree balanced: depth is about log2( count / LEAF_BOUNDS_COUNT ), well inside
+	// MAX_TREE_DEPTH for any uint count
+	uint firstHalfCount = itemCount / 2;
+	std::vector<AABB3> const& itemBounds = m_itemBounds;
+	std::nth_element( m_itemIndices.begin() + firstItem, m_itemIndices.begin() + firstItem + firstHalfCount, m_itemIndices.begin() + firstItem + itemCount,
+		[&itemBounds, splitAxis]( uint lhs, uint rhs ) { return GetCenterOnAxis( itemBounds[ lhs ], splitAxis ) < GetCenterOnAxis( itemBounds[ rhs ], splitAxis ); } );
+
+	BuildNode( firstItem, firstHalfCount );
+	uint secondChildIndex = BuildNode( firstItem + firstHalfCount, itemCount - firstHalfCount );
+	m_nodes[ nodeIndex ].secondChildIndex = secondChildIndex;
+	return nodeIndex;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+uint StaticBoundsTree::CullVisible( Frustum const& frustum, uint* out_visibleIndices ) const
+{
+	if( m_nodes.empty() )
+		return 0;
+
+	uint visibleCount = 0;
+	uint nodeStack[ MAX_TREE_DEPTH ];
+	uint stackSize = 0;
+	nodeStack[ stackSize++ ] = 0;
+
+	while( stackSize > 0 )
+	{
+		uint nodeIndex = nodeStack[ --stackSize ];
+		node_t const& node = m_nodes[ nodeIndex ];
+
+		FrustumOverlap overlap = frustum.ClassifyAABB3( node.bounds );
+		if( overlap == FRUSTUM_OUTSIDE )
+		{
+			continue;
+		}
+
+		if( overlap == FRUSTUM_INSIDE )
+		{
+			memcpy( out_visibleIndices + visibleCount, &m_itemIndices[ node.firstItem ], node.itemCount * sizeof( uint ) );
+			visibleCount += node.itemCount;
+			continue;
+		}
+
+		if( node.secondChildIndex == 0 )
+		{
+			uint leafVisibleIndices[ LEAF_BOUNDS_COUNT ];
+			uint leafVisibleCount = frustum.CullAABB3s( &m_itemBounds[ node.firstItem ], node.itemCount, leafVisibleIndices );
+			for( uint leafIndex = 0; leafIndex < leafVisibleCount; ++leafIndex )
+			{
+				out_visibleIndices[ visibleCount++ ] = m_itemIndices[ node.firstItem + leafVisibleIndices[ leafIndex ] ];
+			}
+			continue;
+		}
+
+		nodeStack[ stackSize++ ] = node.secondChildIndex;
+		nodeStack[ stackSize++ ] = nodeIndex + 1;
+	}
+	return visibleCount;
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include <vector>
+
+struct Frustum;
+
+
+//---------------------------------------------------------------------------------------------------------
+// Bounding volume hierarchy over bounds that don't move (level geometry, props, map chunks). Built once by
+// median splits along the longest axis. A query rejects or accepts a whole subtree with one box test and
+// only tests individual bounds in leaves that straddle a frustum plane.
+//
+// CullVisible writes the original indices of the visible bounds (in tree order, not input order) into
+// out_visibleIndices, which must have room for GetBoundsCount() entries.
+//---------------------------------------------------------------------------------------------------------
+class StaticBoundsTree
+{
+public:
+	StaticBoundsTree() {}
+	~StaticBoundsTree() {}
+
+	void	Build( AABB3 const* bounds, uint count );
+	void	Clear();
+
+	uint	CullVisible( Frustum const& frustum, uint* out_visibleIndices ) const;
+
+	uint	GetBoundsCount() const			{ return static_cast<uint>( m_itemIndices.size() ); }
+	uint	GetNodeCount() const			{ return static_cast<uint>( m_nodes.size() ); }
+
+public:
+	static constexpr uint LEAF_BOUNDS_COUNT	= 8;
+	static constexpr uint MAX_TREE_DEPTH	= 64;	// traversal stack size
+
+private:
+	// Nodes are depth-first, so a node's first child is always the next node. Every node owns the
+	// contiguous item range of its whole subtree, which is what lets a fully inside node be emitted at once.
+	struct node_t
+	{
+		AABB3	bounds;
+		uint	firstItem			= 0;
+		uint	itemCount			= 0;
+		uint	secondChildIndex	= 0;	// 0 for a leaf
+	};
+
+	uint	BuildNode( uint firstItem, uint itemCount );
+
+private:
+	std::vector<node_t>		m_nodes;
+	std::vector<uint>		m_itemIndices;
+	std::vector<AABB3>		m_itemBounds;		// in tree order, parallel to m_itemIndices
+};
@@ -1,9 +1,10 @@
 #include "Engine/Network/NetworkMessages.hpp"
+#include "Engine/Core/BlockPool.hpp"
 
 //---------------------------------------------------------------------------------------------------------
+// Packet payloads come and go every network tick, so they are drawn from the block pools
 UDPPacket::UDPPacket()
 {
-	m_data = new unsigned char[0];
 }
 
 //---------------------------------------------------------------------------------------------------------
@@ -11,7 +12,7 @@ UDPPacket::UDPPacket( UDPMessageHeader const& messageHeader, uint size )
 {
 	m_header = messageHeader;
 	m_size = static_cast<uint16_t>( size );
-	m_data = new unsigned char[size];
+	AllocateData();
 }
 
 //---------------------------------------------------------------------------------------------------------
@@ -21,40 +22,58 @@ UDPPacket::UDPPacket( UDPPacket const& copyFrom )
 	m_header = copyFrom.m_header;
 	m_size = copyFrom.m_size;
 
-	if( m_data != nullptr )
+	AllocateData();
+	if( m_size > 0 )
 	{
-		delete[] m_data;
-		m_data = nullptr;
+		memcpy( &m_data[0], &copyFrom.m_data[0], m_size );
 	}
-	m_data = new unsigned char[m_size];
-	memcpy( &m_data[0], &copyFrom.m_data[0], m_size );
 }
 
 //---------------------------------------------------------------------------------------------------------
 UDPPacket::~UDPPacket()
 {
-	if( m_data != nullptr )
-	{
-		delete[] m_data;
-		m_data = nullptr;
-	}
+	FreeData();
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 void UDPPacket::operator=( UDPPacket const& copyFrom )
 {
+	if( this == &copyFrom )
+		return;
+
 	m_numMessagesUnpacked = copyFrom.m_numMessagesUnpacked;
 	m_header = copyFrom.m_header;
-	m_size = copyFrom.m_size;
 
+	if( m_size != copyFrom.m_size )
+	{
+		FreeData();
+		m_size = copyFrom.m_size;
+		AllocateData();
+	}
+
+	if( m_size > 0 )
+	{
+		memcpy( &m_data[0], &copyFrom.m_data[0], m_size );
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void UDPPacket::AllocateData()
+{
+	m_data = m_size > 0 ? static_cast<unsigned char*>( PoolAllocate( m_size ) ) : nullptr;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void UDPPacket::FreeData()
+{
 	if( m_data != nullptr )
 	{
-		delete[] m_data;
+		PoolFree( m_data, m_size );
 		m_data = nullptr;
 	}
-	m_data = new unsigned char[m_size];
-	memcpy( &m_data[0], &copyFrom.m_data[0], m_size );
 }
 
 
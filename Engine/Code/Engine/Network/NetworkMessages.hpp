@@ -68,4 +68,8 @@ public:
 	void operator=( UDPPacket const& copyFrom );
 
 	bool IsReadyToRead() const { return m_header.m_numMessages == m_numMessagesUnpacked; }
+
+private:
+	void AllocateData();
+	void FreeData();
 };
\ No newline at end of file
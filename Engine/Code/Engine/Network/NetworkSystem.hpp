@@ -1,12 +1,12 @@
 #pragma once
 #include "Engine/Network/TCPSocket.hpp"
 #include "Engine/Core/EventSystem.hpp"
-#include "Engine/Core/SynchronizedNonBlockingQueue.hpp"
 #include "Engine/Network/NetworkMessages.hpp"
 #include <ws2tcpip.h>
 #include <winsock2.h>
 #include <string>
 #include <vector>
+#include <deque>
 
 enum TCPMode
 {
@@ -3,6 +3,7 @@
 #include "Engine/Core/StringUtils.hpp"
 #include "Engine/Network/UDPSocket.hpp"
 #include "Engine/Network/NetworkSystem.hpp"
+#include <iterator>
 
 #define TEST_MODE
 #ifdef TEST_MODE
@@ -14,6 +15,8 @@
 
 //---------------------------------------------------------------------------------------------------------
 UDPSocket::UDPSocket( NetworkSystem* owner, std::string const& host, int receivePort, int sendToPort )
+	: m_UDPMessagesToReceive( UDP_MESSAGE_QUEUE_CAPACITY )
+	, m_UDPMessagesToSend( UDP_MESSAGE_QUEUE_CAPACITY )
 {
 	m_owner = owner;
 
@@ -47,7 +50,11 @@ UDPSocket::~UDPSocket()
 //---------------------------------------------------------------------------------------------------------
 void UDPSocket::SendMessage( UDPMessage const& message, bool isOldMessage )
 {
-	m_UDPMessagesToSend.Push( message );
+	if( !m_UDPMessagesToSend.Push( message ) )
+	{
+		// Same outcome as the packet being lost on the wire; reliable messages get resent
+		LOG_ERROR( "UDP send queue full, message dropped" );
+	}
 
 	if( message.m_header.m_isReliable && !isOldMessage )
 	{
@@ -70,7 +77,7 @@ bool UDPSocket::ReadMessage( UDPMessage& message )
 //---------------------------------------------------------------------------------------------------------
 void UDPSocket::GetMessages( std::deque<UDPMessage>& out_messages )
 {
-	m_UDPMessagesToReceive.Swap( out_messages );
+	m_UDPMessagesToReceive.PopBatch( std::back_inserter( out_messages ), m_UDPMessagesToReceive.GetCapacity() );
 }
 
 
@@ -115,6 +122,7 @@ void UDPSocket::Close()
 void UDPSocket::StopThreads()
 {
 	m_isUDPSocketQuitting = true;
+	m_UDPMessagesToSend.WakeWaiters();
 
 	m_readThread.join();
 	m_sendThread.join();
@@ -197,7 +205,10 @@ void UDPSocket::UDPReceiveMessagesJob()
 			UDPMessage messageToReceive;
 			messageToReceive = *reinterpret_cast<UDPMessage*>( &buffer[0] );
 			//memcpy( &messageToReceive, &buffer[0], MAX_UDP_MESSAGE_SIZE );
-			m_UDPMessagesToReceive.Push( messageToReceive );
+			if( !m_UDPMessagesToReceive.Push( messageToReceive ) )
+			{
+				LOG_ERROR( "UDP receive queue full, message dropped" );
+			}
 		}
 		else
 		{
@@ -213,16 +224,12 @@ void UDPSocket::UDPSendMessagesJob()
 	while( !m_isUDPSocketQuitting )
 	{
 		UDPMessage messageToSend;
-		if( m_UDPMessagesToSend.Pop( messageToSend ) )
+		if( m_UDPMessagesToSend.PopWait( messageToSend, 0.01 ) )
 		{
 			Buffer& buffer = SendBuffer();
 			buffer = *reinterpret_cast<Buffer*>( &messageToSend );
 			//memcpy( &buffer[0], &messageToSend, MAX_UDP_MESSAGE_SIZE );
 			Send( MAX_UDP_MESSAGE_SIZE );
 		}
-		else
-		{
-			std::this_thread::sleep_for( std::chrono::microseconds(10) );
-		}
 	}
 }
@@ -4,7 +4,7 @@
 #define _WINSOCK_DEPRECATED_NO_WARNINGS
 #endif
 
-#include "Engine/Core/SynchronizedNonBlockingQueue.hpp"
+#include "Engine/Core/LockFreeQueue.hpp"
 #include "Engine/Network/NetworkMessages.hpp"
 #include <WinSock2.h>
 #include <limits>
@@ -12,7 +12,9 @@
 #include <array>
 #include <thread>
 #include <deque>
+#include <atomic>
 constexpr int BufferSize = 512;
+constexpr size_t UDP_MESSAGE_QUEUE_CAPACITY = 256;
 typedef std::array<char, BufferSize> Buffer;
 
 
@@ -55,11 +57,11 @@ private:
 private:
 	NetworkSystem* m_owner = nullptr;
 
-	bool		m_isUDPSocketQuitting = false;
+	std::atomic<bool>	m_isUDPSocketQuitting = false;
 	std::thread m_readThread;
 	std::thread m_sendThread;
-	SynchronizedNonBlockingQueue<UDPMessage> m_UDPMessagesToReceive;
-	SynchronizedNonBlockingQueue<UDPMessage> m_UDPMessagesToSend;
+	SPSCQueue<UDPMessage> m_UDPMessagesToReceive;	// read thread -> game thread
+	MPSCQueue<UDPMessage> m_UDPMessagesToSend;		// any thread -> send thread
 
 	std::vector<UDPMessage> m_reliableMessages;
 
@@ -9,6 +9,7 @@
 #include "Engine/Math/Vec3.hpp"
 #include "Engine/Math/Vec4.hpp"
 #include "Engine/Math/Plane2D.hpp"
+#include "Engine/Core/StlAllocators.hpp"
 
 
 //---------------------------------------------------------------------------------------------------------
@@ -192,8 +193,8 @@ static bool PolygonVPolygonManifoldGeneration( Collider2D const* col0, Collider2
 	PolygonCollider2D const* polygon0 = (PolygonCollider2D*)col0;
 	PolygonCollider2D const* polygon1 = (PolygonCollider2D*)col1;
 
-	Polygon2D polygonA = polygon0->m_worldPolygon; //me
-	Polygon2D polygonB = polygon1->m_worldPolygon; //them
+	Polygon2D const& polygonA = polygon0->m_worldPolygon; //me
+	Polygon2D const& polygonB = polygon1->m_worldPolygon; //them
 
 	float penetration = 0.f;
 	Vec2 collisionNormal;
@@ -266,16 +267,7 @@ static bool PolygonVPolygonManifoldGeneration( Collider2D const* col0, Collider2
 		}
 		else
 		{
-			std::vector<Vec2> tempSimplex;
-			for( int simplexIndex = 0; simplexIndex < simplex.size(); ++simplexIndex )
-			{
-				tempSimplex.push_back( simplex[ simplexIndex ] );
-				if( simplexIndex == edgeStartIndex )
-				{
-					tempSimplex.push_back( simplexSupport );
-				}
-			}
-			simplex = tempSimplex;
+			simplex.insert( simplex.begin() + edgeStartIndex + 1, simplexSupport );
 		}
 	}
 
@@ -321,7 +313,8 @@ static bool PolygonVPolygonManifoldGeneration( Collider2D const* col0, Collider2
 	Vec2 cullingSegmentNormal = ( maxCullingPoint - minCullingPoint ).GetNormalized();
 	cullingSegmentNormal.RotateMinus90Degrees();
 
-	std::vector<Vec2> contacts;
+	FrameVector<Vec2> contacts;
+	contacts.reserve( polygonA.GetEdgeCount() * 2 );
 	for( int polygonAEdgeIndex = 0; polygonAEdgeIndex < polygonA.GetEdgeCount(); ++polygonAEdgeIndex )
 	{
 		Vec2 segmentStart;
@@ -2,12 +2,13 @@
 #include "Engine/Math/Vec2.hpp"
 #include "Engine/Math/IntVec2.hpp"
 #include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/BlockPool.hpp"
 
 class	Collider2D;
 struct	Manifold2;
 
 //---------------------------------------------------------------------------------------------------------
-struct Manifold2
+struct Manifold2 : public PoolAllocated
 {
 	Vec2 collisionEdgeStart;
 	Vec2 collisionEdgeEnd;
@@ -23,7 +24,8 @@ public:
 
 
 //---------------------------------------------------------------------------------------------------------
-struct Collision2D
+// Collisions are compared against the previous frame's, so they outlive a frame arena; pooled instead
+struct Collision2D : public PoolAllocated
 {
 public:
 	uint frameIndex = 0;
@@ -1,6 +1,5 @@
 #include "Engine/Physics/DiscCollider2D.hpp"
 #include "Engine/Physics/Physics2D.hpp"
-#include "Engine/Renderer/RenderContext.hpp"
 #include "Engine/Core/Rgba8.hpp"
 #include "Engine/Renderer/MeshUtils.hpp"
 #include "Engine/Math/MathUtils.hpp"
@@ -9,6 +8,11 @@
 #include "Engine/Physics/PolygonCollider2D.hpp"
 #include "Engine/Math/Polygon2D.hpp"
 #include "Engine/Physics/Collision2D.hpp"
+#include "Engine/Platform/Platform.hpp"
+
+#if !defined( ENGINE_HEADLESS )
+#include "Engine/Renderer/RenderContext.hpp"
+#endif
 
 
 //---------------------------------------------------------------------------------------------------------
@@ -100,9 +104,14 @@ void DiscCollider2D::DebugRender( RenderContext* context, Rgba8 const& borderCol
 	TransformVertexArray( debugVerts, 1.f, roationDegrees, m_worldPosition );
 	//AppendVertsForAABB2OutlineAtPoint( debugVerts, m_worldBounds, Rgba8::CYAN, 3.f );
 
+#if defined( ENGINE_HEADLESS )
+	UNUSED( context );
+	UNUSED( debugVerts );
+#else
 	context->BindTexture( nullptr );
 	context->BindShader( (Shader*)nullptr );
 	context->DrawVertexArray( debugVerts );
+#endif
 }
 
 
@@ -11,11 +11,18 @@
 #include "Engine/Math/Vec3.hpp"
 
 
+//---------------------------------------------------------------------------------------------------------
+static void QueuePhysicsStep( void* userData )
+{
+	Physics2D* physics = static_cast<Physics2D*>( userData );
+	physics->m_pendingStepCount++;
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 Physics2D::Physics2D( Clock* gameClock )
 {
 	SetClock( gameClock );
-	m_stepTimer.SetSeconds( gameClock, m_fixedDeltaTime );
 
 	for( uint layerIndex = 0; layerIndex < 32; ++layerIndex )
 	{
@@ -27,6 +34,8 @@ Physics2D::Physics2D( Clock* gameClock )
 //---------------------------------------------------------------------------------------------------------
 Physics2D::~Physics2D()
 {
+	m_clock->CancelTimer( m_stepTimer );
+
 	for( int frameCollisionIndex = 0; frameCollisionIndex < m_frameCollisions.size(); ++frameCollisionIndex )
 	{
 		delete m_frameCollisions[frameCollisionIndex];
@@ -51,9 +60,11 @@ void Physics2D::BeginFrame()
 //---------------------------------------------------------------------------------------------------------
 void Physics2D::Update()
 {
-	int numberOfSteps = m_stepTimer.CheckAndDecrementAll();
+	// The step timer repeats on the physics clock, which has already been advanced this frame
+	uint numberOfSteps = m_pendingStepCount;
+	m_pendingStepCount = 0;
 
-	for( int stepCount = 0; stepCount < numberOfSteps; ++stepCount )
+	for( uint stepCount = 0; stepCount < numberOfSteps; ++stepCount )
 	{
 		AdvanceSimulation( static_cast<float>( m_fixedDeltaTime ) );
 		++m_currentFrameIndex;
@@ -589,11 +600,18 @@ void Physics2D::ApplyDragOnRigidbodies()
 //---------------------------------------------------------------------------------------------------------
 void Physics2D::SetClock( Clock* clock )
 {
+	if( m_clock != nullptr )
+	{
+		m_clock->CancelTimer( m_stepTimer );
+	}
+
 	m_clock = clock;
 	if( clock == nullptr )
 	{
 		m_clock = Clock::GetMaster();
 	}
+
+	ScheduleStepTimer();
 }
 
 
@@ -622,7 +640,16 @@ void Physics2D::SetClockScale( double clockScale )
 void Physics2D::SetFixedDeltaTime( double newFixedDeltaTime )
 {
 	m_fixedDeltaTime = newFixedDeltaTime;
-	m_stepTimer.SetSeconds( newFixedDeltaTime );
+	m_clock->CancelTimer( m_stepTimer );
+	ScheduleStepTimer();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void Physics2D::ScheduleStepTimer()
+{
+	m_pendingStepCount = 0;
+	m_stepTimer = m_clock->ScheduleCallback( m_fixedDeltaTime, QueuePhysicsStep, this, true );
 }
 
 
@@ -1,6 +1,6 @@
 #pragma once
 #include "Engine/Math/Vec2.hpp"
-#include "Engine/Core/Timer.hpp"
+#include "Engine/Core/TimerWheel.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include <vector>
 
@@ -50,6 +50,7 @@ public:
 	void SetFixedDeltaTime( double newFixedDeltaTime );
 	void ToggleClockPause();
 	void SetClockScale( double clockScale );
+	void ScheduleStepTimer();
 
 	float	GetGravityAmount() const	{ return m_gravityAcceleration.y; }
 	double	GetFixedDeltaTime() const	{ return m_fixedDeltaTime; }
@@ -67,7 +68,8 @@ public:
 
 public:
 	Clock* m_clock = nullptr;
-	Timer m_stepTimer;
+	TimerHandle m_stepTimer;
+	uint m_pendingStepCount = 0;
 	double m_fixedDeltaTime = 1.0 / 120.0;
 
 	Vec2 m_gravityAcceleration = Vec2( 0.0f, -9.81f );
@@ -1,6 +1,5 @@
 #include "Engine/Physics/PolygonCollider2D.hpp"
 #include "Engine/Physics/Physics2D.hpp"
-#include "Engine/Renderer/RenderContext.hpp"
 #include "Engine/Core/Rgba8.hpp"
 #include "Engine/Renderer/MeshUtils.hpp"
 #include "Engine/Math/MathUtils.hpp"
@@ -8,6 +7,11 @@
 #include "Engine/Physics/Rigidbody2D.hpp"
 #include "Engine/Physics/DiscCollider2D.hpp"
 #include "Engine/Physics/PhysicsMaterial.hpp"
+#include "Engine/Platform/Platform.hpp"
+
+#if !defined( ENGINE_HEADLESS )
+#include "Engine/Renderer/RenderContext.hpp"
+#endif
 
 
 //---------------------------------------------------------------------------------------------------------
@@ -236,9 +240,14 @@ void PolygonCollider2D::DebugRender( RenderContext* context, Rgba8 const& border
 	//AppendVertsForCircleAtPoint( debugVerts, m_worldBoundsCenter, m_worldBoundsRadius, Rgba8::CYAN, 3.f );
 	//AppendVertsForAABB2OutlineAtPoint( debugVerts, m_worldBounds, Rgba8::CYAN, 3.f );
 
+#if defined( ENGINE_HEADLESS )
+	UNUSED( context );
+	UNUSED( debugVerts );
+#else
 	context->BindTexture( nullptr );
 	context->BindShader( (Shader*)nullptr );
 	context->DrawVertexArray( debugVerts );
+#endif
 }
 
 
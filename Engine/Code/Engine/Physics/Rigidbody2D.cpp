@@ -2,11 +2,15 @@
 #include "Engine/Physics/Rigidbody2D.hpp"
 #include "Engine/Physics/Collider2D.hpp"
 #include "Engine/Physics/Physics2D.hpp"
-#include "Engine/Renderer/RenderContext.hpp"
 #include "Engine/Renderer/MeshUtils.hpp"
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Math/Vec3.hpp"
 #include "Engine/Core/DebugRender.hpp"
+#include "Engine/Platform/Platform.hpp"
+
+#if !defined( ENGINE_HEADLESS )
+#include "Engine/Renderer/RenderContext.hpp"
+#endif
 
 //---------------------------------------------------------------------------------------------------------
 void Rigidbody2D::Destroy()
@@ -302,9 +306,14 @@ void Rigidbody2D::DebugRender( RenderContext* context ) const
 	AppendVertsForLineBetweenPoints( vertexArray, start1, end1, xColor, 0.03f );
 	AppendVertsForLineBetweenPoints( vertexArray, start2, end2, xColor, 0.03f );
 
+#if defined( ENGINE_HEADLESS )
+	UNUSED( context );
+	UNUSED( vertexArray );
+#else
 	context->BindTexture( nullptr );
 	context->BindShader( (Shader*)nullptr );
 	context->DrawVertexArray( vertexArray );
+#endif
 }
 
 
@@ -2,6 +2,7 @@
 #include "Engine/Math/Vec2.hpp"
 
 class	Collider2D;
+class	Physics2D;
 class	RenderContext;
 
 enum SimulationMode
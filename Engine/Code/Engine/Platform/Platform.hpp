@@ -0,0 +1,75 @@
+#pragma once
+#include <stddef.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+
+
+//---------------------------------------------------------------------------------------------------------
+// Only Windows has a window, renderer and input devices. Everywhere else the engine builds headless: Core,
+// Math, Physics, Input (fed by SetFromInputState / InputPlayback) and game simulation, for tests and
+// benchmarks on the Linux build farm.
+//---------------------------------------------------------------------------------------------------------
+#if defined( _WIN32 )
+	#define PLATFORM_WINDOWS
+#else
+	#define PLATFORM_POSIX
+	#define ENGINE_HEADLESS
+#endif
+
+
+//---------------------------------------------------------------------------------------------------------
+// POSIX stand-ins for the MSVC CRT calls the engine uses, with the same truncate-and-terminate behaviour
+//---------------------------------------------------------------------------------------------------------
+#if defined( PLATFORM_POSIX )
+#include <stdlib.h>
+#include <strings.h>
+
+#ifndef _TRUNCATE
+#define _TRUNCATE ( (size_t)-1 )
+#endif
+
+
+//---------------------------------------------------------------------------------------------------------
+inline int vsnprintf_s( char* buffer, size_t bufferSize, size_t maxCount, char const* format, va_list args )
+{
+	size_t writeLimit = ( maxCount < bufferSize ) ? maxCount + 1 : bufferSize;
+	int fullLength = vsnprintf( buffer, writeLimit, format, args );
+	return ( fullLength < 0 || static_cast<size_t>( fullLength ) >= writeLimit ) ? -1 : fullLength;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+inline int strncpy_s( char* destination, size_t destinationSize, char const* source, size_t maxCount )
+{
+	size_t copyLength = strnlen( source, maxCount < destinationSize ? maxCount : destinationSize - 1 );
+	memcpy( destination, source, copyLength );
+	destination[ copyLength ] = '\0';
+	return 0;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+inline int strcpy_s( char* destination, size_t destinationSize, char const* source )
+{
+	return strncpy_s( destination, destinationSize, source, _TRUNCATE );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+inline int fopen_s( FILE** out_file, char const* filepath, char const* mode )
+{
+	*out_file = fopen( filepath, mode );
+	return ( *out_file != nullptr ) ? 0 : -1;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+inline int _stricmp( char const* a, char const* b )						{ return strcasecmp( a, b ); }
+inline void* _aligned_malloc( size_t byteCount, size_t alignment )			{ return aligned_alloc( alignment, ( byteCount + alignment - 1 ) & ~( alignment - 1 ) ); }
+inline void _aligned_free( void* memory )									{ free( memory ); }
+
+#define _ReturnAddress() __builtin_return_address( 0 )
+#define __debugbreak() __builtin_trap()
+
+#endif
@@ -3,7 +3,9 @@
 #include "Engine/Input/InputSystem.hpp"
 #include "Engine/Core/EventSystem.hpp"
 #include "Engine/Math/AABB2.hpp"
+#include "Engine/Platform/Platform.hpp"
 
+#if defined( PLATFORM_WINDOWS )
 #define WIN32_LEAN_AND_MEAN
 #include <Windows.h>
 
@@ -250,6 +252,61 @@ void Window::Close()
 	m_hwnd = nullptr;
 }
 
+#else
+
+
+//---------------------------------------------------------------------------------------------------------
+// Headless: no OS window and nothing to pump. The client area is sized as if on a 1080p desktop so
+// cameras and UI laid out from it behave the same; input arrives through InputSystem::SetFromInputState.
+//---------------------------------------------------------------------------------------------------------
+constexpr float HEADLESS_DESKTOP_WIDTH	= 1920.f;
+constexpr float HEADLESS_DESKTOP_HEIGHT	= 1080.f;
+
+
+//---------------------------------------------------------------------------------------------------------
+Window::Window()
+	: m_hwnd( nullptr )
+{
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+Window::~Window()
+{
+	Close();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool Window::Open( std::string const& title, float clientAspect, float ratioOfHeight )
+{
+	UNUSED( title );
+
+	float desktopAspect = HEADLESS_DESKTOP_WIDTH / HEADLESS_DESKTOP_HEIGHT;
+	float clientWidth = HEADLESS_DESKTOP_WIDTH * ratioOfHeight;
+	float clientHeight = HEADLESS_DESKTOP_HEIGHT * ratioOfHeight;
+	if( clientAspect > desktopAspect )
+	{
+		clientHeight = clientWidth / clientAspect;
+	}
+	else
+	{
+		clientWidth = clientHeight * clientAspect;
+	}
+
+	m_height = static_cast<unsigned int>( clientHeight );
+	m_width = static_cast<unsigned int>( clientWidth );
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void Window::Close()
+{
+}
+
+#endif
+
 
 //---------------------------------------------------------------------------------------------------------
 void Window::SetInputSystem( InputSystem* input )
@@ -274,6 +331,7 @@ void Window::SetIsQuitting( bool isQuitting )
 }
 
 
+#if defined( PLATFORM_WINDOWS )
 //---------------------------------------------------------------------------------------------------------
 Vec2 Window::GetClientCenter() const
 {
@@ -330,4 +388,28 @@ void Window::BeginFrame()
 		TranslateMessage( &queuedMessage );
 		DispatchMessage( &queuedMessage ); // This tells Windows to call our "WindowsMessageHandlingProcedure" (a.k.a. "WinProc") function
 	}
-}
\ No newline at end of file
+}
+
+#else
+
+
+//---------------------------------------------------------------------------------------------------------
+Vec2 Window::GetClientCenter() const
+{
+	return Vec2( static_cast<float>( m_width ) * 0.5f, static_cast<float>( m_height ) * 0.5f );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+AABB2 Window::GetBoundsAsAABB2() const
+{
+	return AABB2( 0.f, 0.f, static_cast<float>( m_width ), static_cast<float>( m_height ) );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void Window::BeginFrame()
+{
+}
+
+#endif
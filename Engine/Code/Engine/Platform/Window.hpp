@@ -1,9 +1,10 @@
 #pragma once
-#include <string.h>
+#include <string>
 
 class InputSystem;
 class EventSystem;
 struct AABB2;
+struct Vec2;
 
 class Window
 {
@@ -0,0 +1,80 @@
+#include "Engine/Renderer/AssetLoadJobs.hpp"
+#include "Engine/Renderer/RenderContext.hpp"
+#include "Engine/Renderer/Shader.hpp"
+#include "Engine/Core/Image.hpp"
+#include "Engine/Core/FileUtils.hpp"
+
+
+//---------------------------------------------------------------------------------------------------------
+TextureLoadJob::TextureLoadJob( RenderContext* context, AssetHandle textureHandle, std::string const& imageFilePath )
+	: AsyncLoadJob( JOB_CATEGORY_RENDER_ASSET_LOADING, imageFilePath )
+	, m_context( context )
+	, m_textureHandle( textureHandle )
+{
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+TextureLoadJob::~TextureLoadJob()
+{
+	delete m_image;
+	m_image = nullptr;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void TextureLoadJob::ExecuteLoad()
+{
+	m_image = new Image( m_filepath.c_str(), true );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void TextureLoadJob::FinalizeLoad()
+{
+	m_context->FinalizeAsyncTextureLoad( m_textureHandle, *m_image );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+//---------------------------------------------------------------------------------------------------------
+MeshLoadJob::MeshLoadJob( RenderContext* context, AssetHandle meshHandle, std::string const& objFilePath, mesh_import_options_t const& options )
+	: AsyncLoadJob( JOB_CATEGORY_RENDER_ASSET_LOADING, objFilePath )
+	, m_context( context )
+	, m_meshHandle( meshHandle )
+	, m_options( options )
+{
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void MeshLoadJob::ExecuteLoad()
+{
+	ReadAndParseObjFile( m_filepath, m_verticies, &m_subMeshVertOffsets );
+	MeshLoadToVertexArray( m_verticies, m_options );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void MeshLoadJob::FinalizeLoad()
+{
+	m_context->FinalizeAsyncMeshLoad( m_meshHandle, m_verticies, m_subMeshVertOffsets );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+//---------------------------------------------------------------------------------------------------------
+ShaderCompileJob::ShaderCompileJob( RenderContext* context, AssetHandle shaderHandle, std::string const& shaderFilePath, uint compileGeneration )
+	: ShaderProgramCompileJob( context->GetShaderCache(), Shader::MakeCompileDesc( shaderFilePath, "", 0, SHADER_TYPE_VERTEX ) )
+	, m_context( context )
+	, m_shaderHandle( shaderHandle )
+	, m_compileGeneration( compileGeneration )
+{
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void ShaderCompileJob::FinalizeLoad()
+{
+	m_context->FinalizeAsyncShaderCompile( m_shaderHandle, m_compileGeneration, m_vertexResult, m_fragmentResult );
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include "Engine/Core/AsyncLoadJob.hpp"
+#include "Engine/Core/AssetRegistry.hpp"
+#include "Engine/Core/Vertex_PCUTBN.hpp"
+#include "Engine/Renderer/MeshUtils.hpp"
+#include "Engine/Renderer/ShaderCache.hpp"
+#include <vector>
+
+class RenderContext;
+struct Image;
+
+
+//---------------------------------------------------------------------------------------------------------
+class TextureLoadJob : public AsyncLoadJob
+{
+public:
+	TextureLoadJob( RenderContext* context, AssetHandle textureHandle, std::string const& imageFilePath );
+	~TextureLoadJob();
+
+protected:
+	virtual void ExecuteLoad() override;
+	virtual void FinalizeLoad() override;
+
+private:
+	RenderContext*	m_context		= nullptr;
+	AssetHandle		m_textureHandle;
+	Image*			m_image			= nullptr;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+class MeshLoadJob : public AsyncLoadJob
+{
+public:
+	MeshLoadJob( RenderContext* context, AssetHandle meshHandle, std::string const& objFilePath, mesh_import_options_t const& options );
+
+protected:
+	virtual void ExecuteLoad() override;
+	virtual void FinalizeLoad() override;
+
+private:
+	RenderContext*				m_context	= nullptr;
+	AssetHandle					m_meshHandle;
+	mesh_import_options_t		m_options;
+	std::vector<Vertex_PCUTBN>	m_verticies;
+	std::vector<uint>			m_subMeshVertOffsets;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// The cache lookup and, on a miss, the compile run on the worker (see ShaderProgramCompileJob); FinalizeLoad
+// hands the results to the RenderContext, which swaps them into the shader.
+//---------------------------------------------------------------------------------------------------------
+class ShaderCompileJob : public ShaderProgramCompileJob
+{
+public:
+	ShaderCompileJob( RenderContext* context, AssetHandle shaderHandle, std::string const& shaderFilePath, uint compileGeneration );
+
+protected:
+	virtual void FinalizeLoad() override;
+
+private:
+	RenderContext*			m_context				= nullptr;
+	AssetHandle				m_shaderHandle;
+	uint					m_compileGeneration		= 0;
+};
@@ -1,5 +1,6 @@
 #include "Engine/Renderer/BitmapFont.hpp"
 #include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/StringUtils.hpp"
 #include "Engine/Math/Vec2.hpp"
 #include "Engine/Renderer/Texture.hpp"
 #include "Engine/Core/Vertex_PCU.hpp"
@@ -8,6 +9,7 @@
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Renderer/MeshUtils.hpp"
 #include "Engine/Math/AABB2.hpp"
+#include <cstring>
 
 
 //---------------------------------------------------------------------------------------------------------
@@ -15,6 +17,30 @@ BitmapFont::BitmapFont( const char* fontName, const Texture* fontTexture )
 	: m_fontName( fontName )
 	, m_glyphSpriteSheet( *fontTexture, IntVec2( 16, 16 ) )
 {
+	BuildGlyphMetrics();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void BitmapFont::BuildGlyphMetrics()
+{
+	int glyphCount = m_glyphSpriteSheet.GetNumSprite();
+	for( int glyphIndex = 0; glyphIndex < GLYPH_COUNT && glyphIndex < glyphCount; ++glyphIndex )
+	{
+		SpriteDefinition const& glyphDefinition = m_glyphSpriteSheet.GetSpriteDefinition( glyphIndex );
+
+		glyph_metrics_t& metrics = m_glyphMetrics[ glyphIndex ];
+		glyphDefinition.GetUVs( metrics.uvAtMins, metrics.uvAtMaxes );
+		metrics.aspect = glyphDefinition.GetAspect();
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void BitmapFont::RefreshGlyphMetrics()
+{
+	BuildGlyphMetrics();
+	ClearTextLayoutCache();
 }
 
 
@@ -26,39 +52,63 @@ const Texture* BitmapFont::GetTexture() const
 
 
 //---------------------------------------------------------------------------------------------------------
-void BitmapFont::AddVertsForText2D( std::vector<Vertex_PCU>& vertexArray, const Vec2& textMins, float cellHeight, const std::string& text, const Rgba8& tint, float cellAspect )
+void BitmapFont::AddVertsForText2D( std::vector<Vertex_PCU>& vertexArray, const Vec2& textMins, float cellHeight, const std::string& text, const Rgba8& tint, float cellAspect ) const
 {
-	Vec2 glyphMins = textMins;
-	Vec2 glyphMaxes( textMins.x, textMins.y + cellHeight );
+	uint vertexCount = GetVertexCountForText( text.length() );
+	if( vertexCount == 0 )
+		return;
 
-	Vec2 uvsAtMins;
-	Vec2 uvsAtMaxes;
+	size_t startIndex = vertexArray.size();
+	vertexArray.resize( startIndex + vertexCount );
+	WriteVertsForText2D( &vertexArray[ startIndex ], vertexCount, textMins, cellHeight, text.c_str(), text.length(), tint, cellAspect );
+}
 
-	for( int stringCharIndex = 0; stringCharIndex < text.length(); ++stringCharIndex )
-	{
-		m_glyphSpriteSheet.GetSpriteUVs( uvsAtMins, uvsAtMaxes, text[ stringCharIndex ] );
 
-		glyphMaxes.x += cellHeight * GetGlyphAspect( text[ stringCharIndex ] ) * cellAspect;
+//---------------------------------------------------------------------------------------------------------
+uint BitmapFont::WriteVertsForText2D( Vertex_PCU* out_verticies, uint maxVertexCount, const Vec2& textMins, float cellHeight, char const* text, size_t textLength, const Rgba8& tint, float cellAspect ) const
+{
+	size_t glyphCount = maxVertexCount / VERTS_PER_GLYPH;
+	if( textLength < glyphCount )
+	{
+		glyphCount = textLength;
+	}
 
-		AppendVertsForAABB2D( vertexArray, AABB2( glyphMins, glyphMaxes ), tint, uvsAtMins, uvsAtMaxes );
+	float glyphWidthScale	= cellHeight * cellAspect;
+	float glyphMinY			= textMins.y;
+	float glyphMaxY			= textMins.y + cellHeight;
+	float glyphMinX			= textMins.x;
 
-		glyphMins = Vec2( glyphMaxes.x, glyphMins.y );
+	Vertex_PCU* vertex = out_verticies;
+	for( size_t stringCharIndex = 0; stringCharIndex < glyphCount; ++stringCharIndex )
+	{
+		glyph_metrics_t const& metrics = m_glyphMetrics[ static_cast<unsigned char>( text[ stringCharIndex ] ) ];
+		float glyphMaxX = glyphMinX + ( glyphWidthScale * metrics.aspect );
+
+		// Same winding and uv layout as AppendVertsForAABB2D
+		vertex[0] = Vertex_PCU( Vec2( glyphMinX, glyphMinY ), tint, metrics.uvAtMins );
+		vertex[1] = Vertex_PCU( Vec2( glyphMaxX, glyphMinY ), tint, Vec2( metrics.uvAtMaxes.x, metrics.uvAtMins.y ) );
+		vertex[2] = Vertex_PCU( Vec2( glyphMaxX, glyphMaxY ), tint, metrics.uvAtMaxes );
+		vertex[3] = vertex[0];
+		vertex[4] = vertex[2];
+		vertex[5] = Vertex_PCU( Vec2( glyphMinX, glyphMaxY ), tint, Vec2( metrics.uvAtMins.x, metrics.uvAtMaxes.y ) );
+
+		vertex += VERTS_PER_GLYPH;
+		glyphMinX = glyphMaxX;
 	}
 
-	//TransformVertexArray( vertexArray, 1.f, 0.f, textMins );
+	return static_cast<uint>( glyphCount ) * VERTS_PER_GLYPH;
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 float BitmapFont::GetGlyphAspect( int glyphUnicode ) const
 {
-	SpriteDefinition glyphDefinition = m_glyphSpriteSheet.GetSpriteDefinition( glyphUnicode );
-	return glyphDefinition.GetAspect();
+	return m_glyphMetrics[ static_cast<unsigned char>( glyphUnicode ) ].aspect;
 }
 
 
 //---------------------------------------------------------------------------------------------------------
-void BitmapFont::AddVertsForTextInBox2D( std::vector<Vertex_PCU>& vertexArray, const AABB2& box, float cellHeight, const std::string& text, const Rgba8& tint, float cellAspect, const Vec2& alignment, const Vec2& offset )
+void BitmapFont::AddVertsForTextInBox2D( std::vector<Vertex_PCU>& vertexArray, const AABB2& box, float cellHeight, const std::string& text, const Rgba8& tint, float cellAspect, const Vec2& alignment, const Vec2& offset ) const
 {
 	Vec2 textDimensions = GetDimensionsForText2D( cellHeight, text, cellAspect );
 	Vec2 boxDimensions	= box.GetDimensions();
@@ -72,16 +122,95 @@ void BitmapFont::AddVertsForTextInBox2D( std::vector<Vertex_PCU>& vertexArray, c
 
 
 //---------------------------------------------------------------------------------------------------------
-Vec2 BitmapFont::GetDimensionsForText2D( float cellHeight, const std::string& text, float cellAspect )
+Vec2 BitmapFont::GetDimensionsForText2D( float cellHeight, const std::string& text, float cellAspect ) const
 {
-	float stringWidth = 0.f;
-	size_t stringLength = text.length();
+	return GetDimensionsForText2D( cellHeight, text.c_str(), text.length(), cellAspect );
+}
 
-	for( int stringIndex = 0; stringIndex < stringLength; ++stringIndex )
+
+//---------------------------------------------------------------------------------------------------------
+Vec2 BitmapFont::GetDimensionsForText2D( float cellHeight, char const* text, size_t textLength, float cellAspect ) const
+{
+	float aspectSum = 0.f;
+	for( size_t stringIndex = 0; stringIndex < textLength; ++stringIndex )
 	{
-		stringWidth += cellHeight * GetGlyphAspect( text[ stringIndex ] ) * cellAspect;
+		aspectSum += m_glyphMetrics[ static_cast<unsigned char>( text[ stringIndex ] ) ].aspect;
 	}
 
-	return Vec2( stringWidth, cellHeight );
+	return Vec2( aspectSum * cellHeight * cellAspect, cellHeight );
 }
 
+
+//---------------------------------------------------------------------------------------------------------
+static uint GetTextLayoutKey( std::string const& text, float cellHeight, float cellAspect )
+{
+	uint heightBits = 0;
+	uint aspectBits = 0;
+	memcpy( &heightBits, &cellHeight, sizeof( heightBits ) );
+	memcpy( &aspectBits, &cellAspect, sizeof( aspectBits ) );
+
+	uint key = HashString( text );
+	key ^= heightBits + 0x9e3779b9 + ( key << 6 ) + ( key >> 2 );
+	key ^= aspectBits + 0x9e3779b9 + ( key << 6 ) + ( key >> 2 );
+	return key;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+std::vector<Vertex_PCU> const& BitmapFont::GetCachedVertsForText2D( float cellHeight, const std::string& text, float cellAspect )
+{
+	uint key = GetTextLayoutKey( text, cellHeight, cellAspect );
+
+	auto foundIter = m_textLayoutCache.find( key );
+	if( foundIter != m_textLayoutCache.end() )
+	{
+		text_layout_t const& layout = foundIter->second;
+		if( layout.cellHeight == cellHeight && layout.cellAspect == cellAspect && layout.text == text )
+		{
+			return layout.verticies;
+		}
+	}
+	else if( m_textLayoutCache.size() >= MAX_CACHED_TEXT_LAYOUTS )
+	{
+		ClearTextLayoutCache();
+	}
+
+	// Either a new string or a hash collision - the newest string wins the slot
+	text_layout_t& layout = m_textLayoutCache[ key ];
+	layout.text			= text;
+	layout.cellHeight	= cellHeight;
+	layout.cellAspect	= cellAspect;
+	layout.verticies.clear();
+	AddVertsForText2D( layout.verticies, Vec2::ZERO, cellHeight, text, Rgba8::WHITE, cellAspect );
+
+	return layout.verticies;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void BitmapFont::AddCachedVertsForText2D( std::vector<Vertex_PCU>& vertexArray, const Vec2& textMins, float cellHeight, const std::string& text, const Rgba8& tint, float cellAspect )
+{
+	std::vector<Vertex_PCU> const& cachedVerticies = GetCachedVertsForText2D( cellHeight, text, cellAspect );
+	if( cachedVerticies.empty() )
+		return;
+
+	size_t startIndex = vertexArray.size();
+	vertexArray.resize( startIndex + cachedVerticies.size() );
+
+	Vec3 offset( textMins.x, textMins.y, 0.f );
+	Vertex_PCU* out_vertex = &vertexArray[ startIndex ];
+	for( Vertex_PCU const& cachedVertex : cachedVerticies )
+	{
+		*out_vertex = cachedVertex;
+		out_vertex->m_position += offset;
+		out_vertex->m_color = tint;
+		++out_vertex;
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void BitmapFont::ClearTextLayoutCache()
+{
+	m_textLayoutCache.clear();
+}
\ No newline at end of file
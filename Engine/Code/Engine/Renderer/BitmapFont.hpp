@@ -1,7 +1,9 @@
 #pragma once
 #include <vector>
 #include <string>
+#include <unordered_map>
 #include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/Vertex_PCU.hpp"
 #include "Engine/Renderer/SpriteSheet.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 
@@ -9,7 +11,15 @@
 struct Vec2;
 struct AABB2;
 struct Texture;
-struct Vertex_PCU;
+
+
+//---------------------------------------------------------------------------------------------------------
+struct glyph_metrics_t
+{
+	Vec2	uvAtMins;
+	Vec2	uvAtMaxes;
+	float	aspect = 1.f;
+};
 
 
 //---------------------------------------------------------------------------------------------------------
@@ -21,18 +31,52 @@ private:
 	BitmapFont( const char* fontName, const Texture* fontTexture );
 
 public:
+	static constexpr uint VERTS_PER_GLYPH			= 6;
+	static constexpr uint GLYPH_COUNT				= 256;
+	static constexpr uint MAX_CACHED_TEXT_LAYOUTS	= 512;
+
 	const Texture* GetTexture() const;
 	
-	void AddVertsForText2D( std::vector<Vertex_PCU>& vertexArray, const Vec2& textMins, float cellHeight, const std::string& text, const Rgba8& tint = Rgba8::WHITE, float cellAspect = 1.f );
+	void AddVertsForText2D( std::vector<Vertex_PCU>& vertexArray, const Vec2& textMins, float cellHeight, const std::string& text, const Rgba8& tint = Rgba8::WHITE, float cellAspect = 1.f ) const;
 	void AddVertsForTextInBox2D(	std::vector<Vertex_PCU>& vertexArray, const AABB2& box, float cellHeight, const std::string& text, const Rgba8& tint = Rgba8::WHITE, float cellAspect = 1.f,
-									const Vec2& alignment = ALIGN_CENTERED, const Vec2& offset = Vec2::ZERO );
-	Vec2 GetDimensionsForText2D( float cellHeight, const std::string& text, float cellAspect = 1.f );
+									const Vec2& alignment = ALIGN_CENTERED, const Vec2& offset = Vec2::ZERO ) const;
+	Vec2 GetDimensionsForText2D( float cellHeight, const std::string& text, float cellAspect = 1.f ) const;
+	Vec2 GetDimensionsForText2D( float cellHeight, char const* text, size_t textLength, float cellAspect = 1.f ) const;
+
+	// Span layout - writes straight into caller owned memory and returns the number of verticies written.
+	// Text that does not fit in maxVertexCount is truncated on a glyph boundary.
+	static uint GetVertexCountForText( size_t textLength )	{ return static_cast<uint>( textLength ) * VERTS_PER_GLYPH; }
+	uint WriteVertsForText2D( Vertex_PCU* out_verticies, uint maxVertexCount, const Vec2& textMins, float cellHeight, char const* text, size_t textLength, const Rgba8& tint = Rgba8::WHITE, float cellAspect = 1.f ) const;
+
+	// Layout cache - text that is drawn every frame without changing (labels, HUD readouts) is laid out once at
+	// the origin and replayed with an offset and tint. The cache is flushed whenever it fills up.
+	std::vector<Vertex_PCU> const& GetCachedVertsForText2D( float cellHeight, const std::string& text, float cellAspect = 1.f );
+	void AddCachedVertsForText2D( std::vector<Vertex_PCU>& vertexArray, const Vec2& textMins, float cellHeight, const std::string& text, const Rgba8& tint = Rgba8::WHITE, float cellAspect = 1.f );
+	void ClearTextLayoutCache();
+	uint GetCachedTextLayoutCount() const					{ return static_cast<uint>( m_textLayoutCache.size() ); }
+
+	glyph_metrics_t const& GetGlyphMetrics( unsigned char glyph ) const		{ return m_glyphMetrics[ glyph ]; }
+
+	// For packing the glyphs into a SpriteAtlas; refresh once the sheet has moved so cached UVs follow it
+	SpriteSheet& GetGlyphSpriteSheet()										{ return m_glyphSpriteSheet; }
+	void RefreshGlyphMetrics();
 
 protected:
 	float GetGlyphAspect( int glyphUnicode ) const;
+	void BuildGlyphMetrics();
 
 protected:
+	struct text_layout_t
+	{
+		std::string				text;
+		float					cellHeight = 0.f;
+		float					cellAspect = 0.f;
+		std::vector<Vertex_PCU>	verticies;
+	};
+
 	std::string		m_fontName;
 	SpriteSheet		m_glyphSpriteSheet;
+	glyph_metrics_t	m_glyphMetrics[ GLYPH_COUNT ];
 
+	std::unordered_map<uint, text_layout_t> m_textLayoutCache;
 };
\ No newline at end of file
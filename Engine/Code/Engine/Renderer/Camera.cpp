@@ -8,6 +8,14 @@
 #include "Engine/Math/IntVec2.hpp"
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Math/Vec3.hpp"
+#include "Engine/Math/Sphere3.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/OBB3.hpp"
+#include "Engine/Math/StaticBoundsTree.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/Time.hpp"
+#include <vector>
 
 
 //---------------------------------------------------------------------------------------------------------
@@ -159,6 +167,18 @@ Mat44 Camera::GetViewMatrix() const
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+// Built from whatever view and projection were last set, so games that fold a change of basis into the
+// projection (or set the view directly) get a frustum that matches what the GPU draws
+//---------------------------------------------------------------------------------------------------------
+Frustum Camera::GetFrustum() const
+{
+	Mat44 viewProjection = m_projection;
+	viewProjection.TransformBy( m_view );
+	return Frustum( viewProjection );
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 void Camera::UpdateViewMatrix()
 {
@@ -354,3 +374,77 @@ void Camera::UpdateCameraUBO()
 	m_uniformBuffer->Update( &cameraData, sizeof( cameraData ), sizeof( cameraData ) );
 }
 
+
+//---------------------------------------------------------------------------------------------------------
+// Random spheres, boxes and oriented boxes scattered through a cube around a 60 degree camera. Times the
+// one-call-per-object path against the batch calls and the static tree, in milliseconds per pass.
+//---------------------------------------------------------------------------------------------------------
+void PrintFrustumCullingBenchmark( uint boundsCount, uint passCount )
+{
+	RandomNumberGenerator rng;
+	std::vector<Sphere3> spheres( boundsCount );
+	std::vector<AABB3> boxes( boundsCount );
+	std::vector<OBB3> orientedBoxes( boundsCount );
+	for( uint boundsIndex = 0; boundsIndex < boundsCount; ++boundsIndex )
+	{
+		Vec3 center = Vec3( rng.RollRandomFloatInRange( -500.f, 500.f ), rng.RollRandomFloatInRange( -500.f, 500.f ), rng.RollRandomFloatInRange( -500.f, 500.f ) );
+		Vec3 dimensions = Vec3( rng.RollRandomFloatInRange( 0.5f, 10.f ), rng.RollRandomFloatInRange( 0.5f, 10.f ), rng.RollRandomFloatInRange( 0.5f, 10.f ) );
+		Mat44 orientation = Mat44::CreateZRotationDegrees( rng.RollRandomFloatInRange( 0.f, 360.f ) );
+		orientation.RotateXDegrees( rng.RollRandomFloatInRange( 0.f, 360.f ) );
+
+		spheres[ boundsIndex ]			= Sphere3( center, dimensions.GetLength() * 0.5f );
+		boxes[ boundsIndex ]			= AABB3( center - dimensions * 0.5f, center + dimensions * 0.5f );
+		orientedBoxes[ boundsIndex ]	= OBB3( center, dimensions, orientation.GetIBasis3D(), orientation.GetJBasis3D(), orientation.GetKBasis3D() );
+	}
+
+	Mat44 view = Mat44::CreateYRotationDegrees( 30.f );
+	view.RotateXDegrees( -10.f );
+	Mat44 viewProjection = Mat44::CreatePerspectiveProjection( 60.f, 16.f / 9.f, -0.1f, -1000.f );
+	viewProjection.TransformBy( view );
+	Frustum frustum( viewProjection );
+
+	double buildStartSeconds = GetCurrentTimeSeconds();
+	StaticBoundsTree tree;
+	tree.Build( boxes.data(), boundsCount );
+	double buildMilliseconds = ( GetCurrentTimeSeconds() - buildStartSeconds ) * 1000.0;
+
+	std::vector<uint> visibleIndices( boundsCount );
+	uint visibleCounts[ 5 ] = {};
+	double totalSeconds[ 5 ] = {};
+	for( uint passIndex = 0; passIndex < passCount; ++passIndex )
+	{
+		double startSeconds = GetCurrentTimeSeconds();
+		uint perObjectVisibleCount = 0;
+		for( uint boundsIndex = 0; boundsIndex < boundsCount; ++boundsIndex )
+		{
+			if( frustum.IsAABB3Visible( boxes[ boundsIndex ] ) )
+			{
+				visibleIndices[ perObjectVisibleCount++ ] = boundsIndex;
+			}
+		}
+		visibleCounts[ 0 ] = perObjectVisibleCount;
+		double perObjectEndSeconds = GetCurrentTimeSeconds();
+		visibleCounts[ 1 ] = frustum.CullAABB3s( boxes.data(), boundsCount, visibleIndices.data() );
+		double aabbEndSeconds = GetCurrentTimeSeconds();
+		visibleCounts[ 2 ] = frustum.CullSpheres( spheres.data(), boundsCount, visibleIndices.data() );
+		double sphereEndSeconds = GetCurrentTimeSeconds();
+		visibleCounts[ 3 ] = frustum.CullOBB3s( orientedBoxes.data(), boundsCount, visibleIndices.data() );
+		double obbEndSeconds = GetCurrentTimeSeconds();
+		visibleCounts[ 4 ] = tree.CullVisible( frustum, visibleIndices.data() );
+		double treeEndSeconds = GetCurrentTimeSeconds();
+
+		totalSeconds[ 0 ] += perObjectEndSeconds - startSeconds;
+		totalSeconds[ 1 ] += aabbEndSeconds - perObjectEndSeconds;
+		totalSeconds[ 2 ] += sphereEndSeconds - aabbEndSeconds;
+		totalSeconds[ 3 ] += obbEndSeconds - sphereEndSeconds;
+		totalSeconds[ 4 ] += treeEndSeconds - obbEndSeconds;
+	}
+
+	char const* testNames[ 5 ] = { "AABB3 one call per object", "AABB3 batch", "Sphere3 batch", "OBB3 batch", "AABB3 static tree" };
+	g_theConsole->PrintString( Rgba8::WHITE, "Frustum culling: %u bounds, %u passes (tree built in %.2fms, %u nodes)", boundsCount, passCount, buildMilliseconds, tree.GetNodeCount() );
+	for( int testIndex = 0; testIndex < 5; ++testIndex )
+	{
+		double millisecondsPerPass = ( totalSeconds[ testIndex ] * 1000.0 ) / static_cast<double>( passCount > 0 ? passCount : 1 );
+		g_theConsole->PrintString( Rgba8::WHITE, "  %-26s %8.3fms  %7u visible", testNames[ testIndex ], millisecondsPerPass, visibleCounts[ testIndex ] );
+	}
+}
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "Engine/Core/Rgba8.hpp"
 #include "Engine/Math/Mat44.hpp"
 #include "Engine/Math/Transform.hpp"
+#include "Engine/Math/Frustum.hpp"
 
 struct Vec3;
 
@@ -65,6 +66,7 @@ public:
 	bool	ShouldClearColor() const;
 	bool	ShouldClearDepth() const;
 	Mat44	GetViewMatrix() const;
+	Frustum	GetFrustum() const;
 	Vec3	NDCToWorldCoords( const Vec4& ndcCoords ) const;
 
 	void SetClearMode( CameraClearFlags clearFlags, Rgba8 color, float depth = 1.0f, unsigned int stencil = 0 );
@@ -103,4 +105,8 @@ private:
 	Rgba8				m_clearColor	= Rgba8::WHITE;
 	float				m_clearDepth	= 1.0f;
 	unsigned int		m_clearStencil	= 0;
-};
\ No newline at end of file
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+void PrintFrustumCullingBenchmark( uint boundsCount, uint passCount );
\ No newline at end of file
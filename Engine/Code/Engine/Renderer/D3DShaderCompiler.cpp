@@ -0,0 +1,194 @@
+#include "Engine/Renderer/D3DShaderCompiler.hpp"
+#include "Engine/Renderer/D3D11Common.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/FileUtils.hpp"
+
+#include <d3dcompiler.h>
+#include <map>
+
+
+//---------------------------------------------------------------------------------------------------------
+static char const* GetDefaultEntryPointForStage( ShaderType type )
+{
+	switch( type )
+	{
+	case SHADER_TYPE_VERTEX:
+		return "VertexFunction";
+	case SHADER_TYPE_FRAGMENT:
+		return "FragmentFunction";
+	default:
+		GUARANTEE_OR_DIE( false, "Bad Stage" );
+		break;
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static char const* GetShaderModelForStage( ShaderType type )
+{
+	switch( type )
+	{
+	case SHADER_TYPE_VERTEX:
+		return "vs_5_0";
+	case SHADER_TYPE_FRAGMENT:
+		return "ps_5_0";
+	default:
+		GUARANTEE_OR_DIE( false, "Unknown shader stage" );
+		break;
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static UINT ToD3DCompileFlags( uint flags )
+{
+	UINT compileFlags = 0U;
+	if( flags & SHADER_COMPILE_DEBUG )
+	{
+		compileFlags |= D3DCOMPILE_DEBUG;
+	}
+	if( flags & SHADER_COMPILE_SKIP_OPTIMIZATION )
+	{
+		compileFlags |= D3DCOMPILE_SKIP_OPTIMIZATION;
+	}
+	if( flags & SHADER_COMPILE_OPTIMIZE_FULLY )
+	{
+		compileFlags |= D3DCOMPILE_OPTIMIZATION_LEVEL3;
+	}
+	return compileFlags;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static std::string GetFolderOfFile( std::string const& filepath )
+{
+	size_t lastSlash = filepath.find_last_of( "/\\" );
+	if( lastSlash == std::string::npos )
+	{
+		return "";
+	}
+	return filepath.substr( 0, lastSlash + 1 );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// One per compile, so no locking; remembers which folder each opened buffer came from so nested includes
+// resolve against their own file.
+//---------------------------------------------------------------------------------------------------------
+class ShaderIncludeRecorder : public ID3DInclude
+{
+public:
+	ShaderIncludeRecorder( std::string const& rootFolder, Strings& out_includedFiles )
+		: m_rootFolder( rootFolder )
+		, m_includedFiles( out_includedFiles )
+	{
+	}
+
+	HRESULT __stdcall Open( D3D_INCLUDE_TYPE includeType, LPCSTR fileName, LPCVOID parentData, LPCVOID* out_data, UINT* out_bytes ) override
+	{
+		UNUSED( includeType );
+
+		std::string parentFolder = m_rootFolder;
+		auto parentIter = m_openedFolders.find( parentData );
+		if( parentIter != m_openedFolders.end() )
+		{
+			parentFolder = parentIter->second;
+		}
+
+		std::string candidates[] = { parentFolder + fileName, std::string( fileName ) };
+		for( std::string const& includePath : candidates )
+		{
+			size_t fileSize = 0;
+			void* fileData = FileReadBinaryToNewBuffer( includePath, &fileSize );
+			if( fileData != nullptr )
+			{
+				m_openedFolders[ fileData ] = GetFolderOfFile( includePath );
+				m_includedFiles.push_back( includePath );
+				*out_data	= fileData;
+				*out_bytes	= static_cast<UINT>( fileSize );
+				return S_OK;
+			}
+		}
+		return E_FAIL;
+	}
+
+	HRESULT __stdcall Close( LPCVOID data ) override
+	{
+		m_openedFolders.erase( data );
+		delete[] static_cast<unsigned char const*>( data );
+		return S_OK;
+	}
+
+private:
+	std::string							m_rootFolder;
+	Strings&							m_includedFiles;
+	std::map<void const*, std::string>	m_openedFolders;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+bool D3DShaderCompiler::Compile( shader_compile_desc_t const& desc, shader_compile_result_t& out_result )
+{
+	out_result.isSuccess = false;
+	out_result.byteCode.clear();
+	out_result.errors.clear();
+	out_result.includedFiles.clear();
+
+	// "NAME=VALUE" strings split into name/value pairs; the macro array points into these
+	Strings macroNames;
+	Strings macroValues;
+	macroNames.reserve( desc.defines.size() );
+	macroValues.reserve( desc.defines.size() );
+	for( std::string const& define : desc.defines )
+	{
+		size_t equalsIndex = define.find( '=' );
+		macroNames.push_back( define.substr( 0, equalsIndex ) );
+		macroValues.push_back( equalsIndex == std::string::npos ? "1" : define.substr( equalsIndex + 1 ) );
+	}
+
+	std::vector<D3D_SHADER_MACRO> macros;
+	for( size_t macroIndex = 0; macroIndex < macroNames.size(); ++macroIndex )
+	{
+		macros.push_back( { macroNames[ macroIndex ].c_str(), macroValues[ macroIndex ].c_str() } );
+	}
+	macros.push_back( { nullptr, nullptr } );
+
+	ShaderIncludeRecorder includeHandler( GetFolderOfFile( desc.filename ), out_result.includedFiles );
+
+	ID3DBlob* byteCode	= nullptr;
+	ID3DBlob* errors	= nullptr;
+	HRESULT hr = ::D3DCompile( desc.source.c_str(),
+		desc.source.length(),
+		desc.filename.c_str(),
+		macros.data(),
+		&includeHandler,
+		GetDefaultEntryPointForStage( desc.stage ),
+		GetShaderModelForStage( desc.stage ),
+		ToD3DCompileFlags( desc.flags ),
+		0,
+		&byteCode,
+		&errors );
+
+	if( errors != nullptr )
+	{
+		out_result.errors = static_cast<char const*>( errors->GetBufferPointer() );
+		DX_SAFE_RELEASE( errors );
+	}
+
+	if( FAILED( hr ) || byteCode == nullptr )
+	{
+		if( out_result.errors.empty() )
+		{
+			out_result.errors = Stringf( "Failed with HRESULT: %u", hr );
+		}
+		DX_SAFE_RELEASE( byteCode );
+		return false;
+	}
+
+	unsigned char const* byteCodePtr = static_cast<unsigned char const*>( byteCode->GetBufferPointer() );
+	out_result.byteCode.assign( byteCodePtr, byteCodePtr + byteCode->GetBufferSize() );
+	DX_SAFE_RELEASE( byteCode );
+
+	out_result.isSuccess = true;
+	return true;
+}
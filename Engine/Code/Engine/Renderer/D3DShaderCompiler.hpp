@@ -0,0 +1,14 @@
+#pragma once
+#include "Engine/Renderer/ShaderCompiler.hpp"
+
+
+//---------------------------------------------------------------------------------------------------------
+// ShaderCompiler over D3DCompile. Includes are opened relative to the file doing the including (then the
+// working directory), matching D3D_COMPILE_STANDARD_FILE_INCLUDE, and each one opened is reported back.
+//---------------------------------------------------------------------------------------------------------
+class D3DShaderCompiler : public ShaderCompiler
+{
+public:
+	virtual bool		Compile( shader_compile_desc_t const& desc, shader_compile_result_t& out_result ) override;
+	virtual char const*	GetCompilerID() const override						{ return "D3DCompile_47/sm5_0"; }
+};
@@ -18,7 +18,7 @@ Material::Material( RenderContext* context, char const* filepath )
 	m_filepath = filepath;
 	m_ubo = new RenderBuffer( context, UNIFORM_BUFFER_BIT, MEMORY_HINT_DYNAMIC );
 
-	XmlDocument materialFile = new XmlDocument();
+	BakedXmlDocument materialFile;
 	materialFile.LoadFile( filepath );
 	GUARANTEE_OR_DIE( materialFile.ErrorID() == 0, Stringf( "%s could not be loaded", filepath ).c_str() );
 	SetFromXML( *materialFile.RootElement() );
@@ -102,7 +102,7 @@ void Material::UpdateUBOIfDirty()
 
 
 //---------------------------------------------------------------------------------------------------------
-void Material::SetFromXML( XmlElement const& element )
+void Material::SetFromXML( BakedXmlElement const& element )
 {
 // 	< Material   name = "ship_dissolve"
 // 		< ShaderState        filepath = "Data\Shaders\dissolve.shaderstate" / >
@@ -121,7 +121,7 @@ void Material::SetFromXML( XmlElement const& element )
 // 		< / Material>
 
 	m_name = ParseXmlAttribute( element, "name", m_name );
-	const XmlElement* nextElement = element.FirstChildElement();
+	const BakedXmlElement* nextElement = element.FirstChildElement();
 	for( ;; )
 	{
 		if( nextElement == nullptr ) break;
@@ -153,7 +153,7 @@ void Material::SetData( void const* data, size_t dataSize )
 
 
 //---------------------------------------------------------------------------------------------------------
-void Material::ParseShaderStateElement( XmlElement const& element )
+void Material::ParseShaderStateElement( BakedXmlElement const& element )
 {
 	std::string filepath = ParseXmlAttribute( element, "filepath", "" );
 	
@@ -165,7 +165,7 @@ void Material::ParseShaderStateElement( XmlElement const& element )
 
 
 //---------------------------------------------------------------------------------------------------------
-void Material::ParseDiffuseTexture( XmlElement const& element )
+void Material::ParseDiffuseTexture( BakedXmlElement const& element )
 {
 	std::string filepath = ParseXmlAttribute( element, "filepath", "" );
 	if( filepath != "" )
@@ -176,7 +176,7 @@ void Material::ParseDiffuseTexture( XmlElement const& element )
 
 
 //---------------------------------------------------------------------------------------------------------
-void Material::ParseNormalTexture( XmlElement const& element )
+void Material::ParseNormalTexture( BakedXmlElement const& element )
 {
 	std::string filepath = ParseXmlAttribute( element, "filepath", "" );
 	if( filepath != "" )
@@ -187,7 +187,7 @@ void Material::ParseNormalTexture( XmlElement const& element )
 
 
 //---------------------------------------------------------------------------------------------------------
-void Material::ParseMaterialTexture( XmlElement const& element )
+void Material::ParseMaterialTexture( BakedXmlElement const& element )
 {
 	std::string filepath = ParseXmlAttribute( element, "filepath", "" );
 	if( filepath != "" )
@@ -198,7 +198,7 @@ void Material::ParseMaterialTexture( XmlElement const& element )
 
 
 //---------------------------------------------------------------------------------------------------------
-void Material::ParseMaterialSampler( XmlElement const& element )
+void Material::ParseMaterialSampler( BakedXmlElement const& element )
 {
 	SamplerType samplerType;
 	TextureAddressMode wrapMode;
@@ -221,7 +221,7 @@ void Material::ParseMaterialSampler( XmlElement const& element )
 
 
 //---------------------------------------------------------------------------------------------------------
-void Material::ParseDataElement( XmlElement const& element )
+void Material::ParseDataElement( BakedXmlElement const& element )
 {
 	std::string dataType = element.Name();
 	if( dataType == "float" ) 
@@ -242,7 +242,7 @@ void Material::ParseDataElement( XmlElement const& element )
 
 
 //---------------------------------------------------------------------------------------------------------
-float Material::ParseFloatData( XmlElement const& element )
+float Material::ParseFloatData( BakedXmlElement const& element )
 {
 	float data = ParseXmlAttribute( element, "value", 0.f );
 	return data;
@@ -250,7 +250,7 @@ float Material::ParseFloatData( XmlElement const& element )
 
 
 //---------------------------------------------------------------------------------------------------------
-Vec3 Material::ParseVec3Data( XmlElement const& element )
+Vec3 Material::ParseVec3Data( BakedXmlElement const& element )
 {
 	Vec3 defaultValue = Vec3::ZERO;
 	Vec3 data = ParseXmlAttribute( element, "value", defaultValue );
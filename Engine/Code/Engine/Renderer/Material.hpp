@@ -1,6 +1,6 @@
 #pragma once
 #include "Engine/Core/Rgba8.hpp"
-#include "Engine/Core/XmlUtils.hpp"
+#include "Engine/Core/BakedXml.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include <vector>
 #include <string>
@@ -31,7 +31,7 @@ public:
 	void AddSampler( uint index, Sampler* sampler );
 	void UpdateUBOIfDirty();
 
-	void SetFromXML( XmlElement const& element );
+	void SetFromXML( BakedXmlElement const& element );
 	
 public:
 	void SetData( void const* data, size_t dataSize );
@@ -47,16 +47,16 @@ public:
 
 private:
 	// Child Element Parse
-	void ParseShaderStateElement( XmlElement const& element );
-	void ParseDiffuseTexture( XmlElement const& element );
-	void ParseNormalTexture( XmlElement const& element );
-	void ParseMaterialTexture( XmlElement const& element );
-	void ParseMaterialSampler( XmlElement const& element );
-	void ParseDataElement( XmlElement const& element );
+	void ParseShaderStateElement( BakedXmlElement const& element );
+	void ParseDiffuseTexture( BakedXmlElement const& element );
+	void ParseNormalTexture( BakedXmlElement const& element );
+	void ParseMaterialTexture( BakedXmlElement const& element );
+	void ParseMaterialSampler( BakedXmlElement const& element );
+	void ParseDataElement( BakedXmlElement const& element );
 
 	//Data Element Parse
-	float ParseFloatData( XmlElement const& element );
-	Vec3 ParseVec3Data( XmlElement const& element );
+	float ParseFloatData( BakedXmlElement const& element );
+	Vec3 ParseVec3Data( BakedXmlElement const& element );
 
 
 public:
@@ -1,5 +1,4 @@
 #include "Engine/Renderer/MeshUtils.hpp"
-#include "Engine/Renderer/GPUMesh.hpp"
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Math/AABB2.hpp"
 #include "Engine/Math/AABB3.hpp"
@@ -9,6 +8,11 @@
 #include "Engine/Math/MikkT.hpp"
 #include "Engine/Core/Rgba8.hpp"
 #include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Platform/Platform.hpp"
+
+#if !defined( ENGINE_HEADLESS )
+#include "Engine/Renderer/GPUMesh.hpp"
+#endif
 
 
 //---------------------------------------------------------------------------------------------------------
@@ -512,6 +516,7 @@ void AppendMasterVertsToPCUTBNArray( std::vector<Vertex_Master>& masterVertArray
 }
 
 
+#if !defined( ENGINE_HEADLESS )
 //---------------------------------------------------------------------------------------------------------
 void AddVerticiesAndIndiciesForCubeMesh( GPUMesh* cubeMesh, float sideLength )
 {
@@ -529,6 +534,7 @@ void AddVerticiesAndIndiciesForCubeMesh( GPUMesh* cubeMesh, float sideLength )
 	cubeMesh->UpdateVerticies( 24, &cubeMeshVerts[0] );
 	cubeMesh->UpdateIndicies( 36, &cubeMeshIndicies[0] );
 }
+#endif
 
 
 //---------------------------------------------------------------------------------------------------------
@@ -2,7 +2,6 @@
 //		THIRD PARTY INCLUDES
 //---------------------------------------------------------------------------------------------------------
 
-#define STB_IMAGE_IMPLEMENTATION
 #include "ThirdParty/stb/stb_image.h"
 
 //#include "Engine/Renderer/D3D11Common.hpp"
@@ -26,7 +25,12 @@
 #include "Engine/Renderer/GPUMesh.hpp"
 #include "Engine/Renderer/GPUSubMesh.hpp"
 #include "Engine/Renderer/ShaderState.hpp"
+#include "Engine/Renderer/ShaderCache.hpp"
+#include "Engine/Renderer/D3DShaderCompiler.hpp"
 #include "Engine/Renderer/Material.hpp"
+#include "Engine/Renderer/AssetLoadJobs.hpp"
+#include "Engine/Renderer/SpriteAnimSystem.hpp"
+#include "Engine/Renderer/TextureAtlas.hpp"
 #include "Engine/Core/Vertex_Master.hpp"
 #include "Engine/Core/Vertex_PCU.hpp"
 #include "Engine/Core/Vertex_PCUTBN.hpp"
@@ -34,11 +38,65 @@
 #include "Engine/Core/StringUtils.hpp"
 #include "Engine/Core/Time.hpp"
 #include "Engine/Core/Clock.hpp"
+#include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/EventSystem.hpp"
+#include "Engine/Core/NamedProperties.hpp"
+#include "Engine/Core/Image.hpp"
+#include "Engine/Core/JobSystem.hpp"
+#include "Engine/Core/AsyncLoadJob.hpp"
+#include "Engine/Core/FileUtils.hpp"
 #include "Engine/Math/IntVec2.hpp"
 #include "Engine/Math/Transform.hpp"
 #include "Engine/Platform/Window.hpp"
 
 
+//---------------------------------------------------------------------------------------------------------
+static void asset_lookups( EventArgs* args )
+{
+	UNUSED( args );
+	g_theConsole->PrintString( Rgba8::WHITE, "Asset string lookups last frame: %u", GetAssetStringLookupsLastFrame() );
+	g_theConsole->PrintString( Rgba8::WHITE, "Asset string lookups peak:       %u", GetAssetStringLookupsPeak() );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void asset_load_times( EventArgs* args )
+{
+	UNUSED( args );
+	PrintAsyncLoadReport();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void cull_benchmark( EventArgs* args )
+{
+	uint boundsCount = static_cast<uint>( args->GetValue( "count", 100000 ) );
+	uint passCount = static_cast<uint>( args->GetValue( "passes", 100 ) );
+	PrintFrustumCullingBenchmark( boundsCount, passCount );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void sprite_anim_benchmark( EventArgs* args )
+{
+	uint instanceCount = static_cast<uint>( args->GetValue( "count", 100000 ) );
+	int frameCount = args->GetValue( "frames", 60 );
+	PrintSpriteAnimBenchmark( instanceCount, frameCount );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static void atlas_benchmark( EventArgs* args )
+{
+	std::string imageFilePath = args->GetValue( "image", "Data/Images/Test_StbiFlippedAndOpenGL.png" );
+	int decodeCount = args->GetValue( "decodes", 20 );
+	uint imageCount = static_cast<uint>( args->GetValue( "count", 2000 ) );
+	int pageSize = args->GetValue( "pageSize", 2048 );
+	PrintRectPackerBenchmark( imageCount, pageSize );
+	PrintTextureAtlasBenchmark( imageFilePath.c_str(), decodeCount, imageCount );
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 void RenderContext::StartUp( Window* theWindow )
 {
@@ -90,6 +148,9 @@ void RenderContext::StartUp( Window* theWindow )
 	Texture* backBufferTexture = m_swapchain->GetBackBuffer();
 	m_defaultDepthStencil = CreateDepthStencilBuffer( backBufferTexture->GetImageTexelSize() );
 
+	m_shaderCompiler = new D3DShaderCompiler();
+	m_shaderCache = new ShaderCache( m_shaderCompiler, "Data/ShaderCache" );
+
 	m_errorShader = CreateShaderFromSourceCode( BuiltInShader::BUILT_IN_ERROR );
 	m_defaultShader = CreateShaderFromSourceCode( BuiltInShader::BUILT_IN_DEFAULT );
 
@@ -105,15 +166,30 @@ void RenderContext::StartUp( Window* theWindow )
 	m_samplerLinear = GetOrCreateSampler( SAMPLER_BILINEAR );
 	m_textueDefaultColor = CreateTextureFromColor( Rgba8::WHITE );
 	m_textureDefaultNormalColor = CreateTextureFromColor( Rgba8( 127, 127, 255, 255 ) );
+	m_meshPlaceholder = new GPUMesh( this );
 
 	SetGameClock( nullptr );
 	CreateBlendStates();
+
+	if( g_theEventSystem != nullptr )
+	{
+		g_theEventSystem->SubscribeEventCallbackFunction( "asset_lookups", asset_lookups );
+		g_theEventSystem->SubscribeEventCallbackFunction( "asset_load_times", asset_load_times );
+		g_theEventSystem->SubscribeEventCallbackFunction( "cull_benchmark", cull_benchmark );
+		g_theEventSystem->SubscribeEventCallbackFunction( "sprite_anim_benchmark", sprite_anim_benchmark );
+		g_theEventSystem->SubscribeEventCallbackFunction( "atlas_benchmark", atlas_benchmark );
+	}
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 void RenderContext::BeginFrame()
 {
+	if( g_theJobSystem != nullptr )
+	{
+		g_theJobSystem->ClaimAndDeleteCompletedJobs( JOB_CATEGORY_RENDER_ASSET_LOADING );
+	}
+
 	UpdateFrameUBO();
 }
 
@@ -122,6 +198,7 @@ void RenderContext::BeginFrame()
 void RenderContext::EndFrame()
 {
 	m_swapchain->Present();
+	EndAssetLookupFrame();
 }
 
 
@@ -155,6 +232,12 @@ void RenderContext::ShutDown()
 	delete m_swapchain;
 	m_swapchain = nullptr;
 
+	delete m_shaderCache;
+	m_shaderCache = nullptr;
+
+	delete m_shaderCompiler;
+	m_shaderCompiler = nullptr;
+
 	DX_SAFE_RELEASE( m_device );
 	DX_SAFE_RELEASE( m_context );
 
@@ -226,13 +309,10 @@ Sampler* RenderContext::GetOrCreateSampler( SamplerType samplerType, TextureAddr
 //---------------------------------------------------------------------------------------------------------
 ShaderState* RenderContext::GetOrCreateShaderStateFromFile( char const* filepath )
 {
-	for( uint shaderStateIndex = 0; shaderStateIndex < m_loadedShaderStates.size(); ++shaderStateIndex )
+	ShaderState* loadedShaderState = m_shaderStateRegistry.Find( filepath );
+	if( loadedShaderState != nullptr )
 	{
-		ShaderState* currentShaderState = m_loadedShaderStates[ shaderStateIndex ];
-		if( currentShaderState->GetFilePath() == filepath )
-		{
-			return currentShaderState;
-		}
+		return loadedShaderState;
 	}
 
 	ShaderState* createdShaderState = CreateShaderState( filepath );
@@ -243,13 +323,10 @@ ShaderState* RenderContext::GetOrCreateShaderStateFromFile( char const* filepath
 //---------------------------------------------------------------------------------------------------------
 Material* RenderContext::GetOrCreateMaterialFromFile( char const* filepath )
 {
-	for( uint materialIndex = 0; materialIndex < m_loadedMaterials.size(); ++materialIndex )
+	Material* loadedMaterial = m_materialRegistry.Find( filepath );
+	if( loadedMaterial != nullptr )
 	{
-		Material* currentMaterial = m_loadedMaterials[ materialIndex ];
-		if( currentMaterial->m_filepath == filepath )
-		{
-			return currentMaterial;
-		}
+		return loadedMaterial;
 	}
 
 	Material* createdMaterial = CreateMaterial( filepath );
@@ -257,6 +334,176 @@ Material* RenderContext::GetOrCreateMaterialFromFile( char const* filepath )
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+AssetHandle RenderContext::GetOrCreateTextureHandle( char const* imageFilePath )
+{
+	AssetHandle textureHandle = m_textureRegistry.FindHandle( imageFilePath );
+	if( !textureHandle.IsValid() )
+	{
+		CreateTextureFromFile( imageFilePath );
+		textureHandle = m_textureRegistry.FindHandle( imageFilePath );
+	}
+	return textureHandle;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+AssetHandle RenderContext::GetOrCreateShaderHandle( char const* filename )
+{
+	AssetHandle shaderHandle = m_shaderRegistry.FindHandle( filename );
+	if( !shaderHandle.IsValid() )
+	{
+		CreateShaderFromFilePath( filename );
+		shaderHandle = m_shaderRegistry.FindHandle( filename );
+	}
+	return shaderHandle;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+AssetHandle RenderContext::GetOrCreateMaterialHandle( char const* filepath )
+{
+	AssetHandle materialHandle = m_materialRegistry.FindHandle( filepath );
+	if( !materialHandle.IsValid() )
+	{
+		CreateMaterial( filepath );
+		materialHandle = m_materialRegistry.FindHandle( filepath );
+	}
+	return materialHandle;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+Texture* RenderContext::GetTexture( AssetHandle textureHandle ) const
+{
+	return m_textureRegistry.Get( textureHandle );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+Shader* RenderContext::GetShader( AssetHandle shaderHandle ) const
+{
+	Shader* shader = m_shaderRegistry.Get( shaderHandle );
+	if( shader == nullptr )
+	{
+		return m_errorShader;
+	}
+	return shader;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+Material* RenderContext::GetMaterial( AssetHandle materialHandle ) const
+{
+	return m_materialRegistry.Get( materialHandle );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+AssetHandle RenderContext::RequestTextureAsync( char const* imageFilePath )
+{
+	AssetHandle textureHandle = m_textureRegistry.FindHandle( imageFilePath );
+	if( textureHandle.IsValid() )
+		return textureHandle;
+
+	textureHandle = m_textureRegistry.Register( imageFilePath, m_textueDefaultColor );
+	PostAsyncLoadJob( new TextureLoadJob( this, textureHandle, imageFilePath ) );
+	return textureHandle;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+AssetHandle RenderContext::RequestMeshAsync( char const* objFilePath, mesh_import_options_t const& options )
+{
+	AssetHandle meshHandle = m_meshRegistry.FindHandle( objFilePath );
+	if( meshHandle.IsValid() )
+		return meshHandle;
+
+	meshHandle = m_meshRegistry.Register( objFilePath, m_meshPlaceholder );
+	PostAsyncLoadJob( new MeshLoadJob( this, meshHandle, objFilePath, options ) );
+	return meshHandle;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+GPUMesh* RenderContext::GetMesh( AssetHandle meshHandle ) const
+{
+	GPUMesh* mesh = m_meshRegistry.Get( meshHandle );
+	if( mesh == nullptr )
+	{
+		return m_meshPlaceholder;
+	}
+	return mesh;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void RenderContext::FinalizeAsyncTextureLoad( AssetHandle textureHandle, Image const& image )
+{
+	Texture* newTexture = CreateTextureFromImage( image );
+	m_textureRegistry.Replace( textureHandle, newTexture );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void RenderContext::FinalizeAsyncMeshLoad( AssetHandle meshHandle, std::vector<Vertex_PCUTBN>& verticies, std::vector<uint> const& subMeshVertOffsets )
+{
+	if( verticies.empty() )
+	{
+		g_theConsole->ErrorString( "Mesh \"%s\" loaded with no verticies", m_meshRegistry.GetFilePath( meshHandle ).c_str() );
+		return;
+	}
+
+	// Anything before the first group still belongs to a sub mesh, and empty groups are dropped
+	std::vector<uint> vertOffsets;
+	vertOffsets.push_back( 0 );
+	for( uint offsetIndex = 0; offsetIndex < subMeshVertOffsets.size(); ++offsetIndex )
+	{
+		uint groupOffset = subMeshVertOffsets[ offsetIndex ];
+		if( groupOffset > vertOffsets.back() && groupOffset < verticies.size() )
+		{
+			vertOffsets.push_back( groupOffset );
+		}
+	}
+
+	GPUMesh* newMesh = new GPUMesh( this, verticies, vertOffsets, static_cast<uint>( vertOffsets.size() ) );
+	m_loadedMeshes.push_back( newMesh );
+	m_meshRegistry.Replace( meshHandle, newMesh );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void RenderContext::FinalizeAsyncShaderCompile( AssetHandle shaderHandle, uint compileGeneration, shader_compile_result_t const& vertexResult, shader_compile_result_t const& fragmentResult )
+{
+	Shader* shader = m_shaderRegistry.Get( shaderHandle );
+	if( shader == nullptr || shader->m_compileGeneration != compileGeneration )
+	{
+		return;
+	}
+
+	// On failure the shader keeps its previous bytecode (or keeps drawing as m_errorShader if it never had any)
+	std::string const& filePath = m_shaderRegistry.GetFilePath( shaderHandle );
+	if( !vertexResult.isSuccess || !fragmentResult.isSuccess )
+	{
+		g_theConsole->ErrorString( "Failed to compile shader \"%s\"", filePath.c_str() );
+		g_theConsole->ErrorString( "%s", vertexResult.isSuccess ? fragmentResult.errors.c_str() : vertexResult.errors.c_str() );
+		return;
+	}
+
+	if( !shader->SetByteCode( vertexResult.byteCode, fragmentResult.byteCode ) )
+	{
+		g_theConsole->ErrorString( "Failed to create shader \"%s\" from compiled bytecode", filePath.c_str() );
+		return;
+	}
+
+	if( m_lastBoundShader == shader )
+	{
+		m_lastBoundShader = nullptr;
+	}
+	m_shaderRegistry.MarkReloaded( shaderHandle );
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 void RenderContext::ApplyFullscreenEffect( Texture* source, Texture* destination, Material* fullscreenMaterial )
 {
@@ -624,6 +871,9 @@ void RenderContext::DrawMeshWithMaterials( GPUMesh* mesh, Material** subMeshMate
 //---------------------------------------------------------------------------------------------------------
 void RenderContext::DrawSubMesh( GPUSubMesh* subMesh )
 {
+	if( subMesh->GetVertexCount() == 0 )
+		return;
+
 	BindVertexInput( subMesh->GetVertexBuffer() );
 	UpdateCurrentLayout( subMesh->GetVertexBuffer()->m_boundBufferAttribute );
 
@@ -770,15 +1020,21 @@ void RenderContext::SetFrontFaceWindOrder( bool isCounterClockwise )
 //---------------------------------------------------------------------------------------------------------
 Shader* RenderContext::CreateShaderFromFilePath( char const* filename )
 {
-	Shader* newShader = new Shader( this );
-	if( newShader->CreateFromFile( filename ) )
+	if( !GetFileModificationInfo( filename, nullptr, nullptr ) )
 	{
-		m_loadedShaders.push_back( newShader );
-		return newShader;
+		return m_errorShader;
 	}
 
-	delete newShader;
-	return m_errorShader;
+	// Registered straight away; until its bytecode arrives, BindShader draws it with m_errorShader
+	Shader* newShader = new Shader( this );
+	m_loadedShaders.push_back( newShader );
+	AssetHandle shaderHandle = m_shaderRegistry.Register( filename, newShader );
+
+	if( !newShader->CreateFromCache( filename ) )
+	{
+		PostAsyncLoadJob( new ShaderCompileJob( this, shaderHandle, filename, newShader->m_compileGeneration ) );
+	}
+	return newShader;
 }
 
 
@@ -796,6 +1052,7 @@ ShaderState* RenderContext::CreateShaderState( char const* filepath )
 {
 	ShaderState* newShaderState = new ShaderState( this, filepath );
 	m_loadedShaderStates.push_back( newShaderState );
+	m_shaderStateRegistry.Register( filepath, newShaderState );
 	return newShaderState;
 }
 
@@ -805,6 +1062,7 @@ Material* RenderContext::CreateMaterial( char const* filepath )
 {
 	Material* newMaterial = new Material( this, filepath );
 	m_loadedMaterials.push_back( newMaterial );
+	m_materialRegistry.Register( filepath, newMaterial );
 	return newMaterial;
 }
 
@@ -890,24 +1148,37 @@ void RenderContext::CreateRasterState()
 //---------------------------------------------------------------------------------------------------------
 bool RenderContext::CreateTextureFromFile( const char* imageFilePath )
 {
-	int imageTexelSizeX = 0;
-	int imageTexelSizeY = 0;
-	int numComponents = 0; 
-	int numComponentsRequested = 4;
+	Image image( imageFilePath, true );
+	Texture* newTexture = CreateTextureFromImage( image );
+	m_textureRegistry.Register( imageFilePath, newTexture );
 
-	// Load (and decompress) the image RGB(A) bytes from a file on disk into a memory buffer (array of bytes)
-	stbi_set_flip_vertically_on_load( 1 );
-	unsigned char* imageData = stbi_load( imageFilePath, &imageTexelSizeX, &imageTexelSizeY, &numComponents, numComponentsRequested );
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+Texture* RenderContext::CreateTextureFromImage( Image const& image, bool generateMips )
+{
+	IntVec2 imageTexelSize = image.GetDimensions();
 
-	// Check if the load was successful
-	GUARANTEE_OR_DIE( imageData, Stringf( "Failed to load image \"%s\"", imageFilePath ) );
-	GUARANTEE_OR_DIE( numComponents == 4 && imageTexelSizeX > 0 && imageTexelSizeY > 0, Stringf( "ERROR loading image \"%s\" (Bpp=%i, size=%i,%i)", imageFilePath, numComponents, imageTexelSizeX, imageTexelSizeY ) );
+	// Mips are box filtered on the CPU and go up with the top level, since the texture is immutable
+	std::vector<Image> mipImages;
+	if( generateMips )
+	{
+		int mipCount = image.GetFullMipChainLength();
+		mipImages.reserve( mipCount - 1 );
+		for( int mipIndex = 1; mipIndex < mipCount; ++mipIndex )
+		{
+			Image const& largerMip = ( mipIndex == 1 ) ? image : mipImages.back();
+			mipImages.push_back( largerMip.CreateHalfSizeMip() );
+		}
+	}
 
 	// Describe the texture
 	D3D11_TEXTURE2D_DESC desc;
-	desc.Width				= imageTexelSizeX;
-	desc.Height				= imageTexelSizeY;
-	desc.MipLevels			= 1;
+	desc.Width				= imageTexelSize.x;
+	desc.Height				= imageTexelSize.y;
+	desc.MipLevels			= 1 + static_cast<UINT>( mipImages.size() );
 	desc.ArraySize			= 1;
 	desc.Format				= DXGI_FORMAT_R8G8B8A8_UNORM;
 	desc.SampleDesc.Count	= 1; //MSAA
@@ -918,36 +1189,33 @@ bool RenderContext::CreateTextureFromFile( const char* imageFilePath )
 	desc.MiscFlags			= 0;
 
 	// Initialize Memory
-	D3D11_SUBRESOURCE_DATA initialData;
-	initialData.pSysMem				= imageData;
-	initialData.SysMemPitch			= imageTexelSizeX * 4;
-	initialData.SysMemSlicePitch	= 0; 
+	std::vector<D3D11_SUBRESOURCE_DATA> initialData( desc.MipLevels );
+	for( UINT mipIndex = 0; mipIndex < desc.MipLevels; ++mipIndex )
+	{
+		Image const& mipImage = ( mipIndex == 0 ) ? image : mipImages[ mipIndex - 1 ];
+		initialData[ mipIndex ].pSysMem				= mipImage.GetRawData();
+		initialData[ mipIndex ].SysMemPitch			= mipImage.GetDimensions().x * 4;
+		initialData[ mipIndex ].SysMemSlicePitch	= 0;
+	}
 
 	ID3D11Texture2D* texHandle = nullptr;
-	m_device->CreateTexture2D( &desc, &initialData, &texHandle );
+	m_device->CreateTexture2D( &desc, initialData.data(), &texHandle );
 
-	Texture* newTexture = new Texture( imageFilePath, this, texHandle );
-	newTexture->SetPixelData( imageTexelSizeX * imageTexelSizeY * 4, imageData );
+	Texture* newTexture = new Texture( image.GetImageFilePath().c_str(), this, texHandle );
+	newTexture->SetPixelData( static_cast<int>( image.GetRawDataSizeBytes() ), static_cast<unsigned char const*>( image.GetRawData() ) );
 	m_loadedTextures.push_back( newTexture );
 
-// 	// Free the raw image texel data now that we've sent a copy of it down to the GPU to be stored in video memory
-	stbi_image_free( imageData );
-
-	return true;
+	return newTexture;
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 Texture* RenderContext::CreateOrGetTextureFromFile( const char* imageFilePath )
 {
-	Texture* loadedTexture;
-	for( int loadedTexturesIndex = 0; loadedTexturesIndex < m_loadedTextures.size(); ++loadedTexturesIndex )
+	Texture* loadedTexture = m_textureRegistry.Find( imageFilePath );
+	if( loadedTexture != nullptr )
 	{
-		loadedTexture = m_loadedTextures[ loadedTexturesIndex ];
-		if( imageFilePath == loadedTexture->GetImageFilePath() )
-		{
-			return loadedTexture;
-		}
+		return loadedTexture;
 	}
 	CreateTextureFromFile( imageFilePath );
 	return m_loadedTextures[ m_loadedTextures.size() - 1 ];
@@ -957,14 +1225,10 @@ Texture* RenderContext::CreateOrGetTextureFromFile( const char* imageFilePath )
 //---------------------------------------------------------------------------------------------------------
 BitmapFont* RenderContext::CreateOrGetBitmapFontFromFile( const char* imageFilePath )
 {
-	BitmapFont* loadedBitFont;
-	for( int loadedFontIndex = 0; loadedFontIndex < m_loadedFonts.size(); ++loadedFontIndex )
+	BitmapFont* loadedBitFont = m_fontRegistry.Find( imageFilePath );
+	if( loadedBitFont != nullptr )
 	{
-		loadedBitFont = m_loadedFonts[ loadedFontIndex ];
-		if( imageFilePath == loadedBitFont->m_fontName )
-		{
-			return loadedBitFont;
-		}
+		return loadedBitFont;
 	}
 	CreateBitmapFontFromFile( imageFilePath );
 	return m_loadedFonts[ m_loadedFonts.size() - 1 ];
@@ -974,13 +1238,10 @@ BitmapFont* RenderContext::CreateOrGetBitmapFontFromFile( const char* imageFileP
 //---------------------------------------------------------------------------------------------------------
 Shader* RenderContext::GetOrCreateShader( char const* filename )
 {
-	for( int shaderIndex = 0; shaderIndex < m_loadedShaders.size(); ++shaderIndex )
+	Shader* loadedShader = m_shaderRegistry.Find( filename );
+	if( loadedShader != nullptr )
 	{
-		Shader* shader = m_loadedShaders[ shaderIndex ];
-		if( shader != nullptr && strcmp( shader->GetFilePath(), filename ) == 0 )
-		{
-			return shader;
-		}
+		return loadedShader;
 	}
 	return CreateShaderFromFilePath( filename );
 }
@@ -1076,6 +1337,22 @@ void RenderContext::ReleaseLoadedAssets()
 		delete m_loadedMaterials[ materialIndex ];
 		m_loadedMaterials[ materialIndex ] = nullptr;
 	}
+
+	for( int meshIndex = 0; meshIndex < m_loadedMeshes.size(); ++meshIndex )
+	{
+		delete m_loadedMeshes[ meshIndex ];
+		m_loadedMeshes[ meshIndex ] = nullptr;
+	}
+
+	delete m_meshPlaceholder;
+	m_meshPlaceholder = nullptr;
+
+	m_textureRegistry.Clear();
+	m_fontRegistry.Clear();
+	m_shaderRegistry.Clear();
+	m_shaderStateRegistry.Clear();
+	m_materialRegistry.Clear();
+	m_meshRegistry.Clear();
 }
 
 
@@ -1243,6 +1520,27 @@ void RenderContext::BindMaterialByPath( const char* filepath )
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+void RenderContext::BindTextureByHandle( AssetHandle textureHandle )
+{
+	BindTexture( GetTexture( textureHandle ) );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void RenderContext::BindShaderByHandle( AssetHandle shaderHandle )
+{
+	BindShader( GetShader( shaderHandle ) );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void RenderContext::BindMaterialByHandle( AssetHandle materialHandle )
+{
+	BindMaterial( GetMaterial( materialHandle ) );
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 void RenderContext::ReloadShaders()
 {
@@ -1251,7 +1549,10 @@ void RenderContext::ReloadShaders()
 		Shader* currentShader = m_loadedShaders[ shaderIndex ];
 		if( currentShader != nullptr && strcmp( currentShader->GetFilePath(), "" ) != 0)
 		{
-			currentShader->Recompile();
+			++currentShader->m_compileGeneration;
+
+			AssetHandle shaderHandle = m_shaderRegistry.FindHandle( currentShader->GetFilePath() );
+			PostAsyncLoadJob( new ShaderCompileJob( this, shaderHandle, currentShader->GetFilePath(), currentShader->m_compileGeneration ) );
 		}
 	}
 }
@@ -1267,6 +1568,10 @@ void RenderContext::BindShader( Shader* shader )
 	{
 		m_currentShader = m_defaultShader;
 	}
+	else if( !m_currentShader->IsValid() )
+	{
+		m_currentShader = m_errorShader;
+	}
 
 	m_context->VSSetShader( m_currentShader->m_vertexStage.m_vs, nullptr, 0 );
 	m_context->RSSetState( m_rasterState );
@@ -1331,6 +1636,7 @@ bool RenderContext::CreateBitmapFontFromFile( const char* fontFilePath )
 	Texture* fontTexture = CreateOrGetTextureFromFile( fontImagePath.c_str() );
 	BitmapFont* newFont = new BitmapFont( fontFilePath, fontTexture );
 	m_loadedFonts.push_back( newFont );
+	m_fontRegistry.Register( fontFilePath, newFont );
 	return true;
 }
 
@@ -2,6 +2,7 @@
 #include "Engine/Core/Rgba8.hpp"
 #include "Engine/Core/Vertex_PCU.hpp"
 #include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/AssetRegistry.hpp"
 #include "Engine/Renderer/Camera.hpp"
 #include "Engine/Renderer/Texture.hpp"
 #include "Engine/Renderer/Light.hpp"
@@ -26,7 +27,13 @@ class GPUMesh;
 class GPUSubMesh;
 class Clock;
 class ShaderState;
+class ShaderCache;
+class ShaderCompiler;
+struct shader_compile_result_t;
 class Material;
+struct Image;
+struct Vertex_PCUTBN;
+struct mesh_import_options_t;
 struct ID3D11Device;
 struct ID3D11Buffer;
 struct ID3D11DeviceContext;
@@ -181,6 +188,10 @@ public:
 	void		BindShaderStateByPath( const char* filepath );
 	void		BindMaterialByPath( const char* filepath );
 
+	void		BindTextureByHandle( AssetHandle textureHandle );
+	void		BindShaderByHandle( AssetHandle shaderHandle );
+	void		BindMaterialByHandle( AssetHandle materialHandle );
+
 	void		ReloadShaders();
 	Texture*	CreateOrGetTextureFromFile( const char* imageFilePath );
 	BitmapFont* CreateOrGetBitmapFontFromFile( const char* imageFilePath );
@@ -200,6 +211,25 @@ public:
 	ShaderState*	GetOrCreateShaderStateFromFile( char const* filepath );
 	Material*		GetOrCreateMaterialFromFile( char const* filepath );
 
+	//Handle Methods - resolve the path once, then look up by index
+	AssetHandle	GetOrCreateTextureHandle( char const* imageFilePath );
+	AssetHandle	GetOrCreateShaderHandle( char const* filename );
+	AssetHandle	GetOrCreateMaterialHandle( char const* filepath );
+	Texture*	GetTexture( AssetHandle textureHandle ) const;
+	Shader*		GetShader( AssetHandle shaderHandle ) const;
+	Material*	GetMaterial( AssetHandle materialHandle ) const;
+	bool		IsShaderHandleStale( AssetHandle shaderHandle ) const		{ return m_shaderRegistry.IsStale( shaderHandle ); }
+
+	//Async Loading - handles resolve to a placeholder until the worker finishes and the asset is uploaded
+	AssetHandle	RequestTextureAsync( char const* imageFilePath );
+	AssetHandle	RequestMeshAsync( char const* objFilePath, mesh_import_options_t const& options );
+	GPUMesh*	GetMesh( AssetHandle meshHandle ) const;
+	void		FinalizeAsyncTextureLoad( AssetHandle textureHandle, Image const& image );
+	void		FinalizeAsyncMeshLoad( AssetHandle meshHandle, std::vector<Vertex_PCUTBN>& verticies, std::vector<uint> const& subMeshVertOffsets );
+	void		FinalizeAsyncShaderCompile( AssetHandle shaderHandle, uint compileGeneration, shader_compile_result_t const& vertexResult, shader_compile_result_t const& fragmentResult );
+	ShaderCache*	GetShaderCache() const								{ return m_shaderCache; }
+	Texture*	CreateTextureFromImage( Image const& image, bool generateMips = false );
+
 	void ApplyFullscreenEffect( Texture* source, Texture* destination, Material* fullscreenMaterial );
 	void BeginFullscreenEffect( Texture* source, Texture* destination, Shader* fullscreenShader );
 	void EndFullscreenEffect();
@@ -266,6 +296,14 @@ private:
 	std::vector<Shader*>		m_loadedShaders;
 	std::vector<ShaderState*>	m_loadedShaderStates;
 	std::vector<Material*>		m_loadedMaterials;
+	std::vector<GPUMesh*>		m_loadedMeshes;
+
+	AssetRegistry<Texture>		m_textureRegistry;
+	AssetRegistry<BitmapFont>	m_fontRegistry;
+	AssetRegistry<Shader>		m_shaderRegistry;
+	AssetRegistry<ShaderState>	m_shaderStateRegistry;
+	AssetRegistry<Material>		m_materialRegistry;
+	AssetRegistry<GPUMesh>		m_meshRegistry;
 
 public:
 	void*						m_debugModule				= nullptr;
@@ -279,8 +317,11 @@ public:
 	Shader*						m_currentShader				= nullptr;
 	Shader*						m_defaultShader				= nullptr;
 	Shader*						m_errorShader				= nullptr;
+	ShaderCompiler*				m_shaderCompiler			= nullptr;
+	ShaderCache*				m_shaderCache				= nullptr;
 	Texture*					m_textueDefaultColor		= nullptr;
 	Texture*					m_textureDefaultNormalColor	= nullptr;
+	GPUMesh*					m_meshPlaceholder			= nullptr;
 	Sampler*					m_samplerPoint				= nullptr;
 	Sampler*					m_samplerLinear				= nullptr;
 	VertexBuffer*				m_immediateVBO				= nullptr;
@@ -1,158 +1,90 @@
 #include "Engine/Renderer/Shader.hpp"
 #include "Engine/Renderer/D3D11Common.hpp"
 #include "Engine/Renderer/RenderContext.hpp"
+#include "Engine/Renderer/ShaderCache.hpp"
 #include "Engine/Renderer/buffer_attribute_t.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/FileUtils.hpp"
 
-#include <d3dcompiler.h>
-
 #define DEBUG_SHADERS
 //---------------------------------------------------------------------------------------------------------
-static char const* GetDefaultEntryPointForStage( ShaderType type )
+ShaderStage::~ShaderStage()
 {
-	switch( type )
-	{
-	case SHADER_TYPE_VERTEX:
-		return "VertexFunction";
-	case SHADER_TYPE_FRAGMENT:
-		return "FragmentFunction";
-	default:
-		GUARANTEE_OR_DIE( false, "Bad Stage" );
-		break;
-	}
+	DX_SAFE_RELEASE( m_handle );
 }
 
 
 //---------------------------------------------------------------------------------------------------------
-static char const* GetShaderModelForStage( ShaderType type )
+bool ShaderStage::Compile( RenderContext* ctx, std::string const& filename, void const* source, size_t const sourceByteLen, ShaderType stage )
 {
-	switch( type )
+	shader_compile_desc_t desc = Shader::MakeCompileDesc( filename, source, sourceByteLen, stage );
+	shader_compile_result_t result;
+	if( !ctx->GetShaderCache()->GetOrCompile( desc, result ) )
 	{
-	case SHADER_TYPE_VERTEX:
-		return "vs_5_0";
-	case SHADER_TYPE_FRAGMENT:
-		return "ps_5_0";
-	default:
-		GUARANTEE_OR_DIE( false, "Unknown shader stage" );
-		break;
+		DebuggerPrintf( "Failed to compile [%s].  Compiler gave the following output;\n%s",
+			filename.c_str(),
+			result.errors.c_str() );
+		return false;
 	}
+
+	return CreateFromByteCode( ctx, result.byteCode, stage );
 }
 
 
 //---------------------------------------------------------------------------------------------------------
-ShaderStage::~ShaderStage()
+bool ShaderStage::CreateFromByteCode( RenderContext* ctx, std::vector<unsigned char> const& byteCode, ShaderType stage )
 {
-	DX_SAFE_RELEASE( m_byteCode );
 	DX_SAFE_RELEASE( m_handle );
-}
+	m_byteCode.clear();
 
-
-//---------------------------------------------------------------------------------------------------------
-bool ShaderStage::Compile( RenderContext* ctx, std::string const& filename, void const* source, size_t const sourceByteLen, ShaderType stage )
-{
-	if( IsValid() )
+	ID3D11Device* device = ctx->m_device;
+	HRESULT hr = E_FAIL;
+	switch( stage )
 	{
-		DX_SAFE_RELEASE( m_byteCode );
-		DX_SAFE_RELEASE( m_handle );
+	case SHADER_TYPE_VERTEX:
+		hr = device->CreateVertexShader( byteCode.data(), byteCode.size(), nullptr, &m_vs );
+		break;
+	case SHADER_TYPE_FRAGMENT:
+		hr = device->CreatePixelShader( byteCode.data(), byteCode.size(), nullptr, &m_fs );
+		break;
+	default:
+		GUARANTEE_OR_DIE( false, "Unimplemented Stage" );
+		break;
 	}
 
-	char const* entrypoint = GetDefaultEntryPointForStage( stage );
-	char const* shaderModel = GetShaderModelForStage( stage );
-	
-	DWORD compileFlags = 0U;
-	#if defined( DEBUG_SHADERS )
-		compileFlags |= D3DCOMPILE_DEBUG;
-		compileFlags |= D3DCOMPILE_SKIP_OPTIMIZATION;
-		//compile_flags |= D3DCOMPILE_WARNINGS_ARE_ERRORS;   // cause, FIX YOUR WARNINGS
-	#else 
-		// compile_flags |= D3DCOMPILE_SKIP_VALIDATION;       // Only do this if you know for a fact this shader works with this device (so second run through of a game)
-		compileFlags |= D3DCOMPILE_OPTIMIZATION_LEVEL3;   // Yay, fastness (default is level 1)
-	#endif
-
-		ID3DBlob* byteCode	= nullptr;
-		ID3DBlob* errors	= nullptr;
-
-	HRESULT hr = ::D3DCompile( source,
-		sourceByteLen,						// plain text source code
-		filename.c_str(),                   // optional, used for error messages (If you HLSL has includes - it will not use the includes names, it will use this name)
-		nullptr,                            // pre-compiler defines - used more for compiling multiple versions of a single shader (different quality specs, or shaders that are mostly the same outside some constants)
-		D3D_COMPILE_STANDARD_FILE_INCLUDE,  // include rules - this allows #includes in the shader to work relative to the src_file path or my current working directly
-		entrypoint,                         // Entry Point for this shader
-		shaderModel,                        // Compile Target (MSDN - "Specifying Compiler Targets")
-		compileFlags,						// Flags that control compilation
-		0,                                  // Effect Flags (we will not be doing Effect Files)
-		&byteCode,							// [OUT] ID3DBlob (buffer) that will store the byte code.
-		&errors );                          // [OUT] ID3DBlob (buffer) that will store error information
-
-
+	// Bytecode comes off disk now, so a bad blob is a failed load rather than a fatal error
 	if( FAILED( hr ) )
 	{
-		if( errors != nullptr ) {
-			char* errorString = (char*) errors->GetBufferPointer();
-			DebuggerPrintf( "Failed to compile [%s].  Compiler gave the following output;\n%s",
-				filename.c_str(),
-				errorString );
-			DX_SAFE_RELEASE( errors );
-
-			//DEBUGBREAK();
-		}
-		else {
-			DebuggerPrintf( "Failed with HRESULT: %u", hr );
-		}
+		DX_SAFE_RELEASE( m_handle );
 		return false;
 	}
-	else
-	{
-		ID3D11Device* device = ctx->m_device;
-		void const* byteCodePtr = byteCode->GetBufferPointer();
-		size_t byteCodeSize = byteCode->GetBufferSize();
-
-		switch( stage )
-		{
-		case SHADER_TYPE_VERTEX:
-			hr = device->CreateVertexShader( byteCodePtr, byteCodeSize, nullptr, &m_vs );
-			GUARANTEE_OR_DIE( SUCCEEDED( hr ), "Failed to link shader stage" );
-			break;
-		case SHADER_TYPE_FRAGMENT:
-			hr = device->CreatePixelShader( byteCodePtr, byteCodeSize, nullptr, &m_fs );
-			GUARANTEE_OR_DIE( SUCCEEDED( hr ), "Failed to link shader stage" );
-			break;
-		default:
-			GUARANTEE_OR_DIE( false, "Unimplemented Stage" );
-			break;
-		}
-	}
-
-	DX_SAFE_RELEASE( errors );
-
-	if( stage == SHADER_TYPE_VERTEX )
-	{
-		m_byteCode = byteCode;
-	}
-	else
-	{
-		DX_SAFE_RELEASE( byteCode );
-		m_byteCode = nullptr;
-	}
 
+	m_byteCode = byteCode;
 	m_type = stage;
-
 	return IsValid();
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+void ShaderStage::Swap( ShaderStage& other )
+{
+	std::swap( m_type, other.m_type );
+	std::swap( m_byteCode, other.m_byteCode );
+	std::swap( m_handle, other.m_handle );
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 void const* ShaderStage::GetByteCode() const
 {
-	return m_byteCode->GetBufferPointer();
+	return m_byteCode.data();
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 size_t ShaderStage::GetByteCodeLength() const
 {
-	return m_byteCode->GetBufferSize();
+	return m_byteCode.size();
 }
 
 //---------------------------------------------------------------------------------------------------------
@@ -179,12 +111,25 @@ bool Shader::Recompile()
 		return false;
 	}
 
-	m_vertexStage.Compile( m_owner, m_filePath, source, file_size, SHADER_TYPE_VERTEX );
-	m_fragmentStage.Compile( m_owner, m_filePath, source, file_size, SHADER_TYPE_FRAGMENT );
+	// Compile into scratch stages so a typo leaves the working shader bound
+	ShaderStage vertexStage;
+	ShaderStage fragmentStage;
+	vertexStage.Compile( m_owner, m_filePath, source, file_size, SHADER_TYPE_VERTEX );
+	fragmentStage.Compile( m_owner, m_filePath, source, file_size, SHADER_TYPE_FRAGMENT );
 
 	delete[] source;
 
-	return m_vertexStage.IsValid() && m_fragmentStage.IsValid();
+	if( !vertexStage.IsValid() || !fragmentStage.IsValid() )
+	{
+		return false;
+	}
+
+	m_vertexStage.Swap( vertexStage );
+	m_fragmentStage.Swap( fragmentStage );
+
+	DX_SAFE_RELEASE( m_inputLayout );
+	m_lastBoundLayout = nullptr;
+	return true;
 }
 
 
@@ -220,6 +165,77 @@ bool Shader::CreateFromSourceCode( const char* sourceCode )
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+// Only succeeds when both stages are already in the bytecode cache; never invokes the compiler
+bool Shader::CreateFromCache( std::string const& filename )
+{
+	m_filePath = filename;
+	size_t file_size = 0;
+	void* source = FileReadToNewBuffer( filename, &file_size );
+	if( source == nullptr )
+	{
+		return false;
+	}
+
+	ShaderCache* shaderCache = m_owner->GetShaderCache();
+	shader_compile_result_t vertexResult;
+	shader_compile_result_t fragmentResult;
+	bool isCached = shaderCache->TryLoad( MakeCompileDesc( filename, source, file_size, SHADER_TYPE_VERTEX ), vertexResult )
+				 && shaderCache->TryLoad( MakeCompileDesc( filename, source, file_size, SHADER_TYPE_FRAGMENT ), fragmentResult );
+
+	delete[] source;
+
+	return isCached && SetByteCode( vertexResult.byteCode, fragmentResult.byteCode );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Swaps in both stages together, or neither
+bool Shader::SetByteCode( std::vector<unsigned char> const& vertexByteCode, std::vector<unsigned char> const& fragmentByteCode )
+{
+	ShaderStage vertexStage;
+	ShaderStage fragmentStage;
+	if( !vertexStage.CreateFromByteCode( m_owner, vertexByteCode, SHADER_TYPE_VERTEX ) ||
+		!fragmentStage.CreateFromByteCode( m_owner, fragmentByteCode, SHADER_TYPE_FRAGMENT ) )
+	{
+		return false;
+	}
+
+	m_vertexStage.Swap( vertexStage );
+	m_fragmentStage.Swap( fragmentStage );
+
+	DX_SAFE_RELEASE( m_inputLayout );
+	m_lastBoundLayout = nullptr;
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool Shader::IsValid() const
+{
+	return m_vertexStage.IsValid() && m_fragmentStage.IsValid();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+STATIC shader_compile_desc_t Shader::MakeCompileDesc( std::string const& filename, void const* source, size_t sourceByteLen, ShaderType stage )
+{
+	shader_compile_desc_t desc;
+	desc.filename	= filename;
+	desc.source.assign( static_cast<char const*>( source ), sourceByteLen );
+	desc.stage		= stage;
+
+	#if defined( DEBUG_SHADERS )
+		desc.flags |= SHADER_COMPILE_DEBUG;
+		desc.flags |= SHADER_COMPILE_SKIP_OPTIMIZATION;
+	#else 
+		desc.flags |= SHADER_COMPILE_OPTIMIZE_FULLY;   // Yay, fastness (default is level 1)
+	#endif
+
+	return desc;
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 const char* Shader::GetFilePath() const
 {
@@ -1,20 +1,15 @@
 #pragma once
+#include "Engine/Renderer/ShaderCompiler.hpp"
 #include <string>
+#include <vector>
 
 class	RenderContext;
 struct	buffer_attribute_t;
 struct	ID3D11Resource;
 struct	ID3D11VertexShader;
 struct	ID3D11PixelShader;
-struct	ID3D10Blob;
 struct	ID3D11InputLayout;
 
-enum ShaderType
-{
-	SHADER_TYPE_VERTEX,
-	SHADER_TYPE_FRAGMENT,
-};
-
 class ShaderStage
 {
 public:
@@ -24,6 +19,8 @@ public:
 					void const* source,
 					size_t const sourceByteLen,
 					ShaderType stage );
+	bool CreateFromByteCode( RenderContext* ctx, std::vector<unsigned char> const& byteCode, ShaderType stage );
+	void Swap( ShaderStage& other );
 
 	bool IsValid() const	{ return ( m_handle != nullptr ); }
 
@@ -32,11 +29,11 @@ public:
 
 
 public:
-	ShaderType m_type;
-	ID3D10Blob* m_byteCode = nullptr;
+	ShaderType m_type = SHADER_TYPE_VERTEX;
+	std::vector<unsigned char> m_byteCode;
 	union
 	{
-		ID3D11Resource		*m_handle;
+		ID3D11Resource		*m_handle = nullptr;
 		ID3D11VertexShader	*m_vs;
 		ID3D11PixelShader	*m_fs;
 	};
@@ -50,16 +47,22 @@ public:
 	bool Recompile();
 	bool CreateFromFile( std::string const& filename );
 	bool CreateFromSourceCode( const char* sourceCode );
+	bool CreateFromCache( std::string const& filename );
+	bool SetByteCode( std::vector<unsigned char> const& vertexByteCode, std::vector<unsigned char> const& fragmentByteCode );
 
+	bool				IsValid() const;
 	const char*			GetFilePath() const;
 	ID3D11InputLayout*	GetOrCreateInputLayout( buffer_attribute_t const* attribute );
 
+	static shader_compile_desc_t MakeCompileDesc( std::string const& filename, void const* source, size_t sourceByteLen, ShaderType stage );
+
 public:
 	std::string m_filePath = "";
 
 	ShaderStage m_vertexStage;
 	ShaderStage m_fragmentStage;
 	RenderContext* m_owner = nullptr;
+	uint m_compileGeneration = 0;	// bumped per async recompile so a slow, older result can't land last
 
 	buffer_attribute_t const* m_lastBoundLayout = nullptr;
 	ID3D11InputLayout* m_inputLayout = nullptr;
@@ -0,0 +1,257 @@
+#include "Engine/Renderer/ShaderCache.hpp"
+#include "Engine/Core/FileUtils.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include <string.h>
+
+
+//---------------------------------------------------------------------------------------------------------
+struct shader_cache_header_t
+{
+	uint32_t	magic			= 0;
+	uint32_t	version			= 0;
+	uint64_t	cacheKey		= 0;
+	uint32_t	byteCodeSize	= 0;
+	uint32_t	includeCount	= 0;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Followed by pathLength characters of path (no terminator)
+struct shader_cache_include_t
+{
+	uint64_t	contentHash		= 0;
+	uint32_t	pathLength		= 0;
+	uint32_t	padding			= 0;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+static uint64_t HashString64( std::string const& string, uint64_t hash )
+{
+	// Hash the terminator too so "ab"+"c" and "a"+"bc" don't collide
+	return HashBytes64( string.c_str(), string.length() + 1, hash );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static bool HashFileContents( std::string const& filepath, uint64_t* out_hash )
+{
+	size_t fileSize = 0;
+	unsigned char* fileData = static_cast<unsigned char*>( FileReadBinaryToNewBuffer( filepath, &fileSize ) );
+	if( fileData == nullptr )
+	{
+		return false;
+	}
+
+	*out_hash = HashBytes64( fileData, fileSize );
+	delete[] fileData;
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+static std::string GetFolderOfFile( std::string const& filepath )
+{
+	size_t lastSlash = filepath.find_last_of( "/\\" );
+	if( lastSlash == std::string::npos )
+	{
+		return "";
+	}
+	return filepath.substr( 0, lastSlash + 1 );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+ShaderCache::ShaderCache( ShaderCompiler* compiler, std::string const& cacheFolder )
+	: m_compiler( compiler )
+	, m_cacheFolder( cacheFolder )
+{
+	CreateFolder( m_cacheFolder );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool ShaderCache::GetOrCompile( shader_compile_desc_t const& desc, shader_compile_result_t& out_result )
+{
+	if( TryLoad( desc, out_result ) )
+	{
+		++m_hitCount;
+		return true;
+	}
+
+	++m_missCount;
+	out_result = shader_compile_result_t();
+	if( !m_compiler->Compile( desc, out_result ) )
+	{
+		out_result.isSuccess = false;
+		return false;
+	}
+
+	out_result.isSuccess = true;
+	Store( GetCacheKey( desc ), out_result );
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool ShaderCache::TryLoad( shader_compile_desc_t const& desc, shader_compile_result_t& out_result ) const
+{
+	uint64_t cacheKey = GetCacheKey( desc );
+
+	size_t fileSize = 0;
+	unsigned char* fileData = static_cast<unsigned char*>( FileReadBinaryToNewBuffer( GetCacheFilepath( cacheKey ), &fileSize ) );
+	if( fileData == nullptr )
+	{
+		return false;
+	}
+
+	// Anything short, stale or torn by a concurrent write is treated as a miss and simply recompiled
+	bool isValid = false;
+	Strings includedFiles;
+	size_t readOffset = sizeof( shader_cache_header_t );
+	shader_cache_header_t header;
+	if( fileSize >= sizeof( header ) )
+	{
+		memcpy( &header, fileData, sizeof( header ) );
+		isValid = header.magic == SHADER_CACHE_MAGIC && header.version == SHADER_CACHE_VERSION && header.cacheKey == cacheKey;
+	}
+
+	for( uint32_t includeIndex = 0; isValid && includeIndex < header.includeCount; ++includeIndex )
+	{
+		shader_cache_include_t include;
+		if( readOffset + sizeof( include ) > fileSize )
+		{
+			isValid = false;
+			break;
+		}
+		memcpy( &include, fileData + readOffset, sizeof( include ) );
+		readOffset += sizeof( include );
+
+		if( readOffset + include.pathLength > fileSize )
+		{
+			isValid = false;
+			break;
+		}
+		std::string includePath( reinterpret_cast<char const*>( fileData + readOffset ), include.pathLength );
+		readOffset += include.pathLength;
+
+		uint64_t currentHash = 0;
+		isValid = HashFileContents( includePath, &currentHash ) && currentHash == include.contentHash;
+		includedFiles.push_back( includePath );
+	}
+
+	if( isValid && readOffset + header.byteCodeSize == fileSize && header.byteCodeSize > 0 )
+	{
+		out_result.isSuccess		= true;
+		out_result.wasCacheHit		= true;
+		out_result.errors.clear();
+		out_result.includedFiles	= includedFiles;
+		out_result.byteCode.assign( fileData + readOffset, fileData + fileSize );
+	}
+	else
+	{
+		isValid = false;
+	}
+
+	delete[] fileData;
+	return isValid;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// The folder is part of the key because #includes resolve against it; the same text elsewhere is a
+// different shader.
+//---------------------------------------------------------------------------------------------------------
+uint64_t ShaderCache::GetCacheKey( shader_compile_desc_t const& desc ) const
+{
+	uint64_t hash = HashBytes64( nullptr, 0 );
+	hash = HashString64( m_compiler->GetCompilerID(), hash );
+	hash = HashString64( GetFolderOfFile( desc.filename ), hash );
+
+	uint32_t stage = static_cast<uint32_t>( desc.stage );
+	hash = HashBytes64( &stage, sizeof( stage ), hash );
+	hash = HashBytes64( &desc.flags, sizeof( desc.flags ), hash );
+
+	uint32_t defineCount = static_cast<uint32_t>( desc.defines.size() );
+	hash = HashBytes64( &defineCount, sizeof( defineCount ), hash );
+	for( size_t defineIndex = 0; defineIndex < desc.defines.size(); ++defineIndex )
+	{
+		hash = HashString64( desc.defines[ defineIndex ], hash );
+	}
+
+	return HashString64( desc.source, hash );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void ShaderCache::Store( uint64_t cacheKey, shader_compile_result_t const& result ) const
+{
+	shader_cache_header_t header;
+	header.magic		= SHADER_CACHE_MAGIC;
+	header.version		= SHADER_CACHE_VERSION;
+	header.cacheKey		= cacheKey;
+	header.byteCodeSize	= static_cast<uint32_t>( result.byteCode.size() );
+	header.includeCount	= 0;
+
+	std::vector<unsigned char> fileData( sizeof( header ) );
+	for( size_t includeIndex = 0; includeIndex < result.includedFiles.size(); ++includeIndex )
+	{
+		std::string const& includePath = result.includedFiles[ includeIndex ];
+
+		shader_cache_include_t include;
+		if( !HashFileContents( includePath, &include.contentHash ) )
+		{
+			// Can't prove the entry is still valid next time, so don't write one
+			return;
+		}
+		include.pathLength = static_cast<uint32_t>( includePath.length() );
+
+		unsigned char const* includeBytes = reinterpret_cast<unsigned char const*>( &include );
+		fileData.insert( fileData.end(), includeBytes, includeBytes + sizeof( include ) );
+		fileData.insert( fileData.end(), includePath.begin(), includePath.end() );
+		++header.includeCount;
+	}
+
+	memcpy( fileData.data(), &header, sizeof( header ) );
+	fileData.insert( fileData.end(), result.byteCode.begin(), result.byteCode.end() );
+	FileWriteFromBuffer( GetCacheFilepath( cacheKey ), fileData.data(), fileData.size() );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+std::string ShaderCache::GetCacheFilepath( uint64_t cacheKey ) const
+{
+	return Stringf( "%s/%016llx.sbc", m_cacheFolder.c_str(), static_cast<unsigned long long>( cacheKey ) );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+//---------------------------------------------------------------------------------------------------------
+ShaderProgramCompileJob::ShaderProgramCompileJob( ShaderCache* shaderCache, shader_compile_desc_t const& programDesc )
+	: AsyncLoadJob( JOB_CATEGORY_RENDER_ASSET_LOADING, programDesc.filename )
+	, m_shaderCache( shaderCache )
+	, m_programDesc( programDesc )
+{
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void ShaderProgramCompileJob::ExecuteLoad()
+{
+	size_t sourceSize = 0;
+	void* source = FileReadToNewBuffer( m_filepath, &sourceSize );
+	if( source == nullptr )
+	{
+		m_vertexResult.errors = Stringf( "Could not read %s", m_filepath.c_str() );
+		return;
+	}
+
+	shader_compile_desc_t stageDesc = m_programDesc;
+	stageDesc.source.assign( static_cast<char const*>( source ), sourceSize );
+	delete[] static_cast<unsigned char*>( source );
+
+	stageDesc.stage = SHADER_TYPE_VERTEX;
+	m_shaderCache->GetOrCompile( stageDesc, m_vertexResult );
+	stageDesc.stage = SHADER_TYPE_FRAGMENT;
+	m_shaderCache->GetOrCompile( stageDesc, m_fragmentResult );
+}
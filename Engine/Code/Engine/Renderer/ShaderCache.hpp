@@ -0,0 +1,66 @@
+#pragma once
+#include "Engine/Renderer/ShaderCompiler.hpp"
+#include "Engine/Core/AsyncLoadJob.hpp"
+#include <atomic>
+#include <stdint.h>
+#include <string>
+
+
+//---------------------------------------------------------------------------------------------------------
+// Content-addressed bytecode cache on disk. An entry is keyed by a hash of the compiler ID, stage, flags,
+// defines and source text, and also records every file the source #included along with a hash of its
+// contents, so editing an include invalidates the entries that pulled it in. All calls are thread-safe.
+//---------------------------------------------------------------------------------------------------------
+class ShaderCache
+{
+public:
+	ShaderCache( ShaderCompiler* compiler, std::string const& cacheFolder );
+	~ShaderCache() {}
+
+	bool				GetOrCompile( shader_compile_desc_t const& desc, shader_compile_result_t& out_result );
+	bool				TryLoad( shader_compile_desc_t const& desc, shader_compile_result_t& out_result ) const;
+
+	uint64_t			GetCacheKey( shader_compile_desc_t const& desc ) const;
+	ShaderCompiler*		GetCompiler() const					{ return m_compiler; }
+	uint				GetHitCount() const					{ return m_hitCount; }
+	uint				GetMissCount() const				{ return m_missCount; }
+
+public:
+	static constexpr uint32_t	SHADER_CACHE_MAGIC		= 0x31434253;	// "SBC1"
+	static constexpr uint32_t	SHADER_CACHE_VERSION	= 1;
+
+private:
+	void				Store( uint64_t cacheKey, shader_compile_result_t const& result ) const;
+	std::string			GetCacheFilepath( uint64_t cacheKey ) const;
+
+private:
+	ShaderCompiler*				m_compiler		= nullptr;
+	std::string					m_cacheFolder	= "";
+	std::atomic<uint>			m_hitCount		= 0;
+	std::atomic<uint>			m_missCount		= 0;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Reads a shader file and gets both stages from the cache (compiling them on a miss) on a job worker. The
+// job never touches the shader it is for; whoever finishes it swaps the bytecode in from FinalizeLoad, and
+// only when IsSuccess(), so the previous bytecode (or the error shader) stays bound until then.
+//---------------------------------------------------------------------------------------------------------
+class ShaderProgramCompileJob : public AsyncLoadJob
+{
+public:
+	ShaderProgramCompileJob( ShaderCache* shaderCache, shader_compile_desc_t const& programDesc );
+
+	bool							IsSuccess() const				{ return m_vertexResult.isSuccess && m_fragmentResult.isSuccess; }
+	shader_compile_result_t const&	GetVertexResult() const			{ return m_vertexResult; }
+	shader_compile_result_t const&	GetFragmentResult() const		{ return m_fragmentResult; }
+
+protected:
+	virtual void ExecuteLoad() override;
+
+protected:
+	ShaderCache*			m_shaderCache		= nullptr;
+	shader_compile_desc_t	m_programDesc;		// everything but the source and stage, which ExecuteLoad fills in
+	shader_compile_result_t	m_vertexResult;
+	shader_compile_result_t	m_fragmentResult;
+};
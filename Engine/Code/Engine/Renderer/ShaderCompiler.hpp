@@ -0,0 +1,58 @@
+#pragma once
+#include "Engine/Core/EngineCommon.hpp"
+#include <string>
+#include <vector>
+
+
+//---------------------------------------------------------------------------------------------------------
+enum ShaderType
+{
+	SHADER_TYPE_VERTEX,
+	SHADER_TYPE_FRAGMENT,
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+enum ShaderCompileFlag : uint
+{
+	SHADER_COMPILE_DEBUG				= 1 << 0,
+	SHADER_COMPILE_SKIP_OPTIMIZATION	= 1 << 1,
+	SHADER_COMPILE_OPTIMIZE_FULLY		= 1 << 2,
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+struct shader_compile_desc_t
+{
+	std::string	filename;			// error messages, and the folder #includes are resolved against
+	std::string	source;
+	ShaderType	stage		= SHADER_TYPE_VERTEX;
+	Strings		defines;			// "NAME" or "NAME=VALUE"
+	uint		flags		= 0;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+struct shader_compile_result_t
+{
+	bool						isSuccess		= false;
+	bool						wasCacheHit		= false;
+	std::vector<unsigned char>	byteCode;
+	std::string					errors;
+	Strings						includedFiles;	// paths as opened, so the cache can tell when one changes
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Turns shader source into bytecode. Compile() is called from worker threads, so implementations must be
+// thread-safe. The ID goes into every cache key - change it whenever the same input would compile to
+// different output.
+//---------------------------------------------------------------------------------------------------------
+class ShaderCompiler
+{
+public:
+	virtual ~ShaderCompiler() {}
+
+	virtual bool		Compile( shader_compile_desc_t const& desc, shader_compile_result_t& out_result ) = 0;
+	virtual char const*	GetCompilerID() const = 0;
+};
\ No newline at end of file
@@ -17,6 +17,12 @@ public:
 
 	const SpriteDefinition& GetSpriteDefAtTime( float seconds ) const;
 
+	const SpriteSheet&		GetSpriteSheet() const			{ return m_spriteSheet; }
+	int						GetStartSpriteIndex() const		{ return m_startSpriteIndex; }
+	int						GetEndSpriteIndex() const		{ return m_endSpriteIndex; }
+	float					GetDurationSeconds() const		{ return m_durationSeconds; }
+	SpriteAnimPlayBackType	GetPlaybackType() const			{ return m_playbackType; }
+
 private:
 	const SpriteDefinition& GetSpriteDefAtTimeForPlaybackTypeOnce( float seconds ) const;
 	const SpriteDefinition& GetSpriteDefAtTimeForPlaybackTypeLoop( float seconds ) const;
@@ -0,0 +1,291 @@
+#include "Engine/Renderer/SpriteAnimSystem.hpp"
+#include "Engine/Renderer/SpriteAnimDefinition.hpp"
+#include "Engine/Renderer/SpriteSheet.hpp"
+#include "Engine/Renderer/Texture.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/Time.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include <math.h>
+
+
+//---------------------------------------------------------------------------------------------------------
+uint32_t SpriteAnimClipTable::AddClip( SpriteAnimDefinition const& animDef )
+{
+	int startSpriteIndex = animDef.GetStartSpriteIndex();
+	int endSpriteIndex = animDef.GetEndSpriteIndex();
+	int step = ( endSpriteIndex >= startSpriteIndex ) ? 1 : -1;
+
+	clip_t clip;
+	clip.spriteSheet		= &animDef.GetSpriteSheet();
+	clip.firstFrame			= static_cast<uint32_t>( m_frameSpriteIndices.size() );
+	clip.durationSeconds	= animDef.GetDurationSeconds();
+	clip.isLooping			= animDef.GetPlaybackType() != SpriteAnimPlayBackType::ONCE;
+
+	for( int spriteIndex = startSpriteIndex; spriteIndex != endSpriteIndex + step; spriteIndex += step )
+	{
+		m_frameSpriteIndices.push_back( spriteIndex );
+	}
+
+	// Back down again without repeating either end, so the loop point doesn't hold a frame twice
+	if( animDef.GetPlaybackType() == SpriteAnimPlayBackType::PINGPONG )
+	{
+		for( int spriteIndex = endSpriteIndex - step; spriteIndex != startSpriteIndex; spriteIndex -= step )
+		{
+			m_frameSpriteIndices.push_back( spriteIndex );
+		}
+	}
+
+	clip.frameCount = static_cast<uint32_t>( m_frameSpriteIndices.size() ) - clip.firstFrame;
+	clip.framesPerSecond = clip.durationSeconds > 0.f ? static_cast<float>( clip.frameCount ) / clip.durationSeconds : 0.f;
+
+	m_frameUVs.resize( m_frameSpriteIndices.size() );
+	m_clips.push_back( clip );
+
+	uint32_t clipIndex = static_cast<uint32_t>( m_clips.size() ) - 1;
+	for( uint32_t frameIndex = clip.firstFrame; frameIndex < clip.firstFrame + clip.frameCount; ++frameIndex )
+	{
+		AABB2& frameUVs = m_frameUVs[ frameIndex ];
+		clip.spriteSheet->GetSpriteUVs( frameUVs.mins, frameUVs.maxes, m_frameSpriteIndices[ frameIndex ] );
+	}
+	return clipIndex;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void SpriteAnimClipTable::RefreshFrameUVs()
+{
+	for( uint32_t clipIndex = 0; clipIndex < m_clips.size(); ++clipIndex )
+	{
+		clip_t const& clip = m_clips[ clipIndex ];
+		for( uint32_t frameIndex = clip.firstFrame; frameIndex < clip.firstFrame + clip.frameCount; ++frameIndex )
+		{
+			AABB2& frameUVs = m_frameUVs[ frameIndex ];
+			clip.spriteSheet->GetSpriteUVs( frameUVs.mins, frameUVs.maxes, m_frameSpriteIndices[ frameIndex ] );
+		}
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void SpriteAnimClipTable::Clear()
+{
+	m_clips.clear();
+	m_frameUVs.clear();
+	m_frameSpriteIndices.clear();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+AABB2 const& SpriteAnimClipTable::GetFrameUVs( uint32_t clipIndex, float seconds ) const
+{
+	return m_frameUVs[ GetFrameIndex( m_clips[ clipIndex ], seconds ) ];
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+uint32_t SpriteAnimClipTable::GetFrameIndex( clip_t const& clip, float seconds ) const
+{
+	int frameNumber = RoundDownToInt( seconds * clip.framesPerSecond );
+	uint32_t frame = static_cast<uint32_t>( frameNumber > 0 ? frameNumber : 0 );
+	frame = clip.isLooping ? ( frame % clip.frameCount ) : Min( frame, clip.frameCount - 1 );
+	return clip.firstFrame + frame;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+SpriteAnimSystem::SpriteAnimSystem( SpriteAnimClipTable const& clips, uint32_t maxInstances )
+	: m_clips( clips )
+	, m_instances( maxInstances )
+{
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+PoolHandle SpriteAnimSystem::CreateInstance( uint32_t clipIndex, float playbackSpeed )
+{
+	GUARANTEE_OR_DIE( clipIndex < m_clips.GetClipCount(), Stringf( "Sprite anim clip #%u does not exist", clipIndex ) );
+
+	sprite_anim_instance_t instance;
+	instance.clipIndex		= clipIndex;
+	instance.playbackSpeed	= playbackSpeed;
+	instance.uvs			= m_clips.GetFrameUVs( clipIndex, 0.f );
+	return m_instances.Create( instance );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void SpriteAnimSystem::DestroyInstance( PoolHandle instance )
+{
+	m_instances.Destroy( instance );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void SpriteAnimSystem::ClearInstances()
+{
+	m_instances.Clear();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Switching direction mid-walk should keep the walk cycle's place, so restart is optional
+//---------------------------------------------------------------------------------------------------------
+void SpriteAnimSystem::SetInstanceClip( PoolHandle instance, uint32_t clipIndex, bool restart )
+{
+	GUARANTEE_OR_DIE( clipIndex < m_clips.GetClipCount(), Stringf( "Sprite anim clip #%u does not exist", clipIndex ) );
+
+	sprite_anim_instance_t* animInstance = m_instances.Get( instance );
+	if( animInstance == nullptr )
+		return;
+
+	animInstance->clipIndex = clipIndex;
+	if( restart )
+	{
+		animInstance->seconds = 0.f;
+	}
+	animInstance->uvs = m_clips.GetFrameUVs( clipIndex, animInstance->seconds );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void SpriteAnimSystem::SetInstancePlaybackSpeed( PoolHandle instance, float playbackSpeed )
+{
+	sprite_anim_instance_t* animInstance = m_instances.Get( instance );
+	if( animInstance != nullptr )
+	{
+		animInstance->playbackSpeed = playbackSpeed;
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void SpriteAnimSystem::Update( float deltaSeconds )
+{
+	std::vector<SpriteAnimClipTable::clip_t> const& clips = m_clips.m_clips;
+	std::vector<AABB2> const& frameUVs = m_clips.m_frameUVs;
+
+	uint32_t instanceCount = m_instances.GetCount();
+	for( uint32_t instanceIndex = 0; instanceIndex < instanceCount; ++instanceIndex )
+	{
+		sprite_anim_instance_t& instance = m_instances[ instanceIndex ];
+		SpriteAnimClipTable::clip_t const& clip = clips[ instance.clipIndex ];
+
+		// Wrapped (or held at the end) so a long-lived clock never gets big enough to lose frame precision
+		float seconds = instance.seconds + ( deltaSeconds * instance.playbackSpeed );
+		if( seconds >= clip.durationSeconds )
+		{
+			seconds = clip.isLooping ? fmodf( seconds, clip.durationSeconds ) : clip.durationSeconds;
+		}
+
+		instance.seconds = seconds;
+		instance.uvs = frameUVs[ m_clips.GetFrameIndex( clip, seconds ) ];
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+AABB2 const* SpriteAnimSystem::GetInstanceUVs( PoolHandle instance ) const
+{
+	sprite_anim_instance_t const* animInstance = m_instances.Get( instance );
+	return animInstance != nullptr ? &animInstance->uvs : nullptr;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+uint32_t SpriteAnimSystem::GetInstanceClip( PoolHandle instance ) const
+{
+	sprite_anim_instance_t const* animInstance = m_instances.Get( instance );
+	return animInstance != nullptr ? animInstance->clipIndex : INVALID_SPRITE_ANIM_CLIP;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool SpriteAnimSystem::IsInstanceFinished( PoolHandle instance ) const
+{
+	sprite_anim_instance_t const* animInstance = m_instances.Get( instance );
+	if( animInstance == nullptr )
+		return true;
+
+	SpriteAnimClipTable::clip_t const& clip = m_clips.m_clips[ animInstance->clipIndex ];
+	return !clip.isLooping && animInstance->seconds >= clip.durationSeconds;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Spread speeds so instances don't all land on the same frame at once
+static float GetBenchmarkPlaybackSpeed( uint32_t instanceIndex )
+{
+	return 0.5f + static_cast<float>( ( instanceIndex * 2654435761u ) % 1000u ) * 0.001f;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void PrintSpriteAnimBenchmark( uint32_t instanceCount, int frameCount )
+{
+	if( instanceCount == 0 || frameCount <= 0 )
+		return;
+
+	float const deltaSeconds = 1.f / 60.f;
+
+	// Only UVs are read, so the sheet never needs a real texture behind it
+	Texture sheetTexture;
+	SpriteSheet spriteSheet( sheetTexture, IntVec2( 8, 8 ) );
+	SpriteAnimDefinition animDefs[] = {
+		SpriteAnimDefinition( spriteSheet, 0, 7, 1.f, SpriteAnimPlayBackType::LOOP ),
+		SpriteAnimDefinition( spriteSheet, 8, 11, 0.5f, SpriteAnimPlayBackType::PINGPONG ),
+		SpriteAnimDefinition( spriteSheet, 16, 21, 2.f, SpriteAnimPlayBackType::ONCE ),
+		SpriteAnimDefinition( spriteSheet, 24, 31, 0.8f, SpriteAnimPlayBackType::LOOP ),
+	};
+	uint32_t const animDefCount = sizeof( animDefs ) / sizeof( animDefs[ 0 ] );
+
+	// Per call: every instance keeps its own clock and asks its definition for a sprite, as entities do now
+	std::vector<float> instanceSeconds( instanceCount, 0.f );
+	float perCallChecksum = 0.f;
+	double startSeconds = GetCurrentTimeSeconds();
+	for( int frameIndex = 0; frameIndex < frameCount; ++frameIndex )
+	{
+		for( uint32_t instanceIndex = 0; instanceIndex < instanceCount; ++instanceIndex )
+		{
+			instanceSeconds[ instanceIndex ] += deltaSeconds * GetBenchmarkPlaybackSpeed( instanceIndex );
+
+			Vec2 uvAtMins;
+			Vec2 uvAtMaxes;
+			SpriteDefinition const& spriteDef = animDefs[ instanceIndex % animDefCount ].GetSpriteDefAtTime( instanceSeconds[ instanceIndex ] );
+			spriteDef.GetUVs( uvAtMins, uvAtMaxes );
+			perCallChecksum += uvAtMins.x;
+		}
+	}
+	double perCallSeconds = GetCurrentTimeSeconds() - startSeconds;
+
+	// Batched: one Update for everything, then each instance's UVs read back the way a renderer would
+	SpriteAnimClipTable clips;
+	for( uint32_t animDefIndex = 0; animDefIndex < animDefCount; ++animDefIndex )
+	{
+		clips.AddClip( animDefs[ animDefIndex ] );
+	}
+
+	SpriteAnimSystem animSystem( clips, instanceCount );
+	std::vector<PoolHandle> instances( instanceCount );
+	for( uint32_t instanceIndex = 0; instanceIndex < instanceCount; ++instanceIndex )
+	{
+		instances[ instanceIndex ] = animSystem.CreateInstance( instanceIndex % animDefCount, GetBenchmarkPlaybackSpeed( instanceIndex ) );
+	}
+
+	float batchedChecksum = 0.f;
+	startSeconds = GetCurrentTimeSeconds();
+	for( int frameIndex = 0; frameIndex < frameCount; ++frameIndex )
+	{
+		animSystem.Update( deltaSeconds );
+		for( uint32_t instanceIndex = 0; instanceIndex < instanceCount; ++instanceIndex )
+		{
+			batchedChecksum += animSystem.GetInstanceUVs( instances[ instanceIndex ] )->mins.x;
+		}
+	}
+	double batchedSeconds = GetCurrentTimeSeconds() - startSeconds;
+
+	double const millisecondsPerFrame = 1000.0 / static_cast<double>( frameCount );
+	g_theConsole->PrintString( Rgba8::WHITE, "Sprite anim benchmark: %u instances, %i frames, ms per frame", instanceCount, frameCount );
+	g_theConsole->PrintString( Rgba8::WHITE, "  GetSpriteDefAtTime per instance  %8.3f  (checksum %.1f)", perCallSeconds * millisecondsPerFrame, perCallChecksum );
+	g_theConsole->PrintString( Rgba8::WHITE, "  SpriteAnimSystem::Update         %8.3f  (checksum %.1f)", batchedSeconds * millisecondsPerFrame, batchedChecksum );
+}
@@ -0,0 +1,102 @@
+#pragma once
+#include "Engine/Core/HandlePool.hpp"
+#include "Engine/Math/AABB2.hpp"
+#include <stdint.h>
+#include <vector>
+
+class SpriteAnimDefinition;
+class SpriteSheet;
+
+
+//---------------------------------------------------------------------------------------------------------
+constexpr uint32_t INVALID_SPRITE_ANIM_CLIP = 0xFFFFFFFF;
+
+
+//---------------------------------------------------------------------------------------------------------
+// Every SpriteAnimDefinition a game uses, flattened once at load time into one table of frame UVs. Ping
+// pong clips are unrolled into a plain sequence (start..end..start+1), so playing any clip is just "frame
+// = time * rate", wrapped if it loops or clamped if it doesn't.
+//
+// Frame UVs are copied out of the sprite sheets, so call RefreshFrameUVs after the sheets are moved into a
+// SpriteAtlas.
+//---------------------------------------------------------------------------------------------------------
+class SpriteAnimClipTable
+{
+public:
+	SpriteAnimClipTable() {}
+	~SpriteAnimClipTable() {}
+
+	uint32_t			AddClip( SpriteAnimDefinition const& animDef );
+	void				RefreshFrameUVs();
+	void				Clear();
+
+	uint32_t			GetClipCount() const								{ return static_cast<uint32_t>( m_clips.size() ); }
+	SpriteSheet const*	GetClipSpriteSheet( uint32_t clipIndex ) const		{ return m_clips[ clipIndex ].spriteSheet; }
+	float				GetClipDurationSeconds( uint32_t clipIndex ) const	{ return m_clips[ clipIndex ].durationSeconds; }
+	AABB2 const&		GetFrameUVs( uint32_t clipIndex, float seconds ) const;
+
+private:
+	friend class SpriteAnimSystem;
+
+	struct clip_t
+	{
+		SpriteSheet const*	spriteSheet			= nullptr;
+		uint32_t			firstFrame			= 0;
+		uint32_t			frameCount			= 1;
+		float				framesPerSecond		= 1.f;
+		float				durationSeconds		= 1.f;
+		bool				isLooping			= true;
+	};
+
+	uint32_t GetFrameIndex( clip_t const& clip, float seconds ) const;
+
+private:
+	std::vector<clip_t>		m_clips;
+	std::vector<AABB2>		m_frameUVs;				// every clip's frames, back to back
+	std::vector<int>		m_frameSpriteIndices;	// parallel to m_frameUVs, for RefreshFrameUVs
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Plays instances of the clips in a SpriteAnimClipTable. Instances live packed in a HandlePool, so Update
+// is one pass over a flat array that advances each clock and writes the current frame's UV rect straight
+// into the instance; renderers read the rect back rather than evaluating the animation per draw.
+//---------------------------------------------------------------------------------------------------------
+class SpriteAnimSystem
+{
+public:
+	explicit SpriteAnimSystem( SpriteAnimClipTable const& clips, uint32_t maxInstances );
+	~SpriteAnimSystem() {}
+
+	PoolHandle		CreateInstance( uint32_t clipIndex, float playbackSpeed = 1.f );
+	void			DestroyInstance( PoolHandle instance );
+	void			ClearInstances();
+
+	void			SetInstanceClip( PoolHandle instance, uint32_t clipIndex, bool restart = true );
+	void			SetInstancePlaybackSpeed( PoolHandle instance, float playbackSpeed );
+	void			Update( float deltaSeconds );
+
+	AABB2 const*	GetInstanceUVs( PoolHandle instance ) const;
+	uint32_t		GetInstanceClip( PoolHandle instance ) const;
+	bool			IsInstanceFinished( PoolHandle instance ) const;
+	uint32_t		GetInstanceCount() const					{ return m_instances.GetCount(); }
+
+private:
+	struct sprite_anim_instance_t
+	{
+		uint32_t	clipIndex		= INVALID_SPRITE_ANIM_CLIP;
+		float		seconds			= 0.f;
+		float		playbackSpeed	= 1.f;
+		AABB2		uvs;
+	};
+
+private:
+	SpriteAnimClipTable const&				m_clips;
+	HandlePool<sprite_anim_instance_t>		m_instances;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Plays instanceCount animations through per-call SpriteAnimDefinition::GetSpriteDefAtTime and through a
+// SpriteAnimSystem, and prints the frame cost of each
+void PrintSpriteAnimBenchmark( uint32_t instanceCount, int frameCount );
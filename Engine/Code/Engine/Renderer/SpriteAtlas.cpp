@@ -0,0 +1,67 @@
+#include "Engine/Renderer/SpriteAtlas.hpp"
+#include "Engine/Renderer/SpriteSheet.hpp"
+#include "Engine/Renderer/BitmapFont.hpp"
+#include "Engine/Renderer/Texture.hpp"
+#include <algorithm>
+
+
+//---------------------------------------------------------------------------------------------------------
+SpriteAtlas::SpriteAtlas( int pageSizeTexels, int paddingTexels )
+	: m_textureAtlas( pageSizeTexels, paddingTexels, RECT_PACK_MAX_RECTS )
+{
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void SpriteAtlas::AddSpriteSheet( SpriteSheet* spriteSheet )
+{
+	if( spriteSheet == nullptr )
+		return;
+
+	if( std::find( m_spriteSheets.begin(), m_spriteSheets.end(), spriteSheet ) == m_spriteSheets.end() )
+	{
+		m_spriteSheets.push_back( spriteSheet );
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void SpriteAtlas::AddBitmapFont( BitmapFont* font )
+{
+	if( font == nullptr )
+		return;
+
+	if( std::find( m_fonts.begin(), m_fonts.end(), font ) == m_fonts.end() )
+	{
+		m_fonts.push_back( font );
+		AddSpriteSheet( &font->GetGlyphSpriteSheet() );
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void SpriteAtlas::Build( RenderContext* renderContext, char const* atlasName )
+{
+	std::vector<int> sheetEntries;
+	for( int sheetIndex = 0; sheetIndex < m_spriteSheets.size(); ++sheetIndex )
+	{
+		sheetEntries.push_back( m_textureAtlas.AddTexture( m_spriteSheets[ sheetIndex ]->GetSourceTexture() ) );
+	}
+
+	m_textureAtlas.Build( renderContext, atlasName );
+
+	for( int sheetIndex = 0; sheetIndex < m_spriteSheets.size(); ++sheetIndex )
+	{
+		int entryIndex = sheetEntries[ sheetIndex ];
+		if( m_textureAtlas.IsEntryPacked( entryIndex ) )
+		{
+			m_spriteSheets[ sheetIndex ]->MoveIntoAtlas( *m_textureAtlas.GetEntryPageTexture( entryIndex ), m_textureAtlas.GetEntryUVBounds( entryIndex ) );
+		}
+	}
+
+	// Glyph metrics cache the sheet's UVs
+	for( int fontIndex = 0; fontIndex < m_fonts.size(); ++fontIndex )
+	{
+		m_fonts[ fontIndex ]->RefreshGlyphMetrics();
+	}
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include "Engine/Renderer/TextureAtlas.hpp"
+#include <vector>
+
+class BitmapFont;
+class RenderContext;
+class SpriteSheet;
+struct Texture;
+
+
+//---------------------------------------------------------------------------------------------------------
+// Packs the textures of many sprite sheets (and bitmap fonts, whose glyphs are a sprite sheet) into a few
+// shared TextureAtlas pages at load time, then moves each sheet onto its page (SpriteSheet::MoveIntoAtlas),
+// so sprites from different sheets bind the same texture and can go out in one draw.
+//
+// Sheets need CPU-side pixel data (Texture::GetPixelData); any without it, or too big for a page, are left
+// on their own texture.
+//---------------------------------------------------------------------------------------------------------
+class SpriteAtlas
+{
+public:
+	explicit SpriteAtlas( int pageSizeTexels = 2048, int paddingTexels = 2 );
+	~SpriteAtlas() {}
+
+	void			AddSpriteSheet( SpriteSheet* spriteSheet );
+	void			AddBitmapFont( BitmapFont* font );
+	void			Build( RenderContext* renderContext, char const* atlasName );
+
+	int				GetPageCount() const						{ return m_textureAtlas.GetPageCount(); }
+	Texture const*	GetPageTexture( int pageIndex ) const		{ return m_textureAtlas.GetPageTexture( pageIndex ); }
+	int				GetPackedSheetCount() const					{ return m_textureAtlas.GetPackedEntryCount(); }
+	float			GetPageFillFraction() const					{ return m_textureAtlas.GetPageFillFraction(); }
+
+private:
+	TextureAtlas				m_textureAtlas;
+	std::vector<SpriteSheet*>	m_spriteSheets;
+	std::vector<BitmapFont*>	m_fonts;
+};
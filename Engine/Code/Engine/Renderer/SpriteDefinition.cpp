@@ -20,6 +20,14 @@ void SpriteDefinition::GetUVs( Vec2& out_uvAtMins, Vec2& out_uvAtMaxes ) const
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+void SpriteDefinition::SetUVs( const Vec2& uvAtMins, const Vec2& uvAtMaxes )
+{
+	m_uvMins = uvAtMins;
+	m_uvMaxes = uvAtMaxes;
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 const SpriteSheet& SpriteDefinition::GetSpriteSheet() const
 {
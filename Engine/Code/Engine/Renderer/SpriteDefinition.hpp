@@ -11,6 +11,7 @@ public:
 	explicit SpriteDefinition( const SpriteSheet& spriteSheet, int spriteIndex, const Vec2& uvAtMins, const Vec2& uvAtMaxes );
 
 	void				GetUVs( Vec2& out_uvAtMins, Vec2& out_uvAtMaxes ) const;
+	void				SetUVs( const Vec2& uvAtMins, const Vec2& uvAtMaxes );
 	const SpriteSheet&	GetSpriteSheet() const;
 	const Texture&		GetTexture() const;
 	float				GetAspect() const;
@@ -4,24 +4,17 @@
 
 //---------------------------------------------------------------------------------------------------------
 SpriteSheet::SpriteSheet( const Texture& texture, const IntVec2& simpleGridLayout )
-	: m_texture ( texture )
-	, m_simpleGridSize( simpleGridLayout )
+	: m_simpleGridSize( simpleGridLayout )
+	, m_sourceTexture( texture )
+	, m_texture( &texture )
 {
-	float spriteSheetXStep = 1.f / simpleGridLayout.x;
-	float spriteSheetYStep = 1.f / simpleGridLayout.y;
-
 	int numSprites = simpleGridLayout.x * simpleGridLayout.y;
-	
+	m_spriteDefs.reserve( numSprites );
 	for( int spriteIndex = 0; spriteIndex < numSprites; ++spriteIndex )
 	{
-		float currentMinU = spriteSheetXStep * static_cast<float>( spriteIndex % simpleGridLayout.x );
-		float currentMinV = 1.f - ( spriteSheetYStep * static_cast<float>( 1 + ( spriteIndex / simpleGridLayout.x ) ) );
-		Vec2 currentUVAtMins = Vec2( currentMinU, currentMinV );
-
-		Vec2 currenUVAtMaxes = Vec2( currentUVAtMins.x + spriteSheetXStep, currentUVAtMins.y + spriteSheetYStep );
-
-		m_spriteDefs.push_back( SpriteDefinition( *this, spriteIndex, currentUVAtMins, currenUVAtMaxes) );
+		m_spriteDefs.push_back( SpriteDefinition( *this, spriteIndex, Vec2( 0.f, 0.f ), Vec2( 1.f, 1.f ) ) );
 	}
+	SetSpriteUVsWithin( AABB2( 0.f, 0.f, 1.f, 1.f ) );
 }
 
 
@@ -62,3 +55,33 @@ int SpriteSheet::GetSpriteIndexFromPosition( IntVec2 spritePosition ) const
 {
 	return ( m_simpleGridSize.x * spritePosition.y ) + spritePosition.x;
 }
+
+
+//---------------------------------------------------------------------------------------------------------
+// Always laid out from the source grid, so moving into a second atlas doesn't compound the first remap
+//---------------------------------------------------------------------------------------------------------
+void SpriteSheet::MoveIntoAtlas( const Texture& atlasTexture, const AABB2& atlasUVBounds )
+{
+	m_texture = &atlasTexture;
+	SetSpriteUVsWithin( atlasUVBounds );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void SpriteSheet::SetSpriteUVsWithin( const AABB2& uvBounds )
+{
+	Vec2 uvBoundsSize = uvBounds.GetDimensions();
+	float spriteSheetXStep = uvBoundsSize.x / static_cast<float>( m_simpleGridSize.x );
+	float spriteSheetYStep = uvBoundsSize.y / static_cast<float>( m_simpleGridSize.y );
+
+	for( int spriteIndex = 0; spriteIndex < m_spriteDefs.size(); ++spriteIndex )
+	{
+		float currentMinU = uvBounds.mins.x + ( spriteSheetXStep * static_cast<float>( spriteIndex % m_simpleGridSize.x ) );
+		float currentMinV = uvBounds.maxes.y - ( spriteSheetYStep * static_cast<float>( 1 + ( spriteIndex / m_simpleGridSize.x ) ) );
+		Vec2 currentUVAtMins = Vec2( currentMinU, currentMinV );
+
+		Vec2 currenUVAtMaxes = Vec2( currentUVAtMins.x + spriteSheetXStep, currentUVAtMins.y + spriteSheetYStep );
+
+		m_spriteDefs[ spriteIndex ].SetUVs( currentUVAtMins, currenUVAtMaxes );
+	}
+}
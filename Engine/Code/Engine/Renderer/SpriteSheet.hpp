@@ -1,6 +1,7 @@
 #pragma once
 #include "Engine/Math/Vec2.hpp"
 #include "Engine/Math/IntVec2.hpp"
+#include "Engine/Math/AABB2.hpp"
 #include "Engine/Renderer/SpriteDefinition.hpp"
 #include <vector>
 
@@ -13,7 +14,9 @@ public:
 	~SpriteSheet() {};
 	explicit SpriteSheet( const Texture& texture, const IntVec2& simpleGridLayout );
 
-	const Texture&				GetTexture() const						{ return m_texture; }
+	const Texture&				GetTexture() const						{ return *m_texture; }
+	const Texture&				GetSourceTexture() const				{ return m_sourceTexture; }
+	bool						IsInAtlas() const						{ return m_texture != &m_sourceTexture; }
 	int							GetNumSprite() const					{ return static_cast<int>( m_spriteDefs.size() ); }
 	IntVec2						GetGridSize() const						{ return m_simpleGridSize; }
 	const SpriteDefinition&		GetSpriteDefinition( int index ) const;
@@ -22,8 +25,14 @@ public:
 	void						GetSpriteUVs( Vec2& out_uvAtMins, Vec2& out_uvAtMaxes, IntVec2 spritePosition ) const;
 	int							GetSpriteIndexFromPosition( IntVec2 spritePosition ) const;
 
+	void						MoveIntoAtlas( const Texture& atlasTexture, const AABB2& atlasUVBounds );
+
+private:
+	void						SetSpriteUVsWithin( const AABB2& uvBounds );
+
 protected:
 	IntVec2							m_simpleGridSize;
-	const Texture&					m_texture;
+	const Texture&					m_sourceTexture;
+	const Texture*					m_texture = nullptr;	// the source, or the atlas page it was packed into
 	std::vector<SpriteDefinition>	m_spriteDefs;
 };
\ No newline at end of file
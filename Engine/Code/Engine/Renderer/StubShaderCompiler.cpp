@@ -0,0 +1,111 @@
+#include "Engine/Renderer/StubShaderCompiler.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/FileUtils.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include <chrono>
+#include <string.h>
+#include <thread>
+
+
+//---------------------------------------------------------------------------------------------------------
+constexpr int MAX_STUB_INCLUDE_DEPTH = 8;
+
+
+//---------------------------------------------------------------------------------------------------------
+static std::string GetFolderOfFile( std::string const& filepath )
+{
+	size_t lastSlash = filepath.find_last_of( "/\\" );
+	if( lastSlash == std::string::npos )
+	{
+		return "";
+	}
+	return filepath.substr( 0, lastSlash + 1 );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Hashes source line by line, folding in each #included file where it appears
+//---------------------------------------------------------------------------------------------------------
+static bool HashSourceWithIncludes( std::string const& source, std::string const& folder, int depth, uint64_t& inout_hash, shader_compile_result_t& out_result )
+{
+	size_t lineStart = 0;
+	while( lineStart < source.length() )
+	{
+		size_t lineEnd = source.find( '\n', lineStart );
+		if( lineEnd == std::string::npos )
+		{
+			lineEnd = source.length();
+		}
+		std::string line = source.substr( lineStart, lineEnd - lineStart );
+		lineStart = lineEnd + 1;
+
+		if( line.compare( 0, 6, "#error" ) == 0 )
+		{
+			out_result.errors += line + "\n";
+			return false;
+		}
+
+		size_t openQuote = line.find( '"' );
+		size_t closeQuote = openQuote == std::string::npos ? std::string::npos : line.find( '"', openQuote + 1 );
+		if( line.compare( 0, 8, "#include" ) != 0 || closeQuote == std::string::npos )
+		{
+			inout_hash = HashBytes64( line.c_str(), line.length() + 1, inout_hash );
+			continue;
+		}
+
+		std::string includePath = folder + line.substr( openQuote + 1, closeQuote - openQuote - 1 );
+		size_t includeSize = 0;
+		char* includeData = static_cast<char*>( FileReadBinaryToNewBuffer( includePath, &includeSize ) );
+		if( includeData == nullptr || depth >= MAX_STUB_INCLUDE_DEPTH )
+		{
+			out_result.errors += Stringf( "Could not include \"%s\"\n", includePath.c_str() );
+			delete[] includeData;
+			return false;
+		}
+
+		out_result.includedFiles.push_back( includePath );
+		std::string includeSource( includeData, includeSize );
+		delete[] includeData;
+		if( !HashSourceWithIncludes( includeSource, GetFolderOfFile( includePath ), depth + 1, inout_hash, out_result ) )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+bool StubShaderCompiler::Compile( shader_compile_desc_t const& desc, shader_compile_result_t& out_result )
+{
+	++m_compileCount;
+	while( m_areCompilesHeld )
+	{
+		std::this_thread::sleep_for( std::chrono::microseconds( 100 ) );
+	}
+
+	out_result.isSuccess = false;
+	out_result.byteCode.clear();
+	out_result.errors.clear();
+	out_result.includedFiles.clear();
+
+	uint64_t hash = HashBytes64( GetCompilerID(), strlen( GetCompilerID() ) );
+	uint32_t stage = static_cast<uint32_t>( desc.stage );
+	hash = HashBytes64( &stage, sizeof( stage ), hash );
+	hash = HashBytes64( &desc.flags, sizeof( desc.flags ), hash );
+	for( std::string const& define : desc.defines )
+	{
+		hash = HashBytes64( define.c_str(), define.length() + 1, hash );
+	}
+
+	if( !HashSourceWithIncludes( desc.source, GetFolderOfFile( desc.filename ), 0, hash, out_result ) )
+	{
+		return false;
+	}
+
+	unsigned char const* hashBytes = reinterpret_cast<unsigned char const*>( &hash );
+	out_result.byteCode.assign( { 'S', 'T', 'U', 'B' } );
+	out_result.byteCode.insert( out_result.byteCode.end(), hashBytes, hashBytes + sizeof( hash ) );
+	out_result.isSuccess = true;
+	return true;
+}
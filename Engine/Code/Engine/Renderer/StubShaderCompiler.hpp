@@ -0,0 +1,24 @@
+#pragma once
+#include "Engine/Renderer/ShaderCompiler.hpp"
+#include <atomic>
+
+
+//---------------------------------------------------------------------------------------------------------
+// ShaderCompiler with no GPU toolchain, for testing ShaderCache and the async compile path headless. The
+// "bytecode" is a hash of everything a real compile depends on, so it is deterministic and changes whenever
+// the input does. #include "file" lines are followed relative to the including file and reported like
+// D3DShaderCompiler's; a #error line fails the compile. Compiles can be held to catch one in flight.
+//---------------------------------------------------------------------------------------------------------
+class StubShaderCompiler : public ShaderCompiler
+{
+public:
+	virtual bool		Compile( shader_compile_desc_t const& desc, shader_compile_result_t& out_result ) override;
+	virtual char const*	GetCompilerID() const override						{ return "StubShaderCompiler_1"; }
+
+	void				SetCompilesHeld( bool areCompilesHeld )			{ m_areCompilesHeld = areCompilesHeld; }
+	uint				GetCompileCount() const							{ return m_compileCount; }
+
+private:
+	std::atomic<bool>	m_areCompilesHeld	= false;
+	std::atomic<uint>	m_compileCount		= 0;
+};
@@ -47,7 +47,7 @@ Texture::Texture( const char* filePath, RenderContext* owner, ID3D11Texture2D* h
 
 
 //---------------------------------------------------------------------------------------------------------
-void Texture::SetPixelData( int size, unsigned char* pixelData )
+void Texture::SetPixelData( int size, unsigned char const* pixelData )
 {
 	m_pixelData = new unsigned char[size];
 	memcpy( m_pixelData, pixelData, size );
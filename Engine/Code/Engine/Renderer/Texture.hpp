@@ -15,7 +15,7 @@ public:
 	explicit Texture( RenderContext* owner, ID3D11Texture2D* handle );
 	explicit Texture( const char* filePath, RenderContext* owner, ID3D11Texture2D* handle );
 
-	void				SetPixelData( int size, unsigned char* pixelData );
+	void				SetPixelData( int size, unsigned char const* pixelData );
 
 	bool				AreViewsMatching(Texture* textureToCompare) const;
 	bool				IsRenderTarget()	const { return m_renderTargetView != nullptr; }
@@ -0,0 +1,273 @@
+#include "Engine/Renderer/TextureAtlas.hpp"
+#include "Engine/Platform/Platform.hpp"
+
+// Packing and composing pages is CPU only; headless builds leave out the parts that touch D3D11 textures
+#if !defined( ENGINE_HEADLESS )
+#include "Engine/Renderer/Texture.hpp"
+#include "Engine/Renderer/RenderContext.hpp"
+#endif
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/Image.hpp"
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/Time.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+
+
+//---------------------------------------------------------------------------------------------------------
+static int GetNextPowerOfTwo( int value )
+{
+	int powerOfTwo = 1;
+	while( powerOfTwo < value )
+	{
+		powerOfTwo <<= 1;
+	}
+	return powerOfTwo;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+TextureAtlas::TextureAtlas( int pageSizeTexels, int paddingTexels, RectPackMethod packMethod )
+	: m_pageSizeTexels( pageSizeTexels )
+	, m_paddingTexels( paddingTexels )
+	, m_packMethod( packMethod )
+{
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+int TextureAtlas::AddEntry( std::string const& name, IntVec2 const& texelSize, void const* rgbaTexels )
+{
+	GUARANTEE_OR_DIE( m_pageCount == 0, Stringf( "Cannot add \"%s\" to an atlas that has already been built", name.c_str() ) );
+
+	atlas_entry_t entry;
+	entry.name = name;
+	entry.texelSize = texelSize;
+	entry.rgbaTexels = rgbaTexels;
+	m_entries.push_back( entry );
+	m_entryUVBounds.push_back( AABB2( Vec2( 0.f, 0.f ), Vec2( 1.f, 1.f ) ) );
+
+	return static_cast<int>( m_entries.size() ) - 1;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+int TextureAtlas::AddImage( Image const& image )
+{
+	return AddEntry( image.GetImageFilePath(), image.GetDimensions(), image.GetRawData() );
+}
+
+
+#if !defined( ENGINE_HEADLESS )
+//---------------------------------------------------------------------------------------------------------
+int TextureAtlas::AddTexture( Texture const& texture )
+{
+	return AddEntry( texture.GetImageFilePath(), texture.GetImageTexelSize(), texture.GetPixelData() );
+}
+#endif // !ENGINE_HEADLESS
+
+
+//---------------------------------------------------------------------------------------------------------
+int TextureAtlas::FindEntry( std::string const& name ) const
+{
+	for( int entryIndex = 0; entryIndex < GetEntryCount(); ++entryIndex )
+	{
+		if( m_entries[ entryIndex ].name == name )
+			return entryIndex;
+	}
+	return -1;
+}
+
+
+#if !defined( ENGINE_HEADLESS )
+//---------------------------------------------------------------------------------------------------------
+Texture const* TextureAtlas::GetEntryPageTexture( int entryIndex ) const
+{
+	int pageIndex = m_entries[ entryIndex ].pageIndex;
+	if( pageIndex < 0 || pageIndex >= m_pages.size() )
+		return nullptr;
+
+	return m_pages[ pageIndex ];
+}
+#endif // !ENGINE_HEADLESS
+
+
+//---------------------------------------------------------------------------------------------------------
+float TextureAtlas::GetPageFillFraction() const
+{
+	if( m_pageTexelCount == 0 )
+		return 0.f;
+
+	return static_cast<float>( static_cast<double>( m_packedTexelCount ) / static_cast<double>( m_pageTexelCount ) );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Pages are trimmed to the power of two covering what the packer used, so a lightly filled atlas doesn't
+// upload a full page of nothing
+//---------------------------------------------------------------------------------------------------------
+void TextureAtlas::BuildPageImages( char const* atlasName, std::vector<Image>& out_pageImages )
+{
+	GUARANTEE_OR_DIE( m_pageCount == 0, Stringf( "Texture atlas \"%s\" has already been built", atlasName ) );
+
+	std::vector<int> packedEntryIndices;
+	std::vector<IntVec2> paddedSizes;
+	for( int entryIndex = 0; entryIndex < GetEntryCount(); ++entryIndex )
+	{
+		atlas_entry_t const& entry = m_entries[ entryIndex ];
+		IntVec2 paddedSize = entry.texelSize + IntVec2( m_paddingTexels * 2, m_paddingTexels * 2 );
+		if( entry.rgbaTexels == nullptr || paddedSize.x > m_pageSizeTexels || paddedSize.y > m_pageSizeTexels )
+		{
+			if( g_theConsole != nullptr )
+			{
+				g_theConsole->PrintString( Rgba8::YELLOW, "\"%s\" left out of atlas \"%s\"", entry.name.c_str(), atlasName );
+			}
+			continue;
+		}
+
+		packedEntryIndices.push_back( entryIndex );
+		paddedSizes.push_back( paddedSize );
+	}
+
+	std::vector<rect_placement_t> placements;
+	std::vector<IntVec2> pageExtents;
+	m_pageCount = PackRectsIntoBins( paddedSizes, IntVec2( m_pageSizeTexels, m_pageSizeTexels ), m_packMethod, placements, &pageExtents );
+
+	out_pageImages.clear();
+	out_pageImages.reserve( m_pageCount );
+	for( int pageIndex = 0; pageIndex < m_pageCount; ++pageIndex )
+	{
+		IntVec2 pageSize( GetNextPowerOfTwo( pageExtents[ pageIndex ].x ), GetNextPowerOfTwo( pageExtents[ pageIndex ].y ) );
+		std::string pageName = Stringf( "%s#%i", atlasName, pageIndex );
+		out_pageImages.push_back( Image( pageName.c_str(), pageSize, Rgba8( 0, 0, 0, 0 ) ) );
+		m_pageTexelCount += static_cast<int64_t>( pageSize.x ) * static_cast<int64_t>( pageSize.y );
+	}
+
+	// UVs cover just the entry, not its border
+	for( size_t packedIndex = 0; packedIndex < packedEntryIndices.size(); ++packedIndex )
+	{
+		int entryIndex = packedEntryIndices[ packedIndex ];
+		atlas_entry_t& entry = m_entries[ entryIndex ];
+		entry.pageIndex = placements[ packedIndex ].binIndex;
+		entry.paddedMins = placements[ packedIndex ].mins;
+
+		Image& page = out_pageImages[ entry.pageIndex ];
+		CopyEntryIntoPage( entry, page );
+
+		Vec2 pageSize = Vec2( static_cast<float>( page.GetDimensions().x ), static_cast<float>( page.GetDimensions().y ) );
+		IntVec2 entryMins = entry.paddedMins + IntVec2( m_paddingTexels, m_paddingTexels );
+		IntVec2 entryMaxes = entryMins + entry.texelSize;
+
+		AABB2& uvBounds = m_entryUVBounds[ entryIndex ];
+		uvBounds.mins	= Vec2( static_cast<float>( entryMins.x ) / pageSize.x, static_cast<float>( entryMins.y ) / pageSize.y );
+		uvBounds.maxes	= Vec2( static_cast<float>( entryMaxes.x ) / pageSize.x, static_cast<float>( entryMaxes.y ) / pageSize.y );
+
+		m_packedTexelCount += static_cast<int64_t>( paddedSizes[ packedIndex ].x ) * static_cast<int64_t>( paddedSizes[ packedIndex ].y );
+		++m_packedEntryCount;
+	}
+}
+
+
+#if !defined( ENGINE_HEADLESS )
+//---------------------------------------------------------------------------------------------------------
+void TextureAtlas::Build( RenderContext* renderContext, char const* atlasName, bool generateMips )
+{
+	std::vector<Image> pageImages;
+	BuildPageImages( atlasName, pageImages );
+
+	for( int pageIndex = 0; pageIndex < pageImages.size(); ++pageIndex )
+	{
+		m_pages.push_back( renderContext->CreateTextureFromImage( pageImages[ pageIndex ], generateMips ) );
+	}
+
+	g_theConsole->PrintString( Rgba8::WHITE, "Texture atlas \"%s\": %i of %i entries on %i pages, %.0f%% filled", atlasName, m_packedEntryCount, GetEntryCount(), GetPageCount(), GetPageFillFraction() * 100.f );
+}
+#endif // !ENGINE_HEADLESS
+
+
+//---------------------------------------------------------------------------------------------------------
+// The border repeats the entry's outermost texels (corners included) by clamping the source row and column
+//---------------------------------------------------------------------------------------------------------
+void TextureAtlas::CopyEntryIntoPage( atlas_entry_t const& entry, Image& page ) const
+{
+	IntVec2 sourceSize = entry.texelSize;
+	Rgba8 const* sourceTexels = static_cast<Rgba8 const*>( entry.rgbaTexels );
+	IntVec2 paddedSize = sourceSize + IntVec2( m_paddingTexels * 2, m_paddingTexels * 2 );
+
+	for( int paddedRow = 0; paddedRow < paddedSize.y; ++paddedRow )
+	{
+		int sourceRow = GetClamp( paddedRow - m_paddingTexels, 0, sourceSize.y - 1 );
+		Rgba8 const* sourceRowTexels = &sourceTexels[ sourceRow * sourceSize.x ];
+		int pageRow = entry.paddedMins.y + paddedRow;
+		int pageColumn = entry.paddedMins.x + m_paddingTexels;
+
+		page.CopyTexelRow( pageColumn, pageRow, sourceSize.x, sourceRowTexels );
+		for( int paddingIndex = 1; paddingIndex <= m_paddingTexels; ++paddingIndex )
+		{
+			page.SetTexelColor( pageColumn - paddingIndex, pageRow, sourceRowTexels[ 0 ] );
+			page.SetTexelColor( pageColumn + sourceSize.x - 1 + paddingIndex, pageRow, sourceRowTexels[ sourceSize.x - 1 ] );
+		}
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void PrintTextureAtlasBenchmark( char const* imageFilePath, int decodeCount, uint imageCount )
+{
+	if( decodeCount > 0 && imageFilePath != nullptr && imageFilePath[ 0 ] != '\0' )
+	{
+		double decodeStartSeconds = GetCurrentTimeSeconds();
+		size_t decodedBytes = 0;
+		for( int decodeIndex = 0; decodeIndex < decodeCount; ++decodeIndex )
+		{
+			Image image( imageFilePath, true );
+			decodedBytes += image.GetRawDataSizeBytes();
+		}
+		double decodeSeconds = GetCurrentTimeSeconds() - decodeStartSeconds;
+
+		Image image( imageFilePath, true );
+		int mipCount = image.GetFullMipChainLength();
+		double mipStartSeconds = GetCurrentTimeSeconds();
+		Image mip = image.CreateHalfSizeMip();
+		for( int mipIndex = 2; mipIndex < mipCount; ++mipIndex )
+		{
+			mip = mip.CreateHalfSizeMip();
+		}
+		double mipSeconds = GetCurrentTimeSeconds() - mipStartSeconds;
+
+		double decodedMegabytes = static_cast<double>( decodedBytes ) / ( 1024.0 * 1024.0 );
+		g_theConsole->PrintString( Rgba8::WHITE, "Image decode: \"%s\" x%i, %.2f ms each, %.1f MB/s of RGBA8", imageFilePath, decodeCount, decodeSeconds * 1000.0 / static_cast<double>( decodeCount ), decodedMegabytes / decodeSeconds );
+		g_theConsole->PrintString( Rgba8::WHITE, "  %i level mip chain on the CPU in %.2f ms", mipCount, mipSeconds * 1000.0 );
+	}
+
+	if( imageCount == 0 )
+		return;
+
+	// Flat coloured images stand in for sprites and icons; only the copy into the pages costs anything
+	RandomNumberGenerator rng;
+	rng.Reset( 48 );
+
+	std::vector<Image> sourceImages;
+	sourceImages.reserve( imageCount );
+	for( uint imageIndex = 0; imageIndex < imageCount; ++imageIndex )
+	{
+		int maxSide = rng.RollPercentChance( 0.1f ) ? 256 : 64;
+		IntVec2 imageSize( rng.RollRandomIntInRange( 8, maxSide ), rng.RollRandomIntInRange( 8, maxSide ) );
+		Rgba8 imageColor( static_cast<unsigned char>( imageIndex ), 128, 255, 255 );
+		sourceImages.push_back( Image( Stringf( "Benchmark%u", imageIndex ).c_str(), imageSize, imageColor ) );
+	}
+
+	TextureAtlas atlas;
+	for( uint imageIndex = 0; imageIndex < imageCount; ++imageIndex )
+	{
+		atlas.AddImage( sourceImages[ imageIndex ] );
+	}
+
+	double buildStartSeconds = GetCurrentTimeSeconds();
+	std::vector<Image> pageImages;
+	atlas.BuildPageImages( "Benchmark", pageImages );
+	double buildSeconds = GetCurrentTimeSeconds() - buildStartSeconds;
+
+	g_theConsole->PrintString( Rgba8::WHITE, "Texture atlas: %u images onto %i pages in %.2f ms, %.1f%% filled", imageCount, atlas.GetPageCount(), buildSeconds * 1000.0, atlas.GetPageFillFraction() * 100.f );
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/IntVec2.hpp"
+#include "Engine/Math/RectPacker.hpp"
+#include <string>
+#include <vector>
+
+class RenderContext;
+struct Image;
+struct Texture;
+
+
+//---------------------------------------------------------------------------------------------------------
+// Packs many small images (sprite sheets, font glyph sheets, UI icons) into a few shared pages at load time.
+// Every entry gets a row in a UV remap table: which page it landed on and where on that page its texels
+// are, so anything drawn from it swaps its texture for the page and maps its UVs into that rect.
+//
+// Each entry is surrounded by a border that repeats its edge texels, so filtering near an entry's edge
+// doesn't pull in a neighbour. Entries without texels, or too big for a page, are left unpacked.
+//
+// Source texels are only read during the build, so they must outlive BuildPageImages / Build and no longer.
+//---------------------------------------------------------------------------------------------------------
+class TextureAtlas
+{
+public:
+	explicit TextureAtlas( int pageSizeTexels = 2048, int paddingTexels = 2, RectPackMethod packMethod = RECT_PACK_MAX_RECTS );
+	~TextureAtlas() {}
+
+	int				AddEntry( std::string const& name, IntVec2 const& texelSize, void const* rgbaTexels );
+	int				AddImage( Image const& image );
+	int				AddTexture( Texture const& texture );
+
+	// Packs and composes the pages on the CPU; Build does this then uploads them
+	void			BuildPageImages( char const* atlasName, std::vector<Image>& out_pageImages );
+	void			Build( RenderContext* renderContext, char const* atlasName, bool generateMips = false );
+
+	int				GetEntryCount() const							{ return static_cast<int>( m_entries.size() ); }
+	int				FindEntry( std::string const& name ) const;
+	bool			IsEntryPacked( int entryIndex ) const			{ return m_entries[ entryIndex ].pageIndex >= 0; }
+	int				GetEntryPageIndex( int entryIndex ) const		{ return m_entries[ entryIndex ].pageIndex; }
+	AABB2 const&	GetEntryUVBounds( int entryIndex ) const		{ return m_entryUVBounds[ entryIndex ]; }
+	Texture const*	GetEntryPageTexture( int entryIndex ) const;
+
+	int				GetPageCount() const							{ return m_pageCount; }
+	Texture const*	GetPageTexture( int pageIndex ) const			{ return m_pages[ pageIndex ]; }
+	int				GetPackedEntryCount() const						{ return m_packedEntryCount; }
+	float			GetPageFillFraction() const;
+
+private:
+	struct atlas_entry_t
+	{
+		std::string		name;
+		IntVec2			texelSize;
+		void const*		rgbaTexels		= nullptr;
+		int				pageIndex		= -1;
+		IntVec2			paddedMins;
+	};
+
+	void	CopyEntryIntoPage( atlas_entry_t const& entry, Image& page ) const;
+
+private:
+	std::vector<atlas_entry_t>	m_entries;
+	std::vector<AABB2>			m_entryUVBounds;	// parallel to m_entries, the UV remap table
+	std::vector<Texture*>		m_pages;
+
+	int				m_pageSizeTexels		= 2048;
+	int				m_paddingTexels			= 2;
+	RectPackMethod	m_packMethod			= RECT_PACK_MAX_RECTS;
+	int				m_pageCount				= 0;
+	int				m_packedEntryCount		= 0;
+	int64_t			m_packedTexelCount		= 0;
+	int64_t			m_pageTexelCount		= 0;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Decodes imageFilePath decodeCount times and builds its mip chain, then packs imageCount random images into
+// atlas pages end to end, and prints the throughput of each step
+void PrintTextureAtlasBenchmark( char const* imageFilePath, int decodeCount, uint imageCount );
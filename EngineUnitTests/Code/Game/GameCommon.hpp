@@ -0,0 +1,15 @@
+//-----------------------------------------------------------------------------------------------
+// GameCommon.hpp
+//
+#pragma once
+
+
+//-----------------------------------------------------------------------------------------------
+typedef int (TestSetFunctionType)(); // Returns the number of VerifyTestResult calls it makes
+
+
+//-----------------------------------------------------------------------------------------------
+// Provided by Main.cpp, the same as in MathUnitTests
+//
+void RunTestSet( TestSetFunctionType testSetFunction, const char* testSetName );
+void VerifyTestResult( bool isCorrect, const char* testName );
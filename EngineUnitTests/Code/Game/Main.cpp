@@ -0,0 +1,118 @@
+//-----------------------------------------------------------------------------------------------
+// Engine Unit Tests: Main.cpp
+//
+// Headless tests for engine systems, run by ctest from the CMake build. Each suite is registered
+//	as its own ctest test by passing its name on the command line; with no argument, every suite
+//	runs. The process exits non-zero if any test failed.
+//
+#include "Game/UnitTests_Platform.hpp"
+#include "Game/UnitTests_Culling.hpp"
+#include "Game/UnitTests_Atlas.hpp"
+#include "Game/UnitTests_Audio.hpp"
+#include "Game/UnitTests_ShaderCache.hpp"
+#include "Game/UnitTests_Timers.hpp"
+#include "Game/GameCommon.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include <stdio.h>
+#include <string.h>
+
+
+//-----------------------------------------------------------------------------------------------
+// The engine expects these from the app; the tests that need a system create their own
+//
+DevConsole*		g_theConsole		= nullptr;
+EventSystem*	g_theEventSystem	= nullptr;
+JobSystem*		g_theJobSystem		= nullptr;
+
+
+//-----------------------------------------------------------------------------------------------
+struct test_suite_t
+{
+	const char*		name;
+	void			(*runTests)();
+};
+
+static const test_suite_t s_testSuites[] =
+{
+	{ "Platform",		RunTests_Platform },
+	{ "Culling",		RunTests_Culling },
+	{ "Atlas",			RunTests_Atlas },
+	{ "Audio",			RunTests_Audio },
+	{ "ShaderCache",	RunTests_ShaderCache },
+	{ "Timers",			RunTests_Timers },
+};
+
+
+//-----------------------------------------------------------------------------------------------
+static int s_numTestsPassed		= 0;
+static int s_numTestsFailed		= 0;
+static int s_numTestSetErrors	= 0;
+
+
+//-----------------------------------------------------------------------------------------------
+void VerifyTestResult( bool isCorrect, const char* testName )
+{
+	if( isCorrect )
+	{
+		++ s_numTestsPassed;
+	}
+	else
+	{
+		++ s_numTestsFailed;
+		printf( "\n  TEST FAILED: %s", testName );
+	}
+}
+
+
+//-----------------------------------------------------------------------------------------------
+void RunTestSet( TestSetFunctionType testSetFunction, const char* testSetName )
+{
+	printf( "Running test set \"%s\"... ", testSetName );
+
+	int numTestsPassedBefore = s_numTestsPassed;
+	int numTestsFailedBefore = s_numTestsFailed;
+	int numTestsExpected = testSetFunction();
+	int numTestsJustPassed = s_numTestsPassed - numTestsPassedBefore;
+	int numTestsJustFailed = s_numTestsFailed - numTestsFailedBefore;
+
+	// A set that bails out early (or miscounts) would otherwise pass silently
+	if( numTestsJustPassed + numTestsJustFailed != numTestsExpected )
+	{
+		++ s_numTestSetErrors;
+		printf( "\n  ERROR: expected %i test(s), but %i ran", numTestsExpected, numTestsJustPassed + numTestsJustFailed );
+	}
+	else if( numTestsJustFailed == 0 )
+	{
+		printf( "all %i tests passed", numTestsJustPassed );
+	}
+
+	printf( "\n" );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+int main( int argc, char** argv )
+{
+	const char* suiteToRun = ( argc > 1 ) ? argv[ 1 ] : nullptr;
+
+	int numSuitesRun = 0;
+	for( const test_suite_t& testSuite : s_testSuites )
+	{
+		if( suiteToRun != nullptr && strcmp( suiteToRun, testSuite.name ) != 0 )
+			continue;
+
+		printf( "Running engine unit tests: %s\n", testSuite.name );
+		testSuite.runTests();
+		printf( "\n" );
+		++ numSuitesRun;
+	}
+
+	if( numSuitesRun == 0 )
+	{
+		printf( "No test suite named \"%s\"\n", suiteToRun );
+		return 1;
+	}
+
+	printf( "%i passed, %i failed, %i test set error(s)\n", s_numTestsPassed, s_numTestsFailed, s_numTestSetErrors );
+	return ( s_numTestsFailed == 0 && s_numTestSetErrors == 0 ) ? 0 : 1;
+}
@@ -0,0 +1,348 @@
+//-----------------------------------------------------------------------------------------------
+// UnitTests_Atlas.cpp
+//
+// RectPacker placement for every method, PackRectsIntoBins, CPU mips and Image copy/move, and
+//	TextureAtlas page composition without a RenderContext.
+//
+#include "Game/UnitTests_Atlas.hpp"
+#include "Engine/Math/RectPacker.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Core/Image.hpp"
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Renderer/TextureAtlas.hpp"
+#include <math.h>
+#include <vector>
+
+
+//-----------------------------------------------------------------------------------------------
+static const unsigned int	ATLAS_RNG_SEED			= 48;
+static const int			NUM_RANDOM_RECTS		= 400;
+
+
+//-----------------------------------------------------------------------------------------------
+struct packed_rect_t
+{
+	IntVec2 mins;
+	IntVec2 size;
+};
+
+
+//-----------------------------------------------------------------------------------------------
+static bool DoRectsOverlap( packed_rect_t const& a, packed_rect_t const& b )
+{
+	return a.mins.x < b.mins.x + b.size.x && b.mins.x < a.mins.x + a.size.x
+		&& a.mins.y < b.mins.y + b.size.y && b.mins.y < a.mins.y + a.size.y;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+static bool AreAnyRectsOverlapping( std::vector<packed_rect_t> const& rects )
+{
+	for( size_t firstIndex = 0; firstIndex < rects.size(); ++firstIndex )
+	{
+		for( size_t secondIndex = firstIndex + 1; secondIndex < rects.size(); ++secondIndex )
+		{
+			if( DoRectsOverlap( rects[ firstIndex ], rects[ secondIndex ] ) )
+				return true;
+		}
+	}
+	return false;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+static IntVec2 RollRandomRectSize( RandomNumberGenerator& rng )
+{
+	return IntVec2( rng.RollRandomIntInRange( 4, 64 ), rng.RollRandomIntInRange( 4, 64 ) );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+// Fills one 512x512 bin until the first rect that doesn't fit, then checks every placement
+//
+static void VerifyRectPackerMethod( RectPackMethod method, const char* methodName )
+{
+	RandomNumberGenerator rng;
+	rng.Reset( ATLAS_RNG_SEED );
+
+	IntVec2 binSize( 512, 512 );
+	RectPacker packer( binSize, method );
+	std::vector<packed_rect_t> packedRects;
+	int packedArea = 0;
+	for( int rectIndex = 0; rectIndex < NUM_RANDOM_RECTS; ++rectIndex )
+	{
+		packed_rect_t rect;
+		rect.size = RollRandomRectSize( rng );
+		if( !packer.Insert( rect.size, rect.mins ) )
+			break;
+
+		packedRects.push_back( rect );
+		packedArea += rect.size.x * rect.size.y;
+	}
+
+	bool areAllInBounds = true;
+	IntVec2 usedExtents( 0, 0 );
+	for( size_t rectIndex = 0; rectIndex < packedRects.size(); ++rectIndex )
+	{
+		packed_rect_t const& rect = packedRects[ rectIndex ];
+		areAllInBounds = areAllInBounds && rect.mins.x >= 0 && rect.mins.y >= 0 && rect.mins.x + rect.size.x <= binSize.x && rect.mins.y + rect.size.y <= binSize.y;
+		usedExtents.x = rect.mins.x + rect.size.x > usedExtents.x ? rect.mins.x + rect.size.x : usedExtents.x;
+		usedExtents.y = rect.mins.y + rect.size.y > usedExtents.y ? rect.mins.y + rect.size.y : usedExtents.y;
+	}
+
+	printf( "\n  %s: %i rects, %.1f%% occupied", methodName, static_cast<int>( packedRects.size() ), packer.GetOccupancy() * 100.f );
+	VerifyTestResult( packedRects.size() > 50 && areAllInBounds, "Every packed rect should lie inside the bin" );
+	VerifyTestResult( !AreAnyRectsOverlapping( packedRects ), "No two packed rects should overlap" );
+	VerifyTestResult( packer.GetPackedArea() == packedArea && packer.GetUsedExtents() == usedExtents, "Packed area and used extents should match the placements" );
+
+	IntVec2 ignoredMins;
+	packer.Reset();
+	bool rejectsOversized = !packer.Insert( IntVec2( 513, 8 ), ignoredMins ) && !packer.Insert( IntVec2( 8, 513 ), ignoredMins );
+	bool acceptsWholeBin = packer.Insert( binSize, ignoredMins ) && ignoredMins == IntVec2( 0, 0 ) && !packer.Insert( IntVec2( 1, 1 ), ignoredMins );
+	VerifyTestResult( rejectsOversized && acceptsWholeBin, "After Reset() a bin should reject oversized rects and take exactly one bin-sized rect" );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_Atlas_RectPacker()
+{
+	VerifyRectPackerMethod( RECT_PACK_SHELF,		"shelf" );
+	VerifyRectPackerMethod( RECT_PACK_SKYLINE,		"skyline" );
+	VerifyRectPackerMethod( RECT_PACK_MAX_RECTS,	"max rects" );
+	printf( "\n  " );
+
+	return 12;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_Atlas_PackRectsIntoBins()
+{
+	RandomNumberGenerator rng;
+	rng.Reset( ATLAS_RNG_SEED );
+
+	IntVec2 binSize( 256, 256 );
+	std::vector<IntVec2> rectSizes;
+	for( int rectIndex = 0; rectIndex < NUM_RANDOM_RECTS; ++rectIndex )
+	{
+		rectSizes.push_back( RollRandomRectSize( rng ) );
+	}
+	rectSizes.push_back( IntVec2( 300, 10 ) );
+	size_t oversizedIndex = rectSizes.size() - 1;
+
+	std::vector<rect_placement_t> placements;
+	std::vector<IntVec2> binExtents;
+	int binCount = PackRectsIntoBins( rectSizes, binSize, RECT_PACK_SKYLINE, placements, &binExtents );
+
+	bool areAllPlaced = placements.size() == rectSizes.size();
+	std::vector<std::vector<packed_rect_t>> rectsPerBin( binCount > 0 ? binCount : 0 );
+	bool areExtentsCovering = static_cast<int>( binExtents.size() ) == binCount;
+	for( size_t rectIndex = 0; rectIndex < placements.size(); ++rectIndex )
+	{
+		if( rectIndex == oversizedIndex )
+			continue;
+
+		rect_placement_t const& placement = placements[ rectIndex ];
+		if( placement.binIndex < 0 || placement.binIndex >= binCount )
+		{
+			areAllPlaced = false;
+			continue;
+		}
+
+		packed_rect_t rect;
+		rect.mins = placement.mins;
+		rect.size = rectSizes[ rectIndex ];
+		rectsPerBin[ placement.binIndex ].push_back( rect );
+
+		if( areExtentsCovering )
+		{
+			IntVec2 const& extents = binExtents[ placement.binIndex ];
+			areExtentsCovering = rect.mins.x + rect.size.x <= extents.x && rect.mins.y + rect.size.y <= extents.y;
+		}
+	}
+
+	bool isAnyBinOverlapping = false;
+	for( size_t binIndex = 0; binIndex < rectsPerBin.size(); ++binIndex )
+	{
+		isAnyBinOverlapping = isAnyBinOverlapping || AreAnyRectsOverlapping( rectsPerBin[ binIndex ] );
+	}
+
+	VerifyTestResult( binCount > 1 && areAllPlaced, "Every rect that fits a bin should be placed, across more than one bin" );
+	VerifyTestResult( placements[ oversizedIndex ].binIndex == -1, "A rect bigger than a bin should be left unplaced" );
+	VerifyTestResult( !isAnyBinOverlapping, "No two rects in the same bin should overlap" );
+	VerifyTestResult( areExtentsCovering, "Each bin's extents should cover every rect placed in it" );
+
+	return 4;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_Atlas_ImageMips()
+{
+	// 5x3, so the mip drops the odd last column and row
+	Image image( "mipSource", IntVec2( 5, 3 ), Rgba8( 0, 0, 0, 0 ) );
+	for( int texelY = 0; texelY < 3; ++texelY )
+	{
+		for( int texelX = 0; texelX < 5; ++texelX )
+		{
+			unsigned char value = static_cast<unsigned char>( ( texelY * 5 + texelX ) * 10 );
+			image.SetTexelColor( texelX, texelY, Rgba8( value, static_cast<unsigned char>( 255 - value ), 7, 255 ) );
+		}
+	}
+
+	Image mip = image.CreateHalfSizeMip();
+	Rgba8 firstMipTexel = mip.GetTexelColor( 0, 0 );
+	Rgba8 secondMipTexel = mip.GetTexelColor( 1, 0 );
+
+	// ( 0 + 10 + 50 + 60 ) / 4 = 30 and ( 20 + 30 + 70 + 80 ) / 4 = 50
+	VerifyTestResult( mip.GetDimensions() == IntVec2( 2, 1 ), "A 5x3 image's mip should be 2x1" );
+	VerifyTestResult( firstMipTexel.r == 30 && firstMipTexel.g == 225 && firstMipTexel.b == 7 && firstMipTexel.a == 255, "Mip texels should be the rounded average of their 2x2 block" );
+	VerifyTestResult( secondMipTexel.r == 50 && secondMipTexel.g == 205, "The second mip texel should average the next 2x2 block" );
+
+	Image wideImage( "wide", IntVec2( 8, 2 ), Rgba8( 10, 20, 30, 40 ) );
+	int mipCount = 1;
+	Image chainMip = wideImage;
+	while( chainMip.GetDimensions() != IntVec2( 1, 1 ) )
+	{
+		chainMip = chainMip.CreateHalfSizeMip();
+		++mipCount;
+	}
+	Rgba8 lastMipTexel = chainMip.GetTexelColor( 0, 0 );
+	VerifyTestResult( wideImage.GetFullMipChainLength() == 4 && mipCount == 4, "An 8x2 image should have a 4 level mip chain, ending at 1x1" );
+	VerifyTestResult( lastMipTexel.r == 10 && lastMipTexel.g == 20 && lastMipTexel.b == 30 && lastMipTexel.a == 40, "A solid image should stay the same color down the chain" );
+
+	Image copiedImage = image;
+	copiedImage.SetTexelColor( 0, 0, Rgba8( 1, 2, 3, 4 ) );
+	VerifyTestResult( image.GetTexelColor( 0, 0 ).g == 255 && copiedImage.GetTexelColor( 0, 0 ).g == 2, "Copying an Image should copy its texels" );
+
+	Image movedImage( std::move( copiedImage ) );
+	VerifyTestResult( movedImage.GetDimensions() == IntVec2( 5, 3 ) && movedImage.GetTexelColor( 0, 0 ).g == 2 && copiedImage.GetRawData() == nullptr, "Moving an Image should take its texels" );
+
+	return 7;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+// Each entry is a gradient unique to it, so a texel copied from the wrong entry or row shows up
+//
+static std::vector<Rgba8> MakeEntryTexels( int entryIndex, IntVec2 const& size )
+{
+	std::vector<Rgba8> texels( static_cast<size_t>( size.x * size.y ) );
+	for( int texelY = 0; texelY < size.y; ++texelY )
+	{
+		for( int texelX = 0; texelX < size.x; ++texelX )
+		{
+			texels[ texelY * size.x + texelX ] = Rgba8( static_cast<unsigned char>( texelX * 3 ), static_cast<unsigned char>( texelY * 3 ), static_cast<unsigned char>( entryIndex ), 255 );
+		}
+	}
+	return texels;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_Atlas_TextureAtlas()
+{
+	RandomNumberGenerator rng;
+	rng.Reset( ATLAS_RNG_SEED );
+
+	const int pageSize = 256;
+	const int padding = 2;
+	const int numEntries = 60;
+
+	TextureAtlas atlas( pageSize, padding, RECT_PACK_MAX_RECTS );
+	std::vector<std::vector<Rgba8>> entryTexels;
+	std::vector<IntVec2> entrySizes;
+	for( int entryIndex = 0; entryIndex < numEntries; ++entryIndex )
+	{
+		IntVec2 size = RollRandomRectSize( rng );
+		entrySizes.push_back( size );
+		entryTexels.push_back( MakeEntryTexels( entryIndex, size ) );
+	}
+	for( int entryIndex = 0; entryIndex < numEntries; ++entryIndex )
+	{
+		atlas.AddEntry( Stringf( "entry%i", entryIndex ), entrySizes[ entryIndex ], entryTexels[ entryIndex ].data() );
+	}
+
+	std::vector<Rgba8> oversizedTexels( static_cast<size_t>( pageSize * 4 ), Rgba8( 255, 0, 0, 255 ) );
+	int oversizedEntry = atlas.AddEntry( "oversized", IntVec2( pageSize, 4 ), oversizedTexels.data() );
+	int emptyEntry = atlas.AddEntry( "empty", IntVec2( 8, 8 ), nullptr );
+
+	std::vector<Image> pages;
+	atlas.BuildPageImages( "UnitTestAtlas", pages );
+
+	VerifyTestResult( atlas.GetPageCount() == static_cast<int>( pages.size() ) && atlas.GetPageCount() > 1, "BuildPageImages() should spread the entries over more than one page" );
+	VerifyTestResult( atlas.GetPackedEntryCount() == numEntries && !atlas.IsEntryPacked( oversizedEntry ) && !atlas.IsEntryPacked( emptyEntry ), "Entries too big for a page or without texels should be left out" );
+	VerifyTestResult( atlas.FindEntry( "entry7" ) == 7 && atlas.FindEntry( "missing" ) == -1, "FindEntry() should find entries by name" );
+
+	bool arePagesPowersOfTwo = true;
+	for( size_t pageIndex = 0; pageIndex < pages.size(); ++pageIndex )
+	{
+		IntVec2 dimensions = pages[ pageIndex ].GetDimensions();
+		arePagesPowersOfTwo = arePagesPowersOfTwo && dimensions.x <= pageSize && dimensions.y <= pageSize && ( dimensions.x & ( dimensions.x - 1 ) ) == 0 && ( dimensions.y & ( dimensions.y - 1 ) ) == 0;
+	}
+	VerifyTestResult( arePagesPowersOfTwo, "Pages should be trimmed to powers of two no bigger than the page size" );
+
+	// Every texel of every entry, and its extruded border, read back through the UV remap table
+	bool doTexelsMatch = true;
+	bool doBordersMatch = true;
+	std::vector<std::vector<packed_rect_t>> paddedRectsPerPage( pages.size() );
+	for( int entryIndex = 0; entryIndex < numEntries && atlas.IsEntryPacked( entryIndex ); ++entryIndex )
+	{
+		Image const& page = pages[ atlas.GetEntryPageIndex( entryIndex ) ];
+		IntVec2 pageDimensions = page.GetDimensions();
+		AABB2 const& uvBounds = atlas.GetEntryUVBounds( entryIndex );
+		IntVec2 entryMins( static_cast<int>( roundf( uvBounds.mins.x * static_cast<float>( pageDimensions.x ) ) ), static_cast<int>( roundf( uvBounds.mins.y * static_cast<float>( pageDimensions.y ) ) ) );
+		IntVec2 entryMaxes( static_cast<int>( roundf( uvBounds.maxes.x * static_cast<float>( pageDimensions.x ) ) ), static_cast<int>( roundf( uvBounds.maxes.y * static_cast<float>( pageDimensions.y ) ) ) );
+		IntVec2 const& size = entrySizes[ entryIndex ];
+		if( entryMaxes - entryMins != size )
+		{
+			doTexelsMatch = false;
+			continue;
+		}
+
+		for( int paddedY = -padding; paddedY < size.y + padding; ++paddedY )
+		{
+			for( int paddedX = -padding; paddedX < size.x + padding; ++paddedX )
+			{
+				int sourceX = paddedX < 0 ? 0 : ( paddedX >= size.x ? size.x - 1 : paddedX );
+				int sourceY = paddedY < 0 ? 0 : ( paddedY >= size.y ? size.y - 1 : paddedY );
+				Rgba8 expected = entryTexels[ entryIndex ][ sourceY * size.x + sourceX ];
+				Rgba8 actual = page.GetTexelColor( entryMins.x + paddedX, entryMins.y + paddedY );
+				bool isMatch = actual.r == expected.r && actual.g == expected.g && actual.b == expected.b && actual.a == expected.a;
+
+				bool isBorder = paddedX < 0 || paddedY < 0 || paddedX >= size.x || paddedY >= size.y;
+				doBordersMatch = doBordersMatch && ( isMatch || !isBorder );
+				doTexelsMatch = doTexelsMatch && ( isMatch || isBorder );
+			}
+		}
+
+		packed_rect_t paddedRect;
+		paddedRect.mins = entryMins - IntVec2( padding, padding );
+		paddedRect.size = size + IntVec2( padding * 2, padding * 2 );
+		paddedRectsPerPage[ atlas.GetEntryPageIndex( entryIndex ) ].push_back( paddedRect );
+	}
+
+	bool isAnyPageOverlapping = false;
+	for( size_t pageIndex = 0; pageIndex < paddedRectsPerPage.size(); ++pageIndex )
+	{
+		isAnyPageOverlapping = isAnyPageOverlapping || AreAnyRectsOverlapping( paddedRectsPerPage[ pageIndex ] );
+	}
+
+	VerifyTestResult( doTexelsMatch, "Each entry's UV rect should hold exactly its texels" );
+	VerifyTestResult( doBordersMatch, "Each entry's border should repeat its edge texels" );
+	VerifyTestResult( !isAnyPageOverlapping, "Padded entries on the same page should not overlap" );
+	VerifyTestResult( atlas.GetPageFillFraction() > 0.f && atlas.GetPageFillFraction() <= 1.f, "The page fill fraction should be in ( 0, 1 ]" );
+
+	return 8;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_Atlas()
+{
+	RunTestSet( TestSet_Atlas_RectPacker,			"Atlas: RectPacker placement for each method" );
+	RunTestSet( TestSet_Atlas_PackRectsIntoBins,	"Atlas: PackRectsIntoBins" );
+	RunTestSet( TestSet_Atlas_ImageMips,			"Atlas: CPU mips and Image copy/move" );
+	RunTestSet( TestSet_Atlas_TextureAtlas,			"Atlas: TextureAtlas page images" );
+}
@@ -0,0 +1,9 @@
+//-----------------------------------------------------------------------------------------------
+// UnitTests_Atlas.hpp
+//
+#pragma once
+#include "Game/GameCommon.hpp"
+
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_Atlas();
@@ -0,0 +1,196 @@
+//-----------------------------------------------------------------------------------------------
+// UnitTests_Audio.cpp
+//
+// AudioSystem's voice budget decisions, checked against a NullAudioBackend: category and global
+//	limits, priority stealing, per-frame throttling, and 3D falloff, culling and panning.
+//
+#include "Game/UnitTests_Audio.hpp"
+#include "Engine/Audio/AudioSystem.hpp"
+#include "Engine/Audio/NullAudioBackend.hpp"
+
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_Audio_CategoryLimit()
+{
+	NullAudioBackend* backend = new NullAudioBackend( 64 );
+	AudioSystem audio( backend );
+	audio.SetCategoryVoiceLimit( SOUND_CATEGORY_SFX, 4 );
+	audio.SetMaxInstancesPerFrame( 0 );
+	SoundID sound = audio.CreateOrGetSound( "shot" );
+	for( int playIndex = 0; playIndex < 10; ++playIndex )
+	{
+		audio.PlaySound( sound );
+	}
+
+	SoundID music = audio.CreateOrGetSound( "music" );
+	sound_play_options_t musicOptions;
+	musicOptions.category = SOUND_CATEGORY_MUSIC;
+	musicOptions.isLooped = true;
+	SoundPlaybackID musicPlayback = audio.PlaySound( music, musicOptions );
+
+	VerifyTestResult( audio.CreateOrGetSound( "shot" ) == sound && music != sound, "CreateOrGetSound() should return the same ID for the same file" );
+	VerifyTestResult( backend->GetPlayingVoiceCount() == 5 && audio.GetCategoryRealVoiceCount( SOUND_CATEGORY_SFX ) == 4, "10 one-shots under an SFX limit of 4 should get 4 voices" );
+	VerifyTestResult( audio.GetVoiceStats().culled == 6 && audio.GetVirtualVoiceCount() == 5, "The 6 one-shots that didn't fit should be dropped" );
+	VerifyTestResult( audio.IsSoundPlaybackReal( musicPlayback ), "Music should still get a voice with SFX full" );
+
+	return 4;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_Audio_GlobalLimit()
+{
+	NullAudioBackend* backend = new NullAudioBackend( 8 );
+	AudioSystem audio( backend );
+	VerifyTestResult( audio.GetMaxRealVoiceCount() == 8, "The global budget should be clamped to what the backend can play" );
+
+	audio.SetMaxRealVoiceCount( 3 );
+	audio.SetMaxInstancesPerFrame( 0 );
+	SoundID sound = audio.CreateOrGetSound( "click" );
+	SoundID music = audio.CreateOrGetSound( "theme" );
+	sound_play_options_t uiOptions;
+	uiOptions.category = SOUND_CATEGORY_UI;
+	for( int playIndex = 0; playIndex < 3; ++playIndex )
+	{
+		audio.PlaySound( sound, uiOptions );
+	}
+
+	sound_play_options_t musicOptions;
+	musicOptions.category = SOUND_CATEGORY_MUSIC;
+	musicOptions.isLooped = true;
+	musicOptions.priority = uiOptions.priority;
+	SoundPlaybackID musicPlayback = audio.PlaySound( music, musicOptions );
+	VerifyTestResult( audio.GetRealVoiceCount() == 3 && !audio.IsSoundPlaybackReal( musicPlayback ) && audio.GetVirtualVoiceCount() == 4, "A loop past the global budget that outranks nothing should wait as a virtual voice" );
+
+	musicOptions.priority = uiOptions.priority + 1;
+	SoundPlaybackID importantPlayback = audio.PlaySound( music, musicOptions );
+	VerifyTestResult( audio.IsSoundPlaybackReal( importantPlayback ) && audio.GetRealVoiceCount() == 3 && audio.GetCategoryRealVoiceCount( SOUND_CATEGORY_UI ) == 2, "With the global budget full, any category's voice can be stolen" );
+	VerifyTestResult( backend->GetPlayingVoiceCount() == audio.GetRealVoiceCount(), "The backend should play exactly the real voices" );
+
+	return 4;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+// Priority stealing, then a stolen loop coming back once the voice frees up
+//
+int TestSet_Audio_PriorityStealing()
+{
+	NullAudioBackend* backend = new NullAudioBackend( 64 );
+	AudioSystem audio( backend );
+	audio.SetCategoryVoiceLimit( SOUND_CATEGORY_SFX, 2 );
+	SoundID ambience = audio.CreateOrGetSound( "hum" );
+	SoundID footstep = audio.CreateOrGetSound( "step" );
+	SoundID explosion = audio.CreateOrGetSound( "boom" );
+
+	sound_play_options_t loopOptions;
+	loopOptions.isLooped = true;
+	loopOptions.priority = 50;
+	SoundPlaybackID loopPlayback = audio.PlaySound( ambience, loopOptions );
+
+	sound_play_options_t stepOptions;
+	stepOptions.priority = 100;
+	audio.PlaySound( footstep, stepOptions );
+
+	sound_play_options_t explosionOptions;
+	explosionOptions.priority = 200;
+	SoundPlaybackID explosionPlayback = audio.PlaySound( explosion, explosionOptions );
+	BackendVoiceHandle explosionVoice = static_cast<BackendVoiceHandle>( backend->GetStartedVoiceCount() - 1 );
+
+	VerifyTestResult( audio.IsSoundPlaybackReal( explosionPlayback ) && !audio.IsSoundPlaybackReal( loopPlayback ), "A high priority sound should steal the lowest priority voice" );
+	VerifyTestResult( audio.GetVirtualVoiceCount() == 3 && audio.GetVoiceStats().stolen == 1, "The stolen loop should wait as a virtual voice" );
+
+	SoundPlaybackID lowPlayback = audio.PlaySound( footstep, stepOptions );
+	VerifyTestResult( lowPlayback != MISSING_SOUND_ID && !audio.IsSoundPlaybackReal( lowPlayback ) && audio.GetVoiceStats().culled == 1, "A one-shot that outranks nothing should be dropped" );
+
+	backend->FinishVoice( explosionVoice );
+	audio.BeginFrame();
+	VerifyTestResult( audio.IsSoundPlaybackReal( loopPlayback ) && audio.GetRealVoiceCount() == 2, "The loop should get its voice back when the one-shot ends" );
+
+	audio.StopSound( explosionPlayback );	// stale by now, must be a quiet no-op
+	audio.StopSound( loopPlayback );
+	VerifyTestResult( audio.GetRealVoiceCount() == 1 && backend->GetPlayingVoiceCount() == 1, "Stopping should free the voice, and stale IDs should be ignored" );
+
+	return 5;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_Audio_Throttling()
+{
+	NullAudioBackend* backend = new NullAudioBackend( 64 );
+	AudioSystem audio( backend );
+	SoundID sound = audio.CreateOrGetSound( "ricochet" );
+	SoundPlaybackID firstPlayback = audio.PlaySound( sound, false, 0.2f );
+	audio.PlaySound( sound, false, 0.2f );
+	SoundPlaybackID mergedPlayback = MISSING_SOUND_ID;
+	for( int playIndex = 0; playIndex < 8; ++playIndex )
+	{
+		mergedPlayback = audio.PlaySound( sound, false, 0.9f );
+	}
+	VerifyTestResult( backend->GetStartedVoiceCount() == 2 && audio.GetVoiceStats().throttled == 8, "10 identical sounds in one frame should start 2 voices" );
+	VerifyTestResult( mergedPlayback == firstPlayback && backend->GetVoiceVolume( 0 ) == 0.9f, "Merged sounds should raise the first one's volume" );
+
+	audio.BeginFrame();
+	audio.PlaySound( sound );
+	VerifyTestResult( backend->GetStartedVoiceCount() == 3, "The per-frame cap should reset the next frame" );
+
+	return 3;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_Audio_Distance()
+{
+	NullAudioBackend* backend = new NullAudioBackend( 64 );
+	AudioSystem audio( backend );
+	audio.SetCategoryVoiceLimit( SOUND_CATEGORY_SFX, 2 );
+	audio.SetListener( Vec3( 0.f, 0.f, 0.f ), Vec3( 0.f, 1.f, 0.f ) );
+	SoundID sound = audio.CreateOrGetSound( "growl" );
+	audio.SetMaxInstancesPerFrame( 0 );
+
+	sound_play_options_t farOptions;
+	farOptions.is3D = true;
+	farOptions.position = Vec3( 100.f, 0.f, 0.f );
+	audio.PlaySound( sound, farOptions );
+	VerifyTestResult( backend->GetStartedVoiceCount() == 0 && audio.GetVirtualVoiceCount() == 0, "A one-shot past maxDistance should be culled" );
+
+	farOptions.isLooped = true;
+	SoundPlaybackID loopPlayback = audio.PlaySound( sound, farOptions );
+	VerifyTestResult( !audio.IsSoundPlaybackReal( loopPlayback ) && audio.GetVirtualVoiceCount() == 1, "A loop past maxDistance should stay virtual" );
+
+	sound_play_options_t midOptions;
+	midOptions.is3D = true;
+	midOptions.position = Vec3( 30.f, 0.f, 0.f );
+	audio.PlaySound( sound, midOptions );
+	midOptions.position = Vec3( 25.f, 0.f, 0.f );
+	audio.PlaySound( sound, midOptions );
+
+	// The backend's first two voices are the 30 and 25 unit sounds
+	VerifyTestResult( backend->GetVoiceVolume( 0 ) > 0.f && backend->GetVoiceVolume( 0 ) < backend->GetVoiceVolume( 1 ), "A farther sound should play quieter" );
+
+	sound_play_options_t nearOptions;
+	nearOptions.is3D = true;
+	nearOptions.position = Vec3( 0.f, 5.f, 0.f );
+	SoundPlaybackID nearPlayback = audio.PlaySound( sound, nearOptions );
+	BackendVoiceHandle nearVoice = static_cast<BackendVoiceHandle>( backend->GetStartedVoiceCount() - 1 );
+	VerifyTestResult( audio.IsSoundPlaybackReal( nearPlayback ) && audio.GetVoiceStats().stolen == 1 && backend->GetPlayingVoiceCount() == 2, "At equal priority a nearer sound should steal the farthest voice" );
+	VerifyTestResult( backend->GetVoiceBalance( nearVoice ) < -0.99f, "A sound on the listener's left should pan left" );
+
+	audio.SetSoundPlaybackPosition( loopPlayback, Vec3( 1.f, 0.f, 0.f ) );
+	audio.BeginFrame();
+	VerifyTestResult( audio.IsSoundPlaybackReal( loopPlayback ) && audio.GetRealVoiceCount() == 2, "The loop should take a voice once it comes into range" );
+
+	return 6;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_Audio()
+{
+	RunTestSet( TestSet_Audio_CategoryLimit,		"Audio: per-category voice limits" );
+	RunTestSet( TestSet_Audio_GlobalLimit,			"Audio: global voice budget" );
+	RunTestSet( TestSet_Audio_PriorityStealing,		"Audio: priority stealing and virtual loops" );
+	RunTestSet( TestSet_Audio_Throttling,			"Audio: identical sounds in one frame" );
+	RunTestSet( TestSet_Audio_Distance,				"Audio: 3D falloff, culling and panning" );
+}
@@ -0,0 +1,9 @@
+//-----------------------------------------------------------------------------------------------
+// UnitTests_Audio.hpp
+//
+#pragma once
+#include "Game/GameCommon.hpp"
+
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_Audio();
@@ -0,0 +1,272 @@
+//-----------------------------------------------------------------------------------------------
+// UnitTests_Culling.cpp
+//
+// Frustum plane extraction checked against clip space, the single and batch volume tests, and
+//	StaticBoundsTree culling checked against brute force.
+//
+#include "Game/UnitTests_Culling.hpp"
+#include "Engine/Math/Frustum.hpp"
+#include "Engine/Math/StaticBoundsTree.hpp"
+#include "Engine/Math/Sphere3.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/OBB3.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/Vec4.hpp"
+#include "Engine/Math/MatrixUtils.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include <algorithm>
+#include <vector>
+#include <math.h>
+
+
+//-----------------------------------------------------------------------------------------------
+static const unsigned int	CULLING_RNG_SEED		= 41;
+static const int			NUM_REFERENCE_POINTS	= 4000;
+static const uint			NUM_RANDOM_VOLUMES		= 5000;
+
+
+//-----------------------------------------------------------------------------------------------
+static Vec3 RollRandomPosition( RandomNumberGenerator& rng, float halfRange )
+{
+	return Vec3( rng.RollRandomFloatInRange( -halfRange, halfRange ), rng.RollRandomFloatInRange( -halfRange, halfRange ), rng.RollRandomFloatInRange( -halfRange, halfRange ) );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+// Projection times view, the same product Camera::GetFrustum builds. Perspective projections are
+//	made with negative near and far, as the games pass them, since the camera looks down -z.
+//
+static Mat44 MakeViewProjection( Mat44 const& projection, Vec3 const& eyePosition, Vec3 const& lookAtPosition )
+{
+	// LookAt points +k at its target, but the camera looks down -k, so aim it at the mirrored point
+	Mat44 view = Mat44::LookAt( eyePosition, ( eyePosition * 2.f ) - lookAtPosition );
+	MatrixInvertOrthoNormal( view );
+
+	Mat44 viewProjection = projection;
+	viewProjection.TransformBy( view );
+	return viewProjection;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+// Compares Frustum::IsPointInside with the D3D clip test ( -w <= x,y <= w, 0 <= z <= w ) for
+//	random points, skipping any too close to a plane for float error to be meaningful
+//
+static void VerifyFrustumMatchesClipSpace( Mat44 const& viewProjection, float pointHalfRange, const char* matchTestName, const char* coverageTestName )
+{
+	RandomNumberGenerator rng;
+	rng.Reset( CULLING_RNG_SEED );
+	Frustum frustum( viewProjection );
+
+	int numMismatches = 0;
+	int numInside = 0;
+	int numOutside = 0;
+	for( int pointIndex = 0; pointIndex < NUM_REFERENCE_POINTS; ++pointIndex )
+	{
+		Vec3 point = RollRandomPosition( rng, pointHalfRange );
+		Vec4 clip = viewProjection.TransformHomogeneousPoint3D( Vec4( point, 1.f ) );
+
+		float margin = std::min( { clip.w - clip.x, clip.w + clip.x, clip.w - clip.y, clip.w + clip.y, clip.z, clip.w - clip.z } );
+		if( fabsf( margin ) < 0.001f * std::max( fabsf( clip.w ), 1.f ) )
+			continue;
+
+		bool isInsideClip = margin > 0.f;
+		numMismatches += ( frustum.IsPointInside( point ) != isInsideClip ) ? 1 : 0;
+		numInside += isInsideClip ? 1 : 0;
+		numOutside += isInsideClip ? 0 : 1;
+	}
+
+	VerifyTestResult( numMismatches == 0, matchTestName );
+	VerifyTestResult( numInside > 0 && numOutside > 0, coverageTestName );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_Culling_PlaneExtraction()
+{
+	Mat44 perspective = Mat44::CreatePerspectiveProjection( 60.f, 16.f / 9.f, -0.1f, -100.f );
+	Mat44 orthographic = Mat44::CreateOrthographicProjection( Vec3( -8.f, -4.5f, 0.f ), Vec3( 8.f, 4.5f, 50.f ) );
+
+	VerifyFrustumMatchesClipSpace( MakeViewProjection( perspective, Vec3::ZERO, Vec3( 0.f, 0.f, -1.f ) ), 60.f,
+		"Perspective frustum should agree with clip space", "Perspective reference points should land both inside and outside" );
+	VerifyFrustumMatchesClipSpace( MakeViewProjection( perspective, Vec3( 10.f, 5.f, -3.f ), Vec3( -4.f, 2.f, 8.f ) ), 60.f,
+		"Moved and rotated perspective frustum should agree with clip space", "Moved perspective reference points should land both inside and outside" );
+	VerifyFrustumMatchesClipSpace( MakeViewProjection( orthographic, Vec3( 2.f, 0.f, 0.f ), Vec3( 2.f, 0.f, 10.f ) ), 30.f,
+		"Orthographic frustum should agree with clip space", "Orthographic reference points should land both inside and outside" );
+
+	Frustum frustum( perspective );
+	bool areNormalized = true;
+	for( int planeIndex = 0; planeIndex < NUM_FRUSTUM_PLANES; ++planeIndex )
+	{
+		areNormalized = areNormalized && fabsf( frustum.planes[ planeIndex ].normal.GetLength() - 1.f ) < 0.0001f;
+	}
+	VerifyTestResult( areNormalized, "Frustum planes should be normalized" );
+
+	return 7;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_Culling_Volumes()
+{
+	Frustum frustum( MakeViewProjection( Mat44::CreatePerspectiveProjection( 60.f, 1.f, -0.1f, -100.f ), Vec3::ZERO, Vec3( 0.f, 0.f, -1.f ) ) );
+
+	// The near plane faces into the frustum, so it points the way the camera looks
+	Vec3 forward = frustum.planes[ FRUSTUM_PLANE_NEAR ].normal;
+	Vec3 ahead = forward * 20.f;
+	Vec3 behind = forward * -20.f;
+	Vec3 side = Vec3( 1.f, 0.f, 0.f ) * 40.f;
+
+	VerifyTestResult( frustum.IsPointInside( ahead ) && !frustum.IsPointInside( behind ), "A point ahead should be inside and one behind outside" );
+	VerifyTestResult( frustum.IsSphereVisible( Sphere3( ahead, 1.f ) ), "A sphere ahead should be visible" );
+	VerifyTestResult( !frustum.IsSphereVisible( Sphere3( behind, 1.f ) ), "A sphere behind should not be visible" );
+	VerifyTestResult( frustum.IsSphereVisible( Sphere3( ahead + side, 30.f ) ) && !frustum.IsPointInside( ahead + side ), "A sphere straddling a side plane should be visible" );
+
+	AABB3 insideBox( ahead - Vec3( 1.f, 1.f, 1.f ), ahead + Vec3( 1.f, 1.f, 1.f ) );
+	AABB3 straddlingBox( ahead - Vec3( 1.f, 1.f, 1.f ), ahead + side );
+	AABB3 outsideBox( behind - Vec3( 1.f, 1.f, 1.f ), behind + Vec3( 1.f, 1.f, 1.f ) );
+	AABB3 flippedBox( insideBox.maxes, insideBox.mins );
+	VerifyTestResult( frustum.ClassifyAABB3( insideBox ) == FRUSTUM_INSIDE, "ClassifyAABB3() of a box ahead should be inside" );
+	VerifyTestResult( frustum.ClassifyAABB3( straddlingBox ) == FRUSTUM_INTERSECTING, "ClassifyAABB3() of a box across a side plane should be intersecting" );
+	VerifyTestResult( frustum.ClassifyAABB3( outsideBox ) == FRUSTUM_OUTSIDE, "ClassifyAABB3() of a box behind should be outside" );
+	VerifyTestResult( frustum.IsAABB3Visible( insideBox ) && frustum.IsAABB3Visible( straddlingBox ) && !frustum.IsAABB3Visible( outsideBox ), "IsAABB3Visible() should agree with ClassifyAABB3()" );
+	VerifyTestResult( frustum.IsAABB3Visible( flippedBox ), "IsAABB3Visible() should accept a box with mins and maxes swapped" );
+
+	// Long and thin along x, so one end pokes into the frustum from the side until it is turned to run along z
+	AABB3 longBox( ahead + side - Vec3( 30.f, 0.5f, 0.5f ), ahead + side + Vec3( 30.f, 0.5f, 0.5f ) );
+	OBB3 reachingBox( longBox );
+	OBB3 rotatedAwayBox( longBox, Vec3( 0.f, 90.f, 0.f ) );
+	OBB3 behindBox( outsideBox, Vec3( 30.f, 45.f, 10.f ) );
+	VerifyTestResult( frustum.IsOBB3Visible( reachingBox ), "An OBB3 reaching into the frustum should be visible" );
+	VerifyTestResult( !frustum.IsOBB3Visible( rotatedAwayBox ), "The same OBB3 yawed to run along the view direction should not be visible" );
+	VerifyTestResult( !frustum.IsOBB3Visible( behindBox ), "A rotated OBB3 behind should not be visible" );
+
+	return 12;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_Culling_Batches()
+{
+	RandomNumberGenerator rng;
+	rng.Reset( CULLING_RNG_SEED );
+	Frustum frustum( MakeViewProjection( Mat44::CreatePerspectiveProjection( 70.f, 16.f / 9.f, -0.1f, -80.f ), Vec3( 3.f, 1.f, 2.f ), Vec3( 0.f, 0.f, -10.f ) ) );
+
+	std::vector<Sphere3> spheres;
+	std::vector<AABB3> boxes;
+	std::vector<OBB3> orientedBoxes;
+	for( uint volumeIndex = 0; volumeIndex < NUM_RANDOM_VOLUMES; ++volumeIndex )
+	{
+		Vec3 center = RollRandomPosition( rng, 100.f );
+		Vec3 halfDimensions = Vec3( rng.RollRandomFloatInRange( 0.1f, 5.f ), rng.RollRandomFloatInRange( 0.1f, 5.f ), rng.RollRandomFloatInRange( 0.1f, 5.f ) );
+		Vec3 pitchYawRoll = Vec3( rng.RollRandomFloatLessThan( 360.f ), rng.RollRandomFloatLessThan( 360.f ), rng.RollRandomFloatLessThan( 360.f ) );
+
+		spheres.push_back( Sphere3( center, halfDimensions.x ) );
+		boxes.push_back( AABB3( center - halfDimensions, center + halfDimensions ) );
+		orientedBoxes.push_back( OBB3( boxes.back(), pitchYawRoll ) );
+	}
+
+	std::vector<uint> visibleIndices( NUM_RANDOM_VOLUMES );
+	std::vector<uint> expectedIndices;
+
+	uint visibleCount = frustum.CullSpheres( spheres.data(), NUM_RANDOM_VOLUMES, visibleIndices.data() );
+	for( uint volumeIndex = 0; volumeIndex < NUM_RANDOM_VOLUMES; ++volumeIndex )
+	{
+		if( frustum.IsSphereVisible( spheres[ volumeIndex ] ) )
+		{
+			expectedIndices.push_back( volumeIndex );
+		}
+	}
+	bool doSpheresMatch = !expectedIndices.empty() && expectedIndices.size() < NUM_RANDOM_VOLUMES && std::equal( expectedIndices.begin(), expectedIndices.end(), visibleIndices.begin(), visibleIndices.begin() + visibleCount );
+	VerifyTestResult( doSpheresMatch, "CullSpheres() should return exactly the spheres IsSphereVisible() accepts, in order" );
+
+	expectedIndices.clear();
+	visibleCount = frustum.CullAABB3s( boxes.data(), NUM_RANDOM_VOLUMES, visibleIndices.data() );
+	for( uint volumeIndex = 0; volumeIndex < NUM_RANDOM_VOLUMES; ++volumeIndex )
+	{
+		if( frustum.IsAABB3Visible( boxes[ volumeIndex ] ) )
+		{
+			expectedIndices.push_back( volumeIndex );
+		}
+	}
+	bool doBoxesMatch = !expectedIndices.empty() && expectedIndices.size() < NUM_RANDOM_VOLUMES && std::equal( expectedIndices.begin(), expectedIndices.end(), visibleIndices.begin(), visibleIndices.begin() + visibleCount );
+	VerifyTestResult( doBoxesMatch, "CullAABB3s() should return exactly the boxes IsAABB3Visible() accepts, in order" );
+
+	expectedIndices.clear();
+	visibleCount = frustum.CullOBB3s( orientedBoxes.data(), NUM_RANDOM_VOLUMES, visibleIndices.data() );
+	for( uint volumeIndex = 0; volumeIndex < NUM_RANDOM_VOLUMES; ++volumeIndex )
+	{
+		if( frustum.IsOBB3Visible( orientedBoxes[ volumeIndex ] ) )
+		{
+			expectedIndices.push_back( volumeIndex );
+		}
+	}
+	bool doOrientedBoxesMatch = !expectedIndices.empty() && expectedIndices.size() < NUM_RANDOM_VOLUMES && std::equal( expectedIndices.begin(), expectedIndices.end(), visibleIndices.begin(), visibleIndices.begin() + visibleCount );
+	VerifyTestResult( doOrientedBoxesMatch, "CullOBB3s() should return exactly the boxes IsOBB3Visible() accepts, in order" );
+
+	return 3;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_Culling_StaticBoundsTree()
+{
+	RandomNumberGenerator rng;
+	rng.Reset( CULLING_RNG_SEED );
+
+	std::vector<AABB3> boxes;
+	for( uint boxIndex = 0; boxIndex < NUM_RANDOM_VOLUMES; ++boxIndex )
+	{
+		Vec3 center = RollRandomPosition( rng, 100.f );
+		Vec3 halfDimensions = Vec3( rng.RollRandomFloatInRange( 0.1f, 3.f ), rng.RollRandomFloatInRange( 0.1f, 3.f ), rng.RollRandomFloatInRange( 0.1f, 3.f ) );
+		boxes.push_back( AABB3( center - halfDimensions, center + halfDimensions ) );
+	}
+
+	StaticBoundsTree tree;
+	std::vector<uint> treeIndices( NUM_RANDOM_VOLUMES );
+	std::vector<uint> bruteForceIndices( NUM_RANDOM_VOLUMES );
+
+	Frustum frustum( MakeViewProjection( Mat44::CreatePerspectiveProjection( 60.f, 16.f / 9.f, -0.1f, -100.f ), Vec3::ZERO, Vec3( 0.f, 0.f, -1.f ) ) );
+	VerifyTestResult( tree.CullVisible( frustum, treeIndices.data() ) == 0, "An empty StaticBoundsTree should cull to nothing" );
+
+	tree.Build( boxes.data(), NUM_RANDOM_VOLUMES );
+	VerifyTestResult( tree.GetBoundsCount() == NUM_RANDOM_VOLUMES && tree.GetNodeCount() > 1, "StaticBoundsTree::Build() should hold every box in more than one node" );
+
+	// Looking from inside the cloud, off to one side of it, and from far away (whole tree inside)
+	const Vec3 eyePositions[ 3 ]	= { Vec3( 0.f, 0.f, 0.f ),		Vec3( 90.f, 20.f, -40.f ),	Vec3( 0.f, 0.f, 900.f ) };
+	const Vec3 lookAtPositions[ 3 ]	= { Vec3( 0.f, 0.f, -1.f ),		Vec3( 100.f, 20.f, 60.f ),	Vec3( 0.f, 0.f, 0.f ) };
+	const float farDistances[ 3 ]	= { 100.f,						100.f,						2000.f };
+
+	bool doAllViewsMatch = true;
+	bool wasWholeTreeVisible = false;
+	for( int viewIndex = 0; viewIndex < 3; ++viewIndex )
+	{
+		Mat44 projection = Mat44::CreatePerspectiveProjection( 60.f, 16.f / 9.f, -0.1f, -farDistances[ viewIndex ] );
+		Frustum viewFrustum( MakeViewProjection( projection, eyePositions[ viewIndex ], lookAtPositions[ viewIndex ] ) );
+
+		uint treeCount = tree.CullVisible( viewFrustum, treeIndices.data() );
+		uint bruteForceCount = viewFrustum.CullAABB3s( boxes.data(), NUM_RANDOM_VOLUMES, bruteForceIndices.data() );
+
+		// The tree writes in tree order
+		std::sort( treeIndices.begin(), treeIndices.begin() + treeCount );
+		doAllViewsMatch = doAllViewsMatch && treeCount == bruteForceCount && std::equal( treeIndices.begin(), treeIndices.begin() + treeCount, bruteForceIndices.begin() );
+		wasWholeTreeVisible = wasWholeTreeVisible || treeCount == NUM_RANDOM_VOLUMES;
+	}
+	VerifyTestResult( doAllViewsMatch, "StaticBoundsTree::CullVisible() should find the same boxes as CullAABB3s()" );
+	VerifyTestResult( wasWholeTreeVisible, "A frustum containing the whole tree should return every box" );
+
+	tree.Clear();
+	VerifyTestResult( tree.GetBoundsCount() == 0 && tree.CullVisible( frustum, treeIndices.data() ) == 0, "A cleared StaticBoundsTree should cull to nothing" );
+
+	return 5;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_Culling()
+{
+	RunTestSet( TestSet_Culling_PlaneExtraction,	"Culling: frustum planes against clip space" );
+	RunTestSet( TestSet_Culling_Volumes,			"Culling: sphere, AABB3 and OBB3 tests" );
+	RunTestSet( TestSet_Culling_Batches,			"Culling: batch culls against single tests" );
+	RunTestSet( TestSet_Culling_StaticBoundsTree,	"Culling: StaticBoundsTree against brute force" );
+}
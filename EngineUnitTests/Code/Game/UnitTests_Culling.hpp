@@ -0,0 +1,9 @@
+//-----------------------------------------------------------------------------------------------
+// UnitTests_Culling.hpp
+//
+#pragma once
+#include "Game/GameCommon.hpp"
+
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_Culling();
@@ -0,0 +1,171 @@
+//-----------------------------------------------------------------------------------------------
+// UnitTests_Platform.cpp
+//
+// The headless platform layer: monotonic time, folder listing, mapped file reads, the headless
+//	window, and input recordings round-tripping through the packed record format.
+//
+#include "Game/UnitTests_Platform.hpp"
+#include "Engine/Core/Time.hpp"
+#include "Engine/Core/FileUtils.hpp"
+#include "Engine/Input/InputSystem.hpp"
+#include "Engine/Input/InputRecording.hpp"
+#include "Engine/Platform/Window.hpp"
+#include <algorithm>
+#include <string.h>
+
+
+//-----------------------------------------------------------------------------------------------
+static const char* SCRATCH_FOLDER = "EngineUnitTests_Scratch";
+
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_Platform_Time()
+{
+	uint64_t firstTicks = GetCurrentTimeTicks();
+	double firstSeconds = GetCurrentTimeSeconds();
+
+	// Spin rather than sleep, so the test doesn't depend on scheduler granularity
+	double spinUntilSeconds = firstSeconds + 0.002;
+	while( GetCurrentTimeSeconds() < spinUntilSeconds )
+	{
+	}
+
+	uint64_t secondTicks = GetCurrentTimeTicks();
+	double secondSeconds = GetCurrentTimeSeconds();
+	double ticksElapsedSeconds = static_cast<double>( secondTicks - firstTicks ) * GetSecondsPerTick();
+
+	VerifyTestResult( GetSecondsPerTick() > 0.0, "GetSecondsPerTick() should be positive" );
+	VerifyTestResult( secondTicks > firstTicks, "GetCurrentTimeTicks() should increase" );
+	VerifyTestResult( secondSeconds - firstSeconds >= 0.002, "GetCurrentTimeSeconds() should advance by at least the spin time" );
+	VerifyTestResult( ticksElapsedSeconds >= 0.002 && ticksElapsedSeconds < 1.0, "Ticks times GetSecondsPerTick() should match elapsed seconds" );
+
+	return 4;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_Platform_Files()
+{
+	std::string textPath = std::string( SCRATCH_FOLDER ) + "/mapped.txt";
+	std::string binaryPath = std::string( SCRATCH_FOLDER ) + "/other.bin";
+	const char* fileText = "The quick brown fox jumps over the lazy dog";
+	size_t fileTextLength = strlen( fileText );
+
+	VerifyTestResult( CreateFolder( SCRATCH_FOLDER ), "CreateFolder() should succeed" );
+	VerifyTestResult( CreateFolder( SCRATCH_FOLDER ), "CreateFolder() on an existing folder should succeed" );
+	VerifyTestResult( FileWriteFromBuffer( textPath, fileText, fileTextLength ), "FileWriteFromBuffer() should succeed" );
+	VerifyTestResult( FileWriteFromBuffer( binaryPath, fileText, 4 ), "FileWriteFromBuffer() of a second file should succeed" );
+
+	int64_t modifiedTime = 0;
+	size_t fileSize = 0;
+	bool hasInfo = GetFileModificationInfo( textPath, &modifiedTime, &fileSize );
+	VerifyTestResult( hasInfo && fileSize == fileTextLength && modifiedTime != 0, "GetFileModificationInfo() should report the written size and a time" );
+
+	size_t mappedSize = 0;
+	const void* mappedData = FileMapReadOnly( textPath, &mappedSize );
+	bool isMappedCorrectly = mappedData != nullptr && mappedSize == fileTextLength && memcmp( mappedData, fileText, fileTextLength ) == 0;
+	VerifyTestResult( isMappedCorrectly, "FileMapReadOnly() should map exactly the file's bytes" );
+	FileUnmap( mappedData, mappedSize );
+
+	size_t missingSize = 123;
+	const void* missingData = FileMapReadOnly( std::string( SCRATCH_FOLDER ) + "/missing.txt", &missingSize );
+	VerifyTestResult( missingData == nullptr, "FileMapReadOnly() of a missing file should return null" );
+
+	Strings textFileNames = GetFileNamesInFolder( SCRATCH_FOLDER, "*.txt" );
+	Strings allFileNames = GetFileNamesInFolder( SCRATCH_FOLDER, "*" );
+	bool hasTextFile = std::find( allFileNames.begin(), allFileNames.end(), "mapped.txt" ) != allFileNames.end();
+	bool hasBinaryFile = std::find( allFileNames.begin(), allFileNames.end(), "other.bin" ) != allFileNames.end();
+	VerifyTestResult( textFileNames.size() == 1 && textFileNames[ 0 ] == "mapped.txt", "GetFileNamesInFolder() should only list files matching the pattern" );
+	VerifyTestResult( hasTextFile && hasBinaryFile, "GetFileNamesInFolder( \"*\" ) should list every file" );
+
+	return 9;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_Platform_HeadlessWindow()
+{
+	Window window;
+	bool isOpen = window.Open( "EngineUnitTests", 16.f / 9.f, 0.5f );
+
+	VerifyTestResult( isOpen, "Headless Window::Open() should succeed" );
+	VerifyTestResult( window.GetClientWidth() == 960 && window.GetClientHeight() == 540, "Headless 16:9 window at half height should be 960x540" );
+
+	window.Close();
+	return 2;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_Platform_InputRecording()
+{
+	InputSystem input;
+	InputRecorder recorder;
+	recorder.BeginRecording();
+
+	// Frame 0: nothing pressed. Frame 1: A pressed and the mouse moved. Frame 2: A held.
+	InputState frameStates[ 3 ];
+	for( int frameIndex = 1; frameIndex < 3; ++frameIndex )
+	{
+		frameStates[ frameIndex ].m_mouseNormalizedPos = Vec2( 0.25f, 0.75f );
+		frameStates[ frameIndex ].m_scrollAmount = 2.f;
+		for( int pressedFrameIndex = 1; pressedFrameIndex <= frameIndex; ++pressedFrameIndex )
+		{
+			frameStates[ frameIndex ].m_keyStates[ 'A' ].UpdateStatus( true );
+		}
+	}
+
+	const double frameDeltas[ 3 ] = { 1.0 / 60.0, 1.0 / 30.0, 1.0 / 60.0 };
+	for( int frameIndex = 0; frameIndex < 3; ++frameIndex )
+	{
+		recorder.RecordFrame( frameStates[ frameIndex ], frameDeltas[ frameIndex ] );
+	}
+	recorder.EndRecording();
+
+	std::vector<unsigned char> recordingBytes;
+	recorder.WriteToBuffer( recordingBytes );
+
+	InputPlayback playback;
+	VerifyTestResult( playback.LoadFromBuffer( recordingBytes.data(), recordingBytes.size() ), "InputPlayback::LoadFromBuffer() should accept a fresh recording" );
+	VerifyTestResult( playback.GetFrameCount() == 3, "InputPlayback should hold three frames" );
+
+	bool doAllFramesMatch = true;
+	for( int frameIndex = 0; frameIndex < 3; ++frameIndex )
+	{
+		InputState playedState;
+		double playedDelta = 0.0;
+		if( !playback.ReadNextFrame( playedState, playedDelta ) )
+		{
+			doAllFramesMatch = false;
+			break;
+		}
+
+		InputState const& recordedState = frameStates[ frameIndex ];
+		doAllFramesMatch = doAllFramesMatch && playedDelta == frameDeltas[ frameIndex ];
+		doAllFramesMatch = doAllFramesMatch && playedState.m_scrollAmount == recordedState.m_scrollAmount;
+		doAllFramesMatch = doAllFramesMatch && playedState.m_mouseNormalizedPos == recordedState.m_mouseNormalizedPos;
+		doAllFramesMatch = doAllFramesMatch && playedState.m_keyStates[ 'A' ].IsPressed() == recordedState.m_keyStates[ 'A' ].IsPressed();
+		doAllFramesMatch = doAllFramesMatch && playedState.m_keyStates[ 'A' ].WasJustPressed() == recordedState.m_keyStates[ 'A' ].WasJustPressed();
+	}
+	VerifyTestResult( doAllFramesMatch, "Played back frames should match the recorded input and deltas" );
+	VerifyTestResult( playback.IsFinished(), "InputPlayback should be finished after the last frame" );
+
+	input.SetFromInputState( frameStates[ 2 ] );
+	InputState roundTrippedState = input.GetInputState();
+	VerifyTestResult( roundTrippedState.m_keyStates[ 'A' ].IsPressed() && roundTrippedState.m_scrollAmount == 2.f, "InputSystem Get/SetFromInputState should round trip" );
+
+	std::vector<unsigned char> truncatedBytes( recordingBytes.begin(), recordingBytes.begin() + 8 );
+	VerifyTestResult( !playback.LoadFromBuffer( truncatedBytes.data(), truncatedBytes.size() ), "InputPlayback should reject a truncated header" );
+
+	return 6;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_Platform()
+{
+	RunTestSet( TestSet_Platform_Time,				"Platform: monotonic time" );
+	RunTestSet( TestSet_Platform_Files,				"Platform: files, folders and mapped reads" );
+	RunTestSet( TestSet_Platform_HeadlessWindow,	"Platform: headless window" );
+	RunTestSet( TestSet_Platform_InputRecording,	"Platform: input recording round trip" );
+}
@@ -0,0 +1,9 @@
+//-----------------------------------------------------------------------------------------------
+// UnitTests_Platform.hpp
+//
+#pragma once
+#include "Game/GameCommon.hpp"
+
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_Platform();
@@ -0,0 +1,293 @@
+//-----------------------------------------------------------------------------------------------
+// UnitTests_ShaderCache.cpp
+//
+// ShaderCache over a StubShaderCompiler: what does and doesn't change the cache key, rejecting
+//	damaged cache files, and compiling a miss on a job worker while the old bytecode stays bound.
+//
+#include "Game/UnitTests_ShaderCache.hpp"
+#include "Engine/Renderer/ShaderCache.hpp"
+#include "Engine/Renderer/StubShaderCompiler.hpp"
+#include "Engine/Core/FileUtils.hpp"
+#include "Engine/Core/JobSystem.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Core/Time.hpp"
+#include <stdio.h>
+#include <string.h>
+
+
+//-----------------------------------------------------------------------------------------------
+static const char* SHADER_SCRATCH_FOLDER	= "EngineUnitTests_Scratch/Shaders";
+static const char* SHADER_CACHE_FOLDER		= "EngineUnitTests_Scratch/ShaderCache";
+static const double JOB_TIMEOUT_SECONDS		= 5.0;
+
+
+//-----------------------------------------------------------------------------------------------
+// Every run starts from an empty cache, so the first lookup of each shader is a real miss
+//
+static void ClearShaderCacheFolder()
+{
+	CreateFolder( "EngineUnitTests_Scratch" );
+	CreateFolder( SHADER_SCRATCH_FOLDER );
+	CreateFolder( SHADER_CACHE_FOLDER );
+
+	Strings cacheFileNames = GetFileNamesInFolder( SHADER_CACHE_FOLDER, "*.sbc" );
+	for( size_t fileIndex = 0; fileIndex < cacheFileNames.size(); ++fileIndex )
+	{
+		remove( Stringf( "%s/%s", SHADER_CACHE_FOLDER, cacheFileNames[ fileIndex ].c_str() ).c_str() );
+	}
+}
+
+
+//-----------------------------------------------------------------------------------------------
+static void WriteTextFile( std::string const& filepath, std::string const& text )
+{
+	FileWriteFromBuffer( filepath, text.c_str(), text.length() );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+static shader_compile_desc_t MakeTestDesc( std::string const& filename, std::string const& source )
+{
+	shader_compile_desc_t desc;
+	desc.filename	= filename;
+	desc.source		= source;
+	desc.stage		= SHADER_TYPE_VERTEX;
+	desc.flags		= SHADER_COMPILE_DEBUG;
+	desc.defines.push_back( "LIGHT_COUNT=8" );
+	return desc;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+static std::string GetCacheFilepath( ShaderCache const& cache, shader_compile_desc_t const& desc )
+{
+	return Stringf( "%s/%016llx.sbc", SHADER_CACHE_FOLDER, static_cast<unsigned long long>( cache.GetCacheKey( desc ) ) );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+// True if looking desc up compiled it rather than loading it from the cache
+//
+static bool DidLookupCompile( ShaderCache& cache, StubShaderCompiler const& compiler, shader_compile_desc_t const& desc, shader_compile_result_t& out_result )
+{
+	uint compilesBefore = compiler.GetCompileCount();
+	bool isSuccess = cache.GetOrCompile( desc, out_result );
+	return isSuccess && !out_result.wasCacheHit && compiler.GetCompileCount() == compilesBefore + 1;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_ShaderCache_Keys()
+{
+	ClearShaderCacheFolder();
+	std::string includePath = std::string( SHADER_SCRATCH_FOLDER ) + "/Lighting.hlsl";
+	std::string shaderPath = std::string( SHADER_SCRATCH_FOLDER ) + "/Lit.hlsl";
+	WriteTextFile( includePath, "float3 ApplyLighting();\n" );
+
+	StubShaderCompiler compiler;
+	ShaderCache cache( &compiler, SHADER_CACHE_FOLDER );
+	shader_compile_desc_t desc = MakeTestDesc( shaderPath, "#include \"Lighting.hlsl\"\nfloat4 VertexFunction();\n" );
+
+	shader_compile_result_t firstResult;
+	bool wasCompiled = DidLookupCompile( cache, compiler, desc, firstResult );
+	VerifyTestResult( wasCompiled && firstResult.includedFiles.size() == 1 && firstResult.includedFiles[ 0 ] == includePath, "The first lookup should compile and report the include" );
+
+	shader_compile_result_t hitResult;
+	bool isHit = cache.GetOrCompile( desc, hitResult ) && hitResult.wasCacheHit && compiler.GetCompileCount() == 1;
+	VerifyTestResult( isHit && hitResult.byteCode == firstResult.byteCode && hitResult.includedFiles == firstResult.includedFiles, "The same key should hit, with the same bytecode and includes" );
+
+	ShaderCache reopenedCache( &compiler, SHADER_CACHE_FOLDER );
+	shader_compile_result_t reopenedResult;
+	VerifyTestResult( reopenedCache.TryLoad( desc, reopenedResult ) && reopenedResult.byteCode == firstResult.byteCode, "A new ShaderCache on the same folder should hit from disk" );
+
+	shader_compile_result_t result;
+	shader_compile_desc_t changedDesc = desc;
+	changedDesc.source += "// edited\n";
+	VerifyTestResult( DidLookupCompile( cache, compiler, changedDesc, result ) && result.byteCode != firstResult.byteCode, "Changing the source should miss" );
+
+	changedDesc = desc;
+	changedDesc.stage = SHADER_TYPE_FRAGMENT;
+	VerifyTestResult( DidLookupCompile( cache, compiler, changedDesc, result ) && result.byteCode != firstResult.byteCode, "Changing the stage should miss" );
+
+	changedDesc = desc;
+	changedDesc.defines[ 0 ] = "LIGHT_COUNT=4";
+	VerifyTestResult( DidLookupCompile( cache, compiler, changedDesc, result ) && result.byteCode != firstResult.byteCode, "Changing a define should miss" );
+
+	changedDesc = desc;
+	changedDesc.flags = SHADER_COMPILE_OPTIMIZE_FULLY;
+	VerifyTestResult( DidLookupCompile( cache, compiler, changedDesc, result ) && result.byteCode != firstResult.byteCode, "Changing the flags should miss" );
+
+	WriteTextFile( includePath, "float3 ApplyLighting( float3 normal );\n" );
+	bool didIncludeEditMiss = DidLookupCompile( cache, compiler, desc, result ) && result.byteCode != firstResult.byteCode;
+	bool isHitAfterRecompile = cache.GetOrCompile( desc, hitResult ) && hitResult.wasCacheHit;
+	VerifyTestResult( didIncludeEditMiss && isHitAfterRecompile, "Editing an include should miss once, then hit the recompiled entry" );
+
+	return 8;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_ShaderCache_DamagedFiles()
+{
+	ClearShaderCacheFolder();
+	std::string shaderPath = std::string( SHADER_SCRATCH_FOLDER ) + "/Unlit.hlsl";
+
+	StubShaderCompiler compiler;
+	ShaderCache cache( &compiler, SHADER_CACHE_FOLDER );
+	shader_compile_desc_t desc = MakeTestDesc( shaderPath, "float4 VertexFunction();\n" );
+	shader_compile_desc_t otherDesc = MakeTestDesc( shaderPath, "float4 FragmentFunction();\n" );
+
+	shader_compile_result_t result;
+	cache.GetOrCompile( desc, result );
+	cache.GetOrCompile( otherDesc, result );
+
+	std::string cachePath = GetCacheFilepath( cache, desc );
+	size_t fileSize = 0;
+	unsigned char* fileData = static_cast<unsigned char*>( FileReadBinaryToNewBuffer( cachePath, &fileSize ) );
+	std::vector<unsigned char> goodFile( fileData, fileData + fileSize );
+	delete[] fileData;
+	VerifyTestResult( fileSize > 0 && cache.TryLoad( desc, result ), "A compiled entry should be on disk and load" );
+
+	FileWriteFromBuffer( cachePath, goodFile.data(), goodFile.size() - 3 );
+	VerifyTestResult( !cache.TryLoad( desc, result ), "A file missing the end of its bytecode should be rejected" );
+
+	FileWriteFromBuffer( cachePath, goodFile.data(), 10 );
+	VerifyTestResult( !cache.TryLoad( desc, result ), "A file shorter than its header should be rejected" );
+
+	std::vector<unsigned char> corruptFile = goodFile;
+	corruptFile[ 0 ] ^= 0xff;
+	FileWriteFromBuffer( cachePath, corruptFile.data(), corruptFile.size() );
+	VerifyTestResult( !cache.TryLoad( desc, result ), "A file with the wrong magic should be rejected" );
+
+	corruptFile = goodFile;
+	corruptFile.push_back( 0 );
+	FileWriteFromBuffer( cachePath, corruptFile.data(), corruptFile.size() );
+	VerifyTestResult( !cache.TryLoad( desc, result ), "A file with trailing bytes should be rejected" );
+
+	// Another entry's file under this key's name, as a bad copy or a hash collision would leave it
+	fileData = static_cast<unsigned char*>( FileReadBinaryToNewBuffer( GetCacheFilepath( cache, otherDesc ), &fileSize ) );
+	FileWriteFromBuffer( cachePath, fileData, fileSize );
+	delete[] fileData;
+	VerifyTestResult( !cache.TryLoad( desc, result ), "A file written for another key should be rejected" );
+
+	bool didRecompile = DidLookupCompile( cache, compiler, desc, result );
+	bool isHitAfterRecompile = cache.GetOrCompile( desc, result ) && result.wasCacheHit;
+	VerifyTestResult( didRecompile && isHitAfterRecompile, "A rejected entry should be recompiled and rewritten" );
+
+	return 7;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+// Stands in for a Shader: what's bound only changes when a job finishes successfully, the same
+//	rule RenderContext::FinalizeAsyncShaderCompile follows
+//
+struct test_bound_program_t
+{
+	std::vector<unsigned char>	vertexByteCode;
+	std::vector<unsigned char>	fragmentByteCode;
+	int							finalizeCount	= 0;
+	std::string					lastErrors;
+};
+
+
+//-----------------------------------------------------------------------------------------------
+class TestShaderCompileJob : public ShaderProgramCompileJob
+{
+public:
+	TestShaderCompileJob( ShaderCache* shaderCache, shader_compile_desc_t const& programDesc, test_bound_program_t* program )
+		: ShaderProgramCompileJob( shaderCache, programDesc )
+		, m_program( program )
+	{
+	}
+
+protected:
+	virtual void FinalizeLoad() override
+	{
+		++m_program->finalizeCount;
+		m_program->lastErrors = m_vertexResult.errors + m_fragmentResult.errors;
+		if( IsSuccess() )
+		{
+			m_program->vertexByteCode = m_vertexResult.byteCode;
+			m_program->fragmentByteCode = m_fragmentResult.byteCode;
+		}
+	}
+
+private:
+	test_bound_program_t* m_program = nullptr;
+};
+
+
+//-----------------------------------------------------------------------------------------------
+static bool ClaimUntilFinalized( test_bound_program_t const& program, int finalizeCount )
+{
+	double timeoutSeconds = GetCurrentTimeSeconds() + JOB_TIMEOUT_SECONDS;
+	while( program.finalizeCount < finalizeCount && GetCurrentTimeSeconds() < timeoutSeconds )
+	{
+		g_theJobSystem->ClaimAndDeleteCompletedJobs( JOB_CATEGORY_RENDER_ASSET_LOADING );
+	}
+	return program.finalizeCount == finalizeCount;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_ShaderCache_AsyncCompile()
+{
+	ClearShaderCacheFolder();
+	std::string shaderPath = std::string( SHADER_SCRATCH_FOLDER ) + "/Async.hlsl";
+	WriteTextFile( shaderPath, "float4 VertexFunction();\nfloat4 FragmentFunction();\n" );
+
+	JobSystem jobSystem;
+	g_theJobSystem = &jobSystem;
+	jobSystem.CreateWorkerThreads( 2 );
+
+	StubShaderCompiler compiler;
+	ShaderCache cache( &compiler, SHADER_CACHE_FOLDER );
+	shader_compile_desc_t programDesc = MakeTestDesc( shaderPath, "" );
+
+	// Until anything compiles, the program draws with the error shader's bytecode
+	std::vector<unsigned char> const errorByteCode = { 'E', 'R', 'R' };
+	test_bound_program_t program;
+	program.vertexByteCode = errorByteCode;
+	program.fragmentByteCode = errorByteCode;
+
+	compiler.SetCompilesHeld( true );
+	PostAsyncLoadJob( new TestShaderCompileJob( &cache, programDesc, &program ) );
+	double timeoutSeconds = GetCurrentTimeSeconds() + JOB_TIMEOUT_SECONDS;
+	while( compiler.GetCompileCount() == 0 && GetCurrentTimeSeconds() < timeoutSeconds )
+	{
+	}
+	jobSystem.ClaimAndDeleteCompletedJobs( JOB_CATEGORY_RENDER_ASSET_LOADING );
+	VerifyTestResult( compiler.GetCompileCount() == 1 && cache.GetMissCount() == 1, "The miss should be compiling on a worker" );
+	VerifyTestResult( program.finalizeCount == 0 && program.vertexByteCode == errorByteCode && program.fragmentByteCode == errorByteCode, "The error bytecode should stay bound while the compile runs" );
+
+	compiler.SetCompilesHeld( false );
+	bool wasFinalized = ClaimUntilFinalized( program, 1 );
+	shader_compile_desc_t vertexDesc = programDesc;
+	vertexDesc.source = "float4 VertexFunction();\nfloat4 FragmentFunction();\n";
+	shader_compile_result_t cachedVertex;
+	bool isCached = cache.TryLoad( vertexDesc, cachedVertex );
+	VerifyTestResult( wasFinalized && compiler.GetCompileCount() == 2 && isCached && program.vertexByteCode == cachedVertex.byteCode && program.fragmentByteCode != errorByteCode, "Finishing the job should bind both stages' new bytecode" );
+
+	std::vector<unsigned char> const goodVertexByteCode = program.vertexByteCode;
+	WriteTextFile( shaderPath, "float4 VertexFunction();\n#error missing semicolon\n" );
+	PostAsyncLoadJob( new TestShaderCompileJob( &cache, programDesc, &program ) );
+	wasFinalized = ClaimUntilFinalized( program, 2 );
+	VerifyTestResult( wasFinalized && program.vertexByteCode == goodVertexByteCode, "A failed recompile should leave the previous bytecode bound" );
+	VerifyTestResult( program.lastErrors.find( "missing semicolon" ) != std::string::npos, "A failed recompile should report the compiler's errors" );
+
+	jobSystem.ShutDown();
+	g_theJobSystem = nullptr;
+	g_isJobSystemQuitting = false;
+
+	return 5;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_ShaderCache()
+{
+	RunTestSet( TestSet_ShaderCache_Keys,			"ShaderCache: hits and misses" );
+	RunTestSet( TestSet_ShaderCache_DamagedFiles,	"ShaderCache: damaged cache files" );
+	RunTestSet( TestSet_ShaderCache_AsyncCompile,	"ShaderCache: compiling a miss on a job" );
+}
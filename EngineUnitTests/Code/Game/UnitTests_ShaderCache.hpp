@@ -0,0 +1,9 @@
+//-----------------------------------------------------------------------------------------------
+// UnitTests_ShaderCache.hpp
+//
+#pragma once
+#include "Game/GameCommon.hpp"
+
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_ShaderCache();
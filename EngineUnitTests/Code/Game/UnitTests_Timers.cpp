@@ -0,0 +1,204 @@
+//-----------------------------------------------------------------------------------------------
+// UnitTests_Timers.cpp
+//
+// TimerWheel and the Clock timer API: deadlines that land on the level 1 and level 2 cascades,
+//	cancelling from inside a callback, paused clock subtrees, and repeating timers over uneven frames.
+//
+#include "Game/UnitTests_Timers.hpp"
+#include "Engine/Core/Clock.hpp"
+#include "Engine/Core/TimerWheel.hpp"
+#include <math.h>
+
+
+//-----------------------------------------------------------------------------------------------
+struct timer_cancel_test_t
+{
+	TimerWheel*	wheel		= nullptr;
+	TimerHandle	toCancel;
+	int			fireCount	= 0;
+};
+
+
+//-----------------------------------------------------------------------------------------------
+static void CountTimerFire( void* userData )
+{
+	int* fireCount = static_cast<int*>( userData );
+	( *fireCount )++;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+static void CancelTimerOnFire( void* userData )
+{
+	timer_cancel_test_t* cancelTest = static_cast<timer_cancel_test_t*>( userData );
+	cancelTest->fireCount++;
+	cancelTest->wheel->Cancel( cancelTest->toCancel );
+}
+
+
+//-----------------------------------------------------------------------------------------------
+// 256 ticks out is the first slot of level 1 and 65536 the first of level 2, so those timers only
+//	reach the due list when their level cascades
+//
+int TestSet_Timers_CascadeBoundaries()
+{
+	TimerWheel wheel;
+	bool levelZeroFired		= false;
+	bool levelOneFired		= false;
+	bool levelOneLastFired	= false;
+	bool levelTwoFired		= false;
+	bool afterLevelTwoFired	= false;
+	wheel.ScheduleFlag( 0.255, &levelZeroFired );
+	wheel.ScheduleFlag( 0.256, &levelOneFired );
+	wheel.ScheduleFlag( 65.535, &levelOneLastFired );
+	wheel.ScheduleFlag( 65.536, &levelTwoFired );
+	wheel.ScheduleFlag( 65.537, &afterLevelTwoFired );
+
+	wheel.AdvanceTo( 0.255 );
+	bool isLevelZeroOnTime = levelZeroFired && !levelOneFired;
+	wheel.AdvanceTo( 0.256 );
+	VerifyTestResult( isLevelZeroOnTime && levelOneFired, "A timer 256 ticks out should fire on the level 1 cascade, not before" );
+
+	// Frame sized steps, so every slot between the two boundaries is passed over
+	for( uint tick = 306; tick < 65535; tick += 50 )
+	{
+		wheel.AdvanceTo( static_cast<double>( tick ) / 1000.0 );
+	}
+	wheel.AdvanceTo( 65.535 );
+	VerifyTestResult( levelOneLastFired && !levelTwoFired, "A timer in level 1's last slot should fire before the level 2 cascade" );
+
+	wheel.AdvanceTo( 65.536 );
+	VerifyTestResult( levelTwoFired && !afterLevelTwoFired && wheel.GetScheduledCount() == 1, "A timer 65536 ticks out should fire on the level 2 cascade, and only that timer" );
+
+	wheel.AdvanceTo( 65.537 );
+	VerifyTestResult( afterLevelTwoFired && wheel.GetScheduledCount() == 0, "The timer one tick past the level 2 boundary should fire on the next tick" );
+
+	TimerWheel jumpWheel;
+	bool jumpFired = false;
+	jumpWheel.ScheduleFlag( 65.536, &jumpFired );
+	jumpWheel.AdvanceTo( 70.0 );
+	VerifyTestResult( jumpFired, "One advance across both cascades should still fire the timer" );
+
+	return 5;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_Timers_CancelDuringCallback()
+{
+	TimerWheel wheel;
+	timer_cancel_test_t firstTest;
+	timer_cancel_test_t secondTest;
+	timer_cancel_test_t repeatingTest;
+	firstTest.wheel = &wheel;
+	secondTest.wheel = &wheel;
+	repeatingTest.wheel = &wheel;
+
+	// Both are due in the same advance and each cancels the other, so whichever fires first wins
+	TimerHandle firstTimer = wheel.Schedule( 0.010, CancelTimerOnFire, &firstTest );
+	TimerHandle secondTimer = wheel.Schedule( 0.010, CancelTimerOnFire, &secondTest );
+	firstTest.toCancel = secondTimer;
+	secondTest.toCancel = firstTimer;
+
+	// Cancels itself, which has to stop the catch-up firing for the periods it has fallen behind
+	TimerHandle repeatingTimer = wheel.Schedule( 0.010, CancelTimerOnFire, &repeatingTest, 0.010 );
+	repeatingTest.toCancel = repeatingTimer;
+
+	int laterFireCount = 0;
+	TimerHandle laterTimer = wheel.Schedule( 0.500, CountTimerFire, &laterFireCount );
+
+	wheel.AdvanceTo( 0.100 );
+	VerifyTestResult( firstTest.fireCount + secondTest.fireCount == 1, "A timer cancelled by another due in the same advance should not fire" );
+	VerifyTestResult( repeatingTest.fireCount == 1 && !wheel.IsScheduled( repeatingTimer ), "A repeating timer that cancels itself should not re-arm" );
+	VerifyTestResult( wheel.IsScheduled( laterTimer ) && wheel.GetScheduledCount() == 1, "Only the timer nobody cancelled should still be scheduled" );
+
+	// The freed entries get reused; the old handles must not see the new timers
+	bool reusedFired = false;
+	wheel.ScheduleFlag( 0.200, &reusedFired );
+	wheel.ScheduleFlag( 0.200, &reusedFired );
+	VerifyTestResult( !wheel.IsScheduled( firstTimer ) && !wheel.IsScheduled( secondTimer ) && !wheel.IsScheduled( repeatingTimer ), "Stale handles should stay unscheduled after their entries are reused" );
+
+	wheel.AdvanceTo( 1.0 );
+	VerifyTestResult( reusedFired && laterFireCount == 1 && wheel.GetScheduledCount() == 0, "Timers scheduled after the cancels should fire normally" );
+
+	return 5;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_Timers_PausedSubtree()
+{
+	Clock parentClock( nullptr );
+	Clock childClock( &parentClock );
+	Clock grandchildClock( &childClock );
+
+	bool childFired = false;
+	int grandchildFireCount = 0;
+	TimerHandle childTimer = childClock.ScheduleFlag( 0.5, &childFired );
+	grandchildClock.ScheduleCallback( 0.125, CountTimerFire, &grandchildFireCount, true );
+
+	// Exact in binary, so the clock totals compare exactly
+	double const frameSeconds = 0.0625;
+	for( int frameIndex = 0; frameIndex < 4; ++frameIndex )
+	{
+		parentClock.Update( frameSeconds );
+	}
+	bool isRunningBeforePause = grandchildFireCount == 2 && !childFired;
+
+	childClock.Pause();
+	for( int frameIndex = 0; frameIndex < 20; ++frameIndex )
+	{
+		parentClock.Update( frameSeconds );
+	}
+	VerifyTestResult( isRunningBeforePause && !childFired && grandchildFireCount == 2, "Timers under a paused clock should not fire" );
+	VerifyTestResult( childClock.GetTotalElapsedSeconds() == 0.25 && grandchildClock.GetTotalElapsedSeconds() == 0.25 && grandchildClock.GetLastDeltaSeconds() == 0.0, "A paused clock's subtree should not advance" );
+	VerifyTestResult( childClock.GetTimerSecondsRemaining( childTimer ) == 0.25 && parentClock.GetTotalElapsedSeconds() == 1.5, "The paused timer should keep its remaining time while the parent runs on" );
+
+	childClock.Resume();
+	for( int frameIndex = 0; frameIndex < 4; ++frameIndex )
+	{
+		parentClock.Update( frameSeconds );
+	}
+	VerifyTestResult( childFired && grandchildFireCount == 4, "Timers should pick up where they left off once the clock resumes" );
+
+	return 4;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+// Re-arming from the deadline rather than from the frame it was noticed on keeps a repeating timer
+//	on its period grid no matter how the frames fall
+//
+int TestSet_Timers_RepeatingDrift()
+{
+	Clock clock( nullptr );
+	double const periodSeconds = 1.0 / 60.0;
+	int fireCount = 0;
+	TimerHandle repeatingTimer = clock.ScheduleCallback( periodSeconds, CountTimerFire, &fireCount, true );
+
+	for( int frameIndex = 0; frameIndex < 3000; ++frameIndex )
+	{
+		clock.Update( 0.004 + 0.003 * static_cast<double>( frameIndex % 11 ) );
+	}
+
+	double totalSeconds = clock.GetTotalElapsedSeconds();
+	double secondsRemaining = clock.GetTimerSecondsRemaining( repeatingTimer );
+	int expectedFireCount = static_cast<int>( totalSeconds / periodSeconds );
+	double expectedDeadlineSeconds = static_cast<double>( fireCount + 1 ) * periodSeconds;
+
+	VerifyTestResult( fireCount == expectedFireCount, "A repeating timer should fire once per period elapsed, however uneven the frames" );
+	VerifyTestResult( fabs( totalSeconds + secondsRemaining - expectedDeadlineSeconds ) < 1e-9, "A repeating timer's next deadline should stay on its period grid" );
+	VerifyTestResult( secondsRemaining > 0.0 && secondsRemaining <= periodSeconds, "A repeating timer should always be less than a period away" );
+
+	return 3;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_Timers()
+{
+	RunTestSet( TestSet_Timers_CascadeBoundaries,		"Timers: level 1 and level 2 cascade boundaries" );
+	RunTestSet( TestSet_Timers_CancelDuringCallback,	"Timers: cancelling from inside a callback" );
+	RunTestSet( TestSet_Timers_PausedSubtree,			"Timers: paused clock subtrees" );
+	RunTestSet( TestSet_Timers_RepeatingDrift,			"Timers: repeating timers over uneven frames" );
+}
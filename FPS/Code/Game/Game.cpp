@@ -24,6 +24,8 @@
 #include "Engine/Math/RandomNumberGenerator.hpp"
 #include "Engine/Math/AABB3.hpp"
 #include "Engine/Math/OBB3.hpp"
+#include "Engine/Math/Sphere3.hpp"
+#include "Engine/Math/Frustum.hpp"
 #include "Engine/Math/Vec4.hpp"
 #include "Engine/Math/Transform.hpp"
 #include "Engine/Math/MatrixUtils.hpp"
@@ -31,6 +33,7 @@
 #include "Engine/Renderer/ShaderState.hpp"
 #include "Engine/Renderer/Material.hpp"
 #include <string>
+#include <math.h>
 
 
 RandomNumberGenerator*	g_RNG = nullptr;
@@ -412,24 +415,35 @@ void Game::RenderRingOfSpheres() const
 	g_theRenderer->BindShader( (Shader*)nullptr );
 /*	g_theRenderer->DrawMesh( m_uvSphere );*/
 
+	constexpr uint numberOfSpheres = 64;
 	float ringRadius = 50.f;
-	int numberOfSpheres = 64;
 	float degreeStep = 360.f / numberOfSpheres;
 
+	Mat44 sphereMat = m_sphereTransform->ToMatrix();
+	Vec3 sphereScale = m_sphereTransform->GetScale();
+	float sphereRadius = Maxf( fabsf( sphereScale.x ), Maxf( fabsf( sphereScale.y ), fabsf( sphereScale.z ) ) );
+
+	Sphere3 sphereBounds[ numberOfSpheres ];
 	float currentAngleDegrees = 0.f;
-	for( int sphereNum = 0; sphereNum < numberOfSpheres; ++sphereNum )
+	for( uint sphereNum = 0; sphereNum < numberOfSpheres; ++sphereNum )
 	{
 		Mat44 ringMat = m_ringTransform->ToMatrix();
 		ringMat.RotateZDegrees( currentAngleDegrees );
 
-		Mat44 sphereMat = m_sphereTransform->ToMatrix();
 		Vec3 worldPosition = ringMat.TransformPosition3D( Vec3( ringRadius, 0.f, 0.f ) );
-		sphereMat.SetTranslation3D( worldPosition );
+		sphereBounds[ sphereNum ] = Sphere3( worldPosition, sphereRadius );
+
+		currentAngleDegrees += degreeStep;
+	}
+
+	uint visibleSphereIndices[ numberOfSpheres ];
+	uint visibleCount = m_worldCamera->GetFrustum().CullSpheres( sphereBounds, numberOfSpheres, visibleSphereIndices );
+	for( uint visibleIndex = 0; visibleIndex < visibleCount; ++visibleIndex )
+	{
+		sphereMat.SetTranslation3D( sphereBounds[ visibleSphereIndices[ visibleIndex ] ].center );
 
 		g_theRenderer->SetModelUBO( sphereMat );
 		g_theRenderer->DrawMesh( m_uvSphere );
-
-		currentAngleDegrees += degreeStep;
 	}
 }
 
@@ -47,6 +47,8 @@ constexpr float RAYCAST_STEP_DISTANCE	= 1.f / RAYCAST_STEP_PER_UNIT;
 
 constexpr float TRIGGER_ACTIVATION_FRACTION	= 0.6f;
 
+constexpr unsigned int MAP_PATH_QUERIES_PER_FRAME	= 4;
+
 constexpr float SCREEN_SHAKE_ABBERATION				= 1.f / 2.f;
 constexpr float MAX_SCREEN_SHAKE_DISPLACEMENT		= 1.0f;
 constexpr float PLAYER_DEATH_SCREEN_SHAKE_INTENSITY = 1.f;
@@ -85,6 +87,7 @@ constexpr float NPC_TANK_SPEED						= 0.7f;
 constexpr float NPC_TANK_NEW_ORIENTATION_INTERVAL	= 3.f;
 constexpr int	NPC_TANK_HEALTH						= 2;
 constexpr float NPC_TANK_EXPLOSION_DURATION_SECONDS = 1.f;
+constexpr float NPC_TANK_WAYPOINT_RADIUS			= 0.25f;
 
 //---------------------------------------------------------------------------------------------------------
 // NPC Turret Constants
@@ -21,6 +21,7 @@
 Map::Map( Game* theGame, World* theWorld, IntVec2 mapDimensions )
 	: m_theGame( theGame )
 	, m_theWorld( theWorld )
+	, m_pathRequests( MAP_PATH_QUERIES_PER_FRAME )
 {
 	m_safeZoneSize = IntVec2( 5, 5 );
 	m_mapDimensions = mapDimensions;
@@ -186,93 +187,72 @@ void Map::CreateSafeZones( TileType startZoneType, TileType exitZoneType )
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+// One flow field pass from the start answers reachability for every tile at once
 //---------------------------------------------------------------------------------------------------------
 bool Map::HasPathToExit()
 {
-	m_tileData.clear();
-	for( int tileIndex = 0; tileIndex < m_mapDimensions.x * m_mapDimensions.y; ++tileIndex )
+	RebuildPassability();
+
+	FlowField flowFromStart;
+	flowFromStart.Build( m_passability, GetTileCoordsForWorldPos( m_startPosition ) );
+
+	m_tileData.resize( m_tiles.size() );
+	for( int tileIndex = 0; tileIndex < m_tileData.size(); ++tileIndex )
 	{
-		m_tileData.push_back( MapTileData() );
+		m_tileData[ tileIndex ].m_isAccessible = flowFromStart.IsReachable( GetTileCoordsForTileIndex( tileIndex ) );
 	}
 
-	int playerStartIndex = GetTileIndexForWorldPos( m_startPosition );
-	int floodFillStartIndex = m_mapDimensions.x + 1;
-	int floodFillStopIndex = (m_mapDimensions.x - 2) + ( m_mapDimensions.x * ( m_mapDimensions.y - 2 ) );
-	int exitTileIndex = GetTileIndexForWorldPos( m_exitPosition );
+	return flowFromStart.IsReachable( GetTileCoordsForWorldPos( m_exitPosition ) );
+}
 
-	m_tileData[ playerStartIndex ].m_isAccessible = true;
-	bool hasBeenUpdated = true;
 
-	while( hasBeenUpdated )
+//---------------------------------------------------------------------------------------------------------
+void Map::MakeInaccessibleTilesSolid( TileType tileType )
+{
+	for( int tileIndex = 0; tileIndex < m_tileData.size(); ++tileIndex )
 	{
-		hasBeenUpdated = false;
-		for( int tileIndex = floodFillStartIndex; tileIndex < floodFillStopIndex + 1; ++tileIndex )
+		if( !m_tileData[ tileIndex ].m_isAccessible )
 		{
-			MapTileData& currentTileData = m_tileData[ tileIndex ];
-			if( !currentTileData.m_hasBeenProcessed && currentTileData.m_isAccessible ) 
-			{
-				if( WasAdjacentTileSetAccessible( tileIndex ) )
-				{
-					hasBeenUpdated = true;
-				}
-				currentTileData.m_hasBeenProcessed = true;
-			}
+			m_tiles[ tileIndex ].m_tileType = tileType;
 		}
 	}
-	if( m_tileData[ exitTileIndex ].m_isAccessible )
-	{
-		return true;
-	}
-	return false;
+	RebuildPassability();
 }
 
 
 //---------------------------------------------------------------------------------------------------------
-bool Map::WasAdjacentTileSetAccessible( int tileIndex )
+void Map::RebuildPassability()
 {
-	int northTileIndex = tileIndex + m_mapDimensions.x;
-	int eastTileIndex = tileIndex + 1;
-	int southTileIndex = tileIndex - m_mapDimensions.x;
-	int westTileIndex = tileIndex - 1;
-
-	bool northWasSet = WasTileSetAccessible( northTileIndex );
-	bool eastWasSet = WasTileSetAccessible( eastTileIndex );
-	bool southWasSet = WasTileSetAccessible( southTileIndex );
-	bool westWasSet = WasTileSetAccessible( westTileIndex );
-
-	if( northWasSet	||
-		eastWasSet	||
-		southWasSet	||
-		westWasSet )
+	m_passability.Resize( m_mapDimensions, false );
+	for( int tileIndex = 0; tileIndex < m_tiles.size(); ++tileIndex )
 	{
-		return true;
+		if( !IsTileSolid( tileIndex ) )
+		{
+			m_passability.SetPassable( tileIndex, true );
+		}
 	}
-	return false;
 }
 
 
 //---------------------------------------------------------------------------------------------------------
-bool Map::WasTileSetAccessible( int tileIndex )
+uint Map::RequestPath( const Vec2& startPos, const Vec2& goalPos )
 {
-	if( !IsTileSolid( tileIndex ) )
-	{
-		m_tileData[ tileIndex ].m_isAccessible = true;
-		return true;
-	}
-	return false;
+	return m_pathRequests.RequestPath( GetTileCoordsForWorldPos( startPos ), GetTileCoordsForWorldPos( goalPos ) );
 }
 
 
 //---------------------------------------------------------------------------------------------------------
-void Map::MakeInaccessibleTilesSolid( TileType tileType )
+GridPathStatus Map::ClaimPath( uint requestID, std::vector<IntVec2>& out_tilePath )
 {
-	for( int tileIndex = 0; tileIndex < m_tileData.size(); ++tileIndex )
-	{
-		if( !m_tileData[ tileIndex ].m_isAccessible )
-		{
-			m_tiles[ tileIndex ].m_tileType = tileType;
-		}
-	}
+	return m_pathRequests.ClaimResult( requestID, out_tilePath );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void Map::CancelPathRequest( uint requestID )
+{
+	m_pathRequests.CancelRequest( requestID );
 }
 
 
@@ -316,6 +296,7 @@ void Map::RenderEntityType( EntityType type ) const
 //---------------------------------------------------------------------------------------------------------
 void Map::Update( float deltaSeconds )
 {
+	m_pathRequests.ProcessRequests( m_passability );
 	UpdateEntities( deltaSeconds );
 
 	CheckExitMap();
@@ -1,6 +1,7 @@
 #pragma once
 #include <vector>
 #include "Engine/Math/IntVec2.hpp"
+#include "Engine/Math/GridPathRequestQueue.hpp"
 #include "Game/Tile.hpp"
 #include "Engine/Core/Vertex_PCU.hpp"
 #include "Game/Entity.hpp"
@@ -74,9 +75,15 @@ public:
 	void			SetPlayerStartTile( TileType startType = TILE_TYPE_GRASS );
 	void			CreateSafeZones( TileType startZoneType = TILE_TYPE_GRASS, TileType exitZoneType = TILE_TYPE_GRASS );
 	bool			HasPathToExit();
-	bool			WasAdjacentTileSetAccessible( int tileIndex );
-	bool			WasTileSetAccessible( int tileIndex );
 	void			MakeInaccessibleTilesSolid( TileType tileType );
+	void			RebuildPassability();
+
+	//---------------------------------------------------------------------------------------------------------
+	// Pathfinding; requests are answered a few per frame in Update, so claim until it stops saying pending
+	//
+	uint			RequestPath( const Vec2& startPos, const Vec2& goalPos );
+	GridPathStatus	ClaimPath( uint requestID, std::vector<IntVec2>& out_tilePath );
+	void			CancelPathRequest( uint requestID );
 
 	//---------------------------------------------------------------------------------------------------------
 	bool			HasLineOfSight( const Vec2& startPos, const Vec2& endPos );
@@ -116,6 +123,8 @@ private:
 	std::vector< Tile >			m_tiles;
 	std::vector< Vertex_PCU >	m_mapTilesVerts;
 	std::vector< MapTileData >	m_tileData;
+	PassabilityGrid				m_passability;
+	GridPathRequestQueue		m_pathRequests;
 	EntityList	m_entityLists[ NUM_ENTITY_TYPES ];
 
 
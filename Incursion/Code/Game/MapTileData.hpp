@@ -5,7 +5,6 @@ struct MapTileData
 {
 public:
 	bool m_isAccessible = false;
-	bool m_hasBeenProcessed = false;
 
 public:
 	~MapTileData() {};
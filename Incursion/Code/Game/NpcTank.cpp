@@ -50,6 +50,7 @@ void NpcTank::Die()
 	g_theAudio->PlaySound( enemyDeathSound );
 
 	m_map->SpawnExplosion( m_position, m_cosmeticRadius, NPC_TANK_EXPLOSION_DURATION_SECONDS );
+	m_map->CancelPathRequest( m_pathRequestID );
 
 	Entity::Die();
 }
@@ -166,8 +167,8 @@ void NpcTank::TurnTowardsEntityIfWithinRange( Entity* entityToTurnTowards, float
 	}
 	else if( m_enemyLastKnownLocation != Vec2( -1.f, -1.f ) )
 	{
-		Vec2 displacementToEnemyLastKnownLocation = m_enemyLastKnownLocation - m_position;
-		m_goalOrientationDegrees = displacementToEnemyLastKnownLocation.GetAngleDegrees();
+		Vec2 displacementToNextPoint = GetNextPointTowardLastKnownLocation() - m_position;
+		m_goalOrientationDegrees = displacementToNextPoint.GetAngleDegrees();
 	}
 	else if( m_newOrientationCooldown <= 0.f  )
 	{
@@ -178,6 +179,44 @@ void NpcTank::TurnTowardsEntityIfWithinRange( Entity* entityToTurnTowards, float
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+// Drives straight at the last known location until the map answers the path request, and again once the
+// path has run out or none was found
+//---------------------------------------------------------------------------------------------------------
+Vec2 NpcTank::GetNextPointTowardLastKnownLocation()
+{
+	if( m_pathGoal != m_enemyLastKnownLocation )
+	{
+		m_map->CancelPathRequest( m_pathRequestID );
+		m_path.clear();
+		m_pathIndex = 0;
+		m_pathGoal = m_enemyLastKnownLocation;
+		m_pathRequestID = m_map->RequestPath( m_position, m_pathGoal );
+	}
+
+	if( m_pathRequestID != GridPathRequestQueue::INVALID_REQUEST_ID )
+	{
+		GridPathStatus pathStatus = m_map->ClaimPath( m_pathRequestID, m_path );
+		if( pathStatus != GRID_PATH_STATUS_PENDING )
+		{
+			m_pathRequestID = GridPathRequestQueue::INVALID_REQUEST_ID;
+			m_pathIndex = 1;	// the first tile is the one we started on
+		}
+	}
+
+	Vec2 const tileCenterOffset( TILE_SIZE * 0.5f, TILE_SIZE * 0.5f );
+	while( m_pathIndex < m_path.size() )
+	{
+		Vec2 waypoint = m_map->GetWorldPosForTileCoords( m_path[ m_pathIndex ] ) + tileCenterOffset;
+		if( !DoDiscsOverlap( m_position, NPC_TANK_WAYPOINT_RADIUS, waypoint, 0.f ) )
+			return waypoint;
+
+		++m_pathIndex;
+	}
+	return m_enemyLastKnownLocation;
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 bool NpcTank::IsEntityVisible( Entity* entity )
 {
@@ -1,6 +1,8 @@
 #pragma once
 #include "Game/Entity.hpp"
 #include "Game/RaycastResult.hpp"
+#include "Engine/Math/IntVec2.hpp"
+#include <vector>
 
 class Map;
 
@@ -20,6 +22,7 @@ public:
 	void TurnTowardsEntityIfWithinRange( Entity* entityToTurnTowards, float deltaSeconds );
 	void ShootAtEntity( Entity* entityToShootAt, float deltaSeconds );
 	void SetThrustFraction( Entity* entityToMoveTowards );
+	Vec2 GetNextPointTowardLastKnownLocation();
 	
 	bool IsEntityVisible( Entity* entity );
 	bool IsEntityInShootingAperature( Entity* entityToShootAt );
@@ -37,6 +40,12 @@ private:
 	Vec2 m_fwdDir;
 	Vec2 m_enemyLastKnownLocation = Vec2( -1.f, -1.f );
 
+	// Tile path to m_pathGoal, requested from the map when the enemy drops out of sight
+	std::vector<IntVec2> m_path;
+	uint m_pathIndex		= 0;
+	uint m_pathRequestID	= 0;
+	Vec2 m_pathGoal			= Vec2( -1.f, -1.f );
+
 	Vec2 m_goalCenterRaycastStart;
 	Vec2 m_goalLeftRaycastStart;
 	Vec2 m_goalRightRaycastStart;
@@ -10,6 +10,7 @@
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Renderer/RenderContext.hpp"
 #include <vector>
+#include <math.h>
 
 //---------------------------------------------------------------------------------------------------------
 EnvironmentObject::EnvironmentObject( EnvironmentObjectType type, Vec3 const& position, Vec3 const& dimensions, float orientationDegrees, Rgba8 const& tint )
@@ -20,6 +21,7 @@ EnvironmentObject::EnvironmentObject( EnvironmentObjectType type, Vec3 const& po
 	m_tint = tint;
 	CreateMesh( dimensions );
 	Set2DBounds( dimensions, orientationDegrees );
+	SetWorldBounds( dimensions, orientationDegrees );
 }
 
 
@@ -136,3 +138,35 @@ void EnvironmentObject::Set2DBounds( Vec3 const& dimensions, float orientationDe
 		break;
 	}
 }
+
+
+//---------------------------------------------------------------------------------------------------------
+// Axis aligned box around the object in world space, for culling. Objects only ever rotate about y.
+//---------------------------------------------------------------------------------------------------------
+void EnvironmentObject::SetWorldBounds( Vec3 const& dimensions, float orientationDegrees )
+{
+	Vec3 position = GetPosition3D();
+	Vec3 halfDimensions = dimensions * 0.5f;
+	switch( m_type )
+	{
+	case ENVIROMENT_OBJECT_AABB:
+		break;
+	case ENVIROMENT_OBJECT_OBB:
+	{
+		float absCos = fabsf( CosDegrees( orientationDegrees ) );
+		float absSin = fabsf( SinDegrees( orientationDegrees ) );
+		float halfX = ( absCos * halfDimensions.x ) + ( absSin * halfDimensions.z );
+		float halfZ = ( absSin * halfDimensions.x ) + ( absCos * halfDimensions.z );
+		halfDimensions = Vec3( halfX, halfDimensions.y, halfZ );
+		break;
+	}
+	case ENVIROMENT_OBJECT_SPHERE:
+		halfDimensions = Vec3( m_asDiscRadius, m_asDiscRadius, m_asDiscRadius );
+		break;
+	default:
+		ERROR_AND_DIE( "Invalid Environment Object Type in Set World Bounds" );
+		break;
+	}
+
+	m_worldBounds = AABB3( position - halfDimensions, position + halfDimensions );
+}
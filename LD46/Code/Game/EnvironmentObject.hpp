@@ -3,6 +3,7 @@
 #include "Engine/Math/Vec3.hpp"
 #include "Engine/Math/OBB2.hpp"
 #include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/AABB3.hpp"
 
 enum EnvironmentObjectType
 {
@@ -21,14 +22,17 @@ public:
 	virtual void Render() const override;
 
 	Vec3 PushDiscOut( Vec2 const& discPosition, float discRadius );
+	AABB3 GetWorldBounds() const		{ return m_worldBounds; }
 
 private:
 	void CreateMesh( Vec3 const& dimensions );
 	void Set2DBounds( Vec3 const& dimensions, float orientationDegrees );
+	void SetWorldBounds( Vec3 const& dimensions, float orientationDegrees );
 
 private:
 	EnvironmentObjectType m_type;
 	OBB2 m_asOBB2;
 	AABB2 m_asAABB2;
 	float m_asDiscRadius = 0.f;
+	AABB3 m_worldBounds;
 };
\ No newline at end of file
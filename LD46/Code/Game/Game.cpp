@@ -189,6 +189,24 @@ void Game::CreateWorldObjects()
 	m_lamps[4] = new Lamp( Vec3( 14.f, 0.f, -9.f ) );
 
 	m_endZone = AABB2( -2.f, -47.f, 0.f, -49.f );
+
+	BuildEnvironmentTree();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void Game::BuildEnvironmentTree()
+{
+	std::vector<AABB3> enviromentBounds;
+	enviromentBounds.reserve( m_enviromentObjects.size() );
+	for( int enviromentObjectIndex = 0; enviromentObjectIndex < m_enviromentObjects.size(); ++enviromentObjectIndex )
+	{
+		enviromentBounds.push_back( m_enviromentObjects[enviromentObjectIndex]->GetWorldBounds() );
+	}
+
+	uint enviromentCount = static_cast<uint>( enviromentBounds.size() );
+	m_enviromentTree.Build( enviromentBounds.data(), enviromentCount );
+	m_visibleEnviromentIndices.resize( enviromentCount );
 }
 
 
@@ -209,6 +227,8 @@ void Game::DeleteEnvironmentObjects()
 		delete m_enviromentObjects[environmentObjectIndex];
 		m_enviromentObjects[environmentObjectIndex] = nullptr;
 	}
+	m_enviromentObjects.clear();
+	m_enviromentTree.Clear();
 }
 
 
@@ -276,9 +296,10 @@ void Game::RenderWorld() const
 
 	RenderTiledFloor();
 
-	for( int enviromentObjectIndex = 0; enviromentObjectIndex < m_enviromentObjects.size(); ++enviromentObjectIndex )
+	uint visibleCount = m_enviromentTree.CullVisible( m_worldCamera->GetFrustum(), m_visibleEnviromentIndices.data() );
+	for( uint visibleIndex = 0; visibleIndex < visibleCount; ++visibleIndex )
 	{
-		EnvironmentObject* currentEnviromentObject = m_enviromentObjects[enviromentObjectIndex];
+		EnvironmentObject* currentEnviromentObject = m_enviromentObjects[ m_visibleEnviromentIndices[visibleIndex] ];
 		currentEnviromentObject->Render();
 	}
 }
@@ -7,6 +7,7 @@
 #include "Engine/Math/Vec3.hpp"
 #include "Engine/Math/Transform.hpp"
 #include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/StaticBoundsTree.hpp"
 #include <vector>
 
 class Entity;
@@ -83,6 +84,7 @@ public:
 
 	//Shut Down
 	void DeleteEnvironmentObjects();
+	void BuildEnvironmentTree();
 
 	//Input
 	void UpdateFromInput( float deltaSeconds );
@@ -162,6 +164,8 @@ private:
 	GameState m_gameState = GAME_STATE_PLAY;
 	PlayerObject* m_player;
 	std::vector<EnvironmentObject*> m_enviromentObjects;
+	StaticBoundsTree m_enviromentTree;
+	mutable std::vector<uint> m_visibleEnviromentIndices;
 	std::vector<EnemyObject*> m_enemyObjects;
 	Lamp* m_lamps[5];
 };
@@ -206,4 +206,5 @@ void App::EndFrame()
 	g_theAudio->EndFrame();
 
 	DebugRenderEndFrame();
+	Clock::EndFrame();
 }
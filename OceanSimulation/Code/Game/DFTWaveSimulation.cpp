@@ -51,6 +51,7 @@ void DFTWaveSimulation::Simulate()
 		m_hTilde[positionIndex] = wavePoint.m_height;
 		m_surfaceVerts[positionIndex].m_position = initialPosition + translation;
 	}
+	MarkSurfaceChanged();
 	m_surfaceMesh->UpdateVerticies( static_cast<uint>( m_surfaceVerts.size() ), &m_surfaceVerts[0] );
 }
 
@@ -0,0 +1,424 @@
+#include "Game/FFT2D.hpp"
+#include "Engine/Core/JobSystem.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <cmath>
+#include <cstring>
+
+#if defined( _M_X64 ) || defined( _M_IX86 ) || defined( __SSE2__ )
+	#define FFT2D_USE_SSE
+	#include <xmmintrin.h>
+#endif
+
+
+//---------------------------------------------------------------------------------------------------------
+// Runs every jobCount'th work item of a pass starting at jobIndex so block rows of uneven cost interleave.
+// Fire-and-forget: RunPass waits on the counter, and nobody else's claim should see these.
+//---------------------------------------------------------------------------------------------------------
+class FFT2DPassJob : public Job
+{
+public:
+	FFT2DPassJob( FFT2D* fft, FFT2DPass pass, uint jobIndex, uint jobCount, uint workItemCount, std::atomic<uint>* jobsRemaining )
+		: Job( JOB_CATEGORY_SIMULATION )
+		, m_fft( fft )
+		, m_pass( pass )
+		, m_jobIndex( jobIndex )
+		, m_jobCount( jobCount )
+		, m_workItemCount( workItemCount )
+		, m_jobsRemaining( jobsRemaining )
+	{
+		m_isFireAndForget = true;
+	}
+
+	virtual void Execute() override
+	{
+		for( uint workItemIndex = m_jobIndex; workItemIndex < m_workItemCount; workItemIndex += m_jobCount )
+		{
+			m_fft->RunPassWorkItem( m_pass, workItemIndex );
+		}
+		m_jobsRemaining->fetch_sub( 1 );
+	}
+
+	virtual void OnCompleteCallback() override {}
+
+private:
+	FFT2D*				m_fft				= nullptr;
+	FFT2DPass			m_pass				= FFT2D_PASS_COLUMNS;
+	uint				m_jobIndex			= 0;
+	uint				m_jobCount			= 1;
+	uint				m_workItemCount		= 0;
+	std::atomic<uint>*	m_jobsRemaining		= nullptr;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// Radix-2 butterfly between two row segments with a unit twiddle (first stage when log2N is odd)
+//---------------------------------------------------------------------------------------------------------
+static void Radix2Rows( float* aRe, float* aIm, float* bRe, float* bIm, uint width )
+{
+	uint column = 0;
+#if defined( FFT2D_USE_SSE )
+	for( ; column + 4 <= width; column += 4 )
+	{
+		__m128 ar = _mm_loadu_ps( aRe + column );
+		__m128 ai = _mm_loadu_ps( aIm + column );
+		__m128 br = _mm_loadu_ps( bRe + column );
+		__m128 bi = _mm_loadu_ps( bIm + column );
+
+		_mm_storeu_ps( aRe + column, _mm_add_ps( ar, br ) );
+		_mm_storeu_ps( aIm + column, _mm_add_ps( ai, bi ) );
+		_mm_storeu_ps( bRe + column, _mm_sub_ps( ar, br ) );
+		_mm_storeu_ps( bIm + column, _mm_sub_ps( ai, bi ) );
+	}
+#endif
+	for( ; column < width; ++column )
+	{
+		float ar = aRe[column];
+		float ai = aIm[column];
+		float br = bRe[column];
+		float bi = bIm[column];
+
+		aRe[column] = ar + br;
+		aIm[column] = ai + bi;
+		bRe[column] = ar - br;
+		bIm[column] = ai - bi;
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Two radix-2 stages fused into one radix-4 butterfly. Rows a,b,c,d are k, k+h, k+2h and k+3h of a 4h group,
+// w1 = W(2h)^k for the first stage and w2 = W(4h)^k for the second, whose odd half picks up a factor of i.
+//---------------------------------------------------------------------------------------------------------
+static void Radix4Rows( float* aRe, float* aIm, float* bRe, float* bIm, float* cRe, float* cIm, float* dRe, float* dIm,
+						float w1r, float w1i, float w2r, float w2i, uint width )
+{
+	uint column = 0;
+#if defined( FFT2D_USE_SSE )
+	__m128 const vW1r = _mm_set1_ps( w1r );
+	__m128 const vW1i = _mm_set1_ps( w1i );
+	__m128 const vW2r = _mm_set1_ps( w2r );
+	__m128 const vW2i = _mm_set1_ps( w2i );
+
+	for( ; column + 4 <= width; column += 4 )
+	{
+		__m128 ar = _mm_loadu_ps( aRe + column );
+		__m128 ai = _mm_loadu_ps( aIm + column );
+		__m128 br = _mm_loadu_ps( bRe + column );
+		__m128 bi = _mm_loadu_ps( bIm + column );
+		__m128 cr = _mm_loadu_ps( cRe + column );
+		__m128 ci = _mm_loadu_ps( cIm + column );
+		__m128 dr = _mm_loadu_ps( dRe + column );
+		__m128 di = _mm_loadu_ps( dIm + column );
+
+		// first stage: (a,b) and (c,d) with w1
+		__m128 tbr = _mm_sub_ps( _mm_mul_ps( br, vW1r ), _mm_mul_ps( bi, vW1i ) );
+		__m128 tbi = _mm_add_ps( _mm_mul_ps( br, vW1i ), _mm_mul_ps( bi, vW1r ) );
+		__m128 tdr = _mm_sub_ps( _mm_mul_ps( dr, vW1r ), _mm_mul_ps( di, vW1i ) );
+		__m128 tdi = _mm_add_ps( _mm_mul_ps( dr, vW1i ), _mm_mul_ps( di, vW1r ) );
+
+		__m128 a1r = _mm_add_ps( ar, tbr );
+		__m128 a1i = _mm_add_ps( ai, tbi );
+		__m128 b1r = _mm_sub_ps( ar, tbr );
+		__m128 b1i = _mm_sub_ps( ai, tbi );
+		__m128 c1r = _mm_add_ps( cr, tdr );
+		__m128 c1i = _mm_add_ps( ci, tdi );
+		__m128 d1r = _mm_sub_ps( cr, tdr );
+		__m128 d1i = _mm_sub_ps( ci, tdi );
+
+		// second stage: (a,c) with w2 and (b,d) with i*w2
+		__m128 ur = _mm_sub_ps( _mm_mul_ps( c1r, vW2r ), _mm_mul_ps( c1i, vW2i ) );
+		__m128 ui = _mm_add_ps( _mm_mul_ps( c1r, vW2i ), _mm_mul_ps( c1i, vW2r ) );
+		__m128 vr = _mm_sub_ps( _mm_setzero_ps(), _mm_add_ps( _mm_mul_ps( d1r, vW2i ), _mm_mul_ps( d1i, vW2r ) ) );
+		__m128 vi = _mm_sub_ps( _mm_mul_ps( d1r, vW2r ), _mm_mul_ps( d1i, vW2i ) );
+
+		_mm_storeu_ps( aRe + column, _mm_add_ps( a1r, ur ) );
+		_mm_storeu_ps( aIm + column, _mm_add_ps( a1i, ui ) );
+		_mm_storeu_ps( cRe + column, _mm_sub_ps( a1r, ur ) );
+		_mm_storeu_ps( cIm + column, _mm_sub_ps( a1i, ui ) );
+		_mm_storeu_ps( bRe + column, _mm_add_ps( b1r, vr ) );
+		_mm_storeu_ps( bIm + column, _mm_add_ps( b1i, vi ) );
+		_mm_storeu_ps( dRe + column, _mm_sub_ps( b1r, vr ) );
+		_mm_storeu_ps( dIm + column, _mm_sub_ps( b1i, vi ) );
+	}
+#endif
+	for( ; column < width; ++column )
+	{
+		float ar = aRe[column];
+		float ai = aIm[column];
+		float br = bRe[column];
+		float bi = bIm[column];
+		float cr = cRe[column];
+		float ci = cIm[column];
+		float dr = dRe[column];
+		float di = dIm[column];
+
+		float tbr = ( br * w1r ) - ( bi * w1i );
+		float tbi = ( br * w1i ) + ( bi * w1r );
+		float tdr = ( dr * w1r ) - ( di * w1i );
+		float tdi = ( dr * w1i ) + ( di * w1r );
+
+		float a1r = ar + tbr;
+		float a1i = ai + tbi;
+		float b1r = ar - tbr;
+		float b1i = ai - tbi;
+		float c1r = cr + tdr;
+		float c1i = ci + tdi;
+		float d1r = cr - tdr;
+		float d1i = ci - tdi;
+
+		float ur = ( c1r * w2r ) - ( c1i * w2i );
+		float ui = ( c1r * w2i ) + ( c1i * w2r );
+		float vr = -( ( d1r * w2i ) + ( d1i * w2r ) );
+		float vi = ( d1r * w2r ) - ( d1i * w2i );
+
+		aRe[column] = a1r + ur;
+		aIm[column] = a1i + ui;
+		cRe[column] = a1r - ur;
+		cIm[column] = a1i - ui;
+		bRe[column] = b1r + vr;
+		bIm[column] = b1i + vi;
+		dRe[column] = b1r - vr;
+		dIm[column] = b1i - vi;
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+FFT2D::FFT2D( uint numSamples, uint numPlanes )
+	: m_numSamples( numSamples )
+	, m_numPlanes( numPlanes )
+{
+	GUARANTEE_OR_DIE( numSamples > 0 && ( numSamples & ( numSamples - 1 ) ) == 0, "FFT2D size needs to be a power of 2" );
+
+	while( ( 1u << m_log2N ) < m_numSamples )
+	{
+		++m_log2N;
+	}
+
+	size_t planeSize = static_cast<size_t>( m_numSamples ) * m_numSamples;
+	m_planeData.resize( planeSize * 2 * m_numPlanes, 0.f );
+
+	m_bitReversedIndices.resize( m_numSamples );
+	for( uint index = 0; index < m_numSamples; ++index )
+	{
+		uint reversed = 0;
+		for( uint bit = 0; bit < m_log2N; ++bit )
+		{
+			reversed |= ( ( index >> bit ) & 1 ) << ( m_log2N - 1 - bit );
+		}
+		m_bitReversedIndices[index] = reversed;
+	}
+
+	// W(N)^t = e^(i * 2pi * t / N); stage m reads W(m)^k as W(N)^(k * N / m)
+	m_twiddleReal.resize( m_numSamples );
+	m_twiddleImag.resize( m_numSamples );
+	for( uint twiddleIndex = 0; twiddleIndex < m_numSamples; ++twiddleIndex )
+	{
+		double angle = ( 2.0 * static_cast<double>( PI_VALUE ) * twiddleIndex ) / m_numSamples;
+		m_twiddleReal[twiddleIndex] = static_cast<float>( cos( angle ) );
+		m_twiddleImag[twiddleIndex] = static_cast<float>( sin( angle ) );
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+FFT2D::~FFT2D()
+{
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+fft_plane_t FFT2D::GetPlane( uint planeIndex )
+{
+	size_t planeSize = static_cast<size_t>( m_numSamples ) * m_numSamples;
+
+	fft_plane_t plane;
+	plane.real = &m_planeData[ planeIndex * planeSize * 2 ];
+	plane.imag = plane.real + planeSize;
+	return plane;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void FFT2D::Transform( bool isMultithreaded )
+{
+	RunPass( FFT2D_PASS_COLUMNS, isMultithreaded );
+	RunPass( FFT2D_PASS_TRANSPOSE, isMultithreaded );
+	RunPass( FFT2D_PASS_COLUMNS, isMultithreaded );
+	RunPass( FFT2D_PASS_TRANSPOSE, isMultithreaded );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+uint FFT2D::GetWorkItemCount( FFT2DPass pass ) const
+{
+	uint blockSize = ( pass == FFT2D_PASS_COLUMNS ) ? COLUMN_BAND_WIDTH : TRANSPOSE_BLOCK_SIZE;
+	uint blocksPerPlane = ( m_numSamples + blockSize - 1 ) / blockSize;
+	return blocksPerPlane * m_numPlanes;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void FFT2D::RunPass( FFT2DPass pass, bool isMultithreaded )
+{
+	uint workItemCount = GetWorkItemCount( pass );
+
+	uint jobCount = 1;
+	if( isMultithreaded && g_theJobSystem != nullptr )
+	{
+		jobCount = static_cast<uint>( g_theJobSystem->GetWorkerThreadCount() ) + 1;
+		jobCount = Min( jobCount, workItemCount );
+	}
+
+	// The calling thread always takes the first share
+	std::atomic<uint> jobsRemaining( jobCount - 1 );
+	for( uint jobIndex = 1; jobIndex < jobCount; ++jobIndex )
+	{
+		g_theJobSystem->PostJob( new FFT2DPassJob( this, pass, jobIndex, jobCount, workItemCount, &jobsRemaining ) );
+	}
+
+	for( uint workItemIndex = 0; workItemIndex < workItemCount; workItemIndex += jobCount )
+	{
+		RunPassWorkItem( pass, workItemIndex );
+	}
+
+	if( jobCount > 1 )
+	{
+		while( jobsRemaining.load() > 0 )
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void FFT2D::RunPassWorkItem( FFT2DPass pass, uint workItemIndex )
+{
+	uint blockSize = ( pass == FFT2D_PASS_COLUMNS ) ? COLUMN_BAND_WIDTH : TRANSPOSE_BLOCK_SIZE;
+	uint blocksPerPlane = ( m_numSamples + blockSize - 1 ) / blockSize;
+	uint planeIndex = workItemIndex / blocksPerPlane;
+	uint blockIndex = workItemIndex - ( planeIndex * blocksPerPlane );
+
+	fft_plane_t plane = GetPlane( planeIndex );
+	switch( pass )
+	{
+	case FFT2D_PASS_COLUMNS:
+	{
+		uint columnStart = blockIndex * COLUMN_BAND_WIDTH;
+		uint columnEnd = Min( columnStart + COLUMN_BAND_WIDTH, m_numSamples );
+		TransformColumns( plane, columnStart, columnEnd );
+		break;
+	}
+	case FFT2D_PASS_TRANSPOSE:
+	{
+		TransposeBlockRow( plane, blockIndex );
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void FFT2D::TransformColumns( fft_plane_t const& plane, uint columnStart, uint columnEnd ) const
+{
+	uint const N = m_numSamples;
+	uint const width = columnEnd - columnStart;
+	float* real = plane.real + columnStart;
+	float* imag = plane.imag + columnStart;
+
+	for( uint row = 0; row < N; ++row )
+	{
+		uint swapRow = m_bitReversedIndices[row];
+		if( swapRow > row )
+		{
+			std::swap_ranges( real + ( row * N ), real + ( row * N ) + width, real + ( swapRow * N ) );
+			std::swap_ranges( imag + ( row * N ), imag + ( row * N ) + width, imag + ( swapRow * N ) );
+		}
+	}
+
+	uint halfSize = 1;
+	if( ( m_log2N & 1 ) != 0 )
+	{
+		for( uint row = 0; row < N; row += 2 )
+		{
+			Radix2Rows( real + ( row * N ), imag + ( row * N ), real + ( ( row + 1 ) * N ), imag + ( ( row + 1 ) * N ), width );
+		}
+		halfSize = 2;
+	}
+
+	for( ; halfSize < N; halfSize *= 4 )
+	{
+		uint groupSize = halfSize * 4;
+		uint firstStageStride = N / ( halfSize * 2 );
+		uint secondStageStride = N / groupSize;
+
+		for( uint groupStart = 0; groupStart < N; groupStart += groupSize )
+		{
+			for( uint k = 0; k < halfSize; ++k )
+			{
+				uint rowA = groupStart + k;
+				uint rowB = rowA + halfSize;
+				uint rowC = rowB + halfSize;
+				uint rowD = rowC + halfSize;
+
+				Radix4Rows( real + ( rowA * N ), imag + ( rowA * N ),
+							real + ( rowB * N ), imag + ( rowB * N ),
+							real + ( rowC * N ), imag + ( rowC * N ),
+							real + ( rowD * N ), imag + ( rowD * N ),
+							m_twiddleReal[ k * firstStageStride ], m_twiddleImag[ k * firstStageStride ],
+							m_twiddleReal[ k * secondStageStride ], m_twiddleImag[ k * secondStageStride ],
+							width );
+			}
+		}
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Swaps block (blockRow, j) with block (j, blockRow) for every j right of the diagonal so each block row can
+// be transposed in place independently of the others. Blocks are staged through the stack so the power of two
+// row stride is only ever walked one contiguous block row at a time.
+//---------------------------------------------------------------------------------------------------------
+void FFT2D::TransposeBlockRow( fft_plane_t const& plane, uint blockRow ) const
+{
+	uint const N = m_numSamples;
+	uint const blockSize = Min( TRANSPOSE_BLOCK_SIZE, N );
+	uint const blockCount = N / blockSize;
+
+	float upperBlock[ TRANSPOSE_BLOCK_SIZE * TRANSPOSE_BLOCK_SIZE ];
+	float lowerBlock[ TRANSPOSE_BLOCK_SIZE * TRANSPOSE_BLOCK_SIZE ];
+	size_t const blockRowBytes = blockSize * sizeof( float );
+
+	float* components[2] = { plane.real, plane.imag };
+	for( float* data : components )
+	{
+		for( uint blockColumn = blockRow; blockColumn < blockCount; ++blockColumn )
+		{
+			float* upper = data + ( blockRow * blockSize * N ) + ( blockColumn * blockSize );
+			float* lower = data + ( blockColumn * blockSize * N ) + ( blockRow * blockSize );
+
+			for( uint row = 0; row < blockSize; ++row )
+			{
+				memcpy( &upperBlock[ row * blockSize ], upper + ( row * N ), blockRowBytes );
+				memcpy( &lowerBlock[ row * blockSize ], lower + ( row * N ), blockRowBytes );
+			}
+
+			for( uint row = 0; row < blockSize; ++row )
+			{
+				float* upperRow = upper + ( row * N );
+				float* lowerRow = lower + ( row * N );
+				for( uint column = 0; column < blockSize; ++column )
+				{
+					upperRow[column] = lowerBlock[ ( column * blockSize ) + row ];
+					lowerRow[column] = upperBlock[ ( column * blockSize ) + row ];
+				}
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#pragma once
+#include "Engine/Core/EngineCommon.hpp"
+#include <vector>
+
+
+//---------------------------------------------------------------------------------------------------------
+// One N x N complex plane, row major, with the real and imaginary parts stored in separate arrays
+//---------------------------------------------------------------------------------------------------------
+struct fft_plane_t
+{
+	float* real = nullptr;
+	float* imag = nullptr;
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+enum FFT2DPass
+{
+	FFT2D_PASS_COLUMNS,
+	FFT2D_PASS_TRANSPOSE,
+};
+
+
+//---------------------------------------------------------------------------------------------------------
+// In place, unnormalized 2D FFT over any number of structure-of-arrays planes. Uses the same e^(+i) sign
+// convention as FFTWaveSimulation::CalculateFFT so the two paths are interchangeable.
+//
+// Each 1D pass runs down the columns of the planes so a butterfly works on whole row segments and the SSE
+// lanes cover four neighbouring columns with a single broadcast twiddle. Rows are done by a blocked transpose,
+// a column pass and a transpose back. Column bands and transpose block rows are split across the job system.
+//---------------------------------------------------------------------------------------------------------
+class FFT2D
+{
+public:
+	static constexpr uint COLUMN_BAND_WIDTH		= 64;
+	static constexpr uint TRANSPOSE_BLOCK_SIZE	= 16;
+
+	explicit FFT2D( uint numSamples, uint numPlanes = 1 );
+	~FFT2D();
+
+	uint		GetNumSamples() const		{ return m_numSamples; }
+	uint		GetNumPlanes() const		{ return m_numPlanes; }
+	fft_plane_t	GetPlane( uint planeIndex );
+
+	void Transform( bool isMultithreaded = true );
+	void RunPassWorkItem( FFT2DPass pass, uint workItemIndex );
+
+private:
+	void RunPass( FFT2DPass pass, bool isMultithreaded );
+	uint GetWorkItemCount( FFT2DPass pass ) const;
+
+	void TransformColumns( fft_plane_t const& plane, uint columnStart, uint columnEnd ) const;
+	void TransposeBlockRow( fft_plane_t const& plane, uint blockRow ) const;
+
+private:
+	uint				m_numSamples	= 0;
+	uint				m_numPlanes		= 0;
+	uint				m_log2N			= 0;
+
+	std::vector<float>	m_planeData;
+	std::vector<uint>	m_bitReversedIndices;
+	std::vector<float>	m_twiddleReal;
+	std::vector<float>	m_twiddleImag;
+};
\ No newline at end of file
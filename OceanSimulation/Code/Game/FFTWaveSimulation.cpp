@@ -7,6 +7,9 @@
 #include "Engine/Renderer/MeshUtils.hpp"
 #include "Engine/Input/InputSystem.hpp"
 #include "Engine/Core/JobSystem.hpp"
+#include "Engine/Core/Time.hpp"
+#include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/Profiler.hpp"
 #include "Game/WaveSurfaceVertex.hpp"
 #include "Game/DFTWaveSimulation.hpp"
 #include "Game/FFTWaveSimulation.hpp"
@@ -14,6 +17,7 @@
 #include "Game/GameCommon.hpp"
 #include "Game/Game.hpp"
 #include "Game/FFTJob.hpp"
+#include "Game/FFT2D.hpp"
 
 
 //---------------------------------------------------------------------------------------------------------
@@ -26,7 +30,7 @@ FFTWaveSimulation::FFTWaveSimulation( Vec2 const& dimensions, uint samples, floa
 
 
 //---------------------------------------------------------------------------------------------------------
-FFTWaveSimulation::FFTWaveSimulation( XmlElement const& element )
+FFTWaveSimulation::FFTWaveSimulation( BakedXmlElement const& element )
 	: WaveSimulation( element )
 {
 	InitializeValues();
@@ -49,53 +53,36 @@ FFTWaveSimulation::FFTWaveSimulation( Vec2 const& dimensions, uint samples, floa
 //---------------------------------------------------------------------------------------------------------
 FFTWaveSimulation::~FFTWaveSimulation()
 {
+	delete m_fft;
+	m_fft = nullptr;
+
+	delete m_iWave;
+	m_iWave = nullptr;
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 void FFTWaveSimulation::Simulate()
 {
-	//m_simulateTimer.StartTimer();
+	PROFILE_SCOPE( "Ocean Simulate" );
 	float elapsedTime = static_cast<float>( m_simulationClock->GetTotalElapsedSeconds() );
 	float deltaSeconds = static_cast<float>( m_simulationClock->GetLastDeltaSeconds() );
 
-	//m_pointCalculationTimer.StartTimer();
-	for( int positionIndex = 0; positionIndex < m_waveSurfaceVerts.size(); ++positionIndex )
 	{
-// 		int m = positionIndex / m_numSamples;
-// 		int n = positionIndex - ( m * m_numSamples );
-// 
-// 		GetHeightAtPosition( n, m, elapsedTime );
-		m_waveSurfaceVerts[positionIndex].CalculateValuesAtTime( elapsedTime );
+		PROFILE_SCOPE( "Ocean Spectrum" );
+		CalculateSpectrumAtTime( elapsedTime );
 	}
-	//m_pointCalculationTimer.StopTimer();
-
-	//m_fftTimer.StartTimer();
-	for( uint mIndex = 0; mIndex < m_numSamples; ++mIndex )
 	{
-		//g_theJobSystem->PostJob( new FFTJob( this, m_waveSurfaceVerts, 1, mIndex * m_numSamples ) );
-
-		CalculateFFT( m_waveSurfaceVerts, 1, mIndex * m_numSamples );
-// 		CalculateFFT( m_hTilde, m_hTilde, 1, mIndex * m_numSamples );
-// 		CalculateFFT( m_hTilde_dx, m_hTilde_dx, 1, mIndex * m_numSamples );
-// 		CalculateFFT( m_hTilde_dy, m_hTilde_dy, 1, mIndex * m_numSamples );
-// 		CalculateFFT( m_slopeX, m_slopeX, 1, mIndex * m_numSamples );
-// 		CalculateFFT( m_slopeY, m_slopeY, 1, mIndex * m_numSamples );
-	}
-	for( uint nIndex = 0; nIndex < m_numSamples; ++nIndex )
-	{
-		//g_theJobSystem->PostJob( new FFTJob( this, m_waveSurfaceVerts, m_numSamples, nIndex ) );
-		CalculateFFT( m_waveSurfaceVerts, m_numSamples, nIndex );
-// 		CalculateFFT( m_hTilde, m_hTilde, m_numSamples, nIndex );
-// 		CalculateFFT( m_hTilde_dx, m_hTilde_dx, m_numSamples, nIndex );
-// 		CalculateFFT( m_hTilde_dy, m_hTilde_dy, m_numSamples, nIndex );
-// 		CalculateFFT( m_slopeX, m_slopeX, m_numSamples, nIndex );
-// 		CalculateFFT( m_slopeY, m_slopeY, m_numSamples, nIndex );
+		PROFILE_SCOPE( "Ocean FFT" );
+		if( m_useLegacyFFT )
+		{
+			RunLegacyFFT();
+		}
+		else
+		{
+			RunPlaneFFT();
+		}
 	}
-	//m_fftTimer.StopTimer();
-	
-// 	g_theJobSystem->WaitForAllJobs();
-// 	g_theJobSystem->ClaimAndDeleteAllCompletedJobs();
 
 	for( uint positionIndex = 0; positionIndex < m_waveSurfaceVerts.size(); ++positionIndex )
 	{
@@ -131,8 +118,11 @@ void FFTWaveSimulation::Simulate()
 
 	if( m_isIWaveEnabled )
 	{
+		PROFILE_SCOPE( "Ocean IWave" );
 		m_iWave->Update( deltaSeconds );
 	}
+
+	PROFILE_SCOPE( "Ocean Surface Verts" );
 	for( uint positionIndex = 0; positionIndex < m_surfaceVerts.size(); ++positionIndex )
 	{
 		int mPlus1 = positionIndex / ( m_numSamples + 1 );
@@ -182,8 +172,8 @@ void FFTWaveSimulation::Simulate()
 	{
 		RecalculateNormals();
 	}
+	MarkSurfaceChanged();
 	m_surfaceMesh->UpdateVerticies( static_cast<uint>( m_surfaceVerts.size() ), &m_surfaceVerts[0] );
-	//m_simulateTimer.StopTimer();
 }
 
 
@@ -225,6 +215,125 @@ void FFTWaveSimulation::InitializeValues()
 
 		m_waveSurfaceVerts[i] = WaveSurfaceVertex( this, n, m, IntVec2( m_numSamples, m_numSamples ), m_dimensions );
 	}
+
+	m_fft = new FFT2D( m_numSamples, NUM_SPECTRUM_PLANES );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void FFTWaveSimulation::CalculateSpectrumAtTime( float time )
+{
+	for( int positionIndex = 0; positionIndex < m_waveSurfaceVerts.size(); ++positionIndex )
+	{
+		m_waveSurfaceVerts[positionIndex].CalculateValuesAtTime( time );
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void FFTWaveSimulation::RunLegacyFFT()
+{
+	for( uint mIndex = 0; mIndex < m_numSamples; ++mIndex )
+	{
+		CalculateFFT( m_waveSurfaceVerts, 1, mIndex * m_numSamples );
+	}
+	for( uint nIndex = 0; nIndex < m_numSamples; ++nIndex )
+	{
+		CalculateFFT( m_waveSurfaceVerts, m_numSamples, nIndex );
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void FFTWaveSimulation::RunPlaneFFT( bool isMultithreaded )
+{
+	fft_plane_t planes[NUM_SPECTRUM_PLANES];
+	for( uint planeIndex = 0; planeIndex < NUM_SPECTRUM_PLANES; ++planeIndex )
+	{
+		planes[planeIndex] = m_fft->GetPlane( planeIndex );
+	}
+
+	size_t vertCount = m_waveSurfaceVerts.size();
+	for( size_t vertIndex = 0; vertIndex < vertCount; ++vertIndex )
+	{
+		WaveSurfaceVertex const& vert = m_waveSurfaceVerts[vertIndex];
+		ComplexFloat const* spectrum[NUM_SPECTRUM_PLANES] = { &vert.m_hTilde, &vert.m_position[0], &vert.m_position[1], &vert.m_surfaceSlope[0], &vert.m_surfaceSlope[1] };
+		for( uint planeIndex = 0; planeIndex < NUM_SPECTRUM_PLANES; ++planeIndex )
+		{
+			planes[planeIndex].real[vertIndex] = spectrum[planeIndex]->real();
+			planes[planeIndex].imag[vertIndex] = spectrum[planeIndex]->imag();
+		}
+	}
+
+	m_fft->Transform( isMultithreaded );
+
+	for( size_t vertIndex = 0; vertIndex < vertCount; ++vertIndex )
+	{
+		WaveSurfaceVertex& vert = m_waveSurfaceVerts[vertIndex];
+		ComplexFloat* spectrum[NUM_SPECTRUM_PLANES] = { &vert.m_hTilde, &vert.m_position[0], &vert.m_position[1], &vert.m_surfaceSlope[0], &vert.m_surfaceSlope[1] };
+		for( uint planeIndex = 0; planeIndex < NUM_SPECTRUM_PLANES; ++planeIndex )
+		{
+			*spectrum[planeIndex] = ComplexFloat( planes[planeIndex].real[vertIndex], planes[planeIndex].imag[vertIndex] );
+		}
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Times the struct butterflies against the plane FFT on the same spectrum and reports the largest difference
+// in the transformed heights. Each run starts from a fresh copy of the spectrum; copies are not timed.
+//---------------------------------------------------------------------------------------------------------
+STATIC void FFTWaveSimulation::BenchmarkFFT( uint numSamples, int iterations )
+{
+	FFTWaveSimulation benchmarkSimulation( Vec2( 32.f, 32.f ), numSamples, 37.f );
+	benchmarkSimulation.CalculateSpectrumAtTime( 1.f );
+	std::vector<WaveSurfaceVertex> const spectrum = benchmarkSimulation.m_waveSurfaceVerts;
+
+	double legacySeconds = 0.0;
+	double singleThreadSeconds = 0.0;
+	double multiThreadSeconds = 0.0;
+	for( int iteration = 0; iteration < iterations; ++iteration )
+	{
+		benchmarkSimulation.m_waveSurfaceVerts = spectrum;
+		double startTime = GetCurrentTimeSeconds();
+		benchmarkSimulation.RunLegacyFFT();
+		legacySeconds += GetCurrentTimeSeconds() - startTime;
+	}
+	std::vector<WaveSurfaceVertex> const legacyResult = benchmarkSimulation.m_waveSurfaceVerts;
+
+	for( int iteration = 0; iteration < iterations; ++iteration )
+	{
+		benchmarkSimulation.m_waveSurfaceVerts = spectrum;
+		double startTime = GetCurrentTimeSeconds();
+		benchmarkSimulation.RunPlaneFFT( false );
+		singleThreadSeconds += GetCurrentTimeSeconds() - startTime;
+	}
+
+	for( int iteration = 0; iteration < iterations; ++iteration )
+	{
+		benchmarkSimulation.m_waveSurfaceVerts = spectrum;
+		double startTime = GetCurrentTimeSeconds();
+		benchmarkSimulation.RunPlaneFFT( true );
+		multiThreadSeconds += GetCurrentTimeSeconds() - startTime;
+	}
+
+	float maxHeight = 0.f;
+	float maxError = 0.f;
+	for( size_t vertIndex = 0; vertIndex < legacyResult.size(); ++vertIndex )
+	{
+		ComplexFloat const& expected = legacyResult[vertIndex].m_hTilde;
+		ComplexFloat const& actual = benchmarkSimulation.m_waveSurfaceVerts[vertIndex].m_hTilde;
+		maxHeight = Maxf( maxHeight, std::abs( expected ) );
+		maxError = Maxf( maxError, std::abs( expected - actual ) );
+	}
+
+	double msPerIteration = 1000.0 / static_cast<double>( iterations );
+	int threadCount = g_theJobSystem->GetWorkerThreadCount() + 1;
+	g_theConsole->PrintString( Rgba8::YELLOW, "FFT %ix%i (%i runs)", numSamples, numSamples, iterations );
+	g_theConsole->PrintString( Rgba8::WHITE, "   Struct butterflies:  %.3f(ms)", legacySeconds * msPerIteration );
+	g_theConsole->PrintString( Rgba8::WHITE, "   Planes, 1 thread:    %.3f(ms)", singleThreadSeconds * msPerIteration );
+	g_theConsole->PrintString( Rgba8::WHITE, "   Planes, %i threads:  %.3f(ms)", threadCount, multiThreadSeconds * msPerIteration );
+	g_theConsole->PrintString( Rgba8::WHITE, "   Max height error:    %g (max height %g)", maxError, maxHeight );
 }
 
 //---------------------------------------------------------------------------------------------------------
@@ -341,20 +450,17 @@ void FFTWaveSimulation::CalculateFFT( std::vector<ComplexFloat>& data_in, std::v
 
 void FFTWaveSimulation::CalculateFFT( std::vector<WaveSurfaceVertex>& data, int stride, int offset )
 {
-	m_simulateTimer.Start();
 	for( uint sampleIndex = 0; sampleIndex < m_numSamples; ++sampleIndex )
 	{
 		int dataIndex = m_bitReversedIndices[sampleIndex] * stride + offset;
 		m_switchArray[which][sampleIndex] = data[ dataIndex ];
 	}
-	m_simulateTimer.Stop();
 
 	int w_ = 0;
 	int numLoops = m_numSamples >> 1;
 	int currentIterationSize = 2;
 	int lastIterationSize = 1;
 
-	m_pointCalculationTimer.Start();
 	for( uint i = 0; i < m_log2N; ++i )//512 = 9 loops
 	{
 		which ^= 1;
@@ -395,9 +501,7 @@ void FFTWaveSimulation::CalculateFFT( std::vector<WaveSurfaceVertex>& data, int
 		lastIterationSize		<<= 1;
 		++w_;
 	}
-	m_pointCalculationTimer.Stop();
 
-	m_fftTimer.Start();
 	for( uint sampleIndex = 0; sampleIndex < m_numSamples; ++sampleIndex )
 	{
 		int dataIndex = sampleIndex * stride + offset;
@@ -409,7 +513,6 @@ void FFTWaveSimulation::CalculateFFT( std::vector<WaveSurfaceVertex>& data, int
 		vertexDataTo.m_surfaceSlope[0] = vertexDataFrom.m_surfaceSlope[0];
 		vertexDataTo.m_surfaceSlope[1] = vertexDataFrom.m_surfaceSlope[1];
 	}
-	m_fftTimer.Stop();
 }
 
 
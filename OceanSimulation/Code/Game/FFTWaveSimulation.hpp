@@ -1,11 +1,25 @@
 #pragma once
 #include "Game/WaveSimulation.hpp"
-#include "Engine/Core/ProfileTimer.hpp"
 
 struct	WavePoint;
 struct	HTilde0Data;
 struct	WaveSurfaceVertex;
 class	IWave;
+class	FFT2D;
+
+
+//---------------------------------------------------------------------------------------------------------
+enum SpectrumPlane
+{
+	SPECTRUM_PLANE_HEIGHT,
+	SPECTRUM_PLANE_DISPLACEMENT_X,
+	SPECTRUM_PLANE_DISPLACEMENT_Y,
+	SPECTRUM_PLANE_SLOPE_X,
+	SPECTRUM_PLANE_SLOPE_Y,
+
+	NUM_SPECTRUM_PLANES
+};
+
 
 class FFTWaveSimulation : public WaveSimulation
 {
@@ -15,11 +29,19 @@ public:
 	~FFTWaveSimulation();
 	FFTWaveSimulation( Vec2 const& dimensions, uint samples, float windSpeed );
 	FFTWaveSimulation( Vec2 const& dimensions, uint samples, float windSpeed, Vec2 const& windDir, float aConstant, float waveSuppression );
-	FFTWaveSimulation( XmlElement const& element );
+	FFTWaveSimulation( BakedXmlElement const& element );
 
 	void Simulate() override;
 	void InitializeValues();
 
+	void CalculateSpectrumAtTime( float time );
+	void RunLegacyFFT();
+	void RunPlaneFFT( bool isMultithreaded = true );
+	void SetUseLegacyFFT( bool useLegacyFFT )		{ m_useLegacyFFT = useLegacyFFT; }
+	bool IsUsingLegacyFFT() const					{ return m_useLegacyFFT; }
+
+	static void BenchmarkFFT( uint numSamples, int iterations );
+
 	void GetHeightAtPosition( int n, int m, float time );
 	WaveSurfaceVertex* GetWaveVertAtIndex( int index );
 
@@ -35,15 +57,15 @@ public:
 
 public:
 	IWave* m_iWave = nullptr;
-	ProfileTimer m_fftTimer					= ProfileTimer( "FFT_FFTTimer" );
-	ProfileTimer m_simulateTimer			= ProfileTimer( "FFT_SimulateTimer" );
-	ProfileTimer m_pointCalculationTimer	= ProfileTimer( "FFT_PointTimer" );
 
 protected:
 	uint m_log2N = 0;
 	float m_pi2 = 0.f;
 	uint which = 0;
 
+	FFT2D*	m_fft			= nullptr;
+	bool	m_useLegacyFFT	= false;
+
 	ComplexFloatVector m_hTilde;
 	ComplexFloatVector m_hTilde_dx;
 	ComplexFloatVector m_hTilde_dy;
@@ -12,6 +12,7 @@
 #include "Engine/Core/Image.hpp"
 #include "Engine/Core/NamedProperties.hpp"
 #include "Engine/Core/ColorString.hpp"
+#include "Engine/Core/Profiler.hpp"
 #include "Engine/Renderer/RenderContext.hpp"
 #include "Engine/Renderer/BitmapFont.hpp"
 #include "Engine/Renderer/MeshUtils.hpp"
@@ -76,6 +77,9 @@ void Game::StartUp()
 	g_theEventSystem->SubscribeEventCallbackFunction( "LoseFocus", LoseFocus );
 	g_theEventSystem->SubscribeEventCallbackMethod( "new_fft_sim", this, &Game::create_new_fft_simulation );
 	g_theEventSystem->SubscribeEventCallbackMethod( "fft_xml", this, &Game::fft_from_xml );
+	g_theEventSystem->SubscribeEventCallbackMethod( "fft_benchmark", this, &Game::fft_benchmark );
+	g_theEventSystem->SubscribeEventCallbackMethod( "fft_legacy", this, &Game::fft_legacy );
+	g_theEventSystem->SubscribeEventCallbackMethod( "iwave_convolution", this, &Game::iwave_convolution );
 
 	g_theInput->SetCursorMode( MOUSE_MODE_RELATIVE );
 
@@ -412,9 +416,9 @@ void Game::RenderUI() const
 	runtimeStrings.push_back( ColorString( Rgba8::WHITE,	Stringf( "[T]   - Time Factor: %.0f", m_FFTWaveSimulation->GetTimeFactor() ) ) );
 
 
-// 	runtimeStrings.push_back( ColorString( Rgba8::WHITE,	Stringf( "Data In: %.4f(ms)", m_FFTWaveSimulation->m_simulateTimer.GetAvgTimeMilliseconds() ) ) );
-// 	runtimeStrings.push_back( ColorString( Rgba8::WHITE,	Stringf( "FFT computation: %.4f(ms)", m_FFTWaveSimulation->m_pointCalculationTimer.GetAvgTimeMilliseconds() ) ) );
-// 	runtimeStrings.push_back( ColorString( Rgba8::WHITE,	Stringf( "Data Out: %.4f(ms)", m_FFTWaveSimulation->m_fftTimer.GetAvgTimeMilliseconds() ) ) );
+	runtimeStrings.push_back( ColorString( Rgba8::WHITE,	Stringf( "Spectrum: %.4f(ms)", ProfilerGetLastFrameZoneMilliseconds( "Ocean Spectrum" ) ) ) );
+	runtimeStrings.push_back( ColorString( Rgba8::WHITE,	Stringf( "FFT computation: %.4f(ms)", ProfilerGetLastFrameZoneMilliseconds( "Ocean FFT" ) ) ) );
+	runtimeStrings.push_back( ColorString( Rgba8::WHITE,	Stringf( "Surface Update: %.4f(ms)", ProfilerGetLastFrameZoneMilliseconds( "Ocean Surface Verts" ) ) ) );
 
 	Vec2 const& simDimensions = m_FFTWaveSimulation->GetGridDimensions();
 	Vec2 const& windDir = m_FFTWaveSimulation->GetWindDirection();
@@ -1520,4 +1524,64 @@ void Game::fft_from_xml( EventArgs* args )
 	}
 
 	LoadSimulationFromXML( filepath.c_str() );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void Game::fft_benchmark( EventArgs* args )
+{
+	int samples		= args->GetValue( "samples", 0 );
+	int iterations	= args->GetValue( "iterations", 10 );
+	if( iterations < 1 )
+	{
+		iterations = 1;
+	}
+
+	if( samples > 0 )
+	{
+		FFTWaveSimulation::BenchmarkFFT( samples, iterations );
+		return;
+	}
+
+	FFTWaveSimulation::BenchmarkFFT( 256, iterations );
+	FFTWaveSimulation::BenchmarkFFT( 512, iterations );
+	FFTWaveSimulation::BenchmarkFFT( 1024, iterations );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void Game::fft_legacy( EventArgs* args )
+{
+	if( m_FFTWaveSimulation == nullptr )
+		return;
+
+	bool useLegacyFFT = args->GetValue( "enabled", !m_FFTWaveSimulation->IsUsingLegacyFFT() );
+	m_FFTWaveSimulation->SetUseLegacyFFT( useLegacyFFT );
+	g_theConsole->PrintString( Rgba8::YELLOW, "FFT path: %s", ( useLegacyFFT ? "struct butterflies" : "SoA planes" ) );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void Game::iwave_convolution( EventArgs* args )
+{
+	if( m_FFTWaveSimulation == nullptr )
+		return;
+
+	IWave* iWave = m_FFTWaveSimulation->m_iWave;
+	std::string mode = args->GetValue( "mode", "auto" );
+	if( mode == "direct" )
+	{
+		iWave->SetConvolutionMode( IWAVE_CONVOLUTION_DIRECT );
+	}
+	else if( mode == "fft" )
+	{
+		iWave->SetConvolutionMode( IWAVE_CONVOLUTION_FFT );
+	}
+	else
+	{
+		iWave->SetConvolutionMode( IWAVE_CONVOLUTION_AUTO );
+	}
+
+	bool isUsingFFT = iWave->GetActiveConvolutionMode() == IWAVE_CONVOLUTION_FFT;
+	g_theConsole->PrintString( Rgba8::YELLOW, "iWave convolution: %s", ( isUsingFFT ? "FFT" : "direct" ) );
 }
\ No newline at end of file
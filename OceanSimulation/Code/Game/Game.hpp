@@ -161,6 +161,9 @@ public:
 	static void LoseFocus( EventArgs* args );
 	void create_new_fft_simulation( EventArgs* args );
 	void fft_from_xml( EventArgs* args );
+	void fft_benchmark( EventArgs* args );
+	void fft_legacy( EventArgs* args );
+	void iwave_convolution( EventArgs* args );
 
 	bool IsQuitting() const { return m_isQuitting; }
 
@@ -24,6 +24,7 @@ void GersternWaveSimulation::Simulate()
 		m_surfaceVerts[pointIndex].m_position = newSurfacePosition;
 	}
 
+	MarkSurfaceChanged();
 	m_surfaceMesh->UpdateVerticies( static_cast<uint>( m_surfaceVerts.size() ), &m_surfaceVerts[0] );
 }
 
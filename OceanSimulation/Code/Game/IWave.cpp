@@ -7,9 +7,23 @@
 #include "Game/FFTWaveSimulation.hpp"
 #include "Game/WaveSurfaceVertex.hpp"
 #include "Game/WaterObject.hpp"
+#include "Game/FFT2D.hpp"
+#include "Engine/Core/JobSystem.hpp"
 #include <complex>
 #include <corecrt_math.h>
 
+#if defined( _M_X64 ) || defined( _M_IX86 ) || defined( __SSE2__ )
+	#define IWAVE_USE_SSE
+	#include <xmmintrin.h>
+#endif
+
+
+//---------------------------------------------------------------------------------------------------------
+// Per-sample cost of the FFT path per log2 of the grid size, measured in units of one folded direct stencil
+// tap. Two SIMD transforms on one thread come out at roughly 7.5 taps per log2 step.
+//---------------------------------------------------------------------------------------------------------
+constexpr float IWAVE_FFT_COST_PER_LOG2_SAMPLE = 7.5f;
+
 //---------------------------------------------------------------------------------------------------------
 IWave::IWave( FFTWaveSimulation* owner, Vec2 const& dimensions, int xSamples, int ySamples )
 	:m_owner( owner )
@@ -35,6 +49,8 @@ IWave::IWave( FFTWaveSimulation* owner, Vec2 const& dimensions, int xSamples, in
 //---------------------------------------------------------------------------------------------------------
 IWave::~IWave()
 {
+	delete m_convolutionFFT;
+	m_convolutionFFT = nullptr;
 }
 
 
@@ -130,6 +146,82 @@ void IWave::CreateKernel( int kernelSize )
 		}
 		m_kernelValuesLookUp[index] = g / g0;
 	}
+
+	CreateKernelSpectrum();
+	m_activeConvolutionMode = ChooseConvolutionMode();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// The kernel is wrapped onto the grid around the origin and transformed once so the FFT path only has to
+// transform the heights each tick. Only square power of two grids at least as wide as the kernel qualify.
+//---------------------------------------------------------------------------------------------------------
+void IWave::CreateKernelSpectrum()
+{
+	delete m_convolutionFFT;
+	m_convolutionFFT = nullptr;
+	m_kernelSpectrumReal.clear();
+	m_kernelSpectrumImag.clear();
+
+	int numSamples = m_gridDimensions.x;
+	bool isPowerOfTwo = numSamples > 0 && ( numSamples & ( numSamples - 1 ) ) == 0;
+	if( m_gridDimensions.x != m_gridDimensions.y || !isPowerOfTwo || numSamples < m_kernelDimension )
+		return;
+
+	m_convolutionFFT = new FFT2D( numSamples, 1 );
+	fft_plane_t plane = m_convolutionFFT->GetPlane( 0 );
+
+	int numPoints = numSamples * numSamples;
+	std::fill( plane.real, plane.real + numPoints, 0.f );
+	std::fill( plane.imag, plane.imag + numPoints, 0.f );
+	for( int l = -m_kernelSize; l < m_kernelSize + 1; ++l )
+	{
+		for( int k = -m_kernelSize; k < m_kernelSize + 1; ++k )
+		{
+			int xPos = PositiveMod( k, numSamples );
+			int yPos = PositiveMod( l, numSamples );
+			plane.real[ ( yPos * numSamples ) + xPos ] = GetKernelValue( k, l );
+		}
+	}
+
+	m_convolutionFFT->Transform( false );
+	m_kernelSpectrumReal.assign( plane.real, plane.real + numPoints );
+	m_kernelSpectrumImag.assign( plane.imag, plane.imag + numPoints );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+IWaveConvolutionMode IWave::ChooseConvolutionMode() const
+{
+	if( m_convolutionMode != IWAVE_CONVOLUTION_AUTO )
+	{
+		if( m_convolutionMode == IWAVE_CONVOLUTION_FFT && m_convolutionFFT == nullptr )
+			return IWAVE_CONVOLUTION_DIRECT;
+
+		return m_convolutionMode;
+	}
+
+	if( m_convolutionFFT == nullptr )
+		return IWAVE_CONVOLUTION_DIRECT;
+
+	int threadCount = 1;
+	if( g_theJobSystem != nullptr )
+	{
+		threadCount += g_theJobSystem->GetWorkerThreadCount();
+	}
+
+	float foldedTaps = static_cast<float>( ( m_kernelSize + 1 ) * ( m_kernelSize + 1 ) );
+	float fftCost = IWAVE_FFT_COST_PER_LOG2_SAMPLE * std::log2( static_cast<float>( m_gridDimensions.x ) ) / static_cast<float>( threadCount );
+	float directCost = foldedTaps;
+	return ( fftCost < directCost ) ? IWAVE_CONVOLUTION_FFT : IWAVE_CONVOLUTION_DIRECT;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void IWave::SetConvolutionMode( IWaveConvolutionMode mode )
+{
+	m_convolutionMode = mode;
+	m_activeConvolutionMode = ChooseConvolutionMode();
 }
 
 
@@ -176,34 +268,166 @@ void IWave::CalculateNewHeights( float deltaSeconds )
 //---------------------------------------------------------------------------------------------------------
 void IWave::ConvolveHeights()
 {
+	if( m_activeConvolutionMode == IWAVE_CONVOLUTION_FFT )
+	{
+		ConvolveHeightsFFT();
+	}
+	else
+	{
+		ConvolveHeightsDirect();
+	}
+
 	for( int index = 0; index < m_samplePoints.size(); ++index )
 	{
-		m_samplePoints[index].m_verticalDerivative = GetConvolutionValue( index );
+		m_samplePoints[index].m_verticalDerivative = m_convolvedHeights[index];
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Adds weight * ( a[x - lx] + a[x + lx] + b[x - lx] + b[x + lx] ) to a row of output, covering the four
+// kernel taps that share a weight. Callers halve the weight when lx or ly is zero and taps repeat.
+//---------------------------------------------------------------------------------------------------------
+static void AccumulateSymmetricTaps( float* out_row, float const* rowA, float const* rowB, int lx, float weight, int width )
+{
+	int x = 0;
+#if defined( IWAVE_USE_SSE )
+	__m128 const vWeight = _mm_set1_ps( weight );
+	for( ; x + 4 <= width; x += 4 )
+	{
+		__m128 taps = _mm_add_ps( _mm_loadu_ps( rowA + x - lx ), _mm_loadu_ps( rowA + x + lx ) );
+		taps = _mm_add_ps( taps, _mm_add_ps( _mm_loadu_ps( rowB + x - lx ), _mm_loadu_ps( rowB + x + lx ) ) );
+		_mm_storeu_ps( out_row + x, _mm_add_ps( _mm_loadu_ps( out_row + x ), _mm_mul_ps( taps, vWeight ) ) );
+	}
+#endif
+	for( ; x < width; ++x )
+	{
+		float taps = rowA[x - lx] + rowA[x + lx] + rowB[x - lx] + rowB[x + lx];
+		out_row[x] += taps * weight;
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Heights are copied once into a buffer padded by the kernel size with the grid wrapped into the border,
+// so the stencil runs without any bounds checks. The kernel is radially symmetric, so each weight is applied
+// once to the sum of its mirrored taps, one output row at a time.
+//---------------------------------------------------------------------------------------------------------
+void IWave::ConvolveHeightsDirect()
+{
+	int const width = m_gridDimensions.x;
+	int const height = m_gridDimensions.y;
+	int const paddedWidth = width + ( 2 * m_kernelSize );
+	int const paddedHeight = height + ( 2 * m_kernelSize );
+
+	m_paddedHeights.resize( paddedWidth * paddedHeight );
+	m_convolvedHeights.assign( width * height, 0.f );
+
+	for( int paddedY = 0; paddedY < paddedHeight; ++paddedY )
+	{
+		int sourceY = PositiveMod( paddedY - m_kernelSize, height );
+		IWaveData const* sourceRow = &m_samplePoints[ sourceY * width ];
+		float* paddedRow = &m_paddedHeights[ paddedY * paddedWidth ];
+		for( int paddedX = 0; paddedX < paddedWidth; ++paddedX )
+		{
+			int sourceX = paddedX - m_kernelSize;
+			if( sourceX < 0 || sourceX >= width )
+			{
+				sourceX = PositiveMod( sourceX, width );
+			}
+			paddedRow[paddedX] = sourceRow[sourceX].m_height;
+		}
+	}
+
+	for( int yPos = 0; yPos < height; ++yPos )
+	{
+		float* outputRow = &m_convolvedHeights[ yPos * width ];
+		float const* centerRow = &m_paddedHeights[ ( ( yPos + m_kernelSize ) * paddedWidth ) + m_kernelSize ];
+
+		for( int ly = 0; ly <= m_kernelSize; ++ly )
+		{
+			float const* rowAbove = centerRow + ( ly * paddedWidth );
+			float const* rowBelow = centerRow - ( ly * paddedWidth );
+			float rowScale = ( ly == 0 ) ? 0.5f : 1.f;
+
+			for( int lx = 0; lx <= m_kernelSize; ++lx )
+			{
+				float columnScale = ( lx == 0 ) ? 0.5f : 1.f;
+				float weight = GetKernelValue( lx, ly ) * rowScale * columnScale;
+				AccumulateSymmetricTaps( outputRow, rowAbove, rowBelow, lx, weight, width );
+			}
+		}
 	}
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+// Circular convolution through the convolution theorem. FFT2D only has the e^(+i) transform, so the inverse
+// is taken as conj( F( conj( H * K ) ) ) / N^2 - and since the result is real only the real part is kept.
+//---------------------------------------------------------------------------------------------------------
+void IWave::ConvolveHeightsFFT()
+{
+	int numSamples = m_gridDimensions.x;
+	int numPoints = numSamples * numSamples;
+	fft_plane_t plane = m_convolutionFFT->GetPlane( 0 );
+
+	for( int index = 0; index < numPoints; ++index )
+	{
+		plane.real[index] = m_samplePoints[index].m_height;
+		plane.imag[index] = 0.f;
+	}
+
+	m_convolutionFFT->Transform();
+
+	for( int index = 0; index < numPoints; ++index )
+	{
+		float heightReal = plane.real[index];
+		float heightImag = plane.imag[index];
+		float kernelReal = m_kernelSpectrumReal[index];
+		float kernelImag = m_kernelSpectrumImag[index];
+
+		plane.real[index] = ( heightReal * kernelReal ) - ( heightImag * kernelImag );
+		plane.imag[index] = -( ( heightReal * kernelImag ) + ( heightImag * kernelReal ) );
+	}
+
+	m_convolutionFFT->Transform();
+
+	float inverseScale = 1.f / static_cast<float>( numPoints );
+	m_convolvedHeights.resize( numPoints );
+	for( int index = 0; index < numPoints; ++index )
+	{
+		m_convolvedHeights[index] = plane.real[index] * inverseScale;
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Reference single point convolution, matches both batched paths
 //---------------------------------------------------------------------------------------------------------
 float IWave::GetConvolutionValue( int index )
 {
+	int yPos = index / m_gridDimensions.x;
+	int xPos = index - ( yPos * m_gridDimensions.x );
+
 	float convolveValue = 0.f;
 	for( int k = -m_kernelSize; k < m_kernelSize + 1; ++k )
 	{
 		for( int l = -m_kernelSize; l < m_kernelSize + 1; ++l )
 		{
-// 			float NEHeight = GetHeightAtIndex( index + ( m_gridDimensions.x * l ) + k );
-// 			float NWHeight = GetHeightAtIndex( index + ( m_gridDimensions.x * l ) - k );
-// 			float SEHeight = GetHeightAtIndex( index - ( m_gridDimensions.x * l ) + k );
-// 			float SWHeight = GetHeightAtIndex( index - ( m_gridDimensions.x * l ) - k );
-// 
-// 			convolveValue += GetKernelValue( k, l ) * ( NEHeight + SEHeight + NWHeight + SWHeight );
-
- 			float height = GetHeightAtIndex( index + ( m_gridDimensions.x * l ) + k );
+			float height = GetHeightAtGridCoords( xPos + k, yPos + l );
 			convolveValue += GetKernelValue( k, l ) * height;
 		}
 	}
-	//Clamp( convolveValue, -1.f, 1.f );
-	return convolveValue;// +m_samplePoints[index].m_height;
+	return convolveValue;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+float IWave::GetHeightAtGridCoords( int xPos, int yPos )
+{
+	int tiledX = PositiveMod( xPos, m_gridDimensions.x );
+	int tiledY = PositiveMod( yPos, m_gridDimensions.y );
+	return m_samplePoints[ ( tiledY * m_gridDimensions.x ) + tiledX ].m_height;
 }
 
 
@@ -5,6 +5,16 @@
 
 class FFTWaveSimulation;
 class WaterObject;
+class FFT2D;
+
+
+//---------------------------------------------------------------------------------------------------------
+enum IWaveConvolutionMode
+{
+	IWAVE_CONVOLUTION_AUTO,
+	IWAVE_CONVOLUTION_DIRECT,
+	IWAVE_CONVOLUTION_FFT,
+};
 
 //---------------------------------------------------------------------------------------------------------
 struct IWaveData
@@ -34,13 +44,24 @@ public:
 	void	CalculateNewHeights( float deltaSeconds );
 
 	void	ConvolveHeights();
+	void	ConvolveHeightsDirect();
+	void	ConvolveHeightsFFT();
 	float	GetConvolutionValue( int index );
 	float	GetHeightAtIndex( int index );
+	float	GetHeightAtGridCoords( int xPos, int yPos );
+
+	void					SetConvolutionMode( IWaveConvolutionMode mode );
+	IWaveConvolutionMode	GetConvolutionMode() const			{ return m_convolutionMode; }
+	IWaveConvolutionMode	GetActiveConvolutionMode() const	{ return m_activeConvolutionMode; }
 
 	void	AddWaterObject( WaterObject* waterObjectToAdd );
 	
 	void ResetHeightsToZero();
 
+private:
+	void					CreateKernelSpectrum();
+	IWaveConvolutionMode	ChooseConvolutionMode() const;
+
 private:
 	FFTWaveSimulation* m_owner = nullptr;
 
@@ -53,4 +74,13 @@ private:
 	std::vector<float>		m_sources;
 	std::vector<float>		m_obstructions;
 	std::vector<IWaveData>	m_samplePoints;
+
+	IWaveConvolutionMode	m_convolutionMode		= IWAVE_CONVOLUTION_AUTO;
+	IWaveConvolutionMode	m_activeConvolutionMode	= IWAVE_CONVOLUTION_DIRECT;
+	std::vector<float>		m_paddedHeights;
+	std::vector<float>		m_convolvedHeights;
+
+	FFT2D*					m_convolutionFFT		= nullptr;
+	std::vector<float>		m_kernelSpectrumReal;
+	std::vector<float>		m_kernelSpectrumImag;
 };
\ No newline at end of file
@@ -18,6 +18,7 @@
 #include "Game/FFTWaveSimulation.hpp"
 #include "Game/DFTWaveSimulation.hpp"
 #include "Game/WaterObject.hpp"
+#include <algorithm>
 
 
 //---------------------------------------------------------------------------------------------------------
@@ -103,7 +104,7 @@ WaveSimulation::WaveSimulation( Vec2 const& dimensions, uint samples, float wind
 
 
 //---------------------------------------------------------------------------------------------------------
-WaveSimulation::WaveSimulation( XmlElement const& element )
+WaveSimulation::WaveSimulation( BakedXmlElement const& element )
 {
 	m_simulationClock = new Clock(g_theGame->GetGameClock());
 	m_transform = new Transform();
@@ -113,10 +114,10 @@ WaveSimulation::WaveSimulation( XmlElement const& element )
 	m_numSamples = ParseXmlAttribute( element, "samples", -1 );
 	m_dimensions = ParseXmlAttribute( element, "dimensions", Vec2( -1.f, -1.f ) );
 
-	XmlElement const& phillipsElement = *element.FirstChildElement( "PhillipsSpectrum" );
+	BakedXmlElement const& phillipsElement = *element.FirstChildElement( "PhillipsSpectrum" );
 	SetPhillipsSpectrumValues( phillipsElement ); 
 
-	XmlElement const& defaultsElement = *element.FirstChildElement( "RuntimeDefaults" );
+	BakedXmlElement const& defaultsElement = *element.FirstChildElement( "RuntimeDefaults" );
 	SetRuntimeDefaults( defaultsElement ); 
 
 	GenerateSurface( Vec3::ZERO, Rgba8::WHITE, m_dimensions, IntVec2( m_numSamples, m_numSamples ) );
@@ -126,6 +127,20 @@ WaveSimulation::WaveSimulation( XmlElement const& element )
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+WaveSimulation::~WaveSimulation()
+{
+	delete m_surfaceMesh;
+	m_surfaceMesh = nullptr;
+
+	delete m_transform;
+	m_transform = nullptr;
+
+	delete m_simulationClock;
+	m_simulationClock = nullptr;
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 void WaveSimulation::Simulate()
 {
@@ -281,7 +296,10 @@ bool WaveSimulation::IsPointUnderWater( Vec3 const& position ) const
 	{
 		Vec2 faceitSize = m_dimensions / static_cast<float>( m_numSamples );
 		Vec2 localPos = positionXY - containingWaterBounds.mins;
-		IntVec2 gridPos = IntVec2( RoundUpToInt( localPos.x / faceitSize.x ), RoundUpToInt( localPos.y / faceitSize.y ) );
+		int maxGridCoord = static_cast<int>( m_numSamples );
+		IntVec2 gridPos;
+		gridPos.x = GetClamp( RoundUpToInt( localPos.x / faceitSize.x ), 0, maxGridCoord );
+		gridPos.y = GetClamp( RoundUpToInt( localPos.y / faceitSize.y ), 0, maxGridCoord );
 
 		int gridPositionIndex = gridPos.x + ( gridPos.y * ( m_numSamples + 1 ) );
 		Vertex_OCEAN const& vertexToAdd = m_surfaceVerts[gridPositionIndex];
@@ -372,76 +390,188 @@ void WaveSimulation::TransformByAverageWater( WaterObject* waterObjectToModify )
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+// Tiles are laid out on a regular grid centered on the origin, so the containing tile is found directly
 //---------------------------------------------------------------------------------------------------------
 bool WaveSimulation::GetContainingWaterBoundsForPoint( Vec2 const& positionToCheck, AABB2& out_foundBounds ) const
 {
-	for( uint waterBoundsIndex = 0; waterBoundsIndex < m_waveGridBounds.size(); ++waterBoundsIndex )
+	if( m_waveGridBounds.empty() )
+		return false;
+
+	Vec2 startPosition = -m_dimensions * ( static_cast<float>( m_tilingDimensions ) * 0.5f );
+	Vec2 localPosition = positionToCheck - startPosition;
+	int tilingDimensions = static_cast<int>( m_tilingDimensions );
+
+	int xTile = RoundDownToInt( localPosition.x / m_dimensions.x );
+	int yTile = RoundDownToInt( localPosition.y / m_dimensions.y );
+
+	// The far edges belong to the last tile
+	if( xTile == tilingDimensions && localPosition.x <= m_dimensions.x * static_cast<float>( tilingDimensions ) )
 	{
-		AABB2 const& currentBounds = m_waveGridBounds[waterBoundsIndex];
-		if( IsPointInsideAABB2D( positionToCheck, currentBounds ) )
-		{
-			out_foundBounds = currentBounds;
-			return true;
-		}
+		xTile = tilingDimensions - 1;
+	}
+	if( yTile == tilingDimensions && localPosition.y <= m_dimensions.y * static_cast<float>( tilingDimensions ) )
+	{
+		yTile = tilingDimensions - 1;
 	}
-	return false;
+
+	if( xTile < 0 || yTile < 0 || xTile >= tilingDimensions || yTile >= tilingDimensions )
+		return false;
+
+	out_foundBounds = m_waveGridBounds[ ( yTile * tilingDimensions ) + xTile ];
+	return true;
 }
 
 
 //---------------------------------------------------------------------------------------------------------
-Mat44 WaveSimulation::GetAverageWaterTransformOnGrid( IntVec2 const& gridStartPos, IntVec2 const& gridDimToUse, Vec2 const& waterBoundCenter )
+// Inclusive prefix sums over the (samples + 1)^2 surface verts with a zero row and column in front, so the
+// sum over any rectangle is four lookups. Rebuilt lazily the first time it is needed after the surface moves.
+//---------------------------------------------------------------------------------------------------------
+void WaveSimulation::BuildSurfaceSumTable()
 {
-	Vec3 positionTotal	= Vec3::ZERO;
-	Vec3 tangentTotal	= Vec3::ZERO;
-	Vec3 bitangentTotal = Vec3::ZERO;
-	Vec3 normalTotal	= Vec3::ZERO;
-	for( int yStep = 0; yStep < gridDimToUse.y; ++yStep )
+	int gridSize = static_cast<int>( m_numSamples + 1 );
+	int tableSize = gridSize + 1;
+	m_surfaceSumTable.resize( tableSize * tableSize );
+
+	for( int xIndex = 0; xIndex < tableSize; ++xIndex )
+	{
+		m_surfaceSumTable[xIndex] = water_surface_sum_t();
+	}
+
+	for( int yIndex = 0; yIndex < gridSize; ++yIndex )
 	{
-		for( int xStep = 0; xStep < gridDimToUse.x; ++xStep )
+		water_surface_sum_t rowSum;
+		water_surface_sum_t* tableRow = &m_surfaceSumTable[ ( yIndex + 1 ) * tableSize ];
+		water_surface_sum_t const* previousTableRow = tableRow - tableSize;
+		Vertex_OCEAN const* vertRow = &m_surfaceVerts[ yIndex * gridSize ];
+
+		tableRow[0] = water_surface_sum_t();
+		for( int xIndex = 0; xIndex < gridSize; ++xIndex )
 		{
-			int samplesPlus1 = static_cast<int>( m_numSamples + 1 );
-			IntVec2 gridPosition = gridStartPos + IntVec2( xStep, yStep );
-			if( gridPosition.x >= samplesPlus1 )
-			{
-				gridPosition.x -= samplesPlus1;
-			}
-			if( gridPosition.y >= samplesPlus1 )
+			Vertex_OCEAN const& vert = vertRow[xIndex];
+			rowSum.height += vert.m_position.z;
+			rowSum.tangent[0] += vert.m_tangent.x;
+			rowSum.tangent[1] += vert.m_tangent.y;
+			rowSum.tangent[2] += vert.m_tangent.z;
+			rowSum.bitangent[0] += vert.m_bitangent.x;
+			rowSum.bitangent[1] += vert.m_bitangent.y;
+			rowSum.bitangent[2] += vert.m_bitangent.z;
+			rowSum.normal[0] += vert.m_normal.x;
+			rowSum.normal[1] += vert.m_normal.y;
+			rowSum.normal[2] += vert.m_normal.z;
+
+			water_surface_sum_t const& above = previousTableRow[ xIndex + 1 ];
+			water_surface_sum_t& entry = tableRow[ xIndex + 1 ];
+			entry.height = rowSum.height + above.height;
+			for( int component = 0; component < 3; ++component )
 			{
-				gridPosition.y -= samplesPlus1;
+				entry.tangent[component]	= rowSum.tangent[component] + above.tangent[component];
+				entry.bitangent[component]	= rowSum.bitangent[component] + above.bitangent[component];
+				entry.normal[component]		= rowSum.normal[component] + above.normal[component];
 			}
+		}
+	}
 
-			int gridPositionIndex = gridPosition.x + ( gridPosition.y * samplesPlus1 );
-			Vertex_OCEAN& vertexToAdd = m_surfaceVerts[gridPositionIndex];
-			positionTotal	+= vertexToAdd.m_position;
-			tangentTotal	+= vertexToAdd.m_tangent;
-			bitangentTotal	+= vertexToAdd.m_bitangent;
-			normalTotal		+= vertexToAdd.m_normal;
+	m_isSurfaceSumTableDirty = false;
+}
 
-			if( g_isDebugDraw )
-			{
-				DebugAddWorldPoint( vertexToAdd.m_position + Vec3( waterBoundCenter, 0.f ), 0.1f, Rgba8::YELLOW, 0.f, DEBUG_RENDER_ALWAYS );
-			}
+
+//---------------------------------------------------------------------------------------------------------
+void WaveSimulation::AddSurfaceSumForRect( water_surface_sum_t& out_sum, int xStart, int yStart, int width, int height ) const
+{
+	int tableSize = static_cast<int>( m_numSamples + 2 );
+	int xEnd = xStart + width;
+	int yEnd = yStart + height;
+
+	water_surface_sum_t const& maxMax = m_surfaceSumTable[ ( yEnd * tableSize ) + xEnd ];
+	water_surface_sum_t const& minMax = m_surfaceSumTable[ ( yEnd * tableSize ) + xStart ];
+	water_surface_sum_t const& maxMin = m_surfaceSumTable[ ( yStart * tableSize ) + xEnd ];
+	water_surface_sum_t const& minMin = m_surfaceSumTable[ ( yStart * tableSize ) + xStart ];
+
+	out_sum.height += maxMax.height - minMax.height - maxMin.height + minMin.height;
+	for( int component = 0; component < 3; ++component )
+	{
+		out_sum.tangent[component]		+= maxMax.tangent[component] - minMax.tangent[component] - maxMin.tangent[component] + minMin.tangent[component];
+		out_sum.bitangent[component]	+= maxMax.bitangent[component] - minMax.bitangent[component] - maxMin.bitangent[component] + minMin.bitangent[component];
+		out_sum.normal[component]		+= maxMax.normal[component] - minMax.normal[component] - maxMin.normal[component] + minMin.normal[component];
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Footprints that run off the far edge of the grid wrap back to the start, so they are split into at most
+// one rectangle per wrap in each direction
+//---------------------------------------------------------------------------------------------------------
+void WaveSimulation::AddSurfaceSumForWrappedRect( water_surface_sum_t& out_sum, IntVec2 const& gridStartPos, IntVec2 const& gridDimToUse ) const
+{
+	int gridSize = static_cast<int>( m_numSamples + 1 );
+
+	int yRemaining = gridDimToUse.y;
+	int yStart = PositiveMod( gridStartPos.y, gridSize );
+	while( yRemaining > 0 )
+	{
+		int rectHeight = std::min( yRemaining, gridSize - yStart );
+
+		int xRemaining = gridDimToUse.x;
+		int xStart = PositiveMod( gridStartPos.x, gridSize );
+		while( xRemaining > 0 )
+		{
+			int rectWidth = std::min( xRemaining, gridSize - xStart );
+			AddSurfaceSumForRect( out_sum, xStart, yStart, rectWidth, rectHeight );
+
+			xRemaining -= rectWidth;
+			xStart = 0;
 		}
+
+		yRemaining -= rectHeight;
+		yStart = 0;
 	}
+}
+
 
-	int totalPointsHit = gridDimToUse.x * gridDimToUse.y;
-	if( totalPointsHit == 0 )
+//---------------------------------------------------------------------------------------------------------
+Mat44 WaveSimulation::GetAverageWaterTransformOnGrid( IntVec2 const& gridStartPos, IntVec2 const& gridDimToUse, Vec2 const& waterBoundCenter )
+{
+	if( gridDimToUse.x <= 0 || gridDimToUse.y <= 0 )
 	{
 		return Mat44::IDENTITY;
 	}
 
-	float inversePointsHit = 1.f / static_cast<float>( totalPointsHit );
+	if( m_isSurfaceSumTableDirty )
+	{
+		BuildSurfaceSumTable();
+	}
+
+	water_surface_sum_t footprintSum;
+	AddSurfaceSumForWrappedRect( footprintSum, gridStartPos, gridDimToUse );
+
+	if( g_isDebugDraw )
+	{
+		int samplesPlus1 = static_cast<int>( m_numSamples + 1 );
+		for( int yStep = 0; yStep < gridDimToUse.y; ++yStep )
+		{
+			for( int xStep = 0; xStep < gridDimToUse.x; ++xStep )
+			{
+				int xGrid = PositiveMod( gridStartPos.x + xStep, samplesPlus1 );
+				int yGrid = PositiveMod( gridStartPos.y + yStep, samplesPlus1 );
+				Vertex_OCEAN const& vertexToDraw = m_surfaceVerts[ xGrid + ( yGrid * samplesPlus1 ) ];
+				DebugAddWorldPoint( vertexToDraw.m_position + Vec3( waterBoundCenter, 0.f ), 0.1f, Rgba8::YELLOW, 0.f, DEBUG_RENDER_ALWAYS );
+			}
+		}
+	}
+
+	double inversePointsHit = 1.0 / static_cast<double>( gridDimToUse.x * gridDimToUse.y );
 
-	Vec3 positionAverage	= positionTotal * inversePointsHit;
-	Vec3 tangentAverage		= tangentTotal * inversePointsHit;
-	Vec3 bitangentAverage	= bitangentTotal * inversePointsHit;
-	Vec3 normalAverage		= normalTotal * inversePointsHit;
+	float heightAverage		= static_cast<float>( footprintSum.height * inversePointsHit );
+	Vec3 tangentAverage		= Vec3( static_cast<float>( footprintSum.tangent[0] ), static_cast<float>( footprintSum.tangent[1] ), static_cast<float>( footprintSum.tangent[2] ) );
+	Vec3 bitangentAverage	= Vec3( static_cast<float>( footprintSum.bitangent[0] ), static_cast<float>( footprintSum.bitangent[1] ), static_cast<float>( footprintSum.bitangent[2] ) );
+	Vec3 normalAverage		= Vec3( static_cast<float>( footprintSum.normal[0] ), static_cast<float>( footprintSum.normal[1] ), static_cast<float>( footprintSum.normal[2] ) );
 
 	tangentAverage.Normalize();
 	bitangentAverage.Normalize();
 	normalAverage.Normalize();
 
-	Mat44 waveVertOrientation = Mat44( tangentAverage, bitangentAverage, normalAverage, Vec3( 0.f, 0.f, positionAverage.z ) );
+	Mat44 waveVertOrientation = Mat44( tangentAverage, bitangentAverage, normalAverage, Vec3( 0.f, 0.f, heightAverage ) );
 	return waveVertOrientation;
 }
 
@@ -449,7 +579,7 @@ Mat44 WaveSimulation::GetAverageWaterTransformOnGrid( IntVec2 const& gridStartPo
 //---------------------------------------------------------------------------------------------------------
 STATIC WaveSimulation* WaveSimulation::CreateWaveSimulation( std::string filePath )
 {
-	XmlDocument waveSimulationFile = new XmlDocument();
+	BakedXmlDocument waveSimulationFile;
 	waveSimulationFile.LoadFile( filePath.c_str() );
 
 	if( waveSimulationFile.ErrorID() != 0 )
@@ -462,7 +592,7 @@ STATIC WaveSimulation* WaveSimulation::CreateWaveSimulation( std::string filePat
 
 
 //---------------------------------------------------------------------------------------------------------
-STATIC WaveSimulation* WaveSimulation::CreateWaveSimulationFromXML( XmlElement* element )
+STATIC WaveSimulation* WaveSimulation::CreateWaveSimulationFromXML( BakedXmlElement* element )
 {
 	std::string waveSimulationType = ParseXmlAttribute( *element, "type", "Default" );
 	WaveSimulationMode waveMode = GetWaveSimulationModeFromString( waveSimulationType );
@@ -488,7 +618,7 @@ WaveSimulationMode WaveSimulation::GetWaveSimulationModeFromString( std::string
 
 
 //---------------------------------------------------------------------------------------------------------
-void WaveSimulation::SetPhillipsSpectrumValues( XmlElement const& element )
+void WaveSimulation::SetPhillipsSpectrumValues( BakedXmlElement const& element )
 {
 	m_A					= ParseXmlAttribute( element, "aConstant", -1.f );
 	m_windSpeed			= ParseXmlAttribute( element, "windSpeed", -1.f );
@@ -506,7 +636,7 @@ void WaveSimulation::SetPhillipsSpectrumValues( XmlElement const& element )
 
 
 //---------------------------------------------------------------------------------------------------------
-void WaveSimulation::SetRuntimeDefaults( XmlElement const& element )
+void WaveSimulation::SetRuntimeDefaults( BakedXmlElement const& element )
 {
 	m_choppyWaterValue	= ParseXmlAttribute( element, "choppiness", 0.f );
 	m_isIWaveEnabled	= ParseXmlAttribute( element, "iWaveEnabled", false );
@@ -2,7 +2,7 @@
 #include "Engine/Math/Vec2.hpp"
 #include "Engine/Math/AABB2.hpp"
 #include "Engine/Core/EngineCommon.hpp"
-#include "Engine/Core/XmlUtils.hpp"
+#include "Engine/Core/BakedXml.hpp"
 #include "Game/Vertex_OCEAN.hpp"
 #include "Game/WaveSurfaceVertex.hpp"
 #include "Game/GameCommon.hpp"
@@ -35,6 +35,19 @@ struct HTilde0Data
 };
 
 
+//---------------------------------------------------------------------------------------------------------
+// Running totals for one corner of the surface summed-area table. Doubles keep the four corner difference
+// accurate for small footprints on large grids.
+//---------------------------------------------------------------------------------------------------------
+struct water_surface_sum_t
+{
+	double height		= 0.0;
+	double tangent[3]	= { 0.0, 0.0, 0.0 };
+	double bitangent[3]	= { 0.0, 0.0, 0.0 };
+	double normal[3]	= { 0.0, 0.0, 0.0 };
+};
+
+
 //---------------------------------------------------------------------------------------------------------
 struct Wave
 {
@@ -65,8 +78,8 @@ class WaveSimulation
 	friend class IWave;
 
 public:
-	virtual ~WaveSimulation() {};
-	WaveSimulation( XmlElement const& element );
+	virtual ~WaveSimulation();
+	WaveSimulation( BakedXmlElement const& element );
 	WaveSimulation( Vec2 const& dimensions, uint samples, float windSpeed );
 
 	virtual void Simulate();
@@ -117,19 +130,24 @@ public:
 	void		TransformByAverageWater( WaterObject* waterObjectToModify );
 	bool		GetContainingWaterBoundsForPoint( Vec2 const& positionToCheck, AABB2& out_foundBounds ) const;
 	Mat44		GetAverageWaterTransformOnGrid( IntVec2 const& gridStartPos, IntVec2 const& gridDimToUse, Vec2 const& waterBoundsCenter );
+	void		MarkSurfaceChanged()					{ m_isSurfaceSumTableDirty = true; }
 
 public:
 	static	WaveSimulation*		CreateWaveSimulation( std::string filePath );
-	static	WaveSimulation*		CreateWaveSimulationFromXML( XmlElement* element );
+	static	WaveSimulation*		CreateWaveSimulationFromXML( BakedXmlElement* element );
 	static	WaveSimulationMode	GetWaveSimulationModeFromString( std::string waveSimulationMode );
-			void				SetPhillipsSpectrumValues( XmlElement const& element );
-			void				SetRuntimeDefaults( XmlElement const& element );
+			void				SetPhillipsSpectrumValues( BakedXmlElement const& element );
+			void				SetRuntimeDefaults( BakedXmlElement const& element );
 	void	CreateQuadTree();
 
 private:
 	void	GenerateSurface( Vec3 const& origin, Rgba8 const& color, Vec2 const& dimensions, IntVec2 const& steps );
 	void	DrawQuadTreeDebug() const;
 
+	void	BuildSurfaceSumTable();
+	void	AddSurfaceSumForRect( water_surface_sum_t& out_sum, int xStart, int yStart, int width, int height ) const;
+	void	AddSurfaceSumForWrappedRect( water_surface_sum_t& out_sum, IntVec2 const& gridStartPos, IntVec2 const& gridDimToUse ) const;
+
 protected:
 	Clock*				m_simulationClock		= nullptr;
 	float				m_timeFactor			= 1.f;
@@ -157,5 +175,8 @@ protected:
 	std::vector<Vec3>			m_initialSurfacePositions;
 	std::vector<AABB2>			m_waveGridBounds;
 
+	bool								m_isSurfaceSumTableDirty = true;
+	std::vector<water_surface_sum_t>	m_surfaceSumTable;
+
 	std::vector<HTilde0Data> m_hTilde0Data;
 };
\ No newline at end of file
@@ -221,4 +221,5 @@ void App::EndFrame()
 	g_theInput->EndFrame();
 	g_theAudio->EndFrame();
 	DebugRenderEndFrame();
+	Clock::EndFrame();
 }
\ No newline at end of file
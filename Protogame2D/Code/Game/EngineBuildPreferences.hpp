@@ -9,4 +9,6 @@
 //
 
 #define ENGINE_DISABLE_AUDIO	// (If uncommented) Disables AudioSystem code and fmod linkage.
+//#define ENGINE_DISABLE_PROFILER	// (If uncommented) Compiles out PROFILE_SCOPE zones.
+//#define ENGINE_TRACK_ALLOCATIONS	// (If uncommented) Routes global new/delete through the MemoryTracker for mem_report.
 
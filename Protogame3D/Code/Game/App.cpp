@@ -199,4 +199,5 @@ void App::EndFrame()
 	g_theAudio->EndFrame();
 
 	DebugRenderEndFrame();
+	Clock::EndFrame();
 }
@@ -8,4 +8,6 @@
 //	Downside: ALL games must now have this Code/Game/EngineBuildPreferences.hpp file.
 //
 
-//#define ENGINE_DISABLE_AUDIO	// (If uncommented) Disables AudioSystem code and fmod linkage.
\ No newline at end of file
+//#define ENGINE_DISABLE_AUDIO	// (If uncommented) Disables AudioSystem code and fmod linkage.
+//#define ENGINE_DISABLE_PROFILER	// (If uncommented) Compiles out PROFILE_SCOPE zones.
+//#define ENGINE_TRACK_ALLOCATIONS	// (If uncommented) Routes global new/delete through the MemoryTracker for mem_report.
\ No newline at end of file
@@ -90,115 +90,63 @@ void Game::SpawnWave()
 //---------------------------------------------------------------------------------------------------------
 void Game::DeleteAllAsteroids()
 {
-	for( int asteroidIndex = 0; asteroidIndex < MAX_ASTEROID_COUNT; ++asteroidIndex )
-	{
-		Asteroid *currentAsteroid = m_asteroids[ asteroidIndex ];
-		if( currentAsteroid != nullptr )
-		{
-			delete currentAsteroid;
-			currentAsteroid = nullptr;
-		}
-	}
+	m_asteroids.Clear();
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 void Game::DeleteAllBullets()
 {
-	for( int bulletIndex = 0; bulletIndex < MAX_BULLET_COUNT; ++bulletIndex )
-	{
-		Bullet *currentBullet = m_bullets[ bulletIndex ];
-		if( currentBullet != nullptr )
-		{
-			delete currentBullet;
-			currentBullet = nullptr;
-		}
-	}
+	m_bullets.Clear();
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 void Game::DeleteAllBeetles()
 {
-	for( int beetleIndex = 0; beetleIndex < MAX_BEETLE_COUNT; ++beetleIndex )
-	{
-		Beetle *currentBeetle = m_beetles[ beetleIndex ];
-		if( currentBeetle != nullptr )
-		{
-			delete currentBeetle;
-			currentBeetle = nullptr;
-		}
-	}
+	m_beetles.Clear();
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 void Game::DeleteAllWasps()
 {
-	for( int waspIndex = 0; waspIndex < MAX_WASP_COUNT; ++waspIndex )
-	{
-		Wasp *currentWasp = m_wasps[ waspIndex ];
-		if( currentWasp != nullptr )
-		{
-			delete currentWasp;
-			currentWasp = nullptr;
-		}
-	}
+	m_wasps.Clear();
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 void Game::DeleteAllDebris()
 {
-	for( int debrisIndex = 0; debrisIndex < MAX_DEBRIS_COUNT; ++debrisIndex )
-	{
-		Debris *currentDebris = m_debris[ debrisIndex ];
-		if( currentDebris != nullptr )
-		{
-			delete currentDebris;
-			currentDebris = nullptr;
-		}
-	}
+	m_debris.Clear();
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 void Game::SpawnBullet( Vec2 location, float rotation )
 {
-	Bullet *newBullet = new Bullet( this, location, rotation );
-	for( int bulletIndex = 0; bulletIndex < MAX_BULLET_COUNT; ++bulletIndex )
+	if( m_bullets.Create( this, location, rotation ).IsNull() )
 	{
-		if( m_bullets[ bulletIndex ] == nullptr )
-		{
-			m_bullets[ bulletIndex ] = newBullet;
-			return;
-		}
+		ERROR_RECOVERABLE( Stringf( "Cannot spawn Bullet; maximum number of Bullets is %i", MAX_BULLET_COUNT ) );
 	}
-	ERROR_RECOVERABLE( Stringf( "Cannot spawn Bullet; maximum number of Bullets is %i", MAX_BULLET_COUNT ) );
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 void Game::SpawnAsteroid( )
 {
-	m_enemiesRemaining++;
-	Asteroid *newAsteroid = new Asteroid( this );
-	for( int asteroidIndex = 0; asteroidIndex < MAX_ASTEROID_COUNT; ++asteroidIndex )
+	if( m_asteroids.Create( this ).IsNull() )
 	{
-		if( m_asteroids[asteroidIndex] == nullptr )
-		{
-			m_asteroids[ asteroidIndex ] = newAsteroid;
-			return;
-		}
+		ERROR_RECOVERABLE( Stringf( "Cannot spawn Asteroid; maximum number of Asteroids is %i", MAX_ASTEROID_COUNT ) );
+		return;
 	}
-	ERROR_RECOVERABLE( Stringf( "Cannot spawn Asteroid; maximum number of Asteroids is %i", MAX_ASTEROID_COUNT ) );
+	m_enemiesRemaining++;
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 void Game::SpawnBeetle()
 {
-	m_enemiesRemaining++;
 	float beetlePositionY = g_RNG->GetRandomFloatInRange( 0.f, CAMERA_SIZE_Y );	
 	
 	int spawnSide = g_RNG->GetRandomIntInRange( 0, 1 );
@@ -212,23 +160,18 @@ void Game::SpawnBeetle()
 		beetlePositionX += BEETLE_COSMETIC_RADIUS;
 	}
 
-	Beetle *newBeetle = new Beetle( this, Vec2( beetlePositionX, beetlePositionY ) );
-	for( int beetleIndex = 0; beetleIndex < MAX_BEETLE_COUNT; ++beetleIndex )
+	if( m_beetles.Create( this, Vec2( beetlePositionX, beetlePositionY ) ).IsNull() )
 	{
-		if( m_beetles[beetleIndex] == nullptr )
-		{
-			m_beetles[ beetleIndex ] = newBeetle;
-			return;
-		}
+		ERROR_RECOVERABLE( Stringf( "Cannot spawn Beetle; maximum number of Beetles is %i", MAX_BEETLE_COUNT ) );
+		return;
 	}
-	ERROR_RECOVERABLE( Stringf( "Cannot spawn Asteroid; maximum number of Beetles is %i", MAX_BEETLE_COUNT ) );
+	m_enemiesRemaining++;
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 void Game::SpawnWasp()
 {
-	m_enemiesRemaining++;
 	float waspPositionY = g_RNG->GetRandomFloatInRange( 0.f, CAMERA_SIZE_Y );
 
 	int spawnSide = g_RNG->GetRandomIntInRange( 0, 1 );
@@ -242,16 +185,12 @@ void Game::SpawnWasp()
 		waspPositionX += WASP_COSMETIC_RADIUS;
 	}
 
-	Wasp *newWasp = new Wasp( this, Vec2( waspPositionX, waspPositionY ) );
-	for( int waspIndex = 0; waspIndex < MAX_BEETLE_COUNT; ++waspIndex )
+	if( m_wasps.Create( this, Vec2( waspPositionX, waspPositionY ) ).IsNull() )
 	{
-		if( m_wasps[ waspIndex ] == nullptr )
-		{
-			m_wasps[ waspIndex ] = newWasp;
-			return;
-		}
+		ERROR_RECOVERABLE( Stringf( "Cannot spawn Wasp; maximum number of Wasps is %i", MAX_WASP_COUNT ) );
+		return;
 	}
-	ERROR_RECOVERABLE( Stringf( "Cannot spawn Asteroid; maximum number of Wasps is %i", MAX_WASP_COUNT ) );
+	m_enemiesRemaining++;
 }
 
 
@@ -264,21 +203,9 @@ void Game::SpawnDebris( const Entity* dyingEntity, const Entity* killingEntity )
 	Rgba8 debrisColor = dyingEntity->GetColor();
 	Vec2 debrisSpeed = dyingEntity->GetForwardVector() + killingEntity->GetForwardVector();
 	
-	int debrisPiecesIndex = 0;
-
- 	for( int debrisIndex = 0; debrisIndex < MAX_DEBRIS_COUNT; ++debrisIndex )
+	for( int debrisPiecesIndex = 0; debrisPiecesIndex < numberOfDebrisPieces; ++debrisPiecesIndex )
 	{
-		while( debrisPiecesIndex < numberOfDebrisPieces && debrisIndex < MAX_DEBRIS_COUNT)
-		{
-			if( m_debris[ debrisIndex ] == nullptr )
-			{
-				Debris *newDebris = new Debris( this, spawnPosition, debrisSpeed, debrisColor, maxDebrisRadius );
-				m_debris[ debrisIndex ] = newDebris;
-				++debrisPiecesIndex;
-			}
-			++debrisIndex;
-		}
-		if( debrisPiecesIndex >= numberOfDebrisPieces )
+		if( m_debris.Create( this, spawnPosition, debrisSpeed, debrisColor, maxDebrisRadius ).IsNull() )
 		{
 			return;
 		}
@@ -315,77 +242,57 @@ void Game::Render() const
 void Game::RenderEntities() const
 {
 	//Draw Bullets
-	for( int numBullets = 0; numBullets < MAX_BULLET_COUNT; ++numBullets )
+	for( Bullet const& currentBullet : m_bullets )
 	{
-		Bullet *currentBullet = m_bullets[ numBullets ];
-		if( currentBullet != nullptr )
-		{
-			currentBullet->Render();
+		currentBullet.Render();
 
-			if( m_gameState == DEBUG_STATE )
-			{
-				DrawLineBetweenEntities( currentBullet, m_playerShip );
-			}
+		if( m_gameState == DEBUG_STATE )
+		{
+			DrawLineBetweenEntities( &currentBullet, m_playerShip );
 		}
 	}
 
 	//Asteroid Render
-	for( int asteroidIndex = 0; asteroidIndex < MAX_ASTEROID_COUNT; ++asteroidIndex )
+	for( Asteroid const& currentAsteroid : m_asteroids )
 	{
-		Asteroid* currentAsteroid = m_asteroids[ asteroidIndex ];
-		if( currentAsteroid != nullptr )
-		{
-			currentAsteroid->Render();
+		currentAsteroid.Render();
 
-			if( m_gameState == DEBUG_STATE )
-			{
-				DrawLineBetweenEntities( currentAsteroid, m_playerShip );
-			}
+		if( m_gameState == DEBUG_STATE )
+		{
+			DrawLineBetweenEntities( &currentAsteroid, m_playerShip );
 		}
 	}
 
 	//Beetle Render
-	for( int beetleIndex = 0; beetleIndex < MAX_BEETLE_COUNT; ++beetleIndex )
+	for( Beetle const& currentBeetle : m_beetles )
 	{
-		Beetle* currentBeetle = m_beetles[ beetleIndex ];
-		if( currentBeetle != nullptr )
-		{
-			currentBeetle->Render();
+		currentBeetle.Render();
 
-			if( m_gameState == DEBUG_STATE )
-			{
-				DrawLineBetweenEntities( currentBeetle, m_playerShip );
-			}
+		if( m_gameState == DEBUG_STATE )
+		{
+			DrawLineBetweenEntities( &currentBeetle, m_playerShip );
 		}
 	}
 
 	//Wasp Render
-	for( int waspIndex = 0; waspIndex < MAX_WASP_COUNT; ++waspIndex )
+	for( Wasp const& currentWasp : m_wasps )
 	{
-		Wasp* currentWasp = m_wasps[ waspIndex ];
-		if( currentWasp != nullptr )
-		{
- 			currentWasp->Render();
+		currentWasp.Render();
 
-			if( m_gameState == DEBUG_STATE )
-			{
-				DrawLineBetweenEntities( currentWasp, m_playerShip );
-			}
+		if( m_gameState == DEBUG_STATE )
+		{
+			DrawLineBetweenEntities( &currentWasp, m_playerShip );
 		}
 	}
 
 	//Debris Render
-	for( int debrisIndex = 0; debrisIndex < MAX_DEBRIS_COUNT; ++debrisIndex )
+	for( Debris const& currentDebris : m_debris )
 	{
-		Debris* currentDebris = m_debris[ debrisIndex ];
-		if( currentDebris != nullptr )
-		{
-			currentDebris->Render();
+		currentDebris.Render();
 
-			if( m_gameState == DEBUG_STATE )
-			{
-				DrawLineBetweenEntities( currentDebris, m_playerShip );
-			}
+		if( m_gameState == DEBUG_STATE )
+		{
+			DrawLineBetweenEntities( &currentDebris, m_playerShip );
 		}
 	}
 
@@ -460,53 +367,33 @@ void Game::Update( float deltaSeconds )
 void Game::UpdateEntities( float deltaSeconds )
 {
 	//Update Bullets
-	for( int numBullets = 0; numBullets < MAX_BULLET_COUNT; ++numBullets )
+	for( Bullet& currentBullet : m_bullets )
 	{
-		Bullet* currentBullet = m_bullets[ numBullets ];
-		if( currentBullet != nullptr )
-		{
-			currentBullet->Update( deltaSeconds );
-		}
+		currentBullet.Update( deltaSeconds );
 	}
 
 	//Update Asteroids
-	for( int asteroidIndex = 0; asteroidIndex < MAX_ASTEROID_COUNT; ++asteroidIndex )
+	for( Asteroid& currentAsteroid : m_asteroids )
 	{
-		Asteroid* currentAsteroid = m_asteroids[ asteroidIndex ];
-		if( currentAsteroid != nullptr )
-		{
-			currentAsteroid->Update( deltaSeconds );
-		}
+		currentAsteroid.Update( deltaSeconds );
 	}
 
 	//Update Beetles
-	for( int beetleIndex = 0; beetleIndex < MAX_BEETLE_COUNT; ++beetleIndex )
+	for( Beetle& currentBeetle : m_beetles )
 	{
-		Beetle* currentBeetle = m_beetles[ beetleIndex ];
-		if( currentBeetle != nullptr )
-		{
-			currentBeetle->Update( deltaSeconds );
-		}
+		currentBeetle.Update( deltaSeconds );
 	}
 
 	//Update Wasps
-	for( int waspIndex = 0; waspIndex < MAX_WASP_COUNT; ++waspIndex )
+	for( Wasp& currentWasp : m_wasps )
 	{
-		Wasp* currentWasp = m_wasps[ waspIndex ];
-		if( currentWasp != nullptr )
-		{
-			currentWasp->Update( deltaSeconds );
-		}
+		currentWasp.Update( deltaSeconds );
 	}
 
 	//Update Debris
-	for( int debrisIndex = 0; debrisIndex < MAX_DEBRIS_COUNT; ++debrisIndex )
+	for( Debris& currentDebris : m_debris )
 	{
-		Debris* currentDebris = m_debris[ debrisIndex ];
-		if( currentDebris != nullptr )
-		{
-			currentDebris->Update( deltaSeconds );
-		}
+		currentDebris.Update( deltaSeconds );
 	}
 
 	//Update Player.
@@ -542,17 +429,11 @@ void Game::UpdateCameras( float deltaSeconds )
 //---------------------------------------------------------------------------------------------------------
 void Game::CheckCollisions()
 {
-	Bullet *currentBullet = nullptr;
-
-	for( int bulletIndex = 0; bulletIndex < MAX_BULLET_COUNT; ++bulletIndex )
+	for( Bullet& currentBullet : m_bullets )
 	{
-		currentBullet = m_bullets[ bulletIndex ];
-		if( currentBullet != nullptr )
-		{
-			CheckAsteroidCollisionsWithEntity( currentBullet );
-			CheckBeetleCollisionsWithEntity( currentBullet );
-			CheckWaspCollisionsWithEntity( currentBullet );
-		}
+		CheckAsteroidCollisionsWithEntity( &currentBullet );
+		CheckBeetleCollisionsWithEntity( &currentBullet );
+		CheckWaspCollisionsWithEntity( &currentBullet );
 	}
 
 	CheckAsteroidCollisionsWithEntity( m_playerShip );
@@ -564,24 +445,20 @@ void Game::CheckCollisions()
 //---------------------------------------------------------------------------------------------------------
 void Game::CheckAsteroidCollisionsWithEntity( Entity* collider )
 {
-	Asteroid *currentAsteroid;
-
-	for( int asteroidIndex = 0; asteroidIndex < MAX_ASTEROID_COUNT; ++asteroidIndex )
+	for( Asteroid& currentAsteroid : m_asteroids )
 	{
-		currentAsteroid = m_asteroids[ asteroidIndex ];
-
-		if( currentAsteroid != nullptr && DoEntitiesOverlap( currentAsteroid, collider ) )
+		if( DoEntitiesOverlap( &currentAsteroid, collider ) )
 		{
- 			collider->TakeDamage( 1 );
+			collider->TakeDamage( 1 );
 			if( collider->IsDead() )
 			{
-				SpawnDebris( collider, currentAsteroid );
+				SpawnDebris( collider, &currentAsteroid );
 			}
 
-			currentAsteroid->TakeDamage( 1 );
-			if( currentAsteroid->IsDead() )
+			currentAsteroid.TakeDamage( 1 );
+			if( currentAsteroid.IsDead() )
 			{
-				SpawnDebris( currentAsteroid, collider );
+				SpawnDebris( &currentAsteroid, collider );
 			}
 		}
 	}
@@ -591,24 +468,20 @@ void Game::CheckAsteroidCollisionsWithEntity( Entity* collider )
 //---------------------------------------------------------------------------------------------------------
 void Game::CheckBeetleCollisionsWithEntity( Entity* collider )
 {
-	Beetle* currentBeetle;
-
-	for( int beetleIndex = 0; beetleIndex < MAX_BEETLE_COUNT; ++beetleIndex )
+	for( Beetle& currentBeetle : m_beetles )
 	{
-		currentBeetle = m_beetles[beetleIndex];
-
-		if( currentBeetle != nullptr && DoEntitiesOverlap( currentBeetle, collider ) )
+		if( DoEntitiesOverlap( &currentBeetle, collider ) )
 		{
 			collider->TakeDamage( 1 );
 			if( collider->IsDead() )
 			{
-				SpawnDebris( collider, currentBeetle );
+				SpawnDebris( collider, &currentBeetle );
 			}
 
-			currentBeetle->TakeDamage( 1 );
-			if( currentBeetle->IsDead() )
+			currentBeetle.TakeDamage( 1 );
+			if( currentBeetle.IsDead() )
 			{
-				SpawnDebris( currentBeetle, collider );
+				SpawnDebris( &currentBeetle, collider );
 			}
 		}
 	}
@@ -618,24 +491,20 @@ void Game::CheckBeetleCollisionsWithEntity( Entity* collider )
 //---------------------------------------------------------------------------------------------------------
 void Game::CheckWaspCollisionsWithEntity( Entity* collider )
 {
-	Wasp* currentWasp;
-
-	for( int waspIndex = 0; waspIndex < MAX_WASP_COUNT; ++waspIndex )
+	for( Wasp& currentWasp : m_wasps )
 	{
-		currentWasp = m_wasps[ waspIndex ];
-
-		if( currentWasp != nullptr && DoEntitiesOverlap( currentWasp, collider ) )
+		if( DoEntitiesOverlap( &currentWasp, collider ) )
 		{
 			collider->TakeDamage( 1 );
 			if( collider->IsDead() )
 			{
-				SpawnDebris( collider, currentWasp );
+				SpawnDebris( collider, &currentWasp );
 			}
 
-			currentWasp->TakeDamage( 1 );
-			if( currentWasp->IsDead() )
+			currentWasp.TakeDamage( 1 );
+			if( currentWasp.IsDead() )
 			{
-				SpawnDebris( currentWasp, collider );
+				SpawnDebris( &currentWasp, collider );
 			}
 		}
 	}
@@ -643,7 +512,7 @@ void Game::CheckWaspCollisionsWithEntity( Entity* collider )
 
 
 //---------------------------------------------------------------------------------------------------------
-bool Game::DoEntitiesOverlap( Entity* A, Entity* B)
+bool Game::DoEntitiesOverlap( Entity const* A, Entity const* B )
 {
 	if( !A->IsDead() && !B->IsDead())
 	{
@@ -654,69 +523,36 @@ bool Game::DoEntitiesOverlap( Entity* A, Entity* B)
 
 
 //---------------------------------------------------------------------------------------------------------
-void Game::DrawLineBetweenEntities( Entity* A, Entity* B ) const
+void Game::DrawLineBetweenEntities( Entity const* A, Entity const* B ) const
 {
 	DrawLineBetweenPoints( A->GetPosition(), B->GetPosition(), Rgba8( 50, 50, 50, 255 ), 0.15f );
 }
 
 
 //---------------------------------------------------------------------------------------------------------
-void Game::DeleteGarbageEntities()
+// Walked back to front so the object DestroyAtIndex moves into the hole has already been checked
+//---------------------------------------------------------------------------------------------------------
+template<typename T>
+static void DeleteGarbageFromPool( HandlePool<T>& pool )
 {
-	//Delete Bullets
-	for( int numBullets = 0; numBullets < MAX_BULLET_COUNT; ++numBullets )
-	{
-		Bullet* currentBullet = m_bullets[ numBullets ];
-		if( currentBullet != nullptr && currentBullet->IsGarbage() )
-		{
-			delete currentBullet;
-			m_bullets[numBullets] = nullptr;
-		}
-	}
-
-	//Delete Asteroids
-	for( int asteroidIndex = 0; asteroidIndex < MAX_ASTEROID_COUNT; ++asteroidIndex )
-	{
-		Asteroid* currentAsteroid = m_asteroids[ asteroidIndex ];
-		if( currentAsteroid != nullptr && currentAsteroid->IsGarbage() )
-		{
-			delete currentAsteroid;
-			m_asteroids[ asteroidIndex ] = nullptr;
-		}
-	}
-
-	//Delete Beetles
-	for( int beetleIndex = 0; beetleIndex < MAX_BEETLE_COUNT; ++beetleIndex )
+	for( uint32_t poolIndex = pool.GetCount(); poolIndex > 0; --poolIndex )
 	{
-		Beetle* currentBeetle = m_beetles[ beetleIndex ];
-		if( currentBeetle != nullptr && currentBeetle->IsGarbage() )
+		if( pool[ poolIndex - 1 ].IsGarbage() )
 		{
-			delete currentBeetle;
-			m_beetles[ beetleIndex ] = nullptr;
+			pool.DestroyAtIndex( poolIndex - 1 );
 		}
 	}
+}
 
-	//Delete Wasps
-	for( int waspIndex = 0; waspIndex < MAX_WASP_COUNT; ++waspIndex )
-	{
-		Wasp* currentWasp = m_wasps[ waspIndex ];
-		if( currentWasp != nullptr && currentWasp->IsGarbage() )
-		{
-			delete currentWasp;
-			m_wasps[ waspIndex ] = nullptr;
-		}
-	}
 
-	//Delete Debris
-	for( int debrisIndex = 0; debrisIndex < MAX_DEBRIS_COUNT; ++debrisIndex )
-	{
-		Debris* currentDebris = m_debris[ debrisIndex ];
-		if( currentDebris != nullptr && currentDebris->IsGarbage() )
-		{
-			delete currentDebris;
-			m_debris[ debrisIndex ] = nullptr;
-		}
-	}
+//---------------------------------------------------------------------------------------------------------
+void Game::DeleteGarbageEntities()
+{
+	DeleteGarbageFromPool( m_bullets );
+	DeleteGarbageFromPool( m_asteroids );
+	DeleteGarbageFromPool( m_beetles );
+	DeleteGarbageFromPool( m_wasps );
+	DeleteGarbageFromPool( m_debris );
 }
 
 
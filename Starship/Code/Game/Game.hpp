@@ -1,15 +1,16 @@
 #pragma once
 #include "Engine/Renderer/Camera.hpp"
+#include "Engine/Core/HandlePool.hpp"
 #include "Game/GameCommon.hpp"
+#include "Game/Bullet.hpp"
+#include "Game/Asteroid.hpp"
+#include "Game/Beetle.hpp"
+#include "Game/Wasp.hpp"
+#include "Game/Debris.hpp"
 
 class Camera;
 class Entity;
 class PlayerShip;
-class Bullet;
-class Asteroid;
-class Beetle;
-class Wasp;
-class Debris;
 enum  GameState;
 
 enum Waves
@@ -62,8 +63,8 @@ public:
 	void CheckAsteroidCollisionsWithEntity( Entity* entityArrayA );
 	void CheckBeetleCollisionsWithEntity( Entity* collider );
 	void CheckWaspCollisionsWithEntity( Entity* collider );
-	bool DoEntitiesOverlap( Entity* A, Entity* B );
-	void DrawLineBetweenEntities( Entity* A, Entity* B ) const;
+	bool DoEntitiesOverlap( Entity const* A, Entity const* B );
+	void DrawLineBetweenEntities( Entity const* A, Entity const* B ) const;
 	void DeleteGarbageEntities();
 	void DecrementEnemyCount();
 
@@ -78,11 +79,11 @@ public:
 	GameState m_gameState = INVALID_GAME_STATE;
 
 	PlayerShip *m_playerShip = nullptr;
-	Bullet *m_bullets[ MAX_BULLET_COUNT ] = { nullptr };
-	Asteroid *m_asteroids[ MAX_ASTEROID_COUNT ] = { nullptr };
-	Beetle *m_beetles[ MAX_BEETLE_COUNT ] = { nullptr };
-	Wasp *m_wasps[ MAX_WASP_COUNT ] = { nullptr };
-	Debris *m_debris[ MAX_DEBRIS_COUNT ] = { nullptr };
+	HandlePool<Bullet>		m_bullets	{ MAX_BULLET_COUNT };
+	HandlePool<Asteroid>	m_asteroids	{ MAX_ASTEROID_COUNT };
+	HandlePool<Beetle>		m_beetles	{ MAX_BEETLE_COUNT };
+	HandlePool<Wasp>		m_wasps		{ MAX_WASP_COUNT };
+	HandlePool<Debris>		m_debris	{ MAX_DEBRIS_COUNT };
 
 	Camera m_worldCamera;
 	Camera m_uiCamera;
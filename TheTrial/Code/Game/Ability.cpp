@@ -12,6 +12,7 @@
 #include "Engine/Renderer/RenderContext.hpp"
 #include "Engine/Renderer/BitmapFont.hpp"
 #include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/Clock.hpp"
 #include <vector>
 
 
@@ -26,8 +27,6 @@ Ability::Ability( Game* theGame, Actor* owner, double cooldownSeconds, std::stri
 	m_owner = owner;
 	m_name = name;
 	m_baseCooldownSeconds = cooldownSeconds;
-
-	m_cooldownTimer.SetSeconds( theGame->GetGameClock(), 0.0 );
 }
 
 
@@ -54,7 +53,6 @@ Ability::Ability( Ability const& copyFrom )
 	, m_type( copyFrom.m_type )
 	, m_name( copyFrom.m_name )
 	, m_baseCooldownSeconds( copyFrom.m_baseCooldownSeconds )
-	, m_cooldownTimer( m_cooldownTimer )
 	, m_castSound( copyFrom.m_castSound )
 	, m_castVolume( copyFrom.m_castVolume )
 {
@@ -92,7 +90,7 @@ void Ability::Render( Vec2 const& minPosition, char abilityKey ) const
 	std::string abilityStatusString = "Ready";
 	if( IsOnCooldown() )
 	{
-		double elapsedTime = m_cooldownTimer.GetSecondsRemaining();
+		double elapsedTime = m_theGame->GetGameClock()->GetTimerSecondsRemaining( m_cooldownTimer );
 		abilityStatusString = Stringf( "%.1f", elapsedTime );
 	}
 	
@@ -112,7 +110,9 @@ void Ability::Render( Vec2 const& minPosition, char abilityKey ) const
 void Ability::Use()
 {
 	double cooldownSeconds = m_baseCooldownSeconds;
-	m_cooldownTimer.SetSeconds( m_theGame->GetGameClock(), cooldownSeconds );
+	Clock* gameClock = m_theGame->GetGameClock();
+	gameClock->CancelTimer( m_cooldownTimer );
+	m_cooldownTimer = gameClock->ScheduleCallback( cooldownSeconds, nullptr );
 
 	g_theAudio->PlaySound( m_castSound, false, m_castVolume * m_theGame->GetSFXVolume() );
 }
@@ -121,7 +121,10 @@ void Ability::Use()
 //---------------------------------------------------------------------------------------------------------
 bool Ability::IsOnCooldown() const
 {
-	return !m_cooldownTimer.HasElapsed();
+	if( m_theGame == nullptr )
+		return false;
+
+	return m_theGame->GetGameClock()->IsTimerScheduled( m_cooldownTimer );
 }
 
 
@@ -129,7 +132,7 @@ bool Ability::IsOnCooldown() const
 void Ability::SetGame( Game* theGame )
 {
 	m_theGame = theGame;
-	m_cooldownTimer.SetSeconds( theGame->GetGameClock(), 0.0 );
+	m_cooldownTimer = TimerHandle::INVALID;
 }
 
 
@@ -2,7 +2,7 @@
 #include "Game/Actor.hpp"
 #include "Engine/Audio/AudioSystem.hpp"
 #include "Engine/Core/XmlUtils.hpp"
-#include "Engine/Core/Timer.hpp"
+#include "Engine/Core/TimerWheel.hpp"
 #include <string>
 #include <map>
 
@@ -63,5 +63,7 @@ protected:
 	AbilityType	m_type					= INVALID_ABILITY_TYPE;
 	std::string	m_name					= "Default Name";
 	double		m_baseCooldownSeconds	= 0.0;
-	Timer		m_cooldownTimer;
+
+	// Scheduled on the game clock when used; the ability is on cooldown for as long as the timer is live
+	TimerHandle	m_cooldownTimer;
 };
@@ -3,9 +3,11 @@
 #include "Game/GameCommon.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/Clock.hpp"
 #include "Engine/Math/AABB2.hpp"
 #include "Engine/Renderer/RenderContext.hpp"
-#include "Engine/Renderer/SpriteAnimDefinition.hpp"
+#include "Engine/Renderer/SpriteAnimSystem.hpp"
+#include "Engine/Renderer/SpriteSheet.hpp"
 #include "Engine/Renderer/MeshUtils.hpp"
 #include "Engine/Core/Vertex_PCU.hpp"
 #include "Engine/Math/RandomNumberGenerator.hpp"
@@ -14,49 +16,52 @@
 //---------------------------------------------------------------------------------------------------------
 //	StatMod
 //---------------------------------------------------------------------------------------------------------
-StatMod::StatMod( ActorStat newStatToMod, float newAmountToAdd )
+StatMod::StatMod( ActorStat newStatToMod, float newAmount, StatModType newModType )
 {
 	statToMod = newStatToMod;
-	amountToAdd = newAmountToAdd;
+	modType = newModType;
+	amount = newAmount;
 }
 //---------------------------------------------------------------------------------------------------------
 
 
 //---------------------------------------------------------------------------------------------------------
-//	StatusEffect
-//---------------------------------------------------------------------------------------------------------
-bool StatusEffect::HasExpired()
-{
-	return statusEffectTimer.HasElapsed();
-}
+// Actor
 //---------------------------------------------------------------------------------------------------------
+STATIC HandlePool<Actor*> Actor::s_actorHandles( MAX_ACTOR_COUNT );
 
 
-//---------------------------------------------------------------------------------------------------------
-// Actor
 //---------------------------------------------------------------------------------------------------------
 Actor::Actor( Game* theGame, float movementSpeed, float attacksPerSecond, int attackDamage, float critChanceFraction )
 	: Entity( theGame )
 {
-	m_movementSpeedPerSecond = movementSpeed;
-	m_attacksPerSecond = attacksPerSecond;
-	m_attackDamage = attackDamage;
-	m_critChanceFraction = critChanceFraction;
-	
-	m_attackTimer.SetSeconds( theGame->GetGameClock(), 0.0 );
+	m_stats.SetBaseValue( STAT_CRIT_MULTIPLIER, 1.5f );
+	m_stats.SetBaseValue( STAT_CRIT_CHANCE, critChanceFraction );
+	m_stats.SetBaseValue( STAT_MOVEMENT_SPEED, movementSpeed );
+	m_stats.SetBaseValue( STAT_ATTACK_SPEED, attacksPerSecond );
+	m_stats.SetBaseValue( STAT_ATTACK_DAMAGE, static_cast<float>( attackDamage ) );
+
+	m_handle = s_actorHandles.Create( this );
+	GUARANTEE_OR_DIE( !m_handle.IsNull(), Stringf( "Cannot create Actor; maximum number of Actors is %i", MAX_ACTOR_COUNT ) );
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 Actor::Actor( Game* theGame )
-	: Entity( theGame )
+	: Actor( theGame, 1.f, 1.f, 20, 0.1f )
 {
-	m_attackTimer.SetSeconds( theGame->GetGameClock(), 0.0 );
 }
 
 //---------------------------------------------------------------------------------------------------------
 Actor::~Actor()
 {
+	SpriteAnimSystem* actorAnims = m_theGame->GetActorAnims();
+	if( actorAnims != nullptr )
+	{
+		actorAnims->DestroyInstance( m_spriteAnim );
+	}
+
+	s_actorHandles.Destroy( m_handle );
 }
 
 
@@ -88,136 +93,72 @@ void Actor::RenderHealthBar( Rgba8 const& healthBarColor ) const
 //---------------------------------------------------------------------------------------------------------
 void Actor::UpdateStatusEffects()
 {
-	for( uint statusEffectIndex = 0; statusEffectIndex < m_statusEffects.size(); ++statusEffectIndex )
-	{
-		StatusEffect* currentStatusEffect = &m_statusEffects[statusEffectIndex];
-		if( currentStatusEffect->HasExpired() )
-		{
-			RemoveStatusEffect( currentStatusEffect );
-			m_statusEffects.erase( m_statusEffects.begin() + statusEffectIndex );
-			continue;
-		}
-		else if( !currentStatusEffect->hasBeenApplied )
-		{ 
-			ApplyStatusEffect( currentStatusEffect );
-			currentStatusEffect->hasBeenApplied = true;
-		}
-	}
+	m_stats.RemoveExpiredModifiers( m_theGame->GetGameClock()->GetTotalElapsedSeconds() );
 }
 
 
 //---------------------------------------------------------------------------------------------------------
-void Actor::ApplyStatusEffect( StatusEffect* statusEffect )
+// Turning keeps the cycle where it was; a new state (walk to attack) starts its animation over
+//---------------------------------------------------------------------------------------------------------
+void Actor::UpdateAnimSpriteBasedOnMovementDirection( char const* pathToAnims, float playbackSpeed )
 {
-	StatMod* statMod	= &statusEffect->statMod;
-	ActorStat statToMod = statMod->statToMod;
-	float amountToAdd	= statMod->amountToAdd;
-	
-	switch( statToMod )
-	{
-	case STAT_CRIT_MULTIPLIER:	m_critDamageMultiplier		+= amountToAdd;						break;
-	case STAT_CRIT_CHANCE:		m_critChanceFraction		+= amountToAdd;						break;
-	case STAT_MOVEMENT_SPEED:	m_movementSpeedPerSecond	+= amountToAdd;						break;
-	case STAT_ATTACK_SPEED:		m_attacksPerSecond			+= amountToAdd;						break;
-	case STAT_ATTACK_DAMAGE:	m_attackDamage				+= static_cast<int>( amountToAdd );	break;
+	std::string currentDirection = "down";
 
-	default:
-		break;
-	}
-}
+	float directionValue = -1000.f;
+	DetermineDirection( directionValue, currentDirection, "down",	Vec2(  0.f, -1.f )	);
+	DetermineDirection( directionValue, currentDirection, "right",	Vec2(  1.f,  0.f )	);
+	DetermineDirection( directionValue, currentDirection, "left",	Vec2( -1.f,  0.f )	);
+	DetermineDirection( directionValue, currentDirection, "up",		Vec2(  0.f,  1.f )	);
 
+	char const* playerStateAsString = GetActorStateAsString( m_actorState );
+	uint32_t clip = m_theGame->GetOrCreateActorAnimClip( Stringf( "Data/Images/%s/%s/%s.png", pathToAnims, playerStateAsString, currentDirection.c_str() ) );
 
-//---------------------------------------------------------------------------------------------------------
-void Actor::RemoveStatusEffect( StatusEffect* statusEffect )
-{
-	StatMod* statMod	= &statusEffect->statMod;
-	ActorStat statToMod = statMod->statToMod;
-	float amountToAdd	= statMod->amountToAdd;
-	
-	switch( statToMod )
+	SpriteAnimSystem* actorAnims = m_theGame->GetActorAnims();
+	if( actorAnims->GetInstanceUVs( m_spriteAnim ) == nullptr )
 	{
-	case STAT_CRIT_MULTIPLIER:	m_critDamageMultiplier		-= amountToAdd;						break;
-	case STAT_CRIT_CHANCE:		m_critChanceFraction		-= amountToAdd;						break;
-	case STAT_MOVEMENT_SPEED:	m_movementSpeedPerSecond	-= amountToAdd;						break;
-	case STAT_ATTACK_SPEED:		m_attacksPerSecond			-= amountToAdd;						break;
-	case STAT_ATTACK_DAMAGE:	m_attackDamage				-= static_cast<int>( amountToAdd );	break;
-
-	default:
-		break;
+		m_spriteAnim = actorAnims->CreateInstance( clip, playbackSpeed );
 	}
-}
-
-
-//---------------------------------------------------------------------------------------------------------
-void Actor::CalculateBonusStats()
-{
-	ZeroBonusStats();
-	for( auto iter = m_heldItems.begin(); iter != m_heldItems.end(); ++iter )
+	else
 	{
-		Item const& itemStatsToAdd = Item::GetItemDefByName( iter->first );
-		for( int statModIndex = 0; statModIndex < itemStatsToAdd.GetNumStatMods(); ++statModIndex )
+		if( clip != m_spriteAnimClip )
 		{
-			StatMod const& statModToAdd = itemStatsToAdd.GetStatModAtIndex( statModIndex );
-			switch( statModToAdd.statToMod )
-			{
-			case STAT_CRIT_MULTIPLIER:	m_bonusCritDamageMultiplier		+= statModToAdd.amountToAdd * iter->second;						break;
-			case STAT_CRIT_CHANCE:		m_bonusCritChanceFraction		+= statModToAdd.amountToAdd * iter->second;						break;
-			case STAT_MOVEMENT_SPEED:	m_bonusMovementSpeedPerSecond	+= statModToAdd.amountToAdd * iter->second;						break;
-			case STAT_ATTACK_SPEED:		m_bonusAttacksPerSecond			+= statModToAdd.amountToAdd * iter->second;						break;
-			case STAT_ATTACK_DAMAGE:	m_bonusAttackDamage				+= static_cast<int>( statModToAdd.amountToAdd * iter->second );	break;
-			default:
-				break;
-			}
+			bool isNewState = playerStateAsString != GetActorStateAsString( m_spriteAnimActorState );
+			actorAnims->SetInstanceClip( m_spriteAnim, clip, isNewState );
 		}
+		actorAnims->SetInstancePlaybackSpeed( m_spriteAnim, playbackSpeed );
 	}
-}
-
 
-//---------------------------------------------------------------------------------------------------------
-void Actor::ZeroBonusStats()
-{
-	m_bonusMaxHealth				= 0; //NotImplemented
-	m_bonusCritDamageMultiplier		= 0.f;
-	m_bonusCritChanceFraction		= 0.f;
-	m_bonusMovementSpeedPerSecond	= 0.f;
-	m_bonusAttacksPerSecond			= 0.f;
-	m_bonusAttackDamage				= 0;
-	m_bonusAttackRange				= 0.f; //NotImplemented
+	m_spriteAnimClip = clip;
+	m_spriteAnimActorState = m_actorState;
 }
 
 
 //---------------------------------------------------------------------------------------------------------
-SpriteAnimDefinition* Actor::GetSpriteAnimByPath( std::string const& animName )
+// Loads the sheet up front so the first frame an actor turns doesn't hitch
+void Actor::CreateSpriteAnimFromPath( char const* filepath )
 {
-	return m_spriteAnimsBySheetName[animName];
+	m_theGame->GetOrCreateActorAnimClip( filepath );
 }
 
 
 //---------------------------------------------------------------------------------------------------------
-void Actor::UpdateAnimSpriteBasedOnMovementDirection( char const* pathToAnims )
+void Actor::RenderSpriteAnim() const
 {
-	std::string currentDirection = "down";
-
-	float directionValue = -1000.f;
-	DetermineDirection( directionValue, currentDirection, "down",	Vec2(  0.f, -1.f )	);
-	DetermineDirection( directionValue, currentDirection, "right",	Vec2(  1.f,  0.f )	);
-	DetermineDirection( directionValue, currentDirection, "left",	Vec2( -1.f,  0.f )	);
-	DetermineDirection( directionValue, currentDirection, "up",		Vec2(  0.f,  1.f )	);
+	SpriteAnimSystem const* actorAnims = m_theGame->GetActorAnims();
+	AABB2 const* spriteUVs = actorAnims->GetInstanceUVs( m_spriteAnim );
+	if( spriteUVs == nullptr )
+		return;
 
-	char const* playerStateAsString = GetActorStateAsString( m_actorState );
-	SpriteAnimDefinition* directionAnim = GetSpriteAnimByPath( Stringf( "Data/Images/%s/%s/%s.png", pathToAnims, playerStateAsString, currentDirection.c_str() ) );
-	m_anim = directionAnim;
-}
+	AABB2 worldSpriteBounds = m_renderBounds;
+	worldSpriteBounds.SetCenter( m_currentPosition );
 
+	std::vector<Vertex_PCU> verts;
+	AppendVertsForAABB2D( verts, worldSpriteBounds, Rgba8::WHITE, spriteUVs->mins, spriteUVs->maxes );
 
-//---------------------------------------------------------------------------------------------------------
-void Actor::CreateSpriteAnimFromPath( char const* filepath )
-{
-	Texture* spriteTexture = g_theRenderer->CreateOrGetTextureFromFile( filepath );
-	SpriteSheet* newSpriteSheet = new SpriteSheet( *spriteTexture, IntVec2( 6, 1 ) );
-
-	m_spriteSheets.push_back( newSpriteSheet );
-	m_spriteAnimsBySheetName[ filepath ] = new SpriteAnimDefinition( *newSpriteSheet, 0, 5, 1.f );
+	SpriteSheet const* spriteSheet = m_theGame->GetActorAnimClips().GetClipSpriteSheet( actorAnims->GetInstanceClip( m_spriteAnim ) );
+	g_theRenderer->BindTexture( &spriteSheet->GetTexture() );
+	g_theRenderer->BindShader( (Shader*)nullptr );
+	g_theRenderer->DrawVertexArray( verts );
 }
 
 //---------------------------------------------------------------------------------------------------------
@@ -285,35 +226,35 @@ int Actor::GetCritDamage() const
 //---------------------------------------------------------------------------------------------------------
 int Actor::GetAttackDamage() const
 {
-	return m_attackDamage + m_bonusAttackDamage;
+	return static_cast<int>( m_stats.GetValue( STAT_ATTACK_DAMAGE ) );
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 float Actor::GetCritMultiplier() const
 {
-	return m_critDamageMultiplier + m_bonusCritDamageMultiplier;
+	return m_stats.GetValue( STAT_CRIT_MULTIPLIER );
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 float Actor::GetMoveSpeed() const
 {
-	return m_movementSpeedPerSecond + m_bonusMovementSpeedPerSecond;
+	return m_stats.GetValue( STAT_MOVEMENT_SPEED );
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 float Actor::GetAttackSpeed() const
 {
-	return m_attacksPerSecond + m_bonusAttacksPerSecond;
+	return m_stats.GetValue( STAT_ATTACK_SPEED );
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 float Actor::GetCritChanceFraction() const
 {
-	return GetClamp( m_critChanceFraction + m_bonusCritChanceFraction, 0.f, 1.f );
+	return GetClamp( m_stats.GetValue( STAT_CRIT_CHANCE ), 0.f, 1.f );
 }
 
 
@@ -331,11 +272,8 @@ int Actor::GetDamageToDeal() const
 //---------------------------------------------------------------------------------------------------------
 void Actor::AddStatusEffect( StatMod const& statModifier, float duration )
 {
-	StatusEffect newStatusEffect;
-	newStatusEffect.statMod = statModifier;
-	newStatusEffect.statusEffectTimer.SetSeconds( m_theGame->GetGameClock(), duration );
-
-	m_statusEffects.push_back( newStatusEffect );
+	double endSeconds = m_theGame->GetGameClock()->GetTotalElapsedSeconds() + static_cast<double>( duration );
+	m_stats.AddTimedModifier( statModifier, endSeconds );
 }
 
 
@@ -363,13 +301,27 @@ void Actor::PickUpItem( Item const& itemToPickUp )
 		m_heldItems[ itemToPickUp.GetName() ] = 1;
 	}
 
-	CalculateBonusStats();
+	for( int statModIndex = 0; statModIndex < itemToPickUp.GetNumStatMods(); ++statModIndex )
+	{
+		m_stats.AddModifier( itemToPickUp.GetStatModAtIndex( statModIndex ) );
+	}
 
 	SoundID itemPickup = g_theAudio->CreateOrGetSound( "Data/Audio/itemCollect.wav" );
 	g_theAudio->PlaySound( itemPickup, false, m_theGame->GetSFXVolume() );
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+STATIC Actor* Actor::GetActorFromHandle( PoolHandle handle )
+{
+	Actor** actor = s_actorHandles.Get( handle );
+	if( actor == nullptr )
+		return nullptr;
+
+	return *actor;
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 STATIC char const* Actor::GetActorStateAsString( ActorState playerState )
 {
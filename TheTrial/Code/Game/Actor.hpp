@@ -1,33 +1,18 @@
 #pragma once
 #include "Game/Item.hpp"
 #include "Game/Entity.hpp"
-#include "Engine/Core/Timer.hpp"
+#include "Game/ActorStats.hpp"
+#include "Engine/Core/TimerWheel.hpp"
+#include "Engine/Core/HandlePool.hpp"
+#include "Engine/Renderer/SpriteAnimSystem.hpp"
 #include <string>
 #include <vector>
 #include <map>
 
 class Game;
 class Item;
-class SpriteAnimDefinition;
-class SpriteSheet;
 struct Rgba8;
 
-//---------------------------------------------------------------------------------------------------------
-struct StatusEffect
-{
-public:
-	StatMod statMod;
-	Timer	statusEffectTimer;
-	bool	hasBeenApplied		= false;
-
-public:
-	StatusEffect() = default;
-	~StatusEffect() {};
-
-	bool HasExpired();
-};
-
-
 //---------------------------------------------------------------------------------------------------------
 enum ActorState
 {
@@ -61,59 +46,46 @@ public:
 	void	PickUpItem( Item const& itemToPickUp );
 	void	SetIsMoving( bool isMoving );
 
+	PoolHandle	GetHandle() const		{ return m_handle; }
+
 protected:
 	virtual void UpdateStatusEffects();
-	virtual void ApplyStatusEffect( StatusEffect* statusEffect );
-	virtual void RemoveStatusEffect( StatusEffect* statusEffect );
 	virtual void SetMovePosition( Vec2 const& positionToMoveTo );
 
-	void CalculateBonusStats();
-	void ZeroBonusStats();
-
-	SpriteAnimDefinition* GetSpriteAnimByPath( std::string const& animName );
-	void UpdateAnimSpriteBasedOnMovementDirection( char const* pathToAnims );
+	void UpdateAnimSpriteBasedOnMovementDirection( char const* pathToAnims, float playbackSpeed );
 	void CreateSpriteAnimFromPath( char const* filepath );
+	void RenderSpriteAnim() const;
 	void DetermineDirection( float& directionValue, std::string& currentDirection, std::string const& newDirection, Vec2 const& directionVector );
 	void MoveTowardsPosition( float deltaSeconds );
 	
 
 public:
 	static char const* GetActorStateAsString( ActorState playerState );
+	static Actor* GetActorFromHandle( PoolHandle handle );
 
 protected:
 	//Stats
 	int		m_currentHealth				= 100;
 	int		m_maxHealth					= 100;
-	int		m_bonusMaxHealth			= 0;
-
-	float	m_critDamageMultiplier		= 1.5f;	
-	float	m_bonusCritDamageMultiplier	= 0.f;
-
-	float	m_movementSpeedPerSecond		= 1.f;
-	float	m_bonusMovementSpeedPerSecond	= 0.f;
-	
-	float	m_attacksPerSecond			= 1.f;
-	float	m_bonusAttacksPerSecond		= 0.f;
-	
-	int		m_attackDamage				= 20;
-	int		m_bonusAttackDamage			= 0;
-	
-	float	m_critChanceFraction		= 0.1f;
-	float	m_bonusCritChanceFraction	= 0.f;
-	
 	float	m_attackRange				= 2.f;
-	float	m_bonusAttackRange			= 0.f;
 
-	Timer m_attackTimer;
+	ActorStats	m_stats;
+
+	// Live on the game clock while the last basic attack is cooling down
+	TimerHandle m_attackTimer;
 
 	Vec2		m_positionToMoveTo;
 	ActorState	m_actorState = ACTOR_STATE_IDLE;
 
-	SpriteAnimDefinition* m_anim = nullptr;
-	std::vector<SpriteSheet*> m_spriteSheets;
-	std::map<std::string, SpriteAnimDefinition*> m_spriteAnimsBySheetName;
+	PoolHandle	m_spriteAnim;
+	uint32_t	m_spriteAnimClip		= INVALID_SPRITE_ANIM_CLIP;
+	ActorState	m_spriteAnimActorState	= ACTOR_STATE_IDLE;
 
 	//Other
-	std::vector<StatusEffect> m_statusEffects;
 	std::map<std::string, int> m_heldItems;
+	PoolHandle m_handle;
+
+private:
+	// Every live actor, so anything that targets one can hold a handle that goes stale when it is deleted
+	static HandlePool<Actor*> s_actorHandles;
 };
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include "Game/ActorStats.hpp"
+#include <algorithm>
+#include <limits>
+
+
+//---------------------------------------------------------------------------------------------------------
+ActorStats::ActorStats()
+{
+	for( int statIndex = 0; statIndex < NUM_ACTOR_STATS; ++statIndex )
+	{
+		m_baseValues[ statIndex ]	= 0.f;
+		m_values[ statIndex ]		= 0.f;
+		m_isValueDirty[ statIndex ]	= false;
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void ActorStats::SetBaseValue( ActorStat stat, float baseValue )
+{
+	m_baseValues[ stat ] = baseValue;
+	m_isValueDirty[ stat ] = true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+float ActorStats::GetValue( ActorStat stat ) const
+{
+	if( m_isValueDirty[ stat ] )
+	{
+		m_values[ stat ] = CalculateValue( stat );
+		m_isValueDirty[ stat ] = false;
+	}
+	return m_values[ stat ];
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void ActorStats::AddModifier( StatMod const& statMod )
+{
+	PushModifier( statMod, std::numeric_limits<double>::infinity() );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void ActorStats::AddTimedModifier( StatMod const& statMod, double endSeconds )
+{
+	PushModifier( statMod, endSeconds );
+
+	modifier_end_time_t endTime;
+	endTime.endSeconds	= endSeconds;
+	endTime.stat		= statMod.statToMod;
+	m_modifierEndTimes.push( endTime );
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void ActorStats::RemoveExpiredModifiers( double currentSeconds )
+{
+	bool hasExpiredModifiers[ NUM_ACTOR_STATS ] = {};
+	bool hasAnyExpired = false;
+	while( !m_modifierEndTimes.empty() && m_modifierEndTimes.top().endSeconds <= currentSeconds )
+	{
+		hasExpiredModifiers[ m_modifierEndTimes.top().stat ] = true;
+		hasAnyExpired = true;
+		m_modifierEndTimes.pop();
+	}
+
+	if( !hasAnyExpired )
+		return;
+
+	// One pass per touched stack no matter how many expired at once; remove_if keeps the survivors in order
+	for( int statIndex = 0; statIndex < NUM_ACTOR_STATS; ++statIndex )
+	{
+		if( !hasExpiredModifiers[ statIndex ] )
+			continue;
+
+		std::vector<stat_modifier_t>& modifiers = m_modifiers[ statIndex ];
+		modifiers.erase( std::remove_if( modifiers.begin(), modifiers.end(),
+			[currentSeconds]( stat_modifier_t const& modifier ) { return modifier.endSeconds <= currentSeconds; } ), modifiers.end() );
+		m_isValueDirty[ statIndex ] = true;
+	}
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+void ActorStats::PushModifier( StatMod const& statMod, double endSeconds )
+{
+	stat_modifier_t newModifier;
+	newModifier.modType		= statMod.modType;
+	newModifier.amount		= statMod.amount;
+	newModifier.endSeconds	= endSeconds;
+
+	m_modifiers[ statMod.statToMod ].push_back( newModifier );
+	m_isValueDirty[ statMod.statToMod ] = true;
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Accumulated in double and rounded once, so the same modifiers always give the same float
+//---------------------------------------------------------------------------------------------------------
+float ActorStats::CalculateValue( ActorStat stat ) const
+{
+	double totalAdded = 0.0;
+	double totalMultiplier = 1.0;
+
+	std::vector<stat_modifier_t> const& modifiers = m_modifiers[ stat ];
+	for( uint modifierIndex = 0; modifierIndex < modifiers.size(); ++modifierIndex )
+	{
+		stat_modifier_t const& modifier = modifiers[ modifierIndex ];
+		switch( modifier.modType )
+		{
+		case STAT_MOD_ADD:		totalAdded		+= static_cast<double>( modifier.amount );	break;
+		case STAT_MOD_MULTIPLY:	totalMultiplier	*= static_cast<double>( modifier.amount );	break;
+		default:
+			break;
+		}
+	}
+
+	double baseValue = static_cast<double>( m_baseValues[ stat ] );
+	return static_cast<float>( ( baseValue + totalAdded ) * totalMultiplier );
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include "Game/Item.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include <functional>
+#include <queue>
+#include <vector>
+
+
+//---------------------------------------------------------------------------------------------------------
+// Base values plus a modifier stack per stat. A stat's value is always rebuilt from its base as
+// ( base + sum of adds ) * product of multiplies, in the order the modifiers were added, so any number of
+// buffs coming and going never leaves drift behind. Values are cached and only rebuilt when a stack changes.
+//
+// Timed modifiers sit in a min-heap of end times; RemoveExpiredModifiers only looks past the heap top when
+// something has actually run out.
+//---------------------------------------------------------------------------------------------------------
+class ActorStats
+{
+public:
+	ActorStats();
+	~ActorStats() {}
+
+	void	SetBaseValue( ActorStat stat, float baseValue );
+	float	GetBaseValue( ActorStat stat ) const					{ return m_baseValues[ stat ]; }
+	float	GetValue( ActorStat stat ) const;
+
+	void	AddModifier( StatMod const& statMod );
+	void	AddTimedModifier( StatMod const& statMod, double endSeconds );
+	void	RemoveExpiredModifiers( double currentSeconds );
+
+	uint	GetModifierCount( ActorStat stat ) const				{ return static_cast<uint>( m_modifiers[ stat ].size() ); }
+	uint	GetTimedModifierCount() const							{ return static_cast<uint>( m_modifierEndTimes.size() ); }
+
+private:
+	struct stat_modifier_t
+	{
+		StatModType	modType		= STAT_MOD_ADD;
+		float		amount		= 0.f;
+		double		endSeconds	= 0.0;	// infinity for modifiers that never expire
+	};
+
+	struct modifier_end_time_t
+	{
+		double		endSeconds	= 0.0;
+		ActorStat	stat		= STAT_ATTACK_DAMAGE;
+
+		bool operator>( modifier_end_time_t const& compare ) const		{ return endSeconds > compare.endSeconds; }
+	};
+
+	void	PushModifier( StatMod const& statMod, double endSeconds );
+	float	CalculateValue( ActorStat stat ) const;
+
+private:
+	float							m_baseValues[ NUM_ACTOR_STATS ];
+	std::vector<stat_modifier_t>	m_modifiers[ NUM_ACTOR_STATS ];
+
+	mutable float					m_values[ NUM_ACTOR_STATS ];
+	mutable bool					m_isValueDirty[ NUM_ACTOR_STATS ];
+
+	std::priority_queue<modifier_end_time_t, std::vector<modifier_end_time_t>, std::greater<modifier_end_time_t>> m_modifierEndTimes;
+};
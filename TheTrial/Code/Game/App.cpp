@@ -205,4 +205,5 @@ void App::EndFrame()
 	g_theAudio->EndFrame();
 
 	DebugRenderEndFrame();
+	Clock::EndFrame();
 }
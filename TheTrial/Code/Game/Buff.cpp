@@ -22,7 +22,8 @@ Buff::Buff( XmlElement const& xmlElement )
 		{
 			std::string statToModAsString = ParseXmlAttribute( *nextValueChild, "stat", "INVALID" );
 			float amountToMod = ParseXmlAttribute( *nextValueChild, "amount", 0.f );
-			m_statMods.emplace_back( Item::GetStatTypeFromString( statToModAsString ), amountToMod );
+			StatModType modType = Item::GetStatModTypeFromString( ParseXmlAttribute( *nextValueChild, "op", "Add" ) );
+			m_statMods.emplace_back( Item::GetStatTypeFromString( statToModAsString ), amountToMod, modType );
 		}
 		nextValueChild = nextValueChild->NextSiblingElement();
 	}
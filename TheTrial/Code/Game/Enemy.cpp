@@ -11,7 +11,6 @@
 #include "Engine/Math/RandomNumberGenerator.hpp"
 #include "Engine/Renderer/RenderContext.hpp"
 #include "Engine/Renderer/SpriteSheet.hpp"
-#include "Engine/Renderer/SpriteAnimDefinition.hpp"
 #include "Engine/Renderer/MeshUtils.hpp"
 #include "Engine/Math/IntVec2.hpp"
 
@@ -21,8 +20,6 @@ Enemy::Enemy( Game* theGame, Vec2 const& position )
 	: Actor( theGame )
 {
 	m_currentPosition = position;
-	Texture* spriteTexture = g_theRenderer->CreateOrGetTextureFromFile( "Data/Images/Enemies/Skeleton/Idle/down.png" );
-	m_spriteSheet = new SpriteSheet( *spriteTexture, IntVec2( 6, 1 ) );
 
 	CreateSpriteAnimFromPath( "Data/Images/Enemies/Skeleton/Walk/down.png" );
 	CreateSpriteAnimFromPath( "Data/Images/Enemies/Skeleton/Walk/left.png" );
@@ -62,11 +59,15 @@ void Enemy::Update( float deltaSeconds )
 		}
 		else
 		{
-			m_actorState = ACTOR_STATE_IDLE;
+			// No line of sight; follow the map's flow field around whatever is in the way
+			Vec2 nextPosition = m_theWorld->GetCurrentMap()->GetNextPositionTowardPlayer( m_currentPosition );
+			m_actorState = ( nextPosition != m_currentPosition ) ? ACTOR_STATE_WALK : ACTOR_STATE_IDLE;
+			SetMovePosition( nextPosition );
+			MoveTowardsPosition( deltaSeconds );
 		}
 	}
 
-	UpdateAnimSpriteBasedOnMovementDirection( "Enemies/Skeleton" );
+	UpdateAnimSpriteBasedOnMovementDirection( "Enemies/Skeleton", GetMoveSpeed() );
 }
 
 
@@ -76,23 +77,7 @@ void Enemy::Render() const
 	if( m_isDead )
 		return;
 
-	Vec2 uvMin;
-	Vec2 uvMax;
-	std::vector<Vertex_PCU> verts;
-	AABB2 worldSpriteBounds = m_renderBounds;
-	worldSpriteBounds.SetCenter( m_currentPosition );
-
-	Clock* gameClock = g_theGame->GetGameClock();
-	float elapsedTime = static_cast<float>( gameClock->GetTotalElapsedSeconds() );
-	SpriteDefinition const& spriteDef = m_anim->GetSpriteDefAtTime( elapsedTime * GetMoveSpeed() );
-	spriteDef.GetUVs( uvMin, uvMax );
-
-	AppendVertsForAABB2D( verts, worldSpriteBounds, Rgba8::WHITE, uvMin, uvMax );
-	
-	g_theRenderer->BindTexture( &spriteDef.GetTexture() );
-	g_theRenderer->BindShader( (Shader*)nullptr );
-	g_theRenderer->DrawVertexArray( verts );
-	
+	RenderSpriteAnim();
 	RenderHealthBar( Rgba8::RED );
 
 	if( g_isDebugDraw )
@@ -140,7 +125,8 @@ void Enemy::DropRandomItem()
 //---------------------------------------------------------------------------------------------------------
 void Enemy::AttackActor( Actor* actor )
 {
-	if( !m_attackTimer.HasElapsed() )
+	Clock* gameClock = m_theGame->GetGameClock();
+	if( gameClock->IsTimerScheduled( m_attackTimer ) )
 		return;
 
 	SoundID enemyAttackSound = g_theAudio->CreateOrGetSound( "Data/Audio/enemyAttack.wav" );
@@ -148,5 +134,5 @@ void Enemy::AttackActor( Actor* actor )
 	actor->TakeDamage( GetDamageToDeal() );
 
 	float attackCooldownSeconds = 1.f / GetAttackSpeed();
-	m_attackTimer.SetSeconds( m_theGame->GetGameClock(), attackCooldownSeconds );
+	m_attackTimer = gameClock->ScheduleCallback( attackCooldownSeconds, nullptr );
 }
@@ -24,6 +24,7 @@
 #include "Engine/Core/ColorString.hpp"
 #include "Engine/Renderer/RenderContext.hpp"
 #include "Engine/Renderer/SpriteAnimDefinition.hpp"
+#include "Engine/Renderer/SpriteSheet.hpp"
 #include "Engine/Renderer/BitmapFont.hpp"
 #include "Engine/Renderer/MeshUtils.hpp"
 #include "Engine/Renderer/Shader.hpp"
@@ -71,6 +72,8 @@ void Game::StartUp()
 	m_gameClock = new Clock();
 	g_theRenderer->SetGameClock( m_gameClock );
 
+	m_actorAnims = new SpriteAnimSystem( m_actorAnimClips, MAX_ACTOR_COUNT );
+
 	g_theEventSystem->SubscribeEventCallbackFunction( "GainFocus", GainFocus );
 	g_theEventSystem->SubscribeEventCallbackFunction( "LoseFocus", LoseFocus );
 
@@ -105,6 +108,36 @@ void Game::ShutDown()
 
 	delete m_gameClock;
 	m_gameClock = nullptr;
+
+	delete m_actorAnims;
+	m_actorAnims = nullptr;
+
+	for( int sheetIndex = 0; sheetIndex < m_actorSpriteSheets.size(); ++sheetIndex )
+	{
+		delete m_actorSpriteSheets[ sheetIndex ];
+	}
+	m_actorSpriteSheets.clear();
+	m_actorAnimClipsBySheetPath.clear();
+	m_actorAnimClips.Clear();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Actor sheets are all six frames in a row, one second per loop
+//---------------------------------------------------------------------------------------------------------
+uint32_t Game::GetOrCreateActorAnimClip( std::string const& spriteSheetPath )
+{
+	auto clipIter = m_actorAnimClipsBySheetPath.find( spriteSheetPath );
+	if( clipIter != m_actorAnimClipsBySheetPath.end() )
+		return clipIter->second;
+
+	Texture* spriteTexture = g_theRenderer->CreateOrGetTextureFromFile( spriteSheetPath.c_str() );
+	SpriteSheet* spriteSheet = new SpriteSheet( *spriteTexture, IntVec2( 6, 1 ) );
+	m_actorSpriteSheets.push_back( spriteSheet );
+
+	uint32_t clip = m_actorAnimClips.AddClip( SpriteAnimDefinition( *spriteSheet, 0, 5, 1.f ) );
+	m_actorAnimClipsBySheetPath.insert( { spriteSheetPath, clip } );
+	return clip;
 }
 
 
@@ -1149,6 +1182,7 @@ void Game::UpdateStateBasedOnGameState()
 		break;
 	case GAME_STATE_PLAYING:
 		m_world->Update( deltaSeconds );
+		m_actorAnims->Update( deltaSeconds );
 		UpdateCameras();
 
 		if( m_player->IsDead() )
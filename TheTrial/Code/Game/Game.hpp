@@ -8,6 +8,9 @@
 #include "Engine/Math/Vec3.hpp"
 #include "Engine/Math/Transform.hpp"
 #include "Engine/Math/Mat44.hpp"
+#include "Engine/Renderer/SpriteAnimSystem.hpp"
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 class Entity;
@@ -22,6 +25,7 @@ class Map;
 class Cursor;
 class NamedProperties;
 class SpriteAnimDefinition;
+class SpriteSheet;
 class UIButton;
 struct Vertex_PCUTBN;
 struct AABB3;
@@ -86,6 +90,10 @@ public:
 	float	GetBackgroundVolumeFraction() const;
 	float	GetSFXVolume() const;
 
+	SpriteAnimClipTable const&	GetActorAnimClips() const	{ return m_actorAnimClips; }
+	SpriteAnimSystem*			GetActorAnims() const		{ return m_actorAnims; }
+	uint32_t					GetOrCreateActorAnimClip( std::string const& spriteSheetPath );
+
 	//Static
 	static void GainFocus( EventArgs* args );
 	static void LoseFocus( EventArgs* args );
@@ -127,6 +135,12 @@ private:
 
 	Clock* m_gameClock = nullptr;
 
+	// Every actor's animation sheet is loaded once and shared; actors only hold an instance
+	SpriteAnimClipTable							m_actorAnimClips;
+	SpriteAnimSystem*							m_actorAnims = nullptr;
+	std::unordered_map<std::string, uint32_t>	m_actorAnimClipsBySheetPath;
+	std::vector<SpriteSheet*>					m_actorSpriteSheets;
+
 	Enemy* m_hoveredEnemy	= nullptr;
 	Cursor* m_cursor		= nullptr;
 	Player* m_player		= nullptr;
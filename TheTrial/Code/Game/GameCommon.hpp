@@ -57,6 +57,7 @@ constexpr float PLAYER_DEATH_SCREEN_SHAKE_INTENSITY = 1.f;
 constexpr float DEV_CONSOLE_LINE_HEIGHT				= 0.15f;
 
 constexpr int MAX_ABILITY_COUNT		= 4;
+constexpr int MAX_ACTOR_COUNT		= 4096;
 constexpr float ABILITY_UI_WIDTH	= 1.f;
 constexpr float ABILITY_UI_HEIGHT	= 1.f;
 
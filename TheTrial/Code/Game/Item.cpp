@@ -39,8 +39,9 @@ Item::Item( XmlElement const& element )
 		std::string statTypeAsString = ParseXmlAttribute( *nextChildElement, "stat", "" );
 		ActorStat statType = GetStatTypeFromString( statTypeAsString );
 		float amountToMod = ParseXmlAttribute( *nextChildElement, "amount", 0.f );
+		StatModType modType = GetStatModTypeFromString( ParseXmlAttribute( *nextChildElement, "op", "Add" ) );
 
-		m_statMods.push_back( StatMod( statType, amountToMod ) );
+		m_statMods.push_back( StatMod( statType, amountToMod, modType ) );
 
 		nextChildElement = nextChildElement->NextSiblingElement();
 	}
@@ -129,7 +130,8 @@ void Item::DrawItemStats() const
 	for( int statIndex = 0; statIndex < m_statMods.size(); ++statIndex )
 	{
 		StatMod statMod = m_statMods[statIndex];
-		statModStrings.push_back( Stringf( "+%.2f %s", statMod.amountToAdd, GetStringForActorStat( statMod.statToMod ).c_str() ) );
+		char const* modFormat = ( statMod.modType == STAT_MOD_MULTIPLY ) ? "x%.2f %s" : "+%.2f %s";
+		statModStrings.push_back( Stringf( modFormat, statMod.amount, GetStringForActorStat( statMod.statToMod ).c_str() ) );
 	}
 
 	Vec2 maxTextDimensions;
@@ -221,6 +223,18 @@ STATIC ActorStat Item::GetStatTypeFromString( std::string const& statTypeAsStrin
 }
 
 
+//---------------------------------------------------------------------------------------------------------
+STATIC StatModType Item::GetStatModTypeFromString( std::string const& modTypeAsString )
+{
+	if( modTypeAsString == "Add" )				{ return STAT_MOD_ADD; }
+	else if( modTypeAsString == "Multiply" )	{ return STAT_MOD_MULTIPLY; }
+	else
+	{
+		ERROR_AND_DIE( "Read an unsupported string for stat mod type" );
+	}
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 STATIC std::string Item::GetStringForActorStat( ActorStat actorStat )
 {
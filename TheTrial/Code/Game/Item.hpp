@@ -17,6 +17,15 @@ enum ActorStat
 	STAT_MOVEMENT_SPEED,
 	STAT_ATTACK_SPEED,
 	STAT_ATTACK_DAMAGE,
+
+	NUM_ACTOR_STATS
+};
+
+//---------------------------------------------------------------------------------------------------------
+enum StatModType
+{
+	STAT_MOD_ADD,
+	STAT_MOD_MULTIPLY,
 };
 
 //---------------------------------------------------------------------------------------------------------
@@ -24,11 +33,12 @@ struct StatMod
 {
 public:
 	ActorStat statToMod = STAT_ATTACK_DAMAGE;
-	float amountToAdd = 0.f;
+	StatModType modType = STAT_MOD_ADD;
+	float amount = 0.f;
 
 public:
 	StatMod() = default;
-	StatMod( ActorStat newStatToMod, float newAmountToAdd );
+	StatMod( ActorStat newStatToMod, float newAmount, StatModType newModType = STAT_MOD_ADD );
 };
 
 
@@ -54,6 +64,7 @@ public:
 	static void			CreateItemsFromXML( const char* filepath );
 	static Item const&	GetItemDefByName( std::string const& itemName );
 	static ActorStat	GetStatTypeFromString( std::string const& statTypeAsString );
+	static StatModType	GetStatModTypeFromString( std::string const& modTypeAsString );
 	static std::string	GetStringForActorStat( ActorStat actorStat );
 	static Item*		GetRandomItem();
 
@@ -13,8 +13,10 @@
 #include "Engine/Core/Image.hpp"
 #include "Engine/Math/RandomNumberGenerator.hpp"
 #include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Math/MathUtils.hpp"
 #include "Engine/Renderer/MeshUtils.hpp"
 #include "Engine/Renderer/RenderContext.hpp"
+#include "Engine/Renderer/GPUMesh.hpp"
 #include "Engine/Renderer/SpriteSheet.hpp"
 
 
@@ -23,6 +25,7 @@ Map::Map( Game* theGame, World* theWorld, char const* imageFilepath )
 {
 	m_theGame = theGame;
 	m_theWorld = theWorld;
+	m_mapMesh = new GPUMesh( g_theRenderer );
 
 	CreateTilesFromImage( imageFilepath );
 }
@@ -31,6 +34,8 @@ Map::Map( Game* theGame, World* theWorld, char const* imageFilepath )
 //---------------------------------------------------------------------------------------------------------
 Map::~Map()
 {
+	delete m_mapMesh;
+	m_mapMesh = nullptr;
 }
 
 
@@ -43,10 +48,6 @@ void Map::CleanUpEntities()
 		{
 			m_projectiles.erase( m_projectiles.begin() + projectile );
 		}
-		else
-		{
-			static_cast<Projectile*>( m_projectiles[projectile] )->ValidateTarget();
-		}
 	}
 	for( int i = 0; i < m_entities.size(); ++i )
 	{
@@ -84,6 +85,7 @@ void Map::ClearEntities()
 void Map::Update( float deltaSeconds )
 {
 	UpdateMapVerts( deltaSeconds );
+	UpdateFlowFieldToPlayer();
 	UpdateEntites( deltaSeconds );
 	ResolveEntityOverlaps();
 	PushActorsOutOfWalls();
@@ -110,13 +112,23 @@ void Map::UpdateMapVerts( float deltaSeconds )
 {
 	UNUSED( deltaSeconds );
 
+	// Tiles only change through SetTileDefinition, so the mesh is rebuilt and uploaded on change, not per frame
+	if( !m_areMapVertsDirty )
+		return;
+
 	m_verts.clear();
 	m_verts.reserve( m_dimensions.x * m_dimensions.y * 6 );
 
 	for( int i = 0; i < m_tiles.size(); ++i )
 	{
-		m_tiles[i]->AppendVertsForRender( m_verts );
+		m_tiles[i].AppendVertsForRender( m_verts );
 	}
+
+	if( m_verts.size() > 0 )
+	{
+		m_mapMesh->UpdateVerticies( static_cast<uint>( m_verts.size() ), &m_verts[0] );
+	}
+	m_areMapVertsDirty = false;
 }
 
 
@@ -211,6 +223,36 @@ void Map::PushActorOutOfTile( Actor* actorToPush, IntVec2 currentTileCoord, int
 	}
 }
 
+
+//---------------------------------------------------------------------------------------------------------
+void Map::UpdateFlowFieldToPlayer()
+{
+	if( m_player == nullptr )
+		return;
+
+	bool wasPassabilityRebuilt = m_isPassabilityDirty;
+	if( m_isPassabilityDirty )
+	{
+		m_passability.Resize( m_dimensions, false );
+		for( int tileIndex = 0; tileIndex < m_tiles.size(); ++tileIndex )
+		{
+			if( !IsTileSolid( &m_tiles[ tileIndex ] ) )
+			{
+				m_passability.SetPassable( tileIndex, true );
+			}
+		}
+		m_isPassabilityDirty = false;
+	}
+
+	Vec2 playerPosition = m_player->GetCurrentPosition();
+	IntVec2 playerTileCoords( RoundDownToInt( playerPosition.x ), RoundDownToInt( playerPosition.y ) );
+	if( wasPassabilityRebuilt || playerTileCoords != m_flowFieldGoal )
+	{
+		m_flowFieldToPlayer.Build( m_passability, playerTileCoords );
+		m_flowFieldGoal = playerTileCoords;
+	}
+}
+
 //---------------------------------------------------------------------------------------------------------
 void Map::Render() const
 {
@@ -222,7 +264,7 @@ void Map::Render() const
 	Texture const& textureToUse = spriteSheetToUse->GetTexture();
 	g_theRenderer->BindTexture( &textureToUse );
 	g_theRenderer->BindShader( (Shader*)nullptr );
-	g_theRenderer->DrawVertexArray( m_verts );
+	g_theRenderer->DrawMesh( m_mapMesh );
 
 	if( g_isDebugDraw )
 	{
@@ -291,7 +333,7 @@ bool Map::IsPlayerInExit()
 Tile* Map::GetTileByCoords( IntVec2 const& tileCoords )
 {
 	int tileIndex = ( tileCoords.y * m_dimensions.x ) + tileCoords.x;
-	return m_tiles[ tileIndex ];
+	return &m_tiles[ tileIndex ];
 }
 
 
@@ -301,6 +343,31 @@ bool Map::IsTileSolid( Tile* tile )
 	return tile->GetTileDefinition()->IsSolid();
 }
 
+
+//---------------------------------------------------------------------------------------------------------
+void Map::SetTileDefinition( IntVec2 const& tileCoords, TileDefinition* tileDef )
+{
+	Tile* tile = GetTileByCoords( tileCoords );
+	if( tile->GetTileDefinition() != tileDef )
+	{
+		tile->SetTileDefinition( tileDef );
+		m_areMapVertsDirty = true;
+		m_isPassabilityDirty = true;
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------
+Vec2 Map::GetNextPositionTowardPlayer( Vec2 const& currentPosition ) const
+{
+	IntVec2 currentTileCoords( RoundDownToInt( currentPosition.x ), RoundDownToInt( currentPosition.y ) );
+	IntVec2 nextTileCoords = m_flowFieldToPlayer.GetNextTile( currentTileCoords );
+	if( nextTileCoords == currentTileCoords )
+		return currentPosition;
+
+	return Vec2( static_cast<float>( nextTileCoords.x ), static_cast<float>( nextTileCoords.y ) ) + ( TILE_DIMENSIONS * 0.5f );
+}
+
+
 //---------------------------------------------------------------------------------------------------------
 void Map::SpawnEnemy( int maxNumEnemies )
 {
@@ -331,7 +398,10 @@ void Map::CreateTilesFromImage( char const* filepath )
 	m_dimensions = imageToUse.GetDimensions();
 	
 	size_t mapSize = m_dimensions.x * m_dimensions.y;
-	m_tiles.resize( mapSize );
+	m_tiles.clear();
+	m_tiles.reserve( mapSize );
+	m_areMapVertsDirty = true;
+	m_isPassabilityDirty = true;
 
 	for( int i = 0; i < mapSize; ++i )
 	{
@@ -341,20 +411,20 @@ void Map::CreateTilesFromImage( char const* filepath )
 		Rgba8 texelColor = imageToUse.GetTexelColor( IntVec2( xCoord, m_dimensions.y - 1 - yCoord ) );
 
 		TileDefinition* tileDef = TileDefinition::GetTileDefWithSetColor( texelColor );
-		m_tiles[i] = new Tile( tileDef, IntVec2( xCoord, yCoord ) );
+		m_tiles.push_back( Tile( tileDef, IntVec2( xCoord, yCoord ) ) );
 
 		unsigned char texelAlpha = texelColor.a;
 		if( texelAlpha == playerSpawnAlpha )
 		{
-			m_playerSpawnPosition = m_tiles[i]->GetCenterPosition();
+			m_playerSpawnPosition = m_tiles[i].GetCenterPosition();
 		}
 		else if( texelAlpha == exitSpawnAlpha )
 		{
-			m_exitSpawnPosition = m_tiles[i]->GetCenterPosition();
+			m_exitSpawnPosition = m_tiles[i].GetCenterPosition();
 		}
 		else if( texelAlpha == enemySpawnAlpha )
 		{
-			m_enemySpawnPositions.push_back( m_tiles[i]->GetCenterPosition() );
+			m_enemySpawnPositions.push_back( m_tiles[i].GetCenterPosition() );
 		}
 	}
 }
@@ -1,6 +1,8 @@
 #pragma once
 #include "Engine/Math/IntVec2.hpp"
 #include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Math/GridPathfinding.hpp"
+#include "Game/Tile.hpp"
 #include <vector>
 
 class Game;
@@ -10,7 +12,8 @@ class Cursor;
 class Enemy;
 class Player;
 class Actor;
-struct Tile;
+class GPUMesh;
+class TileDefinition;
 struct RaycastResult;
 
 class Map
@@ -30,6 +33,7 @@ public:
 	void ResolveEntityOverlaps();
 	void PushActorsOutOfWalls();
 	void PushActorOutOfTile( Actor* actorToPush, IntVec2 currentTileCoord, int xDir, int yDir );
+	void UpdateFlowFieldToPlayer();
 
 	void Render() const;
 	void DebugRender() const;
@@ -39,6 +43,8 @@ public:
 
 	Tile* GetTileByCoords( IntVec2 const& tileCoords );
 	bool IsTileSolid( Tile* tile );
+	void SetTileDefinition( IntVec2 const& tileCoords, TileDefinition* tileDef );
+	Vec2 GetNextPositionTowardPlayer( Vec2 const& currentPosition ) const;
 
 	void SpawnEnemy( int maxNumEnemies );
 	void CreateTilesFromImage( char const* filepath );
@@ -65,7 +71,15 @@ private:
 
 	Player* m_player = nullptr;
 	std::vector<Vertex_PCU> m_verts;
-	std::vector<Tile*> m_tiles;
+	GPUMesh* m_mapMesh = nullptr;
+	bool m_areMapVertsDirty = true;
+	std::vector<Tile> m_tiles;
+
+	// Every enemy that can't see the player walks the same field, rebuilt when the player changes tile
+	PassabilityGrid m_passability;
+	FlowField m_flowFieldToPlayer;
+	IntVec2 m_flowFieldGoal = IntVec2( -1, -1 );
+	bool m_isPassabilityDirty = true;
 	std::vector<Entity*> m_entities;
 	std::vector<Entity*> m_projectiles;
 };
\ No newline at end of file
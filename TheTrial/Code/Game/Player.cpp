@@ -11,7 +11,6 @@
 #include "Engine/Renderer/MeshUtils.hpp"
 #include "Engine/Renderer/RenderContext.hpp"
 #include "Engine/Renderer/SpriteSheet.hpp"
-#include "Engine/Renderer/SpriteAnimDefinition.hpp"
 #include "Engine/Input/InputSystem.hpp"
 #include "Engine/Core/NamedStrings.hpp"
 #include "Engine/Core/Clock.hpp"
@@ -21,7 +20,7 @@
 Player::Player( Game* theGame, std::string const& characterType )
 	: Actor( theGame )
 {
-	m_movementSpeedPerSecond = 2.f;
+	m_stats.SetBaseValue( STAT_MOVEMENT_SPEED, 2.f );
 	m_characterType = characterType;
 
 	AssignAbilityToSlot( "Blink", 0 );
@@ -95,74 +94,63 @@ void Player::Update( float deltaSeconds )
 	}
 	else if( m_actorState == ACTOR_STATE_ATTACK_MOVE )
 	{
-		m_enemyTarget = m_currentMap->GetDiscOverlapEnemy( m_currentPosition, m_attackRange );
-		if( m_enemyTarget == nullptr )
+		Enemy* enemyInRange = m_currentMap->GetDiscOverlapEnemy( m_currentPosition, m_attackRange );
+		if( enemyInRange == nullptr )
 		{
+			m_enemyTarget = PoolHandle();
 			MoveTowardsPosition( deltaSeconds );
 		}
+		else
+		{
+			m_enemyTarget = enemyInRange->GetHandle();
+		}
 	}
 
-	if( m_enemyTarget != nullptr )
+	Enemy* enemyTarget = GetEnemyTarget();
+	if( enemyTarget == nullptr && !m_enemyTarget.IsNull() )
+	{
+		// Deleted since it was targeted
+		m_enemyTarget = PoolHandle();
+		m_actorState = ACTOR_STATE_IDLE;
+	}
+	else if( enemyTarget != nullptr )
 	{
-		if( m_enemyTarget->IsDead() )
+		if( enemyTarget->IsDead() )
 		{
 			m_actorState = ACTOR_STATE_IDLE;
 		}
-		else if( !DoDiscsOverlap( m_currentPosition, m_attackRange, m_enemyTarget->GetCurrentPosition(), m_enemyTarget->GetPhysicsRadius() ) )
+		else if( !DoDiscsOverlap( m_currentPosition, m_attackRange, enemyTarget->GetCurrentPosition(), enemyTarget->GetPhysicsRadius() ) )
 		{
 			m_actorState = ACTOR_STATE_WALK;
-			m_positionToMoveTo = m_enemyTarget->GetCurrentPosition();
+			m_positionToMoveTo = enemyTarget->GetCurrentPosition();
 		}
 		else
 		{
 			m_actorState = ACTOR_STATE_ATTACK;
-			BasicAttack( m_enemyTarget );
+			BasicAttack( enemyTarget );
 		}
 	}
 
 	SetAudioPlayback();
-	UpdateAnimSpriteBasedOnMovementDirection( Stringf( "Player/%s", m_characterType.c_str() ).c_str() );
+
+	float animPlaySpeed = ( m_actorState == ACTOR_STATE_ATTACK ) ? GetAttackSpeed() : GetMoveSpeed();
+	UpdateAnimSpriteBasedOnMovementDirection( Stringf( "Player/%s", m_characterType.c_str() ).c_str(), animPlaySpeed );
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 void Player::Render() const
 {
-	if( m_actorState == ACTOR_STATE_WALK && m_enemyTarget == nullptr )
+	if( m_actorState == ACTOR_STATE_WALK && m_enemyTarget.IsNull() )
 	{
 		DrawCircleAtPoint( m_positionToMoveTo, 0.1f, Rgba8::YELLOW, 0.1f );
 	}
-	else if( m_actorState == ACTOR_STATE_ATTACK_MOVE && m_enemyTarget == nullptr )
+	else if( m_actorState == ACTOR_STATE_ATTACK_MOVE && m_enemyTarget.IsNull() )
 	{
 		DrawCircleAtPoint( m_positionToMoveTo, 0.1f, Rgba8::RED, 0.1f );
 	}
 
-	Vec2 uvMin;
-	Vec2 uvMax;
-	std::vector<Vertex_PCU> verts;
-	AABB2 worldSpriteBounds = m_renderBounds;
-	worldSpriteBounds.SetCenter( m_currentPosition );
-
-	float animPlaySpeed = 0.f;
-	if( m_actorState == ACTOR_STATE_ATTACK )
-	{
-		animPlaySpeed = GetAttackSpeed();
-	}
-	else
-	{
-		animPlaySpeed = GetMoveSpeed();
-	}
-
-	Clock* gameClock = g_theGame->GetGameClock();
-	float elapsedTime = static_cast<float>( gameClock->GetTotalElapsedSeconds() );
-	SpriteDefinition const& spriteDef = m_anim->GetSpriteDefAtTime( elapsedTime * animPlaySpeed );
-	spriteDef.GetUVs( uvMin, uvMax );
-	
-	AppendVertsForAABB2D( verts, worldSpriteBounds, Rgba8::WHITE, uvMin, uvMax );
-	g_theRenderer->BindTexture( &spriteDef.GetTexture() );
-	g_theRenderer->BindShader( (Shader*)nullptr );
-	g_theRenderer->DrawVertexArray( verts );
-
+	RenderSpriteAnim();
 	RenderHealthBar( Rgba8::GREEN );
 
 	if( g_isDebugDraw )
@@ -222,7 +210,7 @@ void Player::SetCurrentPosition( Vec2 const& position )
 //---------------------------------------------------------------------------------------------------------
 void Player::SetMovePosition( Vec2 const& positionToMoveTo )
 {
-	m_enemyTarget = nullptr;
+	m_enemyTarget = PoolHandle();
 	m_positionToMoveTo = positionToMoveTo;
 }
 
@@ -245,14 +233,24 @@ void Player::SetCurrentMap( Map* map )
 //---------------------------------------------------------------------------------------------------------
 void Player::AttackEnemy( Enemy* enemyToAttack )
 {
-	m_enemyTarget = enemyToAttack;
+	m_enemyTarget = enemyToAttack->GetHandle();
+}
+
+
+//---------------------------------------------------------------------------------------------------------
+// Null once the target has been deleted; only enemies are ever targeted, so the cast is safe
+//---------------------------------------------------------------------------------------------------------
+Enemy* Player::GetEnemyTarget() const
+{
+	return static_cast<Enemy*>( Actor::GetActorFromHandle( m_enemyTarget ) );
 }
 
 
 //---------------------------------------------------------------------------------------------------------
 void Player::BasicAttack( Enemy* target )
 {
-	if( !m_attackTimer.HasElapsed() )
+	Clock* gameClock = m_theGame->GetGameClock();
+	if( gameClock->IsTimerScheduled( m_attackTimer ) )
 		return;
 
 	SoundID attackSound = g_theAudio->CreateOrGetSound( "Data/Audio/playerAttack.wav" );
@@ -263,7 +261,7 @@ void Player::BasicAttack( Enemy* target )
 	m_currentMap->AddEntityToList( newBasicAttack );
 
 	float attackCooldownSeconds = 1.f / GetAttackSpeed();
-	m_attackTimer.SetSeconds( m_theGame->GetGameClock(), attackCooldownSeconds );
+	m_attackTimer = gameClock->ScheduleCallback( attackCooldownSeconds, nullptr );
 }
 
 
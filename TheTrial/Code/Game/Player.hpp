@@ -32,13 +32,16 @@ public:
 	void SetAudioPlayback();
 	void IsWalkSoundPaused( bool isPaused );
 
+private:
+	Enemy* GetEnemyTarget() const;
+
 private:
 	Ability*	m_abilities[ 4 ]		= {};
 	char		m_abilityKeys[ 4 ]		= { 'Q', 'W', 'E', 'R' };
 	std::string m_characterType			= "char_one";
 
-	Map*	m_currentMap	= nullptr;
-	Enemy*	m_enemyTarget	= nullptr;
+	Map*		m_currentMap	= nullptr;
+	PoolHandle	m_enemyTarget;
 	
 	SoundPlaybackID m_walkingPlayback;
 };
\ No newline at end of file
@@ -11,7 +11,7 @@ Projectile::Projectile( Game* theGame, int damage, float movementSpeed, Actor* t
 	m_damage = damage;
 	m_movementSpeed = movementSpeed;
 	m_physicsRadius = 0.05f;
-	m_targetEntity = target;
+	m_targetHandle = target->GetHandle();
 }
 
 
@@ -40,17 +40,18 @@ void Projectile::Update( float deltaSeconds )
 	if( m_isDead )
 		return;
 
-	if( m_targetEntity != nullptr && DoDiscsOverlap( m_currentPosition, m_physicsRadius, m_targetEntity->GetCurrentPosition(), m_targetEntity->GetPhysicsRadius() ) )
+	Actor* target = GetTargetOrDropIt();
+	if( target != nullptr && DoDiscsOverlap( m_currentPosition, m_physicsRadius, target->GetCurrentPosition(), target->GetPhysicsRadius() ) )
 	{
-		DealDamageToActor( m_targetEntity );
+		DealDamageToActor( target );
 		return;
 	}
 	
 	Vec2 displacementToDestination;
 	float displacementProjectedDistance = 1000.f;
-	if( m_targetEntity != nullptr )
+	if( target != nullptr )
 	{
-		Vec2 positionToMoveTo = m_targetEntity->GetCurrentPosition();
+		Vec2 positionToMoveTo = target->GetCurrentPosition();
 		displacementToDestination = positionToMoveTo - m_currentPosition;
 		m_direction = displacementToDestination.GetNormalized();
 		displacementProjectedDistance = GetProjectedLength2D( displacementToDestination, m_direction );
@@ -88,21 +89,28 @@ void Projectile::Render() const
 //---------------------------------------------------------------------------------------------------------
 bool Projectile::HasTarget() const
 {
-	return m_targetEntity != nullptr;
+	return !m_targetHandle.IsNull();
 }
 
 
 //---------------------------------------------------------------------------------------------------------
-void Projectile::ValidateTarget()
+// A target that died or was deleted is dropped, and the projectile flies on in its last heading
+//---------------------------------------------------------------------------------------------------------
+Actor* Projectile::GetTargetOrDropIt()
 {
-	if( m_targetEntity != nullptr && m_targetEntity->IsDead() )
-	{
-		m_direction = m_targetEntity->GetCurrentPosition() - m_currentPosition;
-		//m_rangeRemaining = m_direction.GetLength();
-		m_direction.Normalize();
+	if( m_targetHandle.IsNull() )
+		return nullptr;
 
-		m_targetEntity = nullptr;
+	Actor* target = Actor::GetActorFromHandle( m_targetHandle );
+	if( target != nullptr && !target->IsDead() )
+		return target;
+
+	if( target != nullptr )
+	{
+		m_direction = ( target->GetCurrentPosition() - m_currentPosition ).GetNormalized();
 	}
+	m_targetHandle = PoolHandle();
+	return nullptr;
 }
 
 
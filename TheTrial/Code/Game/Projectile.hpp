@@ -1,5 +1,6 @@
 #pragma once
 #include "Game/Entity.hpp"
+#include "Engine/Core/HandlePool.hpp"
 
 class Actor;
 
@@ -14,13 +15,15 @@ public:
 	virtual void Render() const override;
 
 	bool HasTarget() const;
-	void ValidateTarget();
 	void DealDamageToActor( Actor* actorToDealDamageTo );
 
+private:
+	Actor* GetTargetOrDropIt();
+
 private:
 	float	m_movementSpeed		= 0.f;
 	int		m_damage			= 0;
 	float	m_rangeRemaining	= 0.f;
-	Actor*	m_targetEntity		= nullptr;
+	PoolHandle	m_targetHandle;
 	Vec2	m_direction			= Vec2::RIGHT;
 };
\ No newline at end of file
@@ -29,7 +29,8 @@ Target::Target( XmlElement const& xmlElement )
 		{
 			std::string statToModAsString = ParseXmlAttribute( *nextValueChild, "stat", "INVALID" );
 			float amountToMod = ParseXmlAttribute( *nextValueChild, "amount", 0.f );
-			m_statMods.emplace_back( Item::GetStatTypeFromString( statToModAsString ), amountToMod );
+			StatModType modType = Item::GetStatModTypeFromString( ParseXmlAttribute( *nextValueChild, "op", "Add" ) );
+			m_statMods.emplace_back( Item::GetStatTypeFromString( statToModAsString ), amountToMod, modType );
 		}
 		nextValueChild = nextValueChild->NextSiblingElement();
 	}